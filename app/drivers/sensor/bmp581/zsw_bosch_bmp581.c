@@ -38,6 +38,30 @@ LOG_MODULE_REGISTER(zsw_bosch_bmp581, CONFIG_ZSW_BOSCH_BMP581_LOG_LEVEL);
 
 struct bmp581_config {
     struct i2c_dt_spec i2c;
+#ifdef CONFIG_ZSW_BMP581_TRIGGER
+    struct gpio_dt_spec int_gpio;
+#endif
+};
+
+struct bmp581_data {
+    struct bmp5_sensor_data sample;
+    struct bmp5_fifo fifo;
+    uint8_t fifo_buffer[BMP5_FIFO_DATA_BUFFER_SIZE];
+    struct bmp5_sensor_data fifo_frames[BOSCH_BMP581_FIFO_MAX_FRAMES];
+    uint8_t fifo_count;
+    uint8_t fifo_threshold;
+    uint8_t fifo_decimation;
+    int32_t lower_thresh;
+    int32_t upper_thresh;
+#ifdef CONFIG_ZSW_BMP581_TRIGGER
+    const struct device *dev;
+    struct gpio_callback gpio_handler;
+    struct k_work work;
+    const struct sensor_trigger *fifo_trig;
+    sensor_trigger_handler_t fifo_handler;
+    const struct sensor_trigger *threshold_trig;
+    sensor_trigger_handler_t threshold_handler;
+#endif
 };
 
 static struct bmp5_osr_odr_press_config bmp5_osr_odr_press_cfg;
@@ -123,6 +147,75 @@ static int8_t bmp5_set_config(struct bmp5_osr_odr_press_config *p_cfg, struct bm
     return rslt;
 }
 
+/** @brief          Write the FIFO configuration. The FIFO can only be configured in standby, so this
+ *                  also clears it.
+ *  @param p_data   Driver data with the wanted threshold and decimation
+ *  @return         0 when successful
+*/
+static int bmp581_configure_fifo(struct bmp581_data *p_data)
+{
+    enum bmp5_powermode mode;
+
+    if (bmp5_get_power_mode(&mode, &bmp5_dev) != BMP5_OK) {
+        return -EFAULT;
+    }
+
+    if (bmp5_set_power_mode(BMP5_POWERMODE_STANDBY, &bmp5_dev) != BMP5_OK) {
+        return -EFAULT;
+    }
+
+    if (bmp5_get_fifo_configuration(&p_data->fifo, &bmp5_dev) != BMP5_OK) {
+        return -EFAULT;
+    }
+
+    // Raw frames, the IIR filter would delay altitude changes by minutes at low ODR.
+    p_data->fifo.frame_sel = p_data->fifo_threshold ? BMP5_FIFO_PRESSURE_DATA : BMP5_FIFO_NOT_ENABLED;
+    p_data->fifo.dec_sel = p_data->fifo_decimation;
+    p_data->fifo.mode = BMP5_FIFO_MODE_STREAMING;
+    p_data->fifo.threshold = p_data->fifo_threshold;
+    p_data->fifo.set_fifo_iir_t = BMP5_DISABLE;
+    p_data->fifo.set_fifo_iir_p = BMP5_DISABLE;
+
+    if (bmp5_set_fifo_configuration(&p_data->fifo, &bmp5_dev) != BMP5_OK) {
+        LOG_ERR("Failed to configure FIFO!");
+        return -EFAULT;
+    }
+
+    p_data->fifo_count = 0;
+
+    if ((mode != BMP5_POWERMODE_STANDBY) && (bmp5_set_power_mode(mode, &bmp5_dev) != BMP5_OK)) {
+        return -EFAULT;
+    }
+
+    return 0;
+}
+
+/** @brief          Write the out of range pressure window, centered between the lower and upper threshold.
+ *  @param p_data   Driver data with the thresholds
+ *  @return         0 when successful
+*/
+static int bmp581_configure_threshold(struct bmp581_data *p_data)
+{
+    struct bmp5_oor_press_configuration oor_cfg;
+
+    if (p_data->upper_thresh <= p_data->lower_thresh) {
+        return -EINVAL;
+    }
+
+    oor_cfg.oor_thr_p = (p_data->lower_thresh + p_data->upper_thresh) / 2;
+    oor_cfg.oor_range_p = MIN((p_data->upper_thresh - p_data->lower_thresh) / 2, BOSCH_BMP581_THRESHOLD_MAX_RANGE);
+    // Single noisy samples should not wake up the host.
+    oor_cfg.cnt_lim = BMP5_OOR_COUNT_LIMIT_3;
+    oor_cfg.oor_sel_iir_p = BMP5_DISABLE;
+
+    if (bmp5_set_oor_configuration(&oor_cfg, &bmp5_dev) != BMP5_OK) {
+        LOG_ERR("Failed to set pressure window!");
+        return -EFAULT;
+    }
+
+    return 0;
+}
+
 /** @brief
  *  @param p_dev
  *  @param channel
@@ -133,8 +226,46 @@ static int8_t bmp5_set_config(struct bmp5_osr_odr_press_config *p_cfg, struct bm
 static int bmp581_attr_set(const struct device *p_dev, enum sensor_channel channel, enum sensor_attribute attribute,
                              const struct sensor_value *p_value)
 {
+    struct bmp581_data *data = p_dev->data;
+
     __ASSERT_NO_MSG(p_value != NULL);
 
+    switch ((int)attribute) {
+        case SENSOR_ATTR_BMP581_FIFO_THRESHOLD: {
+            if ((p_value->val1 < 0) || (p_value->val1 >= BOSCH_BMP581_FIFO_MAX_FRAMES)) {
+                return -EINVAL;
+            }
+            data->fifo_threshold = p_value->val1;
+            return bmp581_configure_fifo(data);
+        }
+        case SENSOR_ATTR_BMP581_FIFO_DECIMATION: {
+            if ((p_value->val1 < BMP5_FIFO_NO_DOWNSAMPLING) || (p_value->val1 > BMP5_FIFO_DOWNSAMPLING_128X)) {
+                return -EINVAL;
+            }
+            data->fifo_decimation = p_value->val1;
+            return bmp581_configure_fifo(data);
+        }
+        case SENSOR_ATTR_LOWER_THRESH:
+        case SENSOR_ATTR_UPPER_THRESH: {
+            if (channel != SENSOR_CHAN_PRESS) {
+                return -ENOTSUP;
+            }
+            if (attribute == SENSOR_ATTR_LOWER_THRESH) {
+                data->lower_thresh = p_value->val1;
+            } else {
+                data->upper_thresh = p_value->val1;
+            }
+            // Applied once both ends of the window are set.
+            if (data->upper_thresh <= data->lower_thresh) {
+                return 0;
+            }
+            return bmp581_configure_threshold(data);
+        }
+        default: {
+            break;
+        }
+    }
+
     if (((channel != SENSOR_CHAN_ALL) && (channel != SENSOR_CHAN_AMBIENT_TEMP) && (channel != SENSOR_CHAN_PRESS)) ||
         ((attribute != SENSOR_ATTR_SAMPLING_FREQUENCY) && (attribute == SENSOR_ATTR_OVERSAMPLING))) {
         return -ENOTSUP;
@@ -227,6 +358,39 @@ static int bmp581_attr_get(const struct device *p_dev, enum sensor_channel chann
     return 0;
 }
 
+/** @brief          Read all frames from the FIFO, reading empties it.
+ *  @param p_data   Driver data to store the frames in
+ *  @return         0 when successful
+*/
+static int bmp581_fifo_fetch(struct bmp581_data *p_data)
+{
+    p_data->fifo_count = 0;
+
+    if (p_data->fifo_threshold == 0) {
+        return -ENODATA;
+    }
+
+    p_data->fifo.data = p_data->fifo_buffer;
+    if (bmp5_get_fifo_len(&p_data->fifo.length, &p_data->fifo, &bmp5_dev) != BMP5_OK) {
+        return -EIO;
+    }
+
+    if (p_data->fifo.length == 0) {
+        return 0;
+    }
+
+    p_data->fifo.length = MIN(p_data->fifo.length, sizeof(p_data->fifo_buffer));
+    if ((bmp5_get_fifo_data(&p_data->fifo, &bmp5_dev) != BMP5_OK) ||
+        (bmp5_extract_fifo_data(&p_data->fifo, p_data->fifo_frames) != BMP5_OK)) {
+        LOG_ERR("FIFO read error!");
+        return -EIO;
+    }
+
+    p_data->fifo_count = MIN(p_data->fifo.fifo_count, BOSCH_BMP581_FIFO_MAX_FRAMES);
+
+    return 0;
+}
+
 /** @brief
  *  @param p_dev
  *  @param channel
@@ -235,20 +399,24 @@ static int bmp581_attr_get(const struct device *p_dev, enum sensor_channel chann
 static int bmp581_sample_fetch(const struct device *p_dev, enum sensor_channel channel)
 {
     enum pm_device_state pm_state;
-    struct bmp5_sensor_data *data = p_dev->data;
+    struct bmp581_data *data = p_dev->data;
 
     pm_device_state_get(p_dev, &pm_state);
     if (pm_state != PM_DEVICE_STATE_ACTIVE) {
         return -EFAULT;
     }
 
+    if ((int)channel == SENSOR_CHAN_BMP581_FIFO) {
+        return bmp581_fifo_fetch(data);
+    }
+
     if ((channel != SENSOR_CHAN_ALL) && (channel != SENSOR_CHAN_AMBIENT_TEMP) && (channel != SENSOR_CHAN_PRESS)) {
         return -ENOTSUP;
     }
 
     LOG_DBG("Start a new measurement...");
 
-    if (bmp5_get_sensor_data(data, &bmp5_osr_odr_press_cfg, &bmp5_dev) != BMP5_OK) {
+    if (bmp5_get_sensor_data(&data->sample, &bmp5_osr_odr_press_cfg, &bmp5_dev) != BMP5_OK) {
         LOG_ERR("Measurement error!");
     }
 
@@ -263,15 +431,22 @@ static int bmp581_sample_fetch(const struct device *p_dev, enum sensor_channel c
 */
 static int bmp581_channel_get(const struct device *p_dev, enum sensor_channel channel, struct sensor_value *p_value)
 {
-	const struct bmp5_sensor_data *data = p_dev->data;
+	const struct bmp581_data *data = p_dev->data;
 
     __ASSERT_NO_MSG(p_value != NULL);
 
     if (channel == SENSOR_CHAN_AMBIENT_TEMP) {
-        sensor_value_from_float(p_value, data->temperature);
+        sensor_value_from_float(p_value, data->sample.temperature);
     }
     else if (channel == SENSOR_CHAN_PRESS) {
-        sensor_value_from_float(p_value, data->pressure);
+        sensor_value_from_float(p_value, data->sample.pressure);
+    }
+    else if ((int)channel == SENSOR_CHAN_BMP581_FIFO) {
+        p_value[0].val1 = data->fifo_count;
+        p_value[0].val2 = 0;
+        for (int i = 0; i < data->fifo_count; i++) {
+            sensor_value_from_float(&p_value[1 + i], data->fifo_frames[i].pressure);
+        }
     }
     else {
         return -ENOTSUP;
@@ -280,9 +455,149 @@ static int bmp581_channel_get(const struct device *p_dev, enum sensor_channel ch
     return 0;
 }
 
+#ifdef CONFIG_ZSW_BMP581_TRIGGER
+/** @brief          Enable the interrupt sources that have a handler.
+ *  @param p_data   Driver data
+ *  @return         0 when successful
+*/
+static int bmp581_update_int_sources(struct bmp581_data *p_data)
+{
+    struct bmp5_int_source_select int_source = {
+        .drdy_en = BMP5_DISABLE,
+        .fifo_full_en = (p_data->fifo_handler != NULL) ? BMP5_ENABLE : BMP5_DISABLE,
+        .fifo_thres_en = (p_data->fifo_handler != NULL) ? BMP5_ENABLE : BMP5_DISABLE,
+        .oor_press_en = (p_data->threshold_handler != NULL) ? BMP5_ENABLE : BMP5_DISABLE,
+    };
+
+    if (bmp5_int_source_select(&int_source, &bmp5_dev) != BMP5_OK) {
+        return -EFAULT;
+    }
+
+    return 0;
+}
+
+/** @brief
+ *  @param p_work
+*/
+static void bmp581_worker(struct k_work *p_work)
+{
+    uint8_t status;
+    struct bmp581_data *data = CONTAINER_OF(p_work, struct bmp581_data, work);
+
+    // Reading the status also clears the latched interrupt.
+    if (bmp5_get_interrupt_status(&status, &bmp5_dev) != BMP5_OK) {
+        LOG_ERR("Can not fetch interrupt status!");
+        return;
+    }
+
+    LOG_DBG("Status: 0x%02x", status);
+
+    if ((status & (BMP5_INT_ASSERTED_FIFO_THRES | BMP5_INT_ASSERTED_FIFO_FULL)) && data->fifo_handler) {
+        data->fifo_handler(data->dev, data->fifo_trig);
+    }
+
+    if ((status & BMP5_INT_ASSERTED_PRESSURE_OOR) && data->threshold_handler) {
+        data->threshold_handler(data->dev, data->threshold_trig);
+    }
+}
+
+/** @brief
+ *  @param p_dev
+ *  @param p_cb
+ *  @param pins
+*/
+static void bmp581_gpio_on_interrupt_callback(const struct device *p_dev, struct gpio_callback *p_cb, uint32_t pins)
+{
+    ARG_UNUSED(p_dev);
+    ARG_UNUSED(pins);
+
+    struct bmp581_data *data = CONTAINER_OF(p_cb, struct bmp581_data, gpio_handler);
+
+    k_work_submit(&data->work);
+}
+
+/** @brief
+ *  @param p_dev
+ *  @return         0 when successful
+*/
+static int bmp581_init_interrupt(const struct device *p_dev)
+{
+    struct bmp581_data *data = p_dev->data;
+    const struct bmp581_config *config = p_dev->config;
+
+    if (!config->int_gpio.port) {
+        return 0;
+    }
+
+    if (!gpio_is_ready_dt(&config->int_gpio)) {
+        LOG_ERR("INT GPIO device not ready!");
+        return -ENODEV;
+    }
+
+    if (gpio_pin_configure_dt(&config->int_gpio, GPIO_INPUT)) {
+        return -EFAULT;
+    }
+
+    data->dev = p_dev;
+    k_work_init(&data->work, bmp581_worker);
+
+    gpio_init_callback(&data->gpio_handler, bmp581_gpio_on_interrupt_callback, BIT(config->int_gpio.pin));
+
+    if (gpio_add_callback(config->int_gpio.port, &data->gpio_handler)) {
+        return -EFAULT;
+    }
+
+    if (bmp5_configure_interrupt(BMP5_LATCHED, BMP5_ACTIVE_HIGH, BMP5_INTR_PUSH_PULL, BMP5_INTR_ENABLE,
+                                 &bmp5_dev) != BMP5_OK) {
+        return -EFAULT;
+    }
+
+    if (bmp581_update_int_sources(data) != 0) {
+        return -EFAULT;
+    }
+
+    return gpio_pin_interrupt_configure_dt(&config->int_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+}
+
+/** @brief
+ *  @param p_dev
+ *  @param p_trig
+ *  @param handler
+ *  @return         0 when successful
+*/
+static int bmp581_trigger_set(const struct device *p_dev, const struct sensor_trigger *p_trig,
+                              sensor_trigger_handler_t handler)
+{
+    struct bmp581_data *data = p_dev->data;
+    const struct bmp581_config *config = p_dev->config;
+
+    if (!config->int_gpio.port) {
+        return -ENOTSUP;
+    }
+
+    switch (p_trig->type) {
+        case SENSOR_TRIG_FIFO_WATERMARK:
+            data->fifo_trig = p_trig;
+            data->fifo_handler = handler;
+            break;
+        case SENSOR_TRIG_THRESHOLD:
+            data->threshold_trig = p_trig;
+            data->threshold_handler = handler;
+            break;
+        default:
+            return -ENOTSUP;
+    }
+
+    return bmp581_update_int_sources(data);
+}
+#endif
+
 static const struct sensor_driver_api bmp581_driver_api = {
     .attr_set = bmp581_attr_set,
     .attr_get = bmp581_attr_get,
+#ifdef CONFIG_ZSW_BMP581_TRIGGER
+    .trigger_set = bmp581_trigger_set,
+#endif
     .sample_fetch = bmp581_sample_fetch,
     .channel_get = bmp581_channel_get,
 };
@@ -323,6 +638,13 @@ static int bmp581_init(const struct device *p_dev)
         if (bmp5_set_config(&bmp5_osr_odr_press_cfg, &bmp5_dev) != BMP5_OK) {
             return -EFAULT;
         }
+
+#ifdef CONFIG_ZSW_BMP581_TRIGGER
+        if (bmp581_init_interrupt(p_dev) != 0) {
+            LOG_ERR("Can not initialize interrupts!");
+            return -EFAULT;
+        }
+#endif
     }
     else {
         LOG_ERR("Can not initialize BMP581!");
@@ -365,17 +687,20 @@ static int bmp581_pm_action(const struct device *p_dev, enum pm_device_action ac
 #endif
 
 #define BMP581_INIT(inst)                                               \
-    static struct bmp5_sensor_data bmp5_sensor_data_##inst;             \
+    static struct bmp581_data bmp581_data_##inst;                       \
                                                                         \
     static const struct bmp581_config bmp581_config_##inst = {          \
         .i2c = I2C_DT_SPEC_INST_GET(inst),                              \
+        IF_ENABLED(CONFIG_ZSW_BMP581_TRIGGER, (                         \
+            .int_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, int_gpios, {0}), \
+        ))                                                              \
     };                                                                  \
                                                                         \
     PM_DEVICE_DT_INST_DEFINE(inst, bmp581_pm_action);                   \
                                                                         \
     SENSOR_DEVICE_DT_INST_DEFINE(inst, bmp581_init,                     \
                   PM_DEVICE_DT_INST_GET(inst),                          \
-                  &bmp5_sensor_data_##inst,                             \
+                  &bmp581_data_##inst,                                  \
                   &bmp581_config_##inst, POST_KERNEL,                   \
                   CONFIG_SENSOR_INIT_PRIORITY,                          \
                   &bmp581_driver_api);
@@ -50,3 +50,27 @@
 #define BOSCH_BMP581_ODR_0_250_HZ                       0x1E
 #define BOSCH_BMP581_ODR_0_125_HZ                       0x1F
 #define BOSCH_BMP581_ODR_DEFAULT                        BOSCH_BMP581_ODR_0_250_HZ
+
+/** @brief Maximum number of pressure frames in the FIFO.
+*/
+#define BOSCH_BMP581_FIFO_MAX_FRAMES                    32
+
+/** @brief  Pressure frames stored in the FIFO. Fetching this channel drains the FIFO. Getting it writes the number
+ *          of frames to the first value followed by one pressure value per frame, oldest first, so it needs
+ *          BOSCH_BMP581_FIFO_MAX_FRAMES + 1 values.
+*/
+#define SENSOR_CHAN_BMP581_FIFO                         (SENSOR_CHAN_PRIV_START + 1)
+
+/** @brief Number of frames in the FIFO that fires SENSOR_TRIG_FIFO_WATERMARK, 1 to 31. 0 disables the FIFO.
+*/
+#define SENSOR_ATTR_BMP581_FIFO_THRESHOLD               (SENSOR_ATTR_PRIV_START + 1)
+
+/** @brief Only store every 2^n measurement in the FIFO, 0 to 7.
+*/
+#define SENSOR_ATTR_BMP581_FIFO_DECIMATION              (SENSOR_ATTR_PRIV_START + 2)
+
+/** @brief  Pressure window set with SENSOR_ATTR_LOWER_THRESH and SENSOR_ATTR_UPPER_THRESH on SENSOR_CHAN_PRESS,
+ *          SENSOR_TRIG_THRESHOLD fires when the pressure leaves it. The window is at most this many Pa wide
+ *          on each side of its center.
+*/
+#define BOSCH_BMP581_THRESHOLD_MAX_RANGE                255
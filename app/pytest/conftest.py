@@ -175,6 +175,30 @@ def pytest_addoption(parser):
         default=None,
         help="Shell command to run on hardware (e.g. 'app list')",
     )
+    parser.addoption(
+        "--bench-output",
+        action="store",
+        default=None,
+        help="Path for benchmark JSON results (default: /tmp/zswatch_benchmark.json)",
+    )
+    parser.addoption(
+        "--bench-baseline",
+        action="store",
+        default=None,
+        help="Benchmark baseline JSON to compare against (default: benchmark_baseline.json)",
+    )
+    parser.addoption(
+        "--bench-tolerance",
+        action="store",
+        default="0.5",
+        help="Allowed benchmark slowdown vs baseline as a fraction (default: 0.5)",
+    )
+    parser.addoption(
+        "--bench-update-baseline",
+        action="store_true",
+        default=False,
+        help="Store benchmark results as the new baseline instead of comparing",
+    )
 
 
 # Flash once per board before all tests for that board
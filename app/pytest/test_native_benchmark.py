@@ -0,0 +1,204 @@
+"""
+Native simulator performance benchmarks.
+
+Boots the native_sim build, opens a set of apps and runs the firmware ``bench``
+shell command in each. Measured per app:
+
+  render          Full frame render time (lv_refr_now after invalidating the screen)
+  task_handler    lv_task_handler duration while the app is idle on screen
+  raw_fs_read     Open + 1 KB read latency from the raw FS ("S:" drive)
+  gb_parse        Recorded Gadgetbridge GB(...) traffic parsed with ble_gadgetbridge_parse_dry_run(),
+                  nothing is published
+  history_save    zsw_history_save cost
+
+Results are written as JSON and compared against a stored baseline. A metric
+fails when its average is more than ``--bench-tolerance`` slower than baseline,
+or when it is in the baseline but missing from the run. A raw FS read error
+always fails. The baseline is machine specific, create it with
+``--bench-update-baseline`` on the machine that runs the comparison.
+
+Usage examples::
+
+    # Run and compare against benchmark_baseline.json
+    pytest test_native_benchmark.py -s
+
+    # Store a new baseline from this run
+    pytest test_native_benchmark.py -s --bench-update-baseline
+
+    # Only one app, custom output path
+    pytest test_native_benchmark.py -s --app Calc --bench-output /tmp/bench.json
+
+Options:
+    --app NAME                 Only benchmark this app
+    --exe-path PATH            Path to zephyr.exe (auto-detected if not provided)
+    --bench-output PATH        Where to write results (default: /tmp/zswatch_benchmark.json)
+    --bench-baseline PATH      Baseline to compare against (default: benchmark_baseline.json)
+    --bench-tolerance FRACTION Allowed slowdown vs baseline (default: 0.5, i.e. 50%)
+    --bench-update-baseline    Write this run as the new baseline instead of comparing
+"""
+
+import json
+import os
+import re
+import time
+
+import pytest
+from native_sim_runner import NativeSimDevice
+from test_native_app import BOOT_MARKER, BOOT_TIMEOUT, _find_exe
+
+# The watchface is benchmarked as "Watchface", without launching any app.
+WATCHFACE = "Watchface"
+DEFAULT_APPS = [WATCHFACE, "Calc", "Fitness", "Weather", "Compass", "Settings"]
+
+BENCH_ITERATIONS = 20
+BENCH_TIMEOUT = 30  # seconds
+# Time an app is left idle on screen to collect lv_task_handler samples.
+IDLE_SAMPLE_TIME = 2  # seconds
+BENCH_JSON_RE = re.compile(r"BENCH_JSON (\{.*\})")
+
+METRICS = [
+    "render", "task_handler", "raw_fs_read", "gb_parse", "history_save", "spectrum_float", "spectrum_q15",
+]
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(__file__), "benchmark_baseline.json")
+DEFAULT_OUTPUT = "/tmp/zswatch_benchmark.json"
+
+
+# ── Override conftest autouse fixtures (see test_native_app.py) ──
+
+@pytest.fixture(autouse=True)
+def prepare_device():
+    yield
+
+
+@pytest.fixture(autouse=True)
+def reset_device():
+    yield
+
+
+@pytest.fixture(scope="function", autouse=True)
+def uart_logs():
+    yield None
+
+
+# ── Helpers ───────────────────────────────────────────────────
+
+def _run_bench(sim):
+    """Run the firmware benchmark and return the parsed JSON result."""
+    already_seen = len(BENCH_JSON_RE.findall(sim.get_shell_output()))
+    sim.shell_command(f"bench run {BENCH_ITERATIONS}")
+
+    deadline = time.time() + BENCH_TIMEOUT
+    while time.time() < deadline:
+        matches = BENCH_JSON_RE.findall(sim.get_shell_output())
+        if len(matches) > already_seen:
+            return json.loads(matches[-1])
+        time.sleep(0.2)
+
+    pytest.fail(
+        f"No benchmark result within {BENCH_TIMEOUT}s.\n"
+        f"Shell output:\n" + "\n".join(sim.get_shell_output().splitlines()[-20:])
+    )
+
+
+def _bench_app(sim, app_name):
+    if app_name != WATCHFACE:
+        sim.shell_command(f"app launch {app_name}")
+        time.sleep(2)
+
+    sim.shell_command("bench reset")
+    time.sleep(IDLE_SAMPLE_TIME)
+    result = _run_bench(sim)
+
+    crash = sim.has_crash()
+    assert not crash, f"Crash while benchmarking {app_name}: {crash}"
+    assert result.get("raw_fs_err", 0) == 0, f"Raw FS read failed in {app_name}: {result['raw_fs_err']}"
+
+    if app_name != WATCHFACE:
+        sim.shell_command("app close")
+        time.sleep(1)
+
+    return result
+
+
+def _compare(results, baseline, tolerance):
+    """Return a list of human readable regressions, a baselined metric that was not measured is one."""
+    regressions = []
+    for app_name, metrics in results["apps"].items():
+        base_app = baseline.get("apps", {}).get(app_name)
+        if not base_app:
+            continue
+        for metric in METRICS:
+            current = metrics.get(metric)
+            base = base_app.get(metric)
+            if not base:
+                continue
+            if not current:
+                regressions.append(f"{app_name}/{metric}: missing, baseline has {base['avg_us']} us")
+                continue
+            limit = base["avg_us"] * (1.0 + tolerance)
+            if current["avg_us"] > limit:
+                regressions.append(
+                    f"{app_name}/{metric}: {current['avg_us']} us > "
+                    f"{base['avg_us']} us baseline (+{int(tolerance * 100)}% allowed)"
+                )
+    return regressions
+
+
+# ── Benchmark ─────────────────────────────────────────────────
+
+@pytest.mark.linux_only
+class TestNativeSimBenchmark:
+    """Performance benchmark on native_sim — no BLE required."""
+
+    @pytest.fixture(scope="class")
+    def sim(self, request):
+        exe = _find_exe(request)
+        if not exe:
+            pytest.skip("No native_sim executable found (build or provide --exe-path)")
+
+        device = NativeSimDevice(exe_path=exe)
+        device.start()
+
+        if not device.wait_for_log(BOOT_MARKER, timeout=BOOT_TIMEOUT):
+            logs = device.get_logs()
+            device.stop()
+            pytest.fail(
+                f"native_sim failed to boot within {BOOT_TIMEOUT}s.\n"
+                f"Last 30 log lines:\n" + "\n".join(logs.splitlines()[-30:])
+            )
+
+        yield device
+        device.stop()
+
+    def test_benchmark(self, sim, request):
+        """Benchmark hot paths per app and compare against the stored baseline."""
+        app_option = request.config.getoption("--app")
+        apps = [app_option] if app_option else DEFAULT_APPS
+        output_path = request.config.getoption("--bench-output") or DEFAULT_OUTPUT
+        baseline_path = request.config.getoption("--bench-baseline") or DEFAULT_BASELINE
+        tolerance = float(request.config.getoption("--bench-tolerance"))
+
+        results = {"iterations": BENCH_ITERATIONS, "apps": {}}
+        for app_name in apps:
+            results["apps"][app_name] = _bench_app(sim, app_name)
+            print(f"\n{app_name}: {json.dumps(results['apps'][app_name])}")
+
+        with open(output_path, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+        print(f"\nBenchmark results saved: {output_path}")
+
+        if request.config.getoption("--bench-update-baseline"):
+            with open(baseline_path, "w") as f:
+                json.dump(results, f, indent=2, sort_keys=True)
+            print(f"Baseline updated: {baseline_path}")
+            return
+
+        if not os.path.isfile(baseline_path):
+            pytest.skip(f"No baseline at {baseline_path}, run with --bench-update-baseline to create one")
+
+        with open(baseline_path) as f:
+            baseline = json.load(f)
+
+        regressions = _compare(results, baseline, tolerance)
+        assert not regressions, "Performance regressions:\n  " + "\n  ".join(regressions)
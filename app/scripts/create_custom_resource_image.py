@@ -3,87 +3,288 @@
 
 import os
 import argparse
+from binascii import crc32
 from struct import *
 
+try:
+    import lz4.block as lz4_block
+except ImportError:
+    lz4_block = None
+
 MAX_FILE_NAME = 32
 FILE_TABLE_MAX_LEN = 32000
 TABLE_MAGIC = 0x0A0A0A0A
+PATCH_MAGIC = 0x0B0B0B0B
+
+# The top byte of the offset field holds per-file flags, leaving 16 MB for offsets.
+FILE_OFFSET_MASK = 0x00FFFFFF
+FILE_FLAGS_SHIFT = 24
+FILE_FLAG_LZ4 = 0x01
+# Files are compressed in independent blocks of this many uncompressed bytes,
+# so the target can seek without decompressing everything before.
+COMPRESSED_BLOCK_SIZE = 4096
+# Only keep the compressed version when it saves at least this fraction.
+MIN_COMPRESSION_SAVING = 0.1
 """
 magic_number:uint32
-header_len:uint32
+header_len:uint32       Fixed size table region, a multiple of the sector size
 total_length:uint32
 num_files:uint32
 filename[MAX_FILE_NAME]
-offset:uint32
-len:uint32
-filename[MAX_FILE_NAME]
-offset:uint32
-len:uint32
+offset:uint24
+flags:uint8             FILE_FLAG_*
+len:uint32              Uncompressed length
 ...
-[file data]
+crc32:uint32[num_files] CRC32 of the uncompressed content of each file
+[padding up to header_len]
+[file data]             Placed by content, see _layout()
 table_magic:uint32
+
+Compressed file data (starts 4 byte aligned):
+block_ends:uint32[num_blocks + 1]      Relative to the end of this table, first entry is 0
+[LZ4 blocks]                           Each block starts at the previous end rounded up to 4 bytes.
+                                       A block as long as its uncompressed size is stored raw.
 """
 
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5
+LZ4_MF_LIMIT = 12
+LZ4_MAX_OFFSET = 65535
+
+
+def _lz4_write_len(out, value):
+    while value >= 255:
+        out.append(255)
+        value -= 255
+    out.append(value)
+
+
+def _lz4_emit(out, literals, offset=0, match_len=0):
+    lit_len = len(literals)
+    ml = match_len - LZ4_MIN_MATCH if offset else 0
+    out.append((min(lit_len, 15) << 4) | min(ml, 15))
+    if lit_len >= 15:
+        _lz4_write_len(out, lit_len - 15)
+    out.extend(literals)
+    if offset:
+        out.extend(pack("<H", offset))
+        if ml >= 15:
+            _lz4_write_len(out, ml - 15)
+
+
+def _lz4_compress_block_py(data):
+    """Greedy LZ4 block compressor, used when the lz4 package is not installed."""
+    out = bytearray()
+    table = {}
+    n = len(data)
+    anchor = 0
+    i = 0
+    while i < n - LZ4_MF_LIMIT:
+        key = data[i : i + LZ4_MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > LZ4_MAX_OFFSET:
+            i += 1
+            continue
+        match_len = LZ4_MIN_MATCH
+        max_len = n - LZ4_LAST_LITERALS - i
+        while match_len < max_len and data[candidate + match_len] == data[i + match_len]:
+            match_len += 1
+        _lz4_emit(out, data[anchor:i], i - candidate, match_len)
+        i += match_len
+        anchor = i
+    _lz4_emit(out, data[anchor:])
+    return bytes(out)
+
+
+def lz4_compress_block(data):
+    if lz4_block:
+        return lz4_block.compress(data, mode="high_compression", store_size=False)
+    return _lz4_compress_block_py(data)
+
+
+def compress_file(data):
+    """Return the compressed representation of data, or None if not worth it."""
+    blocks = []
+    for start in range(0, len(data), COMPRESSED_BLOCK_SIZE):
+        block = data[start : start + COMPRESSED_BLOCK_SIZE]
+        compressed = lz4_compress_block(block)
+        blocks.append(compressed if len(compressed) < len(block) else block)
+
+    # Aligned block starts let the target read with 4 byte aligned QSPI accesses.
+    body = bytearray()
+    ends = [0]
+    for block in blocks:
+        body.extend(b"\x00" * (-len(body) % 4))
+        body.extend(block)
+        ends.append(len(body))
+    compressed = pack(f"<{len(ends)}I", *ends) + body
+
+    if len(compressed) > len(data) * (1 - MIN_COMPRESSION_SAVING):
+        return None
+    return compressed
+
+
+def _round_up(value, align):
+    return (value + align - 1) // align * align
+
+
+def _parse_image(image):
+    """Return {content: offset} for all files in an existing image, or None if it can't be reused."""
+    if len(image) < 16:
+        return None
+    magic, header_len, total_len, num_files = unpack_from("<IIII", image, 0)
+    if magic != TABLE_MAGIC or total_len > len(image):
+        return None
+
+    contents = {}
+    for i in range(num_files):
+        name, offset, length = unpack_from(f"<{MAX_FILE_NAME}sII", image, 16 + i * 40)
+        flags = offset >> FILE_FLAGS_SHIFT
+        offset &= FILE_OFFSET_MASK
+        start = header_len + offset
+        stored_len = length
+        if flags & FILE_FLAG_LZ4:
+            num_blocks = (length + COMPRESSED_BLOCK_SIZE - 1) // COMPRESSED_BLOCK_SIZE
+            ends = unpack_from(f"<{num_blocks + 1}I", image, start)
+            stored_len = (num_blocks + 1) * 4 + ends[-1]
+        contents[(bytes(image[start : start + stored_len]), flags)] = offset
+    return header_len, contents
+
+
+def _layout(stored_files, base, sector_size):
+    """Content-addressed placement of the stored file data.
+
+    Identical content is stored once. Content that already is in the base image keeps its
+    offset, and new content only goes into sectors the base image does not use at all. A
+    sector holding any base data is never rewritten, so the base image stays valid on the
+    device until its file table is replaced.
+    """
+    placement = {}
+    reserved = []
+    if base:
+        for key, offset in base.items():
+            reserved.append((offset // sector_size * sector_size, _round_up(offset + len(key[0]), sector_size)))
+            if key in stored_files:
+                placement[key] = offset
+
+    gaps = []
+    end = 0
+    for start, stop in sorted(reserved):
+        if start > end:
+            gaps.append([end, start])
+        end = max(end, stop)
+
+    new_files = [key for key in stored_files if key not in placement]
+    for key in sorted(new_files, key=lambda k: len(k[0]), reverse=True):
+        size = len(key[0])
+        # Files spanning sectors start on a sector so they touch as few sectors as possible.
+        align = sector_size if size >= sector_size else 4
+        for gap in gaps:
+            start = _round_up(gap[0], align)
+            if start + size <= gap[1]:
+                gap[0] = start + size
+                break
+        else:
+            start = _round_up(end, align)
+            end = start + size
+        placement[key] = start
+    return placement
+
 
-def create_custom_raw_fs_image(img_filename, source_dir, block_size=4096):
+def create_custom_raw_fs_image(
+    img_filename, source_dir, block_size=4096, compress=False, base_img_filename=None
+):
+    """Create the raw FS image.
+
+    When base_img_filename is given, unchanged content keeps the offset it has in that
+    image, so only sectors with new content differ, see changed_sectors().
+    """
     table = {}
-    offset = 0
-    files_image = bytearray()
+    stored_files = {}
     header_images = bytearray()
+    crc_images = bytearray()
+    if compress and not lz4_block:
+        print("lz4 package not installed, using the slower built-in compressor (pip install lz4)")
     for root, dirs, files in os.walk(source_dir):
         print(f"root {root} dirs {dirs} files {files}")
-        for filename in files:
+        for filename in sorted(files):
+            if len(filename) > MAX_FILE_NAME:
+                print("Filename to long, skipping", filename, len(filename))
+                continue
             path = os.path.join(root, filename)
-            relpath = os.path.relpath(path, start=source_dir)
             print(f"Adding {path}")
             with open(path, "rb") as infile:
-                files_image.extend(infile.read())
-                table[filename] = {"offset": offset, "len": infile.tell()}
-                offset = offset + infile.tell()
-    print(table)
-    for name, data in table.items():
-        if len(name) <= MAX_FILE_NAME:
-            header_images = header_images + pack(
-                f"<{MAX_FILE_NAME}sII",
-                bytes(name, "utf-8"),
-                data["offset"],
-                data["len"],
-            )
+                data = infile.read()
+            flags = 0
+            stored = data
+            if compress:
+                compressed = compress_file(data)
+                if compressed is not None:
+                    stored = compressed
+                    flags |= FILE_FLAG_LZ4
+            key = (stored, flags)
+            stored_files[key] = True
+            table[filename] = {"key": key, "len": len(data), "flags": flags, "crc": crc32(data)}
+
+    # The table region has a fixed size, so adding files never moves the file data.
+    header_len = _round_up(16 + FILE_TABLE_MAX_LEN, block_size)
+    if len(table) * 40 > FILE_TABLE_MAX_LEN or 16 + len(table) * 44 > header_len:
+        print("File table is to big, increase the size on target size", header_len)
+        exit(1)
+
+    base = None
+    base_image = b""
+    if base_img_filename and os.path.isfile(base_img_filename):
+        with open(base_img_filename, "rb") as f:
+            base_image = f.read()
+        parsed = _parse_image(base_image)
+        if parsed and parsed[0] == header_len:
+            base = parsed[1]
+            print(f"Reusing layout of {base_img_filename}")
         else:
-            print("Filename to long, skipping", name, len(name))
+            print(f"{base_img_filename} has an incompatible layout, creating a new one")
 
-    # Insert dummy values as header length and total length so we can get the size of the header
-    fake_header = header_image = (
-        pack("<IIII", TABLE_MAGIC, len(table), 0, 0) + header_images
-    )
-    print("header len", len(fake_header))
-
-    if len(header_images) > FILE_TABLE_MAX_LEN:
-        print(
-            "File table is to big, increase the size on target size",
-            FILE_TABLE_MAX_LEN,
-            "<",
-            len(header_images),
-        )
+    placement = _layout(stored_files, base, block_size)
+    data_end = max([placement[key] + len(key[0]) for key in stored_files], default=0)
+    if base:
+        # The trailer must not land in a sector that still holds base data.
+        data_end = max([data_end] + [offset + len(key[0]) for key, offset in base.items()])
+    if data_end > FILE_OFFSET_MASK:
+        print("Image too large for the file table offset field", data_end)
         exit(1)
 
-    # Calculate padding needed to make total size (header + files + padding + trailer) a multiple of 4
-    trailer_size = 4  # Size of trailer magic number
-    current_size = len(fake_header) + len(files_image) + trailer_size
-    padding_needed = (4 - (current_size % 4)) % 4
-
-    real_header = (
-        pack(
-            "<IIII",
-            TABLE_MAGIC,
-            len(fake_header),
-            len(fake_header) + len(files_image) + padding_needed + trailer_size,
-            len(table),
+    # Space not used by this image keeps the base content so it doesn't show up as a change.
+    files_image = bytearray(b"\xff" * data_end)
+    base_data = base_image[header_len : header_len + data_end] if base else b""
+    files_image[: len(base_data)] = base_data
+    for key in stored_files:
+        offset = placement[key]
+        files_image[offset : offset + len(key[0])] = key[0]
+
+    for name, data in table.items():
+        header_images += pack(
+            f"<{MAX_FILE_NAME}sII",
+            bytes(name, "utf-8"),
+            placement[data["key"]] | (data["flags"] << FILE_FLAGS_SHIFT),
+            data["len"],
         )
-        + header_images
-    )
+        crc_images += pack("<I", data["crc"])
 
-    print(f"Creating Raw FS image: {len(table)} files, {len(files_image)} bytes")
+    # Make total size (header + files + padding + trailer) a multiple of 4
+    trailer_size = 4  # Size of trailer magic number
+    padding_needed = (4 - ((header_len + len(files_image) + trailer_size) % 4)) % 4
+    total_len = header_len + len(files_image) + padding_needed + trailer_size
+
+    # Per-file CRC32 of the uncompressed content follows the file headers.
+    real_header = pack("<IIII", TABLE_MAGIC, header_len, total_len, len(table)) + header_images + crc_images
+    real_header += b"\xff" * (header_len - len(real_header))
+
+    uncompressed_size = sum(data["len"] for data in table.values())
+    print(
+        f"Creating Raw FS image: {len(table)} files, {len(files_image)} bytes "
+        f"({uncompressed_size} bytes uncompressed)"
+    )
 
     with open(img_filename, "wb") as f:
         f.write(real_header)
@@ -93,10 +294,76 @@ def create_custom_raw_fs_image(img_filename, source_dir, block_size=4096):
         f.write(pack("<I", TABLE_MAGIC))
 
 
+def changed_sectors(img_filename, base_img_filename, sector_size=4096):
+    """Return the sector indexes of img_filename that differ from base_img_filename.
+
+    Data sectors come first and the file table sectors last, so a device keeps a valid
+    image until the new file table is written.
+    """
+    with open(img_filename, "rb") as f:
+        image = f.read()
+    base_image = b""
+    if base_img_filename and os.path.isfile(base_img_filename):
+        with open(base_img_filename, "rb") as f:
+            base_image = f.read()
+    # The rest of the last sector is erased when an image is written.
+    image += b"\xff" * (-len(image) % sector_size)
+    base_image += b"\xff" * (-len(base_image) % sector_size)
+
+    header_len = unpack_from("<I", image, 4)[0]
+    changed = []
+    for start in range(0, len(image), sector_size):
+        if image[start : start + sector_size] != base_image[start : start + sector_size]:
+            changed.append(start // sector_size)
+
+    table_sectors = header_len // sector_size
+    return [s for s in changed if s >= table_sectors] + [s for s in changed if s < table_sectors]
+
+
+def create_patch(img_filename, base_img_filename, sectors, patch_filename, sector_size=4096):
+    """Write the sectors as patch records for the full_fs_patch file on the device.
+
+    Header: magic:uint32, header_len:uint32, base_crc32:uint32
+    Record: magic:uint32, address:uint32, crc32:uint32, data[sector_size] (0xFF padded)
+
+    base_crc32 covers the file table region of the base image, the device refuses the
+    patch if its own table differs. Returns False when the two images don't have the same
+    table size, such a patch can't be applied on top of the base.
+    """
+    with open(img_filename, "rb") as f:
+        image = f.read()
+    with open(base_img_filename, "rb") as f:
+        base_image = f.read()
+
+    header_len = unpack_from("<I", image, 4)[0]
+    if len(base_image) < 16 or unpack_from("<I", base_image, 4)[0] != header_len:
+        print(f"{base_img_filename} has a different file table size, not writing a patch")
+        return False
+
+    with open(patch_filename, "wb") as f:
+        f.write(pack("<III", PATCH_MAGIC, header_len, crc32(base_image[:header_len])))
+        for sector in sectors:
+            data = image[sector * sector_size : (sector + 1) * sector_size]
+            data += b"\xff" * (sector_size - len(data))
+            f.write(pack("<III", TABLE_MAGIC, sector * sector_size, crc32(data)))
+            f.write(data)
+    return True
+
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser()
     parser.add_argument("--img-filename", default="littlefs.img")
     parser.add_argument("--block-size", type=int, default=4096)
+    parser.add_argument(
+        "--compress",
+        choices=["none", "lz4"],
+        default="lz4",
+        help="Compress files in the image, requires firmware with compressed raw FS support",
+    )
+    parser.add_argument(
+        "--base",
+        help="Previous image. Unchanged content keeps its place and a patch with the changed sectors is written",
+    )
     parser.add_argument("source")
     args = parser.parse_args()
 
@@ -104,4 +371,10 @@ if __name__ == "__main__":
     block_size = args.block_size
     source_dir = args.source
 
-    create_custom_raw_fs_image(img_filename, source_dir, block_size)
+    create_custom_raw_fs_image(
+        img_filename, source_dir, block_size, args.compress == "lz4", args.base
+    )
+    if args.base:
+        sectors = changed_sectors(img_filename, args.base, block_size)
+        if create_patch(img_filename, args.base, sectors, img_filename + ".patch", block_size):
+            print(f"{len(sectors)} changed sectors written to {img_filename}.patch")
@@ -0,0 +1,343 @@
+# Copyright (c) 2025 ZSWatch Project
+# SPDX-License-Identifier: Apache-2.0
+
+"""Convert a GIF into the ZSWatch animation format played by zsw_ui_anim.
+
+The GIF is decoded once on the host. Each frame is stored as the rectangles that
+changed since the previous frame, in native RGB565 (plus an A8 plane when the GIF
+has transparency), so the watch only copies pixels and never decodes LZW.
+
+File layout (little endian):
+
+header:
+  magic:uint32        "ZANM"
+  version:uint16      1
+  flags:uint16        bit 0: every rect has an A8 alpha plane after the colors
+  width:uint16
+  height:uint16
+  num_frames:uint16   number of frame records, including the wrap record
+  loop_count:uint16   0 = forever
+  loop_offset:uint32  file offset of the record played after the wrap record
+  max_record:uint32   size of the largest record except the first, the player reads a record at a time
+frame record:
+  size:uint32         size of the record including this field
+  delay_ms:uint16
+  num_rects:uint16
+  rect[num_rects]:
+    x:uint16, y:uint16, w:uint16, h:uint16
+    color:uint16[w * h]   RGB565
+    alpha:uint8[w * h]    only with flag bit 0
+
+The first record is the full first frame. The last record (the wrap record) changes
+the last frame back into the first frame, so looping never redraws the whole area.
+The first record is a single full rect, which is exactly an LVGL RGB565 or RGB565A8
+image, so it is read straight into the frame buffer.
+"""
+
+import argparse
+import os
+from struct import pack, unpack_from
+
+MAGIC = 0x4D4E415A  # "ZANM"
+VERSION = 1
+FLAG_ALPHA = 1 << 0
+
+# Each rect costs a header, a file read and a blit, bigger tiles mean fewer but larger rects.
+DEFAULT_TILE = 4
+
+
+def _lzw_decode(data, min_code_size, num_pixels):
+    clear = 1 << min_code_size
+    end = clear + 1
+    out = bytearray()
+    code_size = min_code_size + 1
+    table = [bytes([i]) for i in range(clear)] + [b"", b""]
+    prev = None
+    bit_pos = 0
+    total_bits = len(data) * 8
+    while bit_pos + code_size <= total_bits and len(out) < num_pixels:
+        byte_pos = bit_pos >> 3
+        raw = int.from_bytes(data[byte_pos : byte_pos + 4].ljust(4, b"\x00"), "little")
+        code = (raw >> (bit_pos & 7)) & ((1 << code_size) - 1)
+        bit_pos += code_size
+        if code == clear:
+            code_size = min_code_size + 1
+            table = table[: clear + 2]
+            prev = None
+            continue
+        if code == end:
+            break
+        if prev is None:
+            entry = table[code]
+        elif code < len(table):
+            entry = table[code]
+            table.append(prev + entry[:1])
+        else:
+            entry = prev + prev[:1]
+            table.append(entry)
+        out += entry
+        prev = entry
+        if len(table) == (1 << code_size) and code_size < 12:
+            code_size += 1
+    return out
+
+
+def _read_sub_blocks(data, pos):
+    out = bytearray()
+    while True:
+        size = data[pos]
+        pos += 1
+        if size == 0:
+            return bytes(out), pos
+        out += data[pos : pos + size]
+        pos += size
+
+
+def _parse_color_table(data, pos, size):
+    table = [tuple(data[pos + i * 3 : pos + i * 3 + 3]) for i in range(size)]
+    return table, pos + size * 3
+
+
+def decode_gif(data):
+    """Decode a GIF into a list of (rgba_frame, delay_ms) and the loop count.
+
+    Frames are full canvas lists of (r, g, b, a) tuples with disposal applied.
+    """
+    if data[:6] not in (b"GIF87a", b"GIF89a"):
+        raise ValueError("Not a GIF file")
+    width, height, packed, bg_index, _ = unpack_from("<HHBBB", data, 6)
+    pos = 13
+    global_table = None
+    if packed & 0x80:
+        global_table, pos = _parse_color_table(data, pos, 2 << (packed & 7))
+
+    canvas = [(0, 0, 0, 0)] * (width * height)
+    frames = []
+    loop_count = 0
+    delay = 100
+    transparent = None
+    disposal = 0
+
+    while pos < len(data):
+        block = data[pos]
+        pos += 1
+        if block == 0x3B:
+            break
+        if block == 0x21:
+            label = data[pos]
+            pos += 1
+            payload, pos = _read_sub_blocks(data, pos)
+            if label == 0xF9 and len(payload) >= 4:
+                flags, delay_cs, trans_index = unpack_from("<BHB", payload, 0)
+                delay = max(delay_cs * 10, 20)
+                transparent = trans_index if flags & 1 else None
+                disposal = (flags >> 2) & 7
+            elif label == 0xFF and payload[:11] == b"NETSCAPE2.0" and len(payload) >= 16:
+                loop_count = unpack_from("<H", payload, 13)[0]
+            continue
+        if block != 0x2C:
+            raise ValueError(f"Unknown GIF block 0x{block:02x}")
+
+        left, top, w, h, packed = unpack_from("<HHHHB", data, pos)
+        pos += 9
+        table = global_table
+        if packed & 0x80:
+            table, pos = _parse_color_table(data, pos, 2 << (packed & 7))
+        interlaced = packed & 0x40
+        min_code_size = data[pos]
+        pos += 1
+        lzw, pos = _read_sub_blocks(data, pos)
+        indexes = _lzw_decode(lzw, min_code_size, w * h)
+
+        rows = list(range(h))
+        if interlaced:
+            rows = list(range(0, h, 8)) + list(range(4, h, 8)) + list(range(2, h, 4)) + list(range(1, h, 2))
+
+        previous = list(canvas)
+        for src_row, y in enumerate(rows):
+            if top + y >= height:
+                continue
+            for x in range(w):
+                i = src_row * w + x
+                if i >= len(indexes) or left + x >= width:
+                    continue
+                index = indexes[i]
+                if index == transparent:
+                    continue
+                r, g, b = table[index]
+                canvas[(top + y) * width + left + x] = (r, g, b, 255)
+
+        frames.append((list(canvas), delay))
+
+        if disposal == 2:
+            for y in range(top, min(top + h, height)):
+                for x in range(left, min(left + w, width)):
+                    canvas[y * width + x] = (0, 0, 0, 0)
+        elif disposal == 3:
+            canvas = previous
+        transparent = None
+        disposal = 0
+        delay = 100
+
+    return width, height, frames, loop_count
+
+
+def _rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def _pixel(p, with_alpha, bg):
+    r, g, b, a = p
+    if not with_alpha and a < 255:
+        # Composite over the background color when there is no alpha plane
+        r = (r * a + bg[0] * (255 - a)) // 255
+        g = (g * a + bg[1] * (255 - a)) // 255
+        b = (b * a + bg[2] * (255 - a)) // 255
+        a = 255
+    return _rgb565(r, g, b), a if with_alpha else 255
+
+
+def dirty_rects(prev, cur, width, height, tile):
+    """Return (x, y, w, h) rects covering all pixels that differ.
+
+    Changes are tracked on a grid of tile x tile px. Horizontal runs of dirty tiles
+    become rects, and runs with the same columns in following tile rows are merged.
+    """
+    if prev is None:
+        return [(0, 0, width, height)]
+    tiles_x = (width + tile - 1) // tile
+    tiles_y = (height + tile - 1) // tile
+    dirty = [[False] * tiles_x for _ in range(tiles_y)]
+    for i in range(width * height):
+        if prev[i] != cur[i]:
+            dirty[(i // width) // tile][(i % width) // tile] = True
+
+    done = []
+    open_runs = {}
+    for ty in range(tiles_y + 1):
+        runs = []
+        tx = 0
+        while ty < tiles_y and tx < tiles_x:
+            if dirty[ty][tx]:
+                start = tx
+                while tx < tiles_x and dirty[ty][tx]:
+                    tx += 1
+                runs.append((start, tx))
+            else:
+                tx += 1
+        next_runs = {run: open_runs.pop(run, ty) for run in runs}
+        done += [(run, first, ty) for run, first in open_runs.items()]
+        open_runs = next_runs
+
+    rects = []
+    for (tx1, tx2), ty1, ty2 in sorted(done, key=lambda r: (r[1], r[0])):
+        x = tx1 * tile
+        y = ty1 * tile
+        rects.append((x, y, min(tx2 * tile, width) - x, min(ty2 * tile, height) - y))
+    return rects
+
+
+def _frame_record(frame, prev, delay, width, height, with_alpha, tile):
+    rects = dirty_rects(prev, frame, width, height, tile)
+    out = bytearray(pack("<IHH", 0, min(delay, 0xFFFF), len(rects)))
+    for x, y, w, h in rects:
+        out += pack("<HHHH", x, y, w, h)
+        alpha = bytearray()
+        for row in range(y, y + h):
+            for col in range(x, x + w):
+                color, a = frame[row * width + col]
+                out += pack("<H", color)
+                alpha.append(a)
+        if with_alpha:
+            out += alpha
+    out[0:4] = pack("<I", len(out))
+    return out
+
+
+def write_c_array(filename, name, data, width, height):
+    """Write the image descriptor for builds without external flash.
+
+    The bytes are not copied into the source, the build generates <name>.bin.inc from
+    the .bin in lvgl_lfs, see src/images/gifs/CMakeLists.txt.
+    """
+    with open(filename, "w") as f:
+        f.write("#include <lvgl.h>\n\n")
+        f.write("// Generated by gif_to_zsw_anim.py, played by zsw_ui_anim.\n")
+        f.write(f"static const uint8_t {name}_map[] = {{\n")
+        f.write(f"#include \"{name}.bin.inc\"\n")
+        f.write("};\n\n")
+        f.write(f"const lv_image_dsc_t {name} = {{\n")
+        f.write("    .header.cf = LV_COLOR_FORMAT_RAW,\n")
+        f.write("    .header.magic = LV_IMAGE_HEADER_MAGIC,\n")
+        f.write(f"    .header.w = {width},\n")
+        f.write(f"    .header.h = {height},\n")
+        f.write(f"    .data_size = sizeof({name}_map),\n")
+        f.write(f"    .data = {name}_map,\n")
+        f.write("};\n")
+
+
+def convert(gif_filename, out_filename, bg=(0, 0, 0), force_opaque=False, tile=DEFAULT_TILE, c_array=None):
+    with open(gif_filename, "rb") as f:
+        width, height, frames, loop_count = decode_gif(f.read())
+
+    with_alpha = not force_opaque and any(p[3] < 255 for frame, _ in frames for p in frame)
+    frames = [([_pixel(p, with_alpha, bg) for p in frame], delay) for frame, delay in frames]
+
+    records = []
+    prev = None
+    for frame, delay in frames:
+        records.append(_frame_record(frame, prev, delay, width, height, with_alpha, tile))
+        prev = frame
+    if len(frames) > 1:
+        records.append(_frame_record(frames[0][0], prev, frames[0][1], width, height, with_alpha, tile))
+
+    header_size = 24
+    loop_offset = header_size + len(records[0]) if len(records) > 1 else header_size
+    header = pack(
+        "<IHHHHHHII",
+        MAGIC,
+        VERSION,
+        FLAG_ALPHA if with_alpha else 0,
+        width,
+        height,
+        len(records),
+        loop_count,
+        loop_offset,
+        max((len(record) for record in records[1:]), default=0),
+    )
+    data = header + b"".join(records)
+    with open(out_filename, "wb") as f:
+        f.write(data)
+    if c_array:
+        write_c_array(os.path.splitext(out_filename)[0] + ".c", c_array, data, width, height)
+
+    size = os.path.getsize(out_filename)
+    print(
+        f"{gif_filename}: {width}x{height}, {len(frames)} frames, "
+        f"{'RGB565A8' if with_alpha else 'RGB565'}, {os.path.getsize(gif_filename)} -> {size} bytes"
+    )
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("gif", help="Input GIF")
+    parser.add_argument("output", help="Output animation file, for example lvgl_lfs/snoopy_anim.bin")
+    parser.add_argument(
+        "--bg",
+        default="000000",
+        help="Background color (hex) used for transparent pixels with --opaque",
+    )
+    parser.add_argument(
+        "--opaque",
+        action="store_true",
+        help="Drop transparency and composite over --bg, saves the alpha plane",
+    )
+    parser.add_argument("--tile", type=int, default=DEFAULT_TILE, help="Size of the change tracking grid in px")
+    parser.add_argument(
+        "--c-array",
+        metavar="NAME",
+        help="Also write NAME as a C array next to the output, used when images are not in external flash",
+    )
+    args = parser.parse_args()
+    bg = tuple(bytes.fromhex(args.bg))
+    convert(args.gif, args.output, bg, args.opaque, args.tile, args.c_array)
@@ -85,58 +85,79 @@ def dump_flash(jlink, file, partition):
             raise
 
 
-def load_data(jlink, file, partition):
+def _blocks_to_send(f, buffer_size, sectors):
+    """Yields (block_number, chunk) for all blocks that need to be sent."""
+    if sectors is not None:
+        for sector in sectors:
+            f.seek(sector * buffer_size)
+            chunk = f.read(buffer_size)
+            yield sector, chunk + b"\xff" * (buffer_size - len(chunk))
+        return
+
+    # Skip empty blocks, the whole partition is erased before loading
+    block_number = 0
+    chunk = f.read(buffer_size)
+    while chunk:
+        if block_number == 0 or bytearray(chunk).count(0xFF) != len(chunk):
+            yield block_number, chunk
+        block_number = block_number + 1
+        chunk = f.read(buffer_size)
+
+
+def load_data(jlink, file, partition, sectors=None):
+    """Sends file to the target partition.
+
+    Args:
+      sectors (list): optional sector indexes to send, in order. Only these sectors are
+        erased and written on target, used for delta updates of the raw FS image.
+    """
     try:
         buffer_size = 4096
-        block_number = 0
         print("FILENAME", file)
-        bytes = list(bytearray(f"LOADER_START:{partition}", "utf-8")) + [0x0]
+        start_sequence = "PATCH_START" if sectors is not None else "LOADER_START"
+        bytes = list(bytearray(f"{start_sequence}:{partition}", "utf-8")) + [0x0]
         jlink.rtt_write(2, bytes)
         time.sleep(2)
 
         with open(file, mode="rb") as f:
             num_sent = 0
-            chunk_index = 0
             file_size = os.fstat(f.fileno()).st_size
+            if sectors is not None:
+                file_size = len(sectors) * buffer_size
             print("Filesize:", file_size)
-            chunk = f.read(buffer_size)
             start_ms = round(time.time() * 1000)
-            while chunk and chunk != "" and jlink.connected():
-                to_send = list(bytearray(chunk[chunk_index:]))
-                if chunk_index == 0:
-                    to_send = (
-                        list(
-                            bytearray(
-                                pack(
-                                    "<III",
-                                    RTT_HEADER_MAGIC,
-                                    block_number * buffer_size,
-                                    crc32(bytearray(chunk[chunk_index:])),
+            for block_number, chunk in _blocks_to_send(f, buffer_size, sectors):
+                if not jlink.connected():
+                    break
+                chunk_index = 0
+                while True:
+                    to_send = list(bytearray(chunk[chunk_index:]))
+                    if chunk_index == 0:
+                        to_send = (
+                            list(
+                                bytearray(
+                                    pack(
+                                        "<III",
+                                        RTT_HEADER_MAGIC,
+                                        block_number * buffer_size,
+                                        crc32(bytearray(chunk)),
+                                    )
                                 )
                             )
+                            + to_send
                         )
-                        + to_send
-                    )
-                sent = jlink.rtt_write(2, to_send)
-                if sent == 0:
-                    continue
-                if sent != len(to_send):
-                    chunk_index = chunk_index + sent
-                    continue
+                    sent = jlink.rtt_write(2, to_send)
+                    if sent == 0:
+                        continue
+                    if sent != len(to_send):
+                        chunk_index = chunk_index + sent
+                        continue
+                    break
                 num_sent = num_sent + len(chunk)
                 print(
                     block_number, num_sent, "/", file_size, "len:", len(chunk), end="\r"
                 )
 
-                # Find next none empty block
-                chunk = f.read(buffer_size)
-                chunk_index = 0
-                while chunk and chunk != "":
-                    block_number = block_number + 1
-                    if bytearray(chunk).count(0xFF) != len(chunk):
-                        break
-                    chunk = f.read(buffer_size)
-
             end_ms = round(time.time() * 1000)
             print("Time taken:", end_ms - start_ms, "ms")
             print("Sent", num_sent, "bytes")
@@ -166,6 +187,7 @@ def rtt_run_flush_loader(
     jlink_speed="auto",
     read_data_only=False,
     serial_number=None,
+    sectors=None,
 ):
     """Creates connection to target via RTT and either writes a file or reads from flash.
 
@@ -174,6 +196,7 @@ def rtt_run_flush_loader(
       file (string): The binary file to write to target or dump target flash content in.
       read_data_only (bool): optional bool indication if flash should be read instead of written to.
       serial_number (string): JLink serial number
+      sectors (list): optional sector indexes to write, nothing else in the partition is touched.
 
     Returns:
       Always returns ``0`` or a JLinkException.
@@ -236,7 +259,7 @@ def rtt_run_flush_loader(
         if read_data_only:
             work_thread = Thread(target=dump_flash, args=(jlink, file, partition))
         else:
-            work_thread = Thread(target=load_data, args=(jlink, file, partition))
+            work_thread = Thread(target=load_data, args=(jlink, file, partition, sectors))
         work_thread.daemon = True
         work_thread.start()
         work_thread.join()
@@ -3,11 +3,18 @@
 
 from west.commands import WestCommand
 from west import log
-from create_custom_resource_image import create_custom_raw_fs_image
+from create_custom_resource_image import (
+    create_custom_raw_fs_image,
+    changed_sectors,
+    create_patch,
+)
+from binascii import crc32
+from struct import unpack_from
 from rtt_flash_loader import rtt_run_flush_loader, erase_external_flash
 from create_littlefs_resouce_image import create_littlefs_fs_image
 import sys
 import os
+import shutil
 import time
 import threading
 from pathlib import Path
@@ -82,6 +89,27 @@ class UploadFsWestCommand(WestCommand):
             help="Upload using RTT, needed for v3 watches without QSPI flash",
         )
 
+        parser.add_argument(
+            "--compress",
+            choices=["none", "lz4"],
+            default="lz4",
+            help="Compression of files in the raw image, decompressed by the firmware when read",
+        )
+
+        parser.add_argument(
+            "--delta",
+            action="store_true",
+            help="Only upload the raw image sectors that differ from --base, if the watch holds that image. "
+            "Not supported with --use_rtt, copy the generated .patch to /S/full_fs_patch instead",
+        )
+
+        parser.add_argument(
+            "--base",
+            type=str,
+            default=None,
+            help="Raw image currently on the watch, defaults to the last generated image (<image>.base)",
+        )
+
         parser.add_argument(
             "--generate_only",
             action="store_true",
@@ -119,7 +147,7 @@ class UploadFsWestCommand(WestCommand):
 
         if serial_number is None:
             print("No serial number provided and or no probe found.")
-            return
+            return 1
 
         with HighLevel.API() as api:
             with HighLevel.DebugProbe(api, serial_number) as probe:
@@ -143,6 +171,29 @@ class UploadFsWestCommand(WestCommand):
                 stop.set()
                 t.join()
                 print(f"\r# Programming: {hex_file} done in {time.time() - start:.1f}s.")
+        return 0
+
+    def device_has_image(self, serial_number, ini_file, address, base_filename):
+        """Check that the file table on the watch is the one of base_filename."""
+        with open(base_filename, "rb") as f:
+            base_image = f.read()
+        header_len = unpack_from("<I", base_image, 4)[0]
+
+        with HighLevel.API() as api:
+            with HighLevel.DebugProbe(api, serial_number) as probe:
+                probe.setup_qspi_with_ini(ini_file)
+                table = bytes(probe.read(address, header_len))
+        return crc32(table) == crc32(base_image[:header_len])
+
+    def sectors_to_hex(self, filename, sectors, address, hex_file, sector_size=4096):
+        with open(filename, "rb") as f:
+            image = f.read()
+        ih = intelhex.IntelHex()
+        for sector in sectors:
+            data = image[sector * sector_size : (sector + 1) * sector_size]
+            data += b"\xff" * (sector_size - len(data))
+            ih.puts(address + sector * sector_size, data)
+        ih.tofile(hex_file, format="hex")
 
     def erase_qspi_flash(self, serial_number, ini_file):
         if serial_number is None:
@@ -181,6 +232,7 @@ class UploadFsWestCommand(WestCommand):
         zephyr_base = Path(os.environ.get("ZEPHYR_BASE"))
         images_path = f"{zephyr_base.parent.absolute()}/app/src/images/binaries"
         qspi_flash_address = 0x10000000
+        sectors = None
         print(images_path)
         if args.read_file:
             filename = args.read_file
@@ -189,9 +241,46 @@ class UploadFsWestCommand(WestCommand):
             if args.type == "raw":
                 source_dir = f"{images_path}/S"
                 partition = partition if partition else "lvgl_raw_partition"
-                create_custom_raw_fs_image(filename, source_dir, block_size)
+                base = args.base if args.base else filename + ".base"
+                if not os.path.isfile(base):
+                    base = None
+                create_custom_raw_fs_image(
+                    filename, source_dir, block_size, args.compress == "lz4", base
+                )
                 qspi_flash_address = qspi_flash_address + 0x520000
                 print("lvgl_raw_partition partition address:", qspi_flash_address)
+                if base:
+                    sectors = changed_sectors(filename, base, block_size)
+                    if create_patch(filename, base, sectors, filename + ".patch", block_size):
+                        print(
+                            f"{len(sectors)} sectors differ from {base}, patch for /S/full_fs_patch: "
+                            f"{filename}.patch"
+                        )
+                    else:
+                        # Sectors of a different table layout don't combine with what is on the watch.
+                        sectors = None
+                if args.delta and sectors is None:
+                    print("No compatible base image found, uploading the full image")
+                if not args.delta:
+                    sectors = None
+                elif sectors is not None and args.use_rtt:
+                    # The RTT loader can't read back the table to check the base, so patching
+                    # sectors is left to full_fs_patch which checks it on the watch.
+                    print(f"--delta is not supported over RTT, uploading the full image. "
+                          f"Copy {filename}.patch to /S/full_fs_patch for a delta update")
+                    sectors = None
+                elif sectors is not None and not args.generate_only:
+                    if args.serial_number is None:
+                        args.serial_number = self.prompt_for_serial_number()
+                    if args.serial_number is None:
+                        print("No serial number provided and or no probe found.")
+                        return 1
+                    if not self.device_has_image(args.serial_number, args.ini_file, qspi_flash_address, base):
+                        print(f"The watch does not hold {base}, uploading the full image")
+                        sectors = None
+                if sectors is not None and len(sectors) == 0:
+                    print("Image on the watch is up to date, nothing to upload")
+                    return 0
             elif args.type == "lfs":
                 source_dir = f"{images_path}/lvgl_lfs"
                 partition = partition if partition else "littlefs_storage"
@@ -211,30 +300,34 @@ class UploadFsWestCommand(WestCommand):
 
         # Convert file to Intel Hex file
         hex_file = filename + ".hex"
-        ih = intelhex.IntelHex()
-        ih.loadbin(filename, qspi_flash_address)
-        ih.tofile(hex_file, format="hex")
+        if sectors is not None:
+            self.sectors_to_hex(filename, sectors, qspi_flash_address, hex_file, block_size)
+        else:
+            ih = intelhex.IntelHex()
+            ih.loadbin(filename, qspi_flash_address)
+            ih.tofile(hex_file, format="hex")
 
         log.inf("Uploading image")
         if args.use_rtt:
-            sys.exit(
-                rtt_run_flush_loader(
-                    "nRF5340_XXAA",
-                    filename,
-                    partition,
-                    args.speed,
-                    args.read_file,
-                    str(args.serial_number),
-                )
+            ret = rtt_run_flush_loader(
+                "nRF5340_XXAA",
+                filename,
+                partition,
+                args.speed,
+                args.read_file,
+                str(args.serial_number),
+                sectors,
             )
         else:
             speed = None if args.speed == "auto" else int(args.speed)
             if args.generate_only:
                 print(f"Generated {hex_file} with size {os.path.getsize(hex_file)}")
                 return 0
-            else:
-                sys.exit(
-                    self.write_to_qspi_flash(
-                        args.serial_number, hex_file, args.ini_file, speed
-                    )
-                )
+            ret = self.write_to_qspi_flash(
+                args.serial_number, hex_file, args.ini_file, speed
+            )
+
+        if ret == 0 and args.read_file is None and args.type == "raw" and args.base is None:
+            # Next delta upload is done against what is now on the watch.
+            shutil.copyfile(filename, filename + ".base")
+        sys.exit(ret)
@@ -28,6 +28,7 @@
 #include "ui/utils/zsw_ui_utils.h"
 #include "fuel_gauge/zsw_pmic.h"
 #include "battery_ui.h"
+#include "zsw_zbus_trace.h"
 
 #define SETTING_BATTERY_HIST    "battery/hist"
 #define SAMPLE_INTERVAL_MIN     15
@@ -36,6 +37,7 @@
 
 static void battery_app_start(lv_obj_t *root, lv_group_t *group);
 static void battery_app_stop(void);
+static int battery_app_load_history(void);
 
 static void zbus_battery_sample_data_callback(const struct zbus_channel *chan);
 static void on_battery_hist_clear_cb(void);
@@ -44,7 +46,7 @@ static uint8_t compresse_voltage_in_byte(int mV);
 static int decompress_voltage_from_byte(uint8_t voltage_byte);
 
 ZBUS_CHAN_DECLARE(battery_sample_data_chan);
-ZBUS_LISTENER_DEFINE(battery_app_battery_event, zbus_battery_sample_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(battery_app_battery_event, zbus_battery_sample_data_callback);
 ZBUS_CHAN_ADD_OBS(battery_sample_data_chan, battery_app_battery_event, 1);
 
 ZSW_LV_IMG_DECLARE(battery_app_icon);
@@ -65,7 +67,10 @@ static application_t app = {
     .icon = ZSW_LV_IMG_USE(battery_app_icon),
     .start_func = battery_app_start,
     .stop_func = battery_app_stop,
+    .init_func = battery_app_load_history,
     .category = ZSW_APP_CATEGORY_TOOLS,
+    // Samples the battery into the history while closed
+    .background = true,
 };
 
 static void battery_app_start(lv_obj_t *root, lv_group_t *group)
@@ -172,10 +177,8 @@ static int decompress_voltage_from_byte(uint8_t voltage_byte)
     return (voltage_byte * 10) + 3000;
 }
 
-static int battery_app_add(void)
+static int battery_app_load_history(void)
 {
-    zsw_app_manager_add_application(&app);
-
     if (settings_subsys_init()) {
         LOG_ERR("Error during settings_subsys_init!");
         return -EFAULT;
@@ -191,4 +194,11 @@ static int battery_app_add(void)
     return 0;
 }
 
+static int battery_app_add(void)
+{
+    zsw_app_manager_add_application(&app);
+
+    return 0;
+}
+
 SYS_INIT(battery_app_add, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -47,8 +47,7 @@ static application_t app = {
 };
 
 static lv_timer_t *refresh_timer;
-static bool is_calibrating;
-static uint32_t cal_start_ms;
+static bool calibration_popup_shown;
 
 static void compass_app_start(lv_obj_t *root, lv_group_t *group)
 {
@@ -63,18 +62,18 @@ static void compass_app_stop(void)
         lv_timer_del(refresh_timer);
     }
     compass_ui_remove();
-    zsw_magnetometer_stop_calibration();
     zsw_sensor_fusion_deinit();
-    if (is_calibrating) {
+    if (calibration_popup_shown) {
         zsw_popup_remove();
+        calibration_popup_shown = false;
     }
 }
 
+// Calibration runs all the time, this only starts over, for example after the watch was magnetized.
 static void on_start_calibration(void)
 {
-    zsw_magnetometer_start_calibration();
-    is_calibrating = true;
-    cal_start_ms = lv_tick_get();
+    zsw_magnetometer_reset_calibration();
+    calibration_popup_shown = true;
     zsw_popup_show("Calibration",
                    "Rotate the watch 360 degrees\naround each x,y,z.\n a few times.", NULL,
                    CONFIG_APPLICATIONS_CONFIGURATION_COMPASS_CALIBRATION_TIME_S, false);
@@ -83,16 +82,9 @@ static void on_start_calibration(void)
 static void timer_callback(lv_timer_t *timer)
 {
     float heading;
-    if (is_calibrating &&
-        (lv_tick_elaps(cal_start_ms) >= (CONFIG_APPLICATIONS_CONFIGURATION_COMPASS_CALIBRATION_TIME_S * 1000UL))) {
-        zsw_magnetometer_stop_calibration();
-        is_calibrating = false;
-        zsw_popup_remove();
-    }
-    if (!is_calibrating) {
-        zsw_sensor_fusion_get_heading(&heading);
-        compass_ui_set_heading(heading);
-    }
+
+    zsw_sensor_fusion_get_heading(&heading);
+    compass_ui_set_heading(heading);
 }
 
 static int compass_app_add(void)
@@ -0,0 +1,391 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+
+#include "fitness_activity_log.h"
+
+LOG_MODULE_REGISTER(fitness_activity_log, LOG_LEVEL_INF);
+
+#define SETTING_ACTIVITY_LOG_KEY        "fitness/act"
+#define SETTING_ACTIVITY_WEEK_KEY       "week"
+#define SETTING_ACTIVITY_HOUR_PREFIX    'h'
+
+#define MINUTES_PER_HOUR                60
+#define HOURS_PER_DAY                   24
+
+/*
+ * One log entry per minute, 14 bits of steps taken during that minute
+ * and 2 bits of zsw_imu_data_step_activity_t.
+ */
+#define ENTRY_STEPS_MASK                0x3FFF
+#define ENTRY_ACTIVITY_SHIFT            14
+#define ENTRY_ENCODE(steps, activity)   ((uint16_t)(MIN((steps), ENTRY_STEPS_MASK) | ((activity) << ENTRY_ACTIVITY_SHIFT)))
+#define ENTRY_STEPS(entry)              ((entry) & ENTRY_STEPS_MASK)
+#define ENTRY_ACTIVITY(entry)           ((zsw_imu_data_step_activity_t)((entry) >> ENTRY_ACTIVITY_SHIFT))
+
+typedef struct {
+    uint16_t year;
+    uint16_t yday;
+} log_date_t;
+
+// Flash is written one hour at a time, so a flush only costs the hours that changed.
+typedef struct {
+    log_date_t date;
+    uint16_t entries[MINUTES_PER_HOUR];
+} hour_block_t;
+
+typedef struct {
+    log_date_t date;
+    uint32_t steps;
+} day_total_t;
+
+typedef struct {
+    log_date_t date;
+    uint8_t wday;
+    uint16_t entries[FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY];
+    uint16_t buckets[FITNESS_ACTIVITY_LOG_NUM_BUCKETS];
+    uint32_t daily_steps;
+    uint16_t active_minutes;
+    uint32_t last_total_steps;
+    day_total_t week[FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK];
+    uint32_t dirty_hours;
+    bool week_dirty;
+} activity_log_t;
+
+static activity_log_t activity_log;
+
+K_MUTEX_DEFINE(activity_log_mutex);
+
+static log_date_t date_from_time(const zsw_timeval_t *time)
+{
+    log_date_t date = {
+        .year = time->tm.tm_year,
+        .yday = time->tm.tm_yday
+    };
+
+    return date;
+}
+
+static bool date_equal(log_date_t a, log_date_t b)
+{
+    return a.year == b.year && a.yday == b.yday;
+}
+
+static int32_t date_to_days(log_date_t date)
+{
+    int32_t y = (int32_t)date.year - 1;
+
+    return y * 365 + y / 4 - y / 100 + y / 400 + date.yday;
+}
+
+static bool is_active(zsw_imu_data_step_activity_t activity)
+{
+    return activity == ZSW_IMU_EVT_STEP_ACTIVITY_WALK || activity == ZSW_IMU_EVT_STEP_ACTIVITY_RUN;
+}
+
+static int flush_locked(void);
+
+static void start_new_day(log_date_t date, uint8_t wday)
+{
+    LOG_DBG("New day %d/%d", date.year, date.yday);
+    // Minutes of the previous day that were not written yet would be lost when the log is cleared.
+    if (flush_locked()) {
+        LOG_ERR("Error during saving of previous day, last minutes are lost");
+    }
+    memset(activity_log.entries, 0, sizeof(activity_log.entries));
+    memset(activity_log.buckets, 0, sizeof(activity_log.buckets));
+    activity_log.date = date;
+    activity_log.wday = wday;
+    activity_log.daily_steps = 0;
+    activity_log.active_minutes = 0;
+    activity_log.week[wday].date = date;
+    activity_log.week[wday].steps = 0;
+    activity_log.week_dirty = true;
+    // Hour blocks in flash from the previous day are ignored at load, no need to rewrite them.
+    activity_log.dirty_hours = 0;
+}
+
+// Add the steps counted since the previous sample to one minute. Called with the mutex held.
+static void add_to_minute(int minute, uint32_t total_steps, zsw_imu_data_step_activity_t activity)
+{
+    uint16_t entry;
+    uint32_t steps;
+    uint32_t delta;
+
+    if (total_steps >= activity_log.last_total_steps) {
+        delta = total_steps - activity_log.last_total_steps;
+    } else {
+        // Step counter restarted without fitness_activity_log_counter_reset(), e.g. the IMU was reset.
+        delta = total_steps;
+    }
+    activity_log.last_total_steps = total_steps;
+
+    entry = activity_log.entries[minute];
+    steps = ENTRY_STEPS(entry) + delta;
+    if (!is_active(ENTRY_ACTIVITY(entry)) && is_active(activity)) {
+        activity_log.active_minutes++;
+    } else if (is_active(ENTRY_ACTIVITY(entry)) && !is_active(activity)) {
+        activity_log.active_minutes--;
+    }
+    activity_log.entries[minute] = ENTRY_ENCODE(steps, activity);
+
+    activity_log.daily_steps += delta;
+    activity_log.buckets[minute / FITNESS_ACTIVITY_LOG_BUCKET_MINUTES] += delta;
+    activity_log.week[activity_log.wday].date = activity_log.date;
+    activity_log.week[activity_log.wday].steps = activity_log.daily_steps;
+
+    activity_log.dirty_hours |= BIT(minute / MINUTES_PER_HOUR);
+    activity_log.week_dirty = true;
+
+    LOG_DBG("Minute %d: %d steps, activity %d, today %d", minute, delta, activity, activity_log.daily_steps);
+}
+
+static void rebuild_daily_aggregates(void)
+{
+    activity_log.daily_steps = 0;
+    activity_log.active_minutes = 0;
+    memset(activity_log.buckets, 0, sizeof(activity_log.buckets));
+
+    for (int i = 0; i < FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY; i++) {
+        uint16_t steps = ENTRY_STEPS(activity_log.entries[i]);
+
+        activity_log.daily_steps += steps;
+        activity_log.buckets[i / FITNESS_ACTIVITY_LOG_BUCKET_MINUTES] += steps;
+        if (is_active(ENTRY_ACTIVITY(activity_log.entries[i]))) {
+            activity_log.active_minutes++;
+        }
+    }
+}
+
+static int activity_log_load_cb(const char *p_key, size_t len, settings_read_cb read_cb, void *p_cb_arg,
+                                void *p_param)
+{
+    if (p_key == NULL) {
+        return 0;
+    }
+
+    if (strcmp(p_key, SETTING_ACTIVITY_WEEK_KEY) == 0) {
+        if (len != sizeof(activity_log.week) ||
+            read_cb(p_cb_arg, activity_log.week, len) != sizeof(activity_log.week)) {
+            LOG_ERR("Invalid weekly totals, discarding");
+            memset(activity_log.week, 0, sizeof(activity_log.week));
+        }
+    } else if (p_key[0] == SETTING_ACTIVITY_HOUR_PREFIX) {
+        hour_block_t block;
+        int hour = atoi(&p_key[1]);
+
+        if ((hour < 0) || (hour >= HOURS_PER_DAY) || (len != sizeof(block)) ||
+            (read_cb(p_cb_arg, &block, len) != sizeof(block))) {
+            LOG_ERR("Invalid hour block %s, discarding", p_key);
+            return 0;
+        }
+
+        // Blocks from previous days are left in flash until that hour is written again.
+        if (date_equal(block.date, activity_log.date)) {
+            memcpy(&activity_log.entries[hour * MINUTES_PER_HOUR], block.entries, sizeof(block.entries));
+        }
+    }
+
+    return 0;
+}
+
+int fitness_activity_log_init(const zsw_timeval_t *time)
+{
+    int ret;
+
+    memset(&activity_log, 0, sizeof(activity_log));
+    activity_log.date = date_from_time(time);
+    activity_log.wday = time->tm.tm_wday;
+
+    ret = settings_subsys_init();
+    if (ret) {
+        LOG_ERR("Error during settings initialization! Error: %i", ret);
+        return -EFAULT;
+    }
+
+    ret = settings_load_subtree_direct(SETTING_ACTIVITY_LOG_KEY, activity_log_load_cb, NULL);
+    if (ret) {
+        LOG_ERR("Error during loading of activity log! Error: %i", ret);
+        return -EFAULT;
+    }
+
+    // Only done once at boot, after that the totals are kept up to date on every sample.
+    rebuild_daily_aggregates();
+    activity_log.week[activity_log.wday].date = activity_log.date;
+    activity_log.week[activity_log.wday].steps = activity_log.daily_steps;
+    activity_log.last_total_steps = activity_log.daily_steps;
+
+    LOG_DBG("Loaded activity log, %d steps and %d active minutes today", activity_log.daily_steps,
+            activity_log.active_minutes);
+
+    return 0;
+}
+
+void fitness_activity_log_add(const zsw_timeval_t *time, uint32_t total_steps,
+                              zsw_imu_data_step_activity_t activity)
+{
+    // The sample taken at HH:MM covers the minute that just ended.
+    int minute = time->tm.tm_hour * MINUTES_PER_HOUR + time->tm.tm_min - 1;
+    log_date_t date = date_from_time(time);
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+
+    if (minute < 0) {
+        // Sample at midnight belongs to the last minute of the day being logged.
+        minute = FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY - 1;
+    } else if (!date_equal(date, activity_log.date)) {
+        start_new_day(date, time->tm.tm_wday);
+    }
+
+    add_to_minute(minute, total_steps, activity);
+
+    k_mutex_unlock(&activity_log_mutex);
+}
+
+void fitness_activity_log_counter_reset(const zsw_timeval_t *time, uint32_t total_steps)
+{
+    int minute = time->tm.tm_hour * MINUTES_PER_HOUR + time->tm.tm_min;
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+
+    if (date_equal(date_from_time(time), activity_log.date)) {
+        // Steps since the last sample still belong to today, the counter then starts over at 0.
+        add_to_minute(minute, total_steps, ENTRY_ACTIVITY(activity_log.entries[minute]));
+    }
+    activity_log.last_total_steps = 0;
+
+    k_mutex_unlock(&activity_log_mutex);
+}
+
+static int flush_locked(void)
+{
+    char key[sizeof(SETTING_ACTIVITY_LOG_KEY) + 8];
+    hour_block_t block;
+    int ret = 0;
+
+    for (int hour = 0; hour < HOURS_PER_DAY; hour++) {
+        if ((activity_log.dirty_hours & BIT(hour)) == 0) {
+            continue;
+        }
+
+        block.date = activity_log.date;
+        memcpy(block.entries, &activity_log.entries[hour * MINUTES_PER_HOUR], sizeof(block.entries));
+        snprintf(key, sizeof(key), "%s/%c%02d", SETTING_ACTIVITY_LOG_KEY, SETTING_ACTIVITY_HOUR_PREFIX, hour);
+        ret = settings_save_one(key, &block, sizeof(block));
+        if (ret) {
+            LOG_ERR("Error during saving of %s! Error: %i", key, ret);
+            goto out;
+        }
+        activity_log.dirty_hours &= ~BIT(hour);
+    }
+
+    if (activity_log.week_dirty) {
+        ret = settings_save_one(SETTING_ACTIVITY_LOG_KEY "/" SETTING_ACTIVITY_WEEK_KEY, activity_log.week,
+                                sizeof(activity_log.week));
+        if (ret) {
+            LOG_ERR("Error during saving of weekly totals! Error: %i", ret);
+            goto out;
+        }
+        activity_log.week_dirty = false;
+    }
+
+out:
+    return ret ? -EFAULT : 0;
+}
+
+int fitness_activity_log_flush(void)
+{
+    int ret;
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    ret = flush_locked();
+    k_mutex_unlock(&activity_log_mutex);
+
+    return ret;
+}
+
+uint32_t fitness_activity_log_get_daily_steps(void)
+{
+    uint32_t steps;
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    steps = activity_log.daily_steps;
+    k_mutex_unlock(&activity_log_mutex);
+
+    return steps;
+}
+
+uint16_t fitness_activity_log_get_active_minutes(void)
+{
+    uint16_t minutes;
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    minutes = activity_log.active_minutes;
+    k_mutex_unlock(&activity_log_mutex);
+
+    return minutes;
+}
+
+void fitness_activity_log_get_weekly_steps(const zsw_timeval_t *time,
+                                           uint32_t steps[FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK])
+{
+    int32_t today = date_to_days(date_from_time(time));
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    for (int i = 0; i < FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK; i++) {
+        int32_t age = today - date_to_days(activity_log.week[i].date);
+
+        if ((age >= 0) && (age < FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK)) {
+            steps[i] = activity_log.week[i].steps;
+        } else {
+            steps[i] = 0;
+        }
+    }
+    k_mutex_unlock(&activity_log_mutex);
+}
+
+void fitness_activity_log_get_intraday_steps(uint16_t buckets[FITNESS_ACTIVITY_LOG_NUM_BUCKETS])
+{
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    memcpy(buckets, activity_log.buckets, sizeof(activity_log.buckets));
+    k_mutex_unlock(&activity_log_mutex);
+}
+
+int fitness_activity_log_get_minute(uint16_t minute, uint16_t *steps, zsw_imu_data_step_activity_t *activity)
+{
+    uint16_t entry;
+
+    if (minute >= FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY) {
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&activity_log_mutex, K_FOREVER);
+    entry = activity_log.entries[minute];
+    k_mutex_unlock(&activity_log_mutex);
+
+    *steps = ENTRY_STEPS(entry);
+    *activity = ENTRY_ACTIVITY(entry);
+
+    return 0;
+}
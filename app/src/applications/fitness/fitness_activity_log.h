@@ -0,0 +1,87 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sensors/zsw_imu.h"
+#include "zsw_clock.h"
+
+#define FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK       7
+#define FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY    (24 * 60)
+#define FITNESS_ACTIVITY_LOG_BUCKET_MINUTES     30
+#define FITNESS_ACTIVITY_LOG_NUM_BUCKETS        (FITNESS_ACTIVITY_LOG_MINUTES_PER_DAY / FITNESS_ACTIVITY_LOG_BUCKET_MINUTES)
+
+/** @brief          Load today's log and the weekly totals from flash.
+ *  @param time     Current time, used to discard data from previous days.
+ *  @return         0 when successful
+*/
+int fitness_activity_log_init(const zsw_timeval_t *time);
+
+/** @brief              Add one minute sample to the log.
+ *                      The step delta since the previous sample is stored, together with the activity class.
+ *                      Daily, weekly and intraday totals are updated incrementally.
+ *  @param time         Time of the sample, expected to be close to a full minute.
+ *  @param total_steps  Current value of the daily step counter.
+ *  @param activity     Current step activity class.
+*/
+void fitness_activity_log_add(const zsw_timeval_t *time, uint32_t total_steps,
+                              zsw_imu_data_step_activity_t activity);
+
+/** @brief              Tell the log that the daily step counter is about to be reset to 0.
+ *                      Steps since the last sample are added to the current minute, so the next
+ *                      sample only counts steps taken after the reset.
+ *  @param time         Time of the reset.
+ *  @param total_steps  Value of the daily step counter just before the reset.
+*/
+void fitness_activity_log_counter_reset(const zsw_timeval_t *time, uint32_t total_steps);
+
+/** @brief              Write the parts of the log that changed since last flush to flash.
+ *  @return             0 when successful
+*/
+int fitness_activity_log_flush(void);
+
+/** @brief              Get the number of steps logged today.
+ *  @return             Number of steps
+*/
+uint32_t fitness_activity_log_get_daily_steps(void);
+
+/** @brief              Get the number of minutes today classified as walking or running.
+ *  @return             Number of minutes
+*/
+uint16_t fitness_activity_log_get_active_minutes(void);
+
+/** @brief              Get the total steps of the last seven days.
+ *  @param time         Current time, days older than one week are reported as 0.
+ *  @param steps        Output, indexed by day of week (Sunday = 0).
+*/
+void fitness_activity_log_get_weekly_steps(const zsw_timeval_t *time,
+                                           uint32_t steps[FITNESS_ACTIVITY_LOG_DAYS_IN_WEEK]);
+
+/** @brief              Get today's steps in FITNESS_ACTIVITY_LOG_BUCKET_MINUTES long buckets.
+ *  @param buckets      Output, index 0 is the bucket starting at midnight.
+*/
+void fitness_activity_log_get_intraday_steps(uint16_t buckets[FITNESS_ACTIVITY_LOG_NUM_BUCKETS]);
+
+/** @brief              Get the logged data for one minute of today.
+ *  @param minute       Minute of the day [0, 1439]
+ *  @param steps        Output, steps taken during that minute.
+ *  @param activity     Output, activity class during that minute.
+ *  @return             0 when successful, -EINVAL on invalid minute
+*/
+int fitness_activity_log_get_minute(uint16_t minute, uint16_t *steps, zsw_imu_data_step_activity_t *activity);
@@ -18,15 +18,15 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
 
 #include "fitness_ui.h"
 #include "managers/zsw_app_manager.h"
 #include "zephyr/zbus/zbus.h"
 #include "events/accel_event.h"
 #include "sensors/zsw_imu.h"
-#include "zsw_clock.h"
 #include "zsw_alarm.h"
-#include "history/zsw_history.h"
+#include "fitness_activity_log.h"
 #include "ui/zsw_ui.h"
 #include "zsw_clock.h"
 
@@ -35,30 +35,12 @@ LOG_MODULE_REGISTER(fitness_app, LOG_LEVEL_INF);
 #define STEP_RESET_COUNTER_INTERVAL_S   50
 #define DAYS_IN_WEEK                    7
 
-#define SETTING_FITNESS_HIST_KEY    "fitness/step/hist"
-#define SAMPLE_INTERVAL_MIN         60
-#define SAMPLE_INTERVAL_MS          (SAMPLE_INTERVAL_MIN * 60 * 1000)
-#define MAX_SAMPLES                 (7 * 24) // One week of hourly samples
-
-typedef struct minimal_zsw_timeval {
-    // Same structure as zsw_timeval_t, but with smaller types and without tm_isdst and nanoseconds
-    uint8_t  tm_sec;    /**< Seconds [0, 59] */
-    uint8_t  tm_min;     /**< Minutes [0, 59] */
-    uint8_t  tm_hour;   /**< Hours [0, 23] */
-    uint8_t  tm_mday;   /**< Day of the month [1, 31] */
-    uint8_t  tm_mon;    /**< Month [0, 11] */
-    uint16_t tm_year;   /**< Year */
-    uint8_t  tm_wday;   /**< Day of the week [0, 6] (Sunday = 0) (Unknown = -1) */
-    uint16_t tm_yday;   /**< Day of the year [0, 365] (Unknown = -1) */
-} minimal_zsw_timeval_t;
-
-typedef struct {
-    minimal_zsw_timeval_t time;
-    uint32_t steps;
-} zsw_step_sample_t;
+#define SETTING_FITNESS_LEGACY_HIST_KEY "fitness/step/hist"
+#define ACTIVITY_LOG_FLUSH_INTERVAL_MIN 15
 
 static void fitness_app_start(lv_obj_t *root, lv_group_t *group);
 static void fitness_app_stop(void);
+static int fitness_app_init(void);
 
 static void step_sample_work(struct k_work *work);
 
@@ -68,13 +50,13 @@ static application_t app = {
     .name = "Fitness",
     .start_func = fitness_app_start,
     .stop_func = fitness_app_stop,
+    .init_func = fitness_app_init,
     .icon = ZSW_LV_IMG_USE(fitness_app_icon),
-    .category = ZSW_APP_CATEGORY_ROOT
+    .category = ZSW_APP_CATEGORY_ROOT,
+    // Samples steps and keeps the activity log while closed
+    .background = true,
 };
 
-static zsw_history_t fitness_history_context;
-static zsw_step_sample_t samples[MAX_SAMPLES];
-
 K_WORK_DELAYABLE_DEFINE(sample_step_work, step_sample_work);
 
 ZBUS_CHAN_DECLARE(accel_data_chan);
@@ -82,15 +64,29 @@ ZBUS_CHAN_DECLARE(accel_data_chan);
 static void step_work_polling_callback(struct k_work *work);
 K_WORK_DELAYABLE_DEFINE(step_work, step_work_polling_callback);
 
-static void reset_steps_if_needed(void)
+// Listeners such as the watchface only update the step count on step events.
+static void publish_step_count(uint32_t steps)
 {
     struct accel_event evt = {
         .data.type = ZSW_IMU_EVT_TYPE_STEP,
-        .data.data.step.count = 0
+        .data.data.step.count = steps
     };
+
+    zbus_chan_pub(&accel_data_chan, &evt, K_MSEC(250));
+}
+
+static void reset_steps_if_needed(void)
+{
+    zsw_timeval_t time;
+    uint32_t steps;
+
     LOG_DBG("Reset step counter");
+    zsw_clock_get_time(&time);
+    if (zsw_imu_fetch_num_steps(&steps) == 0) {
+        fitness_activity_log_counter_reset(&time, steps);
+    }
     zsw_imu_reset_step_count();
-    zbus_chan_pub(&accel_data_chan, &evt, K_MSEC(250));
+    publish_step_count(0);
 }
 
 #ifdef CONFIG_RTC
@@ -111,57 +107,32 @@ static void step_work_polling_callback(struct k_work *work)
     k_work_reschedule(&step_work, K_SECONDS(STEP_RESET_COUNTER_INTERVAL_S));
 }
 
-static void timeval_to_minimal_timeval(zsw_timeval_t *time, minimal_zsw_timeval_t *minimal_time)
-{
-    minimal_time->tm_sec = time->tm.tm_sec;
-    minimal_time->tm_min = time->tm.tm_min;
-    minimal_time->tm_hour = time->tm.tm_hour;
-    minimal_time->tm_mday = time->tm.tm_mday;
-    minimal_time->tm_mon = time->tm.tm_mon;
-    minimal_time->tm_year = time->tm.tm_year;
-    minimal_time->tm_wday = time->tm.tm_wday;
-    minimal_time->tm_yday = time->tm.tm_yday;
-}
-
 static void step_sample_work(struct k_work *work)
 {
-    zsw_step_sample_t sample;
     zsw_timeval_t time_now;
-    int next_sample_seconds;
+    zsw_imu_data_step_activity_t activity = ZSW_IMU_EVT_STEP_ACTIVITY_UNKNOWN;
+    uint32_t steps;
+
+    zsw_clock_get_time(&time_now);
+    // Try to sample about every full minute
+    k_work_reschedule(&sample_step_work, K_SECONDS(60 - time_now.tm.tm_sec));
 
-    if (zsw_imu_fetch_num_steps(&sample.steps) != 0) {
+    if (zsw_imu_fetch_num_steps(&steps) != 0) {
 #ifdef CONFIG_ARCH_POSIX
-        sample.steps = rand() % 1000;
+        steps = fitness_activity_log_get_daily_steps() + rand() % 100;
 #else
         LOG_WRN("Error during fetching of steps!");
         return;
 #endif
     }
-    zsw_clock_get_time(&time_now);
-    timeval_to_minimal_timeval(&time_now, &sample.time);
+    zsw_imu_fetch_step_activity(&activity);
 
-    zsw_history_add(&fitness_history_context, &sample);
-    if (zsw_history_save(&fitness_history_context)) {
-        LOG_ERR("Error during saving of step samples!");
-    }
-    LOG_DBG("Step sample hist add: %d", sample.steps);
-    LOG_DBG("Time: %d:%d:%d", sample.time.tm_hour, sample.time.tm_min, sample.time.tm_sec);
-    next_sample_seconds = 60 * (SAMPLE_INTERVAL_MIN - sample.time.tm_min) - sample.time.tm_sec;
-    LOG_DBG("Next sample in %d:%d", next_sample_seconds / 60, next_sample_seconds % 60);
-    k_work_reschedule(&sample_step_work, K_SECONDS(next_sample_seconds));
-}
+    fitness_activity_log_add(&time_now, steps, activity);
 
-static void get_steps_per_day(uint16_t weekdays[DAYS_IN_WEEK])
-{
-    int day;
-    int num_samples = zsw_history_samples(&fitness_history_context);
-
-    for (int i = 0; i < num_samples; i++) {
-        zsw_step_sample_t sample;
-        zsw_history_get(&fitness_history_context, &sample, i);
-        day = sample.time.tm_wday;
-        LOG_DBG("Day: %d, HH: %d, Steps: %d", day, sample.time.tm_hour, sample.steps);
-        weekdays[day] = MAX(sample.steps, weekdays[day]);
+    if ((time_now.tm.tm_min % ACTIVITY_LOG_FLUSH_INTERVAL_MIN) == 0) {
+        if (fitness_activity_log_flush()) {
+            LOG_ERR("Error during saving of activity log!");
+        }
     }
 }
 
@@ -191,10 +162,18 @@ static void fitness_app_start(lv_obj_t *root, lv_group_t *group)
 {
     zsw_timeval_t time;
     uint32_t steps;
-    uint16_t step_weekdays[DAYS_IN_WEEK] = {0};
+    uint32_t weekly_steps[DAYS_IN_WEEK];
+    uint16_t step_weekdays[DAYS_IN_WEEK];
+    uint16_t intraday_steps[FITNESS_ACTIVITY_LOG_NUM_BUCKETS];
     static char *weekday_names[] = {"Su", "Mo", "Tu", "We", "Th", "Fr", "Sa"};
     zsw_clock_get_time(&time);
-    get_steps_per_day(step_weekdays);
+
+    // Totals are maintained by the activity log on every sample, nothing to aggregate here.
+    fitness_activity_log_get_weekly_steps(&time, weekly_steps);
+    fitness_activity_log_get_intraday_steps(intraday_steps);
+    for (int i = 0; i < DAYS_IN_WEEK; i++) {
+        step_weekdays[i] = MIN(weekly_steps[i], UINT16_MAX);
+    }
 
     // Data is in the order of the days of the week, starting from Sunday (index 0)
     // Rotate the array (left/counter-clockwise) so the last element is the current day
@@ -209,6 +188,7 @@ static void fitness_app_start(lv_obj_t *root, lv_group_t *group)
 
     fitness_ui_show(root, DAYS_IN_WEEK);
     fitness_ui_set_weekly_steps(step_weekdays, weekday_names, DAYS_IN_WEEK);
+    fitness_ui_set_intraday_steps(intraday_steps, FITNESS_ACTIVITY_LOG_NUM_BUCKETS);
 
     if (zsw_imu_fetch_num_steps(&steps) == 0) {
         fitness_ui_set_daily_steps(steps);
@@ -220,12 +200,9 @@ static void fitness_app_stop(void)
     fitness_ui_remove();
 }
 
-static int fitness_app_add(void)
+static int fitness_app_init(void)
 {
-    int num_hist_samples;
     zsw_timeval_t time;
-    int next_sample_seconds = 0;
-    zsw_app_manager_add_application(&app);
 
 #ifdef CONFIG_RTC
     if (zsw_clock_rtc_available()) {
@@ -246,27 +223,36 @@ static int fitness_app_add(void)
     k_work_reschedule(&step_work, K_SECONDS(STEP_RESET_COUNTER_INTERVAL_S));
 #endif
 
-    zsw_history_init(&fitness_history_context, MAX_SAMPLES, sizeof(zsw_step_sample_t), samples, SETTING_FITNESS_HIST_KEY);
+    zsw_clock_get_time(&time);
 
-    if (zsw_history_load(&fitness_history_context)) {
-        LOG_ERR("Error during settings_load_subtree!");
+    if (fitness_activity_log_init(&time)) {
+        LOG_ERR("Error during loading of activity log!");
         return -EFAULT;
     }
 
-    num_hist_samples = zsw_history_samples(&fitness_history_context);
-
-    zsw_clock_get_time(&time);
+    // Steps used to be stored as hourly samples, that is now covered by the activity log.
+    settings_delete(SETTING_FITNESS_LEGACY_HIST_KEY "/head");
+    settings_delete(SETTING_FITNESS_LEGACY_HIST_KEY "/data");
 
     // If watch was reset the step counter restarts at 0, so we need to update the offset.
-    if (num_hist_samples > 0 && time.tm.tm_mday == samples[num_hist_samples - 1].time.tm_mday) {
-        zsw_imu_set_step_offset(samples[num_hist_samples - 1].steps);
+    if (fitness_activity_log_get_daily_steps() > 0) {
+        uint32_t steps;
+
+        zsw_imu_set_step_offset(fitness_activity_log_get_daily_steps());
+        // The watchface may already show the count without the offset.
+        if (zsw_imu_fetch_num_steps(&steps) == 0) {
+            publish_step_count(steps);
+        }
     }
 
-    // Try to sample about every full hour
-    next_sample_seconds = 60 * (SAMPLE_INTERVAL_MIN - time.tm.tm_min) - time.tm.tm_sec;
+    k_work_reschedule(&sample_step_work, K_SECONDS(60 - time.tm.tm_sec));
 
-    LOG_DBG("Next sample in %d:%d", next_sample_seconds / 60, next_sample_seconds % 60);
-    k_work_reschedule(&sample_step_work, K_SECONDS(next_sample_seconds));
+    return 0;
+}
+
+static int fitness_app_add(void)
+{
+    zsw_app_manager_add_application(&app);
 
     return 0;
 }
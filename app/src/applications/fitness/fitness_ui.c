@@ -23,8 +23,10 @@
 static lv_obj_t *root_page = NULL;
 static lv_obj_t *ui_step_progress_label = NULL;
 static lv_obj_t *ui_weekly_chart = NULL;
+static lv_obj_t *ui_intraday_chart = NULL;
 static lv_obj_t *ui_step_goal_arc = NULL;
 static lv_chart_series_t *ui_weekly_chart_series_1 = NULL;
+static lv_chart_series_t *ui_intraday_chart_series = NULL;
 static char **chart_bar_names = NULL;
 
 static void event_cb(lv_event_t *e)
@@ -138,6 +140,23 @@ static void create_step_chart(lv_obj_t *ui_root_container, uint16_t max_samples)
     lv_obj_set_style_text_font(ui_step_progress_label, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_step_progress_label, "- / 10000");
 
+    // Small curve of today's steps below the step counter
+    ui_intraday_chart = lv_chart_create(ui_root_container);
+    lv_obj_set_width(ui_intraday_chart, 140);
+    lv_obj_set_height(ui_intraday_chart, 20);
+    lv_obj_set_x(ui_intraday_chart, 0);
+    lv_obj_set_y(ui_intraday_chart, -66);
+    lv_obj_set_align(ui_intraday_chart, LV_ALIGN_CENTER);
+    lv_chart_set_type(ui_intraday_chart, LV_CHART_TYPE_BAR);
+    lv_chart_set_div_line_count(ui_intraday_chart, 0, 0);
+    lv_obj_set_style_bg_opa(ui_intraday_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(ui_intraday_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(ui_intraday_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_column(ui_intraday_chart, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_clear_flag(ui_intraday_chart, LV_OBJ_FLAG_CLICKABLE);
+    ui_intraday_chart_series = lv_chart_add_series(ui_intraday_chart, lv_color_hex(0xffd147),
+                                                   LV_CHART_AXIS_PRIMARY_Y);
+
     ui_weekly_chart = lv_chart_create(ui_root_container);
     lv_obj_set_width(ui_weekly_chart, 231);
     lv_obj_set_height(ui_weekly_chart, 120);
@@ -242,6 +261,24 @@ void fitness_ui_set_weekly_steps(uint16_t *samples, char **weekday_names, uint16
     lv_arc_set_value(ui_step_goal_arc, samples[num_samples - 1]);
 }
 
+void fitness_ui_set_intraday_steps(uint16_t *samples, uint16_t num_samples)
+{
+    uint16_t max_value = 1;
+
+    assert(ui_intraday_chart_series != NULL);
+
+    for (int i = 0; i < num_samples; i++) {
+        max_value = LV_MAX(max_value, samples[i]);
+    }
+
+    lv_chart_set_point_count(ui_intraday_chart, num_samples);
+    lv_chart_set_range(ui_intraday_chart, LV_CHART_AXIS_PRIMARY_Y, 0, max_value);
+    for (int i = 0; i < num_samples; i++) {
+        lv_chart_set_value_by_id(ui_intraday_chart, ui_intraday_chart_series, i, samples[i]);
+    }
+    lv_chart_refresh(ui_intraday_chart);
+}
+
 void fitness_ui_set_daily_steps(uint32_t steps)
 {
     lv_label_set_text_fmt(ui_step_progress_label, "%d / %d", steps, 10000);
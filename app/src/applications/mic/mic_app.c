@@ -21,7 +21,7 @@
 #include <zephyr/logging/log.h>
 
 #include "mic_app_ui.h"
-#include "spectrum_analyzer.h"
+#include "spectrum_analyzer_q15.h"
 #include "managers/zsw_app_manager.h"
 #include "managers/zsw_microphone_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
@@ -30,12 +30,13 @@ LOG_MODULE_REGISTER(mic_app, LOG_LEVEL_DBG);
 
 static void mic_app_start(lv_obj_t *root, lv_group_t *group);
 static void mic_app_stop(void);
+static int mic_app_init(void);
+static void mic_app_deinit(void);
 
 static struct k_work spectrum_update_work;
 static void spectrum_update_work_handler(struct k_work *work);
 
 static uint8_t spectrum_magnitudes[NUM_SPECTRUM_BARS];
-static int16_t audio_samples[SPECTRUM_FFT_SIZE];
 static float current_gain = 1.0f;
 static bool rtt_output_enabled = false;
 
@@ -51,15 +52,15 @@ static application_t app = {
     .icon = ZSW_LV_IMG_USE(statistic_icon),
     .start_func = mic_app_start,
     .stop_func = mic_app_stop,
+    .init_func = mic_app_init,
+    .deinit_func = mic_app_deinit,
 };
 
-static size_t sample_buffer_index = 0;
-
 static void mic_app_start(lv_obj_t *root, lv_group_t *group)
 {
     k_work_init(&spectrum_update_work, spectrum_update_work_handler);
 
-    int ret = spectrum_analyzer_init();
+    int ret = spectrum_analyzer_q15_init(NUM_SPECTRUM_BARS);
     if (ret < 0) {
         LOG_ERR("Failed to initialize spectrum analyzer: %d", ret);
     }
@@ -67,7 +68,6 @@ static void mic_app_start(lv_obj_t *root, lv_group_t *group)
     mic_app_ui_create(root, on_play_stop_toggle, on_gain_changed, on_rtt_output_toggled, current_gain);
     LOG_INF("Circular spectrum watch UI created");
 
-    sample_buffer_index = 0;
     LOG_INF("Microphone app started");
 }
 
@@ -80,11 +80,20 @@ static void mic_app_stop(void)
     }
 
     mic_app_ui_remove();
-    spectrum_analyzer_cleanup();
+    spectrum_analyzer_q15_cleanup();
 
     LOG_INF("Microphone app stopped");
 }
 
+static int mic_app_init(void)
+{
+    return 0;
+}
+
+static void mic_app_deinit(void)
+{
+}
+
 static void on_play_stop_toggle(void)
 {
     if (zsw_microphone_manager_is_recording()) {
@@ -107,9 +116,6 @@ static void on_play_stop_toggle(void)
             return;
         }
 
-        sample_buffer_index = 0;
-        memset(audio_samples, 0, sizeof(audio_samples));
-
         int ret;
         zsw_mic_config_t config;
         zsw_microphone_manager_get_default_config(&config);
@@ -155,21 +161,14 @@ static void mic_event_callback(zsw_mic_event_t event, zsw_mic_event_data_t *data
                 int16_t *samples = (int16_t *)block->data;
                 size_t num_samples = block->size / sizeof(int16_t);
 
-                // Accumulate samples until we have enough for FFT
-                for (size_t i = 0; i < num_samples && sample_buffer_index < SPECTRUM_FFT_SIZE; i++) {
-                    audio_samples[sample_buffer_index++] = samples[i];
-                }
-
-                // Process when buffer is full
-                if (sample_buffer_index >= SPECTRUM_FFT_SIZE) {
+                // The block goes straight into the FFT input, processed once a frame is collected
+                if (spectrum_analyzer_q15_add_samples(samples, num_samples)) {
                     // Process for circular spectrum UI
-                    int ret = spectrum_analyzer_process(audio_samples, SPECTRUM_FFT_SIZE,
-                                                        spectrum_magnitudes, NUM_SPECTRUM_BARS, current_gain);
+                    int ret = spectrum_analyzer_q15_process(spectrum_magnitudes, NUM_SPECTRUM_BARS, current_gain);
                     if (ret == 0) {
                         // Submit work to update UI from main thread
                         k_work_submit(&spectrum_update_work);
                     }
-                    sample_buffer_index = 0;
                 }
             }
             break;
@@ -27,13 +27,16 @@ LOG_MODULE_REGISTER(spectrum_analyzer, LOG_LEVEL_DBG);
 static kiss_fftr_cfg fft_cfg;
 static bool initialized = false;
 
-// Working buffers for FFT processing
-static float input_buffer[SPECTRUM_FFT_SIZE];
-static kiss_fft_cpx output_buffer[SPECTRUM_FFT_SIZE / 2 + 1];
-static float magnitude_buffer[SPECTRUM_FFT_SIZE / 2];
-
-// Smoothing for better visual effect (less smoothing for more responsiveness)
-static float smoothed_magnitudes[64]; // Use max possible bars
+// Working buffers for FFT processing, only allocated while the analyzer is in use
+typedef struct spectrum_buffers_t {
+    float input[SPECTRUM_FFT_SIZE];
+    kiss_fft_cpx output[SPECTRUM_FFT_SIZE / 2 + 1];
+    float magnitude[SPECTRUM_FFT_SIZE / 2];
+    // Smoothing for better visual effect (less smoothing for more responsiveness)
+    float smoothed[64]; // Use max possible bars
+} spectrum_buffers_t;
+
+static spectrum_buffers_t *buffers;
 static const float SMOOTHING_FACTOR = 0.6f; // Reduced for faster response
 
 int spectrum_analyzer_init(void)
@@ -49,11 +52,13 @@ int spectrum_analyzer_init(void)
         return -EIO;
     }
 
-    // Clear working buffers
-    memset(input_buffer, 0, sizeof(input_buffer));
-    memset(output_buffer, 0, sizeof(output_buffer));
-    memset(magnitude_buffer, 0, sizeof(magnitude_buffer));
-    memset(smoothed_magnitudes, 0, sizeof(smoothed_magnitudes));
+    buffers = k_calloc(1, sizeof(spectrum_buffers_t));
+    if (!buffers) {
+        LOG_ERR("Failed to allocate FFT buffers");
+        kiss_fftr_free(fft_cfg);
+        fft_cfg = NULL;
+        return -ENOMEM;
+    }
 
     initialized = true;
 
@@ -80,20 +85,20 @@ int spectrum_analyzer_process(const int16_t *samples, size_t num_samples,
 
     // Convert 16-bit PCM to float and normalize to [-1.0, 1.0]
     for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
-        input_buffer[i] = (float)samples[i] / 32768.0f;
+        buffers->input[i] = (float)samples[i] / 32768.0f;
     }
 
     // Perform Real FFT using kiss_fft
-    kiss_fftr(fft_cfg, input_buffer, output_buffer);
+    kiss_fftr(fft_cfg, buffers->input, buffers->output);
 
     // Calculate magnitude for each frequency bin
     // kiss_fft real FFT output is [DC, complex_bins..., Nyquist]
-    magnitude_buffer[0] = fabsf(output_buffer[0].r); // DC component
+    buffers->magnitude[0] = fabsf(buffers->output[0].r); // DC component
 
     for (int i = 1; i < SPECTRUM_FFT_SIZE / 2; i++) {
-        float real = output_buffer[i].r;
-        float imag = output_buffer[i].i;
-        magnitude_buffer[i] = sqrtf(real * real + imag * imag);
+        float real = buffers->output[i].r;
+        float imag = buffers->output[i].i;
+        buffers->magnitude[i] = sqrtf(real * real + imag * imag);
     }
 
     // Group frequency bins into display bars
@@ -114,16 +119,16 @@ int spectrum_analyzer_process(const int16_t *samples, size_t num_samples,
 
         // Average the magnitude over the frequency range for this bar
         for (int bin = start_bin; bin < end_bin; bin++) {
-            bar_magnitude += magnitude_buffer[bin];
+            bar_magnitude += buffers->magnitude[bin];
         }
         bar_magnitude /= (end_bin - start_bin);
 
         // Apply smoothing for better visual effect
-        smoothed_magnitudes[bar] = SMOOTHING_FACTOR * smoothed_magnitudes[bar] +
+        buffers->smoothed[bar] = SMOOTHING_FACTOR * buffers->smoothed[bar] +
                                    (1.0f - SMOOTHING_FACTOR) * bar_magnitude;
 
         // Convert to 8-bit magnitude (0-255) with much higher sensitivity
-        float log_magnitude = logf(1.0f + smoothed_magnitudes[bar] * 500.0f * gain_multiplier); // Apply gain multiplier
+        float log_magnitude = logf(1.0f + buffers->smoothed[bar] * 500.0f * gain_multiplier); // Apply gain multiplier
         uint8_t magnitude_8bit = (uint8_t)(log_magnitude * 40.0f); // Increased scaling
 
         if (magnitude_8bit > 255) {
@@ -140,6 +145,8 @@ void spectrum_analyzer_cleanup(void)
     if (initialized && fft_cfg) {
         kiss_fftr_free(fft_cfg);
         fft_cfg = NULL;
+        k_free(buffers);
+        buffers = NULL;
         initialized = false;
     }
 }
@@ -25,7 +25,7 @@
 extern "C" {
 #endif
 
-#define SPECTRUM_FFT_SIZE       64      // FFT points for analysis
+#define SPECTRUM_FFT_SIZE       256     // FFT points for analysis
 
 /**
  * @brief Initialize the spectrum analyzer
@@ -0,0 +1,326 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Fixed point version of spectrum_analyzer.c. Per frame there is no float math: each frame is
+ * scaled to use the full q15 range, the bars are computed from the power of the bins so no square
+ * root is needed, and the level of a bar is an integer log2 of its mean power. The window,
+ * twiddles and bin ranges of the bars are computed once in init.
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+#include <arm_math.h>
+#endif
+
+#include "spectrum_analyzer_q15.h"
+
+LOG_MODULE_REGISTER(spectrum_analyzer_q15, LOG_LEVEL_DBG);
+
+#define NUM_BINS                (SPECTRUM_FFT_SIZE / 2)
+// DC is skipped, the offset of the PDM microphone would keep the first bar lit.
+#define FIRST_BIN               1
+// Frames are scaled so the largest sample is below this, the FFT stages can then not overflow.
+#define NORMALIZED_BITS         14
+// 0.6 like the float analyzer.
+#define SMOOTHING_Q8            154
+// Output levels per doubling of the power, 40 * ln(2) / 2 so the scale matches the float analyzer.
+#define LEVELS_PER_OCTAVE_Q8    3549
+
+BUILD_ASSERT(IS_POWER_OF_TWO(SPECTRUM_FFT_SIZE), "FFT size must be a power of two");
+
+typedef struct spectrum_bar_t {
+    uint16_t start_bin;
+    uint16_t end_bin;
+    int32_t log2_width_q8;
+} spectrum_bar_t;
+
+// Working buffers, only allocated while the analyzer is in use
+typedef struct spectrum_q15_buffers_t {
+    // Samples as they are added, windowed and scaled in place before the FFT.
+    int16_t input[SPECTRUM_FFT_SIZE];
+    // Interleaved real and imaginary part of each bin.
+    int16_t output[SPECTRUM_FFT_SIZE * 2];
+    int16_t window[SPECTRUM_FFT_SIZE];
+#ifndef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+    // e^(-2 * pi * i * k / SPECTRUM_FFT_SIZE) as real and imaginary part.
+    int16_t twiddle[NUM_BINS][2];
+#endif
+    spectrum_bar_t bars[SPECTRUM_Q15_MAX_BARS];
+    int32_t smoothed_q8[SPECTRUM_Q15_MAX_BARS];
+} spectrum_q15_buffers_t;
+
+static spectrum_q15_buffers_t *buffers;
+static size_t num_samples_added;
+// All added samples or:ed together, enough to find how far the frame can be scaled up.
+static uint16_t peak;
+#ifdef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+static arm_rfft_instance_q15 rfft;
+#endif
+
+static int16_t to_q15(float value)
+{
+    return CLAMP(lroundf(value * 32768.0f), INT16_MIN, INT16_MAX);
+}
+
+// log2(x) with 8 fractional bits, the fraction is linearly interpolated.
+static int32_t log2_q8(uint64_t x)
+{
+    int msb = 63 - __builtin_clzll(x);
+    uint32_t frac;
+
+    if (msb >= 8) {
+        frac = (x >> (msb - 8)) & 0xFF;
+    } else {
+        frac = (x << (8 - msb)) & 0xFF;
+    }
+
+    return (msb << 8) | frac;
+}
+
+static void build_bars(size_t num_bars)
+{
+    const float ratio = powf((float)NUM_BINS / FIRST_BIN, 1.0f / num_bars);
+    float edge = FIRST_BIN;
+    uint16_t start = FIRST_BIN;
+    uint16_t end;
+
+    for (size_t bar = 0; bar < num_bars; bar++) {
+        edge *= ratio;
+        // Every bar gets at least one bin, and enough are left for the bars after it.
+        end = CLAMP(lroundf(edge), start + 1, (long)(NUM_BINS - (num_bars - bar - 1)));
+        buffers->bars[bar] = (spectrum_bar_t) {
+            .start_bin = start,
+            .end_bin = end,
+            .log2_width_q8 = log2_q8(end - start),
+        };
+        start = end;
+    }
+}
+
+#ifndef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+// Complex FFT of NUM_BINS points in place, each stage is scaled down by 2 so the result is divided by NUM_BINS.
+static void fft_q15(int16_t *data)
+{
+    int16_t *a;
+    int16_t *b;
+    int32_t wr, wi, tr, ti, ar, ai;
+    size_t bit, step;
+    int16_t tmp;
+
+    for (size_t i = 1, j = 0; i < NUM_BINS; i++) {
+        for (bit = NUM_BINS >> 1; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            tmp = data[2 * i];
+            data[2 * i] = data[2 * j];
+            data[2 * j] = tmp;
+            tmp = data[2 * i + 1];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j + 1] = tmp;
+        }
+    }
+
+    for (size_t len = 2; len <= NUM_BINS; len <<= 1) {
+        step = SPECTRUM_FFT_SIZE / len;
+        for (size_t i = 0; i < NUM_BINS; i += len) {
+            for (size_t k = 0; k < len / 2; k++) {
+                a = &data[2 * (i + k)];
+                b = &data[2 * (i + k + len / 2)];
+                wr = buffers->twiddle[k * step][0];
+                wi = buffers->twiddle[k * step][1];
+                tr = (b[0] * wr - b[1] * wi) >> 15;
+                ti = (b[0] * wi + b[1] * wr) >> 15;
+                ar = a[0];
+                ai = a[1];
+                a[0] = (ar + tr) >> 1;
+                a[1] = (ai + ti) >> 1;
+                b[0] = (ar - tr) >> 1;
+                b[1] = (ai - ti) >> 1;
+            }
+        }
+    }
+}
+
+/*
+ * Real FFT done as a complex FFT of half the size, with the even samples as real part and the odd
+ * as imaginary part. The two interleaved spectra are then separated and combined. Scaled like
+ * arm_rfft_q15, the result is divided by NUM_BINS.
+ */
+static void rfft_q15(int16_t *input, int16_t *output)
+{
+    int32_t zr, zi, cr, ci, br, bi, wr, wi;
+    size_t m;
+
+    fft_q15(input);
+
+    for (size_t k = 0; k < NUM_BINS; k++) {
+        m = (NUM_BINS - k) & (NUM_BINS - 1);
+        zr = input[2 * k];
+        zi = input[2 * k + 1];
+        // Conjugate of the mirrored bin.
+        cr = input[2 * m];
+        ci = -input[2 * m + 1];
+        // -i * (Z[k] - conj(Z[N/2 - k]))
+        br = zi - ci;
+        bi = cr - zr;
+        wr = buffers->twiddle[k][0];
+        wi = buffers->twiddle[k][1];
+        output[2 * k] = (zr + cr + ((br * wr - bi * wi) >> 15)) >> 1;
+        output[2 * k + 1] = (zi + ci + ((br * wi + bi * wr) >> 15)) >> 1;
+    }
+}
+#endif
+
+int spectrum_analyzer_q15_init(size_t num_bars)
+{
+    if (buffers) {
+        return -EBUSY;
+    }
+
+    if (num_bars == 0 || num_bars > SPECTRUM_Q15_MAX_BARS || num_bars > NUM_BINS - FIRST_BIN) {
+        LOG_ERR("Invalid number of bars: %d", num_bars);
+        return -EINVAL;
+    }
+
+    buffers = k_calloc(1, sizeof(spectrum_q15_buffers_t));
+    if (!buffers) {
+        LOG_ERR("Failed to allocate FFT buffers");
+        return -ENOMEM;
+    }
+
+#ifdef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+    if (arm_rfft_init_q15(&rfft, SPECTRUM_FFT_SIZE, 0, 1) != ARM_MATH_SUCCESS) {
+        LOG_ERR("Failed to initialize CMSIS-DSP RFFT");
+        k_free(buffers);
+        buffers = NULL;
+        return -EIO;
+    }
+#else
+    for (int i = 0; i < NUM_BINS; i++) {
+        buffers->twiddle[i][0] = to_q15(cosf(2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE));
+        buffers->twiddle[i][1] = to_q15(-sinf(2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE));
+    }
+#endif
+
+    // Hann window, reduces the leakage that otherwise lights up the bars around a tone.
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        buffers->window[i] = to_q15(0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE));
+    }
+
+    build_bars(num_bars);
+    num_samples_added = 0;
+    peak = 0;
+
+    return 0;
+}
+
+bool spectrum_analyzer_q15_add_samples(const int16_t *samples, size_t num_samples)
+{
+    size_t num;
+
+    if (!buffers || !samples) {
+        return false;
+    }
+
+    num = MIN(num_samples, SPECTRUM_FFT_SIZE - num_samples_added);
+    for (size_t i = 0; i < num; i++) {
+        buffers->input[num_samples_added++] = samples[i];
+        peak |= (uint16_t)abs(samples[i]);
+    }
+
+    return num_samples_added == SPECTRUM_FFT_SIZE;
+}
+
+int spectrum_analyzer_q15_process(uint8_t *magnitudes, size_t num_bars, float gain_multiplier)
+{
+    const spectrum_bar_t *bar;
+    const int16_t *bin;
+    int32_t gain_q8;
+    int32_t level_q8;
+    int shift;
+    uint64_t power;
+
+    if (!buffers) {
+        LOG_ERR("Spectrum analyzer not initialized");
+        return -EINVAL;
+    }
+
+    if (!magnitudes || num_bars == 0 || num_bars > SPECTRUM_Q15_MAX_BARS) {
+        LOG_ERR("Invalid parameters");
+        return -EINVAL;
+    }
+
+    if (num_samples_added < SPECTRUM_FFT_SIZE) {
+        LOG_ERR("Not enough samples for FFT: %d < %d", num_samples_added, SPECTRUM_FFT_SIZE);
+        return -EINVAL;
+    }
+
+    // Left shift that brings the largest sample just below NORMALIZED_BITS, negative for loud frames.
+    shift = peak ? NORMALIZED_BITS - (32 - __builtin_clz(peak)) : 0;
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        buffers->input[i] = (buffers->input[i] * buffers->window[i]) >> (15 - shift);
+    }
+
+#ifdef CONFIG_ZSW_MIC_SPECTRUM_CMSIS_DSP
+    arm_rfft_q15(&rfft, buffers->input, buffers->output);
+#else
+    rfft_q15(buffers->input, buffers->output);
+#endif
+
+    // The gain and the frame scaling are offsets in the log domain, the power has twice the exponent.
+    gain_q8 = gain_multiplier > 0.0f ? lroundf(2.0f * log2f(gain_multiplier) * 256.0f) : INT16_MIN;
+    gain_q8 -= 2 * shift * 256;
+
+    for (size_t i = 0; i < num_bars; i++) {
+        bar = &buffers->bars[i];
+        power = 0;
+        for (uint16_t k = bar->start_bin; k < bar->end_bin; k++) {
+            bin = &buffers->output[2 * k];
+            power += (uint32_t)(bin[0] * bin[0]) + (uint32_t)(bin[1] * bin[1]);
+        }
+
+        level_q8 = 0;
+        if (power) {
+            // Mean power of the bins in the bar.
+            level_q8 = log2_q8(power) - bar->log2_width_q8 + gain_q8;
+            level_q8 = CLAMP((level_q8 * LEVELS_PER_OCTAVE_Q8) >> 8, 0, UINT8_MAX << 8);
+        }
+
+        buffers->smoothed_q8[i] = (SMOOTHING_Q8 * buffers->smoothed_q8[i] + (256 - SMOOTHING_Q8) * level_q8) >> 8;
+        magnitudes[i] = buffers->smoothed_q8[i] >> 8;
+    }
+
+    num_samples_added = 0;
+    peak = 0;
+
+    return 0;
+}
+
+void spectrum_analyzer_q15_cleanup(void)
+{
+    k_free(buffers);
+    buffers = NULL;
+    num_samples_added = 0;
+}
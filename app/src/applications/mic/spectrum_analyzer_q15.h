@@ -0,0 +1,75 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "spectrum_analyzer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SPECTRUM_Q15_MAX_BARS   64
+
+/**
+ * @brief Initialize the fixed point spectrum analyzer
+ *
+ * Same output as spectrum_analyzer_process(), but computed with a q15 real FFT of
+ * SPECTRUM_FFT_SIZE Hann windowed samples and bars spaced logarithmically in frequency.
+ *
+ * @param num_bars Number of output bars, at most SPECTRUM_Q15_MAX_BARS
+ *
+ * @return 0 on success, -EBUSY if already in use, negative error code on other failures
+ */
+int spectrum_analyzer_q15_init(size_t num_bars);
+
+/**
+ * @brief Cleanup the fixed point spectrum analyzer and free resources
+ */
+void spectrum_analyzer_q15_cleanup(void);
+
+/**
+ * @brief Add samples to the frame being collected
+ *
+ * Meant to be called with the blocks from the microphone driver as they arrive, the samples
+ * are written straight into the FFT input. Samples that do not fit in the frame are dropped.
+ *
+ * @param samples Pointer to 16-bit audio samples
+ * @param num_samples Number of samples
+ *
+ * @return true when a full frame is collected and spectrum_analyzer_q15_process() should be called
+ */
+bool spectrum_analyzer_q15_add_samples(const int16_t *samples, size_t num_samples);
+
+/**
+ * @brief Compute the frequency spectrum of the collected frame and start collecting the next
+ *
+ * @param magnitudes Output array for frequency magnitudes [0-255]
+ * @param num_bars Number of output bars, same as passed to spectrum_analyzer_q15_init()
+ * @param gain_multiplier Gain multiplier for sensitivity adjustment
+ *
+ * @return 0 on success, negative error code on failure
+ */
+int spectrum_analyzer_q15_process(uint8_t *magnitudes, size_t num_bars, float gain_multiplier);
+
+#ifdef __cplusplus
+}
+#endif
@@ -27,6 +27,7 @@
 #include "events/music_event.h"
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
+#include "zsw_zbus_trace.h"
 
 // Functions needed for all applications
 static void music_control_app_start(lv_obj_t *root, lv_group_t *group);
@@ -40,7 +41,7 @@ static void app_on_ui_available(void);
 ZBUS_CHAN_DECLARE(ble_comm_data_chan);
 
 ZBUS_CHAN_DECLARE(music_control_data_chan);
-ZBUS_LISTENER_DEFINE(music_app_ble_comm_lis, zbus_ble_comm_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(music_app_ble_comm_lis, zbus_ble_comm_data_callback);
 
 static K_WORK_DEFINE(update_ui_work, handle_update_ui);
 static ble_comm_music_info_t last_music_info;
@@ -123,11 +124,11 @@ static void zbus_ble_comm_data_callback(const struct zbus_channel *chan)
     // Need to context switch to not get stack overflow.
     // We are here in host bluetooth thread.
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
-    if (event->data.type == BLE_COMM_DATA_TYPE_MUSIC_INFO) {
-        memcpy(&last_music_info, &event->data.data.music_info, sizeof(ble_comm_music_info_t));
+    if (event->data->type == BLE_COMM_DATA_TYPE_MUSIC_INFO) {
+        memcpy(&last_music_info, &event->data->data.music_info, sizeof(ble_comm_music_info_t));
         k_work_submit(&update_ui_work);
-    } else if (event->data.type == BLE_COMM_DATA_TYPE_MUSIC_STATE) {
-        memcpy(&last_music_state, &event->data.data.music_state, sizeof(ble_comm_music_state_t));
+    } else if (event->data->type == BLE_COMM_DATA_TYPE_MUSIC_STATE) {
+        memcpy(&last_music_state, &event->data->data.music_state, sizeof(ble_comm_music_state_t));
         k_work_submit(&update_ui_work);
     }
 }
@@ -24,6 +24,7 @@
 #include "events/zsw_notification_event.h"
 #include "managers/zsw_app_manager.h"
 #include "managers/zsw_notification_manager.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(notification_app, CONFIG_NOTIFICATION_APP_LOG_LEVEL);
 
@@ -32,9 +33,11 @@ static void notification_app_stop(void);
 static void notification_app_zbus_notification_callback(const struct zbus_channel *chan);
 static void notification_app_zbus_notification_remove_callback(const struct zbus_channel *chan);
 static void notification_app_on_ui_available(void);
+static int notification_app_init(void);
+static void notification_app_deinit(void);
 
-ZBUS_LISTENER_DEFINE(notification_app_lis, notification_app_zbus_notification_callback);
-ZBUS_LISTENER_DEFINE(notification_app_remove_lis, notification_app_zbus_notification_remove_callback);
+ZSW_ZBUS_LISTENER_DEFINE(notification_app_lis, notification_app_zbus_notification_callback);
+ZSW_ZBUS_LISTENER_DEFINE(notification_app_remove_lis, notification_app_zbus_notification_remove_callback);
 
 static lv_group_t *notification_group;
 static lv_obj_t *root_obj;
@@ -45,9 +48,14 @@ static application_t app = {
     .start_func = notification_app_start,
     .stop_func = notification_app_stop,
     .ui_available_func = notification_app_on_ui_available,
+    .init_func = notification_app_init,
+    .deinit_func = notification_app_deinit,
     .category = ZSW_APP_CATEGORY_SYSTEM
 };
 
+// TODO: Can we remove this buffer in some way because we already have one notification buffer?
+static zsw_not_mngr_notification_t *notifications;
+
 static void notification_app_zbus_notification_callback(const struct zbus_channel *chan)
 {
     zsw_not_mngr_notification_t *not;
@@ -90,9 +98,6 @@ static void notification_app_start(lv_obj_t *root, lv_group_t *group)
 {
     static uint32_t num_notifications;
 
-    // TODO: Can we remove this buffer in some way because we already have one notification buffer?
-    static zsw_not_mngr_notification_t notifications[ZSW_NOTIFICATION_MGR_MAX_STORED];
-
     notification_group = group;
     root_obj = root;
 
@@ -110,6 +115,19 @@ static void notification_app_stop(void)
     notifications_ui_page_close();
 }
 
+static int notification_app_init(void)
+{
+    notifications = k_malloc(sizeof(zsw_not_mngr_notification_t) * ZSW_NOTIFICATION_MGR_MAX_STORED);
+
+    return notifications ? 0 : -ENOMEM;
+}
+
+static void notification_app_deinit(void)
+{
+    k_free(notifications);
+    notifications = NULL;
+}
+
 static int notification_app_add(void)
 {
     zsw_app_manager_add_application(&app);
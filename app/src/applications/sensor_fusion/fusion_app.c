@@ -28,6 +28,7 @@
 #include "events/zsw_periodic_event.h"
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
+#include "zsw_zbus_trace.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -45,7 +46,7 @@ static void on_zero_yaw(void);
 ZSW_LV_IMG_DECLARE(imu_sensor_icon);
 
 ZBUS_CHAN_DECLARE(periodic_event_100ms_chan);
-ZBUS_LISTENER_DEFINE(accel_app_lis, zbus_fetch_fusion_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(accel_app_lis, zbus_fetch_fusion_data_callback);
 
 static application_t app = {
     .name = "Fusion",
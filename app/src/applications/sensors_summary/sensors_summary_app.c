@@ -19,11 +19,13 @@
 #include <zephyr/init.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/zbus/zbus.h>
 #include <math.h>
 
 #include "sensors_summary_ui.h"
-#include "sensors/zsw_pressure_sensor.h"
-#include "sensors/zsw_light_sensor.h"
+#include "sensors/zsw_sensor_hub.h"
+#include "events/pressure_event.h"
+#include "events/light_event.h"
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
 
@@ -36,6 +38,9 @@ static void timer_callback(lv_timer_t *timer);
 
 ZSW_LV_IMG_DECLARE(move);
 
+ZBUS_CHAN_DECLARE(pressure_data_chan);
+ZBUS_CHAN_DECLARE(light_data_chan);
+
 static application_t app = {
     .name = "Sensor",
     .icon = ZSW_LV_IMG_USE(move),
@@ -47,25 +52,33 @@ static application_t app = {
 static lv_timer_t *refresh_timer;
 static float relative_pressure;
 
+static zsw_sensor_hub_sub_t pressure_sub = {
+    .sensor = ZSW_SENSOR_HUB_PRESSURE,
+    .interval_ms = CONFIG_APPLICATIONS_CONFIGURATION_SENSORS_SUMMARY_REFRESH_INTERVAL_MS,
+};
+
+static zsw_sensor_hub_sub_t light_sub = {
+    .sensor = ZSW_SENSOR_HUB_LIGHT,
+    .interval_ms = CONFIG_APPLICATIONS_CONFIGURATION_SENSORS_SUMMARY_REFRESH_INTERVAL_MS,
+};
+
 static void sensors_summary_app_start(lv_obj_t *root, lv_group_t *group)
 {
     sensors_summary_ui_show(root, on_close_sensors_summary, on_ref_set);
 
-    // Set inital relative pressure.
-    on_ref_set();
+    // Set from the first sample in timer_callback.
+    relative_pressure = 0;
 
-    // Increase ODR since we want high accuracy here.
-    zsw_pressure_sensor_set_odr(BOSCH_BMP581_ODR_160_HZ);
+    zsw_sensor_hub_subscribe(&pressure_sub);
+    zsw_sensor_hub_subscribe(&light_sub);
     refresh_timer = lv_timer_create(timer_callback, CONFIG_APPLICATIONS_CONFIGURATION_SENSORS_SUMMARY_REFRESH_INTERVAL_MS,
                                     NULL);
 }
 
 static void sensors_summary_app_stop(void)
 {
-    // Cleanup after ourselves
-    // TODO need mechanism so that multiple user can request ODR without
-    // breaking for another when changed.
-    zsw_pressure_sensor_set_odr(BOSCH_BMP581_ODR_DEFAULT);
+    zsw_sensor_hub_unsubscribe(&pressure_sub);
+    zsw_sensor_hub_unsubscribe(&light_sub);
     lv_timer_del(refresh_timer);
     sensors_summary_ui_remove();
 }
@@ -77,15 +90,19 @@ static double get_relative_height_m(double relative_pressure, double new_pressur
 
 static void timer_callback(lv_timer_t *timer)
 {
-    float pressure = 0.0;
-    float light = -1.0;
+    struct pressure_event pressure_evt = { 0 };
+    struct light_event light_evt = { .light = -1.0 };
+
+    zbus_chan_read(&pressure_data_chan, &pressure_evt, K_MSEC(100));
+    zbus_chan_read(&light_data_chan, &light_evt, K_MSEC(100));
 
-    zsw_pressure_sensor_get_pressure(&pressure);
-    zsw_light_sensor_get_light(&light);
+    if (relative_pressure == 0) {
+        relative_pressure = pressure_evt.pressure;
+    }
 
-    sensors_summary_ui_set_pressure(pressure);
-    sensors_summary_ui_set_light(light);
-    sensors_summary_ui_set_rel_height(get_relative_height_m(relative_pressure, pressure, 0.0));
+    sensors_summary_ui_set_pressure(pressure_evt.pressure);
+    sensors_summary_ui_set_light(light_evt.light);
+    sensors_summary_ui_set_rel_height(get_relative_height_m(relative_pressure, pressure_evt.pressure, 0.0));
 }
 
 static void on_close_sensors_summary(void)
@@ -95,7 +112,11 @@ static void on_close_sensors_summary(void)
 
 static void on_ref_set(void)
 {
-    zsw_pressure_sensor_get_pressure(&relative_pressure);
+    struct pressure_event evt;
+
+    if (zbus_chan_read(&pressure_data_chan, &evt, K_MSEC(100)) == 0) {
+        relative_pressure = evt.pressure;
+    }
 }
 
 static int sensors_summary_app_add(void)
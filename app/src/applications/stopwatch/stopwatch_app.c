@@ -24,6 +24,7 @@
 #include "ui/utils/zsw_ui_utils.h"
 #include "stopwatch_ui.h"
 #include "events/zsw_periodic_event.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(stopwatch_app, LOG_LEVEL_INF);
 
@@ -40,7 +41,7 @@ static void on_lap_cb(void);
 static void zbus_periodic_100ms_callback(const struct zbus_channel *chan);
 
 ZBUS_CHAN_DECLARE(periodic_event_100ms_chan);
-ZBUS_LISTENER_DEFINE(stopwatch_app_100ms_event_listener, zbus_periodic_100ms_callback);
+ZSW_ZBUS_LISTENER_DEFINE(stopwatch_app_100ms_event_listener, zbus_periodic_100ms_callback);
 
 ZSW_LV_IMG_DECLARE(stopwatch_app_icon);
 
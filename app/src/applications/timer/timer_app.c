@@ -12,6 +12,7 @@
 #include "events/zsw_periodic_event.h"
 #include "ui/popup/zsw_popup_window.h"
 #include "zsw_clock.h"
+#include "zsw_zbus_trace.h"
 LOG_MODULE_REGISTER(timer_app, LOG_LEVEL_DBG);
 
 #define SETTINGS_NAME_TIMER_APP     "timer_app"
@@ -24,10 +25,11 @@ static void timer_app_stop(void);
 static void on_timer_created_cb(uint32_t hour, uint32_t min, uint32_t sec, ui_timer_type_t type);
 static void on_timer_event_cb(timer_event_type_t evt_type, uint32_t timer_id);
 static void alarm_triggered_cb(void *user_data);
+static int timer_app_init(void);
 static void zbus_periodic_1s_callback(const struct zbus_channel *chan);
 
 ZBUS_CHAN_DECLARE(periodic_event_1s_chan);
-ZBUS_LISTENER_DEFINE(timer_app_1s_event_listener, zbus_periodic_1s_callback);
+ZSW_ZBUS_LISTENER_DEFINE(timer_app_1s_event_listener, zbus_periodic_1s_callback);
 
 ZSW_LV_IMG_DECLARE(timer_app_icon);
 
@@ -39,7 +41,10 @@ static application_t app = {
     .icon = ZSW_LV_IMG_USE(timer_app_icon),
     .start_func = timer_app_start,
     .stop_func = timer_app_stop,
-    .category = ZSW_APP_CATEGORY_ROOT
+    .init_func = timer_app_init,
+    .category = ZSW_APP_CATEGORY_ROOT,
+    // Alarms restored from settings must fire while closed
+    .background = true,
 };
 
 static void timer_app_start(lv_obj_t *root, lv_group_t *group)
@@ -269,15 +274,8 @@ static int timers_settings_load_cb(const char *p_key, size_t len,
     return 0;
 }
 
-static int timer_app_add(void)
+static int timer_app_init(void)
 {
-    if (!zsw_clock_rtc_available()) {
-        LOG_WRN("RTC not available, timer app disabled");
-        return 0;
-    }
-
-    zsw_app_manager_add_application(&app);
-
     if (settings_subsys_init()) {
         LOG_ERR("Error during settings_subsys_init!");
         return -EFAULT;
@@ -293,4 +291,16 @@ static int timer_app_add(void)
     return 0;
 }
 
+static int timer_app_add(void)
+{
+    if (!zsw_clock_rtc_available()) {
+        LOG_WRN("RTC not available, timer app disabled");
+        return 0;
+    }
+
+    zsw_app_manager_add_application(&app);
+
+    return 0;
+}
+
 SYS_INIT(timer_app_add, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
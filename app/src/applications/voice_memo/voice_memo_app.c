@@ -26,6 +26,7 @@
 #include "ui/utils/zsw_ui_utils.h"
 #include "events/zsw_voice_memo_event.h"
 #include "voice_memo_ui.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(voice_memo_app, CONFIG_ZSW_VOICE_MEMO_LOG_LEVEL);
 
@@ -56,8 +57,8 @@ ZBUS_CHAN_DECLARE(voice_memo_result_chan);
 static void on_recording_event(const struct zbus_channel *chan);
 static void on_result_event(const struct zbus_channel *chan);
 
-ZBUS_LISTENER_DEFINE(voice_memo_app_recording_lis, on_recording_event);
-ZBUS_LISTENER_DEFINE(voice_memo_app_result_lis, on_result_event);
+ZSW_ZBUS_LISTENER_DEFINE(voice_memo_app_recording_lis, on_recording_event);
+ZSW_ZBUS_LISTENER_DEFINE(voice_memo_app_result_lis, on_result_event);
 
 static bool recording_screen_shown;
 
@@ -168,7 +169,10 @@ static void refresh_list(void)
         }
     }
 
-    int count = zsw_recording_manager_list(list_entries, ZSW_RECORDING_MAX_FILES);
+    /* The newest recordings, the UI shows them newest first. */
+    int total = zsw_recording_manager_get_count();
+    size_t offset = total > ZSW_RECORDING_MAX_FILES ? total - ZSW_RECORDING_MAX_FILES : 0;
+    int count = zsw_recording_manager_list(list_entries, offset, ZSW_RECORDING_MAX_FILES);
     uint32_t free_bytes = 0;
     zsw_recording_manager_get_free_space(&free_bytes);
 
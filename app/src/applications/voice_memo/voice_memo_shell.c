@@ -15,6 +15,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <zephyr/shell/shell.h>
 #include "managers/zsw_recording_manager.h"
 
@@ -48,18 +49,17 @@ static int cmd_voice_memo_stop(const struct shell *sh, size_t argc, char **argv)
 
 static int cmd_voice_memo_list(const struct shell *sh, size_t argc, char **argv)
 {
-    ARG_UNUSED(argc);
-    ARG_UNUSED(argv);
-
     zsw_recording_entry_t entries[ZSW_RECORDING_MAX_FILES];
-    int count = zsw_recording_manager_list(entries, ARRAY_SIZE(entries));
+    size_t offset = argc > 1 ? strtoul(argv[1], NULL, 10) : 0;
+    int count = zsw_recording_manager_list(entries, offset, ARRAY_SIZE(entries));
 
     if (count < 0) {
         shell_print(sh, "Error listing recordings: %d", count);
         return count;
     }
 
-    shell_print(sh, "Recordings: %d", count);
+    shell_print(sh, "Recordings: %d-%d of %d", count > 0 ? (int)offset + 1 : 0, (int)offset + count,
+                zsw_recording_manager_get_count());
     for (int i = 0; i < count; i++) {
         uint32_t secs = (entries[i].duration_ms + 999) / 1000;
         shell_print(sh, "  %s  %u:%02u  %u bytes",
@@ -86,6 +86,32 @@ static int cmd_voice_memo_delete(const struct shell *sh, size_t argc, char **arg
     return ret;
 }
 
+#ifdef CONFIG_ZSW_VOICE_MEMO_PLAYBACK
+static int cmd_voice_memo_play(const struct shell *sh, size_t argc, char **argv)
+{
+    uint32_t start_s = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+
+    int ret = zsw_recording_manager_play(argv[1], start_s * 1000);
+    if (ret == 0) {
+        shell_print(sh, "Playing from %u ms", zsw_recording_manager_get_playback_ms());
+    } else {
+        shell_print(sh, "Failed to play: %d", ret);
+    }
+    return ret;
+}
+
+static int cmd_voice_memo_play_stop(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    uint32_t position_ms = zsw_recording_manager_get_playback_ms();
+    int ret = zsw_recording_manager_stop_playback();
+    shell_print(sh, "Playback stopped at %u ms", position_ms);
+    return ret;
+}
+#endif
+
 static int cmd_voice_memo_status(const struct shell *sh, size_t argc, char **argv)
 {
     ARG_UNUSED(argc);
@@ -106,15 +132,32 @@ static int cmd_voice_memo_status(const struct shell *sh, size_t argc, char **arg
         shell_print(sh, "Free space: %u KB (%u min at 32kbps)",
                     free_bytes / 1024, secs / 60);
     }
+
+    zsw_recording_stats_t stats;
+    zsw_recording_manager_get_stats(&stats);
+    if (stats.frames > 0) {
+        shell_print(sh, "Encode: avg %u us, max %u us, budget %u us, late %u of %u frames",
+                    stats.encode_avg_us, stats.encode_max_us, stats.frame_budget_us,
+                    stats.late_frames, stats.frames);
+        shell_print(sh, "PCM buffer: peak %u/%u bytes, dropped %u bytes",
+                    stats.ring_peak_bytes, stats.ring_size_bytes, stats.dropped_bytes);
+        shell_print(sh, "Opus: complexity %u (min %u), bitrate %u (min %u)",
+                    stats.complexity, stats.min_complexity, stats.bitrate, stats.min_bitrate);
+    }
     return 0;
 }
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_voice_memo,
                                SHELL_CMD(start, NULL, "Start recording", cmd_voice_memo_start),
                                SHELL_CMD(stop, NULL, "Stop recording", cmd_voice_memo_stop),
-                               SHELL_CMD(list, NULL, "List recordings", cmd_voice_memo_list),
+                               SHELL_CMD_ARG(list, NULL, "List recordings: list [offset]", cmd_voice_memo_list, 1, 1),
                                SHELL_CMD_ARG(delete, NULL, "Delete recording", cmd_voice_memo_delete, 2, 0),
                                SHELL_CMD(status, NULL, "Show recording status", cmd_voice_memo_status),
+                               SHELL_COND_CMD_ARG(CONFIG_ZSW_VOICE_MEMO_PLAYBACK, play, NULL,
+                                                  "Play recording: play <filename> [start_s]",
+                                                  cmd_voice_memo_play, 2, 1),
+                               SHELL_COND_CMD(CONFIG_ZSW_VOICE_MEMO_PLAYBACK, play_stop, NULL,
+                                              "Stop playback", cmd_voice_memo_play_stop),
                                SHELL_SUBCMD_SET_END
                               );
 SHELL_CMD_REGISTER(voice_memo, &sub_voice_memo, "Voice memo commands", NULL);
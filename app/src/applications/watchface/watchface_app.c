@@ -21,8 +21,6 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/sys/reboot.h>
-#include <zephyr/bluetooth/bluetooth.h>
-#include <zephyr/bluetooth/conn.h>
 #include <zephyr/logging/log.h>
 #include <lvgl.h>
 #include <zsw_clock.h>
@@ -31,16 +29,14 @@
 #include <zephyr/settings/settings.h>
 
 #include "watchface_app.h"
+#include "watchface_binding.h"
 #include "zsw_settings.h"
-#include "events/accel_event.h"
-#include "events/battery_event.h"
 #include "events/activity_event.h"
 #include "events/ble_event.h"
-#include "sensors/zsw_imu.h"
-#include "sensors/zsw_pressure_sensor.h"
 #include "drivers/zsw_display_control.h"
-#include "managers/zsw_notification_manager.h"
 #include "ui/watchfaces/zsw_watchface_dropdown_ui.h"
+#include "zsw_zbus_trace.h"
+#include "zsw_boot.h"
 
 LOG_MODULE_REGISTER(watcface_app, LOG_LEVEL_WRN);
 
@@ -49,35 +45,25 @@ LOG_MODULE_REGISTER(watcface_app, LOG_LEVEL_WRN);
 #define SMOOTH_TIME_UPDATE_INTERVAL   K_MSEC(50)
 
 static void zbus_ble_comm_data_callback(const struct zbus_channel *chan);
-static void zbus_accel_data_callback(const struct zbus_channel *chan);
-static void zbus_battery_sample_data_callback(const struct zbus_channel *chan);
 static void zbus_activity_event_callback(const struct zbus_channel *chan);
 static int settings_load_handler_watchface(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
                                            void *param);
 
 ZBUS_CHAN_DECLARE(ble_comm_data_chan);
-ZBUS_LISTENER_DEFINE(watchface_ble_comm_lis, zbus_ble_comm_data_callback);
-
-ZBUS_CHAN_DECLARE(accel_data_chan);
-ZBUS_LISTENER_DEFINE(watchface_accel_lis, zbus_accel_data_callback);
-
-ZBUS_CHAN_DECLARE(battery_sample_data_chan);
-ZBUS_LISTENER_DEFINE(watchface_battery_event, zbus_battery_sample_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_ble_comm_lis, zbus_ble_comm_data_callback);
 
 ZBUS_CHAN_DECLARE(activity_state_data_chan);
-ZBUS_LISTENER_DEFINE(watchface_activity_state_event, zbus_activity_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_activity_state_event, zbus_activity_event_callback);
 
 #define WORK_STACK_SIZE 3000
 #define WORK_PRIORITY   5
 
 #define RENDER_INTERVAL_LVGL    K_MSEC(100)
-#define SLOW_UPDATE_INTERVAL    K_MINUTES(1)
 
 typedef enum work_type {
     UPDATE_CLOCK,
-    UPDATE_VALUES,
     OPEN_WATCHFACE,
-    UPDATE_SLOW_VALUES
+    UPDATE_ACTIVITY
 } work_type_t;
 
 typedef struct delayed_work_item {
@@ -87,33 +73,17 @@ typedef struct delayed_work_item {
 
 static void general_work(struct k_work *item);
 
-static void check_notifications(void);
-static void update_ui_from_event(struct k_work *item);
+static void apply_bound_fields(uint32_t changed, const watchface_binding_values_t *values);
 static void watchface_gesture_cb(lv_event_t *e);
 
-static void connected(struct bt_conn *conn, uint8_t err);
-static void disconnected(struct bt_conn *conn, uint8_t reason);
-
-BT_CONN_CB_DEFINE(conn_callbacks) = {
-    .connected    = connected,
-    .disconnected = disconnected,
-};
-
 static delayed_work_item_t clock_work =     { .type = UPDATE_CLOCK };
-static delayed_work_item_t update_work =      { .type = UPDATE_VALUES };
-static delayed_work_item_t date_work =      { .type = UPDATE_SLOW_VALUES };
+// Starting and stopping the bindings reads sensors, not done in the activity listener.
+static delayed_work_item_t activity_work =  { .type = UPDATE_ACTIVITY };
 
 static delayed_work_item_t general_work_item;
 static struct k_work_sync cancel_work_sync;
 
-static K_WORK_DEFINE(update_ui_work, update_ui_from_event);
-static ble_comm_data_type_t last_data_update_type;
-static ble_comm_weather_t last_weather_data;
-static ble_comm_music_info_t last_music_info;
-static struct battery_sample_event last_batt_evt = {.percent = 100, .mV = 4300};
-
 static bool running;
-static bool is_connected;
 static bool is_suspended;
 static bool watchface_views_created;
 static lv_obj_t *watchface_root_screen;
@@ -128,8 +98,7 @@ static int watchface_app_init(void)
 {
     k_work_init_delayable(&general_work_item.work, general_work);
     k_work_init_delayable(&clock_work.work, general_work);
-    k_work_init_delayable(&update_work.work, general_work);
-    k_work_init_delayable(&date_work.work, general_work);
+    k_work_init_delayable(&activity_work.work, general_work);
     running = false;
     is_suspended = false;
     watchface_views_created = false;
@@ -170,9 +139,9 @@ void watchface_app_stop(void)
 {
     running = false;
     is_suspended = false;
+    k_work_cancel_delayable_sync(&activity_work.work, &cancel_work_sync);
+    watchface_binding_stop();
     k_work_cancel_delayable_sync(&clock_work.work, &cancel_work_sync);
-    k_work_cancel_delayable_sync(&update_work.work, &cancel_work_sync);
-    k_work_cancel_delayable_sync(&date_work.work, &cancel_work_sync);
     k_work_cancel_delayable_sync(&general_work_item.work, &cancel_work_sync);
 
     if (watchface_views_created) {
@@ -198,6 +167,7 @@ void watchface_change(int index)
         return;
     }
 
+    watchface_binding_stop();
     watchfaces[watchface_settings.watchface_index]->remove();
 
     // Make sure we have the latest settings
@@ -241,26 +211,44 @@ int watchface_app_get_face_info(int index, const lv_img_dsc_t **preview,  const
     return 0;
 }
 
-static void refresh_ui(void)
+const char *watchface_app_get_face_asset_prefix(int index)
 {
-    uint32_t steps;
-    watchfaces[watchface_settings.watchface_index]->set_ble_connected(is_connected);
-    watchfaces[watchface_settings.watchface_index]->set_battery_percent(last_batt_evt.percent, last_batt_evt.mV);
-    if (watchfaces[watchface_settings.watchface_index]->set_charging) {
-        watchfaces[watchface_settings.watchface_index]->set_charging(last_batt_evt.is_charging);
+    if (index < 0 || index >= num_watchfaces) {
+        return NULL;
     }
-    zsw_watchface_dropdown_ui_set_battery_info(last_batt_evt.percent, last_batt_evt.is_charging, last_batt_evt.tte,
-                                               last_batt_evt.ttf);
-    if (strlen(last_weather_data.report_text) > 0) {
-        watchfaces[watchface_settings.watchface_index]->set_weather(last_weather_data.temperature_c,
-                                                                    last_weather_data.weather_code);
+
+    return watchfaces[index]->asset_prefix;
+}
+
+static void apply_bound_fields(uint32_t changed, const watchface_binding_values_t *values)
+{
+    watchface_ui_api_t *watchface = watchfaces[watchface_settings.watchface_index];
+
+    if (changed & WATCHFACE_FIELD_BLE_CONNECTED) {
+        watchface->set_ble_connected(values->ble_connected);
+    }
+    if (changed & WATCHFACE_FIELD_BATTERY) {
+        watchface->set_battery_percent(values->battery_percent, values->battery_mv);
+        if (watchface->set_charging) {
+            watchface->set_charging(values->is_charging);
+        }
+        zsw_watchface_dropdown_ui_set_battery_info(values->battery_percent, values->is_charging, values->tte, values->ttf);
     }
-    if (zsw_imu_fetch_num_steps(&steps) == 0) {
+    if ((changed & WATCHFACE_FIELD_WEATHER) && values->has_weather) {
+        watchface->set_weather(values->temperature, values->weather_code);
+    }
+    if (changed & WATCHFACE_FIELD_STEPS) {
         // TODO: Add calculation for distance and kcal
-        watchfaces[watchface_settings.watchface_index]->set_step(steps, 0, 0);
+        watchface->set_step(values->steps, 0, 0);
+    }
+    if (changed & WATCHFACE_FIELD_NOTIFICATIONS) {
+        watchface->set_num_notifcations(values->num_notifications);
+    }
+    if ((changed & WATCHFACE_FIELD_MUSIC) && strlen(values->track_name) > 0) {
+        zsw_watchface_dropdown_ui_set_music_info(values->track_name, values->artist);
     }
-    if (strlen(last_music_info.track_name) > 0) {
-        zsw_watchface_dropdown_ui_set_music_info(last_music_info.track_name, last_music_info.artist);
+    if ((changed & WATCHFACE_FIELD_PRESSURE) && values->has_pressure) {
+        watchface->set_watch_env_sensors((int)values->pressure);
     }
 }
 
@@ -269,7 +257,6 @@ static void general_work(struct k_work *item)
     struct k_work_delayable *delayable_work = CONTAINER_OF(item, struct k_work_delayable, work);
 
     delayed_work_item_t *the_work = CONTAINER_OF(delayable_work, delayed_work_item_t, work);
-    uint32_t steps;
 
     switch (the_work->type) {
         case OPEN_WATCHFACE: {
@@ -279,24 +266,10 @@ static void general_work(struct k_work *item)
             watchfaces[watchface_settings.watchface_index]->show(watchface_root_screen, watchface_evt_cb, &watchface_settings);
             zsw_watchface_dropdown_ui_add(watchface_root_screen, watchface_evt_cb, zsw_display_control_get_brightness());
             watchface_views_created = true;
-            refresh_ui();
+            watchface_binding_start(apply_bound_fields);
+            zsw_boot_first_frame_pending();
 
             __ASSERT(0 <= k_work_schedule(&clock_work.work, K_NO_WAIT), "FAIL clock_work");
-            __ASSERT(0 <= k_work_schedule(&update_work.work, K_SECONDS(1)), "FAIL update_work");
-            __ASSERT(0 <= k_work_schedule(&date_work.work, K_SECONDS(1)), "FAIL date_work");
-            general_work_item.type = UPDATE_SLOW_VALUES;
-            __ASSERT(0 <= k_work_schedule(&general_work_item.work, K_MSEC(100)), "FAIL schedule");
-            break;
-        }
-        case UPDATE_VALUES: {
-            check_notifications();
-
-            // Realtime update of steps
-            if (zsw_imu_fetch_num_steps(&steps) == 0) {
-                // TODO: Add calculation for distance and kcal
-                watchfaces[watchface_settings.watchface_index]->set_step(steps, 0, 0);
-            }
-            __ASSERT(0 <= k_work_schedule(&update_work.work, K_SECONDS(1)), "FAIL update_work");
             break;
         }
         case UPDATE_CLOCK: {
@@ -314,64 +287,21 @@ static void general_work(struct k_work *item)
                                           watchface_settings.smooth_second_hand ? SMOOTH_TIME_UPDATE_INTERVAL : NORMAL_TIME_UPDATE_INTERVAL), "FAIL clock_work");
             break;
         }
-        case UPDATE_SLOW_VALUES: {
-            float pressure = 0.0;
-            zsw_timeval_t time;
-            zsw_clock_get_time(&time);
-
-            zsw_pressure_sensor_get_pressure(&pressure);
-            watchfaces[watchface_settings.watchface_index]->set_watch_env_sensors((int)pressure);
-
-            __ASSERT(0 <= k_work_schedule(&date_work.work, SLOW_UPDATE_INTERVAL), "FAIL date_work");
-        }
-    }
-}
-
-static void check_notifications(void)
-{
-    uint32_t num_unread = zsw_notification_manager_get_num();
-    watchfaces[watchface_settings.watchface_index]->set_num_notifcations(num_unread);
-}
-
-static void connected(struct bt_conn *conn, uint8_t err)
-{
-    is_connected = true;
-    if (!running || is_suspended) {
-        return;
-    }
-    if (err) {
-        LOG_ERR("Connection failed (err %u)", err);
-        return;
-    }
-    watchfaces[watchface_settings.watchface_index]->set_ble_connected(true);
-}
-
-static void disconnected(struct bt_conn *conn, uint8_t reason)
-{
-    is_connected = false;
-    if (!running || is_suspended) {
-        return;
-    }
-    watchfaces[watchface_settings.watchface_index]->set_ble_connected(false);
-}
-
-static void update_ui_from_event(struct k_work *item)
-{
-    if (running && !is_suspended) {
-        if (last_data_update_type == BLE_COMM_DATA_TYPE_WEATHER) {
-            LOG_DBG("Weather: %s t: %d hum: %d code: %d wind: %d dir: %d", last_weather_data.report_text,
-                    last_weather_data.temperature_c, last_weather_data.humidity,
-                    last_weather_data.weather_code,
-                    last_weather_data.wind,
-                    last_weather_data.wind_direction);
-            watchfaces[watchface_settings.watchface_index]->set_weather(last_weather_data.temperature_c,
-                                                                        last_weather_data.weather_code);
-        } else if (last_data_update_type == BLE_COMM_DATA_TYPE_SET_TIME) {
-            k_work_reschedule(&date_work.work, K_NO_WAIT);
-        } else if (last_data_update_type == BLE_COMM_DATA_TYPE_MUSIC_INFO) {
-            zsw_watchface_dropdown_ui_set_music_info(last_music_info.track_name, last_music_info.artist);
+        case UPDATE_ACTIVITY: {
+            if (!running) {
+                break;
+            }
+            // Only the latest state matters if it changed again before this ran.
+            if (is_suspended) {
+                watchface_binding_stop();
+                k_work_cancel_delayable(&clock_work.work);
+            } else {
+                watchfaces[watchface_settings.watchface_index]->ui_invalidate_cached();
+                watchface_binding_start(apply_bound_fields);
+                __ASSERT(0 <= k_work_schedule(&clock_work.work, K_NO_WAIT), "FAIL clock_work");
+            }
+            break;
         }
-        return;
     }
 }
 
@@ -391,40 +321,9 @@ static void watchface_gesture_cb(lv_event_t *e)
 static void zbus_ble_comm_data_callback(const struct zbus_channel *chan)
 {
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
-    last_data_update_type = event->data.type;
-    if (event->data.type == BLE_COMM_DATA_TYPE_WEATHER) {
-        memcpy(&last_weather_data, &event->data.data.weather, sizeof(event->data.data.weather));
-    }
-    if (event->data.type == BLE_COMM_DATA_TYPE_MUSIC_INFO) {
-        memcpy(&last_music_info, &event->data.data.music_info, sizeof(event->data.data.music_info));
-    }
-    if (running && !is_suspended) {
-        k_work_submit(&update_ui_work);
-    }
-}
 
-static void zbus_accel_data_callback(const struct zbus_channel *chan)
-{
-    if (running && !is_suspended) {
-        const struct accel_event *event = zbus_chan_const_msg(chan);
-        if (event->data.type == ZSW_IMU_EVT_TYPE_STEP) {
-            // TODO: Add calculation for distance and kcal
-            watchfaces[watchface_settings.watchface_index]->set_step(event->data.data.step.count, 0, 0);
-        }
-    }
-}
-
-static void zbus_battery_sample_data_callback(const struct zbus_channel *chan)
-{
-    const struct battery_sample_event *event = zbus_chan_const_msg(chan);
-    memcpy(&last_batt_evt, event, sizeof(struct battery_sample_event));
-
-    if (running && !is_suspended) {
-        watchfaces[watchface_settings.watchface_index]->set_battery_percent(event->percent, event->mV);
-        if (watchfaces[watchface_settings.watchface_index]->set_charging) {
-            watchfaces[watchface_settings.watchface_index]->set_charging(event->is_charging);
-        }
-        zsw_watchface_dropdown_ui_set_battery_info(last_batt_evt.percent, event->is_charging, event->tte, event->ttf);
+    if (event->data->type == BLE_COMM_DATA_TYPE_SET_TIME && running && !is_suspended) {
+        k_work_reschedule(&clock_work.work, K_NO_WAIT);
     }
 }
 
@@ -434,16 +333,10 @@ static void zbus_activity_event_callback(const struct zbus_channel *chan)
         const struct activity_state_event *event = zbus_chan_const_msg(chan);
         if (event->state == ZSW_ACTIVITY_STATE_INACTIVE) {
             is_suspended = true;
-            k_work_cancel_delayable_sync(&clock_work.work, &cancel_work_sync);
-            k_work_cancel_delayable_sync(&date_work.work, &cancel_work_sync);
-            k_work_cancel_delayable_sync(&update_work.work, &cancel_work_sync);
+            k_work_reschedule(&activity_work.work, K_NO_WAIT);
         } else if (event->state == ZSW_ACTIVITY_STATE_ACTIVE) {
             is_suspended = false;
-            watchfaces[watchface_settings.watchface_index]->ui_invalidate_cached();
-            refresh_ui();
-            __ASSERT(0 <= k_work_schedule(&clock_work.work, K_NO_WAIT), "FAIL clock_work");
-            __ASSERT(0 <= k_work_schedule(&date_work.work, K_SECONDS(1)), "FAIL clock_work");
-            __ASSERT(0 <= k_work_schedule(&update_work.work, K_SECONDS(1)), "FAIL clock_work");
+            k_work_reschedule(&activity_work.work, K_NO_WAIT);
         }
     }
 }
@@ -71,6 +71,8 @@ typedef struct watchface_ui_api_t {
     void (*ui_invalidate_cached)(void);
     const void *(*get_preview_img)(void);
     const char *name;
+    // Optional, file name prefix of the watchface images in the external flash file system
+    const char *asset_prefix;
 } watchface_ui_api_t;
 
 void watchface_app_start(lv_obj_t *root_screen, lv_group_t *group, watchface_app_evt_listener evt_cb);
@@ -81,3 +83,4 @@ void watchface_app_register_ui(watchface_ui_api_t *ui);
 
 int watchface_app_get_num_faces(void);
 int watchface_app_get_face_info(int index, const lv_img_dsc_t **preview,  const char **name);
+const char *watchface_app_get_face_asset_prefix(int index);
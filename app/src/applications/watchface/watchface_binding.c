@@ -0,0 +1,263 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/logging/log.h>
+
+#include "watchface_binding.h"
+#include "events/accel_event.h"
+#include "events/battery_event.h"
+#include "events/ble_event.h"
+#include "events/pressure_event.h"
+#include "sensors/zsw_imu.h"
+#include "sensors/zsw_sensor_hub.h"
+#include "managers/zsw_notification_manager.h"
+#include "zsw_zbus_trace.h"
+
+LOG_MODULE_REGISTER(watchface_binding, LOG_LEVEL_WRN);
+
+// Shown as a whole number, a slow rate that other sensors can take along is enough.
+#define PRESSURE_INTERVAL_MS    (60 * MSEC_PER_SEC)
+#define PRESSURE_LATENCY_MS     (30 * MSEC_PER_SEC)
+
+static void zbus_accel_data_callback(const struct zbus_channel *chan);
+static void zbus_battery_sample_data_callback(const struct zbus_channel *chan);
+static void zbus_ble_comm_data_callback(const struct zbus_channel *chan);
+static void zbus_notification_callback(const struct zbus_channel *chan);
+static void zbus_pressure_callback(const struct zbus_channel *chan);
+static void flush_work_handler(struct k_work *item);
+
+static void connected(struct bt_conn *conn, uint8_t err);
+static void disconnected(struct bt_conn *conn, uint8_t reason);
+
+ZBUS_CHAN_DECLARE(accel_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_accel_lis, zbus_accel_data_callback);
+
+ZBUS_CHAN_DECLARE(battery_sample_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_battery_event, zbus_battery_sample_data_callback);
+
+ZBUS_CHAN_DECLARE(ble_comm_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_binding_ble_comm_lis, zbus_ble_comm_data_callback);
+ZBUS_CHAN_ADD_OBS(ble_comm_data_chan, watchface_binding_ble_comm_lis, 1);
+
+ZBUS_CHAN_DECLARE(zsw_notification_mgr_chan);
+ZBUS_CHAN_DECLARE(zsw_notification_mgr_remove_chan);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_binding_notification_lis, zbus_notification_callback);
+ZBUS_CHAN_ADD_OBS(zsw_notification_mgr_chan, watchface_binding_notification_lis, 1);
+ZBUS_CHAN_ADD_OBS(zsw_notification_mgr_remove_chan, watchface_binding_notification_lis, 1);
+
+ZBUS_CHAN_DECLARE(pressure_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(watchface_binding_pressure_lis, zbus_pressure_callback);
+ZBUS_CHAN_ADD_OBS(pressure_data_chan, watchface_binding_pressure_lis, 1);
+
+BT_CONN_CB_DEFINE(watchface_binding_conn_callbacks) = {
+    .connected    = connected,
+    .disconnected = disconnected,
+};
+
+static K_WORK_DEFINE(flush_work, flush_work_handler);
+static struct k_work_sync cancel_work_sync;
+
+static struct k_spinlock lock;
+static watchface_binding_values_t values = {
+    .battery_percent = 100,
+    .battery_mv = 4300,
+};
+// Fields that differ from what the watchface shows.
+static uint32_t changed;
+static watchface_binding_apply_cb apply_cb;
+
+static zsw_sensor_hub_sub_t pressure_sub = {
+    .sensor = ZSW_SENSOR_HUB_PRESSURE,
+    .interval_ms = PRESSURE_INTERVAL_MS,
+    .latency_ms = PRESSURE_LATENCY_MS,
+};
+
+static void mark_changed(uint32_t fields)
+{
+    changed |= fields;
+    if (apply_cb) {
+        k_work_submit(&flush_work);
+    }
+}
+
+static void flush_work_handler(struct k_work *item)
+{
+    watchface_binding_values_t snapshot;
+    watchface_binding_apply_cb apply;
+    uint32_t fields;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    apply = apply_cb;
+    if (apply == NULL || changed == 0) {
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    fields = changed;
+    changed = 0;
+    snapshot = values;
+    k_spin_unlock(&lock, key);
+
+    LOG_DBG("Apply fields 0x%x", fields);
+    apply(fields, &snapshot);
+}
+
+void watchface_binding_start(watchface_binding_apply_cb apply)
+{
+    uint32_t steps;
+    // Step events only come every few steps, read the counter once when the watchface is shown.
+    bool has_steps = zsw_imu_fetch_num_steps(&steps) == 0;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (has_steps) {
+        values.steps = steps;
+    }
+    values.num_notifications = zsw_notification_manager_get_num();
+    apply_cb = apply;
+    mark_changed(WATCHFACE_FIELD_ALL);
+    k_spin_unlock(&lock, key);
+
+    zsw_sensor_hub_subscribe(&pressure_sub);
+}
+
+void watchface_binding_stop(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    apply_cb = NULL;
+    k_spin_unlock(&lock, key);
+
+    zsw_sensor_hub_unsubscribe(&pressure_sub);
+    k_work_cancel_sync(&flush_work, &cancel_work_sync);
+}
+
+static void zbus_accel_data_callback(const struct zbus_channel *chan)
+{
+    const struct accel_event *event = zbus_chan_const_msg(chan);
+    k_spinlock_key_t key;
+
+    if (event->data.type != ZSW_IMU_EVT_TYPE_STEP) {
+        return;
+    }
+
+    key = k_spin_lock(&lock);
+    if (event->data.data.step.count != values.steps) {
+        values.steps = event->data.data.step.count;
+        mark_changed(WATCHFACE_FIELD_STEPS);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static void zbus_battery_sample_data_callback(const struct zbus_channel *chan)
+{
+    const struct battery_sample_event *event = zbus_chan_const_msg(chan);
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (event->percent != values.battery_percent || event->mV != values.battery_mv ||
+        event->is_charging != values.is_charging || (int)event->tte != values.tte || (int)event->ttf != values.ttf) {
+        values.battery_percent = event->percent;
+        values.battery_mv = event->mV;
+        values.is_charging = event->is_charging;
+        values.tte = event->tte;
+        values.ttf = event->ttf;
+        mark_changed(WATCHFACE_FIELD_BATTERY);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static void zbus_ble_comm_data_callback(const struct zbus_channel *chan)
+{
+    const struct ble_data_event *event = zbus_chan_const_msg(chan);
+    k_spinlock_key_t key;
+
+    if (event->data->type == BLE_COMM_DATA_TYPE_WEATHER) {
+        const ble_comm_weather_t *weather = &event->data->data.weather;
+
+        key = k_spin_lock(&lock);
+        if (strlen(weather->report_text) > 0 && (!values.has_weather || weather->temperature_c != values.temperature ||
+                                                 weather->weather_code != values.weather_code)) {
+            values.has_weather = true;
+            values.temperature = weather->temperature_c;
+            values.weather_code = weather->weather_code;
+            mark_changed(WATCHFACE_FIELD_WEATHER);
+        }
+        k_spin_unlock(&lock, key);
+    } else if (event->data->type == BLE_COMM_DATA_TYPE_MUSIC_INFO) {
+        const ble_comm_music_info_t *music = &event->data->data.music_info;
+
+        key = k_spin_lock(&lock);
+        if (strcmp(music->track_name, values.track_name) != 0 || strcmp(music->artist, values.artist) != 0) {
+            strcpy(values.track_name, music->track_name);
+            strcpy(values.artist, music->artist);
+            mark_changed(WATCHFACE_FIELD_MUSIC);
+        }
+        k_spin_unlock(&lock, key);
+    }
+}
+
+static void zbus_notification_callback(const struct zbus_channel *chan)
+{
+    uint32_t num_notifications = zsw_notification_manager_get_num();
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (num_notifications != values.num_notifications) {
+        values.num_notifications = num_notifications;
+        mark_changed(WATCHFACE_FIELD_NOTIFICATIONS);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static void zbus_pressure_callback(const struct zbus_channel *chan)
+{
+    const struct pressure_event *event = zbus_chan_const_msg(chan);
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (!values.has_pressure || (int)event->pressure != (int)values.pressure) {
+        values.has_pressure = true;
+        values.pressure = event->pressure;
+        mark_changed(WATCHFACE_FIELD_PRESSURE);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static void set_connected(bool connected)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (connected != values.ble_connected) {
+        values.ble_connected = connected;
+        mark_changed(WATCHFACE_FIELD_BLE_CONNECTED);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+    if (err) {
+        return;
+    }
+    set_connected(true);
+}
+
+static void disconnected(struct bt_conn *conn, uint8_t reason)
+{
+    set_connected(false);
+}
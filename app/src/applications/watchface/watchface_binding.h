@@ -0,0 +1,72 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/util.h>
+
+#include "ble/ble_comm.h"
+
+/** @brief Watchface fields, each one is bound to the event source that changes it. */
+typedef enum watchface_field_t {
+    WATCHFACE_FIELD_STEPS           = BIT(0),
+    WATCHFACE_FIELD_NOTIFICATIONS   = BIT(1),
+    WATCHFACE_FIELD_BATTERY         = BIT(2),
+    WATCHFACE_FIELD_BLE_CONNECTED   = BIT(3),
+    WATCHFACE_FIELD_WEATHER         = BIT(4),
+    WATCHFACE_FIELD_MUSIC           = BIT(5),
+    WATCHFACE_FIELD_PRESSURE        = BIT(6),
+    WATCHFACE_FIELD_ALL             = BIT_MASK(7),
+} watchface_field_t;
+
+typedef struct watchface_binding_values_t {
+    uint32_t steps;
+    uint32_t num_notifications;
+    int battery_percent;
+    int battery_mv;
+    bool is_charging;
+    int tte;
+    int ttf;
+    bool ble_connected;
+    bool has_weather;
+    int8_t temperature;
+    int weather_code;
+    char track_name[MAX_MUSIC_FIELD_LENGTH + 1];
+    char artist[MAX_MUSIC_FIELD_LENGTH + 1];
+    bool has_pressure;
+    float pressure;
+} watchface_binding_values_t;
+
+/** @brief          Called from the system workqueue, the same as LVGL rendering, with all fields
+ *                  that changed since the last call.
+ *  @param changed  Bitmask of watchface_field_t
+ *  @param values   Latest value of every field
+*/
+typedef void (*watchface_binding_apply_cb)(uint32_t changed, const watchface_binding_values_t *values);
+
+/** @brief          Start pushing field changes to a watchface.
+ *                  The sources are always tracked, start applies every field once and after that only
+ *                  the changed ones. Sensors only sampled for the watchface are subscribed to until stop. Changes arriving close together are applied in one call, so the
+ *                  watchface is invalidated once per frame instead of once per event.
+ *  @param apply    Callback that updates the watchface
+*/
+void watchface_binding_start(watchface_binding_apply_cb apply);
+
+/** @brief Stop pushing changes, for example when the watchface is removed or the display is off. */
+void watchface_binding_stop(void);
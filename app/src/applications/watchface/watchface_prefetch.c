@@ -0,0 +1,112 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <lvgl.h>
+
+#include "watchface_prefetch.h"
+#include "watchface_app.h"
+#include "filesystem/zsw_filesystem.h"
+
+LOG_MODULE_REGISTER(watchface_prefetch, LOG_LEVEL_WRN);
+
+#define PREFETCH_INTERVAL_MS        10
+#define PREFETCH_RELEASE_DELAY_MS   3000
+#define PREFETCH_NUM_FACES          3
+
+static lv_timer_t *prefetch_timer;
+static lv_timer_t *release_timer;
+
+static const char *prefixes[PREFETCH_NUM_FACES];
+static int num_prefixes;
+static int prefix_index;
+static uint32_t cursor;
+
+static void prefetch_timer_cb(lv_timer_t *timer)
+{
+    int rc;
+
+    while (prefix_index < num_prefixes) {
+        rc = zsw_filesystem_prefetch_next(prefixes[prefix_index], &cursor);
+        if (rc == 0) {
+            // One file per tick to keep the picker responsive
+            return;
+        } else if (rc != -ENOENT) {
+            LOG_DBG("Prefetch stopped: %d", rc);
+            break;
+        }
+        prefix_index++;
+        cursor = 0;
+    }
+
+    lv_timer_delete(prefetch_timer);
+    prefetch_timer = NULL;
+}
+
+static void release_timer_cb(lv_timer_t *timer)
+{
+    release_timer = NULL;
+    zsw_filesystem_prefetch_release();
+}
+
+void watchface_prefetch_start(int index)
+{
+    // Most likely selected first, the cache replaces the pages of earlier requests first.
+    const int faces[PREFETCH_NUM_FACES] = { index, index + 1, index - 1 };
+    const char *prefix;
+
+    if (!IS_ENABLED(CONFIG_STORE_IMAGES_EXTERNAL_FLASH) || CONFIG_ZSW_FS_PREFETCH_SIZE == 0) {
+        return;
+    }
+
+    if (release_timer) {
+        lv_timer_delete(release_timer);
+        release_timer = NULL;
+    }
+
+    num_prefixes = 0;
+    for (int i = 0; i < ARRAY_SIZE(faces); i++) {
+        prefix = watchface_app_get_face_asset_prefix(faces[i]);
+        if (prefix) {
+            prefixes[num_prefixes++] = prefix;
+        }
+    }
+    prefix_index = 0;
+    cursor = 0;
+
+    zsw_filesystem_prefetch_begin();
+    if (prefetch_timer == NULL) {
+        prefetch_timer = lv_timer_create(prefetch_timer_cb, PREFETCH_INTERVAL_MS, NULL);
+    }
+}
+
+void watchface_prefetch_release(void)
+{
+    if (prefetch_timer) {
+        lv_timer_delete(prefetch_timer);
+        prefetch_timer = NULL;
+    }
+
+    if (!IS_ENABLED(CONFIG_STORE_IMAGES_EXTERNAL_FLASH) || release_timer) {
+        return;
+    }
+
+    release_timer = lv_timer_create(release_timer_cb, PREFETCH_RELEASE_DELAY_MS, NULL);
+    lv_timer_set_repeat_count(release_timer, 1);
+}
@@ -0,0 +1,32 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/** @brief          Load the image headers of a watchface and its neighbours in the background, so
+ *                  switching to one of them does not wait for one flash read per image.
+ *                  Loads one file per LVGL timer tick, replaces any earlier request.
+ *                  Must be called from the LVGL thread.
+ *  @param index    Watchface that is most likely selected next, for example the one centered
+ *                  in the watchface picker
+*/
+void watchface_prefetch_start(int index);
+
+/** @brief Stop loading and free the loaded data after a short delay, long enough for a just
+ *         selected watchface to be shown with it.
+*/
+void watchface_prefetch_release(void);
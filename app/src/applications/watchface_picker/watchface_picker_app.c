@@ -23,6 +23,7 @@
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
 #include "applications/watchface/watchface_app.h"
+#include "applications/watchface/watchface_prefetch.h"
 
 LOG_MODULE_REGISTER(watchface_picker_app, CONFIG_ZSW_REMOTE_APP_LOG_LEVEL);
 
@@ -45,9 +46,14 @@ static void on_watchface_selected(int index)
     zsw_app_manager_app_close_request(&app);
 }
 
+static void on_watchface_focused(int index)
+{
+    watchface_prefetch_start(index);
+}
+
 static void watchface_picker_app_start(lv_obj_t *root, lv_group_t *group)
 {
-    watchface_picker_ui_show(root, on_watchface_selected);
+    watchface_picker_ui_show(root, on_watchface_selected, on_watchface_focused);
     for (int i = 0; i < watchface_app_get_num_faces(); i++) {
         const char *name;
         const lv_img_dsc_t *img;
@@ -56,11 +62,14 @@ static void watchface_picker_app_start(lv_obj_t *root, lv_group_t *group)
     }
 
     watchface_picker_ui_set_selected(watchface_app_get_current_face());
+    watchface_prefetch_start(watchface_app_get_current_face());
 }
 
 static void watchface_picker_app_stop(void)
 {
     watchface_picker_ui_remove();
+    // Keep the pages until the selected watchface has read them
+    watchface_prefetch_release();
 }
 
 static int watchface_picker_app_add(void)
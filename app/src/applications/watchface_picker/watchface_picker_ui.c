@@ -15,6 +15,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 
@@ -23,6 +24,8 @@
 
 static lv_obj_t *ui_faceSelect;
 static on_watchface_selected_cb_t watchface_selected_cb;
+static on_watchface_focused_cb_t watchface_focused_cb;
+static int focused_index;
 
 void on_watchface_selected(lv_event_t *e)
 {
@@ -34,6 +37,32 @@ void on_watchface_selected(lv_event_t *e)
     }
 }
 
+static void on_scroll_end(lv_event_t *e)
+{
+    lv_area_t area;
+    int32_t center;
+    int32_t distance;
+    int32_t min_distance = INT32_MAX;
+    int closest = focused_index;
+
+    lv_obj_get_coords(ui_faceSelect, &area);
+    center = area.x1 + lv_area_get_width(&area) / 2;
+
+    for (int i = 0; i < lv_obj_get_child_cnt(ui_faceSelect); i++) {
+        lv_obj_get_coords(lv_obj_get_child(ui_faceSelect, i), &area);
+        distance = abs(area.x1 + lv_area_get_width(&area) / 2 - center);
+        if (distance < min_distance) {
+            min_distance = distance;
+            closest = i;
+        }
+    }
+
+    if (closest != focused_index) {
+        focused_index = closest;
+        watchface_focused_cb(closest);
+    }
+}
+
 void watchface_picker_ui_add_watchface(const lv_img_dsc_t *src, const char *name, int index)
 {
     lv_obj_t *ui_faceItem = lv_obj_create(ui_faceSelect);
@@ -82,9 +111,12 @@ void watchface_picker_ui_add_watchface(const lv_img_dsc_t *src, const char *name
     lv_obj_set_style_outline_pad(ui_face_outline, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
 }
 
-void watchface_picker_ui_show(lv_obj_t *root, on_watchface_selected_cb_t select_cb)
+void watchface_picker_ui_show(lv_obj_t *root, on_watchface_selected_cb_t select_cb,
+                              on_watchface_focused_cb_t focus_cb)
 {
     watchface_selected_cb = select_cb;
+    watchface_focused_cb = focus_cb;
+    focused_index = -1;
     ui_faceSelect = lv_obj_create(root);
     lv_obj_set_width( ui_faceSelect, 240);
     lv_obj_set_height( ui_faceSelect, 240);
@@ -103,11 +135,13 @@ void watchface_picker_ui_show(lv_obj_t *root, on_watchface_selected_cb_t select_
     lv_obj_set_style_pad_bottom(ui_faceSelect, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_row(ui_faceSelect, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_pad_column(ui_faceSelect, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_event_cb(ui_faceSelect, on_scroll_end, LV_EVENT_SCROLL_END, NULL);
 }
 
 void watchface_picker_ui_set_selected(int index)
 {
     if (index < lv_obj_get_child_cnt(ui_faceSelect)) {
+        focused_index = index;
         lv_obj_scroll_to_view(lv_obj_get_child(ui_faceSelect, index), LV_ANIM_ON);
     }
 }
@@ -19,33 +19,52 @@
 #include <zephyr/init.h>
 #include <zephyr/zbus/zbus.h>
 #include <zephyr/logging/log.h>
-#include "cJSON.h"
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/timeutil.h>
 
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
 #include "events/ble_event.h"
 #include <ble/ble_http.h>
 #include "weather_ui.h"
+#include "weather_parser.h"
 #include <zsw_clock.h>
 #include <stdio.h>
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(weather_app, LOG_LEVEL_DBG);
 
-#define HTTP_REQUEST_URL_FMT "https://api.open-meteo.com/v1/forecast?latitude=%f&longitude=%f&current=wind_speed_10m,temperature_2m,apparent_temperature,weather_code&daily=weather_code,temperature_2m_max,temperature_2m_min,apparent_temperature_max,apparent_temperature_min,precipitation_sum,rain_sum,precipitation_probability_max&wind_speed_unit=ms&timezone=auto&forecast_days=%d"
+#define HTTP_REQUEST_URL_FMT "https://api.open-meteo.com/v1/forecast?latitude=%f&longitude=%f&current=wind_speed_10m,temperature_2m,apparent_temperature,weather_code&daily=weather_code,temperature_2m_max,temperature_2m_min,precipitation_probability_max&wind_speed_unit=ms&timezone=auto&forecast_days=%d"
 
 #define MAX_GPS_AGED_TIME_MS 30 * 60 * 1000
 #define WEATHER_BACKGROUND_FETCH_INTERVAL_S (30 * 60)
 
+#define SECONDS_PER_DAY             (24 * 60 * 60)
+#define SETTING_WEATHER_CACHE_KEY   "weather/cache"
+// Shown without fetching again.
+#define WEATHER_CACHE_FRESH_S       WEATHER_BACKGROUND_FETCH_INTERVAL_S
+// Shown while a new one is fetched, older is not shown at all.
+#define WEATHER_CACHE_MAX_AGE_S     (12 * 60 * 60)
+
+BUILD_ASSERT(WEATHER_UI_NUM_FORECASTS <= WEATHER_PARSER_MAX_DAYS);
+
+typedef struct weather_cache_t {
+    // Local time in seconds since 1970 when fetched, from timeutil_timegm.
+    uint32_t fetched_at;
+    weather_data_t data;
+} weather_cache_t;
+
 // Functions needed for all applications
 static void weather_app_start(lv_obj_t *root, lv_group_t *group);
 static void weather_app_stop(void);
+static int weather_app_init(void);
 static void on_zbus_ble_data_callback(const struct zbus_channel *chan);
 static void periodic_fetch_weather_data(struct k_work *work);
 static void publish_weather_data(struct k_work *work);
 static void weather_data_timeout(struct k_work *work);
 
 ZBUS_CHAN_DECLARE(ble_comm_data_chan);
-ZBUS_LISTENER_DEFINE(weather_ble_comm_lis, on_zbus_ble_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(weather_ble_comm_lis, on_zbus_ble_data_callback);
 ZBUS_CHAN_ADD_OBS(ble_comm_data_chan, weather_ble_comm_lis, 1);
 
 K_WORK_DELAYABLE_DEFINE(weather_app_fetch_work, periodic_fetch_weather_data);
@@ -61,89 +80,190 @@ static uint64_t last_update_weather_time;
 static double last_lat;
 static double last_lon;
 
-static ble_comm_weather_t last_weather;
+static const char *const days[] = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+
+static struct k_spinlock cache_lock;
+static weather_cache_t cache;
+static bool has_cache;
+// Fetched but not saved yet
+static bool cache_dirty;
+// The UI shows weather data, cached or fetched.
+static bool weather_shown;
 
 static application_t app = {
     .name = "Weather",
     .icon = ZSW_LV_IMG_USE(weather_app_icon),
     .start_func = weather_app_start,
     .stop_func = weather_app_stop,
-    .category = ZSW_APP_CATEGORY_ROOT
+    .init_func = weather_app_init,
+    .category = ZSW_APP_CATEGORY_ROOT,
+    // Fetches the forecast periodically while closed
+    .background = true,
 };
 
-static void http_rsp_cb(ble_http_status_code_t status, char *response)
+static uint32_t get_local_time(struct tm *tm)
+{
+    zsw_timeval_t ztm;
+
+    zsw_clock_get_time(&ztm);
+    zsw_timeval_to_tm(&ztm, tm);
+
+    return (uint32_t)timeutil_timegm(tm);
+}
+
+// Negative if the clock is behind the fetch time, as it is before the time is set after a reboot.
+static int64_t get_cache_age_s(const weather_cache_t *entry, uint32_t now)
+{
+    return (int64_t)now - entry->fetched_at;
+}
+
+static bool is_cache_fresh(const weather_cache_t *entry, uint32_t now)
+{
+    int64_t age = get_cache_age_s(entry, now);
+
+    return age >= 0 && age < WEATHER_CACHE_FRESH_S;
+}
+
+static bool is_cache_usable(const weather_cache_t *entry, uint32_t now)
+{
+    int64_t age = get_cache_age_s(entry, now);
+
+    // Until the time is set the age is unknown, the cache may be days old.
+    return age >= 0 && age < WEATHER_CACHE_MAX_AGE_S;
+}
+
+static bool get_cache(weather_cache_t *entry)
+{
+    k_spinlock_key_t key = k_spin_lock(&cache_lock);
+    bool valid = has_cache;
+
+    *entry = cache;
+    k_spin_unlock(&cache_lock, key);
+
+    return valid;
+}
+
+static void show_error(const char *error)
+{
+    // Cached weather stays on screen when refreshing it fails.
+    if (app.current_state == ZSW_APP_STATE_UI_VISIBLE && !weather_shown) {
+        weather_ui_set_error((char *)error);
+    }
+}
+
+static void show_weather(const weather_cache_t *entry)
 {
-    zsw_timeval_t time_now;
     weather_ui_current_weather_data_t current_weather;
     weather_ui_forecast_data_t forecasts[WEATHER_UI_NUM_FORECASTS];
-    char *days[] = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+    const weather_day_t *day;
+    struct tm tm;
+    uint32_t now = get_local_time(&tm);
+    int first_day = 0;
+    int num_days;
+
+    // Days that passed since the forecast was fetched are skipped.
+    if (now > entry->fetched_at) {
+        first_day = now / SECONDS_PER_DAY - entry->fetched_at / SECONDS_PER_DAY;
+    }
+    num_days = MIN(entry->data.num_days - first_day, WEATHER_UI_NUM_FORECASTS);
+    if (num_days <= 0) {
+        return;
+    }
+
+    current_weather.temperature = entry->data.temperature;
+    current_weather.apparent_temperature = entry->data.apparent_temperature;
+    current_weather.wind_speed = entry->data.wind_speed;
+    current_weather.icon = zsw_ui_utils_icon_from_wmo_weather_code(entry->data.weather_code, &current_weather.color,
+                                                                   &current_weather.text);
+
+    for (int i = 0; i < num_days; i++) {
+        day = &entry->data.days[first_day + i];
+        forecasts[i].temperature = day->temperature_max;
+        forecasts[i].low_temp = day->temperature_min;
+        forecasts[i].high_temp = day->temperature_max;
+        forecasts[i].rain_percent = day->rain_percent;
+        forecasts[i].icon = zsw_ui_utils_icon_from_wmo_weather_code(day->weather_code, &forecasts[i].color,
+                                                                    &forecasts[i].text);
+        snprintf(forecasts[i].day, sizeof(forecasts[i].day), "%s", days[(tm.tm_wday + i) % 7]);
+    }
+
+    weather_ui_set_weather_data(current_weather, forecasts, num_days);
+    weather_shown = true;
+}
 
-    // TODO: We should cache the last successful weather data and populate it when app opens.
+static void http_rsp_cb(ble_http_status_code_t status, char *response)
+{
+    weather_parser_t parser;
+    weather_data_t data;
+    struct tm tm;
+    k_spinlock_key_t key;
+    int ret;
 
     if (status == BLE_HTTP_STATUS_OK) {
-        zsw_clock_get_time(&time_now);
-        cJSON *parsed_response = cJSON_Parse(response);
-        if (parsed_response == NULL) {
-            LOG_ERR("Failed to parse weather JSON response");
-            return;
-        }
-        cJSON *current = cJSON_GetObjectItem(parsed_response, "current");
-        cJSON *current_temperature_2m = cJSON_GetObjectItem(current, "temperature_2m");
-        current_weather.temperature = current_temperature_2m->valuedouble;
-        cJSON *current_weather_code = cJSON_GetObjectItem(current, "weather_code");
-        current_weather.icon = zsw_ui_utils_icon_from_wmo_weather_code(current_weather_code->valueint, &current_weather.color,
-                                                                       &current_weather.text);
-        cJSON *current_wind_speed = cJSON_GetObjectItem(current, "wind_speed_10m");
-        current_weather.wind_speed = current_wind_speed->valuedouble;
-        cJSON *apparent_temperature = cJSON_GetObjectItem(current, "apparent_temperature");
-        current_weather.apparent_temperature = apparent_temperature->valuedouble;
-
-        cJSON *daily_forecasts = cJSON_GetObjectItem(parsed_response, "daily");
-
-        cJSON *weather_code_list = cJSON_GetObjectItem(daily_forecasts, "weather_code");
-        cJSON *temperature_2m_max_list = cJSON_GetObjectItem(daily_forecasts, "temperature_2m_max");
-        cJSON *temperature_2m_min_list = cJSON_GetObjectItem(daily_forecasts, "temperature_2m_min");
-        cJSON *precipitation_probability_max_list = cJSON_GetObjectItem(daily_forecasts, "precipitation_probability_max");
-
-        for (int i = 0; i < cJSON_GetArraySize(weather_code_list); i++) {
-            forecasts[i].temperature = cJSON_GetArrayItem(temperature_2m_max_list, i)->valuedouble;
-            forecasts[i].low_temp = cJSON_GetArrayItem(temperature_2m_min_list, i)->valuedouble;
-            forecasts[i].high_temp = cJSON_GetArrayItem(temperature_2m_max_list, i)->valuedouble;
-            forecasts[i].rain_percent = cJSON_GetArrayItem(precipitation_probability_max_list, i)->valueint;
-            forecasts[i].icon = zsw_ui_utils_icon_from_wmo_weather_code(cJSON_GetArrayItem(weather_code_list, i)->valueint,
-                                                                        &forecasts[i].color, &forecasts[i].text);
-            sprintf(forecasts[i].day, "%s", days[(time_now.tm.tm_wday + i) % 7]);
+        weather_parser_init(&parser, &data);
+        ret = weather_parser_feed(&parser, response, strlen(response));
+        if (ret == 0) {
+            ret = weather_parser_finish(&parser);
         }
-        if (app.current_state == ZSW_APP_STATE_UI_VISIBLE) {
-            weather_ui_set_weather_data(current_weather, forecasts, cJSON_GetArraySize(weather_code_list));
+        if (ret != 0) {
+            LOG_ERR("Failed to parse weather response: %d", ret);
+            show_error("Failed");
+            return;
         }
 
         ble_comm_request_gps_status(false);
-        last_weather.temperature_c = current_weather.temperature;
-        last_weather.humidity = 0;
-        last_weather.wind = current_weather.wind_speed;
-        last_weather.wind_direction = 0;
-        last_weather.weather_code = wmo_code_to_weather_code(current_weather_code->valueint);
-        strncpy(last_weather.report_text, current_weather.text, sizeof(last_weather.report_text));
-
-        cJSON_Delete(parsed_response);
+
+        key = k_spin_lock(&cache_lock);
+        cache.fetched_at = get_local_time(&tm);
+        cache.data = data;
+        has_cache = true;
+        cache_dirty = true;
+        k_spin_unlock(&cache_lock, key);
         last_update_weather_time = k_uptime_get();
 
         k_work_submit(&weather_app_publish);
     } else {
         LOG_ERR("HTTP request failed\n");
-        if (app.current_state == ZSW_APP_STATE_UI_VISIBLE) {
-            weather_ui_set_error(status == BLE_HTTP_STATUS_TIMEOUT ? "Timeout" : "Failed");
-        }
+        show_error(status == BLE_HTTP_STATUS_TIMEOUT ? "Timeout" : "Failed");
     }
 }
 
 static void publish_weather_data(struct k_work *work)
 {
-    ble_comm_cb_data_t data;
-    data.type = BLE_COMM_DATA_TYPE_WEATHER;
-    data.data.weather = last_weather;
-    zbus_chan_pub(&ble_comm_data_chan, &data, K_MSEC(250));
+    weather_cache_t entry;
+    ble_comm_weather_t weather = { 0 };
+    lv_color_t color;
+    char *text = "";
+    k_spinlock_key_t key;
+    bool save;
+    int ret;
+
+    if (!get_cache(&entry)) {
+        return;
+    }
+
+    if (app.current_state == ZSW_APP_STATE_UI_VISIBLE) {
+        show_weather(&entry);
+    }
+
+    zsw_ui_utils_icon_from_wmo_weather_code(entry.data.weather_code, &color, &text);
+    weather.temperature_c = entry.data.temperature;
+    weather.wind = entry.data.wind_speed;
+    weather.weather_code = wmo_code_to_weather_code(entry.data.weather_code);
+    strncpy(weather.report_text, text, sizeof(weather.report_text) - 1);
+    ble_data_event_send(BLE_COMM_DATA_TYPE_WEATHER, &weather);
+
+    key = k_spin_lock(&cache_lock);
+    save = cache_dirty;
+    cache_dirty = false;
+    k_spin_unlock(&cache_lock, key);
+
+    if (save) {
+        ret = settings_save_one(SETTING_WEATHER_CACHE_KEY, &entry, sizeof(entry));
+        if (ret) {
+            LOG_ERR("Error during saving of weather cache! Error: %i", ret);
+        }
+    }
 }
 
 static void fetch_weather_data(double lat, double lon)
@@ -153,9 +273,7 @@ static void fetch_weather_data(double lat, double lon)
     int ret = zsw_ble_http_get(weather_url, http_rsp_cb);
     if (ret != 0 && ret != -EBUSY) {
         LOG_ERR("Failed to send HTTP request: %d", ret);
-        if (app.current_state == ZSW_APP_STATE_UI_VISIBLE) {
-            weather_ui_set_error("Failed fetching weather");
-        }
+        show_error("Failed fetching weather");
     }
 }
 
@@ -170,24 +288,22 @@ static void periodic_fetch_weather_data(struct k_work *work)
 
 static void weather_data_timeout(struct k_work *work)
 {
-    if (app.current_state == ZSW_APP_STATE_UI_VISIBLE) {
-        weather_ui_set_error("No data received\nMake sure phone is connected");
-    }
+    show_error("No data received\nMake sure phone is connected");
 }
 
 static void on_zbus_ble_data_callback(const struct zbus_channel *chan)
 {
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
 
-    if (event->data.type == BLE_COMM_DATA_TYPE_GPS) {
+    if (event->data->type == BLE_COMM_DATA_TYPE_GPS) {
         k_work_cancel_delayable(&weather_data_timeout_work);
         last_update_gps_time = k_uptime_get();
         LOG_DBG("Got GPS data, fetch weather\n");
-        LOG_DBG("Latitude: %f\n", event->data.data.gps.lat);
-        LOG_DBG("Longitude: %f\n", event->data.data.gps.lon);
-        last_lat = event->data.data.gps.lat;
-        last_lon = event->data.data.gps.lon;
-        fetch_weather_data(event->data.data.gps.lat, event->data.data.gps.lon);
+        LOG_DBG("Latitude: %f\n", event->data->data.gps.lat);
+        LOG_DBG("Longitude: %f\n", event->data->data.gps.lon);
+        last_lat = event->data->data.gps.lat;
+        last_lon = event->data->data.gps.lon;
+        fetch_weather_data(event->data->data.gps.lat, event->data->data.gps.lon);
         int ret = ble_comm_request_gps_status(false);
         if (ret != 0) {
             LOG_ERR("Failed to request GPS data: %d", ret);
@@ -197,13 +313,27 @@ static void on_zbus_ble_data_callback(const struct zbus_channel *chan)
 
 static void weather_app_start(lv_obj_t *root, lv_group_t *group)
 {
+    weather_cache_t entry;
+    struct tm tm;
+    uint32_t now = get_local_time(&tm);
+    bool cached = get_cache(&entry) && is_cache_usable(&entry, now);
+
     weather_ui_show(root);
-    if (last_update_gps_time == 0 || k_uptime_delta(&last_update_gps_time) > MAX_GPS_AGED_TIME_MS) {
+    weather_shown = false;
+
+    // Show the cached weather right away and only fetch a new one when it is stale.
+    if (cached) {
+        show_weather(&entry);
+    }
+
+    if (cached && is_cache_fresh(&entry, now)) {
+        LOG_DBG("Cached weather is fresh, not fetching");
+    } else if (last_update_gps_time == 0 || k_uptime_delta(&last_update_gps_time) > MAX_GPS_AGED_TIME_MS) {
         LOG_DBG("GPS data is too old, request GPS\n");
         int res = ble_comm_request_gps_status(true);
         if (res != 0) {
             LOG_ERR("Failed to request GPS data: %d", res);
-            weather_ui_set_error("Failed to get GPS data");
+            show_error("Failed to get GPS data");
         } else {
             k_work_reschedule(&weather_data_timeout_work, K_SECONDS(WEATHER_DATA_TIMEOUT_S));
         }
@@ -224,12 +354,52 @@ static void weather_app_stop(void)
     ble_comm_request_gps_status(false);
 }
 
+static int weather_cache_load_cb(const char *p_key, size_t len, settings_read_cb read_cb, void *p_cb_arg,
+                                 void *p_param)
+{
+    if (len != sizeof(cache) || read_cb(p_cb_arg, &cache, len) != sizeof(cache)) {
+        LOG_ERR("Invalid weather cache, discarding");
+        return 0;
+    }
+    has_cache = true;
+
+    return 0;
+}
+
+static int weather_app_init(void)
+{
+    struct tm tm;
+    uint32_t now;
+    int ret;
+
+    ret = settings_subsys_init();
+    if (ret == 0) {
+        ret = settings_load_subtree_direct(SETTING_WEATHER_CACHE_KEY, weather_cache_load_cb, NULL);
+    }
+    if (ret) {
+        LOG_ERR("Error during loading of weather cache! Error: %i", ret);
+    }
+
+    now = get_local_time(&tm);
+    if (has_cache && is_cache_usable(&cache, now)) {
+        // Lets the watchface show the weather before it is fetched.
+        k_work_submit(&weather_app_publish);
+    }
+
+    if (has_cache && is_cache_fresh(&cache, now)) {
+        k_work_reschedule(&weather_app_fetch_work,
+                          K_SECONDS(WEATHER_CACHE_FRESH_S - get_cache_age_s(&cache, now)));
+    } else {
+        k_work_reschedule(&weather_app_fetch_work, K_SECONDS(30));
+    }
+
+    return 0;
+}
+
 static int weather_app_add(void)
 {
     zsw_app_manager_add_application(&app);
 
-    k_work_reschedule(&weather_app_fetch_work, K_SECONDS(30));
-
     return 0;
 }
 
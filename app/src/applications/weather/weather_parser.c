@@ -0,0 +1,369 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Extracts the shown fields from an Open-Meteo response in one pass without building a tree.
+ * Only the key of the member being parsed and the array index are kept for each level, that is
+ * enough to know where a value belongs when it is found. The daily arrays are filled in as
+ * they are read instead of being looked up by index afterwards.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "weather_parser.h"
+
+#define CURRENT_FIELDS_ALL  BIT_MASK(4)
+#define DAY_FIELDS_ALL      BIT_MASK(4)
+
+typedef enum lex_state_t {
+    LEX_IDLE,
+    LEX_STRING,
+    LEX_ESCAPE,
+    LEX_SCALAR,
+} lex_state_t;
+
+typedef enum field_key_t {
+    KEY_OTHER,
+    KEY_CURRENT,
+    KEY_DAILY,
+    KEY_TEMPERATURE,
+    KEY_APPARENT_TEMPERATURE,
+    KEY_WIND_SPEED,
+    KEY_WEATHER_CODE,
+    KEY_TEMPERATURE_MAX,
+    KEY_TEMPERATURE_MIN,
+    KEY_RAIN_PROBABILITY,
+} field_key_t;
+
+static const char *const key_names[] = {
+    [KEY_CURRENT] = "current",
+    [KEY_DAILY] = "daily",
+    [KEY_TEMPERATURE] = "temperature_2m",
+    [KEY_APPARENT_TEMPERATURE] = "apparent_temperature",
+    [KEY_WIND_SPEED] = "wind_speed_10m",
+    [KEY_WEATHER_CODE] = "weather_code",
+    [KEY_TEMPERATURE_MAX] = "temperature_2m_max",
+    [KEY_TEMPERATURE_MIN] = "temperature_2m_min",
+    [KEY_RAIN_PROBABILITY] = "precipitation_probability_max",
+};
+
+static uint8_t lookup_key(const weather_parser_t *parser)
+{
+    if (parser->token_truncated) {
+        return KEY_OTHER;
+    }
+
+    for (int i = KEY_CURRENT; i < ARRAY_SIZE(key_names); i++) {
+        if (strcmp(parser->token, key_names[i]) == 0) {
+            return i;
+        }
+    }
+
+    return KEY_OTHER;
+}
+
+// Level the parser is in, NULL at the top or below the levels kept track of.
+static weather_parser_level_t *current_level(weather_parser_t *parser)
+{
+    if (parser->depth == 0 || parser->depth > WEATHER_PARSER_MAX_DEPTH) {
+        return NULL;
+    }
+
+    return &parser->levels[parser->depth - 1];
+}
+
+static uint8_t to_code(float value)
+{
+    return CLAMP(value, 0, UINT8_MAX);
+}
+
+static void set_current(weather_parser_t *parser, uint8_t key, float value)
+{
+    weather_data_t *data = parser->data;
+
+    switch (key) {
+        case KEY_TEMPERATURE:
+            data->temperature = value;
+            parser->current_fields |= BIT(0);
+            break;
+        case KEY_APPARENT_TEMPERATURE:
+            data->apparent_temperature = value;
+            parser->current_fields |= BIT(1);
+            break;
+        case KEY_WIND_SPEED:
+            data->wind_speed = value;
+            parser->current_fields |= BIT(2);
+            break;
+        case KEY_WEATHER_CODE:
+            data->weather_code = to_code(value);
+            parser->current_fields |= BIT(3);
+            break;
+        default:
+            break;
+    }
+}
+
+static void set_day(weather_parser_t *parser, uint8_t key, uint8_t index, float value)
+{
+    weather_day_t *day;
+
+    if (index >= WEATHER_PARSER_MAX_DAYS) {
+        return;
+    }
+    day = &parser->data->days[index];
+
+    switch (key) {
+        case KEY_TEMPERATURE_MAX:
+            day->temperature_max = value;
+            parser->day_fields[index] |= BIT(0);
+            break;
+        case KEY_TEMPERATURE_MIN:
+            day->temperature_min = value;
+            parser->day_fields[index] |= BIT(1);
+            break;
+        case KEY_RAIN_PROBABILITY:
+            day->rain_percent = CLAMP(value, 0, 100);
+            parser->day_fields[index] |= BIT(2);
+            break;
+        case KEY_WEATHER_CODE:
+            day->weather_code = to_code(value);
+            parser->day_fields[index] |= BIT(3);
+            break;
+        default:
+            break;
+    }
+}
+
+static void on_scalar(weather_parser_t *parser)
+{
+    const weather_parser_level_t *levels = parser->levels;
+    char *end;
+    float value;
+
+    if (parser->token_truncated) {
+        return;
+    }
+
+    parser->token[parser->token_len] = '\0';
+    value = strtof(parser->token, &end);
+    if (end == parser->token) {
+        // null, true or false
+        return;
+    }
+
+    if (parser->depth == 2 && !levels[0].is_array && levels[0].key == KEY_CURRENT && !levels[1].is_array) {
+        set_current(parser, levels[1].key, value);
+    } else if (parser->depth == 3 && !levels[0].is_array && levels[0].key == KEY_DAILY && !levels[1].is_array &&
+               levels[2].is_array) {
+        set_day(parser, levels[1].key, levels[2].index, value);
+    }
+}
+
+static void on_string(weather_parser_t *parser)
+{
+    weather_parser_level_t *level = current_level(parser);
+
+    parser->token[parser->token_len] = '\0';
+    // String values are not used, only keys.
+    if (level && !level->is_array && level->expect_key) {
+        level->key = lookup_key(parser);
+    }
+}
+
+static void push(weather_parser_t *parser, bool is_array)
+{
+    if (parser->depth == UINT8_MAX) {
+        parser->error = true;
+        return;
+    }
+
+    if (parser->depth < WEATHER_PARSER_MAX_DEPTH) {
+        parser->levels[parser->depth] = (weather_parser_level_t) {
+            .is_array = is_array,
+            .expect_key = !is_array,
+            .key = KEY_OTHER,
+            .index = 0,
+        };
+    }
+    parser->depth++;
+}
+
+static void pop(weather_parser_t *parser, bool is_array)
+{
+    const weather_parser_level_t *level = current_level(parser);
+
+    if (parser->depth == 0 || (level && level->is_array != is_array)) {
+        parser->error = true;
+        return;
+    }
+    parser->depth--;
+}
+
+static void next_member(weather_parser_t *parser)
+{
+    weather_parser_level_t *level = current_level(parser);
+
+    if (parser->depth == 0) {
+        parser->error = true;
+    } else if (level == NULL) {
+        return;
+    } else if (level->is_array) {
+        if (level->index < UINT8_MAX) {
+            level->index++;
+        }
+    } else {
+        level->expect_key = true;
+        level->key = KEY_OTHER;
+    }
+}
+
+static void start_token(weather_parser_t *parser, lex_state_t state)
+{
+    parser->lex_state = state;
+    parser->token_len = 0;
+    parser->token_truncated = false;
+}
+
+static void append(weather_parser_t *parser, char c)
+{
+    if (parser->token_len < WEATHER_PARSER_MAX_TOKEN) {
+        parser->token[parser->token_len++] = c;
+    } else {
+        parser->token_truncated = true;
+    }
+}
+
+static bool is_scalar_char(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '+' ||
+           c == '.';
+}
+
+static void feed_char(weather_parser_t *parser, char c)
+{
+    weather_parser_level_t *level;
+
+    switch (parser->lex_state) {
+        case LEX_STRING:
+            if (c == '\\') {
+                parser->lex_state = LEX_ESCAPE;
+            } else if (c == '"') {
+                parser->lex_state = LEX_IDLE;
+                on_string(parser);
+            } else {
+                append(parser, c);
+            }
+            return;
+        case LEX_ESCAPE:
+            // The escaped character is kept as is, none of the matched keys contain one.
+            append(parser, c);
+            parser->lex_state = LEX_STRING;
+            return;
+        case LEX_SCALAR:
+            if (is_scalar_char(c)) {
+                append(parser, c);
+                return;
+            }
+            parser->lex_state = LEX_IDLE;
+            on_scalar(parser);
+            break;
+        default:
+            break;
+    }
+
+    switch (c) {
+        case '{':
+        case '[':
+            push(parser, c == '[');
+            break;
+        case '}':
+        case ']':
+            pop(parser, c == ']');
+            break;
+        case ':':
+            level = current_level(parser);
+            if (level && !level->is_array) {
+                level->expect_key = false;
+            }
+            break;
+        case ',':
+            next_member(parser);
+            break;
+        case '"':
+            start_token(parser, LEX_STRING);
+            break;
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            break;
+        default:
+            if (!is_scalar_char(c)) {
+                parser->error = true;
+                break;
+            }
+            start_token(parser, LEX_SCALAR);
+            append(parser, c);
+            break;
+    }
+}
+
+void weather_parser_init(weather_parser_t *parser, weather_data_t *data)
+{
+    memset(parser, 0, sizeof(*parser));
+    memset(data, 0, sizeof(*data));
+    parser->data = data;
+    parser->lex_state = LEX_IDLE;
+}
+
+int weather_parser_feed(weather_parser_t *parser, const char *buf, size_t len)
+{
+    for (size_t i = 0; i < len && !parser->error; i++) {
+        feed_char(parser, buf[i]);
+    }
+
+    return parser->error ? -EINVAL : 0;
+}
+
+int weather_parser_finish(weather_parser_t *parser)
+{
+    uint8_t num_days = 0;
+
+    if (parser->lex_state == LEX_SCALAR) {
+        parser->lex_state = LEX_IDLE;
+        on_scalar(parser);
+    }
+
+    if (parser->error || parser->depth != 0 || parser->lex_state != LEX_IDLE) {
+        return -EINVAL;
+    }
+
+    // Days are only used up to the first one missing a field.
+    while (num_days < WEATHER_PARSER_MAX_DAYS && parser->day_fields[num_days] == DAY_FIELDS_ALL) {
+        num_days++;
+    }
+    parser->data->num_days = num_days;
+
+    if (parser->current_fields != CURRENT_FIELDS_ALL || num_days == 0) {
+        return -ENODATA;
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define WEATHER_PARSER_MAX_DAYS     4
+// Deepest level the parser keeps track of, the fields used are at most three levels down.
+#define WEATHER_PARSER_MAX_DEPTH    4
+// Longest key or value the parser matches, anything longer is skipped.
+#define WEATHER_PARSER_MAX_TOKEN    32
+
+typedef struct weather_day_t {
+    float temperature_max;
+    float temperature_min;
+    uint8_t rain_percent;
+    uint8_t weather_code;
+} weather_day_t;
+
+/** @brief The fields of an Open-Meteo forecast response that are shown. Weather codes are WMO codes. */
+typedef struct weather_data_t {
+    float temperature;
+    float apparent_temperature;
+    float wind_speed;
+    uint8_t weather_code;
+    uint8_t num_days;
+    weather_day_t days[WEATHER_PARSER_MAX_DAYS];
+} weather_data_t;
+
+typedef struct weather_parser_level_t {
+    bool is_array;
+    bool expect_key;
+    uint8_t key;
+    uint8_t index;
+} weather_parser_level_t;
+
+/** @brief Parser state, only touched by the functions below. */
+typedef struct weather_parser_t {
+    weather_data_t *data;
+    weather_parser_level_t levels[WEATHER_PARSER_MAX_DEPTH];
+    uint8_t depth;
+    uint8_t lex_state;
+    char token[WEATHER_PARSER_MAX_TOKEN + 1];
+    uint8_t token_len;
+    bool token_truncated;
+    bool error;
+    uint8_t current_fields;
+    uint8_t day_fields[WEATHER_PARSER_MAX_DAYS];
+} weather_parser_t;
+
+/** @brief          Start parsing a response, without allocating anything.
+ *  @param parser   Parser state
+ *  @param data     Filled in with the fields as they are found
+*/
+void weather_parser_init(weather_parser_t *parser, weather_data_t *data);
+
+/** @brief          Parse the next part of the response. Each byte is looked at once, so the response
+ *                  can be passed in any number of chunks as it arrives.
+ *  @param parser   Parser state
+ *  @param buf      Next part of the response
+ *  @param len      Length of buf
+ *  @return         0 on success, -EINVAL if the response is not valid JSON
+*/
+int weather_parser_feed(weather_parser_t *parser, const char *buf, size_t len);
+
+/** @brief          Finish parsing after the whole response was fed.
+ *  @param parser   Parser state
+ *  @return         0 if the current weather and at least one day were found, -EINVAL if the
+ *                  response is not valid JSON, -ENODATA if fields are missing
+*/
+int weather_parser_finish(weather_parser_t *parser);
@@ -23,6 +23,7 @@
 #include "events/accel_event.h"
 #include "managers/zsw_app_manager.h"
 #include "ui/utils/zsw_ui_utils.h"
+#include "zsw_zbus_trace.h"
 
 // Functions needed for all applications
 static void zds_app_start(lv_obj_t *root, lv_group_t *group);
@@ -31,7 +32,7 @@ static void zds_app_stop(void);
 static void zbus_accel_data_callback(const struct zbus_channel *chan);
 
 ZBUS_CHAN_DECLARE(accel_data_chan);
-ZBUS_LISTENER_DEFINE_WITH_ENABLE(zds_app_accel_lis, zbus_accel_data_callback, false);
+ZSW_ZBUS_LISTENER_DEFINE_WITH_ENABLE(zds_app_accel_lis, zbus_accel_data_callback, false);
 
 ZSW_LV_IMG_DECLARE(zephyr_icon_round);
 
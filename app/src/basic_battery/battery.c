@@ -20,6 +20,8 @@
 #include <zephyr/random/random.h>
 
 #include "events/battery_event.h"
+#include "events/activity_event.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(BATTERY, CONFIG_ZSW_BATTERY_LOG_LEVEL);
 
@@ -43,12 +45,22 @@ static const struct battery_level_point levels[] = {
     { 0, 3500 },
 };
 
+// The voltage barely moves while the watch is lying still, sample much less often.
+#define BATTERY_SAMPLE_INTERVAL_IDLE_MINUTES    15
+
 static void handle_battery_sample_timeout(struct k_work *item);
+static void zbus_activity_event_callback(const struct zbus_channel *chan);
 
 K_WORK_DELAYABLE_DEFINE(battery_sample_work, handle_battery_sample_timeout);
 
 ZBUS_CHAN_DECLARE(battery_sample_data_chan);
 
+ZBUS_CHAN_DECLARE(activity_state_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(battery_activity_state_event_lis, zbus_activity_event_callback);
+ZBUS_CHAN_ADD_OBS(activity_state_data_chan, battery_activity_state_event_lis, 1);
+
+static bool not_worn_stationary;
+
 #if DT_IO_CHANNELS_INPUT(VBATT)
 
 #define BATTERY_SAMPLE_INTETRVAL_MINUTES    5
@@ -308,7 +320,21 @@ static void handle_battery_sample_timeout(struct k_work *item)
     if (rc == 0) {
         zbus_chan_pub(&battery_sample_data_chan, &evt, K_MSEC(5));
     }
-    k_work_schedule(&battery_sample_work, K_MINUTES(BATTERY_SAMPLE_INTETRVAL_MINUTES));
+    k_work_schedule(&battery_sample_work, K_MINUTES(not_worn_stationary ? BATTERY_SAMPLE_INTERVAL_IDLE_MINUTES :
+                                                    BATTERY_SAMPLE_INTETRVAL_MINUTES));
+}
+
+static void zbus_activity_event_callback(const struct zbus_channel *chan)
+{
+    const struct activity_state_event *event = zbus_chan_const_msg(chan);
+    bool was_idle = not_worn_stationary;
+
+    not_worn_stationary = event->state == ZSW_ACTIVITY_STATE_NOT_WORN_STATIONARY;
+
+    // Picked up again, refresh the battery level instead of waiting out the idle interval.
+    if (was_idle && !not_worn_stationary) {
+        k_work_reschedule(&battery_sample_work, K_NO_WAIT);
+    }
 }
 
 static int battery_init(void)
@@ -30,6 +30,7 @@
 #include "ble/ble_comm.h"
 #include "events/ble_event.h"
 #include "events/music_event.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(ble_ams, CONFIG_ZSW_BLE_LOG_LEVEL);
 
@@ -60,12 +61,11 @@ static void ble_ams_delayed_write_handle(struct k_work *item);
 static void ams_discover_retry_handle(struct k_work *item);
 static void music_control_event_callback(const struct zbus_channel *chan);
 
-ZBUS_CHAN_DECLARE(ble_comm_data_chan);
 
 ZBUS_CHAN_DECLARE(music_control_data_chan);
 ZBUS_OBS_DECLARE(ios_music_control_lis);
 ZBUS_CHAN_ADD_OBS(music_control_data_chan, ios_music_control_lis, 1);
-ZBUS_LISTENER_DEFINE(ios_music_control_lis, music_control_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(ios_music_control_lis, music_control_event_callback);
 
 K_WORK_DELAYABLE_DEFINE(ams_gatt_discover_retry, ams_discover_retry_handle);
 K_WORK_DELAYABLE_DEFINE(ble_ams_delayed_write, ble_ams_delayed_write_handle);
@@ -169,51 +169,46 @@ static void notify_eu_cb(struct bt_ams_client *ams_c,
         msg_buff[notif->len] = '\0';
         LOG_DBG("AMS EU: %s %s", str_hex, msg_buff);
 
-        static struct ble_data_event evt_music_inf = {0};
+        static ble_comm_music_info_t music_info = {0};
 
         if (notif->ent_attr.entity == BT_AMS_ENTITY_ID_TRACK &&
             attr_val == BT_AMS_TRACK_ATTRIBUTE_ID_ARTIST) {
-            evt_music_inf.data.type = BLE_COMM_DATA_TYPE_MUSIC_INFO;
-            memcpy(&evt_music_inf.data.data.music_info.artist, msg_buff, notif->len);
+            memcpy(&music_info.artist, msg_buff, notif->len);
         }
 
         if (notif->ent_attr.entity == BT_AMS_ENTITY_ID_TRACK &&
             attr_val == BT_AMS_TRACK_ATTRIBUTE_ID_DURATION) {
-            evt_music_inf.data.type = BLE_COMM_DATA_TYPE_MUSIC_INFO;
             // A string containing the floating point value of the total duration of the track in seconds.
-            evt_music_inf.data.data.music_info.duration = (int)atof(msg_buff);
+            music_info.duration = (int)atof(msg_buff);
         }
 
         if (notif->ent_attr.entity == BT_AMS_ENTITY_ID_TRACK &&
             attr_val == BT_AMS_TRACK_ATTRIBUTE_ID_TITLE) {
-            evt_music_inf.data.type = BLE_COMM_DATA_TYPE_MUSIC_INFO;
-            memcpy(&evt_music_inf.data.data.music_info.track_name, msg_buff, notif->len);
+            memcpy(&music_info.track_name, msg_buff, notif->len);
 
             // Only publish when all music information is received, otherwise values are overwritten
-            zbus_chan_pub(&ble_comm_data_chan, &evt_music_inf, K_MSEC(250));
+            ble_data_event_send(BLE_COMM_DATA_TYPE_MUSIC_INFO, &music_info);
 
-            memset(&evt_music_inf, 0, sizeof(evt_music_inf));
+            memset(&music_info, 0, sizeof(music_info));
         }
 
         if (notif->ent_attr.entity == BT_AMS_ENTITY_ID_PLAYER &&
             attr_val == BT_AMS_PLAYER_ATTRIBUTE_ID_PLAYBACK_INFO) {
 
-            struct ble_data_event evt_music_state = {0};
-
-            evt_music_state.data.type = BLE_COMM_DATA_TYPE_MUSIC_STATE;
+            ble_comm_music_state_t music_state = {0};
 
             // A concatenation of three comma-separated values, i.e 0,0.0,0.000
             // where first value is status
-            evt_music_state.data.data.music_state.playing = ((msg_buff[0] - '0') == 1) ? true : false;
+            music_state.playing = ((msg_buff[0] - '0') == 1) ? true : false;
 
             // the last is the elapsed time in seconds as double, it sends empty when the phone player is closed
             if (notif->len > sizeof("0,,")) {
                 char elapsed_time[sizeof("9999.999")] = {'\0'};
                 memcpy(elapsed_time, &msg_buff[6], notif->len - 6);
-                evt_music_state.data.data.music_state.position = (int)atof(elapsed_time);
+                music_state.position = (int)atof(elapsed_time);
             }
 
-            zbus_chan_pub(&ble_comm_data_chan, &evt_music_state, K_MSEC(250));
+            ble_data_event_send(BLE_COMM_DATA_TYPE_MUSIC_STATE, &music_state);
         }
     }
 }
@@ -103,7 +103,6 @@ static void bt_ancs_write_response_handler(struct bt_ancs_client *ancs_c, uint8_
 static void gatt_discover_retry_handle(struct k_work *item);
 
 K_WORK_DELAYABLE_DEFINE(gatt_discover_retry, gatt_discover_retry_handle);
-ZBUS_CHAN_DECLARE(ble_comm_data_chan);
 
 static void enable_ancs_notifications(struct bt_ancs_client *ancs_c)
 {
@@ -398,34 +397,31 @@ static void notif_attr_print(const struct bt_ancs_attr *attr)
 
 static int parse_notify(const struct bt_ancs_attr *attr)
 {
-    static struct ble_data_event evt = {0};
+    static ble_comm_notify_t notify = {0};
 
     switch (attr->attr_id) {
         case ATTR_ID_TITLE:
-            evt.data.data.notify.title = attr->attr_data;
-            evt.data.data.notify.title_len = attr->attr_len;
+            notify.title = attr->attr_data;
+            notify.title_len = attr->attr_len;
             break;
 
         case ATTR_ID_MESSAGE:
-            evt.data.data.notify.body = (char *)attr->attr_data;
-            evt.data.data.notify.body_len = attr->attr_len;
+            notify.body = (char *)attr->attr_data;
+            notify.body_len = attr->attr_len;
             break;
 
         case ATTR_ID_APP_ID:
             // This comes as example com.facebook.Messenger
-            evt.data.data.notify.src = strrchr(attr->attr_data, '.') + 1;
-            evt.data.data.notify.src_len = strlen(evt.data.data.notify.src);
-            evt.data.data.notify.id = notification_latest.notif_uid;
+            notify.src = strrchr(attr->attr_data, '.') + 1;
+            notify.src_len = strlen(notify.src);
+            notify.id = notification_latest.notif_uid;
             break;
 
         // the last message is Negative action label, send only when all data is received;
         case ATTR_ID_NEGATIVE_ACTION_LABEL:
+            ble_data_event_send(BLE_COMM_DATA_TYPE_NOTIFY, &notify);
 
-            evt.data.type = BLE_COMM_DATA_TYPE_NOTIFY;
-
-            zbus_chan_pub(&ble_comm_data_chan, &evt, K_MSEC(250));
-
-            memset(&evt, 0, sizeof(evt));
+            memset(&notify, 0, sizeof(notify));
             break;
         case ATTR_ID_DATE:
         case ATTR_ID_MESSAGE_SIZE:
@@ -446,14 +442,13 @@ static void bt_ancs_notification_source_handler(struct bt_ancs_client *ancs_c,
         notification_latest = *notif;
 
         if (notification_latest.evt_id == BT_ANCS_EVENT_ID_NOTIFICATION_REMOVED) {
-            struct ble_data_event evt_notif_rem = {
-                .data.type = BLE_COMM_DATA_TYPE_NOTIFY_REMOVE,
-                .data.data.notify_remove.id = notification_latest.notif_uid,
+            ble_comm_notify_remove_t notify_remove = {
+                .id = notification_latest.notif_uid,
             };
 
-            LOG_DBG("Remove notification %d", evt_notif_rem.data.data.notify_remove.id);
+            LOG_DBG("Remove notification %d", notify_remove.id);
 
-            zbus_chan_pub(&ble_comm_data_chan, &evt_notif_rem, K_MSEC(250));
+            ble_data_event_send(BLE_COMM_DATA_TYPE_NOTIFY_REMOVE, &notify_remove);
 
             return;
         }
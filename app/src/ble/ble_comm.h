@@ -89,8 +89,9 @@ typedef struct ble_comm_remote_control {
 } ble_comm_remote_control_t;
 
 typedef struct ble_comm_http_response {
-    char err[MAX_HTTP_FIELD_LENGTH + 1];
-    char response[MAX_HTTP_FIELD_LENGTH + 1];
+    // Stored after the payload in the message, empty strings when not set
+    const char *err;
+    const char *response;
     int id;
 } ble_comm_http_response_t;
 
@@ -26,7 +26,6 @@
 #include "events/ble_event.h"
 
 LOG_MODULE_REGISTER(ble_cts, CONFIG_ZSW_BLE_LOG_LEVEL);
-ZBUS_CHAN_DECLARE(ble_comm_data_chan);
 
 static struct bt_cts_client cts_c;
 
@@ -83,7 +82,7 @@ static void current_time_print(struct bt_cts_current_time *current_time)
 
 void publish_time_event(struct bt_cts_current_time *current_time)
 {
-    struct ble_data_event evt_time_inf = {0};
+    ble_comm_notify_time_t time_inf = {0};
 
     struct tm tm = {
         .tm_sec = current_time->exact_time_256.seconds,
@@ -94,12 +93,11 @@ void publish_time_event(struct bt_cts_current_time *current_time)
         .tm_year = current_time->exact_time_256.year - 1900,
     };
 
-    evt_time_inf.data.type = BLE_COMM_DATA_TYPE_SET_TIME;
-    evt_time_inf.data.data.time.seconds = timeutil_timegm(&tm);
+    time_inf.seconds = timeutil_timegm(&tm);
 
-    LOG_DBG("EPOCH %d", evt_time_inf.data.data.time.seconds);
+    LOG_DBG("EPOCH %d", time_inf.seconds);
 
-    zbus_chan_pub(&ble_comm_data_chan, &evt_time_inf, K_MSEC(250));
+    ble_data_event_send(BLE_COMM_DATA_TYPE_SET_TIME, &time_inf);
 }
 
 static void notify_current_time_cb(struct bt_cts_client *cts_c,
@@ -6,6 +6,7 @@
 #include <zephyr/zbus/zbus.h>
 #include <events/ble_event.h>
 #include <cJSON.h>
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(ble_http, LOG_LEVEL_DBG);
 
@@ -16,7 +17,7 @@ LOG_MODULE_REGISTER(ble_http, LOG_LEVEL_DBG);
 static void zbus_ble_comm_data_callback(const struct zbus_channel *chan);
 static void ble_http_timeout_handler(struct k_work *work);
 
-ZBUS_LISTENER_DEFINE(ble_http_lis, zbus_ble_comm_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(ble_http_lis, zbus_ble_comm_data_callback);
 ZBUS_CHAN_DECLARE(ble_comm_data_chan);
 ZBUS_CHAN_ADD_OBS(ble_comm_data_chan, ble_http_lis, 1);
 
@@ -37,31 +38,31 @@ static void zbus_ble_comm_data_callback(const struct zbus_channel *chan)
 {
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
 
-    if (event->data.type == BLE_COMM_DATA_TYPE_HTTP) {
-        if (event->data.data.http_response.id != request_id) {
-            LOG_WRN("Not the expected response ID, was: %d, expected: %d", event->data.data.http_response.id, request_id);
+    if (event->data->type == BLE_COMM_DATA_TYPE_HTTP) {
+        if (event->data->data.http_response.id != request_id) {
+            LOG_WRN("Not the expected response ID, was: %d, expected: %d", event->data->data.http_response.id, request_id);
             return;
         }
         struct k_work_sync sync;
         k_work_cancel_delayable_sync(&ble_http_timeout_work, &sync);
         request_pending = false;
 
-        if (strlen(event->data.data.http_response.err) > 0) {
-            LOG_WRN("HTTP request failed: %s", event->data.data.http_response.err);
-        } else if (strlen(event->data.data.http_response.response) > 0) {
-            char *fixed_rsp = k_malloc(strlen(event->data.data.http_response.response) + 1);
+        if (strlen(event->data->data.http_response.err) > 0) {
+            LOG_WRN("HTTP request failed: %s", event->data->data.http_response.err);
+        } else if (strlen(event->data->data.http_response.response) > 0) {
+            char *fixed_rsp = k_malloc(strlen(event->data->data.http_response.response) + 1);
             __ASSERT(fixed_rsp, "Failed to allocate memory for fixed_rsp");
             // As the response from Gadgetbride contains two characters like this[\\, "] instead of just one character [\"],
             // we need to remove them for it to be avalid JSON accepted by cJSON
             int i;
             int j;
-            for (i = 0, j = 0; i < strlen(event->data.data.http_response.response) - 1;) {
-                if (event->data.data.http_response.response[i] == '\\' && event->data.data.http_response.response[i + 1] == '"') {
+            for (i = 0, j = 0; i < strlen(event->data->data.http_response.response) - 1;) {
+                if (event->data->data.http_response.response[i] == '\\' && event->data->data.http_response.response[i + 1] == '"') {
                     fixed_rsp[j] = '\"';
                     j++;
                     i += 2;
                 } else {
-                    fixed_rsp[j] = event->data.data.http_response.response[i];
+                    fixed_rsp[j] = event->data->data.http_response.response[i];
                     j++;
                     i++;
                 }
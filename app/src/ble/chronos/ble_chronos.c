@@ -18,14 +18,14 @@
 #include "events/ble_event.h"
 #include "events/music_event.h"
 #include "ble_chronos.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(ble_chronos, CONFIG_ZSW_BLE_LOG_LEVEL);
 
 // static void parse_time(char *data);
 static void music_control_event_callback(const struct zbus_channel *chan);
 
-ZBUS_CHAN_DECLARE(ble_comm_data_chan);
-ZBUS_LISTENER_DEFINE(android_music_control_lis_chronos, music_control_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(android_music_control_lis_chronos, music_control_event_callback);
 
 static chronos_data_t incoming; // variable to store incoming data
 
@@ -69,11 +69,6 @@ void ble_chronos_add_touch_cb(touch_callback_t callback)
     touch_callback = callback;
 }
 
-static void send_ble_data_event(struct ble_data_event *evt)
-{
-    zbus_chan_pub(&ble_comm_data_chan, evt, K_MSEC(250));
-}
-
 static void music_control_event_callback(const struct zbus_channel *chan)
 {
     const struct music_event *event = zbus_chan_const_msg(chan);
@@ -103,61 +98,64 @@ static void music_control_event_callback(const struct zbus_channel *chan)
 
 static void parse_time(uint32_t epoch)
 {
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
-
-    cb.data.data.time.seconds = epoch;
-    cb.data.type = BLE_COMM_DATA_TYPE_SET_TIME;
-    send_ble_data_event(&cb);
+    ble_comm_notify_time_t time = {
+        .seconds = epoch,
+    };
 
+    ble_data_event_send(BLE_COMM_DATA_TYPE_SET_TIME, &time);
 }
 
 static int parse_notify(chronos_notification_t *notification)
 {
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
-
+    ble_comm_cb_data_t *cb;
+    char *strings;
     struct tm tm_info = ble_chronos_get_time_struct();
+    const char *app_name = ble_chronos_get_app_name(notification->icon);
+    int app_name_len = strlen(app_name);
+    int title_len = strlen(notification->title);
+    int message_len = strlen(notification->message);
+
+    // The strings are kept in the message and freed with it
+    cb = ble_data_event_alloc(BLE_COMM_DATA_TYPE_NOTIFY, app_name_len + 1 + title_len + 1 + message_len + 1,
+                              (void **)&strings);
+    if (cb == NULL) {
+        return -ENOMEM;
+    }
 
-    cb.data.type = BLE_COMM_DATA_TYPE_NOTIFY;
-    cb.data.data.notify.id = tm_info.tm_sec + notification->time.hour * 10000 +  notification->time.minute * 100;
-    cb.data.data.notify.src = strdup(ble_chronos_get_app_name(notification->icon));
-    cb.data.data.notify.src_len = strlen(ble_chronos_get_app_name(notification->icon));
-    cb.data.data.notify.sender = strdup(ble_chronos_get_app_name(notification->icon));
-    cb.data.data.notify.sender_len = strlen(ble_chronos_get_app_name(notification->icon));
-    cb.data.data.notify.title = strdup(notification->title);
-    cb.data.data.notify.title_len = strlen(notification->title);
-    cb.data.data.notify.subject = strdup(notification->title);
-    cb.data.data.notify.subject_len = strlen(notification->title);
-    cb.data.data.notify.body = strdup(notification->message);
-    cb.data.data.notify.body_len = strlen(notification->message);
-
-    send_ble_data_event(&cb);
+    cb->data.notify.id = tm_info.tm_sec + notification->time.hour * 10000 +  notification->time.minute * 100;
+    cb->data.notify.src = strcpy(strings, app_name);
+    cb->data.notify.src_len = app_name_len;
+    cb->data.notify.sender = cb->data.notify.src;
+    cb->data.notify.sender_len = app_name_len;
+    strings += app_name_len + 1;
+    cb->data.notify.title = strcpy(strings, notification->title);
+    cb->data.notify.title_len = title_len;
+    cb->data.notify.subject = cb->data.notify.title;
+    cb->data.notify.subject_len = title_len;
+    strings += title_len + 1;
+    cb->data.notify.body = strcpy(strings, notification->message);
+    cb->data.notify.body_len = message_len;
 
-    return 0;
+    return ble_data_event_publish(cb);
 }
 
 static int parse_weather()
 {
     //{t:"weather",temp:268,hum:97,code:802,txt:"slightly cloudy",wind:2.0,wdir:14,loc:"MALMO"
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_weather_t weather_data = { 0 };
 
     chronos_weather_t *weather = ble_chronos_get_weather(0);
     chronos_hourly_forecast_t *forecast = ble_chronos_get_forecast_hour(ble_chronos_get_time_struct().tm_hour);
 
-    cb.data.type = BLE_COMM_DATA_TYPE_WEATHER;
-    cb.data.data.weather.humidity = forecast->humidity;
-    cb.data.data.weather.weather_code = 0;
-    cb.data.data.weather.wind = forecast->wind;
-    cb.data.data.weather.wind_direction = 0;
-    // cb.data.data.weather.report_text
-
-    cb.data.data.weather.temperature_c = weather->temp;
+    weather_data.humidity = forecast->humidity;
+    weather_data.weather_code = 0;
+    weather_data.wind = forecast->wind;
+    weather_data.wind_direction = 0;
+    // weather_data.report_text
 
-    send_ble_data_event(&cb);
+    weather_data.temperature_c = weather->temp;
 
-    return 0;
+    return ble_data_event_send(BLE_COMM_DATA_TYPE_WEATHER, &weather_data);
 }
 
 void ble_chronos_input(const uint8_t *const data, uint16_t len)
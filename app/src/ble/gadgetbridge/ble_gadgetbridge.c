@@ -22,6 +22,7 @@
 #include "managers/zsw_smp_manager.h"
 #include "ble_gadgetbridge.h"
 #include "app_version.h"
+#include "zsw_zbus_trace.h"
 
 #ifdef CONFIG_APPLICATIONS_USE_VOICE_MEMO
 #include "managers/zsw_recording_manager.h"
@@ -41,16 +42,20 @@ static parse_state_t parse_state = WAIT_GB;
 static uint16_t parsed_data_index = 0;
 static uint8_t receive_buf[MAX_GB_PACKET_LENGTH];
 
+#ifdef CONFIG_ZSW_BENCHMARK
+// Thread currently inside ble_gadgetbridge_parse_dry_run(), its parsed data is dropped.
+static k_tid_t dry_run_thread;
+#endif
+
 static void music_control_event_callback(const struct zbus_channel *chan);
 static void parse_time_zone(char *offset);
 
-ZBUS_CHAN_DECLARE(ble_comm_data_chan);
-ZBUS_LISTENER_DEFINE(android_music_control_lis, music_control_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(android_music_control_lis, music_control_event_callback);
 
 #ifdef CONFIG_APPLICATIONS_USE_VOICE_MEMO
 static void on_ble_recording_event(const struct zbus_channel *chan);
 ZBUS_CHAN_DECLARE(voice_memo_recording_chan);
-ZBUS_LISTENER_DEFINE(ble_voice_memo_recording_lis, on_ble_recording_event);
+ZSW_ZBUS_LISTENER_DEFINE(ble_voice_memo_recording_lis, on_ble_recording_event);
 
 static struct zsw_voice_memo_recording_event ble_recording_evt_copy;
 
@@ -76,11 +81,6 @@ static void on_ble_recording_event(const struct zbus_channel *chan)
 }
 #endif /* CONFIG_APPLICATIONS_USE_VOICE_MEMO */
 
-static void send_ble_data_event(struct ble_data_event *evt)
-{
-    zbus_chan_pub(&ble_comm_data_chan, evt, K_MSEC(250));
-}
-
 static void music_control_event_callback(const struct zbus_channel *chan)
 {
     const struct music_event *event = zbus_chan_const_msg(chan);
@@ -114,16 +114,14 @@ static void music_control_event_callback(const struct zbus_channel *chan)
 static void parse_time(char *start_time)
 {
     char *end_time;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_notify_time_t time = { 0 };
 
     end_time = strstr(start_time, ")");
     if (end_time) {
         errno = 0;
-        cb.data.data.time.seconds = strtol(start_time, &end_time, 10);
+        time.seconds = strtol(start_time, &end_time, 10);
         if (start_time != end_time && errno == 0) {
-            cb.data.type = BLE_COMM_DATA_TYPE_SET_TIME;
-            send_ble_data_event(&cb);
+            ble_data_event_send(BLE_COMM_DATA_TYPE_SET_TIME, &time);
         } else {
             LOG_WRN("Failed parsing time");
         }
@@ -140,17 +138,15 @@ static void parse_time(char *start_time)
 static void parse_time_zone(char *offset)
 {
     char *end_timezone;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_notify_time_t time = { 0 };
 
     end_timezone = strstr(offset, ")");
     if (end_timezone) {
-        cb.data.data.time.tz_offset = strtof(offset, &end_timezone);
+        time.tz_offset = strtof(offset, &end_timezone);
 
         if (offset != end_timezone) {
-            cb.data.type = BLE_COMM_DATA_TYPE_SET_TIME;
-            LOG_DBG("set time offset: %.1f", cb.data.data.time.tz_offset);
-            send_ble_data_event(&cb);
+            LOG_DBG("set time offset: %.1f", time.tz_offset);
+            ble_data_event_send(BLE_COMM_DATA_TYPE_SET_TIME, &time);
         } else {
             LOG_WRN("Failed parsing time");
         }
@@ -463,55 +459,75 @@ static void convert_to_encoded_text(char *data, int len, char *out_data, int out
     out_data[j] = '\0';
 }
 
+static bool is_dry_run(void)
+{
+#ifdef CONFIG_ZSW_BENCHMARK
+    return dry_run_thread == k_current_get();
+#else
+    return false;
+#endif
+}
+
+static int gb_data_event_publish(ble_comm_cb_data_t *data)
+{
+    if (is_dry_run()) {
+        ble_data_event_unref(data);
+        return 0;
+    }
+
+    return ble_data_event_publish(data);
+}
+
+static int gb_data_event_send(ble_comm_data_type_t type, const void *payload)
+{
+    if (is_dry_run()) {
+        return 0;
+    }
+
+    return ble_data_event_send(type, payload);
+}
+
 static int parse_notify(char *data, int len)
 {
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_notify_t notify = { 0 };
 
-    cb.data.type = BLE_COMM_DATA_TYPE_NOTIFY;
-    cb.data.data.notify.id = extract_value_uint32("\"id\":", data);
-    cb.data.data.notify.src = extract_value_str("\"src\":", data, &cb.data.data.notify.src_len);
-    cb.data.data.notify.sender = extract_value_str("\"sender\":", data, &cb.data.data.notify.sender_len);
-    cb.data.data.notify.title = extract_value_str("\"title\":", data, &cb.data.data.notify.title_len);
-    cb.data.data.notify.subject = extract_value_str("\"subject\":", data, &cb.data.data.notify.subject_len);
-    cb.data.data.notify.body = extract_value_str("\"body\":", data, &cb.data.data.notify.body_len);
+    notify.id = extract_value_uint32("\"id\":", data);
+    notify.src = extract_value_str("\"src\":", data, &notify.src_len);
+    notify.sender = extract_value_str("\"sender\":", data, &notify.sender_len);
+    notify.title = extract_value_str("\"title\":", data, &notify.title_len);
+    notify.subject = extract_value_str("\"subject\":", data, &notify.subject_len);
+    notify.body = extract_value_str("\"body\":", data, &notify.body_len);
 
     // Little hack since we know it's JSON, we can terminate all values in the data
     // which saves us some hassle and we can just pass all values null terminated
     // to the callback. Make sure to do it after finish parsing!
-    if (cb.data.data.notify.src) {
-        cb.data.data.notify.src[cb.data.data.notify.src_len] = '\0';
+    if (notify.src) {
+        notify.src[notify.src_len] = '\0';
     }
-    if (cb.data.data.notify.sender) {
-        cb.data.data.notify.sender[cb.data.data.notify.sender_len] = '\0';
+    if (notify.sender) {
+        notify.sender[notify.sender_len] = '\0';
     }
-    if (cb.data.data.notify.title) {
-        cb.data.data.notify.title[cb.data.data.notify.title_len] = '\0';
+    if (notify.title) {
+        notify.title[notify.title_len] = '\0';
     }
 
-    if (cb.data.data.notify.subject) {
-        cb.data.data.notify.subject[cb.data.data.notify.subject_len] = '\0';
+    if (notify.subject) {
+        notify.subject[notify.subject_len] = '\0';
     }
-    if (cb.data.data.notify.body) {
-        cb.data.data.notify.body[cb.data.data.notify.body_len] = '\0';
+    if (notify.body) {
+        notify.body[notify.body_len] = '\0';
     }
 
-    send_ble_data_event(&cb);
-
-    return 0;
+    return gb_data_event_send(BLE_COMM_DATA_TYPE_NOTIFY, &notify);
 }
 
 static int parse_notify_delete(char *data, int len)
 {
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
-
-    cb.data.type = BLE_COMM_DATA_TYPE_NOTIFY_REMOVE;
-    cb.data.data.notify.id = extract_value_uint32("\"id\":", data);
-
-    send_ble_data_event(&cb);
+    ble_comm_notify_remove_t notify_remove = {
+        .id = extract_value_uint32("\"id\":", data),
+    };
 
-    return 0;
+    return gb_data_event_send(BLE_COMM_DATA_TYPE_NOTIFY_REMOVE, &notify_remove);
 }
 
 static int parse_weather(char *data, int len)
@@ -520,27 +536,23 @@ static int parse_weather(char *data, int len)
     int temp_len;
     char *temp_value;
     float temperature;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_weather_t weather = { 0 };
 
-    cb.data.type = BLE_COMM_DATA_TYPE_WEATHER;
     int32_t temperature_k = extract_value_uint32("\"temp\":", data);
-    cb.data.data.weather.humidity = extract_value_uint32("\"hum\":", data);
-    cb.data.data.weather.weather_code = extract_value_uint32("\"code\":", data);
-    cb.data.data.weather.wind = extract_value_uint32("\"wind\":", data);
-    cb.data.data.weather.wind_direction = extract_value_uint32("\"wdir\":", data);
+    weather.humidity = extract_value_uint32("\"hum\":", data);
+    weather.weather_code = extract_value_uint32("\"code\":", data);
+    weather.wind = extract_value_uint32("\"wind\":", data);
+    weather.wind_direction = extract_value_uint32("\"wdir\":", data);
     temp_value = extract_value_str("\"txt\":", data, &temp_len);
 
-    strncpy(cb.data.data.weather.report_text, temp_value, MIN(temp_len, MAX_WEATHER_REPORT_TEXT_LENGTH - 1));
-    cb.data.data.weather.report_text[MAX_WEATHER_REPORT_TEXT_LENGTH - 1] = '\0';
+    strncpy(weather.report_text, temp_value, MIN(temp_len, MAX_WEATHER_REPORT_TEXT_LENGTH - 1));
+    weather.report_text[MAX_WEATHER_REPORT_TEXT_LENGTH - 1] = '\0';
 
     // App sends temperature in Kelvin
     temperature = temperature_k - 273.15f;
-    cb.data.data.weather.temperature_c = (int8_t)roundf(temperature);
+    weather.temperature_c = (int8_t)roundf(temperature);
 
-    send_ble_data_event(&cb);
-
-    return 0;
+    return gb_data_event_send(BLE_COMM_DATA_TYPE_WEATHER, &weather);
 }
 
 static int parse_musicinfo(char *data, int len)
@@ -548,23 +560,23 @@ static int parse_musicinfo(char *data, int len)
     // {t:"musicinfo",artist:"Ava Max",album:"Heaven & Hell",track:"Sweet but Psycho",dur:187,c:-1,n:-1}
     char *temp_value;
     int temp_len;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_cb_data_t *cb = ble_data_event_alloc(BLE_COMM_DATA_TYPE_MUSIC_INFO, 0, NULL);
 
-    cb.data.type = BLE_COMM_DATA_TYPE_MUSIC_INFO;
-    cb.data.data.music_info.duration = extract_value_int32("\"dur\":", data);
-    cb.data.data.music_info.track_count = extract_value_int32("\"c\":", data);
-    cb.data.data.music_info.track_num = extract_value_int32("\"n\":", data);
+    if (cb == NULL) {
+        return -ENOMEM;
+    }
+
+    cb->data.music_info.duration = extract_value_int32("\"dur\":", data);
+    cb->data.music_info.track_count = extract_value_int32("\"c\":", data);
+    cb->data.music_info.track_num = extract_value_int32("\"n\":", data);
     temp_value = extract_value_str("\"artist\":", data, &temp_len);
-    strncpy(cb.data.data.music_info.artist, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
+    strncpy(cb->data.music_info.artist, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
     temp_value = extract_value_str("\"album\":", data, &temp_len);
-    strncpy(cb.data.data.music_info.album, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
+    strncpy(cb->data.music_info.album, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
     temp_value = extract_value_str("\"track\":", data, &temp_len);
-    strncpy(cb.data.data.music_info.track_name, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
-
-    send_ble_data_event(&cb);
+    strncpy(cb->data.music_info.track_name, temp_value, MIN(temp_len, MAX_MUSIC_FIELD_LENGTH));
 
-    return 0;
+    return gb_data_event_publish(cb);
 }
 
 static int parse_musicstate(char *data, int len)
@@ -572,24 +584,20 @@ static int parse_musicstate(char *data, int len)
     // {t:"musicinfo",artist:"Ava Max",album:"Heaven & Hell",track:"Sweet but Psycho",dur:187,c:-1,n:-1}
     char *temp_value;
     int temp_len;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_music_state_t music_state = { 0 };
 
-    cb.data.type = BLE_COMM_DATA_TYPE_MUSIC_STATE;
-    cb.data.data.music_state.position = extract_value_int32("\"position\":", data);
-    cb.data.data.music_state.shuffle = extract_value_int32("\"shuffle\":", data);
-    cb.data.data.music_state.repeat = extract_value_int32("\"repeat\":", data);
+    music_state.position = extract_value_int32("\"position\":", data);
+    music_state.shuffle = extract_value_int32("\"shuffle\":", data);
+    music_state.repeat = extract_value_int32("\"repeat\":", data);
 
     temp_value = extract_value_str("\"state\":", data, &temp_len);
     if (strncmp(temp_value, "play", temp_len) == 0) {
-        cb.data.data.music_state.playing = true;
+        music_state.playing = true;
     } else {
-        cb.data.data.music_state.playing = false;
+        music_state.playing = false;
     }
 
-    send_ble_data_event(&cb);
-
-    return 0;
+    return gb_data_event_send(BLE_COMM_DATA_TYPE_MUSIC_STATE, &music_state);
 }
 
 static int parse_httpstate(char *data, int len)
@@ -597,22 +605,23 @@ static int parse_httpstate(char *data, int len)
     // {"t":"http","resp":"{\"response_code\":0,\"results\":[{\"type\":\"boolean\",\"difficulty\":\"easy\",\"category\":\"Geography\",\"question\":\"Hungary is the only country in the world beginning with H.\",\"correct_answer\":\"False\",\"incorrect_answers\":[\"True\"]}]}"}
     char *temp_value;
     int temp_len;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
-
-    cb.data.type = BLE_COMM_DATA_TYPE_HTTP;
+    int id = -1;
+    const char *err = NULL;
+    size_t err_len = 0;
+    const char *response = NULL;
+    size_t response_len = 0;
+    ble_comm_cb_data_t *cb;
+    char *strings;
 
     temp_value = extract_value_str("\"id\":", data, &temp_len);
     if (temp_value) {
         errno = 0;
         char *end_data;
-        cb.data.data.http_response.id  = strtol(temp_value, &end_data, 10);
+        id = strtol(temp_value, &end_data, 10);
         if (temp_value == end_data || errno != 0) {
             LOG_WRN("Failed parsing http request id");
-            cb.data.data.http_response.id = -1;
+            id = -1;
         }
-    } else {
-        cb.data.data.http_response.id = -1;
     }
 
     // {"t":"http","err":"Internet access not enabled in this Gadgetbridge build"}
@@ -620,28 +629,40 @@ static int parse_httpstate(char *data, int len)
 
     if (temp_value != NULL) {
         LOG_ERR("HTTP err: %s", temp_value);
-        memcpy(cb.data.data.http_response.err, temp_value, temp_len);
-        send_ble_data_event(&cb);
+        err = temp_value;
+        err_len = MIN(temp_len, MAX_HTTP_FIELD_LENGTH);
     } else {
         temp_value = extract_value_str("\"resp\":", data, &temp_len);
-        if (temp_value) {
-            LOG_DBG("HTTP response: %s", temp_value);
-            memcpy(cb.data.data.http_response.response, temp_value,
-                   (strlen(temp_value) > MAX_HTTP_FIELD_LENGTH) ? MAX_HTTP_FIELD_LENGTH : strlen(temp_value)); /// @todo cast?
-            send_ble_data_event(&cb);
+        if (temp_value == NULL) {
+            return 0;
         }
+        LOG_DBG("HTTP response: %s", temp_value);
+        response = temp_value;
+        response_len = MIN(strlen(temp_value), MAX_HTTP_FIELD_LENGTH);
     }
 
-    return 0;
+    // Both strings are stored null terminated after the payload, only as large as received
+    cb = ble_data_event_alloc(BLE_COMM_DATA_TYPE_HTTP, err_len + 1 + response_len + 1, (void **)&strings);
+    if (cb == NULL) {
+        return -ENOMEM;
+    }
+    if (err) {
+        memcpy(strings, err, err_len);
+    }
+    if (response) {
+        memcpy(&strings[err_len + 1], response, response_len);
+    }
+    cb->data.http_response.id = id;
+    cb->data.http_response.err = strings;
+    cb->data.http_response.response = &strings[err_len + 1];
+
+    return gb_data_event_publish(cb);
 }
 
 static int parse_gps_data(char *data, int len)
 {
     //{"t":"gps","lat":55.6135542,"lon":12.9747185,"alt":41.900001525878906,"speed":0.1458607256412506,"time":1717002933835,"satellites":0,"hdop":16.215999603271484,"externalSource":true,"gpsSource":"network"}
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
-
-    cb.data.type = BLE_COMM_DATA_TYPE_GPS;
+    ble_comm_gps_t gps = { 0 };
 
     cJSON *root = cJSON_Parse(data);
     if (root == NULL) {
@@ -657,19 +678,17 @@ static int parse_gps_data(char *data, int len)
     cJSON *satellites = cJSON_GetObjectItem(root, "satellites");
     cJSON *hdop = cJSON_GetObjectItem(root, "hdop");
 
-    cb.data.data.gps.lat = lat != NULL ? lat->valuedouble : -1;
-    cb.data.data.gps.lon = lon != NULL ? lon->valuedouble : -1;
-    cb.data.data.gps.alt = alt != NULL ? alt->valuedouble : -1;
-    cb.data.data.gps.speed = speed != NULL ? speed->valuedouble : -1;
-    cb.data.data.gps.time = time != NULL ? time->valuedouble : -1;
-    cb.data.data.gps.satellites = satellites != NULL ? satellites->valueint : -1;
-    cb.data.data.gps.hdop = hdop != NULL ? hdop->valuedouble : -1;
+    gps.lat = lat != NULL ? lat->valuedouble : -1;
+    gps.lon = lon != NULL ? lon->valuedouble : -1;
+    gps.alt = alt != NULL ? alt->valuedouble : -1;
+    gps.speed = speed != NULL ? speed->valuedouble : -1;
+    gps.time = time != NULL ? time->valuedouble : -1;
+    gps.satellites = satellites != NULL ? satellites->valueint : -1;
+    gps.hdop = hdop != NULL ? hdop->valuedouble : -1;
 
     cJSON_Delete(root);
 
-    send_ble_data_event(&cb);
-
-    return 0;
+    return gb_data_event_send(BLE_COMM_DATA_TYPE_GPS, &gps);
 }
 
 static int parse_log_command(char *data, int len)
@@ -771,11 +790,17 @@ static int parse_voice_memo_command(char *data, int len)
     const char *action = action_obj->valuestring;
 
     if (strcmp(action, "list") == 0) {
+        /* Paged, optional "offset" and "limit", oldest first */
+        zsw_recording_entry_t entries[50];
+        cJSON *offset_obj = cJSON_GetObjectItem(root, "offset");
+        cJSON *limit_obj = cJSON_GetObjectItem(root, "limit");
+        int offset = cJSON_IsNumber(offset_obj) ? MAX(offset_obj->valueint, 0) : 0;
+        int limit = cJSON_IsNumber(limit_obj) ? CLAMP(limit_obj->valueint, 1, (int)ARRAY_SIZE(entries)) :
+                    (int)ARRAY_SIZE(entries);
         cJSON_Delete(root);
 
         /* Build JSON response with recording list */
-        zsw_recording_entry_t entries[50];
-        int count = zsw_recording_manager_list(entries, ARRAY_SIZE(entries));
+        int count = zsw_recording_manager_list(entries, offset, limit);
         if (count < 0) {
             LOG_ERR("voice_memo: list failed: %d", count);
             count = 0;
@@ -788,6 +813,8 @@ static int parse_voice_memo_command(char *data, int len)
 
         cJSON_AddStringToObject(resp, "t", "voice_memo");
         cJSON_AddStringToObject(resp, "action", "list_result");
+        cJSON_AddNumberToObject(resp, "offset", offset);
+        cJSON_AddNumberToObject(resp, "total", zsw_recording_manager_get_count());
 
         cJSON *arr = cJSON_AddArrayToObject(resp, "recordings");
         for (int i = 0; i < count; i++) {
@@ -917,6 +944,11 @@ static int parse_data(char *data, int len)
         return parse_httpstate(data, len);
     }
 
+    // The remaining types are commands, a dry run must not execute them.
+    if (is_dry_run()) {
+        return 0;
+    }
+
     if (strlen("gps") == type_len && strncmp(type, "gps", type_len) == 0) {
         return parse_gps_data(data, len);
     }
@@ -948,8 +980,7 @@ static int parse_data(char *data, int len)
 static void parse_remote_control(char *data, int len)
 {
     int button;
-    struct ble_data_event cb;
-    memset(&cb, 0, sizeof(cb));
+    ble_comm_remote_control_t remote_control;
 
     button = atoi(data);
     LOG_DBG("Pressed: %d, len: %d", button, len);
@@ -957,10 +988,9 @@ static void parse_remote_control(char *data, int len)
         return;
     }
 
-    cb.data.type = BLE_COMM_DATA_TYPE_REMOTE_CONTROL;
-    cb.data.data.remote_control.button = button;
+    remote_control.button = button;
 
-    send_ble_data_event(&cb);
+    ble_data_event_send(BLE_COMM_DATA_TYPE_REMOTE_CONTROL, &remote_control);
 }
 
 void ble_gadgetbridge_input(const uint8_t *const data, uint16_t len)
@@ -1054,6 +1084,32 @@ void ble_gadgetbridge_input(const uint8_t *const data, uint16_t len)
     }
 }
 
+#ifdef CONFIG_ZSW_BENCHMARK
+int ble_gadgetbridge_parse_dry_run(const char *data, uint16_t len)
+{
+    static char parse_buf[MAX_GB_PACKET_LENGTH];
+    const char *gb_start = strstr(data, "GB(");
+    int ret;
+
+    if (gb_start == NULL) {
+        return -EINVAL;
+    }
+    gb_start += strlen("GB(");
+    len -= gb_start - data;
+    if (len >= sizeof(parse_buf)) {
+        return -ENOMEM;
+    }
+    memcpy(parse_buf, gb_start, len);
+    parse_buf[len] = '\0';
+
+    dry_run_thread = k_current_get();
+    ret = parse_data(parse_buf, len);
+    dry_run_thread = NULL;
+
+    return ret;
+}
+#endif
+
 void ble_gadgetbridge_send_version_info(void)
 {
     char version_msg[100];
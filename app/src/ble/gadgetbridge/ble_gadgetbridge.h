@@ -13,6 +13,19 @@
 
 void ble_gadgetbridge_input(const uint8_t *const data, uint16_t len);
 
+#ifdef CONFIG_ZSW_BENCHMARK
+/**
+ * @brief Parse one complete GB(...) message without publishing the result or running commands.
+ *
+ * Used to benchmark the parser, does not touch the state of ble_gadgetbridge_input().
+ *
+ * @param data Message, starting with GB(
+ * @param len  Length of data
+ * @return 0 when parsed, negative errno otherwise
+ */
+int ble_gadgetbridge_parse_dry_run(const char *data, uint16_t len);
+#endif
+
 void ble_gadgetbridge_send_version_info(void);
 
 /**
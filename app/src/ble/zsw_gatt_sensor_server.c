@@ -24,6 +24,8 @@
 
 #include "events/periodic_event.h"
 #include "events/zsw_periodic_event.h"
+#include "events/pressure_event.h"
+#include "events/light_event.h"
 
 #include "ble/ble_comm.h"
 #include <ble/zsw_gatt_sensor_server.h>
@@ -32,7 +34,8 @@
 #include "sensors/zsw_imu.h"
 #include "sensors/zsw_light_sensor.h"
 #include "sensors/zsw_magnetometer.h"
-#include "sensors/zsw_pressure_sensor.h"
+#include "sensors/zsw_sensor_hub.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(zsw_gatt_sensor_server, CONFIG_ZSW_BLE_LOG_LEVEL);
 
@@ -45,7 +48,9 @@ static void connected(struct bt_conn *conn, uint8_t err);
 static void zbus_periodic_fast_callback(const struct zbus_channel *chan);
 
 ZBUS_CHAN_DECLARE(periodic_event_100ms_chan);
-ZBUS_LISTENER_DEFINE(azsw_gatt_sensor_server_lis, zbus_periodic_fast_callback);
+ZBUS_CHAN_DECLARE(pressure_data_chan);
+ZBUS_CHAN_DECLARE(light_data_chan);
+ZSW_ZBUS_LISTENER_DEFINE(azsw_gatt_sensor_server_lis, zbus_periodic_fast_callback);
 
 BT_CONN_CB_DEFINE(conn_callbacks) = {
     .connected = connected,
@@ -56,6 +61,16 @@ BT_CONN_CB_DEFINE(conn_callbacks) = {
 // 1 = 100ms, 5 = 500ms, 10 = 1s etc.
 #define ZSW_GATT_SENSOR_NOTIFY_INTERVAL_PERIODS    2
 
+static zsw_sensor_hub_sub_t pressure_sub = {
+    .sensor = ZSW_SENSOR_HUB_PRESSURE,
+    .interval_ms = ZSW_GATT_SENSOR_NOTIFY_INTERVAL_PERIODS * 100,
+};
+
+static zsw_sensor_hub_sub_t light_sub = {
+    .sensor = ZSW_SENSOR_HUB_LIGHT,
+    .interval_ms = ZSW_GATT_SENSOR_NOTIFY_INTERVAL_PERIODS * 100,
+};
+
 #if CONFIG_BLE_DISABLE_PAIRING_REQUIRED
 #define ZSW_GATT_READ_WRITE_PERM    BT_GATT_PERM_READ | BT_GATT_PERM_WRITE
 #else
@@ -192,13 +207,14 @@ static ssize_t on_read(struct bt_conn *conn, const struct bt_gatt_attr *attr, vo
     int16_t y;
     int16_t z;
     int write_len;
-    float pressure = 0.0;
+    struct pressure_event pressure_evt = { 0 };
     float *f_ptr;
 
     f_ptr = (float *)buf;
     write_len = 0;
 
-    zsw_pressure_sensor_get_pressure(&pressure);
+    // Latest sample from the sensor hub, only sampled while someone is subscribed.
+    zbus_chan_read(&pressure_data_chan, &pressure_evt, K_MSEC(100));
 
     if (bt_gatt_attr_get_handle(attr) == bt_gatt_attr_get_handle(&temp_service.attrs[2])) {
         f_ptr[0] = 0.0;
@@ -213,7 +229,7 @@ static ssize_t on_read(struct bt_conn *conn, const struct bt_gatt_attr *attr, vo
         f_ptr[0] = 0.0;
         write_len = sizeof(float);
     } else if (bt_gatt_attr_get_handle(attr) == bt_gatt_attr_get_handle(&pressure_service.attrs[2])) {
-        f_ptr[0] = pressure;
+        f_ptr[0] = pressure_evt.pressure;
         write_len = sizeof(float);
     } else if (bt_gatt_attr_get_handle(attr) == bt_gatt_attr_get_handle(&mag_service.attrs[2])) {
         zsw_magnetometer_set_enable(true);
@@ -275,10 +291,14 @@ static void on_ccc_cfg_changed(const struct bt_gatt_attr *attr, uint16_t value)
             LOG_ERR("Failed to start sensor fusion for BLE notifications");
         }
         ble_comm_set_short_connection_interval();
+        zsw_sensor_hub_subscribe(&pressure_sub);
+        zsw_sensor_hub_subscribe(&light_sub);
         zsw_periodic_chan_add_obs(&periodic_event_100ms_chan, &azsw_gatt_sensor_server_lis);
     } else if (notif_enabled && !notifications_active) {
         ble_comm_set_default_connection_interval();
         zsw_periodic_chan_rm_obs(&periodic_event_100ms_chan, &azsw_gatt_sensor_server_lis);
+        zsw_sensor_hub_unsubscribe(&pressure_sub);
+        zsw_sensor_hub_unsubscribe(&light_sub);
         zsw_imu_feature_disable(ZSW_IMU_FEATURE_GYRO);
         zsw_sensor_fusion_deinit();
         notif_enabled = false;
@@ -313,6 +333,8 @@ static void disconnected(struct bt_conn *conn, uint8_t reason)
 
     ble_comm_set_default_connection_interval();
     zsw_periodic_chan_rm_obs(&periodic_event_100ms_chan, &azsw_gatt_sensor_server_lis);
+    zsw_sensor_hub_unsubscribe(&pressure_sub);
+    zsw_sensor_hub_unsubscribe(&light_sub);
     zsw_imu_feature_disable(ZSW_IMU_FEATURE_GYRO);
     zsw_sensor_fusion_deinit();
     notif_enabled = false;
@@ -325,7 +347,8 @@ static void zbus_periodic_fast_callback(const struct zbus_channel *chan)
     int16_t z;
     int write_len;
     float *f_ptr;
-    float pressure = 0.0;
+    struct pressure_event pressure_evt;
+    struct light_event light_evt;
     zsw_quat_t quat;
     uint8_t buf[CONFIG_BT_L2CAP_TX_MTU];
 
@@ -345,10 +368,11 @@ static void zbus_periodic_fast_callback(const struct zbus_channel *chan)
     write_len = sizeof(float);
     bt_gatt_notify(NULL, &humidity_service.attrs[2], &buf, write_len);
 
-    zsw_pressure_sensor_get_pressure(&pressure);
-    f_ptr[0] = pressure;
-    write_len = sizeof(float);
-    bt_gatt_notify(NULL, &pressure_service.attrs[2], &buf, write_len);
+    if (zbus_chan_read(&pressure_data_chan, &pressure_evt, K_NO_WAIT) == 0) {
+        f_ptr[0] = pressure_evt.pressure;
+        write_len = sizeof(float);
+        bt_gatt_notify(NULL, &pressure_service.attrs[2], &buf, write_len);
+    }
 
     if (zsw_imu_fetch_accel(&x, &y, &z) == 0) {
         f_ptr[0] = x;
@@ -373,7 +397,8 @@ static void zbus_periodic_fast_callback(const struct zbus_channel *chan)
         bt_gatt_notify(NULL, &mag_service.attrs[2], &buf, write_len);
     }
 
-    if (zsw_light_sensor_get_light(&f_ptr[0]) == 0) {
+    if (zbus_chan_read(&light_data_chan, &light_evt, K_NO_WAIT) == 0) {
+        f_ptr[0] = light_evt.light;
         write_len = sizeof(float);
         bt_gatt_notify(NULL, &light_service.attrs[2], &buf, write_len);
     }
@@ -38,6 +38,26 @@ static __aligned(4) uint8_t *encoder_mem;
 static OpusEncoder *encoder;
 static bool initialized;
 static bool xip_acquired;
+static int complexity = CONFIG_ZSW_OPUS_COMPLEXITY;
+static int32_t bitrate = CONFIG_ZSW_OPUS_BITRATE;
+
+/* Decoder state, also from the system heap, only allocated while playing back. */
+static __aligned(4) uint8_t *decoder_mem;
+static OpusDecoder *decoder;
+static bool decoder_xip_acquired;
+
+static void apply_settings(void)
+{
+    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(bitrate));
+    opus_encoder_ctl(encoder, OPUS_SET_VBR(1));
+    opus_encoder_ctl(encoder, OPUS_SET_VBR_CONSTRAINT(0));
+    opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(complexity));
+    opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+    opus_encoder_ctl(encoder, OPUS_SET_LSB_DEPTH(16));
+    opus_encoder_ctl(encoder, OPUS_SET_DTX(0));
+    opus_encoder_ctl(encoder, OPUS_SET_INBAND_FEC(0));
+    opus_encoder_ctl(encoder, OPUS_SET_PACKET_LOSS_PERC(0));
+}
 
 int zsw_audio_codec_init(void)
 {
@@ -86,15 +106,9 @@ int zsw_audio_codec_init(void)
     }
 
     /* Configure encoder per spec */
-    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(CONFIG_ZSW_OPUS_BITRATE));
-    opus_encoder_ctl(encoder, OPUS_SET_VBR(1));
-    opus_encoder_ctl(encoder, OPUS_SET_VBR_CONSTRAINT(0));
-    opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(CONFIG_ZSW_OPUS_COMPLEXITY));
-    opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
-    opus_encoder_ctl(encoder, OPUS_SET_LSB_DEPTH(16));
-    opus_encoder_ctl(encoder, OPUS_SET_DTX(0));
-    opus_encoder_ctl(encoder, OPUS_SET_INBAND_FEC(0));
-    opus_encoder_ctl(encoder, OPUS_SET_PACKET_LOSS_PERC(0));
+    complexity = CONFIG_ZSW_OPUS_COMPLEXITY;
+    bitrate = CONFIG_ZSW_OPUS_BITRATE;
+    apply_settings();
 
     initialized = true;
 
@@ -142,21 +156,57 @@ void zsw_audio_codec_reset(void)
     if (ret != OPUS_OK) {
         LOG_ERR("Opus encoder reset failed: %d", ret);
     } else {
-        /* Reapply settings after reset */
-        opus_encoder_ctl(encoder, OPUS_SET_BITRATE(CONFIG_ZSW_OPUS_BITRATE));
-        opus_encoder_ctl(encoder, OPUS_SET_VBR(1));
-        opus_encoder_ctl(encoder, OPUS_SET_VBR_CONSTRAINT(0));
-        opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(CONFIG_ZSW_OPUS_COMPLEXITY));
-        opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
-        opus_encoder_ctl(encoder, OPUS_SET_LSB_DEPTH(16));
-        opus_encoder_ctl(encoder, OPUS_SET_DTX(0));
-        opus_encoder_ctl(encoder, OPUS_SET_INBAND_FEC(0));
-        opus_encoder_ctl(encoder, OPUS_SET_PACKET_LOSS_PERC(0));
+        /* Reapply settings after reset, tuning from the last recording is dropped */
+        complexity = CONFIG_ZSW_OPUS_COMPLEXITY;
+        bitrate = CONFIG_ZSW_OPUS_BITRATE;
+        apply_settings();
 
         LOG_DBG("Opus encoder state reset");
     }
 }
 
+int zsw_audio_codec_set_complexity(int new_complexity)
+{
+    if (!initialized) {
+        return -EINVAL;
+    }
+
+    if (new_complexity < 0 || new_complexity > 10) {
+        return -EINVAL;
+    }
+
+    if (opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(new_complexity)) != OPUS_OK) {
+        return -EIO;
+    }
+    complexity = new_complexity;
+
+    return 0;
+}
+
+int zsw_audio_codec_get_complexity(void)
+{
+    return complexity;
+}
+
+int zsw_audio_codec_set_bitrate(int32_t new_bitrate)
+{
+    if (!initialized) {
+        return -EINVAL;
+    }
+
+    if (opus_encoder_ctl(encoder, OPUS_SET_BITRATE(new_bitrate)) != OPUS_OK) {
+        return -EIO;
+    }
+    bitrate = new_bitrate;
+
+    return 0;
+}
+
+int32_t zsw_audio_codec_get_bitrate(void)
+{
+    return bitrate;
+}
+
 size_t zsw_audio_codec_frame_samples(void)
 {
     return OPUS_MAX_FRAME_SIZE;
@@ -176,3 +226,76 @@ void zsw_audio_codec_deinit(void)
         xip_acquired = false;
     }
 }
+
+int zsw_audio_codec_decoder_init(uint32_t sample_rate)
+{
+    int actual_size;
+    int ret;
+
+    if (decoder) {
+        LOG_WRN("Audio decoder already initialized");
+        return 0;
+    }
+
+    ret = zsw_xip_enable();
+    if (ret < 0) {
+        LOG_ERR("Failed to enable XIP for Opus decoder: %d", ret);
+        return ret;
+    }
+    decoder_xip_acquired = true;
+
+    actual_size = opus_decoder_get_size(OPUS_CHANNELS);
+    decoder_mem = k_malloc(actual_size);
+    if (!decoder_mem) {
+        LOG_ERR("Failed to allocate %d bytes for Opus decoder", actual_size);
+        zsw_audio_codec_decoder_deinit();
+        return -ENOMEM;
+    }
+    decoder = (OpusDecoder *)decoder_mem;
+
+    ret = opus_decoder_init(decoder, (opus_int32)sample_rate, OPUS_CHANNELS);
+    if (ret != OPUS_OK) {
+        LOG_ERR("Opus decoder init failed: %d", ret);
+        zsw_audio_codec_decoder_deinit();
+        return ret == OPUS_BAD_ARG ? -EINVAL : -EIO;
+    }
+
+    LOG_INF("Opus decoder initialized: state_size=%d, sample_rate=%u", actual_size, sample_rate);
+
+    return 0;
+}
+
+int zsw_audio_codec_decode(const uint8_t *opus_in, size_t len, int16_t *pcm_out, size_t max_samples)
+{
+    int decoded;
+
+    if (!decoder) {
+        return -EINVAL;
+    }
+
+    if (pcm_out == NULL || max_samples == 0 || max_samples > INT_MAX || len > INT32_MAX) {
+        return -EINVAL;
+    }
+
+    decoded = opus_decode(decoder, opus_in, (opus_int32)len, pcm_out, (int)max_samples, 0);
+    if (decoded < 0) {
+        LOG_WRN("Opus decoding failed: %d", decoded);
+        return -EIO;
+    }
+
+    return decoded;
+}
+
+void zsw_audio_codec_decoder_deinit(void)
+{
+    if (decoder_mem) {
+        k_free(decoder_mem);
+        decoder_mem = NULL;
+        decoder = NULL;
+    }
+
+    if (decoder_xip_acquired) {
+        zsw_xip_disable();
+        decoder_xip_acquired = false;
+    }
+}
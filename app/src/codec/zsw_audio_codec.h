@@ -45,6 +45,55 @@ void zsw_audio_codec_reset(void);
 /** Release encoder resources (frees heap memory). */
 void zsw_audio_codec_deinit(void);
 
+/**
+ * @brief Change the encoder complexity, takes effect from the next frame.
+ *
+ * Reset to CONFIG_ZSW_OPUS_COMPLEXITY by zsw_audio_codec_init() and zsw_audio_codec_reset().
+ *
+ * @param complexity 0-10, lower is faster.
+ * @return 0 on success, or negative error code.
+ */
+int zsw_audio_codec_set_complexity(int complexity);
+
+/** Get the current encoder complexity. */
+int zsw_audio_codec_get_complexity(void);
+
+/**
+ * @brief Change the encoder bitrate, takes effect from the next frame.
+ *
+ * Reset to CONFIG_ZSW_OPUS_BITRATE by zsw_audio_codec_init() and zsw_audio_codec_reset().
+ *
+ * @param bitrate Bitrate in bits per second.
+ * @return 0 on success, or negative error code.
+ */
+int zsw_audio_codec_set_bitrate(int32_t bitrate);
+
+/** Get the current encoder bitrate in bits per second. */
+int32_t zsw_audio_codec_get_bitrate(void);
+
+/**
+ * @brief Initialize the Opus decoder, separate from the encoder.
+ *
+ * @param sample_rate Output rate, one of 8000, 12000, 16000, 24000 or 48000. Opus resamples
+ *                    internally, so recordings can be decoded straight to the speaker rate.
+ * @return 0 on success, or negative error code.
+ */
+int zsw_audio_codec_decoder_init(uint32_t sample_rate);
+
+/**
+ * @brief Decode an Opus frame to mono PCM.
+ *
+ * @param opus_in     Encoded frame, or NULL to conceal a lost frame.
+ * @param len         Size of opus_in in bytes.
+ * @param pcm_out     Output buffer for 16-bit PCM samples.
+ * @param max_samples Size of pcm_out in samples.
+ * @return Decoded sample count on success, or negative error code.
+ */
+int zsw_audio_codec_decode(const uint8_t *opus_in, size_t len, int16_t *pcm_out, size_t max_samples);
+
+/** Release decoder resources (frees heap memory). */
+void zsw_audio_codec_decoder_deinit(void);
+
 /** Get the expected frame size in samples (e.g. 160 for 10 ms at 16 kHz). */
 size_t zsw_audio_codec_frame_samples(void);
 
@@ -17,6 +17,10 @@
 
 #include "drivers/zsw_display_control.h"
 #include "managers/zsw_xip_manager.h"
+#ifdef CONFIG_ZSW_BENCHMARK
+#include "zsw_benchmark.h"
+#include "zsw_timing.h"
+#endif
 #include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/device.h>
@@ -306,7 +310,13 @@ void zsw_display_control_set_brightness(uint8_t percent)
 
 static void lvgl_render(struct k_work *item)
 {
+#ifdef CONFIG_ZSW_BENCHMARK
+    uint32_t start_us = zsw_timing_get_us();
+#endif
     const int64_t next_update_in_ms = lv_task_handler();
+#ifdef CONFIG_ZSW_BENCHMARK
+    zsw_benchmark_add_task_handler_sample(zsw_timing_get_us() - start_us);
+#endif
     if (first_render_since_poweron) {
         zsw_display_control_set_brightness(last_brightness);
         first_render_since_poweron = false;
@@ -15,10 +15,40 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/zbus/zbus.h>
+#include <zephyr/logging/log.h>
 
 #include "ble_event.h"
 
+LOG_MODULE_REGISTER(ble_event, LOG_LEVEL_WRN);
+
+typedef struct ble_data_msg_t {
+    atomic_t refcount;
+    ble_comm_cb_data_t data;
+} ble_data_msg_t;
+
+#define MSG_HEADER_SIZE     offsetof(ble_data_msg_t, data.data)
+
+static const uint16_t payload_sizes[] = {
+    [BLE_COMM_DATA_TYPE_NOTIFY] = sizeof(ble_comm_notify_t),
+    [BLE_COMM_DATA_TYPE_NOTIFY_REMOVE] = sizeof(ble_comm_notify_remove_t),
+    [BLE_COMM_DATA_TYPE_SET_TIME] = sizeof(ble_comm_notify_time_t),
+    [BLE_COMM_DATA_TYPE_WEATHER] = sizeof(ble_comm_weather_t),
+    [BLE_COMM_DATA_TYPE_MUSIC_INFO] = sizeof(ble_comm_music_info_t),
+    [BLE_COMM_DATA_TYPE_MUSIC_STATE] = sizeof(ble_comm_music_state_t),
+    [BLE_COMM_DATA_TYPE_REMOTE_CONTROL] = sizeof(ble_comm_remote_control_t),
+    [BLE_COMM_DATA_TYPE_HTTP] = sizeof(ble_comm_http_response_t),
+    [BLE_COMM_DATA_TYPE_GPS] = sizeof(ble_comm_gps_t),
+    [BLE_COMM_DATA_TYPE_EMPTY] = 0,
+};
+
+BUILD_ASSERT(ARRAY_SIZE(payload_sizes) == BLE_COMM_DATA_TYPE_EMPTY + 1, "Add the payload size of the new type");
+
+K_HEAP_DEFINE(ble_data_event_heap, CONFIG_ZSW_BLE_DATA_EVENT_POOL_SIZE);
+
 ZBUS_CHAN_DEFINE(ble_comm_data_chan,
                  struct ble_data_event,
                  NULL,
@@ -26,3 +56,69 @@ ZBUS_CHAN_DEFINE(ble_comm_data_chan,
                  ZBUS_OBSERVERS(notification_mgr_ble_comm_lis, main_ble_comm_lis, music_app_ble_comm_lis, watchface_ble_comm_lis),
                  ZBUS_MSG_INIT()
                 );
+
+ble_comm_cb_data_t *ble_data_event_alloc(ble_comm_data_type_t type, size_t extra_len, void **extra)
+{
+    ble_data_msg_t *msg;
+    size_t payload_size;
+
+    __ASSERT_NO_MSG(type < ARRAY_SIZE(payload_sizes));
+    payload_size = payload_sizes[type];
+
+    // Called from the Bluetooth RX thread, never wait for the pool.
+    msg = k_heap_alloc(&ble_data_event_heap, MSG_HEADER_SIZE + payload_size + extra_len, K_NO_WAIT);
+    if (msg == NULL) {
+        LOG_WRN("Pool full, dropped message type %d (%zu bytes)", type, MSG_HEADER_SIZE + payload_size + extra_len);
+        return NULL;
+    }
+
+    memset(msg, 0, MSG_HEADER_SIZE + payload_size + extra_len);
+    atomic_set(&msg->refcount, 1);
+    msg->data.type = type;
+    if (extra) {
+        *extra = (uint8_t *)msg + MSG_HEADER_SIZE + payload_size;
+    }
+
+    return &msg->data;
+}
+
+int ble_data_event_publish(ble_comm_cb_data_t *data)
+{
+    struct ble_data_event evt = {
+        .data = data,
+    };
+    int ret;
+
+    ret = zbus_chan_pub(&ble_comm_data_chan, &evt, K_MSEC(250));
+    ble_data_event_unref(data);
+
+    return ret;
+}
+
+int ble_data_event_send(ble_comm_data_type_t type, const void *payload)
+{
+    ble_comm_cb_data_t *data = ble_data_event_alloc(type, 0, NULL);
+
+    if (data == NULL) {
+        return -ENOMEM;
+    }
+    memcpy(&data->data, payload, payload_sizes[type]);
+
+    return ble_data_event_publish(data);
+}
+
+void ble_data_event_ref(ble_comm_cb_data_t *data)
+{
+    ble_data_msg_t *msg = CONTAINER_OF(data, ble_data_msg_t, data);
+
+    atomic_inc(&msg->refcount);
+}
+
+void ble_data_event_unref(ble_comm_cb_data_t *data)
+{
+    ble_data_msg_t *msg = CONTAINER_OF(data, ble_data_msg_t, data);
+
+    if (atomic_dec(&msg->refcount) == 1) {
+        k_heap_free(&ble_data_event_heap, msg);
+    }
+}
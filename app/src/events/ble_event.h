@@ -17,8 +17,47 @@
 
 #pragma once
 
+#include <stddef.h>
+
 #include "ble/ble_comm.h"
 
+/*
+ * Published on ble_comm_data_chan. Only a handle is passed, the payload is refcounted and
+ * allocated with the size its type needs. It is valid until the listener returns, a listener
+ * that needs it later takes a reference with ble_data_event_ref.
+ * The last message in the channel is not kept, don't read the channel with zbus_chan_read.
+ */
 struct ble_data_event {
-    ble_comm_cb_data_t data;
+    ble_comm_cb_data_t *data;
 };
+
+/** @brief           Allocate a zeroed message, only the union member for type is valid.
+ *  @param type      Message type
+ *  @param extra_len Extra bytes allocated after the payload, for example for strings
+ *  @param extra     Set to the extra bytes, can be NULL if extra_len is 0
+ *  @return          Message with one reference owned by the caller, NULL if the pool is full
+*/
+ble_comm_cb_data_t *ble_data_event_alloc(ble_comm_data_type_t type, size_t extra_len, void **extra);
+
+/** @brief      Publish a message on ble_comm_data_chan and drop the reference of the caller.
+ *  @param data Message from ble_data_event_alloc
+ *  @return     0 when successful
+*/
+int ble_data_event_publish(ble_comm_cb_data_t *data);
+
+/** @brief         Allocate a message, copy the payload into it and publish it.
+ *  @param type    Message type
+ *  @param payload Union member for type, for example a ble_comm_music_state_t
+ *  @return        0 when successful, -ENOMEM if the pool is full
+*/
+int ble_data_event_send(ble_comm_data_type_t type, const void *payload);
+
+/** @brief      Keep a message after the listener returns.
+ *  @param data Message received in a listener
+*/
+void ble_data_event_ref(ble_comm_cb_data_t *data);
+
+/** @brief      Release a reference, the message is freed with the last one.
+ *  @param data Message
+*/
+void ble_data_event_unref(ble_comm_cb_data_t *data);
@@ -22,6 +22,7 @@
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/storage/stream_flash.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/crc.h>
 #include <filesystem/zsw_filesystem.h>
 #include <drivers/zsw_display_control.h>
 #include <lvgl.h>
@@ -56,15 +57,31 @@ LOG_MODULE_REGISTER(zsw_fs, LOG_LEVEL_INF);
 #define MAX_FILE_NAME_LEN   32
 #define MAX_OPENED_FILES    64
 
+/* file_header_t flags, set by scripts/create_custom_resource_image.py */
+#define FILE_FLAG_LZ4               BIT(0)
+
+/*
+ * Compressed files are split in independent LZ4 blocks of this many uncompressed bytes.
+ * The file data starts with a table of num_blocks + 1 block end offsets, counted from the end
+ * of the table. Each block starts at the previous end rounded up to 4 bytes, a block that is
+ * as long as its uncompressed size is stored raw.
+ */
+#define COMPRESSED_BLOCK_SIZE       4096
+
 #define IS_SPECIAL_FULL_FS_FILE_PATH(name) \
-    (strncmp(name, FULL_FS_SPECIAL_FILE_NAME, sizeof(FULL_FS_SPECIAL_FILE_NAME) - 1) == 0)
+    (strcmp(name, FULL_FS_SPECIAL_FILE_NAME) == 0)
 #define IS_SPECIAL_FULL_FS_FILE(ptr) \
     (ptr == &full_fs_file)
+#define IS_SPECIAL_FULL_FS_PATCH_FILE_PATH(name) \
+    (strcmp(name, FULL_FS_PATCH_SPECIAL_FILE_NAME) == 0)
+#define IS_SPECIAL_FULL_FS_PATCH_FILE(ptr) \
+    (ptr == &full_fs_patch_file)
 
 typedef struct file_header_t {
     uint8_t         filename[MAX_FILE_NAME_LEN];
-    uint32_t        offset;
-    uint32_t        len;
+    uint32_t        offset : 24;
+    uint32_t        flags : 8;
+    uint32_t        len; // Uncompressed length
 } file_header_t;
 
 typedef struct file_table_t {
@@ -75,8 +92,22 @@ typedef struct file_table_t {
     file_header_t   file_headers[FILE_TABLE_MAX_LEN / sizeof(file_header_t)];
 } file_table_t;
 
+/*
+ * First pages of files that will likely be opened soon, for example the assets of the
+ * watchfaces next to the one selected in the watchface picker. Each prefetch request starts
+ * a new generation, slots holding pages of earlier generations are replaced first.
+ */
+#define PREFETCH_NUM_SLOTS  (CONFIG_ZSW_FS_PREFETCH_SIZE / CONFIG_ZSW_FS_PREFETCH_PAGE_SIZE)
+
+typedef struct prefetch_slot_t {
+    const file_header_t *file;
+    uint16_t        len;
+    uint16_t        generation;
+} prefetch_slot_t;
+
 typedef struct opened_file_t {
     file_header_t  *header;
+    const prefetch_slot_t *prefetch;
     uint32_t        index;
     bool            is_cached;
     uint32_t        cache_start;
@@ -91,21 +122,67 @@ typedef struct fullFsFile_t {
     bool            opened;
 } fullFsFile_t;
 
+/*
+ * Writing to full_fs_patch replaces single sectors of the image, written by
+ * scripts/create_custom_resource_image.py (create_patch). The patch starts with the CRC of
+ * the file table it was made against and is refused if the table on flash differs.
+ * Records are applied as they arrive. Data sectors come first and only touch space the
+ * current image does not use, the file table sectors come last, so rendering only stops
+ * while the table is replaced. Every file is checked against its CRC on close.
+ */
+#define FULL_FS_PATCH_SPECIAL_FILE_NAME "full_fs_patch"
+#define FULL_FS_PATCH_MAGIC 0x0B0B0B0B
+
+typedef struct full_fs_patch_header_t {
+    uint32_t        magic;
+    uint32_t        header_length;
+    uint32_t        base_table_crc;
+} full_fs_patch_header_t;
+
+typedef struct full_fs_patch_record_t {
+    uint32_t        magic;
+    uint32_t        address;
+    uint32_t        crc;
+    uint8_t         data[SPI_FLASH_SECTOR_SIZE];
+} full_fs_patch_record_t;
+
+typedef struct fullFsPatchFile_t {
+    full_fs_patch_header_t header;
+    full_fs_patch_record_t *record;
+    uint32_t        record_len;
+    uint32_t        index;
+    int             error; // First failure, nothing more is applied after it
+    bool            opened;
+    bool            table_written;
+} fullFsPatchFile_t;
+
 static file_table_t file_table;
 static opened_file_t opened_files[MAX_OPENED_FILES];
 
 static uint8_t file_cache_buffer[SPI_FLASH_SECTOR_SIZE];
 static opened_file_t *current_cached_file;
 
+static uint8_t decoded_block[COMPRESSED_BLOCK_SIZE] __aligned(4);
+static const file_header_t *decoded_file;
+static uint32_t decoded_block_index;
+
+static prefetch_slot_t prefetch_slots[MAX(PREFETCH_NUM_SLOTS, 1)];
+static uint8_t *prefetch_data;
+static uint16_t prefetch_generation;
+static uint32_t prefetch_next_slot;
+
 static const struct flash_area *flash_area;
 
 static lv_fs_drv_t fs_drv;
 
 static fullFsFile_t full_fs_file;
+static fullFsPatchFile_t full_fs_patch_file;
 static struct stream_flash_ctx full_fs_stream_ctx;
 static uint8_t full_fs_stream_buf[512] __aligned(4);
 static bool full_fs_stream_active;
 
+static int decode_block(const file_header_t *file, uint32_t block);
+
 static file_header_t *find_file(const char *name)
 {
     for (int i = 0; i < file_table.num_files; i++) {
@@ -126,6 +203,307 @@ static opened_file_t *find_free_opened_file(void)
     return NULL;
 }
 
+static prefetch_slot_t *prefetch_find(const file_header_t *file)
+{
+    if (prefetch_data == NULL) {
+        return NULL;
+    }
+
+    for (int i = 0; i < PREFETCH_NUM_SLOTS; i++) {
+        if (prefetch_slots[i].file == file) {
+            return &prefetch_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static uint8_t *prefetch_page(const prefetch_slot_t *slot)
+{
+    return prefetch_data + (slot - prefetch_slots) * CONFIG_ZSW_FS_PREFETCH_PAGE_SIZE;
+}
+
+static void prefetch_detach(const prefetch_slot_t *slot)
+{
+    for (int i = 0; i < MAX_OPENED_FILES; i++) {
+        if (slot == NULL || opened_files[i].prefetch == slot) {
+            opened_files[i].prefetch = NULL;
+        }
+    }
+}
+
+// Compiled out when prefetching is disabled, the modulo would divide by zero.
+#if PREFETCH_NUM_SLOTS > 0
+static prefetch_slot_t *prefetch_alloc_slot(void)
+{
+    prefetch_slot_t *slot;
+
+    for (int i = 0; i < PREFETCH_NUM_SLOTS; i++) {
+        slot = &prefetch_slots[prefetch_next_slot];
+        prefetch_next_slot = (prefetch_next_slot + 1) % PREFETCH_NUM_SLOTS;
+        if (slot->file == NULL || slot->generation != prefetch_generation) {
+            // Files already open on this slot go back to reading from flash
+            prefetch_detach(slot);
+            slot->file = NULL;
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+static int load_file_table(void)
+{
+    int rc;
+
+    rc = flash_area_read(flash_area, 0, &file_table, FILE_TABLE_MAX_LEN);
+    if (rc != 0) {
+        printk("Flash read failed! %d\n", rc);
+        return rc;
+    }
+
+    // Fill in the special file that corresponds to the full image.
+    full_fs_file.opened = false;
+    full_fs_file.index = 0;
+    full_fs_file.len = file_table.total_length;
+
+    if (file_table.magic != TABLE_HEADER_MAGIC) {
+        LOG_ERR("Invalid file table magic: 0x%08x", file_table.magic);
+        full_fs_file.len = 0;
+    } else {
+        uint32_t trailer_magic;
+        uint32_t trailer_offset = file_table.total_length - sizeof(trailer_magic); // Last 4 bytes
+
+        rc = flash_area_read(flash_area, trailer_offset, &trailer_magic, sizeof(trailer_magic));
+        if (rc != 0) {
+            LOG_ERR("Failed to read trailer magic at offset %d: %d", trailer_offset, rc);
+            full_fs_file.len = 0;
+        } else if (trailer_magic != TABLE_HEADER_MAGIC) {
+            LOG_ERR("Invalid trailer magic at offset %d: 0x%08x, expected 0x%08x",
+                    trailer_offset, trailer_magic, TABLE_HEADER_MAGIC);
+            full_fs_file.len = 0;
+        }
+    }
+
+    return 0;
+}
+
+static int full_fs_patch_check_header(const full_fs_patch_header_t *header, uint8_t *scratch)
+{
+    int rc;
+    uint32_t crc = 0;
+    uint32_t len;
+
+    if (header->magic != FULL_FS_PATCH_MAGIC) {
+        LOG_ERR("Invalid patch magic: 0x%08x", header->magic);
+        return -EINVAL;
+    }
+    if (file_table.magic != TABLE_HEADER_MAGIC || header->header_length != file_table.header_length) {
+        LOG_ERR("Patch table size %u does not match the image on flash", header->header_length);
+        return -EINVAL;
+    }
+
+    for (uint32_t pos = 0; pos < file_table.header_length; pos += len) {
+        len = MIN(SPI_FLASH_SECTOR_SIZE, file_table.header_length - pos);
+        rc = flash_area_read(flash_area, pos, scratch, len);
+        if (rc != 0) {
+            return rc;
+        }
+        crc = crc32_ieee_update(crc, scratch, len);
+    }
+
+    if (crc != header->base_table_crc) {
+        LOG_ERR("Patch was made for another image, table CRC 0x%08x, expected 0x%08x", crc,
+                header->base_table_crc);
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static int full_fs_patch_apply(const full_fs_patch_record_t *record)
+{
+    int rc;
+    bool is_table = record->address < ROUND_UP(full_fs_patch_file.header.header_length, SPI_FLASH_SECTOR_SIZE);
+
+    if (record->magic != TABLE_HEADER_MAGIC) {
+        LOG_ERR("Invalid patch record magic: 0x%08x", record->magic);
+        return -EINVAL;
+    }
+    if ((record->address % SPI_FLASH_SECTOR_SIZE) != 0 ||
+        record->address + SPI_FLASH_SECTOR_SIZE > flash_area->fa_size) {
+        LOG_ERR("Invalid patch record address: 0x%08x", record->address);
+        return -EINVAL;
+    }
+    if (crc32_ieee(record->data, SPI_FLASH_SECTOR_SIZE) != record->crc) {
+        LOG_ERR("Patch record CRC mismatch at 0x%08x", record->address);
+        return -EIO;
+    }
+
+    // Open files point into the table, keep LVGL away until the new table is loaded on close.
+    if (is_table && !full_fs_patch_file.table_written) {
+        zsw_display_control_set_render_enabled(false);
+        full_fs_patch_file.table_written = true;
+    }
+
+    rc = flash_area_erase(flash_area, record->address, SPI_FLASH_SECTOR_SIZE);
+    if (rc != 0) {
+        LOG_ERR("Failed to erase sector at 0x%08x: %d", record->address, rc);
+        return rc;
+    }
+    rc = flash_area_write(flash_area, record->address, record->data, SPI_FLASH_SECTOR_SIZE);
+    if (rc != 0) {
+        LOG_ERR("Failed to write sector at 0x%08x: %d", record->address, rc);
+        return rc;
+    }
+
+    return 0;
+}
+
+static ssize_t full_fs_patch_write(const void *ptr, size_t size)
+{
+    const uint8_t *src = ptr;
+    size_t remaining = size;
+    int rc;
+
+    if (full_fs_patch_file.error != 0) {
+        return full_fs_patch_file.error;
+    }
+
+    if (full_fs_patch_file.index < sizeof(full_fs_patch_header_t)) {
+        uint32_t chunk = MIN(remaining, sizeof(full_fs_patch_header_t) - full_fs_patch_file.index);
+
+        memcpy((uint8_t *)&full_fs_patch_file.header + full_fs_patch_file.index, src, chunk);
+        full_fs_patch_file.index += chunk;
+        src += chunk;
+        remaining -= chunk;
+
+        if (full_fs_patch_file.index == sizeof(full_fs_patch_header_t)) {
+            // No record has arrived yet, so its data buffer is free to use for reading the table.
+            rc = full_fs_patch_check_header(&full_fs_patch_file.header, full_fs_patch_file.record->data);
+            if (rc != 0) {
+                full_fs_patch_file.error = rc;
+                return rc;
+            }
+        }
+    }
+
+    while (remaining > 0) {
+        uint32_t chunk = MIN(remaining, sizeof(full_fs_patch_record_t) - full_fs_patch_file.record_len);
+
+        memcpy((uint8_t *)full_fs_patch_file.record + full_fs_patch_file.record_len, src, chunk);
+        full_fs_patch_file.record_len += chunk;
+        full_fs_patch_file.index += chunk;
+        src += chunk;
+        remaining -= chunk;
+
+        if (full_fs_patch_file.record_len == sizeof(full_fs_patch_record_t)) {
+            full_fs_patch_file.record_len = 0;
+            rc = full_fs_patch_apply(full_fs_patch_file.record);
+            if (rc != 0) {
+                full_fs_patch_file.error = rc;
+                return rc;
+            }
+        }
+    }
+
+    return size;
+}
+
+/* CRC32 of the uncompressed content of every file, against the CRCs after the file headers. */
+static int verify_files(void)
+{
+    int rc;
+    uint32_t crc_address = offsetof(file_table_t, file_headers) + file_table.num_files * sizeof(file_header_t);
+    uint32_t expected;
+    uint32_t crc;
+    uint32_t len;
+
+    // The read cache buffer is borrowed for uncompressed files.
+    if (current_cached_file) {
+        current_cached_file->is_cached = false;
+        current_cached_file = NULL;
+    }
+
+    for (int i = 0; i < file_table.num_files; i++) {
+        const file_header_t *file = &file_table.file_headers[i];
+
+        rc = flash_area_read(flash_area, crc_address + i * sizeof(uint32_t), &expected, sizeof(expected));
+        if (rc != 0) {
+            return rc;
+        }
+
+        crc = 0;
+        for (uint32_t pos = 0; pos < file->len; pos += len) {
+            if (file->flags & FILE_FLAG_LZ4) {
+                len = MIN(COMPRESSED_BLOCK_SIZE, file->len - pos);
+                rc = decode_block(file, pos / COMPRESSED_BLOCK_SIZE);
+                crc = crc32_ieee_update(crc, decoded_block, len);
+            } else {
+                len = MIN(sizeof(file_cache_buffer), file->len - pos);
+                rc = flash_area_read(flash_area, file_table.header_length + file->offset + pos, file_cache_buffer,
+                                     ROUND_UP(len, 4));
+                crc = crc32_ieee_update(crc, file_cache_buffer, len);
+            }
+            if (rc != 0) {
+                return rc;
+            }
+        }
+
+        if (crc != expected) {
+            LOG_ERR("CRC mismatch in %s after patching", (const char *)file->filename);
+            return -EIO;
+        }
+    }
+
+    return 0;
+}
+
+static int full_fs_patch_close(void)
+{
+    int rc = 0;
+
+    if (full_fs_patch_file.error != 0) {
+        rc = full_fs_patch_file.error;
+    } else if (full_fs_patch_file.index < sizeof(full_fs_patch_header_t)) {
+        LOG_ERR("Patch ended before its header");
+        rc = -EINVAL;
+    } else if (full_fs_patch_file.record_len != 0) {
+        LOG_ERR("Patch ended with a partial record of %d bytes", full_fs_patch_file.record_len);
+        rc = -EINVAL;
+    }
+
+    if (full_fs_patch_file.table_written) {
+        int load_rc;
+
+        // Prefetched pages belong to the old file table
+        zsw_filesystem_prefetch_release();
+        load_rc = load_file_table();
+
+        current_cached_file = NULL;
+        decoded_file = NULL;
+        if (load_rc == 0 && full_fs_file.len != 0) {
+            load_rc = verify_files();
+            if (load_rc != 0) {
+                // Don't let LVGL read a half patched image, it needs a full upload.
+                full_fs_file.len = 0;
+            }
+        }
+        lv_image_cache_drop(NULL);
+        zsw_display_control_set_render_enabled(true);
+        if (rc == 0) {
+            rc = load_rc;
+        }
+        LOG_INF("Raw FS patched, %d files: %d", file_table.num_files, load_rc);
+    }
+
+    k_free(full_fs_patch_file.record);
+    full_fs_patch_file.record = NULL;
+    full_fs_patch_file.opened = false;
+
+    return rc;
+}
+
 static bool lvgl_fs_ready(struct _lv_fs_drv_t *drv)
 {
     return true;
@@ -189,6 +567,7 @@ static void *lvgl_fs_open(struct _lv_fs_drv_t *drv, const char *path, lv_fs_mode
     }
 
     open_file->header = file;
+    open_file->prefetch = prefetch_find(file);
     open_file->index = 0;
 
     return open_file;
@@ -210,7 +589,7 @@ static int zsw_fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t m
     }
 
     if (IS_SPECIAL_FULL_FS_FILE_PATH(file_name_ptr)) {
-        if (full_fs_file.opened) {
+        if (full_fs_file.opened || full_fs_patch_file.opened) {
             return -EALREADY;
         }
         if (mode & FS_O_WRITE) {
@@ -235,6 +614,23 @@ static int zsw_fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t m
         full_fs_file.opened = true;
         full_fs_file.index = 0;
         zfp->filep = &full_fs_file;
+    } else if (IS_SPECIAL_FULL_FS_PATCH_FILE_PATH(file_name_ptr)) {
+        if (full_fs_patch_file.opened || full_fs_file.opened) {
+            return -EALREADY;
+        }
+        if (!(mode & FS_O_WRITE)) {
+            return -EACCES;
+        }
+        full_fs_patch_file.record = k_malloc(sizeof(full_fs_patch_record_t));
+        if (full_fs_patch_file.record == NULL) {
+            return -ENOMEM;
+        }
+        full_fs_patch_file.record_len = 0;
+        full_fs_patch_file.index = 0;
+        full_fs_patch_file.error = 0;
+        full_fs_patch_file.table_written = false;
+        full_fs_patch_file.opened = true;
+        zfp->filep = &full_fs_patch_file;
     } else {
         if (mode & FS_O_WRITE) {
             LOG_ERR("Write mode not supported for this file");
@@ -254,6 +650,7 @@ static lv_fs_res_t lvgl_fs_close(struct _lv_fs_drv_t *drv, void *file)
 {
     opened_file_t *open_file = (opened_file_t *)file;
     open_file->header = NULL;
+    open_file->prefetch = NULL;
     open_file->index = 0;
     open_file->is_cached = false;
     return errno_to_lv_fs_res(0);
@@ -277,12 +674,169 @@ static int zsw_fs_close(struct fs_file_t *zfp)
         full_fs_file.index = 0;
         zsw_display_control_set_render_enabled(true);
         return rc;
+    } else if (IS_SPECIAL_FULL_FS_PATCH_FILE(zfp->filep)) {
+        return full_fs_patch_close();
     } else {
         lvgl_fs_close(NULL, zfp->filep);
     }
     return 0;
 }
 
+static int lz4_decompress_block(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len)
+{
+    const uint8_t *ip = src;
+    const uint8_t *ip_end = src + src_len;
+    uint8_t *op = dst;
+    uint8_t *op_end = dst + dst_len;
+    const uint8_t *match;
+    uint32_t offset;
+    uint32_t len;
+    uint8_t token;
+    uint8_t b;
+
+    while (ip < ip_end) {
+        token = *ip++;
+
+        len = token >> 4;
+        if (len == 15) {
+            do {
+                if (ip >= ip_end) {
+                    return -EBADF;
+                }
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > (uint32_t)(ip_end - ip) || len > (uint32_t)(op_end - op)) {
+            return -EBADF;
+        }
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+
+        // The last sequence only has literals
+        if (ip >= ip_end) {
+            break;
+        }
+
+        if (ip_end - ip < 2) {
+            return -EBADF;
+        }
+        offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst)) {
+            return -EBADF;
+        }
+
+        len = token & 0x0F;
+        if (len == 15) {
+            do {
+                if (ip >= ip_end) {
+                    return -EBADF;
+                }
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (uint32_t)(op_end - op)) {
+            return -EBADF;
+        }
+
+        // Byte by byte as the match may overlap the output, that is how runs are encoded
+        match = op - offset;
+        while (len--) {
+            *op++ = *match++;
+        }
+    }
+
+    return op - dst;
+}
+
+static int decode_block(const file_header_t *file, uint32_t block)
+{
+    int rc;
+    uint32_t block_ends[2];
+    uint32_t num_blocks = DIV_ROUND_UP(file->len, COMPRESSED_BLOCK_SIZE);
+    uint32_t data_address = file_table.header_length + file->offset;
+    uint32_t block_len = MIN(COMPRESSED_BLOCK_SIZE, file->len - block * COMPRESSED_BLOCK_SIZE);
+    uint32_t block_start;
+    uint32_t stored_len;
+
+    if (decoded_file == file && decoded_block_index == block) {
+        return 0;
+    }
+
+    decoded_file = NULL;
+
+    rc = flash_area_read(flash_area, data_address + block * sizeof(uint32_t), block_ends, sizeof(block_ends));
+    if (rc != 0) {
+        return rc;
+    }
+
+    block_start = ROUND_UP(block_ends[0], 4);
+    stored_len = block_ends[1] - block_start;
+    if (block_ends[1] < block_start || stored_len > block_len) {
+        LOG_ERR("Corrupt block %u in %s", block, (const char *)file->filename);
+        return -EBADF;
+    }
+
+    // Block starts are 4 byte aligned, read lengths are rounded up for the QSPI flash.
+    data_address += (num_blocks + 1) * sizeof(uint32_t) + block_start;
+
+    if (stored_len == block_len) {
+        rc = flash_area_read(flash_area, data_address, decoded_block, ROUND_UP(block_len, 4));
+    } else {
+        // Borrow the read cache as input buffer
+        if (current_cached_file) {
+            current_cached_file->is_cached = false;
+            current_cached_file = NULL;
+        }
+        rc = flash_area_read(flash_area, data_address, file_cache_buffer, ROUND_UP(stored_len, 4));
+        if (rc == 0) {
+            rc = lz4_decompress_block(file_cache_buffer, stored_len, decoded_block, block_len);
+            rc = rc == block_len ? 0 : -EBADF;
+        }
+    }
+
+    if (rc != 0) {
+        LOG_ERR("Failed to decode block %u in %s: %d", block, (const char *)file->filename, rc);
+        return rc;
+    }
+
+    decoded_file = file;
+    decoded_block_index = block;
+
+    return 0;
+}
+
+static lv_fs_res_t compressed_read(opened_file_t *open_file, uint8_t *buf, uint32_t btr, uint32_t *br)
+{
+    int rc;
+    uint32_t block_offset;
+    uint32_t len;
+
+    *br = 0;
+
+    while (btr > 0) {
+        rc = decode_block(open_file->header, open_file->index / COMPRESSED_BLOCK_SIZE);
+        if (rc != 0) {
+            return errno_to_lv_fs_res(rc);
+        }
+
+        block_offset = open_file->index % COMPRESSED_BLOCK_SIZE;
+        len = MIN(btr, COMPRESSED_BLOCK_SIZE - block_offset);
+        memcpy(buf, decoded_block + block_offset, len);
+
+        buf += len;
+        btr -= len;
+        *br += len;
+        open_file->index += len;
+    }
+
+    return LV_FS_RES_OK;
+}
+
 static lv_fs_res_t lvgl_fs_read(struct _lv_fs_drv_t *drv, void *file, void *buf, uint32_t btr,
                                 uint32_t *br)
 {
@@ -299,6 +853,17 @@ static lv_fs_res_t lvgl_fs_read(struct _lv_fs_drv_t *drv, void *file, void *buf,
         return LV_FS_RES_OK;
     }
 
+    if (open_file->prefetch && open_file->index + btr <= open_file->prefetch->len) {
+        memcpy(buf, prefetch_page(open_file->prefetch) + open_file->index, btr);
+        *br = btr;
+        open_file->index += btr;
+        return LV_FS_RES_OK;
+    }
+
+    if (open_file->header->flags & FILE_FLAG_LZ4) {
+        return compressed_read(open_file, buf, btr, br);
+    }
+
     orig_read_address = open_file->header->offset + open_file->index + file_table.header_length;
 
     if (open_file->is_cached && (orig_read_address >= current_cached_file->cache_start) &&
@@ -363,7 +928,9 @@ static lv_fs_res_t lvgl_fs_read(struct _lv_fs_drv_t *drv, void *file, void *buf,
 static ssize_t zsw_fs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 {
     LOG_DBG("Reading %d bytes from file", size);
-    if (IS_SPECIAL_FULL_FS_FILE(zfp->filep)) {
+    if (IS_SPECIAL_FULL_FS_PATCH_FILE(zfp->filep)) {
+        return -EACCES;
+    } else if (IS_SPECIAL_FULL_FS_FILE(zfp->filep)) {
         int rc;
         if (full_fs_stream_active) {
             return -EBUSY;
@@ -420,6 +987,8 @@ static ssize_t zsw_fs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
         }
 
         return size;
+    } else if (IS_SPECIAL_FULL_FS_PATCH_FILE(zfp->filep)) {
+        return full_fs_patch_write(ptr, size);
     } else {
         return -ENOTSUP;
     }
@@ -451,7 +1020,13 @@ static int zsw_fs_seek(struct fs_file_t *zfp, off_t offset, int whence)
     int rc;
     LOG_DBG("Seeking %d bytes in file, whence: %d", (int)offset, whence);
 
-    if (IS_SPECIAL_FULL_FS_FILE(zfp->filep)) {
+    if (IS_SPECIAL_FULL_FS_PATCH_FILE(zfp->filep)) {
+        // Records are applied as they arrive, only sequential writes are possible.
+        if ((whence == FS_SEEK_SET && offset == full_fs_patch_file.index) || (whence == FS_SEEK_CUR && offset == 0)) {
+            return 0;
+        }
+        return -ENOTSUP;
+    } else if (IS_SPECIAL_FULL_FS_FILE(zfp->filep)) {
         if (full_fs_stream_active) {
             LOG_ERR("Seek not supported while streaming full_fs writes");
             return -ENOTSUP;
@@ -504,6 +1079,8 @@ static off_t zsw_fs_tell(struct fs_file_t *zfp)
 {
     if (IS_SPECIAL_FULL_FS_FILE(zfp->filep)) {
         return full_fs_file.index;
+    } else if (IS_SPECIAL_FULL_FS_PATCH_FILE(zfp->filep)) {
+        return full_fs_patch_file.index;
     } else {
         uint32_t pos;
         lvgl_fs_tell(NULL, zfp->filep, &pos);
@@ -549,6 +1126,11 @@ static int zsw_fs_stat(struct fs_mount_t *mountp,
         entry->size = full_fs_file.len;
         strncpy(entry->name, FULL_FS_SPECIAL_FILE_NAME, MAX_FILE_NAME_LEN);
         return 0;
+    } else if (IS_SPECIAL_FULL_FS_PATCH_FILE_PATH(file_name_ptr)) {
+        entry->type = FS_DIR_ENTRY_FILE;
+        entry->size = full_fs_patch_file.index;
+        strncpy(entry->name, FULL_FS_PATCH_SPECIAL_FILE_NAME, MAX_FILE_NAME_LEN);
+        return 0;
     } else {
         file_header_t *file = find_file(file_name_ptr);
         if (file) {
@@ -568,7 +1150,7 @@ static int zsw_fs_unlink(struct fs_mount_t *mountp, const char *path)
 
     LOG_DBG("unlink file %s", file_name_ptr);
 
-    if (IS_SPECIAL_FULL_FS_FILE_PATH(file_name_ptr)) {
+    if (IS_SPECIAL_FULL_FS_FILE_PATH(file_name_ptr) || IS_SPECIAL_FULL_FS_PATCH_FILE_PATH(file_name_ptr)) {
         return 0;
     } else {
         return -ENOTSUP;
@@ -585,11 +1167,118 @@ int zsw_filesytem_get_total_size(void)
     return file_table.total_length;
 }
 
+#if PREFETCH_NUM_SLOTS > 0
+static int prefetch_fill(prefetch_slot_t *slot, const file_header_t *file)
+{
+    int rc;
+    uint32_t len = MIN(file->len, CONFIG_ZSW_FS_PREFETCH_PAGE_SIZE);
+    uint32_t address = file_table.header_length + file->offset;
+    uint32_t read_address = ROUND_DOWN(address, 4);
+    uint8_t *page = prefetch_page(slot);
+
+    if (file->flags & FILE_FLAG_LZ4) {
+        rc = decode_block(file, 0);
+        if (rc == 0) {
+            memcpy(page, decoded_block, len);
+        }
+    } else {
+        // Borrow the read cache, the QSPI flash needs 4 byte aligned reads.
+        if (current_cached_file) {
+            current_cached_file->is_cached = false;
+            current_cached_file = NULL;
+        }
+        rc = flash_area_read(flash_area, read_address, file_cache_buffer, ROUND_UP(address + len, 4) - read_address);
+        if (rc == 0) {
+            memcpy(page, file_cache_buffer + (address - read_address), len);
+        }
+    }
+
+    if (rc != 0) {
+        LOG_ERR("Failed to prefetch %s: %d", (const char *)file->filename, rc);
+        return rc;
+    }
+
+    slot->file = file;
+    slot->len = len;
+    slot->generation = prefetch_generation;
+
+    return 0;
+}
+#endif
+
+void zsw_filesystem_prefetch_begin(void)
+{
+    prefetch_generation++;
+}
+
+int zsw_filesystem_prefetch_next(const char *prefix, uint32_t *cursor)
+{
+#if PREFETCH_NUM_SLOTS == 0
+    ARG_UNUSED(prefix);
+    ARG_UNUSED(cursor);
+
+    return -ENOTSUP;
+#else
+    int rc;
+    size_t prefix_len = strlen(prefix);
+    file_header_t *file;
+    prefetch_slot_t *slot;
+
+    if (file_table.magic != TABLE_HEADER_MAGIC || full_fs_file.len == 0) {
+        return -ENOENT;
+    }
+
+    if (prefetch_data == NULL) {
+        prefetch_data = k_malloc(PREFETCH_NUM_SLOTS * CONFIG_ZSW_FS_PREFETCH_PAGE_SIZE);
+        if (prefetch_data == NULL) {
+            return -ENOMEM;
+        }
+    }
+
+    for (; *cursor < file_table.num_files; (*cursor)++) {
+        file = &file_table.file_headers[*cursor];
+        if (strncmp(file->filename, prefix, prefix_len) != 0) {
+            continue;
+        }
+
+        slot = prefetch_find(file);
+        if (slot) {
+            // Already prefetched, keep it for this request
+            slot->generation = prefetch_generation;
+            continue;
+        }
+
+        slot = prefetch_alloc_slot();
+        if (slot == NULL) {
+            return -ENOSPC;
+        }
+
+        rc = prefetch_fill(slot, file);
+        (*cursor)++;
+
+        return rc;
+    }
+
+    return -ENOENT;
+#endif
+}
+
+void zsw_filesystem_prefetch_release(void)
+{
+    prefetch_detach(NULL);
+    memset(prefetch_slots, 0, sizeof(prefetch_slots));
+    prefetch_next_slot = 0;
+    k_free(prefetch_data);
+    prefetch_data = NULL;
+}
+
 int zsw_filesytem_erase(void)
 {
+    zsw_filesystem_prefetch_release();
     memset(opened_files, 0, sizeof(opened_files));
     memset(&file_table, 0, sizeof(file_table));
     current_cached_file = NULL;
+    decoded_file = NULL;
     full_fs_file.len = 0;
     full_fs_file.index = 0;
     full_fs_stream_active = false;
@@ -663,35 +1352,11 @@ static int zsw_decoder_init(void)
         return 0;
     }
 
-    rc = flash_area_read(flash_area, 0, &file_table, FILE_TABLE_MAX_LEN);
+    rc = load_file_table();
     if (rc != 0) {
-        printk("Flash read failed! %d\n", rc);
         return rc;
     }
 
-    // Fill in the special file that corresponds to the full image.
-    full_fs_file.opened = false;
-    full_fs_file.index = 0;
-    full_fs_file.len = file_table.total_length;
-
-    if (file_table.magic != TABLE_HEADER_MAGIC) {
-        LOG_ERR("Invalid file table magic: 0x%08x", file_table.magic);
-        full_fs_file.len = 0;
-    } else {
-        uint32_t trailer_magic;
-        uint32_t trailer_offset = file_table.total_length - sizeof(trailer_magic); // Last 4 bytes
-
-        rc = flash_area_read(flash_area, trailer_offset, &trailer_magic, sizeof(trailer_magic));
-        if (rc != 0) {
-            LOG_ERR("Failed to read trailer magic at offset %d: %d", trailer_offset, rc);
-            full_fs_file.len = 0;
-        } else if (trailer_magic != TABLE_HEADER_MAGIC) {
-            LOG_ERR("Invalid trailer magic at offset %d: 0x%08x, expected 0x%08x",
-                    trailer_offset, trailer_magic, TABLE_HEADER_MAGIC);
-            full_fs_file.len = 0;
-        }
-    }
-
     rc = fs_register(FS_TYPE_EXTERNAL_BASE, &zsw_fs);
 
     if (rc == 0) {
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #define ZSW_USER_LFS_MOUNT_POINT "/user"
 
 #define ZSW_USER_LFS_CACHE_SIZE  512
@@ -26,3 +28,23 @@ int zsw_filesytem_get_num_rawfs_files(void);
 int zsw_filesytem_get_total_size(void);
 
 int zsw_filesytem_erase(void);
+
+/** @brief Start a new prefetch request. Pages prefetched by earlier requests are kept, but are
+ *         the first to be replaced when the cache is full.
+*/
+void zsw_filesystem_prefetch_begin(void);
+
+/** @brief          Load the first CONFIG_ZSW_FS_PREFETCH_PAGE_SIZE bytes of the next raw FS file
+ *                  whose name starts with prefix. Reads of that range are then served from RAM,
+ *                  which covers LVGL reading the image header. Loads one file per call so the
+ *                  caller can spread the flash reads out.
+ *                  Must be called from the LVGL thread, the same as the file reads.
+ *  @param prefix   File name prefix, for example "face_goog_"
+ *  @param cursor   Position in the file table, start at 0
+ *  @return         0 when a file was loaded, -ENOENT when no files are left, -ENOSPC when the cache
+ *                  is full of pages for the current request, other negative error code on failure
+*/
+int zsw_filesystem_prefetch_next(const char *prefix, uint32_t *cursor);
+
+/** @brief Free all prefetched pages. */
+void zsw_filesystem_prefetch_release(void);
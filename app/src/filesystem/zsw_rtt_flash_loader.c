@@ -39,6 +39,8 @@ LOG_MODULE_REGISTER(zsw_rtt_flash_loader, LOG_LEVEL_DBG);
 #define TRANSFER_TIMEOUT_MS     5000
 
 #define START_LOAD_SEQUENCE "LOADER_START"
+// Like LOADER_START, but only the sectors that are sent are erased, used for delta updates.
+#define START_PATCH_SEQUENCE "PATCH_START"
 #define STOP_LOAD_SEQUENCE  "LOADER_END"
 #define DUMP_FLASH_SEQUENCE "DUMP_START"
 #define READ_DONE_SEQUENCE  "DUMP_END"
@@ -79,7 +81,7 @@ static uint8_t *data_buf;
 static uint8_t *up_buffer;
 static uint8_t *down_buffer;
 
-static int loader_write_flash(int partition_id, int buf_idx, uint8_t *buf, int len)
+static int loader_write_flash(int partition_id, int buf_idx, uint8_t *buf, int len, bool erase)
 {
     int rc;
     if (len != SPI_FLASH_SECTOR_SIZE) {
@@ -87,13 +89,13 @@ static int loader_write_flash(int partition_id, int buf_idx, uint8_t *buf, int l
         return -EINVAL;
     }
 
-#ifdef CONFIG_ERASE_PROGRESSIVELY
-    rc = flash_area_erase(flash_area, buf_idx * SPI_FLASH_SECTOR_SIZE, SPI_FLASH_SECTOR_SIZE);
-    if (rc != 0) {
-        printk("Flash erase failed! %d", rc);
-        return rc;
+    if (erase) {
+        rc = flash_area_erase(flash_area, buf_idx * SPI_FLASH_SECTOR_SIZE, SPI_FLASH_SECTOR_SIZE);
+        if (rc != 0) {
+            printk("Flash erase failed! %d", rc);
+            return rc;
+        }
     }
-#endif
 
     rc = flash_area_write(flash_area, buf_idx * SPI_FLASH_SECTOR_SIZE, buf, len);
     if (rc != 0) {
@@ -128,10 +130,11 @@ static int find_partition_id_from_label(char *label)
     return -ENODEV;
 }
 
-static bool check_start_sequence(uint8_t *buf, uint32_t len, int *partition_id)
+static bool check_start_sequence(uint8_t *buf, uint32_t len, int *partition_id, bool *patch)
 {
     char *partition_label;
-    if (strncmp(buf, START_LOAD_SEQUENCE, strlen(START_LOAD_SEQUENCE)) == 0) {
+    *patch = strncmp(buf, START_PATCH_SEQUENCE, strlen(START_PATCH_SEQUENCE)) == 0;
+    if (*patch || strncmp(buf, START_LOAD_SEQUENCE, strlen(START_LOAD_SEQUENCE)) == 0) {
         partition_label = strchr(buf, ':');
         if (partition_label) {
             *partition_id = find_partition_id_from_label(partition_label + 1);
@@ -170,7 +173,7 @@ static bool check_read_sequence(uint8_t *buf, uint32_t len, int *partition_id)
     return false;
 }
 
-static void rtt_load_flash_thread(void *partition_id_param, void *, void *)
+static void rtt_load_flash_thread(void *partition_id_param, void *patch_param, void *)
 {
     int ret;
     int len;
@@ -179,6 +182,8 @@ static void rtt_load_flash_thread(void *partition_id_param, void *, void *)
     int bytes_flashed = 0;
     struct rtt_rx_data_header *header;
     uint8_t partition_id = (uint8_t)((uint32_t)partition_id_param);
+    bool patch = (bool)patch_param;
+    bool erase_sector = patch || IS_ENABLED(CONFIG_ERASE_PROGRESSIVELY);
     uint32_t len_to_read;
     uint32_t last_activity_ms = k_uptime_get_32();
     uint32_t crc;
@@ -190,10 +195,11 @@ static void rtt_load_flash_thread(void *partition_id_param, void *, void *)
         return;
     }
 
-#ifndef CONFIG_ERASE_PROGRESSIVELY
-    ret = flash_area_erase(flash_area, 0, flash_area->fa_size);
-    LOG_WRN("Erasing flash area ... %d", ret);
-#endif
+    // A patch leaves all sectors that are not sent untouched.
+    if (!erase_sector) {
+        ret = flash_area_erase(flash_area, 0, flash_area->fa_size);
+        LOG_WRN("Erasing flash area ... %d", ret);
+    }
 
     while (1) {
         len_to_read = DATA_BUFFER_SIZE - buffer_index;
@@ -224,7 +230,8 @@ static void rtt_load_flash_thread(void *partition_id_param, void *, void *)
                 break;
             }
             ret = loader_write_flash((int)partition_id, header->address / SPI_FLASH_SECTOR_SIZE,
-                                     data_buf + sizeof(struct rtt_rx_data_header), DATA_BUFFER_SIZE - sizeof(struct rtt_rx_data_header));
+                                     data_buf + sizeof(struct rtt_rx_data_header), DATA_BUFFER_SIZE - sizeof(struct rtt_rx_data_header),
+                                     erase_sector);
             if (ret != 0) {
                 printk("loader_write_flash failed: %dn", ret);
                 break;
@@ -311,6 +318,7 @@ static void rtt_dump_flash_thread(void *partition_id_param, void *, void *)
 int zsw_rtt_flash_loader_start(void)
 {
     int partition_id;
+    bool patch;
 
     bootmode_clear();
 
@@ -336,10 +344,10 @@ int zsw_rtt_flash_loader_start(void)
             continue;
         }
 
-        if (check_start_sequence(data_buf, len, &partition_id)) {
+        if (check_start_sequence(data_buf, len, &partition_id, &patch)) {
             printk("Load sequence received: %s partition ID: %d\n", data_buf, partition_id);
             k_tid_t tid = k_thread_create(&rtt_work_thread, rtt_work_thread_stack, K_KERNEL_STACK_SIZEOF(rtt_work_thread_stack),
-                                          rtt_load_flash_thread, (void *)partition_id, NULL, NULL, CONFIG_NUM_COOP_PRIORITIES - 2, 0, K_NO_WAIT);
+                                          rtt_load_flash_thread, (void *)partition_id, (void *)patch, NULL, CONFIG_NUM_COOP_PRIORITIES - 2, 0, K_NO_WAIT);
             k_thread_join(tid, K_FOREVER);
             printk("Load thread done\n");
         } else if (check_read_sequence(data_buf, len, &partition_id)) {
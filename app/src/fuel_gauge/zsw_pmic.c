@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -28,10 +29,10 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/zbus/zbus.h>
 #include <events/activity_event.h>
-#include <events/zsw_periodic_event.h>
 #include <events/battery_event.h>
 #include "nrf_fuel_gauge.h"
 #include "zsw_pmic.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(zsw_pmic, LOG_LEVEL_WRN);
 
@@ -44,20 +45,19 @@ LOG_MODULE_REGISTER(zsw_pmic, LOG_LEVEL_WRN);
 #define NPM1300_CHG_STATUS_CV_MASK   BIT(4)
 
 static void zbus_activity_event_callback(const struct zbus_channel *chan);
-static void zbus_periodic_slow_10s_callback(const struct zbus_channel *chan);
+static void sample_work_handler(struct k_work *work);
 static int read_sensors(const struct device *charger, float *voltage, float *current, float *temp, int *status,
                         int *error);
 static int charge_status_inform(int32_t chg_status);
 
 ZBUS_CHAN_DECLARE(activity_state_data_chan);
-ZBUS_LISTENER_DEFINE(pmic_activity_state_event_lis, zbus_activity_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(pmic_activity_state_event_lis, zbus_activity_event_callback);
 ZBUS_CHAN_ADD_OBS(activity_state_data_chan, pmic_activity_state_event_lis, 1);
 
-ZBUS_CHAN_DECLARE(periodic_event_10s_chan);
-ZBUS_LISTENER_DEFINE(zsw_pmic_slow_lis, zbus_periodic_slow_10s_callback);
-
 ZBUS_CHAN_DECLARE(battery_sample_data_chan);
 
+K_WORK_DELAYABLE_DEFINE(sample_work, sample_work_handler);
+
 static const struct device *pmic = DEVICE_DT_GET(DT_NODELABEL(npm1300_pmic));
 static const struct device *charger = DEVICE_DT_GET(DT_NODELABEL(npm1300_charger));
 static const struct device *regulators = DEVICE_DT_GET(DT_NODELABEL(npm1300_regulators));
@@ -66,6 +66,9 @@ static float max_charge_current;
 static float term_charge_current;
 static int64_t ref_time;
 static bool vbus_connected;
+static bool vbus_limit_valid;
+static int vbus_limit_ma;
+static zsw_power_manager_state_t activity_state = ZSW_ACTIVITY_STATE_ACTIVE;
 
 static const struct battery_model battery_model = {
 #include "ld403533.inc"
@@ -73,29 +76,33 @@ static const struct battery_model battery_model = {
 
 static void zbus_activity_event_callback(const struct zbus_channel *chan)
 {
-    int ret;
-    float voltage;
-    float current;
-    float temp;
-    int status;
-    int error;
+    const struct activity_state_event *event = zbus_chan_const_msg(chan);
+    zsw_power_manager_state_t prev_state = activity_state;
 
-    ret = read_sensors(charger, &voltage, &current, &temp, &status, &error);
-    if (ret != 0) {
-        LOG_ERR("Error: Could not read from charger device\n");
-        return;
+    activity_state = event->state;
+
+    // Take a sample right away when leaving the idle state, the last one may be several minutes old.
+    if (prev_state == ZSW_ACTIVITY_STATE_NOT_WORN_STATIONARY && activity_state != prev_state) {
+        k_work_reschedule(&sample_work, K_NO_WAIT);
     }
-    const struct activity_state_event *event = zbus_chan_const_msg(chan);
-    switch (event->state) {
-        case ZSW_ACTIVITY_STATE_NOT_WORN_STATIONARY:
-            // TODO must be called in same contect as nrf_fuel_gauge_process
-            //nrf_fuel_gauge_idle_set(voltage, temp, ZSW_NOT_WORN_STATIONARY_CURRENT);
-            break;
-        case ZSW_ACTIVITY_STATE_ACTIVE:
-        case ZSW_ACTIVITY_STATE_INACTIVE:
-            // TODO resume
-            break;
+}
+
+/*
+ * Sample fast while the state of charge changes quickly (charging or heavy load),
+ * and very slowly when the watch is lying still and not worn.
+ */
+static uint32_t next_sample_interval_s(const struct battery_sample_event *sample)
+{
+    if (vbus_connected || sample->is_charging ||
+        fabsf(sample->avg_current) * 1000 >= CONFIG_ZSW_PMIC_FAST_DRAIN_CURRENT_MA) {
+        return CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_FAST_S;
+    }
+
+    if (activity_state == ZSW_ACTIVITY_STATE_NOT_WORN_STATIONARY) {
+        return CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_IDLE_S;
     }
+
+    return CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_S;
 }
 
 const char *zsw_pmic_charger_status_str(int status)
@@ -193,20 +200,35 @@ static int charge_status_inform(int32_t chg_status)
                                            &state_info);
 }
 
-static void zbus_periodic_slow_10s_callback(const struct zbus_channel *chan)
+static void sample_work_handler(struct k_work *work)
 {
     int ret;
+    uint32_t interval_s;
     struct battery_sample_event evt;
 
     ret = zsw_pmic_get_full_state(&evt);
     if (ret < 0) {
         LOG_ERR("Error: Could not read from charger device\n");
+        k_work_schedule(&sample_work, K_SECONDS(CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_S));
         return;
     }
 
     zbus_chan_pub(&battery_sample_data_chan, &evt, K_MSEC(50));
 
     check_battery_voltage_cutoff(evt.mV);
+
+    interval_s = next_sample_interval_s(&evt);
+    // Until the next sample the model assumes the not worn current, called from the same work
+    // item as nrf_fuel_gauge_process() as the library requires.
+    if (activity_state == ZSW_ACTIVITY_STATE_NOT_WORN_STATIONARY &&
+        interval_s == CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_IDLE_S) {
+        ret = nrf_fuel_gauge_idle_set(evt.mV / 1000.f, evt.temperature, ZSW_NOT_WORN_STATIONARY_CURRENT);
+        if (ret < 0) {
+            LOG_WRN("Could not set fuel gauge idle: %d", ret);
+        }
+    }
+
+    k_work_schedule(&sample_work, K_SECONDS(interval_s));
 }
 
 static int read_sensors(const struct device *charger, float *voltage, float *current, float *temp, int *status,
@@ -284,6 +306,12 @@ static void event_callback(const struct device *dev, struct gpio_callback *cb, u
     if (BIT(NPM13XX_EVENT_CHG_ERROR) & pins) {
         LOG_ERR("Charging error\n");
     }
+    if ((BIT(NPM13XX_EVENT_VBUS_DETECTED) | BIT(NPM13XX_EVENT_VBUS_REMOVED)) & pins) {
+        // VBUS current limit only changes on plug/unplug, re-read it with the next sample.
+        vbus_limit_valid = false;
+    }
+    // Charging state changed, sample now and let the sampler pick the new interval.
+    k_work_reschedule(&sample_work, K_NO_WAIT);
 }
 
 int zsw_pmic_get_full_state(struct battery_sample_event *sample)
@@ -301,17 +329,20 @@ int zsw_pmic_get_full_state(struct battery_sample_event *sample)
     float delta;
     int32_t chg_status;
     struct sensor_value vbus_val;
-    int vbus_ma = 0;
 
+    // All measurements and charger status/error come from one sample fetch.
     ret = read_sensors(charger, &voltage, &current, &temp, &chg_status, &error);
     if (ret < 0) {
         LOG_ERR("Error: Could not read from charger device\n");
         return ret;
     }
 
-    ret = sensor_attr_get(charger, SENSOR_CHAN_CURRENT, SENSOR_ATTR_UPPER_THRESH, &vbus_val);
-    if (ret == 0) {
-        vbus_ma = (vbus_val.val1 * 1000) + (vbus_val.val2 / 1000);
+    if (!vbus_limit_valid) {
+        ret = sensor_attr_get(charger, SENSOR_CHAN_CURRENT, SENSOR_ATTR_UPPER_THRESH, &vbus_val);
+        if (ret == 0) {
+            vbus_limit_ma = (vbus_val.val1 * 1000) + (vbus_val.val2 / 1000);
+            vbus_limit_valid = true;
+        }
     }
 
     ret = nrf_fuel_gauge_ext_state_update(
@@ -341,7 +372,7 @@ int zsw_pmic_get_full_state(struct battery_sample_event *sample)
 
     LOG_DBG("V: %.3f, I: %.3f, T: %.2f, ", voltage, current, temp);
     LOG_DBG("SoC: %.2f, TTE: %.0f, TTF: %.0f\n", soc, tte, ttf);
-    LOG_DBG("Status: %d, Error: %d, VBUS: %d mA\n", chg_status, error, vbus_ma);
+    LOG_DBG("Status: %d, Error: %d, VBUS: %d mA\n", chg_status, error, vbus_limit_ma);
 
     sample->mV = voltage * 1000;
     sample->percent = soc;
@@ -351,7 +382,7 @@ int zsw_pmic_get_full_state(struct battery_sample_event *sample)
     sample->ttf = ttf;
     sample->status = chg_status;
     sample->error = error;
-    sample->vbus_current_limit_ma = vbus_ma;
+    sample->vbus_current_limit_ma = vbus_limit_ma;
     sample->is_charging = is_charging_from_status(chg_status);
     sample->pmic_data_valid = true;
 
@@ -408,19 +439,20 @@ static int zsw_pmic_init(void)
     }
 
     vbus_connected = (val.val1 != 0) || (val.val2 != 0);
-
-    zsw_periodic_chan_add_obs(&periodic_event_10s_chan, &zsw_pmic_slow_lis);
+    vbus_limit_ma = (val.val1 * 1000) + (val.val2 / 1000);
+    vbus_limit_valid = true;
 
     struct battery_sample_event evt;
     ret = zsw_pmic_get_full_state(&evt);
     if (ret == 0) {
         zbus_chan_pub(&battery_sample_data_chan, &evt, K_MSEC(50));
+        check_battery_voltage_cutoff(evt.mV);
+        k_work_schedule(&sample_work, K_SECONDS(next_sample_interval_s(&evt)));
     } else {
         LOG_ERR("Error: Could not publish inital battery data.\n");
+        k_work_schedule(&sample_work, K_SECONDS(CONFIG_ZSW_PMIC_SAMPLE_INTERVAL_S));
     }
 
-    check_battery_voltage_cutoff(evt.mV);
-
     return 0;
 }
 
@@ -1,5449 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SNOOPY
-#define LV_ATTRIBUTE_IMG_SNOOPY
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SNOOPY uint8_t snoopy_map[] = {
-    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x4a, 0x00, 0x36, 0x00, 0xf7, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x08, 0x07, 0x09, 0x0c, 0x0c, 0x0c, 0x0f, 
-    0x0e, 0x11, 0x14, 0x14, 0x14, 0x16, 0x16, 0x19, 0x1b, 0x1b, 0x1c, 0x1d, 0x1c, 
-    0x24, 0x22, 0x22, 0x23, 0x26, 0x26, 0x2c, 0x27, 0x26, 0x31, 0x2a, 0x28, 0x34, 
-    0x2b, 0x2b, 0x2c, 0x30, 0x2e, 0x3a, 0x33, 0x33, 0x33, 0x36, 0x35, 0x42, 0x39, 
-    0x37, 0x44, 0x3c, 0x3c, 0x3c, 0x3f, 0x3d, 0x4a, 0x3f, 0x3f, 0x40, 0x43, 0x43, 
-    0x43, 0x44, 0x43, 0x4f, 0x45, 0x43, 0x51, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x59, 
-    0x4e, 0x4d, 0x53, 0x52, 0x4d, 0x5c, 0x53, 0x53, 0x54, 0x56, 0x55, 0x62, 0x56, 
-    0x55, 0x6c, 0x59, 0x59, 0x6e, 0x5a, 0x44, 0x50, 0x5a, 0x54, 0x63, 0x5b, 0x5b, 
-    0x5c, 0x5c, 0x5c, 0x72, 0x5d, 0x5d, 0x60, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 
-    0x65, 0x65, 0x79, 0x67, 0x67, 0x6a, 0x69, 0x25, 0x27, 0x6a, 0x6a, 0x7d, 0x6b, 
-    0x6b, 0x6c, 0x6c, 0x2a, 0x2c, 0x6d, 0x2e, 0x30, 0x6e, 0x6e, 0x81, 0x70, 0x26, 
-    0x28, 0x70, 0x66, 0x75, 0x72, 0x27, 0x27, 0x72, 0x29, 0x29, 0x72, 0x6d, 0x7a, 
-    0x72, 0x71, 0x7c, 0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x75, 0x31, 0x32, 0x76, 
-    0x39, 0x3a, 0x76, 0x76, 0x88, 0x78, 0x77, 0x77, 0x79, 0x3b, 0x3b, 0x7a, 0x31, 
-    0x31, 0x7b, 0x7b, 0x8d, 0x7c, 0x2c, 0x2c, 0x7c, 0x43, 0x43, 0x7c, 0x7c, 0x7c, 
-    0x7f, 0x7f, 0x90, 0x80, 0x46, 0x46, 0x80, 0x4d, 0x4e, 0x83, 0x2b, 0x2c, 0x83, 
-    0x82, 0x8d, 0x83, 0x83, 0x93, 0x84, 0x51, 0x52, 0x84, 0x84, 0x84, 0x88, 0x7c, 
-    0x87, 0x88, 0x88, 0x97, 0x89, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x5d, 0x5d, 
-    0x8b, 0x8b, 0x8c, 0x8c, 0x6d, 0x6f, 0x8c, 0x8c, 0x9b, 0x8d, 0x76, 0x7c, 0x8e, 
-    0x62, 0x62, 0x90, 0x2f, 0x2f, 0x90, 0x7e, 0x86, 0x90, 0x8f, 0x90, 0x90, 0x90, 
-    0x9f, 0x91, 0x69, 0x68, 0x94, 0x32, 0x32, 0x94, 0x94, 0x94, 0x95, 0x95, 0xa3, 
-    0x99, 0x99, 0xa6, 0x9a, 0x34, 0x34, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0xaa, 0xa1, 
-    0xa1, 0xad, 0xa3, 0xa3, 0xa4, 0xa4, 0x82, 0x82, 0xa6, 0xa6, 0xb1, 0xaa, 0xaa, 
-    0xb5, 0xab, 0xab, 0xac, 0xad, 0x9e, 0xa3, 0xae, 0xae, 0xb9, 0xb3, 0xb3, 0xb4, 
-    0xb3, 0xb3, 0xbd, 0xb7, 0xb7, 0xc1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 0xbf, 
-    0xa8, 0xa8, 0xc1, 0xab, 0xab, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcb, 0xc5, 0xb1, 
-    0xb1, 0xc9, 0xb5, 0xb5, 0xca, 0xca, 0xcc, 0xcc, 0xba, 0xba, 0xcc, 0xcc, 0xd2, 
-    0xd0, 0xbf, 0xbf, 0xd2, 0xd2, 0xd5, 0xd4, 0xc4, 0xc4, 0xd4, 0xd4, 0xda, 0xd7, 
-    0xca, 0xca, 0xda, 0xda, 0xdd, 0xdb, 0xce, 0xce, 0xdd, 0xdd, 0xe2, 0xe2, 0xe2, 
-    0xe5, 0xe6, 0xe6, 0xe9, 0xeb, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf3, 0xf3, 0xf4, 
-    0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xff, 0xff, 0xff, 0x6a, 0x6a, 0x7e, 0x0b, 
-    0x0b, 0x0b, 0xb7, 0xb7, 0xc0, 0xbf, 0xbf, 0xc8, 0x83, 0x83, 0x94, 0x76, 0x76, 
-    0x89, 0xa5, 0xa5, 0xb1, 0xf8, 0xf6, 0xf6, 0xa3, 0xa3, 0xa3, 0xcc, 0xcc, 0xd3, 
-    0x8b, 0x2d, 0x2e, 0x8c, 0x8c, 0x8c, 0xf2, 0xed, 0xed, 0xf4, 0xf3, 0xf4, 0x94, 
-    0x94, 0xa2, 0x8e, 0x30, 0x31, 0x1b, 0x1b, 0x1b, 0x64, 0x64, 0x64, 0x93, 0x93, 
-    0x94, 0x7a, 0x7a, 0x7b, 0x91, 0x65, 0x65, 0x6c, 0x6c, 0x6d, 0x75, 0x27, 0x28, 
-    0xd5, 0xd5, 0xda, 0x59, 0x59, 0x6f, 0x72, 0x2a, 0x2a, 0x54, 0x54, 0x54, 0xb3, 
-    0xb3, 0xbc, 0x2a, 0x29, 0x33, 0x7b, 0x7b, 0x8c, 0xa1, 0xa1, 0xae, 0x82, 0x82, 
-    0x82, 0xbc, 0xbc, 0xc4, 0x99, 0x34, 0x34, 0x3b, 0x3b, 0x3c, 0xb3, 0xb3, 0xb3, 
-    0x31, 0x2f, 0x3c, 0x9c, 0x9b, 0x9c, 0x56, 0x56, 0x6d, 0x33, 0x33, 0x34, 0x73, 
-    0x73, 0x85, 0x50, 0x4f, 0x5b, 0x8b, 0x5c, 0x5c, 0x9c, 0x74, 0x74, 0x84, 0x2b, 
-    0x2b, 0xa1, 0x7d, 0x7d, 0xe4, 0xda, 0xda, 0x2f, 0x2d, 0x3a, 0x82, 0x4d, 0x4d, 
-    0x9a, 0x9a, 0xa5, 0x88, 0x56, 0x56, 0xac, 0xac, 0xac, 0x27, 0x25, 0x30, 0x0f, 
-    0x0f, 0x12, 0x3e, 0x3e, 0x42, 0x54, 0x54, 0x5f, 0x60, 0x5e, 0x69, 0x65, 0x64, 
-    0x6c, 0x75, 0x75, 0x7a, 0x1d, 0x1c, 0x25, 0x20, 0x1f, 0x20, 0x24, 0x23, 0x2a, 
-    0x5e, 0x33, 0x39, 0x65, 0x2b, 0x2d, 0x6d, 0x2b, 0x2b, 0x72, 0x26, 0x26, 0x7b, 
-    0x27, 0x28, 0x7c, 0x2a, 0x2b, 0x79, 0x30, 0x2f, 0x60, 0x30, 0x36, 0x6d, 0x32, 
-    0x32, 0x6f, 0x3c, 0x3e, 0x74, 0x34, 0x34, 0x7a, 0x35, 0x35, 0x74, 0x39, 0x39, 
-    0x79, 0x3d, 0x3d, 0x38, 0x36, 0x43, 0x40, 0x3f, 0x40, 0x72, 0x3f, 0x40, 0x45, 
-    0x45, 0x49, 0x47, 0x45, 0x53, 0x48, 0x46, 0x55, 0x4e, 0x4c, 0x58, 0x7a, 0x42, 
-    0x42, 0x77, 0x49, 0x4b, 0x7e, 0x4a, 0x4a, 0x59, 0x53, 0x66, 0x5e, 0x5e, 0x65, 
-    0x6e, 0x6d, 0x73, 0x91, 0x2f, 0x30, 0x82, 0x52, 0x52, 0x8e, 0x60, 0x60, 0x94, 
-    0x6b, 0x6b, 0x9f, 0x7b, 0x7b, 0x7e, 0x7d, 0x84, 0x9a, 0x92, 0x9b, 0xa5, 0x83, 
-    0x83, 0xa4, 0x88, 0x8a, 0xab, 0x8a, 0x8a, 0xaf, 0x92, 0x92, 0xb6, 0x9c, 0x9b, 
-    0xb8, 0x9c, 0x9c, 0xbc, 0xa3, 0xa3, 0xbc, 0xb4, 0xba, 0xc2, 0xad, 0xad, 0xc6, 
-    0xb1, 0xb1, 0xc9, 0xb6, 0xb6, 0xce, 0xbd, 0xbc, 0xc8, 0xc7, 0xc8, 0xd2, 0xc2, 
-    0xc2, 0xd7, 0xc8, 0xc8, 0xda, 0xcd, 0xcc, 0xd2, 0xd2, 0xd6, 0xdf, 0xd4, 0xd3, 
-    0xda, 0xda, 0xde, 0xe3, 0xd8, 0xd7, 0xea, 0xe2, 0xe2, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45, 0x32, 
-    0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xfe, 0x29, 0x47, 0x49, 0x46, 
-    0x20, 0x72, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
-    0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x65, 0x7a, 0x67, 0x69, 
-    0x66, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x72, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x00, 
-    0x21, 0xf9, 0x04, 0x05, 0x21, 0x00, 0x85, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 
-    0x4a, 0x00, 0x36, 0x00, 0x00, 0x08, 0xff, 0x00, 0x0b, 0x09, 0x1c, 0x48, 0xb0, 
-    0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 
-    0x23, 0x4a, 0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 
-    0xb1, 0xa3, 0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 
-    0x28, 0x39, 0x4a, 0x48, 0xb9, 0xf1, 0x14, 0x2b, 0x82, 0x1a, 0x5a, 0x29, 0xe9, 
-    0xd1, 0x8a, 0x65, 0xc5, 0x95, 0x02, 0x41, 0xe9, 0x09, 0xa4, 0x87, 0x10, 0xa1, 
-    0x40, 0xf7, 0x10, 0x89, 0xb2, 0x39, 0xd1, 0x08, 0x27, 0x9f, 0x48, 0x93, 0x06, 
-    0x2a, 0x45, 0x34, 0xe2, 0xd1, 0xa4, 0x50, 0x7d, 0xea, 0x81, 0xd2, 0xb4, 0xe1, 
-    0x9b, 0xa8, 0x58, 0x09, 0xdd, 0xab, 0xba, 0x10, 0x4d, 0xd6, 0xac, 0xf1, 0xb8, 
-    0x1e, 0x14, 0x55, 0x4a, 0xd2, 0x57, 0xac, 0x83, 0xc4, 0x10, 0x0d, 0x02, 0xea, 
-    0x8d, 0xa3, 0x7a, 0x70, 0xeb, 0xd9, 0xe9, 0xe3, 0x27, 0x6a, 0xa0, 0x40, 0x67, 
-    0xf9, 0xb0, 0xd4, 0x39, 0x08, 0xed, 0x3d, 0x9f, 0x7d, 0x93, 0xf2, 0x39, 0x4b, 
-    0x08, 0xd4, 0xc9, 0x49, 0x3d, 0xb3, 0xf6, 0xf9, 0x4b, 0x88, 0x8c, 0x1a, 0x42, 
-    0x76, 0x00, 0x49, 0xfd, 0xca, 0xa8, 0x4b, 0x28, 0x93, 0x5e, 0x24, 0x67, 0x0d, 
-    0x04, 0x88, 0x31, 0x35, 0x37, 0x84, 0x3e, 0x9d, 0x91, 0x6a, 0x36, 0x2a, 0x23, 
-    0x1b, 0x00, 0x00, 0x34, 0x20, 0x39, 0xe9, 0xcf, 0xd9, 0x41, 0x7f, 0x06, 0x0f, 
-    0x02, 0x82, 0x57, 0xc4, 0x68, 0x42, 0x7a, 0xea, 0x46, 0xbd, 0x94, 0x1a, 0xc0, 
-    0x00, 0x92, 0x4f, 0x5f, 0x0b, 0x62, 0x94, 0x54, 0x8f, 0x6b, 0xad, 0x83, 0xa1, 
-    0xca, 0x09, 0xd0, 0x1b, 0x80, 0x02, 0x91, 0x62, 0x08, 0x13, 0x06, 0xd4, 0xe7, 
-    0xcf, 0x71, 0xa4, 0x8c, 0x30, 0x34, 0x07, 0x50, 0x49, 0x64, 0x70, 0xa5, 0x74, 
-    0xdc, 0xc8, 0xff, 0xe9, 0x23, 0x1d, 0x2b, 0xaa, 0xed, 0x00, 0x0a, 0x84, 0xec, 
-    0x51, 0x3a, 0xa9, 0x9d, 0x06, 0xcd, 0x71, 0x95, 0x4f, 0x2a, 0x49, 0x02, 0x7a, 
-    0x03, 0x21, 0xc7, 0x60, 0xc5, 0xb4, 0x1d, 0xc8, 0x7c, 0xa4, 0x6a, 0xa0, 0x07, 
-    0x40, 0x00, 0x21, 0x95, 0x82, 0x95, 0x1c, 0x14, 0xa4, 0x26, 0x80, 0x08, 0x76, 
-    0xfc, 0xe7, 0x13, 0x0a, 0x02, 0x02, 0x10, 0xd2, 0x55, 0x59, 0x01, 0x02, 0x08, 
-    0x71, 0x0e, 0x12, 0xe2, 0xc7, 0x00, 0x11, 0x56, 0x00, 0x12, 0x22, 0x19, 0x96, 
-    0xe7, 0x46, 0x84, 0x12, 0x82, 0x64, 0x46, 0x88, 0xd2, 0x65, 0x11, 0x21, 0x81, 
-    0x20, 0x19, 0xd1, 0x1e, 0x8a, 0x58, 0x99, 0x10, 0xa1, 0x7a, 0x21, 0xc9, 0x01, 
-    0xe3, 0x57, 0xf0, 0x09, 0x48, 0x63, 0x48, 0xc9, 0xdd, 0x48, 0xdf, 0x01, 0x11, 
-    0x26, 0x40, 0x92, 0x1c, 0x78, 0xf9, 0xe8, 0x53, 0x20, 0x06, 0x08, 0xa8, 0x8b, 
-    0x49, 0xa2, 0xac, 0x51, 0x4f, 0x1f, 0x82, 0xdc, 0xc8, 0x47, 0x92, 0xe8, 0x09, 
-    0x99, 0x52, 0x0d, 0x50, 0x98, 0x81, 0x88, 0x1d, 0xf5, 0xf0, 0xf1, 0x47, 0x94, 
-    0x67, 0xf5, 0x61, 0x58, 0x02, 0xe8, 0x1d, 0x20, 0xd6, 0x40, 0x2e, 0x6c, 0xf1, 
-    0xc6, 0x75, 0x48, 0x01, 0x62, 0x98, 0x40, 0x95, 0x6c, 0xb7, 0xda, 0x99, 0x05, 
-    0x29, 0xd1, 0x23, 0x21, 0x80, 0x4c, 0x52, 0x90, 0x2e, 0xa9, 0x11, 0xf0, 0x1c, 
-    0x9d, 0x06, 0x81, 0x92, 0x14, 0x22, 0x07, 0x3d, 0x20, 0x0c, 0xa0, 0x08, 0x4d, 
-    0x92, 0x94, 0x12, 0x88, 0x3e, 0x74, 0x84, 0x38, 0x75, 0xc0, 0x03, 0xcf, 0x3b, 
-    0x47, 0x34, 0xea, 0xd0, 0x12, 0x94, 0x30, 0xa1, 0xa9, 0xa6, 0x44, 0x58, 0xca, 
-    0x50, 0x23, 0xb3, 0xe0, 0x23, 0x2a, 0x3e, 0x65, 0x78, 0xca, 0x90, 0x6e, 0x48, 
-    0xd9, 0x61, 0xaa, 0x42, 0x14, 0x26, 0xe5, 0xc7, 0xaa, 0x08, 0x89, 0x39, 0x11, 
-    0xd8, 0x1f, 0x81, 0x11, 0x42, 0x15, 0xac, 0x04, 0x29, 0x71, 0x5d, 0x62, 0x3e, 
-    0x1d, 0x82, 0x2b, 0x41, 0xdf, 0xe1, 0x91, 0x94, 0x0e, 0xbf, 0xe6, 0x04, 0x95, 
-    0xb0, 0x3e, 0xfd, 0x61, 0x40, 0x08, 0xbf, 0x1a, 0xc1, 0x26, 0x21, 0x4f, 0x09, 
-    0x12, 0x0f, 0x00, 0x0e, 0xfc, 0x0a, 0x22, 0x54, 0x89, 0x49, 0xf2, 0x06, 0x00, 
-    0x97, 0x8d, 0x14, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x00, 0x00, 
-    0x2c, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x33, 0x00, 0x00, 0x02, 0x35, 0x84, 
-    0x8f, 0xa9, 0xcb, 0xed, 0x0f, 0xa3, 0x9c, 0xb4, 0xda, 0x8b, 0xb3, 0xde, 0xbc, 
-    0xfb, 0x0f, 0x86, 0xe2, 0x48, 0x96, 0xe6, 0x89, 0xa6, 0xea, 0xca, 0xb6, 0xee, 
-    0x0b, 0xc7, 0xf2, 0x4c, 0xd7, 0xf6, 0x8d, 0xe7, 0xfa, 0xce, 0xf7, 0xfe, 0x0f, 
-    0x0c, 0x0a, 0x87, 0xc4, 0xa2, 0xf1, 0x88, 0x4c, 0x2a, 0x97, 0x4c, 0x4e, 0x01, 
-    0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x87, 0x00, 0x2c, 0x0a, 0x00, 0x0c, 
-    0x00, 0x2a, 0x00, 0x2a, 0x00, 0x87, 0x00, 0x00, 0x00, 0x07, 0x07, 0x09, 0x08, 
-    0x07, 0x09, 0x0b, 0x0b, 0x0b, 0x0e, 0x0d, 0x10, 0x13, 0x13, 0x14, 0x16, 0x14, 
-    0x1a, 0x1b, 0x1b, 0x1b, 0x1e, 0x1d, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x2b, 
-    0x27, 0x25, 0x30, 0x2a, 0x29, 0x33, 0x2b, 0x2b, 0x2b, 0x33, 0x33, 0x33, 0x35, 
-    0x35, 0x3b, 0x36, 0x35, 0x42, 0x38, 0x36, 0x44, 0x3b, 0x3b, 0x3c, 0x3d, 0x3c, 
-    0x49, 0x3d, 0x3d, 0x41, 0x44, 0x44, 0x44, 0x46, 0x44, 0x51, 0x48, 0x47, 0x48, 
-    0x4a, 0x4a, 0x5a, 0x4b, 0x4b, 0x54, 0x4c, 0x4c, 0x4c, 0x54, 0x53, 0x63, 0x54, 
-    0x54, 0x54, 0x56, 0x56, 0x6d, 0x57, 0x57, 0x58, 0x59, 0x58, 0x65, 0x59, 0x59, 
-    0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x5d, 0x2f, 0x34, 0x5d, 0x3f, 0x49, 
-    0x5f, 0x34, 0x3b, 0x60, 0x30, 0x34, 0x61, 0x61, 0x76, 0x63, 0x63, 0x64, 0x65, 
-    0x64, 0x69, 0x65, 0x65, 0x7a, 0x69, 0x69, 0x7d, 0x6b, 0x6b, 0x6b, 0x6d, 0x41, 
-    0x45, 0x6d, 0x6c, 0x72, 0x6e, 0x6e, 0x81, 0x6f, 0x3d, 0x40, 0x70, 0x6f, 0x82, 
-    0x71, 0x2f, 0x30, 0x72, 0x72, 0x73, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 0x74, 
-    0x31, 0x31, 0x76, 0x3c, 0x3d, 0x76, 0x76, 0x79, 0x76, 0x76, 0x88, 0x77, 0x26, 
-    0x27, 0x78, 0x27, 0x28, 0x79, 0x27, 0x27, 0x79, 0x33, 0x33, 0x7a, 0x3d, 0x3e, 
-    0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x8c, 0x7c, 0x2f, 0x30, 0x7c, 0x46, 0x46, 0x7e, 
-    0x2a, 0x2a, 0x7e, 0x53, 0x56, 0x7f, 0x49, 0x49, 0x7f, 0x7f, 0x90, 0x80, 0x7f, 
-    0x90, 0x82, 0x2a, 0x2b, 0x82, 0x4d, 0x4d, 0x82, 0x51, 0x4f, 0x83, 0x83, 0x94, 
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x89, 0x85, 0x53, 0x53, 0x88, 0x57, 0x57, 0x88, 
-    0x88, 0x97, 0x8b, 0x2f, 0x30, 0x8b, 0x5b, 0x5b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 
-    0x9b, 0x8c, 0x2d, 0x2d, 0x8e, 0x30, 0x31, 0x8f, 0x62, 0x62, 0x90, 0x90, 0x9f, 
-    0x92, 0x2f, 0x2f, 0x92, 0x64, 0x64, 0x92, 0x92, 0x93, 0x93, 0x32, 0x33, 0x94, 
-    0x94, 0xa2, 0x95, 0x6a, 0x6a, 0x99, 0x6e, 0x6f, 0x99, 0x99, 0xa6, 0x9b, 0x35, 
-    0x35, 0x9c, 0x74, 0x73, 0x9c, 0x7c, 0x7e, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0xaa, 
-    0xa2, 0xa2, 0xae, 0xa3, 0x80, 0x7f, 0xa4, 0x82, 0x82, 0xa4, 0xa4, 0xa4, 0xa5, 
-    0xa5, 0xb1, 0xaa, 0xaa, 0xb5, 0xac, 0xac, 0xac, 0xae, 0xae, 0xb9, 0xaf, 0x90, 
-    0x90, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xbd, 0xb7, 0xb7, 0xc0, 0xbc, 0xbc, 0xbd, 
-    0xbc, 0xbc, 0xc5, 0xbf, 0xbf, 0xc8, 0xc4, 0xc4, 0xcb, 0xc5, 0xc5, 0xc5, 0xc8, 
-    0xc7, 0xcf, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 
-    0xda, 0xda, 0xda, 0xdd, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe5, 0xe6, 0xe6, 0xe9, 
-    0xeb, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf1, 0xec, 0xec, 0xf4, 0xf3, 0xf4, 0xf7, 
-    0xf7, 0xf8, 0xf8, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x0f, 0x09, 0x1c, 
-    0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x3c, 0x58, 0x41, 0x20, 0x16, 
-    0x32, 0x74, 0xfe, 0xfc, 0xe9, 0xa3, 0x67, 0x8e, 0x91, 0x85, 0x18, 0x0d, 0x52, 
-    0x38, 0x94, 0x23, 0x8f, 0x21, 0x43, 0x79, 0x0a, 0x7d, 0xfc, 0x48, 0x28, 0x0f, 
-    0x95, 0x8c, 0x28, 0x05, 0xee, 0x19, 0x69, 0x88, 0x10, 0xcb, 0x8f, 0x81, 0xd4, 
-    0xa4, 0xc4, 0x58, 0xe7, 0xa5, 0x4d, 0x92, 0x6b, 0x66, 0x26, 0x84, 0x73, 0xb3, 
-    0xe7, 0x20, 0x30, 0x3a, 0x0d, 0xc2, 0x71, 0xd9, 0xf3, 0x66, 0x9f, 0x99, 0x39, 
-    0x68, 0xc4, 0x88, 0xb1, 0xa4, 0x0d, 0x9f, 0x40, 0x36, 0x89, 0x16, 0xa5, 0xb3, 
-    0xb0, 0x8d, 0x1e, 0x3f, 0x83, 0xa4, 0x7e, 0xec, 0x73, 0x13, 0x90, 0x56, 0x9b, 
-    0x81, 0xa0, 0x20, 0x6c, 0xf3, 0xa7, 0x27, 0x21, 0x3e, 0x2e, 0x03, 0x7d, 0xe5, 
-    0xea, 0x93, 0x4c, 0x43, 0x83, 0x1e, 0x7b, 0xfe, 0x19, 0xe4, 0xa7, 0x65, 0x08, 
-    0x3c, 0x84, 0x9a, 0x00, 0xfa, 0xc8, 0xc7, 0x27, 0x0a, 0x00, 0x00, 0x1e, 0x14, 
-    0xd4, 0x53, 0xd4, 0x90, 0x1f, 0x40, 0x83, 0x0c, 0xfd, 0x69, 0x00, 0x08, 0x10, 
-    0x00, 0x3c, 0x1f, 0xf7, 0xec, 0xb5, 0xc9, 0x04, 0x30, 0x80, 0x03, 0x04, 0xe9, 
-    0x14, 0x6e, 0x49, 0xf7, 0x63, 0x62, 0x43, 0x69, 0xca, 0x1a, 0xda, 0x53, 0xf7, 
-    0xa5, 0x1c, 0xcb, 0x00, 0x02, 0x0c, 0x04, 0xf3, 0x75, 0xf3, 0xcb, 0xb3, 0x9d, 
-    0x59, 0x06, 0x7a, 0x80, 0x1a, 0x40, 0x02, 0x81, 0x71, 0x5d, 0xf7, 0x84, 0x0a, 
-    0xf5, 0x65, 0x9a, 0xda, 0xb6, 0x39, 0x7e, 0x96, 0x9d, 0x26, 0x04, 0x05, 0x14, 
-    0x64, 0x7a, 0xeb, 0x86, 0xd9, 0x00, 0x78, 0x81, 0x43, 0x6d, 0x6e, 0xce, 0xa8, 
-    0xcd, 0x66, 0xf9, 0xc8, 0x37, 0xc0, 0x01, 0x3c, 0xbf, 0x73, 0x33, 0x44, 0x6d, 
-    0x39, 0xd6, 0x3f, 0x7a, 0xf5, 0x07, 0x3e, 0xe0, 0x50, 0x6e, 0x96, 0x80, 0xde, 
-    0x90, 0x21, 0xf3, 0x86, 0x70, 0x78, 0x3f, 0x01, 0xb2, 0xab, 0x3e, 0x1f, 0xbe, 
-    0xf0, 0x69, 0xf9, 0xe6, 0xeb, 0xeb, 0xde, 0x92, 0x1d, 0x40, 0x79, 0x9e, 0xfa, 
-    0x6d, 0x36, 0x9e, 0x73, 0x87, 0x18, 0xa1, 0x5c, 0x80, 0x37, 0x35, 0x97, 0x1d, 
-    0x66, 0x87, 0xcc, 0x81, 0xa0, 0x4f, 0x07, 0xf4, 0xd7, 0xc0, 0x40, 0x75, 0xb4, 
-    0x86, 0xe0, 0x20, 0x11, 0x12, 0x48, 0x50, 0x19, 0x7a, 0x0c, 0xf7, 0xe0, 0x20, 
-    0x08, 0x64, 0x37, 0xa1, 0x41, 0x31, 0x98, 0x41, 0x87, 0x1e, 0xa4, 0x1d, 0xe8, 
-    0x5a, 0x49, 0x54, 0x64, 0x88, 0x9a, 0x01, 0x29, 0xe5, 0xd0, 0xc5, 0x1a, 0x73, 
-    0xd4, 0xa1, 0x87, 0x68, 0x36, 0x99, 0x24, 0x90, 0x8b, 0x80, 0xdd, 0x16, 0x14, 
-    0x41, 0x6d, 0x78, 0x48, 0x48, 0x1b, 0x04, 0x55, 0x20, 0x80, 0x65, 0x08, 0xfc, 
-    0x68, 0x90, 0x66, 0x23, 0xe5, 0x61, 0x90, 0x03, 0x04, 0x24, 0xe0, 0x80, 0x92, 
-    0x06, 0x75, 0xc1, 0x92, 0x4c, 0x54, 0xa2, 0xb4, 0x85, 0x20, 0x80, 0x48, 0x34, 
-    0x43, 0x96, 0x19, 0x45, 0x61, 0x45, 0x15, 0x55, 0x58, 0x61, 0x26, 0x12, 0x60, 
-    0x2e, 0x24, 0xc5, 0x1b, 0x6c, 0xb0, 0xf1, 0xc6, 0x1b, 0x5f, 0x38, 0x91, 0xa6, 
-    0x42, 0xee, 0x8d, 0x74, 0xc7, 0x9c, 0x09, 0x45, 0xf7, 0xd2, 0x1f, 0x78, 0x1e, 
-    0xd4, 0xc5, 0x67, 0x83, 0x0c, 0x07, 0x54, 0x9f, 0x03, 0x2d, 0x51, 0x9a, 0x21, 
-    0x6c, 0x7d, 0x54, 0x07, 0xa1, 0x03, 0xd5, 0x39, 0x1a, 0x4b, 0x64, 0x30, 0xba, 
-    0xd0, 0x20, 0x28, 0x6c, 0xd4, 0x27, 0x14, 0x81, 0x20, 0x64, 0x08, 0x1f, 0x0d, 
-    0x30, 0x40, 0xe8, 0x9d, 0x05, 0xed, 0x21, 0x10, 0x21, 0x7b, 0x1c, 0x90, 0x64, 
-    0x46, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x3b, 0x00, 0x2c, 
-    0x0a, 0x00, 0x0c, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x85, 0x0a, 0x0a, 0x0a, 0x13, 
-    0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x27, 0x27, 0x28, 0x2c, 0x2c, 0x2c, 0x2f, 0x2f, 
-    0x30, 0x33, 0x33, 0x34, 0x35, 0x34, 0x38, 0x3b, 0x3b, 0x3c, 0x3f, 0x3f, 0x40, 
-    0x44, 0x44, 0x44, 0x48, 0x47, 0x48, 0x4a, 0x49, 0x56, 0x4b, 0x4b, 0x4b, 0x53, 
-    0x53, 0x53, 0x56, 0x55, 0x6b, 0x57, 0x55, 0x62, 0x57, 0x57, 0x58, 0x59, 0x58, 
-    0x65, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 
-    0x63, 0x63, 0x64, 0x63, 0x63, 0x6a, 0x65, 0x65, 0x7a, 0x6a, 0x68, 0x74, 0x6a, 
-    0x6a, 0x7d, 0x6b, 0x6b, 0x6b, 0x6e, 0x6e, 0x81, 0x72, 0x72, 0x85, 0x73, 0x73, 
-    0x73, 0x74, 0x31, 0x31, 0x76, 0x76, 0x88, 0x7a, 0x3d, 0x3e, 0x7a, 0x46, 0x46, 
-    0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x8c, 0x7f, 0x61, 0x66, 0x7f, 0x7f, 0x90, 0x80, 
-    0x51, 0x4f, 0x81, 0x4b, 0x4b, 0x81, 0x80, 0x89, 0x83, 0x83, 0x93, 0x84, 0x84, 
-    0x84, 0x88, 0x88, 0x97, 0x8a, 0x5c, 0x5c, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x9b, 
-    0x8f, 0x63, 0x63, 0x90, 0x90, 0x9f, 0x94, 0x6a, 0x6a, 0x95, 0x95, 0xa3, 0x9b, 
-    0x73, 0x72, 0x9d, 0x9d, 0xaa, 0xa2, 0xa2, 0xad, 0xa4, 0x81, 0x81, 0xa5, 0xa5, 
-    0xb1, 0xb2, 0xb2, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6f, 0xc0, 0x9d, 0x70, 0x48, 0x2c, 
-    0x1a, 0x8f, 0xc8, 0xa4, 0x72, 0xc9, 0x6c, 0x32, 0x13, 0xce, 0xa8, 0x74, 0x4a, 
-    0xad, 0x5a, 0xaf, 0xd8, 0x6c, 0xb5, 0xb3, 0xd2, 0x7a, 0xa3, 0xdd, 0xaf, 0x58, 
-    0x49, 0x19, 0x37, 0x0b, 0x55, 0x81, 0x79, 0x5d, 0x3d, 0xb0, 0xc7, 0x14, 0xe8, 
-    0xbb, 0xf8, 0x99, 0x23, 0xcb, 0xf6, 0xbc, 0x7e, 0xcf, 0x4f, 0xe2, 0x8d, 0x01, 
-    0x6f, 0x04, 0x48, 0x6a, 0x6c, 0x85, 0x46, 0x83, 0x7d, 0x76, 0x87, 0x44, 0x89, 
-    0x45, 0x1e, 0x37, 0x5a, 0x8c, 0x55, 0x34, 0x53, 0x93, 0x5a, 0x3a, 0x4b, 0x72, 
-    0x42, 0x97, 0x6c, 0x6e, 0x63, 0x95, 0x8a, 0xa2, 0xa3, 0x26, 0x45, 0x35, 0xa3, 
-    0xa8, 0x6f, 0xa1, 0xa9, 0xac, 0x6f, 0x99, 0x7e, 0x66, 0x30, 0xad, 0x47, 0x9d, 
-    0x48, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x01, 0x00, 0x2c, 0x09, 
-    0x00, 0x0e, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x00, 0x08, 0xff, 0x00, 0x03, 0x08, 
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x56, 0xd6, 0xbc, 0x79, 0x83, 0xc8, 0x8b, 
-    0xa8, 0x83, 0x10, 0x23, 0x46, 0x2c, 0xe5, 0x87, 0x90, 0xc5, 0x8b, 0x80, 0xe8, 
-    0x4c, 0x92, 0xc8, 0x31, 0x22, 0xa7, 0x8b, 0x20, 0x2f, 0x0a, 0x2a, 0xd5, 0xb1, 
-    0xe4, 0x40, 0x3a, 0x21, 0x53, 0x5a, 0xac, 0x67, 0xb2, 0xa3, 0x19, 0x95, 0x30, 
-    0xe9, 0xb4, 0x8c, 0x08, 0x05, 0x10, 0x21, 0x9b, 0x30, 0x43, 0xae, 0x99, 0x69, 
-    0x50, 0x89, 0x1e, 0x3d, 0x6e, 0x00, 0xf5, 0xe9, 0x93, 0x53, 0xa4, 0x2d, 0x9e, 
-    0x02, 0x6b, 0xa0, 0xf9, 0x13, 0x52, 0x4f, 0xbc, 0x8a, 0x45, 0xed, 0x74, 0x0c, 
-    0x82, 0x46, 0x0e, 0x1e, 0x4e, 0x7c, 0xfc, 0x08, 0x22, 0xd4, 0x67, 0x50, 0x4a, 
-    0xaf, 0x39, 0xe5, 0xb0, 0x4a, 0x10, 0x51, 0x8c, 0x1e, 0xb0, 0x17, 0xbd, 0xd6, 
-    0x83, 0xd9, 0x15, 0xa6, 0x9d, 0x02, 0x00, 0x00, 0x08, 0xeb, 0xb9, 0x56, 0x65, 
-    0x1f, 0x3e, 0x5b, 0x03, 0x49, 0x4a, 0xa9, 0x47, 0x25, 0xa0, 0x0a, 0x71, 0x01, 
-    0x18, 0x28, 0x68, 0x85, 0xa8, 0xca, 0x41, 0x7d, 0xfa, 0x12, 0x0a, 0xa4, 0x07, 
-    0x10, 0x20, 0x3b, 0x8a, 0xf1, 0x04, 0x4a, 0xa9, 0x2a, 0x70, 0x5c, 0x56, 0x04, 
-    0xf9, 0x14, 0x0d, 0x24, 0x08, 0xaa, 0xca, 0x7a, 0x7e, 0xd0, 0x12, 0xf2, 0x53, 
-    0xc9, 0x32, 0x80, 0x60, 0x03, 0xe5, 0x14, 0x5d, 0x2d, 0xf4, 0x8f, 0xe1, 0x8b, 
-    0x8d, 0x4c, 0x03, 0x28, 0x20, 0xd0, 0xca, 0xd6, 0xd5, 0xab, 0x45, 0x13, 0x92, 
-    0xf4, 0x40, 0xb6, 0x2e, 0x81, 0xaa, 0x53, 0x0a, 0xb2, 0xa3, 0x46, 0x0d, 0x1d, 
-    0xdd, 0xb8, 0xe5, 0xc8, 0x8e, 0xdb, 0x20, 0xc0, 0xeb, 0x8b, 0x7c, 0xa8, 0x59, 
-    0xee, 0x82, 0x3b, 0xe4, 0xa5, 0xe5, 0x00, 0x58, 0x89, 0x42, 0xee, 0xc4, 0x34, 
-    0x90, 0xea, 0x20, 0x31, 0x60, 0xe9, 0xaf, 0xe4, 0x45, 0xa5, 0x9b, 0x60, 0x71, 
-    0x1f, 0x38, 0x79, 0x8e, 0x1b, 0x90, 0x2e, 0xec, 0x03, 0xc6, 0xc0, 0x64, 0xf4, 
-    0x07, 0x27, 0xf8, 0x8b, 0x7a, 0xb0, 0x03, 0x20, 0xf0, 0xe5, 0xfe, 0x7d, 0x3b, 
-    0xfa, 0x25, 0x90, 0x08, 0x72, 0xfe, 0xa9, 0xa4, 0x1c, 0x76, 0xcd, 0xb1, 0x57, 
-    0xa0, 0x81, 0xd8, 0x11, 0x20, 0x10, 0x22, 0x0b, 0xae, 0xc6, 0xc9, 0x78, 0x03, 
-    0x69, 0x16, 0x21, 0x5b, 0xcb, 0x09, 0x80, 0x99, 0x40, 0x50, 0x28, 0x76, 0x21, 
-    0x48, 0x9c, 0x58, 0x61, 0x80, 0x6c, 0x64, 0x15, 0xb4, 0x08, 0x1d, 0x7d, 0x30, 
-    0x72, 0xa1, 0x1f, 0x63, 0x08, 0xa4, 0x80, 0x69, 0x25, 0x42, 0xe4, 0x42, 0x10, 
-    0x5e, 0x8c, 0x01, 0x4a, 0x29, 0x74, 0xbc, 0x21, 0x87, 0x1c, 0x8e, 0x38, 0xe2, 
-    0x19, 0x48, 0x78, 0x14, 0xf4, 0xde, 0x7e, 0xcd, 0x21, 0x55, 0xd0, 0x17, 0x4c, 
-    0x5d, 0xd4, 0xc7, 0x41, 0x0f, 0x3c, 0x60, 0x24, 0x44, 0x2f, 0x5d, 0xf4, 0xc6, 
-    0x93, 0x33, 0x05, 0x81, 0x96, 0x18, 0x54, 0x9a, 0x54, 0xcb, 0x11, 0xe9, 0xa0, 
-    0x73, 0xce, 0x39, 0x47, 0x08, 0x91, 0x65, 0x47, 0x4b, 0x94, 0x19, 0x8b, 0x99, 
-    0x44, 0x8c, 0xc9, 0x91, 0x16, 0x7f, 0x48, 0xc2, 0x88, 0x57, 0x72, 0xa8, 0x29, 
-    0x91, 0x12, 0x3f, 0x12, 0x72, 0x8f, 0x9c, 0x10, 0x15, 0xa6, 0xe4, 0x45, 0x5f, 
-    0xe0, 0x59, 0x90, 0x17, 0x49, 0x5a, 0x64, 0x21, 0x57, 0x7e, 0x0e, 0xb4, 0xc8, 
-    0x64, 0x17, 0xfd, 0x11, 0x68, 0x20, 0x11, 0x14, 0xba, 0x85, 0x7d, 0x16, 0x9d, 
-    0x65, 0x11, 0x20, 0x7e, 0xd0, 0x86, 0x67, 0x10, 0x0a, 0xe2, 0x81, 0x9f, 0x1f, 
-    0x00, 0x40, 0xd0, 0x51, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x38, 
-    0x00, 0x2c, 0x09, 0x00, 0x0e, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x85, 0x0e, 0x0e, 
-    0x0e, 0x14, 0x14, 0x14, 0x1c, 0x1c, 0x1c, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 
-    0x34, 0x34, 0x34, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x42, 0x41, 0x40, 0x4c, 0x43, 
-    0x43, 0x43, 0x48, 0x47, 0x54, 0x4a, 0x4a, 0x4b, 0x53, 0x53, 0x54, 0x54, 0x54, 
-    0x5f, 0x57, 0x57, 0x6d, 0x59, 0x59, 0x6f, 0x5a, 0x5a, 0x5b, 0x5c, 0x5c, 0x72, 
-    0x60, 0x5e, 0x69, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 0x64, 0x6c, 0x65, 
-    0x65, 0x79, 0x6a, 0x6a, 0x7e, 0x6d, 0x6c, 0x74, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 
-    0x81, 0x6f, 0x55, 0x5f, 0x71, 0x32, 0x32, 0x72, 0x72, 0x72, 0x73, 0x73, 0x85, 
-    0x75, 0x75, 0x7a, 0x76, 0x76, 0x89, 0x79, 0x3e, 0x3e, 0x79, 0x41, 0x42, 0x7a, 
-    0x36, 0x36, 0x7b, 0x7b, 0x8c, 0x7e, 0x7d, 0x86, 0x7f, 0x7f, 0x90, 0x81, 0x81, 
-    0x81, 0x82, 0x4e, 0x4e, 0x83, 0x83, 0x94, 0x88, 0x88, 0x97, 0x8a, 0x5c, 0x5c, 
-    0x8c, 0x8c, 0x9b, 0x90, 0x90, 0x9f, 0x91, 0x66, 0x66, 0x93, 0x6a, 0x6a, 0x94, 
-    0x94, 0xa2, 0x99, 0x99, 0xa6, 0x9d, 0x9d, 0xaa, 0xa4, 0x83, 0x83, 0xab, 0x8b, 
-    0x8a, 0xab, 0xaa, 0xb5, 0xaf, 0xaf, 0xb9, 0xb0, 0xb0, 0xba, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x54, 0x40, 0x9c, 0x70, 
-    0x48, 0x2c, 0x1a, 0x8f, 0x42, 0x10, 0x72, 0xc9, 0x6c, 0x3a, 0x9f, 0xd0, 0xa8, 
-    0x74, 0x4a, 0xad, 0x5a, 0xaf, 0xd8, 0xac, 0x76, 0xcb, 0xad, 0x16, 0x06, 0xdd, 
-    0xb0, 0x78, 0xfc, 0x2c, 0x90, 0x99, 0xe0, 0xb3, 0x7a, 0x1a, 0x58, 0x23, 0xcd, 
-    0xc8, 0x05, 0x19, 0x3e, 0x96, 0xbb, 0xef, 0x56, 0x00, 0x7e, 0x8f, 0x24, 0xf0, 
-    0x71, 0x7a, 0x7f, 0x82, 0x38, 0x06, 0x7f, 0x69, 0x7b, 0x87, 0x4c, 0x35, 0x37, 
-    0x83, 0x8d, 0x48, 0x36, 0x8e, 0x91, 0x92, 0x93, 0x5b, 0x2c, 0x94, 0x97, 0x98, 
-    0x99, 0x6b, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0xb6, 0x00, 0x2c, 
-    0x0c, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x29, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 
-    0x0b, 0x0b, 0x0e, 0x0e, 0x11, 0x13, 0x13, 0x13, 0x16, 0x15, 0x1b, 0x1b, 0x1b, 
-    0x1c, 0x1e, 0x1d, 0x22, 0x20, 0x1e, 0x28, 0x24, 0x24, 0x24, 0x25, 0x24, 0x2b, 
-    0x2b, 0x29, 0x35, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x32, 0x30, 0x2e, 0x3a, 0x32, 
-    0x32, 0x33, 0x36, 0x35, 0x42, 0x39, 0x37, 0x45, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 
-    0x49, 0x43, 0x43, 0x43, 0x44, 0x3d, 0x4a, 0x44, 0x43, 0x4f, 0x45, 0x45, 0x53, 
-    0x46, 0x22, 0x1d, 0x47, 0x25, 0x20, 0x4a, 0x29, 0x25, 0x4b, 0x23, 0x1d, 0x4b, 
-    0x2a, 0x26, 0x4b, 0x4b, 0x4c, 0x4c, 0x45, 0x5a, 0x4c, 0x4c, 0x53, 0x4d, 0x42, 
-    0x53, 0x4d, 0x4a, 0x5d, 0x4e, 0x3e, 0x4c, 0x4e, 0x40, 0x4f, 0x4e, 0x4b, 0x62, 
-    0x4f, 0x30, 0x2c, 0x50, 0x3c, 0x49, 0x50, 0x4e, 0x65, 0x51, 0x25, 0x1f, 0x51, 
-    0x3b, 0x45, 0x53, 0x26, 0x20, 0x53, 0x52, 0x65, 0x53, 0x53, 0x53, 0x54, 0x36, 
-    0x3c, 0x55, 0x33, 0x32, 0x55, 0x38, 0x39, 0x55, 0x55, 0x6c, 0x56, 0x2e, 0x2a, 
-    0x56, 0x31, 0x2f, 0x57, 0x28, 0x21, 0x58, 0x2d, 0x2a, 0x58, 0x58, 0x6e, 0x59, 
-    0x40, 0x40, 0x59, 0x58, 0x6f, 0x5a, 0x29, 0x22, 0x5a, 0x3d, 0x39, 0x5c, 0x5c, 
-    0x5d, 0x5c, 0x5c, 0x72, 0x5d, 0x41, 0x3d, 0x5d, 0x50, 0x5a, 0x5e, 0x3c, 0x45, 
-    0x5f, 0x60, 0x75, 0x61, 0x46, 0x42, 0x61, 0x61, 0x76, 0x62, 0x29, 0x2b, 0x63, 
-    0x49, 0x46, 0x63, 0x63, 0x64, 0x64, 0x64, 0x6a, 0x65, 0x65, 0x79, 0x67, 0x4c, 
-    0x49, 0x67, 0x68, 0x7c, 0x68, 0x3b, 0x3f, 0x69, 0x4f, 0x4c, 0x6a, 0x69, 0x75, 
-    0x6a, 0x6a, 0x7e, 0x6b, 0x6b, 0x6b, 0x6c, 0x32, 0x33, 0x6d, 0x52, 0x4f, 0x6d, 
-    0x56, 0x55, 0x6d, 0x6d, 0x81, 0x6f, 0x25, 0x25, 0x70, 0x57, 0x53, 0x71, 0x58, 
-    0x56, 0x71, 0x6f, 0x81, 0x72, 0x73, 0x85, 0x73, 0x27, 0x28, 0x73, 0x4d, 0x53, 
-    0x73, 0x73, 0x73, 0x74, 0x25, 0x25, 0x74, 0x2c, 0x2c, 0x75, 0x37, 0x36, 0x76, 
-    0x3c, 0x3d, 0x76, 0x5d, 0x5a, 0x76, 0x76, 0x89, 0x77, 0x72, 0x7e, 0x79, 0x60, 
-    0x5d, 0x7a, 0x26, 0x27, 0x7b, 0x32, 0x32, 0x7b, 0x45, 0x45, 0x7b, 0x7b, 0x8d, 
-    0x7c, 0x27, 0x28, 0x7c, 0x66, 0x63, 0x7c, 0x7b, 0x81, 0x7c, 0x7c, 0x7c, 0x7e, 
-    0x45, 0x46, 0x7f, 0x2a, 0x2b, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x83, 0x2a, 
-    0x2b, 0x83, 0x6c, 0x6b, 0x83, 0x6c, 0x73, 0x83, 0x83, 0x8a, 0x83, 0x83, 0x94, 
-    0x84, 0x4d, 0x4d, 0x84, 0x52, 0x53, 0x84, 0x84, 0x84, 0x85, 0x58, 0x58, 0x86, 
-    0x4f, 0x50, 0x87, 0x87, 0x98, 0x89, 0x55, 0x55, 0x89, 0x89, 0x96, 0x8b, 0x2d, 
-    0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x5b, 0x5b, 0x8c, 0x75, 0x74, 0x8c, 0x8c, 0x8c, 
-    0x8c, 0x8c, 0x9b, 0x8e, 0x62, 0x62, 0x8f, 0x30, 0x31, 0x8f, 0x60, 0x5f, 0x90, 
-    0x2f, 0x2f, 0x91, 0x91, 0x9e, 0x92, 0x2f, 0x30, 0x92, 0x31, 0x32, 0x92, 0x65, 
-    0x65, 0x94, 0x94, 0xa3, 0x95, 0x95, 0x95, 0x96, 0x6b, 0x6b, 0x97, 0x77, 0x77, 
-    0x98, 0x83, 0x81, 0x98, 0x97, 0x98, 0x99, 0x99, 0xa6, 0x9a, 0x73, 0x73, 0x9b, 
-    0x35, 0x35, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0xaa, 0xa1, 0x7e, 0x7e, 0xa2, 0xa2, 
-    0xae, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xb1, 0xa7, 0xa8, 0xb3, 0xa9, 0x88, 0x88, 
-    0xaa, 0xaa, 0xb6, 0xad, 0xad, 0xad, 0xae, 0xae, 0xb9, 0xb0, 0x99, 0x9b, 0xb0, 
-    0xaf, 0xba, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xbd, 0xb7, 0xb7, 0xc0, 0xbb, 0xbb, 
-    0xbc, 0xbc, 0xbc, 0xc5, 0xbf, 0xbf, 0xc8, 0xc4, 0xc4, 0xc5, 0xc4, 0xc4, 0xcc, 
-    0xcb, 0xcb, 0xcd, 0xcc, 0xcc, 0xd3, 0xd2, 0xd2, 0xd5, 0xd4, 0xd4, 0xda, 0xda, 
-    0xda, 0xdd, 0xdd, 0xdd, 0xe2, 0xe3, 0xe3, 0xe5, 0xe6, 0xe6, 0xe9, 0xeb, 0xeb, 
-    0xed, 0xee, 0xe8, 0xe7, 0xee, 0xee, 0xf0, 0xf2, 0xed, 0xed, 0xf4, 0xf3, 0xf4, 
-    0xf7, 0xf7, 0xf8, 0xf8, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 
-    0x6d, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x88, 0x3e, 0x81, 0xca, 0xb4, 
-    0xe6, 0xa0, 0xc3, 0x87, 0x0e, 0x4b, 0xb9, 0xaa, 0x45, 0x91, 0x22, 0xab, 0x52, 
-    0x77, 0x20, 0x6a, 0x34, 0xe8, 0x88, 0x55, 0xc5, 0x8f, 0x14, 0x61, 0x7d, 0xda, 
-    0x48, 0xd2, 0x96, 0x47, 0x54, 0xae, 0x66, 0xb5, 0x02, 0x49, 0xb1, 0x94, 0x46, 
-    0x36, 0xa2, 0x4a, 0x95, 0x02, 0x95, 0xd1, 0xa0, 0xaa, 0x59, 0xaa, 0x3c, 0xd6, 
-    0x12, 0xc5, 0x92, 0xa2, 0x28, 0x87, 0x8e, 0x52, 0xcd, 0x02, 0xd9, 0xea, 0x94, 
-    0x25, 0x28, 0xb6, 0x1c, 0xad, 0xaa, 0x35, 0x0b, 0xd6, 0xd0, 0x5a, 0xac, 0x52, 
-    0xf5, 0x9c, 0xe5, 0xc8, 0x20, 0xa8, 0xa7, 0x3d, 0x6b, 0xc9, 0x82, 0x05, 0x4b, 
-    0x56, 0x2a, 0x55, 0x13, 0x34, 0xd5, 0x5a, 0x2a, 0x2b, 0x2b, 0xaa, 0x82, 0x99, 
-    0xb0, 0x66, 0xd5, 0xca, 0xaa, 0x95, 0x2b, 0x58, 0x95, 0x5c, 0x85, 0x02, 0x50, 
-    0x4a, 0xed, 0x47, 0x59, 0x71, 0x06, 0xe6, 0x81, 0xc5, 0x32, 0xaa, 0x4e, 0x8a, 
-    0xaa, 0x6a, 0x75, 0xad, 0x88, 0x4a, 0x13, 0xac, 0xbf, 0x2c, 0xfd, 0x0c, 0x2c, 
-    0x05, 0x72, 0x16, 0x16, 0x00, 0x90, 0x39, 0x90, 0xa2, 0xd8, 0xca, 0x2e, 0x60, 
-    0x95, 0x2c, 0x67, 0xf9, 0x09, 0x30, 0xc1, 0x56, 0x15, 0xbe, 0x1f, 0x59, 0x41, 
-    0x1e, 0x8d, 0xa0, 0x6c, 0xd6, 0x59, 0xa8, 0x11, 0x53, 0x6c, 0x04, 0xb9, 0x80, 
-    0xad, 0x4d, 0x3d, 0x2b, 0x19, 0x18, 0x8d, 0xc6, 0xf2, 0xc7, 0x59, 0xa8, 0x58, 
-    0xce, 0x85, 0x3c, 0xc0, 0x16, 0xe3, 0x9e, 0xb4, 0x56, 0xa9, 0x5a, 0xb9, 0xb6, 
-    0x96, 0xab, 0x89, 0x20, 0x59, 0x25, 0x18, 0x0d, 0xc0, 0xd6, 0xa9, 0xe2, 0xd0, 
-    0x8b, 0x3f, 0x66, 0x9e, 0x20, 0x77, 0xf4, 0xeb, 0x1f, 0x49, 0x31, 0x87, 0x8c, 
-    0xc0, 0x14, 0xf6, 0xef, 0xb3, 0x56, 0x6c, 0xff, 0x07, 0x30, 0xe0, 0xd2, 0xf7, 
-    0x8a, 0x38, 0x51, 0xa9, 0xa6, 0xa8, 0x7d, 0x7c, 0xf3, 0xc0, 0xd8, 0x67, 0x99, 
-    0x5a, 0x23, 0xe4, 0xc6, 0x8c, 0x37, 0xc8, 0x2b, 0xa2, 0x71, 0xdf, 0x9c, 0xd0, 
-    0xfa, 0x9e, 0xab, 0x54, 0x65, 0xcb, 0x13, 0x32, 0xdc, 0x70, 0x83, 0x19, 0x58, 
-    0xc1, 0x52, 0x00, 0x7f, 0x03, 0x99, 0x62, 0x1b, 0x65, 0xa0, 0x14, 0x04, 0x83, 
-    0x81, 0x37, 0xf0, 0x44, 0x91, 0x29, 0xfc, 0x09, 0x40, 0x50, 0x1c, 0xa3, 0xa8, 
-    0x77, 0x5c, 0x54, 0xa6, 0x58, 0x72, 0x10, 0x0e, 0x14, 0xa2, 0x51, 0x51, 0x25, 
-    0xfc, 0x19, 0x50, 0xd2, 0x41, 0x33, 0x50, 0xd8, 0xc3, 0x53, 0xd3, 0x8d, 0x87, 
-    0xc0, 0x8a, 0x06, 0x15, 0x68, 0x60, 0x0d, 0x4f, 0x4d, 0xc0, 0x20, 0x8d, 0x04, 
-    0x91, 0x48, 0xe1, 0x19, 0x14, 0xcd, 0xb2, 0x80, 0x7b, 0xbd, 0xf1, 0x28, 0xd0, 
-    0x0f, 0x36, 0xde, 0x10, 0x83, 0x54, 0x14, 0x0d, 0x39, 0x9e, 0x6b, 0x25, 0x79, 
-    0xf1, 0xc7, 0x91, 0x2d, 0x1a, 0x88, 0xc3, 0x64, 0x4c, 0xad, 0x12, 0xc1, 0x78, 
-    0x01, 0xf0, 0xd8, 0x49, 0x28, 0x74, 0xd4, 0x10, 0x43, 0x0c, 0x42, 0x44, 0xe2, 
-    0xd1, 0x2a, 0xa2, 0x78, 0x61, 0xcb, 0x82, 0xdb, 0x2d, 0x60, 0xa4, 0x52, 0x4d, 
-    0x81, 0x36, 0x4b, 0x27, 0x04, 0x6d, 0x49, 0x9d, 0x91, 0x03, 0x11, 0x47, 0xd1, 
-    0x48, 0x05, 0x39, 0x30, 0x9a, 0x03, 0x78, 0x2e, 0x56, 0x11, 0x2b, 0x0e, 0x45, 
-    0xa0, 0x62, 0xa0, 0x82, 0x02, 0x86, 0xe8, 0x46, 0x7b, 0xec, 0x11, 0xc8, 0xa3, 
-    0x81, 0xec, 0x91, 0xc6, 0xa2, 0x0f, 0x29, 0x82, 0x09, 0x26, 0x93, 0x64, 0x6a, 
-    0x87, 0x1c, 0x94, 0x3a, 0xb4, 0xd4, 0x47, 0xa3, 0x74, 0x7a, 0xd0, 0x27, 0x2c, 
-    0xad, 0x22, 0x6a, 0x41, 0x84, 0x98, 0x36, 0x18, 0x45, 0x88, 0x9c, 0x3a, 0xd0, 
-    0xa7, 0xb5, 0xc0, 0x28, 0x77, 0xa1, 0xab, 0xb6, 0x58, 0x47, 0x11, 0x93, 0x17, 
-    0x7a, 0x70, 0xaa, 0x85, 0x15, 0xe1, 0x0a, 0x17, 0x04, 0xa2, 0x3a, 0x62, 0x17, 
-    0x93, 0x38, 0xf9, 0x71, 0x28, 0xa5, 0xb8, 0xf6, 0x1a, 0xa4, 0x2a, 0x67, 0x00, 
-    0x20, 0xc1, 0x46, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x3f, 
-    0x00, 0x2c, 0x0c, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x29, 0x00, 0x85, 0x0c, 0x0c, 
-    0x0c, 0x1b, 0x1b, 0x1b, 0x26, 0x26, 0x28, 0x2c, 0x2c, 0x2c, 0x2f, 0x2f, 0x30, 
-    0x32, 0x32, 0x32, 0x38, 0x36, 0x44, 0x42, 0x42, 0x43, 0x47, 0x26, 0x21, 0x4a, 
-    0x2a, 0x25, 0x4c, 0x4c, 0x53, 0x4e, 0x4c, 0x5b, 0x50, 0x4f, 0x5c, 0x51, 0x33, 
-    0x2f, 0x54, 0x36, 0x32, 0x54, 0x54, 0x54, 0x55, 0x55, 0x6c, 0x56, 0x38, 0x35, 
-    0x56, 0x55, 0x62, 0x59, 0x59, 0x6f, 0x5a, 0x3d, 0x39, 0x5d, 0x5d, 0x72, 0x61, 
-    0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 0x65, 0x79, 0x68, 0x3c, 0x3f, 0x69, 0x69, 
-    0x6a, 0x6a, 0x6a, 0x7e, 0x6d, 0x56, 0x55, 0x6e, 0x6d, 0x81, 0x72, 0x72, 0x85, 
-    0x73, 0x35, 0x35, 0x73, 0x73, 0x74, 0x75, 0x39, 0x3a, 0x75, 0x74, 0x7f, 0x76, 
-    0x41, 0x41, 0x76, 0x5d, 0x5a, 0x76, 0x76, 0x89, 0x78, 0x70, 0x7d, 0x78, 0x76, 
-    0x81, 0x79, 0x3b, 0x3a, 0x7a, 0x35, 0x36, 0x7b, 0x7a, 0x8c, 0x7f, 0x7f, 0x90, 
-    0x81, 0x4d, 0x4d, 0x83, 0x53, 0x53, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x88, 
-    0x88, 0x97, 0x8b, 0x5b, 0x5b, 0x8d, 0x62, 0x62, 0x90, 0x7c, 0x7a, 0x91, 0x65, 
-    0x65, 0x93, 0x93, 0x9c, 0x94, 0x94, 0xa2, 0x99, 0x99, 0xa6, 0xa1, 0xa1, 0xad, 
-    0xa2, 0x7f, 0x7f, 0xa5, 0xa5, 0xb1, 0xa7, 0x85, 0x85, 0xa9, 0x97, 0x9c, 0xac, 
-    0xac, 0xb7, 0xb3, 0xb3, 0xbd, 0x00, 0x00, 0x00, 0x06, 0x57, 0xc0, 0x9f, 0x70, 
-    0x48, 0x2c, 0x1a, 0x87, 0xb6, 0xa3, 0x72, 0xc9, 0x6c, 0xc2, 0x9a, 0xd0, 0xa8, 
-    0x74, 0x4a, 0x9d, 0x3e, 0xab, 0xd8, 0xac, 0x76, 0xdb, 0xec, 0x71, 0xad, 0xdf, 
-    0xb0, 0x58, 0x78, 0xf8, 0x95, 0xc6, 0xe8, 0xb4, 0x5a, 0xa0, 0x56, 0x82, 0x8a, 
-    0xec, 0xb6, 0x7c, 0x4e, 0xaf, 0xdb, 0xef, 0xc6, 0x2b, 0x3e, 0xfc, 0xc6, 0x97, 
-    0xe9, 0x2e, 0x43, 0x71, 0x77, 0x03, 0x7b, 0x7f, 0x61, 0x81, 0x7b, 0x55, 0x83, 
-    0x75, 0x04, 0x8a, 0x8f, 0x90, 0x5a, 0x3b, 0x3b, 0x39, 0x91, 0x96, 0x75, 0x37, 
-    0x97, 0x9a, 0x9b, 0x9c, 0x68, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 
-    0xb2, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x29, 0x00, 0x87, 0x00, 
-    0x00, 0x00, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x11, 0x13, 0x13, 
-    0x13, 0x15, 0x15, 0x18, 0x1b, 0x1b, 0x1b, 0x1e, 0x1d, 0x22, 0x21, 0x1f, 0x28, 
-    0x23, 0x22, 0x2c, 0x23, 0x23, 0x23, 0x29, 0x27, 0x32, 0x2c, 0x2a, 0x36, 0x2c, 
-    0x2b, 0x2c, 0x30, 0x2f, 0x3c, 0x32, 0x32, 0x32, 0x36, 0x35, 0x38, 0x38, 0x37, 
-    0x44, 0x3a, 0x38, 0x45, 0x3c, 0x3c, 0x3c, 0x43, 0x42, 0x4c, 0x44, 0x44, 0x44, 
-    0x47, 0x22, 0x1d, 0x47, 0x25, 0x21, 0x48, 0x26, 0x21, 0x49, 0x2e, 0x31, 0x4a, 
-    0x29, 0x24, 0x4a, 0x2c, 0x2a, 0x4a, 0x39, 0x46, 0x4b, 0x23, 0x1e, 0x4b, 0x4b, 
-    0x4b, 0x4c, 0x42, 0x53, 0x4c, 0x46, 0x5a, 0x4d, 0x49, 0x5d, 0x4d, 0x4c, 0x53, 
-    0x4e, 0x3e, 0x4c, 0x4e, 0x4d, 0x63, 0x50, 0x3d, 0x4a, 0x50, 0x4e, 0x65, 0x50, 
-    0x4f, 0x5c, 0x51, 0x3a, 0x43, 0x52, 0x26, 0x1f, 0x53, 0x31, 0x2e, 0x53, 0x38, 
-    0x3f, 0x53, 0x51, 0x66, 0x53, 0x53, 0x53, 0x54, 0x27, 0x20, 0x54, 0x36, 0x3b, 
-    0x54, 0x54, 0x5c, 0x55, 0x34, 0x34, 0x56, 0x28, 0x21, 0x56, 0x56, 0x6c, 0x57, 
-    0x2f, 0x2f, 0x57, 0x39, 0x35, 0x58, 0x2d, 0x2a, 0x59, 0x48, 0x57, 0x59, 0x59, 
-    0x6e, 0x5a, 0x29, 0x22, 0x5b, 0x3e, 0x3b, 0x5b, 0x5b, 0x5c, 0x5c, 0x3b, 0x43, 
-    0x5c, 0x51, 0x5e, 0x5c, 0x5c, 0x72, 0x5d, 0x44, 0x44, 0x5e, 0x42, 0x3e, 0x5f, 
-    0x5f, 0x60, 0x5f, 0x60, 0x75, 0x60, 0x2f, 0x35, 0x61, 0x61, 0x76, 0x64, 0x64, 
-    0x64, 0x65, 0x49, 0x46, 0x65, 0x65, 0x7a, 0x66, 0x4a, 0x48, 0x67, 0x67, 0x68, 
-    0x68, 0x68, 0x79, 0x69, 0x28, 0x29, 0x69, 0x52, 0x4f, 0x6a, 0x62, 0x6c, 0x6a, 
-    0x6a, 0x7e, 0x6c, 0x6c, 0x6d, 0x6e, 0x35, 0x36, 0x6e, 0x6e, 0x81, 0x6f, 0x55, 
-    0x52, 0x72, 0x73, 0x85, 0x73, 0x25, 0x26, 0x73, 0x2c, 0x2c, 0x73, 0x59, 0x55, 
-    0x73, 0x73, 0x74, 0x74, 0x5b, 0x59, 0x75, 0x27, 0x28, 0x76, 0x75, 0x7b, 0x76, 
-    0x76, 0x89, 0x77, 0x36, 0x37, 0x77, 0x6f, 0x7b, 0x77, 0x78, 0x8a, 0x79, 0x61, 
-    0x5e, 0x7a, 0x25, 0x26, 0x7a, 0x3b, 0x3b, 0x7a, 0x7a, 0x7b, 0x7b, 0x63, 0x62, 
-    0x7b, 0x7b, 0x8d, 0x7d, 0x27, 0x28, 0x7d, 0x29, 0x2a, 0x7d, 0x45, 0x45, 0x7f, 
-    0x7f, 0x80, 0x7f, 0x7f, 0x90, 0x80, 0x79, 0x86, 0x82, 0x69, 0x66, 0x83, 0x4d, 
-    0x4d, 0x83, 0x6e, 0x6c, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 
-    0x86, 0x53, 0x53, 0x88, 0x55, 0x55, 0x8a, 0x5b, 0x5a, 0x8b, 0x2e, 0x2e, 0x8b, 
-    0x2f, 0x30, 0x8b, 0x75, 0x73, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x9b, 0x8e, 0x30, 
-    0x31, 0x8f, 0x60, 0x60, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x9f, 0x91, 0x65, 0x65, 
-    0x92, 0x31, 0x32, 0x93, 0x2f, 0x2f, 0x93, 0x93, 0x94, 0x94, 0x94, 0xa2, 0x95, 
-    0x6c, 0x6d, 0x96, 0x7b, 0x79, 0x98, 0x6f, 0x6f, 0x99, 0x86, 0x84, 0x99, 0x99, 
-    0xa6, 0x9a, 0x34, 0x35, 0x9c, 0x75, 0x75, 0x9c, 0x8a, 0x88, 0x9c, 0x9c, 0x9d, 
-    0x9d, 0x9d, 0xaa, 0xa0, 0x7b, 0x7b, 0xa1, 0xa1, 0xad, 0xa4, 0xa4, 0xa4, 0xa5, 
-    0x88, 0x87, 0xa5, 0xa5, 0xb1, 0xa6, 0x91, 0x95, 0xab, 0xab, 0xac, 0xab, 0xab, 
-    0xb5, 0xae, 0xae, 0xb9, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xbd, 0xb5, 0x99, 0x98, 
-    0xb7, 0xb7, 0xc0, 0xb7, 0xb8, 0xc1, 0xbb, 0xbb, 0xc4, 0xbd, 0xbd, 0xbd, 0xbf, 
-    0xbf, 0xc8, 0xbf, 0xc0, 0xc8, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xcb, 0xca, 0xca, 
-    0xcc, 0xcb, 0xcb, 0xd2, 0xd2, 0xd2, 0xd5, 0xd5, 0xd5, 0xdb, 0xda, 0xd4, 0xd6, 
-    0xda, 0xda, 0xdd, 0xdd, 0xdd, 0xe2, 0xe3, 0xe3, 0xe6, 0xe6, 0xe6, 0xe9, 0xe8, 
-    0xe7, 0xe8, 0xeb, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf2, 0xee, 0xee, 0xf3, 0xf0, 
-    0xef, 0xf3, 0xf3, 0xf4, 0xf7, 0xf7, 0xf8, 0xf8, 0xf6, 0xf6, 0xff, 0xff, 0xff, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0xff, 0x00, 0x65, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x69, 0x2c, 
-    0x75, 0xfa, 0x64, 0xe9, 0xcd, 0xc1, 0x87, 0x10, 0x1f, 0x06, 0x12, 0xf5, 0x2a, 
-    0x96, 0x45, 0x8b, 0xa7, 0x38, 0x45, 0x34, 0x38, 0xc5, 0x4b, 0x94, 0x88, 0x8d, 
-    0x5a, 0xbd, 0xf2, 0x14, 0xeb, 0xd4, 0x45, 0x8b, 0xa9, 0x20, 0x6d, 0xc4, 0xf3, 
-    0xe9, 0x54, 0xc5, 0x57, 0xa7, 0x40, 0x19, 0x32, 0xd8, 0xc8, 0x55, 0x2a, 0x51, 
-    0x16, 0x41, 0x55, 0x3c, 0xf9, 0xca, 0x12, 0x44, 0x4c, 0xb0, 0x4e, 0x9e, 0x34, 
-    0x85, 0x69, 0x8a, 0x40, 0x4a, 0xae, 0x5e, 0xb9, 0xba, 0xe8, 0x0a, 0x94, 0xd0, 
-    0x58, 0xaf, 0x54, 0x1a, 0xd4, 0xf4, 0xf4, 0xa9, 0x2b, 0x53, 0xa6, 0x5c, 0x8d, 
-    0xfa, 0xd4, 0x00, 0xe7, 0xaa, 0x57, 0xa9, 0x76, 0x9e, 0x44, 0x65, 0x70, 0x92, 
-    0xd8, 0xaa, 0x17, 0x5f, 0x99, 0x4a, 0x95, 0x6a, 0xd3, 0x8e, 0x56, 0xa9, 0x1e, 
-    0x38, 0x3a, 0x7b, 0x52, 0x13, 0xc1, 0x37, 0xa8, 0x9e, 0x96, 0xaa, 0x54, 0x89, 
-    0x94, 0xd8, 0x52, 0xb1, 0x4c, 0x9d, 0xf4, 0x54, 0xe1, 0x94, 0xe0, 0xaa, 0xa5, 
-    0x08, 0x52, 0x15, 0x4a, 0x2a, 0x00, 0x80, 0xc7, 0x1e, 0x00, 0x07, 0xb6, 0x78, 
-    0x16, 0xe6, 0xd7, 0xaa, 0xae, 0xd2, 0x0c, 0x94, 0x7c, 0x12, 0xd4, 0xe3, 0xcf, 
-    0x4f, 0x2c, 0x26, 0xb5, 0x6a, 0xea, 0x95, 0xaa, 0xaa, 0x9f, 0x26, 0x08, 0x4c, 
-    0x43, 0xd7, 0xa2, 0x5b, 0xc7, 0x0a, 0x36, 0xa1, 0xa5, 0x5c, 0xb2, 0xf5, 0xa7, 
-    0x01, 0x01, 0x04, 0x36, 0x9a, 0x1d, 0xcb, 0xd5, 0x65, 0xde, 0xb0, 0x4e, 0x71, 
-    0xbe, 0x68, 0x4a, 0xc1, 0xe3, 0x03, 0xb2, 0x28, 0xf1, 0x5e, 0x7e, 0x71, 0x55, 
-    0x50, 0xa1, 0xb0, 0x76, 0x7c, 0x2e, 0x20, 0x6b, 0x37, 0xf3, 0xeb, 0x4f, 0x1d, 
-    0x7d, 0x06, 0x40, 0x40, 0xe0, 0x2a, 0xec, 0xe0, 0x4b, 0x1a, 0xff, 0xd8, 0x0e, 
-    0x40, 0xe0, 0xa7, 0xf0, 0xb1, 0x52, 0x4d, 0x92, 0xf2, 0x43, 0xd1, 0xf7, 0xa7, 
-    0x77, 0xc8, 0x03, 0x50, 0x20, 0x10, 0xe7, 0x75, 0x57, 0x1a, 0x8d, 0xc8, 0xc8, 
-    0x91, 0x03, 0xcb, 0xfb, 0x8b, 0xa7, 0x10, 0x20, 0xdf, 0x03, 0x03, 0x7d, 0xd2, 
-    0x9a, 0x50, 0xa2, 0xe0, 0x31, 0x90, 0x0d, 0xfc, 0xe5, 0x70, 0x87, 0x50, 0xda, 
-    0x0d, 0x48, 0x10, 0x1f, 0xa0, 0xe4, 0x25, 0x94, 0x2b, 0xa2, 0x2c, 0x52, 0x10, 
-    0x83, 0xfc, 0xd9, 0x70, 0x98, 0x45, 0x2d, 0xc8, 0x07, 0x40, 0x03, 0x07, 0x79, 
-    0x01, 0x89, 0x25, 0x96, 0x40, 0x82, 0xc7, 0x47, 0x06, 0x19, 0xd1, 0x60, 0x0e, 
-    0x92, 0x5c, 0x84, 0x8a, 0x00, 0x22, 0x12, 0xb8, 0x11, 0x44, 0x2e, 0x36, 0xf8, 
-    0xa0, 0x45, 0x9e, 0x88, 0x08, 0x80, 0x8d, 0x37, 0x1e, 0xc4, 0x21, 0x7f, 0x5d, 
-    0x5c, 0x14, 0x21, 0x79, 0x03, 0x04, 0x09, 0xd1, 0x90, 0x0e, 0x5e, 0x84, 0x86, 
-    0x88, 0xdd, 0x29, 0xd9, 0xe2, 0x8b, 0x39, 0x54, 0x72, 0x51, 0x11, 0x22, 0x1a, 
-    0x20, 0x65, 0x41, 0x48, 0x30, 0x89, 0x45, 0x2b, 0x17, 0x05, 0x21, 0x9f, 0x00, 
-    0x5b, 0xca, 0x82, 0x87, 0x21, 0x3a, 0xe8, 0x40, 0xa5, 0x18, 0xa7, 0xad, 0x52, 
-    0x0a, 0x28, 0x14, 0xc8, 0x47, 0x5f, 0x99, 0x9f, 0xec, 0x75, 0x47, 0x17, 0x68, 
-    0x38, 0x22, 0x8a, 0x2a, 0x32, 0x0d, 0x64, 0xdc, 0x76, 0x5a, 0x96, 0x29, 0x50, 
-    0x27, 0x42, 0x8d, 0xe2, 0x10, 0x41, 0x7f, 0x3e, 0x96, 0x9b, 0xa0, 0x02, 0x79, 
-    0x01, 0xa6, 0x45, 0xa6, 0x3c, 0xf4, 0x27, 0x75, 0x8c, 0x0e, 0x74, 0x9a, 0x45, 
-    0x76, 0x49, 0x4a, 0x62, 0xa5, 0x02, 0xb1, 0x01, 0x0a, 0x28, 0xa2, 0x90, 0x52, 
-    0x08, 0xa7, 0x37, 0xd6, 0x91, 0xc7, 0xa9, 0xa6, 0xe6, 0x51, 0x07, 0xa9, 0x11, 
-    0x01, 0x42, 0x0a, 0x29, 0xa2, 0x88, 0x49, 0x02, 0x4a, 0x24, 0x67, 0xb0, 0x0a, 
-    0xd1, 0x70, 0xb1, 0x88, 0x62, 0xeb, 0x43, 0x98, 0x58, 0xc5, 0xe2, 0xae, 0x03, 
-    0x19, 0xb2, 0x54, 0x6f, 0x8f, 0xc6, 0x32, 0x09, 0xb0, 0x04, 0x99, 0x04, 0x69, 
-    0x67, 0xc8, 0x0a, 0x14, 0xca, 0x49, 0xf6, 0x59, 0x54, 0x49, 0xb3, 0x93, 0x14, 
-    0x7a, 0x91, 0x2a, 0x62, 0x48, 0x00, 0xec, 0x1b, 0xa9, 0x58, 0x6b, 0xd1, 0x28, 
-    0x2d, 0x30, 0x00, 0xec, 0x62, 0x27, 0x8d, 0x72, 0xd1, 0x28, 0x13, 0x20, 0xa7, 
-    0x64, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x4c, 0x00, 0x2c, 0x0d, 
-    0x00, 0x0d, 0x00, 0x28, 0x00, 0x29, 0x00, 0x86, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 
-    0x12, 0x13, 0x13, 0x13, 0x1b, 0x1b, 0x1b, 0x1f, 0x1f, 0x20, 0x22, 0x22, 0x22, 
-    0x2c, 0x2c, 0x2c, 0x32, 0x32, 0x32, 0x38, 0x37, 0x38, 0x39, 0x37, 0x45, 0x3e, 
-    0x3d, 0x4a, 0x42, 0x42, 0x42, 0x48, 0x47, 0x53, 0x4b, 0x4b, 0x4c, 0x4c, 0x2b, 
-    0x26, 0x4d, 0x4b, 0x59, 0x51, 0x31, 0x2e, 0x51, 0x4f, 0x5c, 0x53, 0x53, 0x54, 
-    0x55, 0x36, 0x32, 0x55, 0x54, 0x64, 0x56, 0x56, 0x6c, 0x57, 0x39, 0x35, 0x59, 
-    0x59, 0x6e, 0x5c, 0x5c, 0x72, 0x5f, 0x60, 0x75, 0x61, 0x61, 0x76, 0x62, 0x47, 
-    0x44, 0x64, 0x64, 0x65, 0x65, 0x65, 0x7a, 0x67, 0x68, 0x7c, 0x6a, 0x4e, 0x4c, 
-    0x6a, 0x6a, 0x7e, 0x6c, 0x6c, 0x6d, 0x6d, 0x39, 0x3c, 0x6e, 0x2e, 0x2e, 0x6e, 
-    0x33, 0x34, 0x6e, 0x6e, 0x81, 0x70, 0x6f, 0x7a, 0x73, 0x73, 0x85, 0x74, 0x5b, 
-    0x59, 0x74, 0x73, 0x7e, 0x74, 0x74, 0x74, 0x75, 0x33, 0x34, 0x76, 0x39, 0x39, 
-    0x76, 0x76, 0x89, 0x79, 0x79, 0x79, 0x7b, 0x47, 0x47, 0x7b, 0x7b, 0x8d, 0x7d, 
-    0x6f, 0x7c, 0x7f, 0x7f, 0x90, 0x80, 0x79, 0x86, 0x82, 0x5e, 0x60, 0x82, 0x82, 
-    0x93, 0x83, 0x6e, 0x6c, 0x86, 0x54, 0x54, 0x8a, 0x5b, 0x5a, 0x8b, 0x78, 0x76, 
-    0x8c, 0x74, 0x72, 0x8c, 0x8c, 0x9b, 0x90, 0x90, 0x9f, 0x91, 0x67, 0x67, 0x92, 
-    0x7c, 0x79, 0x94, 0x94, 0xa2, 0x95, 0x81, 0x80, 0x9a, 0x87, 0x84, 0x9a, 0x88, 
-    0x87, 0x9a, 0x9a, 0xa7, 0x9d, 0x9d, 0xaa, 0x9f, 0x7a, 0x79, 0xa0, 0x8f, 0x8e, 
-    0xa2, 0xa2, 0xae, 0xa3, 0xa3, 0xb0, 0xaa, 0xaa, 0xb5, 0xb1, 0xb0, 0xbb, 0xb7, 
-    0xb7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x78, 0x80, 0x4c, 0x82, 0x83, 0x84, 0x85, 0x86, 0x83, 0x35, 
-    0x87, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x86, 0x27, 0x8e, 0x47, 0x8f, 0x8c, 0x3b, 
-    0x94, 0x93, 0x94, 0x99, 0x85, 0x91, 0x4c, 0x4a, 0x9a, 0x9f, 0xa0, 0x8d, 0x49, 
-    0xa1, 0xa1, 0x32, 0xa4, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xa9, 0x98, 0xac, 0x8b, 
-    0x04, 0xaf, 0xb2, 0xb3, 0xb4, 0xb5, 0x99, 0x05, 0xa4, 0x1b, 0xb6, 0x84, 0x96, 
-    0xbb, 0x83, 0x43, 0x99, 0x12, 0x87, 0x06, 0x8a, 0x48, 0x83, 0xbd, 0x86, 0xba, 
-    0xbe, 0x84, 0xca, 0xcb, 0x87, 0x31, 0x8d, 0x00, 0xce, 0xab, 0xcd, 0xd3, 0xbe, 
-    0xc8, 0x85, 0xd0, 0x84, 0x0d, 0xb3, 0xda, 0x87, 0xb8, 0xd6, 0xe0, 0xaa, 0x30, 
-    0x8f, 0xe2, 0xd6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0x8d, 0x0a, 
-    0xac, 0x89, 0x8c, 0xc2, 0xef, 0x8a, 0x81, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 
-    0x00, 0xb9, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x29, 0x00, 0x87, 
-    0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x10, 0x10, 
-    0x0f, 0x13, 0x14, 0x14, 0x14, 0x15, 0x14, 0x18, 0x1c, 0x1c, 0x1c, 0x1d, 0x1d, 
-    0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2b, 0x2a, 0x29, 0x33, 0x2c, 0x2c, 0x2c, 
-    0x30, 0x2e, 0x3c, 0x34, 0x32, 0x3c, 0x34, 0x34, 0x34, 0x39, 0x37, 0x44, 0x3a, 
-    0x3a, 0x3b, 0x3e, 0x3e, 0x41, 0x42, 0x42, 0x43, 0x45, 0x37, 0x44, 0x45, 0x43, 
-    0x51, 0x45, 0x44, 0x4b, 0x46, 0x23, 0x1d, 0x47, 0x25, 0x20, 0x48, 0x25, 0x20, 
-    0x48, 0x2e, 0x31, 0x4b, 0x2b, 0x26, 0x4c, 0x23, 0x1d, 0x4c, 0x42, 0x53, 0x4c, 
-    0x46, 0x5a, 0x4c, 0x4c, 0x4c, 0x4d, 0x49, 0x5e, 0x4e, 0x2e, 0x2a, 0x4e, 0x30, 
-    0x2c, 0x4e, 0x3e, 0x4b, 0x4e, 0x4c, 0x62, 0x4e, 0x4d, 0x54, 0x50, 0x3d, 0x49, 
-    0x50, 0x4e, 0x65, 0x51, 0x25, 0x1f, 0x51, 0x3a, 0x43, 0x52, 0x51, 0x66, 0x54, 
-    0x27, 0x20, 0x54, 0x35, 0x3a, 0x54, 0x39, 0x3d, 0x54, 0x53, 0x5e, 0x54, 0x54, 
-    0x54, 0x56, 0x28, 0x21, 0x56, 0x31, 0x2f, 0x56, 0x32, 0x32, 0x56, 0x39, 0x35, 
-    0x56, 0x56, 0x6c, 0x57, 0x2f, 0x2c, 0x58, 0x2d, 0x2a, 0x58, 0x3b, 0x37, 0x58, 
-    0x57, 0x6e, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5a, 0x3d, 0x3a, 0x5b, 0x5b, 
-    0x5b, 0x5c, 0x5c, 0x72, 0x5d, 0x4e, 0x5e, 0x5e, 0x5d, 0x62, 0x60, 0x31, 0x36, 
-    0x61, 0x61, 0x76, 0x62, 0x46, 0x43, 0x64, 0x63, 0x64, 0x65, 0x63, 0x6e, 0x65, 
-    0x65, 0x7a, 0x66, 0x48, 0x49, 0x69, 0x67, 0x76, 0x6a, 0x48, 0x50, 0x6a, 0x6a, 
-    0x7e, 0x6b, 0x32, 0x33, 0x6c, 0x6c, 0x6c, 0x6d, 0x2e, 0x2f, 0x6d, 0x51, 0x4f, 
-    0x6d, 0x6d, 0x81, 0x6f, 0x70, 0x83, 0x70, 0x57, 0x54, 0x71, 0x59, 0x56, 0x72, 
-    0x2a, 0x2a, 0x72, 0x72, 0x85, 0x73, 0x25, 0x26, 0x74, 0x33, 0x33, 0x74, 0x6f, 
-    0x79, 0x74, 0x74, 0x74, 0x75, 0x74, 0x7e, 0x76, 0x27, 0x28, 0x76, 0x5d, 0x5b, 
-    0x76, 0x76, 0x88, 0x77, 0x3b, 0x3b, 0x78, 0x65, 0x68, 0x79, 0x27, 0x27, 0x79, 
-    0x33, 0x33, 0x79, 0x61, 0x5d, 0x7b, 0x2d, 0x2d, 0x7b, 0x78, 0x86, 0x7b, 0x7b, 
-    0x7c, 0x7b, 0x7b, 0x8d, 0x7d, 0x44, 0x44, 0x7e, 0x66, 0x64, 0x7f, 0x7f, 0x90, 
-    0x82, 0x4e, 0x4e, 0x83, 0x6c, 0x6a, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 
-    0x2b, 0x2c, 0x84, 0x55, 0x56, 0x87, 0x70, 0x6c, 0x87, 0x88, 0x98, 0x88, 0x87, 
-    0x88, 0x8a, 0x2e, 0x2f, 0x8a, 0x76, 0x74, 0x8b, 0x2f, 0x30, 0x8b, 0x5b, 0x5a, 
-    0x8b, 0x7c, 0x85, 0x8b, 0x8b, 0x9a, 0x8d, 0x68, 0x67, 0x8d, 0x8d, 0x8d, 0x8d, 
-    0x8d, 0x92, 0x8e, 0x30, 0x31, 0x8e, 0x62, 0x63, 0x90, 0x8f, 0x90, 0x91, 0x91, 
-    0x9e, 0x92, 0x2f, 0x2f, 0x93, 0x31, 0x32, 0x93, 0x93, 0x93, 0x94, 0x94, 0xa2, 
-    0x95, 0x6c, 0x6c, 0x9a, 0x34, 0x34, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0xa6, 0x9d, 
-    0x89, 0x88, 0x9d, 0x9d, 0xaa, 0xa1, 0xa1, 0xad, 0xa3, 0xa3, 0xa3, 0xa6, 0x84, 
-    0x84, 0xa6, 0x94, 0x92, 0xa6, 0xa6, 0xb1, 0xa7, 0xa8, 0xb4, 0xaa, 0x98, 0x97, 
-    0xaa, 0xaa, 0xb5, 0xab, 0xab, 0xac, 0xac, 0x8b, 0x8b, 0xae, 0xae, 0xb9, 0xaf, 
-    0x90, 0x8f, 0xb2, 0xae, 0xb6, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xbc, 0xb5, 0x98, 
-    0x98, 0xb7, 0xa8, 0xa9, 0xb7, 0xb7, 0xc0, 0xbb, 0xbb, 0xbb, 0xbc, 0xbc, 0xc5, 
-    0xbd, 0xa4, 0xa4, 0xbf, 0xbf, 0xc8, 0xc0, 0xbf, 0xc0, 0xc3, 0xc3, 0xcb, 0xc4, 
-    0xc4, 0xc4, 0xc6, 0xb2, 0xb2, 0xc9, 0xb5, 0xb5, 0xca, 0xca, 0xcc, 0xcc, 0xcc, 
-    0xd2, 0xcd, 0xbb, 0xbb, 0xd2, 0xd2, 0xd5, 0xd3, 0xc3, 0xc3, 0xd5, 0xd5, 0xda, 
-    0xd7, 0xc9, 0xc9, 0xd9, 0xd9, 0xdd, 0xdb, 0xce, 0xce, 0xdd, 0xdd, 0xe1, 0xdf, 
-    0xd3, 0xd3, 0xe3, 0xdb, 0xdb, 0xe3, 0xe3, 0xe5, 0xe6, 0xe6, 0xe9, 0xe8, 0xe7, 
-    0xe8, 0xeb, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xf0, 
-    0xf3, 0xf3, 0xf4, 0xf7, 0xf7, 0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0xff, 0x00, 0x73, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x64, 
-    0x18, 0x75, 0x5a, 0x78, 0x68, 0xcb, 0xc1, 0x87, 0x10, 0x1f, 0x76, 0x9a, 0x75, 
-    0x0b, 0x97, 0x45, 0x5c, 0xb5, 0x48, 0x05, 0x8a, 0x48, 0xf0, 0x8c, 0xa5, 0x4f, 
-    0x9d, 0x18, 0x3d, 0x79, 0xb8, 0x45, 0x15, 0x2e, 0x4f, 0xb6, 0x70, 0x99, 0xbc, 
-    0x78, 0xab, 0x13, 0x47, 0x44, 0xa8, 0x2a, 0x5e, 0xb4, 0x65, 0x0a, 0x51, 0xc1, 
-    0x35, 0xaa, 0x6e, 0xe5, 0xb4, 0xe8, 0xe9, 0xe2, 0x45, 0x53, 0x10, 0x37, 0xc9, 
-    0xf4, 0x79, 0x91, 0x55, 0xa6, 0x29, 0xb9, 0x10, 0xbd, 0xba, 0xc5, 0x4a, 0xd6, 
-    0xcf, 0x5a, 0x44, 0x71, 0x91, 0x3a, 0x98, 0x29, 0xaa, 0xd5, 0x5b, 0xb3, 0x60, 
-    0xbd, 0x52, 0x35, 0x04, 0x0e, 0xae, 0x5b, 0xa6, 0x70, 0x39, 0x8d, 0xfa, 0xa8, 
-    0xe0, 0xa1, 0xa1, 0x56, 0x7d, 0x9a, 0x34, 0x55, 0x6b, 0x8c, 0x49, 0x35, 0x3c, 
-    0x56, 0x46, 0x55, 0x55, 0x90, 0x55, 0x54, 0x54, 0x78, 0xc6, 0x10, 0x22, 0x75, 
-    0x51, 0xd6, 0x2c, 0x5c, 0xaf, 0x7c, 0xbe, 0x18, 0xc5, 0xf7, 0x6a, 0x9f, 0x81, 
-    0x88, 0xa2, 0xde, 0x7a, 0x00, 0xa0, 0x31, 0x80, 0x31, 0x15, 0x97, 0x7e, 0x8d, 
-    0x6a, 0x0a, 0xad, 0xcf, 0x4d, 0x03, 0x0b, 0x13, 0x5d, 0xe2, 0xb8, 0x71, 0x60, 
-    0x8c, 0x8a, 0x59, 0xdd, 0xfa, 0x4c, 0xd4, 0xd6, 0x98, 0x81, 0xa4, 0x7d, 0xda, 
-    0xd2, 0x04, 0x77, 0x08, 0xa4, 0xb4, 0x44, 0xed, 0x12, 0xbd, 0x75, 0x05, 0x40, 
-    0x82, 0x5c, 0x4f, 0xa0, 0xc2, 0xde, 0x3d, 0x73, 0x56, 0xe5, 0xa8, 0x80, 0x1a, 
-    0x17, 0xc8, 0xe5, 0x24, 0x25, 0x6f, 0xde, 0xb6, 0x74, 0x13, 0x1d, 0xe5, 0x38, 
-    0x80, 0xc0, 0xd4, 0xc7, 0xa3, 0x5b, 0xb4, 0x35, 0xa1, 0x33, 0x83, 0x5c, 0x9f, 
-    0xa4, 0x13, 0x9d, 0xc5, 0xca, 0xb8, 0xd5, 0x44, 0x9d, 0x01, 0x1c, 0xff, 0xc8, 
-    0xf5, 0x06, 0x96, 0x76, 0x5c, 0xac, 0x12, 0xc9, 0xd0, 0xb1, 0x83, 0x92, 0x55, 
-    0x59, 0x09, 0xc2, 0x0f, 0x10, 0x18, 0x08, 0x7a, 0xda, 0x59, 0x99, 0x04, 0xda, 
-    0xd0, 0xc1, 0x3f, 0x51, 0x54, 0xf0, 0xe1, 0x29, 0x30, 0xd0, 0x1a, 0xa3, 0x58, 
-    0xe6, 0xd3, 0x2d, 0xa3, 0xac, 0x31, 0xd0, 0x7a, 0xfc, 0xd9, 0x20, 0xd7, 0x57, 
-    0xd5, 0x85, 0x67, 0xc0, 0x4d, 0x9b, 0x98, 0x02, 0x8b, 0x2d, 0xb7, 0xd8, 0x22, 
-    0x8b, 0x2a, 0x9d, 0x9c, 0x51, 0x90, 0x11, 0xfc, 0xf1, 0x07, 0x88, 0x5a, 0xe1, 
-    0x35, 0x26, 0x40, 0x44, 0x0a, 0x42, 0x14, 0x42, 0x88, 0x3a, 0x08, 0x31, 0x54, 
-    0x25, 0x25, 0x02, 0x30, 0x21, 0x47, 0x10, 0xed, 0xc0, 0xa2, 0x0d, 0xe6, 0x59, 
-    0x34, 0x46, 0x8c, 0xb7, 0xd1, 0xf8, 0x90, 0x8d, 0x21, 0xda, 0x40, 0x9a, 0x04, 
-    0x31, 0x8e, 0xe7, 0xe3, 0x41, 0x40, 0xf2, 0x57, 0xc3, 0x58, 0xb5, 0x1c, 0x10, 
-    0xa3, 0x80, 0x47, 0x7e, 0xc8, 0xa2, 0x0e, 0x5a, 0x5c, 0x14, 0x4b, 0x00, 0x25, 
-    0x3a, 0x17, 0x25, 0x19, 0x03, 0x81, 0x21, 0xc4, 0x8d, 0xa3, 0x58, 0x89, 0x65, 
-    0x78, 0x46, 0x46, 0x19, 0x08, 0x23, 0x2d, 0xec, 0x17, 0x62, 0x13, 0x7c, 0xd9, 
-    0xc2, 0x0a, 0x29, 0x8c, 0x08, 0x50, 0xe2, 0x75, 0x51, 0x0a, 0xa4, 0x8a, 0x2c, 
-    0xa4, 0x54, 0x02, 0x49, 0x25, 0xa6, 0xe0, 0x69, 0xd3, 0x40, 0x05, 0x84, 0x47, 
-    0x67, 0x9d, 0xb9, 0x04, 0x82, 0x96, 0x2a, 0x29, 0x12, 0xc4, 0x40, 0x67, 0x3d, 
-    0x12, 0xfa, 0xdc, 0x45, 0xb0, 0x40, 0x34, 0x40, 0x63, 0x8d, 0x3a, 0x9a, 0x4b, 
-    0x8e, 0xb8, 0x8c, 0x02, 0xd1, 0x03, 0x01, 0x20, 0x60, 0xe9, 0x40, 0x68, 0x88, 
-    0x52, 0x4a, 0x29, 0xa7, 0x18, 0x42, 0xc7, 0xa7, 0x34, 0xb2, 0x31, 0xc7, 0xaa, 
-    0xab, 0xea, 0x11, 0x07, 0xaa, 0x1c, 0xf5, 0x4c, 0xf1, 0x8a, 0x2b, 0xae, 0xb4, 
-    0xd2, 0x0a, 0x26, 0x68, 0xc0, 0x1a, 0xd1, 0x83, 0x2a, 0xe9, 0x0a, 0x51, 0x55, 
-    0xa5, 0x8d, 0xe4, 0x6b, 0x41, 0x85, 0xc8, 0x94, 0xdc, 0x45, 0x8c, 0x0c, 0x5b, 
-    0x10, 0x69, 0xa2, 0x5d, 0xa4, 0xa9, 0xb2, 0x02, 0x69, 0x86, 0x0b, 0x2a, 0x3e, 
-    0x41, 0x02, 0x6d, 0x2e, 0x8c, 0x10, 0x45, 0xad, 0x45, 0xb2, 0x5c, 0x61, 0x01, 
-    0xb4, 0xd0, 0x6d, 0x3b, 0xad, 0x04, 0x10, 0x28, 0x0b, 0xac, 0x4f, 0xe2, 0xa2, 
-    0xa2, 0xc0, 0x02, 0x51, 0x06, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 
-    0x48, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x29, 0x00, 0x86, 0x0e, 
-    0x0d, 0x0e, 0x15, 0x15, 0x15, 0x17, 0x17, 0x18, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 
-    0x20, 0x24, 0x24, 0x24, 0x2c, 0x2c, 0x2c, 0x3d, 0x3c, 0x48, 0x3f, 0x3f, 0x40, 
-    0x43, 0x43, 0x44, 0x44, 0x43, 0x4c, 0x46, 0x45, 0x51, 0x48, 0x47, 0x53, 0x4c, 
-    0x4c, 0x4d, 0x4e, 0x2e, 0x2b, 0x4e, 0x30, 0x2d, 0x4e, 0x4d, 0x54, 0x52, 0x50, 
-    0x5d, 0x53, 0x53, 0x54, 0x54, 0x36, 0x32, 0x55, 0x54, 0x64, 0x56, 0x56, 0x6d, 
-    0x57, 0x3b, 0x38, 0x58, 0x3b, 0x37, 0x59, 0x59, 0x6e, 0x5a, 0x3d, 0x3a, 0x5a, 
-    0x5a, 0x5b, 0x5c, 0x5c, 0x72, 0x5e, 0x5d, 0x62, 0x61, 0x61, 0x76, 0x63, 0x63, 
-    0x64, 0x65, 0x41, 0x49, 0x65, 0x65, 0x7a, 0x66, 0x4b, 0x49, 0x68, 0x4c, 0x49, 
-    0x68, 0x61, 0x71, 0x68, 0x67, 0x7c, 0x6a, 0x69, 0x75, 0x6a, 0x6a, 0x6a, 0x6a, 
-    0x6a, 0x7e, 0x6c, 0x31, 0x31, 0x6d, 0x6d, 0x81, 0x70, 0x6f, 0x78, 0x73, 0x73, 
-    0x85, 0x74, 0x32, 0x32, 0x75, 0x3d, 0x3d, 0x76, 0x5d, 0x5b, 0x76, 0x76, 0x88, 
-    0x78, 0x6f, 0x7a, 0x79, 0x61, 0x5d, 0x7b, 0x7b, 0x8c, 0x7e, 0x66, 0x64, 0x82, 
-    0x4e, 0x4e, 0x83, 0x52, 0x52, 0x83, 0x83, 0x94, 0x86, 0x5b, 0x5d, 0x87, 0x72, 
-    0x70, 0x88, 0x88, 0x97, 0x8b, 0x8b, 0x9b, 0x8d, 0x79, 0x77, 0x91, 0x91, 0x9f, 
-    0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0x99, 0x99, 0xa7, 0x9d, 0x9d, 0xaa, 0xa2, 
-    0xa2, 0xae, 0xa5, 0xa5, 0xb1, 0xa8, 0x95, 0x94, 0xa8, 0xa8, 0xb4, 0xaa, 0x8a, 
-    0x8a, 0xac, 0x9b, 0x9a, 0xb3, 0xa6, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6b, 0x80, 0x48, 0x82, 0x83, 0x84, 
-    0x85, 0x86, 0x83, 0x2f, 0x85, 0x32, 0x87, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 
-    0x92, 0x93, 0x84, 0x41, 0x94, 0x97, 0x98, 0x99, 0x97, 0x1e, 0x9a, 0x9d, 0x9e, 
-    0x99, 0x12, 0x93, 0x96, 0x9f, 0xa4, 0xa5, 0x97, 0x1a, 0xa6, 0x48, 0x29, 0xa9, 
-    0x87, 0x3d, 0xac, 0xaf, 0x9d, 0x09, 0xb0, 0x94, 0x39, 0xb3, 0x86, 0x00, 0xb6, 
-    0xb9, 0x87, 0x08, 0x86, 0x02, 0xba, 0xbf, 0x8e, 0xbe, 0xc0, 0xba, 0xbc, 0xc3, 
-    0x48, 0xc2, 0xa6, 0x21, 0xba, 0x8b, 0xc6, 0x82, 0xa3, 0xcd, 0x90, 0x01, 0xa5, 
-    0x3c, 0x86, 0xb5, 0xd0, 0xd7, 0x87, 0x04, 0x9e, 0x35, 0xd8, 0xd8, 0x47, 0xdd, 
-    0xe0, 0xe1, 0xe2, 0xe3, 0x94, 0x0a, 0xc6, 0xc5, 0xe4, 0x86, 0x81, 0x00, 0x21, 
-    0xf9, 0x04, 0x05, 0x03, 0x00, 0xba, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x28, 
-    0x00, 0x29, 0x00, 0x87, 0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 
-    0x0f, 0x0e, 0x11, 0x14, 0x14, 0x14, 0x15, 0x14, 0x18, 0x18, 0x17, 0x1d, 0x1b, 
-    0x1b, 0x1b, 0x1d, 0x1c, 0x23, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x25, 0x25, 
-    0x2b, 0x28, 0x26, 0x31, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x32, 0x30, 0x2e, 0x3c, 
-    0x34, 0x32, 0x3c, 0x34, 0x34, 0x34, 0x39, 0x37, 0x44, 0x3b, 0x3b, 0x3b, 0x3e, 
-    0x3e, 0x41, 0x43, 0x41, 0x4e, 0x43, 0x43, 0x43, 0x45, 0x37, 0x44, 0x45, 0x43, 
-    0x51, 0x46, 0x23, 0x1d, 0x47, 0x25, 0x20, 0x48, 0x25, 0x20, 0x48, 0x2e, 0x31, 
-    0x4b, 0x2b, 0x26, 0x4b, 0x4b, 0x4c, 0x4c, 0x23, 0x1d, 0x4c, 0x42, 0x53, 0x4c, 
-    0x46, 0x5a, 0x4d, 0x49, 0x5e, 0x4e, 0x2e, 0x2a, 0x4e, 0x30, 0x2c, 0x4e, 0x3e, 
-    0x4b, 0x4e, 0x40, 0x4f, 0x4e, 0x4c, 0x62, 0x4e, 0x4d, 0x54, 0x50, 0x3d, 0x49, 
-    0x50, 0x4e, 0x65, 0x51, 0x25, 0x1f, 0x51, 0x3a, 0x43, 0x52, 0x51, 0x66, 0x54, 
-    0x27, 0x20, 0x54, 0x35, 0x3a, 0x54, 0x39, 0x3d, 0x54, 0x54, 0x55, 0x56, 0x28, 
-    0x21, 0x56, 0x31, 0x2f, 0x56, 0x32, 0x32, 0x56, 0x39, 0x35, 0x56, 0x55, 0x5b, 
-    0x56, 0x56, 0x6c, 0x57, 0x2f, 0x2c, 0x58, 0x2d, 0x2a, 0x58, 0x3b, 0x37, 0x58, 
-    0x57, 0x58, 0x58, 0x57, 0x6e, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5a, 0x3d, 
-    0x3a, 0x5b, 0x59, 0x66, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x72, 0x5d, 0x4e, 0x5e, 
-    0x60, 0x31, 0x36, 0x61, 0x61, 0x76, 0x62, 0x46, 0x43, 0x63, 0x63, 0x64, 0x65, 
-    0x65, 0x7a, 0x66, 0x48, 0x49, 0x66, 0x65, 0x6b, 0x69, 0x67, 0x76, 0x6a, 0x48, 
-    0x50, 0x6a, 0x6a, 0x7e, 0x6b, 0x32, 0x33, 0x6b, 0x6b, 0x6c, 0x6d, 0x2e, 0x2f, 
-    0x6d, 0x51, 0x4f, 0x6d, 0x6d, 0x81, 0x6f, 0x70, 0x83, 0x71, 0x59, 0x56, 0x72, 
-    0x2a, 0x2a, 0x72, 0x72, 0x85, 0x73, 0x25, 0x26, 0x73, 0x73, 0x73, 0x74, 0x33, 
-    0x33, 0x74, 0x6f, 0x79, 0x75, 0x75, 0x7c, 0x76, 0x27, 0x28, 0x76, 0x5d, 0x5b, 
-    0x76, 0x76, 0x88, 0x77, 0x3b, 0x3b, 0x78, 0x65, 0x68, 0x79, 0x27, 0x27, 0x79, 
-    0x33, 0x33, 0x79, 0x61, 0x5d, 0x7b, 0x2d, 0x2d, 0x7b, 0x78, 0x86, 0x7b, 0x7b, 
-    0x8c, 0x7c, 0x7c, 0x7c, 0x7d, 0x44, 0x44, 0x7e, 0x66, 0x64, 0x7f, 0x7f, 0x90, 
-    0x82, 0x4e, 0x4e, 0x82, 0x82, 0x82, 0x83, 0x6c, 0x6a, 0x83, 0x83, 0x94, 0x84, 
-    0x2b, 0x2c, 0x84, 0x55, 0x56, 0x87, 0x70, 0x6c, 0x87, 0x87, 0x88, 0x87, 0x88, 
-    0x98, 0x8a, 0x2e, 0x2f, 0x8a, 0x76, 0x74, 0x8b, 0x2f, 0x30, 0x8b, 0x5b, 0x5a, 
-    0x8b, 0x7c, 0x85, 0x8b, 0x8b, 0x9a, 0x8d, 0x68, 0x67, 0x8d, 0x8d, 0x8d, 0x8d, 
-    0x8d, 0x92, 0x8e, 0x30, 0x31, 0x8e, 0x62, 0x63, 0x90, 0x90, 0x9f, 0x92, 0x2f, 
-    0x2f, 0x93, 0x31, 0x32, 0x93, 0x93, 0x93, 0x94, 0x94, 0xa2, 0x95, 0x6c, 0x6c, 
-    0x9a, 0x34, 0x34, 0x9a, 0x9a, 0xa6, 0x9b, 0x9b, 0x9b, 0x9d, 0x89, 0x88, 0x9d, 
-    0x9d, 0xaa, 0xa1, 0xa1, 0xae, 0xa2, 0xa2, 0xa3, 0xa6, 0x84, 0x84, 0xa6, 0x94, 
-    0x92, 0xa6, 0xa6, 0xb1, 0xa7, 0xa8, 0xb4, 0xaa, 0x98, 0x97, 0xaa, 0xaa, 0xb5, 
-    0xab, 0xab, 0xab, 0xac, 0x8b, 0x8b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x8f, 0xb2, 
-    0xae, 0xb6, 0xb2, 0xb2, 0xbc, 0xb3, 0xb3, 0xb4, 0xb5, 0x98, 0x98, 0xb7, 0xa8, 
-    0xa9, 0xb7, 0xb7, 0xc0, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc4, 0xbd, 0xa4, 0xa4, 
-    0xbf, 0xbf, 0xc8, 0xc0, 0xbf, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcb, 0xc6, 
-    0xb2, 0xb2, 0xcb, 0xcb, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xbb, 0xbb, 0xd2, 0xd2, 
-    0xd5, 0xd3, 0xc3, 0xc3, 0xd5, 0xd5, 0xda, 0xd7, 0xc9, 0xc9, 0xd9, 0xd9, 0xdc, 
-    0xdb, 0xce, 0xce, 0xdd, 0xdd, 0xe1, 0xdf, 0xd3, 0xd3, 0xe3, 0xdb, 0xdb, 0xe3, 
-    0xe3, 0xe5, 0xe6, 0xe6, 0xe9, 0xe8, 0xe7, 0xe8, 0xeb, 0xeb, 0xed, 0xee, 0xee, 
-    0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xf3, 0xf3, 0xf4, 0xf7, 0xf7, 0xf8, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x75, 0x09, 0x1c, 0x48, 0xb0, 
-    0xa0, 0xc1, 0x81, 0x5e, 0x1c, 0x7d, 0x5a, 0xa8, 0xc8, 0xcb, 0xc1, 0x87, 0x10, 
-    0x1f, 0x7e, 0xa2, 0x85, 0x2b, 0x97, 0xc5, 0x5c, 0xb6, 0x4a, 0x0d, 0x8a, 0x48, 
-    0x50, 0xcd, 0x25, 0x51, 0x9f, 0x1e, 0x59, 0x79, 0xe8, 0x25, 0x55, 0x2e, 0x50, 
-    0xb7, 0x72, 0xad, 0xba, 0x98, 0x0b, 0xd7, 0x27, 0x8e, 0x8a, 0x52, 0x55, 0xbc, 
-    0x78, 0xeb, 0x94, 0xa2, 0x82, 0x6e, 0x56, 0xe1, 0xd2, 0x69, 0x31, 0x14, 0x4b, 
-    0x8b, 0xa9, 0x20, 0x76, 0x9a, 0xf9, 0xd3, 0x62, 0xab, 0x4d, 0x53, 0x74, 0x25, 
-    0x82, 0x85, 0xab, 0xd5, 0xac, 0x8b, 0xa7, 0x6c, 0x15, 0x25, 0x75, 0x70, 0x53, 
-    0xd1, 0xab, 0xb8, 0x68, 0xc5, 0x82, 0xb5, 0xea, 0x88, 0x9c, 0x96, 0xa7, 0x72, 
-    0x3d, 0x2d, 0x1a, 0xa9, 0x60, 0x22, 0xa2, 0x57, 0x59, 0xae, 0x3c, 0x75, 0xeb, 
-    0xcc, 0x4a, 0x36, 0x41, 0x56, 0x5e, 0x5d, 0x55, 0xb0, 0x55, 0xd1, 0x54, 0x7b, 
-    0xce, 0x1c, 0x2a, 0x75, 0x71, 0x16, 0xad, 0x5c, 0xb0, 0x58, 0xc6, 0x10, 0xc5, 
-    0x17, 0xeb, 0x9f, 0x81, 0x8a, 0x8a, 0xe2, 0x8a, 0x00, 0xa0, 0x31, 0x80, 0x33, 
-    0x15, 0x99, 0xb6, 0x2c, 0x7a, 0x0a, 0x2d, 0xcb, 0x4e, 0x03, 0x0b, 0xff, 0x7c, 
-    0xe2, 0xb8, 0x71, 0xe0, 0x5c, 0x29, 0x7f, 0x36, 0xc5, 0xf5, 0xf9, 0xe7, 0x2d, 
-    0x36, 0x03, 0x4b, 0xb3, 0xbc, 0xc5, 0x89, 0xcd, 0x8e, 0x23, 0x92, 0xd2, 0xfe, 
-    0xb4, 0x2b, 0x1a, 0x0b, 0x00, 0x05, 0xba, 0xa4, 0x84, 0x96, 0xcd, 0xdb, 0xe2, 
-    0x2d, 0x5a, 0x95, 0x8b, 0x1e, 0x6a, 0x3c, 0x20, 0xf7, 0xee, 0xde, 0xb2, 0x6f, 
-    0x49, 0x2d, 0x5a, 0x2a, 0x80, 0x63, 0x81, 0xaa, 0x91, 0x4b, 0xb7, 0x88, 0x0b, 
-    0x45, 0x67, 0xdc, 0xa2, 0xa6, 0xff, 0xa4, 0xd5, 0xea, 0xf8, 0x4f, 0x4c, 0x9d, 
-    0x01, 0x1c, 0xff, 0xd0, 0x35, 0x27, 0x96, 0xf6, 0x5c, 0xad, 0x16, 0xd1, 0xf0, 
-    0xf1, 0xc3, 0xd2, 0xd5, 0x5b, 0x8c, 0xaf, 0x0b, 0x1c, 0x64, 0x1e, 0x39, 0xad, 
-    0x4d, 0x02, 0x73, 0xf8, 0xd8, 0xbf, 0xa8, 0x28, 0xf8, 0xf0, 0x05, 0x0c, 0xe4, 
-    0x06, 0x29, 0x96, 0xb1, 0x84, 0x0b, 0x29, 0x6e, 0x0c, 0xb4, 0xde, 0x7e, 0x39, 
-    0xc8, 0x75, 0x51, 0x10, 0xe1, 0x01, 0x10, 0x00, 0x4e, 0x9d, 0x9c, 0x12, 0xcb, 
-    0x2d, 0xb8, 0xdc, 0x32, 0xcb, 0x2a, 0x9f, 0xa8, 0x51, 0x50, 0x12, 0xfb, 0xed, 
-    0x27, 0x08, 0x4b, 0xb2, 0x08, 0x10, 0xe1, 0x84, 0x10, 0x25, 0x08, 0xd1, 0x08, 
-    0x21, 0xfa, 0x60, 0x04, 0x51, 0xa1, 0x44, 0x28, 0x21, 0x47, 0x11, 0xfd, 0xd0, 
-    0x62, 0x0e, 0xb2, 0x5c, 0x34, 0x5c, 0x84, 0xe3, 0xd1, 0xf8, 0x90, 0x8d, 0x21, 
-    0xe6, 0x50, 0x1a, 0x67, 0x11, 0x12, 0xe0, 0xe3, 0x43, 0x44, 0xb4, 0x88, 0xc3, 
-    0x58, 0xb9, 0x4c, 0x20, 0x23, 0x02, 0x47, 0x1a, 0x64, 0x44, 0x8b, 0x3e, 0x74, 
-    0x71, 0x11, 0x2e, 0x0b, 0xc8, 0x38, 0x41, 0x94, 0x66, 0x0c, 0x34, 0xc6, 0x94, 
-    0x41, 0x92, 0x72, 0x65, 0x96, 0xe1, 0xf5, 0x18, 0xe5, 0x20, 0x8e, 0xc0, 0xa0, 
-    0x5f, 0x88, 0x51, 0x88, 0x79, 0x4b, 0x2b, 0xa5, 0x5c, 0x72, 0x40, 0x84, 0x0d, 
-    0x44, 0x39, 0xd0, 0x2a, 0xb3, 0x90, 0x82, 0x89, 0x24, 0x98, 0x9c, 0x32, 0x4b, 
-    0x29, 0x37, 0x0d, 0x34, 0x67, 0x67, 0x66, 0xda, 0xf9, 0x07, 0x5a, 0xab, 0xcc, 
-    0x61, 0x90, 0x02, 0x9d, 0x19, 0x69, 0x27, 0x41, 0xa5, 0xc5, 0x02, 0x51, 0x01, 
-    0x8d, 0x05, 0xf8, 0x28, 0xa4, 0x17, 0x51, 0x05, 0x51, 0x03, 0x85, 0x5e, 0xba, 
-    0xc6, 0x28, 0xa6, 0x98, 0x82, 0x0a, 0x22, 0x77, 0x5c, 0x7a, 0xe4, 0x1b, 0x76, 
-    0xa4, 0x9a, 0x6a, 0x1f, 0x74, 0x98, 0xea, 0xe3, 0x1f, 0xb0, 0xbc, 0x49, 0xf2, 
-    0x8a, 0x2b, 0xae, 0x68, 0xb2, 0x86, 0xab, 0x34, 0x3a, 0x68, 0x11, 0x5d, 0xb8, 
-    0x46, 0x64, 0x95, 0x69, 0x52, 0xf4, 0xfa, 0x90, 0x21, 0xa1, 0x29, 0x77, 0x91, 
-    0x23, 0xc2, 0x1e, 0x54, 0x1a, 0x6d, 0x16, 0x69, 0x9a, 0x6c, 0x66, 0x2c, 0x99, 
-    0x74, 0x91, 0x24, 0xcf, 0x0e, 0xe4, 0xc8, 0x4f, 0xd2, 0x8a, 0x85, 0x45, 0x05, 
-    0xd5, 0xea, 0x12, 0x5d, 0xb6, 0xa9, 0x50, 0x20, 0x41, 0xb5, 0xbf, 0x46, 0x7b, 
-    0x51, 0x2a, 0x0d, 0x30, 0x10, 0x65, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x12, 
-    0x00, 0x46, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x29, 0x00, 0x86, 
-    0x0f, 0x0f, 0x0f, 0x1a, 0x1a, 0x1b, 0x24, 0x24, 0x24, 0x27, 0x27, 0x28, 0x2f, 
-    0x2f, 0x30, 0x36, 0x35, 0x36, 0x3b, 0x3b, 0x3c, 0x3d, 0x3c, 0x48, 0x3f, 0x3f, 
-    0x40, 0x46, 0x45, 0x51, 0x48, 0x47, 0x53, 0x4b, 0x4b, 0x4b, 0x4e, 0x2e, 0x2b, 
-    0x4e, 0x30, 0x2d, 0x54, 0x36, 0x32, 0x55, 0x54, 0x5a, 0x55, 0x54, 0x64, 0x56, 
-    0x56, 0x6d, 0x57, 0x3b, 0x38, 0x58, 0x3b, 0x37, 0x58, 0x57, 0x58, 0x59, 0x59, 
-    0x6e, 0x5a, 0x3d, 0x3a, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x63, 0x61, 0x61, 0x76, 
-    0x65, 0x41, 0x49, 0x65, 0x65, 0x7a, 0x66, 0x4b, 0x49, 0x66, 0x65, 0x6b, 0x68, 
-    0x4c, 0x49, 0x68, 0x61, 0x71, 0x68, 0x67, 0x7c, 0x6a, 0x69, 0x75, 0x6a, 0x6a, 
-    0x7e, 0x6c, 0x31, 0x31, 0x6c, 0x6b, 0x6c, 0x6d, 0x6d, 0x81, 0x70, 0x57, 0x54, 
-    0x70, 0x6f, 0x78, 0x70, 0x70, 0x71, 0x73, 0x73, 0x85, 0x74, 0x32, 0x32, 0x75, 
-    0x3d, 0x3d, 0x75, 0x74, 0x7e, 0x76, 0x76, 0x88, 0x78, 0x6f, 0x7a, 0x79, 0x61, 
-    0x5d, 0x7b, 0x7b, 0x8c, 0x7e, 0x66, 0x64, 0x81, 0x81, 0x81, 0x82, 0x4e, 0x4e, 
-    0x83, 0x52, 0x52, 0x83, 0x83, 0x93, 0x86, 0x5b, 0x5d, 0x87, 0x72, 0x70, 0x88, 
-    0x88, 0x97, 0x8b, 0x8b, 0x9b, 0x8d, 0x79, 0x77, 0x91, 0x91, 0x9f, 0x94, 0x94, 
-    0xa2, 0x99, 0x99, 0xa7, 0x9d, 0x9d, 0xaa, 0xa2, 0xa2, 0xae, 0xa5, 0xa5, 0xb1, 
-    0xa8, 0x95, 0x94, 0xa8, 0xa8, 0xb4, 0xaa, 0x8a, 0x8a, 0xac, 0x9b, 0x9a, 0xb3, 
-    0xa6, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x76, 0x80, 0x46, 0x82, 0x83, 
-    0x84, 0x85, 0x86, 0x87, 0x46, 0x3e, 0x30, 0x88, 0x8c, 0x8d, 0x8e, 0x8f, 0x8d, 
-    0x42, 0x90, 0x93, 0x86, 0x3f, 0x88, 0x96, 0x84, 0x35, 0x94, 0x9b, 0x9c, 0x9d, 
-    0x94, 0x18, 0x9e, 0xa1, 0x83, 0x32, 0xa2, 0xa5, 0x8f, 0x98, 0xa6, 0xa5, 0x24, 
-    0xa9, 0xa3, 0x90, 0xa4, 0xac, 0x02, 0xac, 0x93, 0x00, 0xb2, 0xb5, 0xb5, 0x03, 
-    0xb6, 0x90, 0x38, 0xb9, 0x82, 0x05, 0x85, 0xb8, 0xbc, 0xb2, 0x9a, 0xc1, 0xc4, 
-    0x88, 0xc3, 0xc5, 0xc8, 0xc9, 0xca, 0xcb, 0x83, 0xc0, 0x85, 0x08, 0xc1, 0xce, 
-    0xa5, 0x40, 0x86, 0x26, 0x90, 0xd2, 0xb6, 0x01, 0x85, 0xda, 0x9d, 0x3b, 0x86, 
-    0xbb, 0xcc, 0xe1, 0xc8, 0x34, 0xe2, 0xcc, 0xde, 0x84, 0x45, 0xe5, 0xea, 0xeb, 
-    0xec, 0xed, 0xac, 0x28, 0xe1, 0xd0, 0xcc, 0xd8, 0x8e, 0x81, 0x00, 0x21, 0xf9, 
-    0x04, 0x09, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 
-    0x36, 0x00, 0x00, 0x08, 0xff, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 
-    0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a, 
-    0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 
-    0xc7, 0x8f, 0x20, 0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28, 0x53, 
-    0xaa, 0x5c, 0xc9, 0x32, 0xa1, 0x22, 0x82, 0x5f, 0x5a, 0x62, 0x1c, 0x54, 0xd0, 
-    0x91, 0x16, 0x99, 0x03, 0x41, 0x31, 0x7c, 0x89, 0x73, 0x21, 0x4d, 0x82, 0xf5, 
-    0x10, 0x0e, 0xd2, 0xc3, 0x28, 0x21, 0x1e, 0x96, 0x3f, 0x13, 0xd6, 0x00, 0x10, 
-    0x13, 0x00, 0x9f, 0x9e, 0x1a, 0x91, 0x00, 0x28, 0x0a, 0x15, 0x40, 0xd2, 0x87, 
-    0x98, 0x06, 0x8a, 0x48, 0xa8, 0x07, 0x27, 0x24, 0x00, 0xaa, 0x0e, 0xf6, 0x21, 
-    0xc8, 0x21, 0x5e, 0xc2, 0xab, 0x2a, 0x1f, 0x10, 0xc4, 0xf4, 0x13, 0xed, 0xc0, 
-    0xa0, 0x32, 0x1d, 0x1d, 0xd4, 0xf4, 0x90, 0xa6, 0xdb, 0x81, 0xe3, 0x4a, 0x8e, 
-    0x35, 0x28, 0x49, 0x8d, 0x40, 0x4b, 0xb8, 0x1a, 0xde, 0x33, 0x38, 0xc8, 0x46, 
-    0x49, 0x17, 0x18, 0x25, 0x09, 0xbc, 0x2b, 0x50, 0xd7, 0x48, 0xc4, 0x17, 0x15, 
-    0x57, 0xf5, 0xc8, 0x88, 0xc3, 0x64, 0x85, 0x4f, 0x13, 0xa2, 0x2a, 0x78, 0xe0, 
-    0xb2, 0xe7, 0x82, 0x37, 0x2b, 0x82, 0x69, 0x68, 0xe0, 0x24, 0xd5, 0x83, 0xa7, 
-    0x1b, 0x6e, 0x2d, 0x28, 0x80, 0x65, 0xea, 0xcf, 0xb0, 0x63, 0x1f, 0xec, 0x2c, 
-    0x7b, 0xe0, 0xde, 0xda, 0x07, 0x87, 0x45, 0x0c, 0x86, 0xbb, 0xe0, 0xeb, 0x81, 
-    0x12, 0x7a, 0xcb, 0x19, 0xf8, 0xdb, 0x73, 0xe8, 0x84, 0x83, 0x41, 0xd1, 0x96, 
-    0x3d, 0x58, 0x20, 0x2e, 0x76, 0x70, 0x9b, 0xf6, 0x1e, 0xc8, 0x98, 0x60, 0x82, 
-    0xde, 0xb7, 0x15, 0x96, 0x06, 0xb0, 0xbd, 0xf6, 0xf0, 0x84, 0x0d, 0x96, 0x7b, 
-    0x34, 0x3e, 0xf2, 0x0e, 0x00, 0x3c, 0x79, 0x00, 0x6e, 0x4d, 0x67, 0xb8, 0x64, 
-    0x3d, 0x41, 0x72, 0x63, 0xf1, 0xd9, 0xb3, 0xe7, 0xbe, 0x7e, 0x45, 0x49, 0x90, 
-    0xdd, 0x4b, 0xb6, 0x5f, 0x30, 0x7b, 0xd2, 0xef, 0xfc, 0x1d, 0xc5, 0x9f, 0x41, 
-    0x02, 0x0e, 0x48, 0x50, 0x81, 0x00, 0x48, 0x13, 0x4d, 0x6f, 0x6b, 0x40, 0x15, 
-    0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x9d, 0x00, 0x2c, 0x0d, 0x00, 
-    0x0d, 0x00, 0x3d, 0x00, 0x29, 0x00, 0x87, 0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 
-    0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x13, 0x13, 0x14, 0x16, 0x15, 0x1a, 0x1b, 
-    0x1b, 0x1c, 0x1d, 0x1c, 0x24, 0x20, 0x1f, 0x1f, 0x23, 0x23, 0x23, 0x26, 0x25, 
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x34, 0x34, 0x31, 0x3f, 0x34, 0x34, 0x34, 
-    0x3a, 0x39, 0x44, 0x3b, 0x3b, 0x3c, 0x43, 0x43, 0x43, 0x46, 0x22, 0x1d, 0x49, 
-    0x26, 0x22, 0x4a, 0x49, 0x52, 0x4b, 0x23, 0x1d, 0x4b, 0x2a, 0x26, 0x4b, 0x32, 
-    0x35, 0x4b, 0x3a, 0x46, 0x4b, 0x42, 0x4d, 0x4b, 0x4b, 0x4b, 0x4c, 0x42, 0x53, 
-    0x4c, 0x45, 0x5a, 0x4d, 0x49, 0x5d, 0x4e, 0x3e, 0x4b, 0x4e, 0x4c, 0x62, 0x50, 
-    0x3c, 0x48, 0x51, 0x25, 0x1f, 0x51, 0x3a, 0x44, 0x51, 0x4e, 0x64, 0x53, 0x27, 
-    0x20, 0x53, 0x31, 0x2e, 0x53, 0x36, 0x3c, 0x54, 0x54, 0x54, 0x55, 0x33, 0x34, 
-    0x56, 0x28, 0x21, 0x56, 0x55, 0x66, 0x56, 0x55, 0x6c, 0x57, 0x2f, 0x2e, 0x57, 
-    0x57, 0x58, 0x58, 0x2d, 0x2a, 0x58, 0x39, 0x37, 0x59, 0x59, 0x6e, 0x5a, 0x29, 
-    0x22, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x72, 0x5d, 0x41, 0x3d, 0x61, 0x61, 0x76, 
-    0x63, 0x5b, 0x6d, 0x63, 0x63, 0x63, 0x64, 0x48, 0x45, 0x65, 0x65, 0x7a, 0x66, 
-    0x66, 0x6a, 0x69, 0x69, 0x78, 0x6a, 0x6a, 0x7e, 0x6b, 0x6b, 0x6c, 0x6c, 0x2c, 
-    0x2e, 0x6d, 0x6d, 0x81, 0x6f, 0x56, 0x53, 0x6f, 0x70, 0x83, 0x72, 0x2b, 0x2b, 
-    0x72, 0x72, 0x85, 0x73, 0x25, 0x26, 0x73, 0x73, 0x73, 0x74, 0x5b, 0x58, 0x76, 
-    0x76, 0x89, 0x77, 0x77, 0x78, 0x78, 0x25, 0x26, 0x78, 0x3a, 0x3a, 0x78, 0x77, 
-    0x88, 0x79, 0x60, 0x5d, 0x7a, 0x32, 0x32, 0x7a, 0x44, 0x44, 0x7a, 0x68, 0x69, 
-    0x7b, 0x2c, 0x2d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8c, 0x7f, 0x7f, 0x90, 0x7f, 
-    0x80, 0x91, 0x81, 0x4d, 0x4d, 0x83, 0x83, 0x93, 0x84, 0x84, 0x84, 0x86, 0x55, 
-    0x55, 0x87, 0x2d, 0x2d, 0x89, 0x89, 0x97, 0x8a, 0x7e, 0x85, 0x8a, 0x8a, 0x8b, 
-    0x8b, 0x2f, 0x30, 0x8c, 0x76, 0x75, 0x8c, 0x8c, 0x9b, 0x8f, 0x30, 0x31, 0x91, 
-    0x2f, 0x2f, 0x91, 0x6e, 0x6e, 0x91, 0x91, 0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 
-    0x93, 0x94, 0x94, 0xa2, 0x95, 0x6b, 0x6b, 0x95, 0x73, 0x1b, 0x97, 0x8a, 0x8c, 
-    0x98, 0x97, 0xa5, 0x99, 0x34, 0x34, 0x9b, 0x9b, 0x9b, 0x9c, 0x7b, 0x1a, 0x9c, 
-    0x9c, 0xa9, 0x9e, 0x81, 0x38, 0xa1, 0xa1, 0xad, 0xa2, 0x7d, 0x7d, 0xa3, 0xa3, 
-    0xa3, 0xa5, 0xa5, 0xb1, 0xa7, 0xa8, 0xb3, 0xa8, 0x86, 0x86, 0xab, 0xab, 0xb5, 
-    0xac, 0xac, 0xad, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x8f, 0xaf, 0x97, 0x61, 0xb2, 
-    0x9c, 0x65, 0xb2, 0xb2, 0xbd, 0xb3, 0xb3, 0xb3, 0xb5, 0x98, 0x98, 0xb7, 0xb7, 
-    0xc0, 0xb8, 0xa2, 0x6e, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 0xa4, 0xa4, 
-    0xbd, 0xbd, 0xc6, 0xc1, 0xab, 0xab, 0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xcb, 0xc7, 
-    0xb8, 0xb9, 0xca, 0xc5, 0xcb, 0xca, 0xca, 0xcd, 0xcc, 0xcc, 0xd3, 0xd3, 0xd3, 
-    0xd5, 0xd5, 0xd5, 0xda, 0xd6, 0xc8, 0xc8, 0xd9, 0xcb, 0xcb, 0xdb, 0xdb, 0xde, 
-    0xdd, 0xdd, 0xe2, 0xde, 0xd2, 0xd1, 0xe2, 0xe2, 0xe5, 0xe3, 0xd9, 0xd9, 0xe6, 
-    0xe6, 0xe9, 0xeb, 0xe3, 0xe3, 0xeb, 0xeb, 0xed, 0xef, 0xef, 0xf1, 0xf3, 0xf3, 
-    0xf4, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x3b, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x4b, 0xf0, 0x1c, 0x32, 0x14, 0xc8, 0xcc, 
-    0xc1, 0x87, 0x10, 0x23, 0x4a, 0x7c, 0x68, 0x65, 0x11, 0x26, 0x4e, 0x18, 0x31, 
-    0x5e, 0x3a, 0xa4, 0x65, 0xa2, 0xc7, 0x88, 0x09, 0x09, 0xf1, 0xe9, 0xf8, 0x70, 
-    0x4c, 0xa5, 0x4d, 0x82, 0x38, 0x61, 0xba, 0x94, 0x51, 0x25, 0x9f, 0x8f, 0x30, 
-    0x07, 0xd2, 0x69, 0xb4, 0xa9, 0xe5, 0x24, 0x8e, 0x05, 0xcd, 0x54, 0xca, 0x04, 
-    0xa9, 0xe6, 0x25, 0x48, 0x2d, 0x31, 0x1a, 0x8a, 0xf9, 0x51, 0x51, 0xd0, 0x96, 
-    0x9b, 0x18, 0xc1, 0x11, 0x88, 0xe7, 0x92, 0xa6, 0x49, 0x9a, 0x32, 0x1a, 0x3a, 
-    0xca, 0xe9, 0x0f, 0x51, 0x89, 0x46, 0xa9, 0x06, 0xc5, 0x54, 0xe9, 0x27, 0x23, 
-    0x07, 0x29, 0x31, 0x4d, 0xda, 0x74, 0x31, 0x68, 0x26, 0x87, 0x57, 0x0f, 0xe2, 
-    0xd1, 0x4a, 0x15, 0x92, 0x26, 0x48, 0x8d, 0x7a, 0x38, 0x3d, 0xc1, 0xa5, 0x92, 
-    0xd6, 0x45, 0x69, 0x0d, 0x4e, 0x61, 0x19, 0x74, 0x51, 0x99, 0x32, 0x7d, 0x26, 
-    0x65, 0x8c, 0x44, 0xb6, 0x2c, 0xa7, 0x49, 0x0b, 0x26, 0x2d, 0xd2, 0x7a, 0x29, 
-    0x6f, 0xc1, 0x40, 0x47, 0x27, 0x09, 0x00, 0x40, 0x59, 0xc0, 0x1d, 0x8c, 0x91, 
-    0x30, 0x46, 0x6d, 0x99, 0x29, 0xd2, 0xe6, 0xa3, 0x6a, 0x1c, 0x0f, 0x6c, 0x74, 
-    0xf4, 0xd2, 0x02, 0xca, 0x94, 0x1d, 0xd4, 0xdc, 0xf4, 0x39, 0xe3, 0xdb, 0xc3, 
-    0x54, 0x27, 0xc9, 0x10, 0xdd, 0x69, 0x48, 0xa6, 0xd8, 0x6c, 0x5a, 0x2c, 0x38, 
-    0x91, 0x92, 0x6d, 0xcd, 0x95, 0xa5, 0x23, 0x00, 0x48, 0x20, 0x5a, 0x0d, 0xdb, 
-    0xe3, 0x66, 0x2b, 0x91, 0x0e, 0xba, 0xa9, 0x07, 0x65, 0xe2, 0x8e, 0x8d, 0x23, 
-    0x9f, 0x9e, 0xe9, 0xf6, 0xd1, 0x3b, 0xa8, 0x07, 0x88, 0x96, 0xd2, 0x7a, 0xba, 
-    0x77, 0x8c, 0x95, 0x12, 0xa0, 0xff, 0x06, 0x00, 0x41, 0xf4, 0xf2, 0xef, 0xae, 
-    0xad, 0x6b, 0xe5, 0x32, 0x1e, 0x80, 0x02, 0xd1, 0x70, 0xba, 0x23, 0x87, 0x54, 
-    0xe6, 0x05, 0x8a, 0x28, 0x40, 0x8f, 0x46, 0x1a, 0xd0, 0xbe, 0x00, 0x6d, 0x3c, 
-    0xf2, 0x51, 0x75, 0x09, 0x1e, 0x02, 0xa5, 0x10, 0x43, 0x0c, 0x2f, 0x9c, 0x97, 
-    0x51, 0x19, 0xed, 0x01, 0xa0, 0x1d, 0x6d, 0x6e, 0xe4, 0xa7, 0x55, 0x26, 0x87, 
-    0x48, 0x31, 0x10, 0x0b, 0x07, 0xc6, 0x00, 0x84, 0x7a, 0x9c, 0x64, 0x72, 0x5a, 
-    0x7b, 0x0e, 0xd0, 0x36, 0x90, 0x1b, 0x8a, 0x44, 0x92, 0xc9, 0x6a, 0x98, 0x40, 
-    0x42, 0x08, 0x15, 0x05, 0xbd, 0x90, 0x61, 0x0c, 0x53, 0x65, 0xc4, 0x48, 0x83, 
-    0xc3, 0x89, 0x58, 0x50, 0x10, 0x3c, 0x04, 0x31, 0x04, 0x44, 0x18, 0x66, 0xc8, 
-    0x45, 0x4b, 0xd8, 0x35, 0xb8, 0x80, 0x8d, 0x44, 0xf5, 0x78, 0x20, 0x10, 0x2d, 
-    0x5d, 0x41, 0x23, 0x01, 0x44, 0xc6, 0xe4, 0x62, 0x86, 0x34, 0xd4, 0x84, 0x91, 
-    0x06, 0x34, 0x22, 0xd0, 0x24, 0x4c, 0x46, 0xc6, 0x60, 0x84, 0x6b, 0x1f, 0xb6, 
-    0x07, 0xdd, 0x95, 0x12, 0xe1, 0xf0, 0x62, 0x0c, 0x6c, 0x64, 0x94, 0x09, 0x02, 
-    0x0d, 0x06, 0x00, 0xe6, 0x43, 0x3f, 0x0c, 0x84, 0x83, 0x0b, 0x2f, 0xe2, 0x60, 
-    0x17, 0x46, 0x99, 0x88, 0xd7, 0x1e, 0x93, 0x6b, 0x1a, 0x74, 0x04, 0x1d, 0x63, 
-    0xd0, 0x30, 0xe6, 0x13, 0x99, 0x61, 0xd2, 0x88, 0x22, 0x78, 0x18, 0xd0, 0x60, 
-    0x04, 0x79, 0x1e, 0x64, 0x52, 0x25, 0x86, 0xf4, 0x71, 0x87, 0x20, 0x90, 0x5c, 
-    0xa2, 0x48, 0x68, 0x03, 0xd9, 0x89, 0x9a, 0x01, 0x89, 0x3e, 0x44, 0x47, 0x50, 
-    0x8c, 0x4c, 0x61, 0x50, 0x97, 0x0e, 0x66, 0x0a, 0x91, 0x61, 0x91, 0x40, 0x44, 
-    0x40, 0x65, 0xa2, 0x8e, 0x9a, 0x51, 0x20, 0x11, 0x29, 0x30, 0x64, 0xaa, 0x07, 
-    0x61, 0x60, 0xe1, 0xc8, 0xac, 0x8e, 0x78, 0x01, 0xeb, 0x55, 0x5d, 0x80, 0xd1, 
-    0xc5, 0xae, 0xb9, 0x66, 0x71, 0x6b, 0x4c, 0x6c, 0x50, 0x42, 0x89, 0x24, 0xc4, 
-    0xca, 0x81, 0xc5, 0xaf, 0x30, 0x65, 0xd6, 0x12, 0x23, 0xc8, 0x7e, 0x44, 0xc8, 
-    0x51, 0x98, 0x34, 0x3b, 0x91, 0x1b, 0x9b, 0x61, 0xa2, 0x1e, 0xa5, 0xd2, 0x3e, 
-    0x24, 0x18, 0x46, 0x12, 0x72, 0x72, 0x48, 0xb6, 0x0f, 0x2d, 0x96, 0x91, 0x82, 
-    0x72, 0x80, 0x6b, 0x90, 0x1d, 0x9c, 0x66, 0x74, 0xc9, 0x0d, 0x1c, 0x98, 0x4b, 
-    0xd0, 0x9c, 0xe3, 0x8e, 0xbb, 0xc0, 0x03, 0xee, 0x0a, 0x04, 0x59, 0x50, 0xe7, 
-    0x31, 0x62, 0xc0, 0x7b, 0xa9, 0x06, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 
-    0x00, 0x99, 0x00, 0x2c, 0x0d, 0x00, 0x0d, 0x00, 0x3d, 0x00, 0x29, 0x00, 0x87, 
-    0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x13, 
-    0x13, 0x14, 0x16, 0x15, 0x1a, 0x1b, 0x1b, 0x1c, 0x1d, 0x1c, 0x24, 0x20, 0x1f, 
-    0x1f, 0x23, 0x23, 0x23, 0x26, 0x25, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x34, 
-    0x34, 0x31, 0x3f, 0x34, 0x34, 0x34, 0x3a, 0x39, 0x44, 0x3b, 0x3b, 0x3c, 0x43, 
-    0x43, 0x43, 0x46, 0x22, 0x1d, 0x49, 0x26, 0x22, 0x4a, 0x49, 0x52, 0x4b, 0x23, 
-    0x1d, 0x4b, 0x2a, 0x26, 0x4b, 0x32, 0x35, 0x4b, 0x3a, 0x46, 0x4b, 0x42, 0x4d, 
-    0x4b, 0x4b, 0x4b, 0x4c, 0x42, 0x53, 0x4c, 0x45, 0x5a, 0x4d, 0x49, 0x5d, 0x4e, 
-    0x3e, 0x4b, 0x4e, 0x4c, 0x62, 0x50, 0x3c, 0x48, 0x51, 0x25, 0x1f, 0x51, 0x3a, 
-    0x44, 0x51, 0x4e, 0x64, 0x53, 0x27, 0x20, 0x53, 0x31, 0x2e, 0x53, 0x36, 0x3c, 
-    0x54, 0x54, 0x54, 0x55, 0x33, 0x34, 0x56, 0x28, 0x21, 0x56, 0x55, 0x66, 0x56, 
-    0x55, 0x6c, 0x57, 0x2f, 0x2e, 0x57, 0x57, 0x58, 0x58, 0x2d, 0x2a, 0x58, 0x39, 
-    0x37, 0x59, 0x59, 0x6e, 0x5a, 0x29, 0x22, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x72, 
-    0x5d, 0x41, 0x3d, 0x61, 0x61, 0x76, 0x63, 0x5b, 0x6d, 0x63, 0x63, 0x63, 0x64, 
-    0x48, 0x45, 0x65, 0x65, 0x7a, 0x66, 0x66, 0x6a, 0x69, 0x69, 0x78, 0x6a, 0x6a, 
-    0x7e, 0x6b, 0x6b, 0x6c, 0x6c, 0x2c, 0x2e, 0x6d, 0x6d, 0x81, 0x6f, 0x56, 0x53, 
-    0x6f, 0x70, 0x83, 0x72, 0x2b, 0x2b, 0x72, 0x72, 0x85, 0x73, 0x25, 0x26, 0x73, 
-    0x73, 0x73, 0x74, 0x5b, 0x58, 0x76, 0x76, 0x89, 0x77, 0x77, 0x78, 0x78, 0x25, 
-    0x26, 0x78, 0x3a, 0x3a, 0x78, 0x77, 0x88, 0x79, 0x60, 0x5d, 0x7a, 0x32, 0x32, 
-    0x7a, 0x44, 0x44, 0x7a, 0x68, 0x69, 0x7b, 0x2c, 0x2d, 0x7b, 0x7b, 0x7b, 0x7b, 
-    0x7b, 0x8c, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x81, 0x4d, 0x4d, 0x83, 0x83, 
-    0x93, 0x84, 0x84, 0x84, 0x86, 0x55, 0x55, 0x87, 0x2d, 0x2d, 0x89, 0x89, 0x97, 
-    0x8a, 0x7e, 0x85, 0x8a, 0x8a, 0x8b, 0x8b, 0x2f, 0x30, 0x8c, 0x76, 0x75, 0x8c, 
-    0x8c, 0x9b, 0x8f, 0x30, 0x31, 0x91, 0x2f, 0x2f, 0x91, 0x6e, 0x6e, 0x91, 0x91, 
-    0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 0x93, 0x94, 0x94, 0xa2, 0x95, 0x6b, 0x6b, 
-    0x97, 0x8a, 0x8c, 0x98, 0x97, 0xa5, 0x99, 0x34, 0x34, 0x9b, 0x9b, 0x9b, 0x9c, 
-    0x9c, 0xa9, 0xa1, 0xa1, 0xad, 0xa2, 0x7d, 0x7d, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 
-    0xb1, 0xa7, 0xa8, 0xb3, 0xa8, 0x86, 0x86, 0xab, 0xab, 0xb5, 0xac, 0xac, 0xad, 
-    0xae, 0xae, 0xb9, 0xaf, 0x90, 0x8f, 0xaf, 0x97, 0x61, 0xb2, 0xb2, 0xbd, 0xb3, 
-    0xb3, 0xb3, 0xb4, 0x9d, 0x68, 0xb5, 0x98, 0x98, 0xb7, 0xb7, 0xc0, 0xbb, 0xbb, 
-    0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 0xa4, 0xa4, 0xbd, 0xbd, 0xc6, 0xc1, 0xab, 0xab, 
-    0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xcb, 0xc7, 0xb8, 0xb9, 0xca, 0xc5, 0xcb, 0xca, 
-    0xca, 0xcd, 0xcc, 0xcc, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xda, 0xd6, 0xc8, 
-    0xc8, 0xd9, 0xcb, 0xcb, 0xdb, 0xdb, 0xde, 0xdd, 0xdd, 0xe2, 0xde, 0xd2, 0xd1, 
-    0xe2, 0xe2, 0xe5, 0xe3, 0xd9, 0xd9, 0xe6, 0xe6, 0xe9, 0xeb, 0xe3, 0xe3, 0xeb, 
-    0xeb, 0xed, 0xef, 0xef, 0xf1, 0xf3, 0xf3, 0xf4, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 
-    0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0xff, 0x00, 0x33, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x4b, 
-    0xea, 0x0c, 0x12, 0xd4, 0xc7, 0xcc, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x7c, 0x68, 
-    0xe5, 0x10, 0x25, 0x4c, 0x18, 0x31, 0x4e, 0x1a, 0xa4, 0x65, 0xa2, 0xc7, 0x88, 
-    0x09, 0x01, 0xe1, 0xe9, 0xf8, 0x70, 0x4c, 0xa4, 0x4b, 0x7e, 0x30, 0x51, 0x9a, 
-    0x94, 0x51, 0x25, 0x9e, 0x8f, 0x30, 0x07, 0xc6, 0x49, 0x74, 0xa9, 0xe5, 0x23, 
-    0x8e, 0x05, 0xcd, 0x44, 0xaa, 0xc4, 0xa8, 0xe6, 0x24, 0x46, 0x2d, 0x31, 0x0a, 
-    0x8a, 0xf9, 0xd1, 0x50, 0xd0, 0x96, 0x97, 0x10, 0xb5, 0x11, 0x58, 0x67, 0x92, 
-    0xa5, 0x47, 0x96, 0x32, 0x0a, 0x3a, 0x8a, 0x89, 0x0f, 0x51, 0x89, 0x46, 0xa9, 
-    0x06, 0xa5, 0x14, 0xe9, 0x27, 0x22, 0x07, 0x29, 0x29, 0x3d, 0xba, 0x74, 0x31, 
-    0x68, 0x25, 0x87, 0x57, 0x0f, 0xd6, 0xd1, 0x4a, 0x95, 0x91, 0x25, 0x46, 0x89, 
-    0x7a, 0x38, 0x3d, 0xc1, 0x25, 0x92, 0xd6, 0x43, 0x69, 0x0d, 0x4e, 0x61, 0x19, 
-    0xf4, 0x50, 0x99, 0x32, 0x79, 0x1e, 0x65, 0x6c, 0x44, 0xb6, 0x2c, 0xa6, 0x47, 
-    0x0b, 0x1e, 0x1d, 0xd2, 0x3a, 0x29, 0x6f, 0xc1, 0x3e, 0x47, 0x1f, 0x09, 0x00, 
-    0x40, 0x59, 0x00, 0x1d, 0x8c, 0x8d, 0x30, 0x46, 0x6d, 0x59, 0xa9, 0xd1, 0xe6, 
-    0xa3, 0x69, 0x1c, 0x0f, 0x4c, 0x74, 0x74, 0xd2, 0x02, 0xca, 0x94, 0x1d, 0xd4, 
-    0xbc, 0xf4, 0x39, 0xe3, 0xdb, 0xc3, 0x54, 0x1f, 0xc9, 0x10, 0x9d, 0x69, 0x48, 
-    0xa5, 0xd8, 0x6b, 0x5a, 0x2c, 0x38, 0x91, 0x92, 0x6d, 0xcd, 0x95, 0xa5, 0x23, 
-    0x00, 0x48, 0x20, 0x3a, 0x0d, 0xdb, 0xe3, 0x66, 0x23, 0x91, 0x0e, 0x7a, 0xa9, 
-    0x07, 0x65, 0xe2, 0x8e, 0x8d, 0x23, 0x9f, 0x5e, 0xe9, 0xf6, 0x51, 0x3a, 0xa8, 
-    0x07, 0x88, 0x96, 0xd2, 0x7a, 0xba, 0x77, 0x8c, 0x91, 0x12, 0xa0, 0xff, 0x06, 
-    0x00, 0x41, 0xf4, 0xf2, 0xef, 0xae, 0xad, 0x6b, 0xe5, 0x32, 0x1e, 0x80, 0x02, 
-    0xd1, 0x6d, 0xba, 0x23, 0x67, 0x54, 0xe6, 0x05, 0x8a, 0x28, 0x40, 0x8f, 0x36, 
-    0x1a, 0xd0, 0xbe, 0x00, 0xed, 0x3a, 0xf2, 0x51, 0x35, 0x49, 0x1d, 0x02, 0xa5, 
-    0x10, 0x43, 0x0c, 0x2f, 0x9c, 0x97, 0x51, 0x19, 0xed, 0x01, 0xa0, 0x1d, 0x6d, 
-    0x6c, 0xe4, 0xa7, 0x55, 0x25, 0x83, 0x48, 0x31, 0x10, 0x0b, 0x07, 0xc6, 0x00, 
-    0x84, 0x7a, 0x98, 0x54, 0x72, 0x5a, 0x7b, 0x0e, 0xd0, 0x36, 0x10, 0x1b, 0x86, 
-    0x34, 0x52, 0xc9, 0x6a, 0x94, 0x30, 0x02, 0x08, 0x15, 0x05, 0xbd, 0x90, 0x61, 
-    0x0c, 0x53, 0x65, 0x84, 0x48, 0x83, 0xc3, 0x89, 0x58, 0x50, 0x10, 0x3c, 0x04, 
-    0x31, 0x04, 0x44, 0x18, 0x66, 0xc8, 0x45, 0x4b, 0xd8, 0x35, 0xb8, 0x80, 0x8d, 
-    0x44, 0xf5, 0x78, 0x20, 0x10, 0x2d, 0x5d, 0x41, 0x23, 0x01, 0x44, 0xc6, 0xe4, 
-    0x62, 0x86, 0x34, 0xd4, 0x84, 0x91, 0x06, 0x34, 0x22, 0xd0, 0x24, 0x4c, 0x46, 
-    0xc6, 0x60, 0x84, 0x6b, 0x1f, 0xb6, 0x07, 0xdd, 0x95, 0x12, 0xe1, 0xf0, 0x62, 
-    0x0c, 0x6b, 0x64, 0x54, 0x09, 0x02, 0x0d, 0x06, 0x00, 0xe6, 0x43, 0x3f, 0x0c, 
-    0x84, 0x83, 0x0b, 0x2f, 0xe2, 0x60, 0x17, 0x46, 0x95, 0x88, 0xd7, 0x1e, 0x93, 
-    0x6b, 0x1a, 0x74, 0x44, 0x1c, 0x63, 0xd0, 0x30, 0xe6, 0x13, 0x99, 0x51, 0x92, 
-    0x88, 0x21, 0x75, 0x18, 0xd0, 0x60, 0x04, 0x79, 0x1e, 0xf4, 0x45, 0x24, 0x91, 
-    0x08, 0x92, 0x07, 0x1d, 0x7e, 0x30, 0x32, 0x89, 0x21, 0xa1, 0x0d, 0x64, 0x27, 
-    0x6a, 0x06, 0x24, 0xfa, 0x50, 0x1c, 0x41, 0x21, 0x32, 0x85, 0x41, 0x5d, 0x3a, 
-    0xa8, 0x29, 0x44, 0x86, 0x35, 0x02, 0x11, 0x01, 0x95, 0x8d, 0x4a, 0x6a, 0x46, 
-    0x7d, 0x44, 0xa4, 0xc0, 0x90, 0xaa, 0x1e, 0x61, 0x84, 0x85, 0x22, 0xb4, 0x2a, 
-    0xe2, 0x45, 0xac, 0x57, 0x75, 0x01, 0x46, 0x17, 0xbc, 0xea, 0xda, 0x05, 0xae, 
-    0x31, 0xad, 0x01, 0x09, 0x24, 0x8e, 0x14, 0xfb, 0x06, 0x16, 0xc0, 0xc2, 0x94, 
-    0x59, 0x4b, 0x88, 0x24, 0xfb, 0x11, 0x20, 0x47, 0x51, 0xe2, 0xec, 0x44, 0x6c, 
-    0x6c, 0x46, 0x89, 0x7a, 0x95, 0x4e, 0xfb, 0x90, 0x60, 0x18, 0x49, 0x88, 0xc9, 
-    0x20, 0xda, 0x3e, 0xb4, 0x58, 0x46, 0x0a, 0xbe, 0x11, 0xae, 0x41, 0x73, 0x74, 
-    0x9a, 0xd1, 0x24, 0x37, 0x70, 0x70, 0x2e, 0x41, 0x73, 0x92, 0x4b, 0xee, 0x02, 
-    0x0f, 0xbc, 0x2b, 0x10, 0x64, 0x41, 0x9d, 0x87, 0x88, 0x01, 0xef, 0xa9, 0x1a, 
-    0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xc8, 0x00, 0x2c, 0x0c, 0x00, 
-    0x0d, 0x00, 0x3e, 0x00, 0x29, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 
-    0x0d, 0x0d, 0x10, 0x13, 0x13, 0x14, 0x18, 0x17, 0x1b, 0x1b, 0x1b, 0x1c, 0x21, 
-    0x1f, 0x28, 0x24, 0x23, 0x2d, 0x24, 0x24, 0x24, 0x2c, 0x2c, 0x2c, 0x2f, 0x2e, 
-    0x34, 0x31, 0x2f, 0x3c, 0x34, 0x34, 0x34, 0x37, 0x37, 0x3a, 0x3b, 0x3b, 0x3b, 
-    0x3c, 0x3b, 0x46, 0x43, 0x3d, 0x4a, 0x43, 0x43, 0x44, 0x47, 0x22, 0x1d, 0x4a, 
-    0x29, 0x24, 0x4a, 0x4a, 0x4b, 0x4c, 0x23, 0x1e, 0x4c, 0x40, 0x4f, 0x4c, 0x46, 
-    0x5a, 0x4c, 0x48, 0x5c, 0x4d, 0x42, 0x53, 0x4e, 0x38, 0x3c, 0x4e, 0x3e, 0x4c, 
-    0x4e, 0x4c, 0x62, 0x50, 0x4e, 0x63, 0x51, 0x25, 0x1f, 0x52, 0x51, 0x5f, 0x53, 
-    0x3a, 0x43, 0x53, 0x52, 0x53, 0x54, 0x27, 0x20, 0x54, 0x32, 0x2e, 0x55, 0x32, 
-    0x33, 0x55, 0x38, 0x3a, 0x55, 0x49, 0x52, 0x56, 0x54, 0x66, 0x56, 0x56, 0x6c, 
-    0x57, 0x29, 0x22, 0x58, 0x2e, 0x2b, 0x58, 0x58, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 
-    0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 0x65, 
-    0x7a, 0x67, 0x2e, 0x31, 0x6a, 0x6a, 0x7e, 0x6b, 0x6b, 0x6c, 0x6b, 0x6b, 0x75, 
-    0x6d, 0x6e, 0x81, 0x6e, 0x52, 0x51, 0x6e, 0x54, 0x51, 0x70, 0x5f, 0x61, 0x72, 
-    0x72, 0x85, 0x73, 0x73, 0x76, 0x76, 0x76, 0x89, 0x78, 0x6a, 0x6b, 0x79, 0x38, 
-    0x38, 0x7a, 0x29, 0x29, 0x7a, 0x7a, 0x86, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8d, 
-    0x7d, 0x44, 0x44, 0x7d, 0x48, 0x48, 0x7f, 0x7f, 0x90, 0x81, 0x4c, 0x4c, 0x83, 
-    0x5e, 0x07, 0x83, 0x83, 0x84, 0x84, 0x2a, 0x2b, 0x84, 0x84, 0x94, 0x87, 0x57, 
-    0x57, 0x88, 0x64, 0x09, 0x88, 0x6d, 0x6c, 0x89, 0x89, 0x96, 0x8a, 0x8a, 0x8b, 
-    0x8b, 0x2f, 0x30, 0x8c, 0x2d, 0x2d, 0x8c, 0x8c, 0x9b, 0x8d, 0x6a, 0x0a, 0x8d, 
-    0x6b, 0x18, 0x90, 0x90, 0x9f, 0x91, 0x6e, 0x0b, 0x91, 0x6f, 0x17, 0x93, 0x32, 
-    0x32, 0x93, 0x66, 0x66, 0x93, 0x93, 0x93, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x1c, 
-    0x95, 0x75, 0x24, 0x96, 0x74, 0x0c, 0x96, 0x76, 0x2a, 0x96, 0x88, 0x8b, 0x97, 
-    0x75, 0x16, 0x99, 0x99, 0xa6, 0x9a, 0x75, 0x75, 0x9a, 0x7b, 0x24, 0x9a, 0x7b, 
-    0x2b, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x1b, 0x9b, 0x7d, 0x37, 0x9c, 0x7e, 0x33, 
-    0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0xaa, 0x9d, 0x7b, 0x0e, 0x9d, 0x7c, 0x15, 0x9e, 
-    0x80, 0x35, 0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x2c, 0xa0, 0x84, 0x3d, 0xa1, 0x80, 
-    0x0f, 0xa1, 0xa1, 0xae, 0xa2, 0x85, 0x35, 0xa2, 0x86, 0x42, 0xa3, 0x84, 0x1b, 
-    0xa3, 0x84, 0x2a, 0xa3, 0x85, 0x84, 0xa4, 0x83, 0x13, 0xa4, 0x88, 0x45, 0xa4, 
-    0x8b, 0x51, 0xa5, 0x8b, 0x4b, 0xa6, 0xa6, 0xb1, 0xa7, 0x88, 0x19, 0xa8, 0x8e, 
-    0x4e, 0xa8, 0xa8, 0xa8, 0xa9, 0x8f, 0x51, 0xaa, 0x91, 0x54, 0xaa, 0xaa, 0xb5, 
-    0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1a, 0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 
-    0x90, 0x18, 0xaf, 0x96, 0x55, 0xaf, 0x98, 0x60, 0xb0, 0xaf, 0xb9, 0xb2, 0x9b, 
-    0x65, 0xb2, 0xb2, 0xb3, 0xb3, 0x94, 0x17, 0xb3, 0x95, 0x1a, 0xb3, 0xb3, 0xbd, 
-    0xb5, 0x9e, 0x6a, 0xb6, 0x98, 0x17, 0xb6, 0xa1, 0x6d, 0xb7, 0x99, 0x19, 0xb7, 
-    0xb7, 0xc0, 0xb9, 0xa4, 0x6b, 0xb9, 0xa4, 0x73, 0xba, 0x9d, 0x19, 0xba, 0xa6, 
-    0x77, 0xbb, 0xbb, 0xbc, 0xbc, 0xbc, 0xc5, 0xbe, 0xa1, 0x1a, 0xbf, 0xbf, 0xc8, 
-    0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xb3, 0x89, 0xc4, 0xc4, 0xcb, 0xc6, 
-    0xaa, 0x1d, 0xc7, 0xab, 0x21, 0xc9, 0xad, 0x1e, 0xcb, 0xcb, 0xcd, 0xcc, 0xb1, 
-    0x1f, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 0x21, 0xd1, 0xb6, 0x21, 0xd3, 0xd3, 0xd5, 
-    0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd8, 0xbf, 0x24, 0xda, 0xda, 0xdd, 0xdc, 
-    0xc3, 0x26, 0xdc, 0xca, 0x6b, 0xdd, 0xdd, 0xe1, 0xdf, 0xc7, 0x2a, 0xe1, 0xc9, 
-    0x27, 0xe2, 0xe2, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xe6, 0xe9, 0xe7, 0xd0, 0x2b, 
-    0xea, 0xd8, 0x62, 0xeb, 0xd4, 0x2c, 0xec, 0xeb, 0xed, 0xee, 0xd8, 0x2d, 0xee, 
-    0xee, 0xf0, 0xf1, 0xec, 0xec, 0xf2, 0xdc, 0x2e, 0xf3, 0xf3, 0xf4, 0xf4, 0xde, 
-    0x30, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xf7, 0xf7, 0xfa, 0xe5, 0x32, 
-    0xff, 0xeb, 0x34, 0xff, 0xec, 0x3a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x91, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0x41, 0x82, 0x73, 0x3a, 0x29, 0x9c, 0xc3, 0xe3, 0xa0, 
-    0xc3, 0x87, 0x10, 0x23, 0x3e, 0xdc, 0xc4, 0xeb, 0x98, 0x45, 0x8b, 0xbf, 0x4e, 
-    0x89, 0x91, 0xc8, 0x51, 0xa2, 0x0e, 0x1d, 0x36, 0x20, 0x0a, 0x61, 0x75, 0xec, 
-    0xd3, 0x30, 0x61, 0x15, 0x2f, 0x0e, 0x0b, 0xd5, 0xb1, 0x65, 0x41, 0x48, 0xac, 
-    0x2a, 0x0e, 0xd3, 0xa5, 0xea, 0x50, 0xc3, 0x82, 0xac, 0x7e, 0xa9, 0xd2, 0x75, 
-    0x8c, 0x17, 0xc9, 0x8b, 0x16, 0x59, 0xb9, 0x6c, 0xb9, 0x25, 0x16, 0x50, 0xa0, 
-    0xbc, 0x42, 0x49, 0x11, 0x28, 0xc5, 0xd5, 0x31, 0x61, 0x40, 0x35, 0x0d, 0x3b, 
-    0x7a, 0x4c, 0xd5, 0x50, 0x89, 0x62, 0x78, 0x52, 0x05, 0x3a, 0x2c, 0x96, 0x2b, 
-    0x5a, 0xbc, 0x54, 0xb5, 0x00, 0x84, 0x71, 0x98, 0xad, 0xad, 0x90, 0xae, 0x42, 
-    0xa4, 0xb5, 0x75, 0x6b, 0x2c, 0x61, 0xa7, 0x68, 0x0d, 0x38, 0x75, 0xec, 0x49, 
-    0x8d, 0xb3, 0x5b, 0x69, 0xa9, 0x75, 0x18, 0x8a, 0xea, 0x30, 0x55, 0xa5, 0x5c, 
-    0x41, 0xc5, 0x78, 0x96, 0x2d, 0x54, 0x5e, 0x00, 0x34, 0xa9, 0x6a, 0x7b, 0x6c, 
-    0xe3, 0x5e, 0x82, 0x42, 0x52, 0x02, 0x0d, 0x02, 0xa0, 0xb2, 0x82, 0x46, 0x16, 
-    0x69, 0x4d, 0xfd, 0x05, 0x94, 0xad, 0xaa, 0xc1, 0x54, 0x59, 0x3e, 0x1e, 0x58, 
-    0xc9, 0xaf, 0x83, 0xca, 0xa8, 0x8d, 0xf6, 0x74, 0x2b, 0x8c, 0x2d, 0x55, 0x5d, 
-    0x30, 0x46, 0x0f, 0x5c, 0x4c, 0x55, 0x15, 0x0c, 0xd4, 0x2d, 0x38, 0xb7, 0x1d, 
-    0xac, 0x1a, 0xa8, 0xb0, 0xdb, 0x08, 0x64, 0x23, 0x73, 0xbd, 0x95, 0x57, 0x2c, 
-    0x5b, 0x53, 0x19, 0xff, 0xa2, 0xb9, 0x55, 0x4d, 0xe5, 0x00, 0xc2, 0xf1, 0x32, 
-    0x9e, 0x6e, 0x51, 0x98, 0xee, 0xa3, 0xac, 0x02, 0xa0, 0x4e, 0x20, 0x9b, 0x38, 
-    0xf5, 0xef, 0x54, 0x6f, 0xa3, 0xff, 0x2e, 0x20, 0x9b, 0x2e, 0xf8, 0xf3, 0x17, 
-    0x4b, 0xa1, 0xae, 0x4c, 0x40, 0xf6, 0x16, 0xd0, 0xe7, 0x6d, 0x85, 0x52, 0x9c, 
-    0x3c, 0xfc, 0x7a, 0x00, 0x02, 0x84, 0x43, 0xaa, 0x4f, 0x9d, 0xd5, 0x16, 0x64, 
-    0x24, 0xb0, 0xc0, 0x42, 0x0f, 0x5a, 0x01, 0xe5, 0xca, 0x7d, 0x95, 0x09, 0x87, 
-    0xcc, 0x20, 0x05, 0xb6, 0x65, 0xcb, 0x22, 0x03, 0x95, 0x20, 0xe0, 0x80, 0xf0, 
-    0x1d, 0xe3, 0x1c, 0x82, 0x11, 0x28, 0x88, 0xcc, 0x26, 0x6f, 0x51, 0x45, 0xcb, 
-    0x26, 0x05, 0x99, 0x30, 0x21, 0x0b, 0x9f, 0x1c, 0xd5, 0x02, 0x82, 0x00, 0x30, 
-    0xa0, 0xa1, 0x40, 0x36, 0xac, 0x01, 0x49, 0x25, 0x95, 0x30, 0xe4, 0x50, 0x0a, 
-    0x13, 0x06, 0x01, 0xd4, 0x2f, 0x05, 0xa0, 0xa8, 0xe2, 0x8a, 0x2d, 0xd1, 0x28, 
-    0x20, 0x08, 0xa0, 0xc5, 0x82, 0x22, 0x00, 0x43, 0xe9, 0x61, 0xca, 0x2b, 0xa9, 
-    0x24, 0xf2, 0xd8, 0x0d, 0x23, 0x92, 0x70, 0x9d, 0x2a, 0x28, 0x42, 0xd7, 0x11, 
-    0x27, 0xb5, 0x04, 0xb3, 0x8b, 0x2c, 0xb7, 0xf8, 0xf2, 0x98, 0x84, 0x13, 0x96, 
-    0x00, 0x9a, 0x7a, 0x08, 0x4a, 0x29, 0xd1, 0x28, 0xb5, 0xbc, 0x32, 0xcb, 0x2d, 
-    0xc4, 0xe4, 0xe2, 0xc9, 0x63, 0x2a, 0x8c, 0x68, 0x63, 0x7a, 0x28, 0x06, 0xd7, 
-    0xd1, 0x2a, 0xa9, 0x08, 0x84, 0x48, 0x2b, 0xb7, 0xb4, 0x24, 0x04, 0x41, 0x6d, 
-    0x4e, 0xa8, 0x02, 0x6d, 0x16, 0x41, 0x89, 0x20, 0x79, 0x2d, 0xd5, 0x39, 0x90, 
-    0x29, 0x2e, 0xcd, 0x31, 0x88, 0x09, 0x7d, 0xfe, 0xd8, 0xd7, 0x30, 0xb4, 0xa8, 
-    0xb2, 0x49, 0x0d, 0x08, 0x0e, 0xe0, 0x12, 0x27, 0xa6, 0x8c, 0xe2, 0x87, 0x5a, 
-    0x4a, 0xb0, 0xa2, 0x4b, 0x29, 0x8d, 0xa8, 0x01, 0x48, 0x28, 0xc6, 0x55, 0xb2, 
-    0xe7, 0x40, 0x02, 0xdc, 0xc7, 0x9d, 0x44, 0x9c, 0xcc, 0x42, 0x0c, 0x31, 0xb7, 
-    0xdc, 0xe9, 0x02, 0xcc, 0x2a, 0xa4, 0x48, 0x72, 0x95, 0x77, 0xbf, 0x0c, 0x72, 
-    0x50, 0x02, 0xeb, 0x11, 0x1a, 0x51, 0x22, 0xaf, 0xac, 0x32, 0x4b, 0x2b, 0xbb, 
-    0xec, 0x62, 0x4a, 0x2d, 0xbe, 0xac, 0x72, 0x55, 0x27, 0x40, 0xa5, 0xe5, 0x90, 
-    0x76, 0x00, 0xf8, 0xda, 0xd1, 0x28, 0xab, 0xf8, 0x52, 0xcb, 0x2e, 0xb5, 0x14, 
-    0x53, 0xcc, 0x55, 0x90, 0x5c, 0xf4, 0xcb, 0x4d, 0x0e, 0x0d, 0x20, 0xad, 0x4b, 
-    0xb9, 0x14, 0xe3, 0xcb, 0x2b, 0xc4, 0xec, 0x72, 0x15, 0x20, 0xaa, 0xb4, 0xab, 
-    0xc9, 0x12, 0x3c, 0x0e, 0x84, 0xc9, 0x28, 0x9e, 0xe8, 0x81, 0xcc, 0x2b, 0xaf, 
-    0x0c, 0x05, 0x45, 0x14, 0xfc, 0xf6, 0x9b, 0x44, 0xbc, 0xf7, 0x8a, 0x32, 0xd0, 
-    0x2b, 0xb5, 0x0c, 0x05, 0x48, 0x29, 0x08, 0x23, 0xdc, 0x04, 0xc0, 0xc8, 0xe4, 
-    0x32, 0x0a, 0x32, 0xa3, 0xa0, 0x39, 0x8b, 0x4b, 0x4e, 0x48, 0x66, 0x11, 0x88, 
-    0x00, 0x03, 0x93, 0x2f, 0x32, 0x94, 0xe4, 0x32, 0x71, 0x4b, 0xe6, 0x01, 0x25, 
-    0x14, 0xc0, 0xbb, 0x00, 0x83, 0xca, 0x2d, 0xc1, 0x10, 0x63, 0x28, 0x47, 0x7d, 
-    0x5c, 0x24, 0xdd, 0x2f, 0x3a, 0x00, 0x7c, 0x4b, 0x31, 0xad, 0x78, 0x22, 0x4a, 
-    0x2e, 0x4a, 0x72, 0xe4, 0x44, 0x81, 0x4e, 0x5d, 0xa4, 0x6b, 0xbc, 0xa3, 0x14, 
-    0x83, 0xca, 0x2a, 0xbb, 0x08, 0xdc, 0x11, 0xa0, 0xc7, 0xfc, 0x64, 0xd1, 0x13, 
-    0x0c, 0x8f, 0x42, 0xc9, 0x2b, 0x8f, 0x20, 0x13, 0x09, 0x47, 0x87, 0x60, 0x67, 
-    0xd1, 0x30, 0xbc, 0xac, 0xca, 0xf0, 0x50, 0xd2, 0x05, 0x85, 0x11, 0x94, 0x0d, 
-    0x6c, 0xed, 0x12, 0xb3, 0x5c, 0xf5, 0xfc, 0x8b, 0x7a, 0x0b, 0x88, 0x3d, 0x50, 
-    0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xc4, 0x00, 0x2c, 0x0c, 0x00, 
-    0x0d, 0x00, 0x3e, 0x00, 0x29, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 
-    0x0d, 0x0d, 0x10, 0x13, 0x13, 0x14, 0x18, 0x17, 0x1b, 0x1b, 0x1b, 0x1c, 0x21, 
-    0x1f, 0x28, 0x24, 0x23, 0x2d, 0x24, 0x24, 0x24, 0x2c, 0x2c, 0x2c, 0x2f, 0x2e, 
-    0x34, 0x31, 0x2f, 0x3c, 0x34, 0x34, 0x34, 0x37, 0x37, 0x3a, 0x3b, 0x3b, 0x3b, 
-    0x3c, 0x3b, 0x46, 0x43, 0x3d, 0x4a, 0x43, 0x43, 0x44, 0x47, 0x22, 0x1d, 0x4a, 
-    0x29, 0x24, 0x4a, 0x4a, 0x4b, 0x4c, 0x23, 0x1e, 0x4c, 0x40, 0x4f, 0x4c, 0x46, 
-    0x5a, 0x4c, 0x48, 0x5c, 0x4d, 0x42, 0x53, 0x4e, 0x38, 0x3c, 0x4e, 0x3e, 0x4c, 
-    0x4e, 0x4c, 0x62, 0x50, 0x4e, 0x63, 0x51, 0x25, 0x1f, 0x52, 0x51, 0x5f, 0x53, 
-    0x3a, 0x43, 0x53, 0x52, 0x53, 0x54, 0x27, 0x20, 0x54, 0x32, 0x2e, 0x54, 0x35, 
-    0x3a, 0x55, 0x32, 0x33, 0x56, 0x54, 0x66, 0x56, 0x56, 0x6c, 0x57, 0x29, 0x22, 
-    0x57, 0x3a, 0x39, 0x58, 0x2e, 0x2b, 0x58, 0x58, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 
-    0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 0x65, 
-    0x7a, 0x67, 0x2e, 0x31, 0x69, 0x4c, 0x4b, 0x6a, 0x6a, 0x7e, 0x6b, 0x6b, 0x6c, 
-    0x6b, 0x6b, 0x75, 0x6d, 0x6e, 0x81, 0x6e, 0x54, 0x51, 0x70, 0x5f, 0x61, 0x72, 
-    0x72, 0x85, 0x73, 0x73, 0x76, 0x76, 0x5a, 0x59, 0x76, 0x76, 0x89, 0x78, 0x6a, 
-    0x6b, 0x79, 0x38, 0x38, 0x7a, 0x29, 0x29, 0x7a, 0x7a, 0x86, 0x7b, 0x7b, 0x7c, 
-    0x7b, 0x7b, 0x8d, 0x7d, 0x44, 0x44, 0x7d, 0x48, 0x48, 0x7f, 0x7f, 0x90, 0x81, 
-    0x4c, 0x4c, 0x83, 0x5e, 0x08, 0x83, 0x83, 0x84, 0x84, 0x2a, 0x2b, 0x84, 0x84, 
-    0x94, 0x87, 0x57, 0x57, 0x88, 0x6d, 0x6c, 0x89, 0x65, 0x0a, 0x89, 0x89, 0x96, 
-    0x8a, 0x8a, 0x8b, 0x8b, 0x2f, 0x30, 0x8c, 0x2d, 0x2d, 0x8c, 0x8c, 0x9b, 0x8d, 
-    0x6a, 0x0a, 0x90, 0x6e, 0x18, 0x90, 0x90, 0x9f, 0x91, 0x6e, 0x0c, 0x93, 0x32, 
-    0x32, 0x93, 0x66, 0x66, 0x93, 0x93, 0x93, 0x94, 0x94, 0xa2, 0x95, 0x72, 0x0b, 
-    0x95, 0x74, 0x1c, 0x95, 0x75, 0x23, 0x96, 0x88, 0x8b, 0x97, 0x75, 0x16, 0x97, 
-    0x77, 0x2a, 0x99, 0x76, 0x0c, 0x99, 0x99, 0xa6, 0x9a, 0x75, 0x75, 0x9a, 0x7b, 
-    0x2b, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x24, 0x9b, 0x7d, 0x33, 0x9c, 0x7c, 0x1b, 
-    0x9c, 0x7f, 0x39, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0xaa, 0x9d, 0x7b, 0x0e, 0x9d, 
-    0x7c, 0x14, 0x9e, 0x80, 0x36, 0x9e, 0x81, 0x3b, 0x9f, 0x81, 0x2c, 0xa1, 0x80, 
-    0x0f, 0xa1, 0x84, 0x3c, 0xa1, 0xa1, 0xae, 0xa2, 0x83, 0x29, 0xa2, 0x85, 0x33, 
-    0xa2, 0x86, 0x42, 0xa3, 0x85, 0x84, 0xa3, 0xa3, 0xa3, 0xa4, 0x84, 0x13, 0xa4, 
-    0x84, 0x1b, 0xa4, 0x88, 0x45, 0xa5, 0x8b, 0x4b, 0xa6, 0xa6, 0xb1, 0xa7, 0x88, 
-    0x1b, 0xa8, 0x8e, 0x4e, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1a, 
-    0xab, 0x91, 0x55, 0xac, 0xab, 0xac, 0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 
-    0x90, 0x19, 0xaf, 0x98, 0x60, 0xb0, 0xaf, 0xb9, 0xb2, 0x94, 0x17, 0xb2, 0x9b, 
-    0x64, 0xb2, 0xb2, 0xb3, 0xb3, 0x95, 0x1a, 0xb3, 0xb3, 0xbd, 0xb5, 0x9e, 0x6a, 
-    0xb6, 0x99, 0x19, 0xb7, 0xa1, 0x6e, 0xb7, 0xb7, 0xc0, 0xb9, 0xa4, 0x73, 0xba, 
-    0x9c, 0x1a, 0xbb, 0xbb, 0xbc, 0xbc, 0xa9, 0x7a, 0xbc, 0xbc, 0xc5, 0xbe, 0xa1, 
-    0x1b, 0xbf, 0xbf, 0xc8, 0xc2, 0xa5, 0x1c, 0xc2, 0xc2, 0xc3, 0xc4, 0xb2, 0x88, 
-    0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 0x1d, 0xc8, 0xad, 0x22, 0xc8, 0xc7, 0xcf, 0xc9, 
-    0xad, 0x1f, 0xcb, 0xcb, 0xcd, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 
-    0x21, 0xd1, 0xb6, 0x22, 0xd3, 0xd3, 0xd5, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 
-    0xd8, 0xbf, 0x25, 0xda, 0xda, 0xdd, 0xdc, 0xc4, 0x26, 0xdd, 0xdd, 0xe1, 0xdf, 
-    0xc6, 0x28, 0xe1, 0xc9, 0x27, 0xe2, 0xe2, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xe6, 
-    0xe9, 0xe7, 0xd0, 0x2b, 0xeb, 0xd4, 0x2c, 0xec, 0xeb, 0xed, 0xee, 0xd8, 0x2d, 
-    0xee, 0xee, 0xf0, 0xf1, 0xec, 0xec, 0xf2, 0xdc, 0x2e, 0xf3, 0xf3, 0xf4, 0xf4, 
-    0xde, 0x30, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xf7, 0xf7, 0xfa, 0xe5, 
-    0x32, 0xfd, 0xea, 0x3b, 0xff, 0xeb, 0x34, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x89, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0x41, 0x82, 0x74, 0x34, 0x29, 0xa4, 0xd3, 0xe3, 0xa0, 
-    0xc3, 0x87, 0x10, 0x23, 0x3e, 0xc4, 0x84, 0x6b, 0x98, 0x45, 0x8b, 0xbb, 0x4a, 
-    0x8d, 0x91, 0xc8, 0x51, 0xa2, 0x0e, 0x1d, 0x37, 0x20, 0x0e, 0x51, 0x35, 0x8c, 
-    0xd3, 0x2f, 0x5f, 0x15, 0x2f, 0xfe, 0xf2, 0xd4, 0xb1, 0x65, 0xc1, 0x47, 0xaa, 
-    0x2a, 0xfe, 0xb2, 0x85, 0xea, 0x50, 0xc3, 0x82, 0xaa, 0x76, 0xa1, 0xb2, 0x35, 
-    0x0c, 0x17, 0xc9, 0x8b, 0x16, 0x55, 0xb9, 0x6c, 0xb9, 0xc5, 0x15, 0x50, 0xa0, 
-    0xb8, 0x42, 0x4d, 0x11, 0x38, 0x85, 0xd5, 0x30, 0x5f, 0x40, 0x4d, 0x1e, 0x1d, 
-    0x86, 0x6a, 0xa8, 0xc4, 0x31, 0x3c, 0xa7, 0x02, 0xfd, 0xe5, 0x8a, 0x55, 0x2c, 
-    0x5c, 0xa8, 0x5a, 0x14, 0xc2, 0xf8, 0x6b, 0x96, 0xd6, 0x47, 0x56, 0x21, 0xc6, 
-    0xd2, 0xaa, 0xd5, 0x95, 0xaf, 0x52, 0xb1, 0x06, 0x94, 0x1a, 0xa6, 0xc5, 0x86, 
-    0x59, 0xad, 0xb1, 0xd2, 0x3a, 0xf4, 0x34, 0xf5, 0x17, 0xaa, 0x51, 0xac, 0xa0, 
-    0x62, 0x34, 0xbb, 0x16, 0x2a, 0x2e, 0x00, 0x96, 0x50, 0xb1, 0x1d, 0xb6, 0x51, 
-    0x2f, 0xc1, 0x21, 0x29, 0x81, 0x0a, 0x01, 0x40, 0x59, 0x41, 0x23, 0x8b, 0xb1, 
-    0x7e, 0x0d, 0xdb, 0x05, 0x74, 0x2d, 0x2a, 0xc1, 0x53, 0x59, 0x3a, 0x1e, 0x38, 
-    0xa9, 0xaf, 0x03, 0xca, 0xa8, 0x8d, 0xf6, 0x6c, 0xeb, 0x6b, 0xed, 0x54, 0x5b, 
-    0x30, 0x46, 0x0f, 0x54, 0x3c, 0x15, 0x15, 0x0c, 0xd4, 0x2d, 0x38, 0xb3, 0x15, 
-    0xac, 0x1a, 0xa8, 0xaf, 0xdb, 0x08, 0x64, 0x13, 0x73, 0xad, 0x15, 0x97, 0xab, 
-    0x59, 0x9a, 0x17, 0xef, 0xa2, 0xa9, 0x75, 0x0d, 0xe5, 0x00, 0xc2, 0xef, 0x2e, 
-    0x9e, 0x6e, 0xd1, 0x97, 0xee, 0xa3, 0xa8, 0x02, 0xa0, 0x4e, 0x20, 0x9b, 0x38, 
-    0xf5, 0xef, 0x47, 0x7f, 0xd5, 0xff, 0x40, 0x0d, 0xa0, 0x80, 0xec, 0xb9, 0xe0, 
-    0xd3, 0x5f, 0x1c, 0x45, 0x1e, 0x00, 0x01, 0xd9, 0x5b, 0x40, 0xa7, 0x9f, 0xe5, 
-    0x29, 0x71, 0xf2, 0xa9, 0xb7, 0xc9, 0x0b, 0x10, 0xfe, 0xe8, 0x3e, 0x75, 0x55, 
-    0x5b, 0x10, 0x93, 0x02, 0x0b, 0x2c, 0xf8, 0x90, 0x15, 0x50, 0xac, 0xb4, 0x47, 
-    0x99, 0x70, 0xc4, 0x04, 0x72, 0x20, 0x5b, 0xb3, 0x28, 0x32, 0xd0, 0x80, 0x04, 
-    0xfa, 0x20, 0xdf, 0x30, 0x79, 0x28, 0x08, 0x80, 0x03, 0x0c, 0x12, 0x83, 0x89, 
-    0x5b, 0x53, 0xb9, 0x32, 0x49, 0x41, 0x33, 0x10, 0x48, 0x20, 0x27, 0x47, 0xb5, 
-    0xa0, 0xa1, 0x02, 0x1d, 0x0a, 0x74, 0x03, 0x1b, 0x8f, 0x4c, 0x32, 0x09, 0x43, 
-    0x0e, 0xa1, 0x60, 0xa2, 0x10, 0x40, 0xed, 0x52, 0x80, 0x86, 0x0c, 0xb4, 0xe8, 
-    0x92, 0x8d, 0x04, 0xa6, 0x00, 0x5a, 0x2c, 0x1a, 0x02, 0x30, 0x14, 0x1f, 0xa4, 
-    0xb4, 0x72, 0xca, 0x22, 0x8e, 0x95, 0x68, 0x62, 0x09, 0x91, 0xa1, 0xa2, 0x21, 
-    0x74, 0x1d, 0x65, 0x22, 0x4b, 0x2f, 0xb7, 0xb4, 0x22, 0x8b, 0x2e, 0x8e, 0x51, 
-    0x18, 0x24, 0x68, 0xec, 0x29, 0xb8, 0x1f, 0x47, 0xa0, 0xc8, 0xd2, 0x0a, 0x2c, 
-    0xb4, 0x00, 0x53, 0xcb, 0x26, 0x8e, 0xa9, 0x60, 0x22, 0x0b, 0x38, 0xae, 0xa7, 
-    0x61, 0x70, 0x1d, 0xa5, 0x92, 0x8a, 0x40, 0x88, 0xac, 0x42, 0x4b, 0x4b, 0x46, 
-    0x10, 0xe4, 0xa6, 0x89, 0x2a, 0xd0, 0x66, 0x91, 0x94, 0x0a, 0x9a, 0xd7, 0xd2, 
-    0x29, 0x8e, 0xd1, 0x11, 0x08, 0x08, 0x7f, 0x12, 0x38, 0x03, 0x5f, 0xbf, 0xc4, 
-    0x82, 0x0a, 0x26, 0x36, 0x28, 0x38, 0x80, 0x4b, 0x99, 0x90, 0xf2, 0x89, 0x1d, 
-    0x69, 0x2d, 0xa1, 0x8a, 0x2d, 0xa3, 0x14, 0xb2, 0x46, 0x1e, 0x9e, 0x18, 0x37, 
-    0xc9, 0x10, 0x04, 0x09, 0xd0, 0x1e, 0x77, 0x12, 0x65, 0x02, 0x0b, 0x30, 0xc0, 
-    0xd0, 0xd5, 0x42, 0x0b, 0x2f, 0xa9, 0x80, 0x92, 0x96, 0x77, 0xbb, 0x04, 0x72, 
-    0x50, 0x02, 0xe4, 0x19, 0x1a, 0x11, 0x21, 0xad, 0xa4, 0x02, 0xcb, 0x2a, 0xb7, 
-    0xdc, 0x42, 0xca, 0x96, 0xaf, 0x58, 0xa5, 0x09, 0x50, 0x68, 0x39, 0xa4, 0x5d, 
-    0x79, 0x43, 0x81, 0x92, 0x8a, 0x2e, 0xb2, 0xd4, 0x22, 0x8b, 0x30, 0xc1, 0x58, 
-    0xf5, 0xc8, 0x45, 0xbb, 0xdc, 0xe4, 0x10, 0x01, 0xbe, 0x0e, 0x55, 0x8b, 0x30, 
-    0xba, 0xb4, 0x12, 0x4c, 0x2f, 0x56, 0xe5, 0x81, 0xca, 0xba, 0x9c, 0x30, 0xe1, 
-    0xe3, 0x40, 0x95, 0x7c, 0xb2, 0x09, 0x1f, 0xc4, 0xac, 0x22, 0xcb, 0x50, 0x51, 
-    0x48, 0xa1, 0xef, 0xbe, 0x4a, 0xbc, 0x5b, 0x2f, 0x9b, 0x03, 0xed, 0xe9, 0x52, 
-    0x1e, 0xa3, 0x14, 0x5c, 0x70, 0x13, 0xfe, 0x12, 0x53, 0xcb, 0x27, 0x04, 0x01, 
-    0xdc, 0xd1, 0x13, 0x91, 0x59, 0x84, 0x49, 0xc2, 0xbc, 0x24, 0xab, 0x17, 0x7a, 
-    0x40, 0x09, 0xe5, 0xef, 0x2d, 0xc0, 0x30, 0x2c, 0x50, 0x24, 0x2d, 0xf9, 0x71, 
-    0x91, 0x74, 0xbb, 0xe8, 0xe0, 0x2f, 0x2d, 0xc2, 0xdc, 0x4b, 0x4c, 0x26, 0xb5, 
-    0x3c, 0x7c, 0xa0, 0x53, 0x17, 0xe9, 0xfa, 0x2e, 0x28, 0xc0, 0x20, 0x4a, 0xcc, 
-    0x26, 0x99, 0x74, 0x24, 0xe8, 0x30, 0x3f, 0x59, 0x04, 0x45, 0xc2, 0x1e, 0x0b, 
-    0x44, 0x0a, 0x47, 0x87, 0x1c, 0xf5, 0xd3, 0x2f, 0xb8, 0xb0, 0x9a, 0xf0, 0x50, 
-    0x0f, 0xf2, 0x8c, 0x91, 0x94, 0x0d, 0x2c, 0xed, 0xd2, 0xb2, 0x5b, 0xc1, 0xbc, 
-    0x0b, 0x7b, 0x0b, 0x48, 0x3d, 0x50, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 
-    0x00, 0xdf, 0x00, 0x2c, 0x0b, 0x00, 0x0d, 0x00, 0x3f, 0x00, 0x29, 0x00, 0x87, 
-    0x00, 0x00, 0x00, 0x08, 0x08, 0x05, 0x0b, 0x0b, 0x0b, 0x13, 0x13, 0x13, 0x14, 
-    0x13, 0x0a, 0x14, 0x14, 0x1a, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x22, 0x21, 0x1f, 
-    0x18, 0x24, 0x24, 0x24, 0x25, 0x24, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x36, 
-    0x30, 0x2c, 0x0a, 0x33, 0x33, 0x34, 0x34, 0x32, 0x3f, 0x3a, 0x39, 0x44, 0x3b, 
-    0x3b, 0x3b, 0x44, 0x44, 0x44, 0x45, 0x3e, 0x0e, 0x46, 0x23, 0x1d, 0x48, 0x43, 
-    0x4d, 0x4a, 0x2a, 0x25, 0x4b, 0x23, 0x1d, 0x4b, 0x47, 0x5a, 0x4c, 0x42, 0x53, 
-    0x4c, 0x4c, 0x4c, 0x4d, 0x3e, 0x4b, 0x4f, 0x4d, 0x63, 0x50, 0x4e, 0x65, 0x51, 
-    0x25, 0x1f, 0x51, 0x3b, 0x46, 0x52, 0x31, 0x2f, 0x53, 0x53, 0x53, 0x55, 0x28, 
-    0x22, 0x55, 0x54, 0x65, 0x56, 0x33, 0x32, 0x56, 0x38, 0x3b, 0x56, 0x4c, 0x54, 
-    0x56, 0x56, 0x6d, 0x57, 0x4f, 0x11, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 
-    0x29, 0x22, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x72, 0x5d, 0x41, 0x3d, 0x61, 0x61, 
-    0x76, 0x63, 0x5b, 0x6a, 0x65, 0x65, 0x79, 0x67, 0x3c, 0x40, 0x67, 0x66, 0x68, 
-    0x6a, 0x61, 0x15, 0x6a, 0x6a, 0x7e, 0x6b, 0x50, 0x4d, 0x6c, 0x2a, 0x2b, 0x6c, 
-    0x60, 0x6a, 0x6d, 0x6a, 0x75, 0x6d, 0x6d, 0x81, 0x70, 0x6f, 0x83, 0x72, 0x72, 
-    0x85, 0x74, 0x54, 0x0a, 0x74, 0x74, 0x74, 0x76, 0x29, 0x2a, 0x76, 0x36, 0x36, 
-    0x76, 0x76, 0x88, 0x79, 0x6a, 0x6c, 0x7b, 0x79, 0x85, 0x7b, 0x7b, 0x8d, 0x7d, 
-    0x47, 0x48, 0x7d, 0x7c, 0x7d, 0x7f, 0x7f, 0x90, 0x81, 0x4d, 0x4d, 0x81, 0x5d, 
-    0x0d, 0x83, 0x2b, 0x2b, 0x83, 0x83, 0x94, 0x86, 0x86, 0x86, 0x89, 0x58, 0x58, 
-    0x89, 0x8a, 0x96, 0x8a, 0x66, 0x09, 0x8b, 0x2d, 0x2e, 0x8b, 0x2f, 0x30, 0x8c, 
-    0x6e, 0x16, 0x8c, 0x8c, 0x9b, 0x8d, 0x6c, 0x26, 0x8e, 0x30, 0x30, 0x91, 0x6e, 
-    0x0b, 0x91, 0x91, 0x9e, 0x92, 0x73, 0x72, 0x92, 0x86, 0x1e, 0x93, 0x67, 0x67, 
-    0x94, 0x32, 0x33, 0x94, 0x80, 0x7e, 0x94, 0x94, 0xa2, 0x95, 0x72, 0x0b, 0x96, 
-    0x74, 0x15, 0x96, 0x75, 0x1b, 0x96, 0x76, 0x23, 0x96, 0x77, 0x2b, 0x97, 0x97, 
-    0x97, 0x97, 0x98, 0xa5, 0x98, 0x77, 0x1a, 0x99, 0x34, 0x34, 0x99, 0x76, 0x0d, 
-    0x99, 0x99, 0xa6, 0x9a, 0x7b, 0x2c, 0x9a, 0x7c, 0x38, 0x9b, 0x7b, 0x24, 0x9b, 
-    0x7d, 0x33, 0x9c, 0x7b, 0x15, 0x9c, 0x7b, 0x1b, 0x9d, 0x7b, 0x0e, 0x9d, 0x9d, 
-    0xaa, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 0x9e, 0x84, 0x26, 0xa0, 0x7f, 0x0f, 
-    0xa1, 0x84, 0x3c, 0xa1, 0xa1, 0xae, 0xa2, 0x83, 0x23, 0xa2, 0x84, 0x2b, 0xa2, 
-    0x86, 0x42, 0xa2, 0xa2, 0xa2, 0xa3, 0x83, 0x13, 0xa3, 0x83, 0x1a, 0xa3, 0x86, 
-    0x36, 0xa4, 0x89, 0x45, 0xa5, 0xa5, 0xb1, 0xa6, 0x8b, 0x4b, 0xa7, 0x88, 0x15, 
-    0xa8, 0x8e, 0x4c, 0xa8, 0x8e, 0x51, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 
-    0x8c, 0x1a, 0xab, 0x92, 0x55, 0xab, 0xab, 0xab, 0xac, 0x8e, 0x8e, 0xac, 0x95, 
-    0x64, 0xad, 0x95, 0x5c, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x98, 0x5f, 
-    0xb1, 0x98, 0x4f, 0xb1, 0x9a, 0x63, 0xb3, 0x94, 0x17, 0xb3, 0x95, 0x19, 0xb3, 
-    0xb3, 0xbd, 0xb4, 0x99, 0x2b, 0xb4, 0x9e, 0x6a, 0xb7, 0x99, 0x17, 0xb7, 0x99, 
-    0x19, 0xb7, 0xa1, 0x6d, 0xb7, 0xb7, 0xb8, 0xb7, 0xb7, 0xc0, 0xb8, 0xa5, 0x28, 
-    0xb9, 0xa4, 0x73, 0xba, 0x9d, 0x1a, 0xbb, 0xa2, 0xa2, 0xbb, 0xa7, 0x78, 0xbb, 
-    0xbb, 0xc4, 0xbc, 0xbd, 0xc6, 0xbe, 0xa1, 0x1b, 0xc1, 0xa5, 0x1c, 0xc3, 0xc3, 
-    0xcb, 0xc4, 0xb3, 0x89, 0xc4, 0xc4, 0xc4, 0xc5, 0xa9, 0x1d, 0xc6, 0xb2, 0xb3, 
-    0xc7, 0xc8, 0xcf, 0xc8, 0xad, 0x22, 0xc8, 0xb8, 0x29, 0xc9, 0xad, 0x1e, 0xc9, 
-    0xb4, 0xb4, 0xcb, 0xcb, 0xcc, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xd3, 0xcd, 0xb2, 
-    0x21, 0xd1, 0xb6, 0x22, 0xd2, 0xd2, 0xd5, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 
-    0xd6, 0xc8, 0xc8, 0xd8, 0xbf, 0x24, 0xda, 0xc8, 0x2b, 0xdb, 0xdb, 0xdd, 0xdc, 
-    0xc3, 0x26, 0xdc, 0xd4, 0xd5, 0xdd, 0xdd, 0xe2, 0xe1, 0xc8, 0x27, 0xe2, 0xe2, 
-    0xe5, 0xe3, 0xd9, 0xd9, 0xe4, 0xcc, 0x29, 0xe4, 0xd0, 0x4a, 0xe6, 0xe6, 0xe9, 
-    0xe7, 0xd0, 0x2b, 0xe7, 0xd1, 0x32, 0xeb, 0xd4, 0x2c, 0xeb, 0xde, 0x92, 0xeb, 
-    0xe3, 0xe3, 0xeb, 0xeb, 0xed, 0xee, 0xee, 0xf0, 0xef, 0xd9, 0x2d, 0xf2, 0xdc, 
-    0x2f, 0xf2, 0xee, 0xee, 0xf3, 0xf3, 0xf4, 0xf4, 0xdf, 0x30, 0xf5, 0xe0, 0x2f, 
-    0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf8, 0xf6, 0xf5, 0xfa, 0xe5, 0x32, 0xfd, 
-    0xeb, 0x49, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xec, 0x43, 0xff, 0xee, 
-    0x56, 0xff, 0xef, 0x63, 0xff, 0xf0, 0x68, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x84, 
-    0xff, 0xf4, 0x96, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0xff, 0x00, 0xbf, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x81, 0x4e, 
-    0x26, 0x85, 0xd2, 0x84, 0x86, 0xc7, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x8c, 0xc8, 
-    0xc8, 0x97, 0xb7, 0x8b, 0x17, 0x9b, 0xcd, 0x82, 0x33, 0xb1, 0xa3, 0xc7, 0x8e, 
-    0xa9, 0xbc, 0x25, 0xc3, 0x48, 0xd2, 0x1b, 0xac, 0x25, 0x1f, 0x53, 0x16, 0x74, 
-    0x42, 0x88, 0xd1, 0x95, 0x1d, 0x0f, 0x49, 0x45, 0xab, 0x35, 0xcb, 0x9b, 0xab, 
-    0x92, 0x17, 0x7d, 0x4d, 0x51, 0x99, 0x32, 0x94, 0x30, 0x92, 0xc9, 0x66, 0x31, 
-    0xd2, 0x41, 0x10, 0x94, 0xb7, 0x66, 0xd2, 0x2e, 0x0a, 0xab, 0x89, 0x33, 0x17, 
-    0xcf, 0x8e, 0x5d, 0x2c, 0xe2, 0xbc, 0x98, 0x0c, 0xd6, 0x24, 0x4d, 0x4c, 0x4b, 
-    0xf2, 0xfa, 0x89, 0x93, 0xd4, 0xd3, 0x88, 0x5d, 0x90, 0x4d, 0xc5, 0xd9, 0x4c, 
-    0xec, 0xd8, 0xa9, 0xc9, 0x8e, 0x7c, 0x7d, 0x98, 0xeb, 0x6c, 0xc9, 0xb6, 0x6e, 
-    0xa7, 0x6a, 0x5a, 0x6b, 0x70, 0x12, 0x4e, 0x69, 0xa0, 0xf4, 0x20, 0x9a, 0x15, 
-    0x8d, 0xea, 0xc8, 0x68, 0xb9, 0xa4, 0x62, 0xec, 0x3b, 0xd5, 0x14, 0xdd, 0x82, 
-    0xbc, 0x70, 0x32, 0x01, 0xc0, 0x18, 0x00, 0x8b, 0xbf, 0x5c, 0x31, 0xe6, 0x82, 
-    0x2b, 0x98, 0xa4, 0x2f, 0x07, 0x0e, 0x0e, 0x0b, 0xec, 0x32, 0xd5, 0x48, 0x63, 
-    0xc6, 0xa6, 0xe2, 0x7a, 0x83, 0x4b, 0x32, 0xda, 0x0c, 0x00, 0x02, 0x34, 0x7f, 
-    0x0b, 0x85, 0x56, 0x4f, 0x88, 0x03, 0x11, 0xc6, 0x34, 0x3b, 0x1b, 0x2d, 0x28, 
-    0x61, 0x92, 0x99, 0x1a, 0x27, 0xd0, 0x0c, 0x4b, 0x74, 0xdc, 0x68, 0xb3, 0x71, 
-    0x26, 0x73, 0xd0, 0x78, 0x00, 0x6f, 0xdf, 0xc8, 0x4b, 0x22, 0xfa, 0x1c, 0x40, 
-    0x73, 0xc8, 0xe4, 0xc9, 0x9b, 0x45, 0xf8, 0x0c, 0x60, 0xc1, 0xe1, 0x3f, 0xd0, 
-    0x93, 0x9b, 0xa2, 0x0e, 0x60, 0xf7, 0xe1, 0xc4, 0xd9, 0xbd, 0xdd, 0xff, 0xee, 
-    0xcc, 0xdd, 0xf8, 0xe1, 0x2b, 0x95, 0xe3, 0xfa, 0x22, 0xc5, 0xa4, 0x84, 0x0d, 
-    0x44, 0xe3, 0x33, 0x26, 0xe0, 0x5e, 0x40, 0xb5, 0x13, 0x58, 0xf1, 0x4b, 0x6a, 
-    0xb4, 0x33, 0x30, 0xc5, 0x8a, 0x15, 0x4c, 0xc4, 0xe7, 0x0b, 0x77, 0x00, 0x98, 
-    0x57, 0xd0, 0x21, 0xb2, 0xdc, 0xa2, 0x8b, 0x28, 0x1f, 0x75, 0x91, 0x0a, 0x2f, 
-    0xc1, 0x1d, 0xe5, 0xcb, 0x2c, 0x93, 0x38, 0x44, 0x90, 0x0b, 0xff, 0xad, 0x40, 
-    0x4a, 0x49, 0xb3, 0x10, 0xe8, 0x1d, 0x41, 0xb4, 0x28, 0x03, 0xcc, 0x2d, 0xb7, 
-    0xc4, 0x52, 0xd0, 0x29, 0xc4, 0x14, 0xa3, 0x0b, 0x44, 0x3a, 0xec, 0xc0, 0x83, 
-    0x85, 0x0f, 0xf9, 0xf7, 0x1f, 0x13, 0x25, 0xb9, 0x42, 0x60, 0x73, 0x04, 0xf5, 
-    0x52, 0x8d, 0x33, 0xd3, 0x4c, 0x53, 0x8c, 0x2c, 0x05, 0x11, 0x53, 0xcd, 0x90, 
-    0xc5, 0xd0, 0x25, 0xe3, 0x0a, 0x36, 0xd4, 0x48, 0x60, 0x6a, 0x03, 0xe9, 0xd2, 
-    0xcb, 0x2b, 0x8d, 0xf4, 0x41, 0xc9, 0x2b, 0xaa, 0x14, 0x04, 0xcd, 0x90, 0x43, 
-    0xf6, 0xb2, 0xd6, 0x91, 0x49, 0x92, 0xd4, 0x21, 0x77, 0x06, 0x10, 0xd4, 0x09, 
-    0x30, 0x9d, 0x18, 0x24, 0x0b, 0x25, 0xb7, 0xc8, 0x32, 0x0d, 0x96, 0xd5, 0x14, 
-    0xf9, 0x14, 0x09, 0x19, 0x02, 0x58, 0xd2, 0x80, 0xe5, 0x15, 0xb4, 0x09, 0x2d, 
-    0x05, 0xc5, 0xe2, 0xcc, 0x32, 0xd3, 0xd0, 0xc2, 0x66, 0x35, 0xc4, 0x3c, 0x65, 
-    0xc3, 0x91, 0x29, 0xdc, 0x44, 0x12, 0x2f, 0x05, 0x70, 0x97, 0x19, 0x41, 0x8d, 
-    0xd0, 0xd2, 0x4b, 0x31, 0xbd, 0xd0, 0x72, 0x4b, 0x2f, 0xd3, 0x8c, 0xf8, 0x0a, 
-    0x96, 0x57, 0x02, 0xe3, 0x11, 0x11, 0x84, 0xa0, 0x24, 0x03, 0xa1, 0x7a, 0x5c, 
-    0x14, 0x0d, 0x2f, 0xb0, 0xfc, 0xf1, 0x8d, 0x01, 0xd4, 0x19, 0x28, 0xd0, 0x2d, 
-    0xd3, 0x28, 0xd3, 0x4b, 0x2c, 0xb2, 0x14, 0xff, 0x53, 0x8d, 0x32, 0x55, 0x7e, 
-    0xe3, 0x67, 0x35, 0xad, 0x0e, 0x83, 0xcb, 0x47, 0x7f, 0x04, 0x46, 0x0a, 0x22, 
-    0x63, 0x38, 0xa1, 0x47, 0x4d, 0xbc, 0x80, 0x32, 0x04, 0x41, 0x0b, 0x50, 0xf7, 
-    0xe1, 0x37, 0xbd, 0x28, 0xa3, 0x0b, 0x2d, 0xc0, 0x0c, 0x23, 0xe2, 0x90, 0xd0, 
-    0xd0, 0x12, 0x8b, 0x2e, 0x58, 0xce, 0x81, 0x0b, 0x2b, 0x2a, 0xb1, 0x46, 0x52, 
-    0x33, 0x84, 0x3c, 0x34, 0x40, 0x63, 0x4c, 0x0a, 0xd4, 0xc9, 0x2b, 0xa3, 0x3c, 
-    0x7b, 0xe5, 0x32, 0xb7, 0x28, 0x23, 0xcb, 0xa3, 0xd5, 0x2c, 0xb3, 0xcc, 0xac, 
-    0xab, 0x88, 0xc8, 0x53, 0x6f, 0x18, 0x31, 0x02, 0xd1, 0x02, 0x01, 0x14, 0x18, 
-    0x01, 0x44, 0xaa, 0x00, 0xa3, 0x4a, 0x23, 0xd0, 0x00, 0xf9, 0x0d, 0x31, 0xcb, 
-    0x0c, 0xe3, 0x0c, 0x30, 0x9b, 0x38, 0x53, 0x0d, 0x4f, 0x76, 0x65, 0x04, 0x13, 
-    0x44, 0x11, 0xfc, 0x1b, 0x91, 0x89, 0xdf, 0xc4, 0xd2, 0xa6, 0x40, 0xbd, 0x08, 
-    0x39, 0x4d, 0xc7, 0xca, 0x3c, 0xac, 0x12, 0x23, 0xcd, 0x30, 0x83, 0xcc, 0x2e, 
-    0x42, 0xd0, 0x45, 0xc9, 0x8a, 0xdf, 0xc8, 0xb2, 0x8c, 0x32, 0xc4, 0x6c, 0x72, 
-    0xe5, 0x9f, 0x22, 0x7f, 0x14, 0xc5, 0xcd, 0x55, 0xe4, 0x5c, 0x45, 0x14, 0x6b, 
-    0xc5, 0xa2, 0x8c, 0x40, 0x94, 0xa8, 0x42, 0x4c, 0xbb, 0xb4, 0x38, 0xfc, 0xa7, 
-    0x4a, 0x4d, 0x24, 0x92, 0x88, 0x27, 0x4c, 0x73, 0x51, 0xc4, 0x5a, 0xb2, 0x54, 
-    0x73, 0xcb, 0x40, 0xb8, 0x00, 0x73, 0x4a, 0x2f, 0xb7, 0xd0, 0xac, 0xd2, 0x86, 
-    0x24, 0xd5, 0x42, 0xd7, 0x26, 0x3d, 0xbe, 0x32, 0x90, 0x82, 0xa7, 0xac, 0x29, 
-    0x2b, 0x8f, 0x65, 0x7e, 0x34, 0x45, 0x84, 0xa2, 0xa2, 0xb4, 0x96, 0x90, 0x06, 
-    0x0b, 0xb4, 0x48, 0x30, 0xc1, 0xd0, 0xe2, 0xe3, 0x9a, 0x18, 0x7b, 0x84, 0xef, 
-    0x51, 0x18, 0x79, 0x4e, 0xb5, 0x96, 0x2a, 0x5a, 0x1e, 0x84, 0xcd, 0x34, 0x55, 
-    0x56, 0x13, 0xf7, 0x44, 0x70, 0xdc, 0x06, 0x9e, 0x37, 0xbe, 0xa8, 0x76, 0x50, 
-    0x31, 0x62, 0x7f, 0x73, 0xcd, 0x29, 0x1f, 0x2d, 0xee, 0x4d, 0x2d, 0x18, 0x21, 
-    0x03, 0x81, 0xe3, 0x10, 0xed, 0xea, 0x91, 0x51, 0x83, 0x81, 0x17, 0x8d, 0x2b, 
-    0x0c, 0x70, 0x7e, 0x98, 0x13, 0x6c, 0x23, 0x63, 0x56, 0x2e, 0xa6, 0x08, 0xc0, 
-    0x81, 0xe9, 0x6b, 0x3d, 0x87, 0x91, 0x2f, 0xc1, 0xd5, 0x02, 0x0a, 0x00, 0x0f, 
-    0xc0, 0x7e, 0x50, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x99, 0x00, 
-    0x2c, 0x0b, 0x00, 0x0d, 0x00, 0x3f, 0x00, 0x29, 0x00, 0x87, 0x07, 0x07, 0x07, 
-    0x0a, 0x0a, 0x0a, 0x14, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x24, 0x24, 0x25, 0x2c, 
-    0x2c, 0x2c, 0x34, 0x34, 0x34, 0x3c, 0x3a, 0x48, 0x3c, 0x3c, 0x3c, 0x44, 0x42, 
-    0x4f, 0x46, 0x3e, 0x4a, 0x4c, 0x4a, 0x57, 0x4c, 0x4c, 0x4c, 0x4d, 0x32, 0x32, 
-    0x4e, 0x2f, 0x2b, 0x4f, 0x31, 0x2d, 0x50, 0x31, 0x2d, 0x50, 0x4f, 0x5b, 0x53, 
-    0x53, 0x53, 0x54, 0x36, 0x32, 0x56, 0x56, 0x6d, 0x58, 0x57, 0x63, 0x59, 0x59, 
-    0x6e, 0x5b, 0x3f, 0x3b, 0x5b, 0x48, 0x4d, 0x5c, 0x5c, 0x5d, 0x5c, 0x5c, 0x72, 
-    0x5d, 0x41, 0x3d, 0x60, 0x5e, 0x6a, 0x61, 0x46, 0x42, 0x61, 0x5f, 0x73, 0x61, 
-    0x61, 0x76, 0x62, 0x62, 0x62, 0x64, 0x48, 0x45, 0x65, 0x63, 0x6f, 0x65, 0x65, 
-    0x79, 0x68, 0x2d, 0x30, 0x6a, 0x6a, 0x7e, 0x6b, 0x51, 0x4d, 0x6d, 0x6a, 0x75, 
-    0x6e, 0x6e, 0x6f, 0x6e, 0x6e, 0x81, 0x70, 0x6f, 0x83, 0x72, 0x33, 0x33, 0x72, 
-    0x6e, 0x7b, 0x73, 0x5a, 0x57, 0x73, 0x73, 0x74, 0x73, 0x73, 0x85, 0x76, 0x76, 
-    0x89, 0x77, 0x3c, 0x3c, 0x79, 0x60, 0x5e, 0x79, 0x6b, 0x77, 0x7b, 0x7a, 0x83, 
-    0x7b, 0x7b, 0x8c, 0x7c, 0x43, 0x43, 0x7c, 0x7c, 0x7c, 0x7d, 0x4c, 0x4c, 0x7d, 
-    0x65, 0x63, 0x7f, 0x68, 0x65, 0x7f, 0x7f, 0x90, 0x80, 0x4c, 0x4c, 0x83, 0x6b, 
-    0x68, 0x83, 0x83, 0x93, 0x85, 0x54, 0x54, 0x85, 0x70, 0x6e, 0x87, 0x72, 0x71, 
-    0x88, 0x56, 0x57, 0x88, 0x88, 0x97, 0x8b, 0x5c, 0x5c, 0x8c, 0x8c, 0x8c, 0x8c, 
-    0x8c, 0x9b, 0x8d, 0x7a, 0x79, 0x90, 0x62, 0x62, 0x90, 0x6e, 0x16, 0x90, 0x90, 
-    0x9f, 0x91, 0x71, 0x32, 0x94, 0x80, 0x7e, 0x94, 0x94, 0xa2, 0x96, 0x74, 0x16, 
-    0x96, 0x75, 0x1b, 0x96, 0x76, 0x23, 0x96, 0x76, 0x2a, 0x97, 0x78, 0x2d, 0x98, 
-    0x76, 0x15, 0x98, 0x77, 0x1d, 0x99, 0x99, 0xa7, 0x9a, 0x7b, 0x24, 0x9a, 0x7b, 
-    0x2c, 0x9a, 0x7d, 0x43, 0x9b, 0x7b, 0x1c, 0x9b, 0x7d, 0x33, 0x9c, 0x74, 0x74, 
-    0x9c, 0x7b, 0x14, 0x9c, 0x7f, 0x3a, 0x9e, 0x81, 0x3b, 0x9e, 0x9e, 0xaa, 0x9f, 
-    0x7a, 0x79, 0x9f, 0x80, 0x27, 0x9f, 0x80, 0x29, 0xa1, 0x81, 0x17, 0xa1, 0x82, 
-    0x2c, 0xa1, 0x84, 0x33, 0xa1, 0x84, 0x3c, 0xa2, 0x83, 0x24, 0xa2, 0x86, 0x43, 
-    0xa3, 0x83, 0x18, 0xa4, 0x89, 0x45, 0xa5, 0xa5, 0xb0, 0xa6, 0x88, 0x2c, 0xa6, 
-    0x8b, 0x3c, 0xa6, 0x8b, 0x4b, 0xa8, 0x88, 0x87, 0xa8, 0x8e, 0x4e, 0xa9, 0x8d, 
-    0x43, 0xa9, 0x8f, 0x51, 0xab, 0x92, 0x55, 0xac, 0x9d, 0x9c, 0xad, 0x91, 0x41, 
-    0xad, 0x95, 0x5c, 0xaf, 0x95, 0x4b, 0xb0, 0x95, 0x3f, 0xb0, 0x98, 0x5e, 0xb1, 
-    0x9a, 0x63, 0xb4, 0x9e, 0x6a, 0xb6, 0x9a, 0x2a, 0xb7, 0xa2, 0x70, 0xb8, 0x9f, 
-    0x48, 0xb8, 0xa2, 0x6d, 0xb9, 0xa4, 0x73, 0xbd, 0xa9, 0x77, 0xbd, 0xa9, 0x7b, 
-    0xc1, 0xae, 0x82, 0xc3, 0xb1, 0x86, 0xc6, 0xb5, 0x8c, 0xc8, 0xb8, 0x91, 0xdc, 
-    0xcc, 0x89, 0xdd, 0xc8, 0x48, 0xe2, 0xd3, 0x83, 0xe6, 0xd1, 0x42, 0xe8, 0xd3, 
-    0x43, 0xf3, 0xe0, 0x49, 0xfe, 0xee, 0x53, 0xff, 0xec, 0x3c, 0xff, 0xed, 0x43, 
-    0xff, 0xee, 0x4a, 0xff, 0xef, 0x5b, 0xff, 0xf0, 0x6b, 0xff, 0xf1, 0x63, 0xff, 
-    0xf2, 0x73, 0xff, 0xf2, 0x7c, 0xff, 0xf3, 0x82, 0xff, 0xf3, 0x89, 0xff, 0xf4, 
-    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc3, 
-    0x00, 0x33, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x99, 0x5e, 0x20, 0x5c, 
-    0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x99, 0xbe, 0x40, 0x9c, 0x48, 0xb1, 0xa2, 0x40, 
-    0x1f, 0x16, 0x2d, 0x0e, 0xc9, 0xc8, 0xb1, 0xe3, 0xc2, 0x14, 0x1e, 0x43, 0x8a, 
-    0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28, 0x53, 0xaa, 0xa4, 0x98, 0xc1, 0xa3, 
-    0x81, 0x95, 0x99, 0x6e, 0x90, 0x04, 0x01, 0xb3, 0x20, 0x82, 0x91, 0x04, 0x6a, 
-    0x96, 0x14, 0xa0, 0x93, 0x24, 0x80, 0x9e, 0x24, 0x0b, 0x84, 0x5c, 0x03, 0xb4, 
-    0xa8, 0x51, 0xa3, 0x39, 0x0b, 0xf2, 0x14, 0xb9, 0xb1, 0xe6, 0xd2, 0x82, 0x75, 
-    0x50, 0x2a, 0x24, 0x78, 0xa1, 0x62, 0xd2, 0x94, 0x2a, 0x4c, 0xfe, 0x3c, 0x6a, 
-    0xd0, 0x44, 0xc7, 0x3a, 0x6c, 0xf8, 0x70, 0xad, 0xe8, 0xe7, 0x60, 0xd9, 0xb1, 
-    0x0b, 0xcf, 0xa2, 0x1d, 0xf8, 0x74, 0x61, 0x54, 0x94, 0x35, 0x32, 0x61, 0xec, 
-    0xb0, 0x16, 0x22, 0x51, 0x82, 0x45, 0x0a, 0xc6, 0x5d, 0x78, 0xb5, 0x2e, 0x59, 
-    0xbf, 0x07, 0xb7, 0xbe, 0x6c, 0xf8, 0x16, 0xed, 0x4d, 0xc0, 0x02, 0x73, 0x78, 
-    0x14, 0x8b, 0xb8, 0xae, 0x10, 0x3a, 0x74, 0x06, 0x82, 0xb1, 0xd1, 0x18, 0xa6, 
-    0x5a, 0x87, 0x8c, 0x3d, 0x62, 0x3c, 0x89, 0xa8, 0x32, 0x4c, 0x89, 0x46, 0x17, 
-    0x79, 0x86, 0xd8, 0x79, 0x74, 0xc8, 0xa6, 0x0c, 0x23, 0x98, 0x5e, 0x1b, 0x10, 
-    0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xe2, 0x00, 0x2c, 0x04, 0x00, 0x10, 
-    0x00, 0x46, 0x00, 0x26, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x05, 0x0b, 
-    0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x14, 0x14, 0x14, 0x17, 0x14, 0x04, 0x17, 0x16, 
-    0x1a, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x22, 0x23, 0x23, 0x24, 0x25, 0x23, 0x2d, 
-    0x29, 0x25, 0x08, 0x2a, 0x28, 0x33, 0x2c, 0x2c, 0x2c, 0x30, 0x2e, 0x3b, 0x34, 
-    0x33, 0x3d, 0x34, 0x34, 0x34, 0x3a, 0x38, 0x46, 0x3b, 0x3b, 0x3c, 0x44, 0x43, 
-    0x44, 0x44, 0x44, 0x4a, 0x48, 0x23, 0x1d, 0x4b, 0x48, 0x57, 0x4b, 0x4a, 0x4b, 
-    0x4c, 0x42, 0x53, 0x4c, 0x45, 0x5a, 0x4e, 0x3e, 0x4c, 0x4e, 0x4c, 0x62, 0x4f, 
-    0x31, 0x33, 0x50, 0x4f, 0x65, 0x51, 0x25, 0x1f, 0x51, 0x3a, 0x44, 0x53, 0x53, 
-    0x53, 0x54, 0x4d, 0x11, 0x55, 0x2c, 0x28, 0x55, 0x55, 0x6c, 0x56, 0x34, 0x37, 
-    0x59, 0x2d, 0x2b, 0x59, 0x45, 0x48, 0x59, 0x58, 0x64, 0x59, 0x59, 0x6e, 0x5a, 
-    0x29, 0x22, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 0x63, 0x63, 
-    0x64, 0x64, 0x34, 0x38, 0x65, 0x65, 0x79, 0x67, 0x4c, 0x4a, 0x69, 0x6a, 0x7d, 
-    0x6a, 0x66, 0x78, 0x6b, 0x6b, 0x6c, 0x6c, 0x27, 0x28, 0x6e, 0x6e, 0x81, 0x6f, 
-    0x65, 0x16, 0x70, 0x56, 0x0c, 0x72, 0x72, 0x85, 0x74, 0x36, 0x36, 0x75, 0x75, 
-    0x75, 0x76, 0x76, 0x88, 0x77, 0x28, 0x29, 0x77, 0x6a, 0x73, 0x79, 0x78, 0x83, 
-    0x79, 0x79, 0x7b, 0x7b, 0x7b, 0x8c, 0x7c, 0x47, 0x47, 0x7f, 0x5c, 0x60, 0x7f, 
-    0x7f, 0x90, 0x83, 0x83, 0x84, 0x84, 0x2b, 0x2b, 0x84, 0x52, 0x52, 0x84, 0x84, 
-    0x94, 0x88, 0x87, 0x88, 0x88, 0x88, 0x97, 0x89, 0x65, 0x08, 0x8a, 0x2e, 0x2e, 
-    0x8a, 0x6d, 0x16, 0x8b, 0x2f, 0x30, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8d, 
-    0x6a, 0x0b, 0x8e, 0x30, 0x31, 0x8e, 0x6d, 0x25, 0x90, 0x90, 0x9f, 0x91, 0x6e, 
-    0x0b, 0x91, 0x6f, 0x15, 0x91, 0x85, 0x1d, 0x92, 0x8f, 0x99, 0x93, 0x31, 0x32, 
-    0x94, 0x6a, 0x6a, 0x94, 0x6d, 0x6e, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa3, 0x95, 
-    0x74, 0x17, 0x96, 0x73, 0x0c, 0x96, 0x75, 0x24, 0x97, 0x77, 0x28, 0x99, 0x99, 
-    0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2b, 0x9b, 0x9b, 0x9b, 
-    0x9c, 0x7b, 0x1c, 0x9c, 0x7e, 0x33, 0x9d, 0x7b, 0x0e, 0x9d, 0x7c, 0x14, 0x9d, 
-    0x7f, 0x39, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x36, 0x9e, 0x82, 0x3b, 0x9f, 0x81, 
-    0x2a, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x11, 0xa1, 0x7c, 0x7c, 0xa1, 0x84, 0x3d, 
-    0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1a, 0xa3, 
-    0x84, 0x27, 0xa4, 0x84, 0x14, 0xa4, 0x89, 0x46, 0xa6, 0x8b, 0x4b, 0xa6, 0xa6, 
-    0xb2, 0xa7, 0x8e, 0x54, 0xa8, 0x8b, 0x33, 0xa9, 0x8e, 0x4d, 0xa9, 0x8f, 0x51, 
-    0xaa, 0x8b, 0x19, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x91, 0x55, 0xab, 
-    0xab, 0xab, 0xad, 0x95, 0x5b, 0xae, 0x8f, 0x8f, 0xae, 0x98, 0x26, 0xae, 0xae, 
-    0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x97, 0x60, 0xaf, 0x98, 0x5f, 0xaf, 0xa7, 0x97, 
-    0xb2, 0x93, 0x16, 0xb2, 0x94, 0x19, 0xb2, 0x98, 0x47, 0xb2, 0x9a, 0x5d, 0xb2, 
-    0x9a, 0x63, 0xb3, 0xb3, 0xbc, 0xb4, 0x9e, 0x6a, 0xb5, 0xb5, 0xb5, 0xb6, 0x98, 
-    0x19, 0xb7, 0x99, 0x16, 0xb7, 0xa2, 0x6c, 0xb7, 0xb7, 0xc1, 0xb8, 0xb7, 0xb8, 
-    0xba, 0x9d, 0x1a, 0xba, 0xa5, 0x74, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 
-    0xa8, 0xa9, 0xbd, 0xa9, 0x78, 0xbe, 0xa1, 0x1b, 0xbf, 0xa4, 0x29, 0xc0, 0xad, 
-    0x7f, 0xc1, 0xa5, 0x1c, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xcb, 0xc5, 0xb3, 0x89, 
-    0xc6, 0xaa, 0x1d, 0xc6, 0xab, 0x21, 0xc6, 0xb5, 0x8d, 0xc8, 0xb5, 0x28, 0xc9, 
-    0xae, 0x1e, 0xc9, 0xc9, 0xcc, 0xca, 0xb3, 0x4b, 0xca, 0xb6, 0xb6, 0xcd, 0xb2, 
-    0x1f, 0xcd, 0xb3, 0x21, 0xcd, 0xcd, 0xd3, 0xd0, 0xb5, 0x1f, 0xd0, 0xbb, 0x29, 
-    0xd1, 0xb6, 0x22, 0xd3, 0xd3, 0xd5, 0xd4, 0xd4, 0xda, 0xd5, 0xbb, 0x23, 0xd6, 
-    0xc6, 0xc6, 0xd8, 0xbe, 0x24, 0xdb, 0xc6, 0x2b, 0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 
-    0x26, 0xdd, 0xca, 0x62, 0xdd, 0xdd, 0xe1, 0xde, 0xd3, 0xd3, 0xe0, 0xc7, 0x27, 
-    0xe1, 0xc8, 0x27, 0xe3, 0xd8, 0xd8, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe5, 
-    0xe5, 0xe9, 0xe7, 0xd1, 0x2b, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xec, 0xd8, 
-    0x49, 0xec, 0xd9, 0x31, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xed, 0xec, 
-    0xf2, 0xdc, 0x2f, 0xf3, 0xf3, 0xf4, 0xf4, 0xde, 0x30, 0xf6, 0xe1, 0x31, 0xf7, 
-    0xf7, 0xf8, 0xf9, 0xf7, 0xf7, 0xfa, 0xe5, 0x32, 0xfa, 0xe6, 0x3b, 0xfd, 0xed, 
-    0x67, 0xfd, 0xf2, 0x8e, 0xfe, 0xed, 0x45, 0xfe, 0xed, 0x56, 0xff, 0xeb, 0x34, 
-    0xff, 0xec, 0x3b, 0xff, 0xed, 0x4b, 0xff, 0xf0, 0x58, 0xff, 0xf1, 0x6a, 0xff, 
-    0xf2, 0x79, 0xff, 0xf3, 0x86, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xc5, 0x09, 0x1c, 
-    0x48, 0xb0, 0x60, 0x41, 0x20, 0x88, 0x4a, 0x95, 0x22, 0x55, 0xc7, 0xa0, 0xc3, 
-    0x87, 0x10, 0x23, 0x4a, 0x94, 0x88, 0x69, 0xd7, 0xb4, 0x70, 0x18, 0x31, 0x2e, 
-    0x63, 0x75, 0x64, 0xa2, 0xc7, 0x8f, 0x20, 0x07, 0xee, 0x29, 0x96, 0xb1, 0x64, 
-    0xc6, 0x67, 0xa5, 0x42, 0xaa, 0x5c, 0x49, 0x90, 0xd3, 0x45, 0x93, 0x30, 0xc3, 
-    0x95, 0x69, 0xc0, 0xb2, 0xa6, 0x47, 0x4e, 0x31, 0x63, 0x0e, 0x13, 0x00, 0x80, 
-    0xa6, 0xcd, 0x9f, 0x06, 0xc3, 0x48, 0xcb, 0x09, 0x93, 0x0e, 0x80, 0xa3, 0x03, 
-    0x80, 0x2a, 0x15, 0x18, 0x8b, 0x28, 0x4c, 0x10, 0x47, 0x8f, 0x26, 0x58, 0x0a, 
-    0x94, 0xa4, 0xd3, 0x8c, 0xcb, 0x02, 0x44, 0x3d, 0xea, 0xb3, 0x66, 0xa5, 0x5b, 
-    0xb7, 0x42, 0xd5, 0x3c, 0x32, 0x34, 0x5c, 0xb1, 0x5d, 0x4e, 0x77, 0x6d, 0x45, 
-    0x6a, 0x13, 0x55, 0x34, 0x6d, 0x70, 0x8d, 0xb1, 0xdc, 0x83, 0x71, 0x57, 0x2d, 
-    0xbb, 0x44, 0x59, 0xad, 0xe5, 0x5a, 0x13, 0x18, 0xdc, 0xbf, 0xc0, 0x56, 0x96, 
-    0x42, 0xd6, 0xc9, 0xea, 0x30, 0x52, 0xa4, 0x90, 0xc1, 0x24, 0xb5, 0x17, 0x00, 
-    0x81, 0x9a, 0xb7, 0xfe, 0xc2, 0x85, 0xb6, 0xb2, 0x13, 0x5a, 0x98, 0xbe, 0x58, 
-    0x5d, 0xc6, 0x98, 0xa9, 0x71, 0x4f, 0x96, 0x8f, 0xde, 0x4a, 0x46, 0x15, 0x52, 
-    0x52, 0xb8, 0x61, 0x31, 0x97, 0x2d, 0x7b, 0x56, 0x36, 0x5c, 0xe7, 0xc6, 0x06, 
-    0x22, 0x86, 0xd2, 0xf4, 0x30, 0xd8, 0x5f, 0x63, 0xc7, 0x6e, 0x11, 0x9c, 0x15, 
-    0x71, 0xcf, 0x33, 0xd5, 0x39, 0x7d, 0x3d, 0x2b, 0xd9, 0xc9, 0x73, 0xd2, 0x87, 
-    0x9a, 0x82, 0xc9, 0x75, 0x88, 0xea, 0xaf, 0x32, 0x55, 0xc6, 0x48, 0x0b, 0x64, 
-    0xf6, 0x70, 0x4a, 0xad, 0x69, 0xcf, 0x36, 0x63, 0xcd, 0x58, 0x6b, 0x38, 0xc6, 
-    0x58, 0x9e, 0x01, 0x4c, 0xff, 0x75, 0x38, 0xca, 0xd8, 0x72, 0x71, 0x8f, 0x08, 
-    0xb2, 0x11, 0x4d, 0x4d, 0x15, 0x33, 0x6a, 0xc4, 0x82, 0x39, 0xdb, 0x16, 0xf4, 
-    0x3a, 0x46, 0x64, 0xbe, 0x48, 0xee, 0xf2, 0x75, 0xda, 0x57, 0xd9, 0xbb, 0x19, 
-    0x15, 0x13, 0xde, 0x78, 0x06, 0xa1, 0x62, 0x4c, 0x30, 0xa3, 0xc0, 0x12, 0x0a, 
-    0x30, 0x62, 0x09, 0x94, 0x47, 0x2e, 0xd4, 0x68, 0x43, 0x8d, 0x0d, 0xba, 0x88, 
-    0xa6, 0x4d, 0x35, 0x04, 0x3d, 0x11, 0xcb, 0x4b, 0x19, 0xb5, 0x06, 0x53, 0x31, 
-    0xc8, 0x28, 0x96, 0x91, 0x0a, 0x9e, 0x3d, 0xc6, 0x1c, 0x33, 0xb2, 0x10, 0xf3, 
-    0xca, 0x2d, 0xad, 0xa0, 0xa2, 0x89, 0x1f, 0xe2, 0xe4, 0xa2, 0x4d, 0x30, 0xd4, 
-    0x28, 0xe3, 0x0c, 0x31, 0x11, 0x6a, 0xe3, 0x8c, 0x74, 0xe2, 0x04, 0xb2, 0xcc, 
-    0x55, 0x40, 0x86, 0x43, 0x48, 0x78, 0x0f, 0xcd, 0x12, 0xcd, 0x2a, 0xc7, 0x1c, 
-    0x28, 0x19, 0x35, 0xd1, 0x54, 0x73, 0x0c, 0x33, 0x3a, 0x4a, 0xa6, 0x0d, 0x7d, 
-    0x3d, 0x7a, 0x18, 0x64, 0x4e, 0xc8, 0x18, 0xe0, 0x19, 0x04, 0x0e, 0xcd, 0x62, 
-    0xcc, 0x2a, 0xc6, 0xd8, 0x78, 0x1b, 0x69, 0xa8, 0x1c, 0x23, 0xa5, 0x84, 0xd0, 
-    0x44, 0x23, 0x4e, 0x12, 0x3f, 0x5e, 0x09, 0x64, 0x19, 0x9e, 0x11, 0x48, 0x50, 
-    0x2e, 0xc7, 0xf0, 0x72, 0xe3, 0x31, 0xd0, 0x68, 0x93, 0x0b, 0x41, 0x16, 0xfe, 
-    0xa5, 0x0b, 0x8c, 0xe2, 0xb0, 0xe2, 0x66, 0x90, 0x59, 0x36, 0x76, 0x5c, 0x41, 
-    0xb0, 0x68, 0x42, 0x0c, 0x31, 0xb9, 0xbc, 0x75, 0x4c, 0x41, 0xc4, 0x1c, 0x13, 
-    0x21, 0x93, 0x79, 0xea, 0x26, 0x0e, 0x6a, 0x26, 0xa9, 0xc6, 0x21, 0x51, 0xc8, 
-    0x50, 0xb2, 0x05, 0x1d, 0xfc, 0x85, 0xb3, 0xcb, 0x04, 0x8d, 0x05, 0x00, 0x91, 
-    0x33, 0xca, 0x11, 0x63, 0x0c, 0x2f, 0x05, 0xb5, 0xd2, 0x4b, 0x9e, 0xc6, 0x68, 
-    0xff, 0x73, 0xcb, 0x36, 0xce, 0x88, 0x73, 0x04, 0x87, 0xd3, 0x10, 0x22, 0x01, 
-    0x57, 0x94, 0x38, 0x55, 0x8a, 0x09, 0x29, 0x04, 0x4b, 0x42, 0x2d, 0xe1, 0x04, 
-    0x22, 0xce, 0xae, 0x6b, 0x1d, 0xf0, 0x10, 0x2c, 0xbc, 0x00, 0x53, 0x09, 0x35, 
-    0xa1, 0xe8, 0x62, 0xd0, 0x23, 0xd5, 0x18, 0x93, 0x0c, 0x35, 0x02, 0x61, 0x13, 
-    0x4a, 0x20, 0x25, 0xbd, 0x16, 0xd5, 0x05, 0x9b, 0x96, 0xe4, 0x0b, 0x09, 0xc1, 
-    0x96, 0xbb, 0x45, 0x31, 0x03, 0x41, 0xb0, 0x96, 0x04, 0x0f, 0x35, 0x08, 0x0b, 
-    0x35, 0xa0, 0x1c, 0xd3, 0xe0, 0x40, 0xae, 0x8a, 0xb3, 0x0d, 0x31, 0xf4, 0x62, 
-    0xd2, 0xed, 0x5a, 0x65, 0x10, 0x75, 0x45, 0x09, 0xc1, 0x96, 0x00, 0xc3, 0x16, 
-    0x99, 0x15, 0x84, 0x80, 0x01, 0x04, 0x70, 0x29, 0xd1, 0x28, 0xd4, 0x18, 0xa3, 
-    0x0a, 0x6f, 0x0e, 0x11, 0x33, 0xaf, 0x38, 0xa6, 0x95, 0x54, 0x4b, 0x27, 0x9d, 
-    0xc4, 0x62, 0x55, 0x4c, 0xbb, 0x88, 0x43, 0x02, 0x0c, 0x99, 0x6c, 0xcc, 0xc9, 
-    0x4f, 0xc6, 0xe4, 0x02, 0x0d, 0x8f, 0x12, 0x85, 0x31, 0x28, 0x46, 0xd3, 0xac, 
-    0x21, 0x8e, 0x6f, 0x26, 0x21, 0xf2, 0x93, 0x23, 0xa1, 0x44, 0xe3, 0xcc, 0xc4, 
-    0x11, 0x6d, 0x7c, 0x65, 0x2d, 0xe2, 0x70, 0x61, 0x8b, 0x2f, 0x9b, 0x62, 0xa2, 
-    0xd4, 0x2c, 0xd4, 0xa0, 0x1c, 0x11, 0x4e, 0x6e, 0x3e, 0xc3, 0x85, 0x38, 0x31, 
-    0x08, 0xa4, 0x2f, 0x46, 0xc5, 0x18, 0x62, 0x84, 0x52, 0x90, 0x84, 0x64, 0x8b, 
-    0x9b, 0x92, 0x14, 0x34, 0xc4, 0x32, 0xb8, 0xc4, 0x11, 0x45, 0x13, 0x45, 0x50, 
-    0x15, 0x52, 0x53, 0x57, 0x2d, 0x93, 0x75, 0x41, 0x46, 0x44, 0x11, 0xc5, 0x12, 
-    0x59, 0xb8, 0x92, 0x89, 0xd8, 0x21, 0xd5, 0x51, 0x4b, 0x9b, 0x25, 0x3d, 0x63, 
-    0x0b, 0x27, 0x43, 0x38, 0xb4, 0x44, 0x13, 0x86, 0x08, 0x44, 0xa3, 0x51, 0x47, 
-    0x70, 0x87, 0x74, 0x44, 0x20, 0x92, 0x60, 0x12, 0xc8, 0x13, 0x4d, 0x43, 0xd4, 
-    0x43, 0x33, 0x26, 0xc5, 0x12, 0xf8, 0xe3, 0x03, 0x55, 0x5c, 0x37, 0x05, 0x90, 
-    0x3f, 0x8e, 0x69, 0x49, 0xc3, 0xc8, 0x59, 0xb9, 0x52, 0x48, 0x9b, 0x95, 0x91, 
-    0x2f, 0x00, 0x3c, 0xb0, 0xf9, 0x52, 0x42, 0x65, 0xb4, 0x19, 0x32, 0xe2, 0x8d, 
-    0xae, 0xd4, 0xe5, 0xe1, 0x5c, 0xad, 0x11, 0x02, 0x00, 0xb0, 0x3b, 0x7a, 0x40, 
-    0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xe2, 0x00, 0x2c, 0x04, 0x00, 0x10, 
-    0x00, 0x46, 0x00, 0x26, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x05, 0x0b, 
-    0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x14, 0x14, 0x14, 0x17, 0x14, 0x04, 0x17, 0x16, 
-    0x1a, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x22, 0x23, 0x23, 0x24, 0x25, 0x23, 0x2d, 
-    0x29, 0x25, 0x08, 0x2a, 0x28, 0x33, 0x2c, 0x2c, 0x2c, 0x30, 0x2e, 0x3b, 0x34, 
-    0x33, 0x3d, 0x34, 0x34, 0x34, 0x3a, 0x38, 0x46, 0x3b, 0x3b, 0x3c, 0x44, 0x43, 
-    0x44, 0x44, 0x44, 0x4a, 0x48, 0x23, 0x1d, 0x4b, 0x48, 0x57, 0x4b, 0x4a, 0x4b, 
-    0x4c, 0x42, 0x53, 0x4c, 0x45, 0x5a, 0x4e, 0x3e, 0x4c, 0x4e, 0x4c, 0x62, 0x4f, 
-    0x31, 0x33, 0x50, 0x4f, 0x65, 0x51, 0x25, 0x1f, 0x51, 0x3a, 0x44, 0x53, 0x53, 
-    0x53, 0x54, 0x4d, 0x11, 0x55, 0x2c, 0x28, 0x55, 0x55, 0x6c, 0x56, 0x34, 0x37, 
-    0x59, 0x2d, 0x2b, 0x59, 0x45, 0x48, 0x59, 0x58, 0x64, 0x59, 0x59, 0x6e, 0x5a, 
-    0x29, 0x22, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 0x63, 0x63, 
-    0x64, 0x64, 0x34, 0x38, 0x65, 0x65, 0x79, 0x67, 0x4c, 0x4a, 0x69, 0x6a, 0x7d, 
-    0x6a, 0x66, 0x78, 0x6b, 0x6b, 0x6c, 0x6c, 0x27, 0x28, 0x6e, 0x6e, 0x81, 0x6f, 
-    0x65, 0x16, 0x70, 0x56, 0x0c, 0x72, 0x72, 0x85, 0x74, 0x36, 0x36, 0x75, 0x75, 
-    0x75, 0x76, 0x76, 0x88, 0x77, 0x28, 0x29, 0x77, 0x6a, 0x73, 0x79, 0x78, 0x83, 
-    0x79, 0x79, 0x7b, 0x7b, 0x7b, 0x8c, 0x7c, 0x47, 0x47, 0x7f, 0x5c, 0x60, 0x7f, 
-    0x7f, 0x90, 0x83, 0x83, 0x84, 0x84, 0x2b, 0x2b, 0x84, 0x52, 0x52, 0x84, 0x84, 
-    0x94, 0x88, 0x87, 0x88, 0x88, 0x88, 0x97, 0x89, 0x6e, 0x17, 0x8a, 0x2e, 0x2e, 
-    0x8a, 0x66, 0x09, 0x8b, 0x2f, 0x30, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8d, 
-    0x6c, 0x27, 0x8e, 0x30, 0x31, 0x90, 0x6e, 0x17, 0x90, 0x90, 0x9f, 0x91, 0x6e, 
-    0x0a, 0x91, 0x85, 0x1d, 0x92, 0x8f, 0x99, 0x93, 0x31, 0x32, 0x94, 0x6a, 0x6a, 
-    0x94, 0x6d, 0x6e, 0x94, 0x72, 0x13, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa3, 0x96, 
-    0x73, 0x0c, 0x96, 0x75, 0x19, 0x96, 0x75, 0x24, 0x97, 0x77, 0x28, 0x99, 0x99, 
-    0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2c, 0x9b, 0x9b, 0x9b, 
-    0x9c, 0x7b, 0x0e, 0x9c, 0x7b, 0x1c, 0x9c, 0x7e, 0x33, 0x9d, 0x7c, 0x14, 0x9d, 
-    0x7f, 0x39, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x35, 0x9f, 0x81, 0x2a, 0x9f, 0x82, 
-    0x3b, 0xa0, 0x37, 0x37, 0xa1, 0x7c, 0x7c, 0xa1, 0x85, 0x3d, 0xa2, 0x81, 0x0f, 
-    0xa2, 0x84, 0x27, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xae, 0xa3, 
-    0x83, 0x1a, 0xa4, 0x84, 0x13, 0xa4, 0x89, 0x46, 0xa6, 0x8b, 0x4b, 0xa6, 0xa6, 
-    0xb2, 0xa7, 0x88, 0x1a, 0xa7, 0x8e, 0x56, 0xa8, 0x8b, 0x33, 0xa9, 0x8e, 0x4d, 
-    0xa9, 0x8e, 0x51, 0xaa, 0xaa, 0xb5, 0xab, 0x8c, 0x15, 0xab, 0x8c, 0x1a, 0xab, 
-    0x91, 0x55, 0xab, 0xab, 0xab, 0xad, 0x95, 0x5a, 0xae, 0x8f, 0x8f, 0xae, 0x98, 
-    0x26, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x98, 0x5f, 0xaf, 0x98, 0x61, 
-    0xaf, 0xa7, 0x97, 0xb1, 0x9a, 0x5d, 0xb2, 0x94, 0x17, 0xb2, 0x98, 0x47, 0xb2, 
-    0x9a, 0x63, 0xb3, 0x94, 0x19, 0xb3, 0xb3, 0xbc, 0xb4, 0x9e, 0x6a, 0xb5, 0xb5, 
-    0xb5, 0xb6, 0x98, 0x19, 0xb7, 0x99, 0x17, 0xb7, 0xa2, 0x6c, 0xb7, 0xb7, 0xc1, 
-    0xb8, 0xb7, 0xb8, 0xba, 0x9d, 0x1a, 0xba, 0xa5, 0x74, 0xbb, 0xbb, 0xc4, 0xbc, 
-    0xa8, 0x78, 0xbc, 0xbc, 0xbc, 0xbd, 0xa8, 0xa9, 0xbe, 0xa1, 0x1b, 0xbf, 0xa4, 
-    0x29, 0xc0, 0xad, 0x7f, 0xc2, 0xa5, 0x1c, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xcb, 
-    0xc4, 0xb2, 0x87, 0xc5, 0xa9, 0x21, 0xc6, 0xaa, 0x1e, 0xc6, 0xb5, 0x8c, 0xc8, 
-    0xb5, 0x28, 0xc9, 0xad, 0x1e, 0xc9, 0xc9, 0xcc, 0xca, 0xb3, 0x4b, 0xca, 0xb6, 
-    0xb6, 0xcc, 0xb1, 0x1f, 0xcd, 0xcd, 0xd3, 0xce, 0xb3, 0x21, 0xd0, 0xb5, 0x1f, 
-    0xd0, 0xbb, 0x29, 0xd1, 0xb6, 0x21, 0xd3, 0xd3, 0xd5, 0xd4, 0xd4, 0xda, 0xd5, 
-    0xbb, 0x23, 0xd6, 0xc6, 0xc6, 0xd8, 0xbe, 0x24, 0xdb, 0xc6, 0x2b, 0xdb, 0xdb, 
-    0xdd, 0xdc, 0xc3, 0x26, 0xdd, 0xca, 0x62, 0xdd, 0xdd, 0xe1, 0xde, 0xd3, 0xd3, 
-    0xe0, 0xc8, 0x27, 0xe3, 0xcc, 0x29, 0xe3, 0xd8, 0xd8, 0xe3, 0xe3, 0xe5, 0xe5, 
-    0xe5, 0xe9, 0xe7, 0xd0, 0x2b, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xec, 0xd8, 
-    0x49, 0xec, 0xd9, 0x31, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xed, 0xec, 
-    0xf2, 0xdc, 0x2f, 0xf3, 0xf3, 0xf4, 0xf4, 0xde, 0x30, 0xf6, 0xe1, 0x31, 0xf7, 
-    0xf7, 0xf8, 0xf9, 0xf7, 0xf7, 0xfa, 0xe5, 0x32, 0xfa, 0xe6, 0x3b, 0xfd, 0xed, 
-    0x67, 0xfd, 0xf2, 0x8e, 0xfe, 0xed, 0x45, 0xfe, 0xed, 0x56, 0xff, 0xeb, 0x34, 
-    0xff, 0xec, 0x3b, 0xff, 0xed, 0x4b, 0xff, 0xf0, 0x58, 0xff, 0xf1, 0x6a, 0xff, 
-    0xf2, 0x79, 0xff, 0xf3, 0x86, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xc5, 0x09, 0x1c, 
-    0x48, 0xb0, 0x60, 0x41, 0x20, 0x89, 0x4c, 0x99, 0x2a, 0x65, 0xc7, 0xa0, 0xc3, 
-    0x87, 0x10, 0x23, 0x4a, 0x94, 0x98, 0x89, 0xd7, 0xb4, 0x70, 0x18, 0x31, 0x2e, 
-    0x6b, 0x75, 0x64, 0xa2, 0xc7, 0x8f, 0x20, 0x07, 0xee, 0x29, 0x96, 0xb1, 0x64, 
-    0xc6, 0x67, 0xa6, 0x42, 0xaa, 0x5c, 0x49, 0xb0, 0xd3, 0x45, 0x93, 0x30, 0xc3, 
-    0x95, 0x69, 0xc0, 0xb2, 0xa6, 0xc7, 0x4e, 0x31, 0x63, 0x12, 0x13, 0x00, 0x80, 
-    0xa6, 0xcd, 0x9f, 0x06, 0xc3, 0x48, 0xcb, 0x09, 0xb3, 0x0e, 0x80, 0xa3, 0x03, 
-    0x80, 0x2a, 0x15, 0x18, 0x8b, 0x28, 0x4c, 0x10, 0x47, 0x8f, 0x26, 0x58, 0x0a, 
-    0x94, 0xa4, 0xd3, 0x8c, 0xcb, 0x02, 0x44, 0x3d, 0xea, 0xb3, 0xa6, 0x25, 0x5c, 
-    0xb8, 0x44, 0xd5, 0x3c, 0x32, 0x34, 0x5c, 0x31, 0x5e, 0x4e, 0x79, 0x6d, 0x45, 
-    0x6a, 0x13, 0x55, 0x34, 0x6d, 0x70, 0x8d, 0xb1, 0xdc, 0x83, 0x91, 0x97, 0x2d, 
-    0xbb, 0x44, 0x5b, 0xad, 0xe5, 0x5a, 0x33, 0x18, 0xdc, 0xbf, 0xc1, 0x56, 0x9a, 
-    0x42, 0xf6, 0xc9, 0x2a, 0xb1, 0x52, 0xa5, 0x90, 0xc1, 0x2c, 0xb5, 0x17, 0x00, 
-    0x81, 0x9a, 0xb8, 0xfe, 0xc2, 0x85, 0xb6, 0xf2, 0x13, 0x5a, 0x98, 0xbf, 0x5a, 
-    0x5d, 0xc6, 0xa8, 0xa9, 0x71, 0x4f, 0x96, 0x90, 0xde, 0x4a, 0x46, 0x15, 0x72, 
-    0x52, 0x38, 0x62, 0x31, 0x97, 0x2d, 0x7b, 0x56, 0x36, 0x5c, 0xe7, 0xc6, 0x06, 
-    0x22, 0x8a, 0xda, 0xf4, 0xd0, 0x6f, 0xdc, 0x63, 0xb8, 0x08, 0xd2, 0x8a, 0xb8, 
-    0xe7, 0x99, 0xea, 0x9c, 0xbf, 0x9e, 0x95, 0xfc, 0xe4, 0x39, 0xe9, 0xc3, 0x4b, 
-    0xc1, 0xe4, 0x3a, 0x44, 0xf5, 0x57, 0xd9, 0x2a, 0x63, 0xa4, 0x05, 0x32, 0x7b, 
-    0x38, 0xc5, 0xd6, 0xb4, 0x67, 0x9b, 0xb1, 0x66, 0xb4, 0x25, 0x1c, 0x63, 0x2c, 
-    0xcf, 0x00, 0xa6, 0x3a, 0xff, 0x24, 0x65, 0x4c, 0x39, 0xa1, 0x82, 0x6c, 0x44, 
-    0x53, 0x5b, 0xc5, 0x8c, 0x9a, 0xb0, 0x60, 0xce, 0xb6, 0x05, 0xb5, 0x8e, 0x11, 
-    0xd9, 0x2f, 0x92, 0xbc, 0x7e, 0x9d, 0xfe, 0x55, 0xf6, 0x6e, 0xc6, 0x62, 0xe0, 
-    0x89, 0x67, 0x10, 0x2a, 0xc6, 0xe8, 0xb2, 0x09, 0x24, 0xb2, 0x04, 0x36, 0x50, 
-    0x1e, 0xba, 0x50, 0xa3, 0x0d, 0x35, 0x36, 0xec, 0x22, 0x9a, 0x36, 0xd5, 0x10, 
-    0xf4, 0x44, 0x2c, 0x2f, 0x65, 0xd4, 0x1a, 0x4c, 0xc5, 0x20, 0xa3, 0x58, 0x46, 
-    0x2a, 0x78, 0xf6, 0x98, 0x43, 0xa9, 0x30, 0x83, 0x8b, 0x30, 0xb5, 0xf4, 0xa2, 
-    0xcb, 0x2c, 0x97, 0xfc, 0x21, 0x8e, 0x2e, 0xda, 0x04, 0x43, 0x8d, 0x32, 0xce, 
-    0x08, 0xe3, 0xa0, 0x36, 0xce, 0x44, 0x27, 0x4e, 0x20, 0xcb, 0x5c, 0xe5, 0x63, 
-    0x38, 0x85, 0x80, 0xf7, 0x10, 0x2d, 0xd1, 0xc0, 0x72, 0xcc, 0x31, 0xb6, 0x51, 
-    0x48, 0x4d, 0x34, 0xd5, 0x1c, 0xc3, 0x0c, 0x8e, 0x92, 0x69, 0x23, 0xdf, 0x8e, 
-    0x1b, 0xfe, 0x98, 0x13, 0x32, 0x06, 0x78, 0x06, 0x81, 0x43, 0xb4, 0x18, 0x73, 
-    0x89, 0x31, 0x34, 0xfe, 0x05, 0x9d, 0x38, 0xa9, 0x1c, 0x13, 0xe5, 0x83, 0xd0, 
-    0x44, 0x23, 0x4e, 0x12, 0x3d, 0x5a, 0xe9, 0x63, 0x19, 0x9e, 0x09, 0x48, 0x50, 
-    0x2f, 0xca, 0xec, 0xe2, 0x0c, 0x2e, 0x60, 0x6a, 0xb3, 0x0b, 0x41, 0x13, 0xfe, 
-    0xb5, 0x8b, 0x8b, 0xe2, 0xb4, 0xe2, 0xe6, 0x8f, 0x58, 0x36, 0x66, 0x5c, 0x41, 
-    0xb0, 0x40, 0x22, 0xcc, 0x31, 0x13, 0x2a, 0x28, 0xd0, 0xa2, 0x0e, 0x2e, 0x09, 
-    0x8d, 0x36, 0xb9, 0x89, 0x83, 0x9a, 0x49, 0xaa, 0x65, 0x48, 0x14, 0x32, 0x95, 
-    0x6c, 0x51, 0x87, 0x7e, 0xe1, 0xf0, 0x32, 0x41, 0x63, 0x01, 0x40, 0xe4, 0x0c, 
-    0x2b, 0xac, 0xe8, 0xe2, 0x8c, 0x36, 0xbb, 0x0d, 0xe4, 0x8a, 0x30, 0x93, 0x1a, 
-    0xff, 0xa3, 0x8d, 0x2e, 0xdb, 0x38, 0x23, 0xce, 0x11, 0x19, 0x4e, 0x53, 0x88, 
-    0x04, 0x5c, 0x55, 0xe2, 0x94, 0x29, 0x26, 0xa4, 0x20, 0x2c, 0x09, 0xb6, 0x84, 
-    0x13, 0x88, 0x38, 0xbc, 0xae, 0x75, 0xc0, 0x43, 0xb2, 0xec, 0x32, 0xcb, 0x2e, 
-    0xba, 0xe0, 0xe2, 0xe8, 0x40, 0x90, 0x54, 0x63, 0x4c, 0x32, 0xd4, 0x08, 0x84, 
-    0x0d, 0x29, 0x81, 0x94, 0xf4, 0x5a, 0x54, 0x17, 0x68, 0x5a, 0xd2, 0x2f, 0x24, 
-    0x08, 0x6b, 0xee, 0x16, 0xc5, 0x0c, 0x04, 0xc1, 0x5a, 0x12, 0x3c, 0x24, 0x96, 
-    0x40, 0x83, 0xd4, 0xe2, 0x90, 0x2b, 0xbe, 0x88, 0xb3, 0x8d, 0x30, 0xae, 0x66, 
-    0xe2, 0xed, 0x5a, 0x65, 0x10, 0x65, 0x45, 0x09, 0xc2, 0x96, 0x00, 0xc3, 0x16, 
-    0x99, 0x15, 0x84, 0x80, 0x01, 0x04, 0x6c, 0xe9, 0x91, 0x31, 0xae, 0x40, 0x24, 
-    0xcc, 0xbb, 0x02, 0x99, 0x56, 0x92, 0x2d, 0x9f, 0x7c, 0x12, 0x8b, 0x55, 0x31, 
-    0xf1, 0x22, 0x0e, 0x09, 0x30, 0x68, 0x82, 0x71, 0x27, 0x40, 0x05, 0x03, 0x4d, 
-    0x2a, 0x1f, 0x85, 0x31, 0x28, 0x46, 0xd3, 0xac, 0x21, 0x4e, 0x6f, 0x26, 0x25, 
-    0x02, 0x94, 0x5b, 0xce, 0x40, 0x2c, 0x11, 0xc6, 0x56, 0xda, 0x22, 0x0e, 0x17, 
-    0xb7, 0xfc, 0xa2, 0x69, 0x26, 0x4a, 0x11, 0xa9, 0xa3, 0x44, 0x38, 0xb9, 0xf9, 
-    0x0c, 0x17, 0xe2, 0xc4, 0x20, 0x90, 0xbe, 0x18, 0x15, 0x73, 0x88, 0x11, 0x4a, 
-    0x39, 0x12, 0xd2, 0x2d, 0x6e, 0x4e, 0x52, 0xd0, 0x10, 0xcb, 0xe4, 0x02, 0x47, 
-    0x14, 0x51, 0x14, 0x41, 0x55, 0x48, 0x4d, 0x5d, 0xb5, 0x8c, 0xd4, 0x05, 0x19, 
-    0x81, 0xf5, 0x12, 0x58, 0xbc, 0xa2, 0xc9, 0xd6, 0x21, 0xd9, 0x61, 0x4b, 0x9b, 
-    0x25, 0x3d, 0x73, 0x4b, 0x27, 0x43, 0x38, 0xb4, 0x44, 0x13, 0x87, 0x0c, 0xa3, 
-    0x51, 0x47, 0x68, 0x87, 0x74, 0x44, 0x20, 0x93, 0x4c, 0x3a, 0x12, 0xc8, 0x13, 
-    0x46, 0x43, 0xd4, 0x43, 0x33, 0x26, 0xc5, 0x92, 0xf7, 0xe1, 0x03, 0x49, 0xdc, 
-    0x36, 0x05, 0x88, 0x1f, 0x7e, 0x69, 0x49, 0xc4, 0xc8, 0xd9, 0xb8, 0x52, 0x41, 
-    0x9b, 0x95, 0xd1, 0x2f, 0x00, 0x3c, 0x30, 0xf9, 0x52, 0x42, 0x65, 0xb4, 0x19, 
-    0x32, 0xe1, 0x6d, 0xae, 0xd4, 0xe3, 0xe1, 0x40, 0xad, 0x11, 0x02, 0x00, 0xb4, 
-    0xbb, 0x79, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0xde, 0x00, 0x2c, 
-    0x04, 0x00, 0x10, 0x00, 0x43, 0x00, 0x26, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 
-    0x07, 0x05, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x14, 0x14, 0x14, 0x16, 0x14, 
-    0x04, 0x16, 0x16, 0x1a, 0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x23, 
-    0x24, 0x22, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x28, 0x09, 0x2d, 0x2c, 0x37, 0x31, 
-    0x2f, 0x3c, 0x33, 0x33, 0x33, 0x35, 0x35, 0x39, 0x3b, 0x3a, 0x42, 0x3b, 0x3b, 
-    0x3c, 0x43, 0x43, 0x43, 0x47, 0x2e, 0x17, 0x48, 0x44, 0x4b, 0x4b, 0x47, 0x58, 
-    0x4c, 0x43, 0x53, 0x4c, 0x4b, 0x4c, 0x4e, 0x2e, 0x2d, 0x4e, 0x3e, 0x4c, 0x4e, 
-    0x4c, 0x63, 0x51, 0x49, 0x10, 0x51, 0x4f, 0x66, 0x52, 0x3a, 0x44, 0x53, 0x53, 
-    0x54, 0x55, 0x34, 0x37, 0x55, 0x53, 0x64, 0x56, 0x56, 0x6c, 0x57, 0x57, 0x58, 
-    0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5c, 0x5c, 0x5d, 0x5c, 
-    0x5c, 0x72, 0x61, 0x61, 0x76, 0x63, 0x63, 0x64, 0x65, 0x65, 0x7a, 0x67, 0x67, 
-    0x68, 0x6a, 0x6a, 0x7d, 0x6b, 0x26, 0x26, 0x6b, 0x6a, 0x76, 0x6c, 0x6c, 0x6c, 
-    0x6e, 0x6e, 0x81, 0x6f, 0x30, 0x30, 0x73, 0x73, 0x85, 0x74, 0x6a, 0x16, 0x74, 
-    0x74, 0x74, 0x75, 0x38, 0x38, 0x76, 0x4a, 0x4a, 0x76, 0x76, 0x89, 0x77, 0x28, 
-    0x28, 0x79, 0x54, 0x08, 0x7a, 0x79, 0x86, 0x7b, 0x7b, 0x7d, 0x7b, 0x7b, 0x8c, 
-    0x7e, 0x66, 0x63, 0x7f, 0x7f, 0x90, 0x81, 0x4f, 0x4f, 0x83, 0x83, 0x84, 0x83, 
-    0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x79, 0x84, 0x85, 0x54, 0x54, 0x89, 0x89, 
-    0x96, 0x8a, 0x66, 0x09, 0x8b, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x69, 0x20, 
-    0x8b, 0x8b, 0x9b, 0x8c, 0x6a, 0x17, 0x8c, 0x8c, 0x8c, 0x8d, 0x71, 0x14, 0x8e, 
-    0x30, 0x31, 0x8e, 0x6b, 0x6c, 0x91, 0x91, 0x9d, 0x93, 0x69, 0x69, 0x94, 0x32, 
-    0x32, 0x94, 0x86, 0x8f, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x1b, 0x96, 0x73, 0x0c, 
-    0x96, 0x75, 0x23, 0x97, 0x77, 0x27, 0x97, 0x78, 0x35, 0x97, 0x98, 0xa6, 0x98, 
-    0x76, 0x17, 0x98, 0x8b, 0x1e, 0x98, 0x98, 0x98, 0x99, 0x99, 0xa6, 0x9a, 0x7b, 
-    0x24, 0x9a, 0x7b, 0x2b, 0x9b, 0x7d, 0x33, 0x9c, 0x35, 0x35, 0x9c, 0x7b, 0x15, 
-    0x9c, 0x7b, 0x1b, 0x9d, 0x7b, 0x0e, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x36, 0x9e, 
-    0x81, 0x3a, 0x9e, 0x82, 0x27, 0x9f, 0x83, 0x40, 0xa0, 0x37, 0x37, 0xa1, 0x7d, 
-    0x7c, 0xa1, 0x84, 0x35, 0xa1, 0x84, 0x3d, 0xa2, 0x81, 0x0f, 0xa2, 0x82, 0x1b, 
-    0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xae, 0xa3, 0xa3, 0xa4, 0xa4, 0x83, 0x15, 0xa4, 
-    0x85, 0x26, 0xa5, 0xa5, 0xb1, 0xa6, 0x8a, 0x48, 0xa6, 0x8b, 0x4b, 0xa6, 0x8c, 
-    0x54, 0xa7, 0x88, 0x15, 0xa9, 0x8f, 0x51, 0xaa, 0x98, 0x26, 0xab, 0x8b, 0x15, 
-    0xab, 0x8c, 0x19, 0xab, 0x91, 0x55, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb5, 0xad, 
-    0x95, 0x5b, 0xae, 0x90, 0x90, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x98, 
-    0x60, 0xb0, 0x97, 0x58, 0xb2, 0x94, 0x16, 0xb2, 0x9b, 0x64, 0xb3, 0x95, 0x19, 
-    0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xbd, 0xb4, 0x9e, 0x6a, 0xb6, 0x99, 0x19, 0xb6, 
-    0xa0, 0x6d, 0xb7, 0x98, 0x17, 0xb7, 0xa6, 0x28, 0xb7, 0xb7, 0xc0, 0xb9, 0xa4, 
-    0x73, 0xb9, 0xa5, 0xa7, 0xba, 0x9d, 0x19, 0xbb, 0xa5, 0x6a, 0xbb, 0xa7, 0x77, 
-    0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 0xbd, 0xc6, 0xbe, 0xa1, 0x1b, 0xbf, 
-    0xad, 0x81, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xcb, 0xc5, 0xb1, 
-    0x69, 0xc5, 0xb3, 0x89, 0xc5, 0xb4, 0x8c, 0xc6, 0xaa, 0x1d, 0xc7, 0xb2, 0xb2, 
-    0xc7, 0xb5, 0x28, 0xc9, 0xad, 0x1e, 0xca, 0xae, 0x23, 0xca, 0xca, 0xcc, 0xcc, 
-    0xcc, 0xd3, 0xcd, 0xb2, 0x1f, 0xcd, 0xb2, 0x20, 0xd0, 0xb8, 0x37, 0xd1, 0xb6, 
-    0x22, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xda, 0xd5, 0xbb, 0x23, 0xd7, 0xbe, 0x25, 
-    0xd8, 0xc9, 0xc9, 0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 0x26, 0xdc, 0xc4, 0x33, 0xdc, 
-    0xc8, 0x5c, 0xdd, 0xdd, 0xe2, 0xde, 0xc8, 0x2a, 0xde, 0xd2, 0xd2, 0xe1, 0xc8, 
-    0x27, 0xe2, 0xd7, 0xa8, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe5, 0xdb, 0xdb, 
-    0xe6, 0xe6, 0xe9, 0xe7, 0xd1, 0x2b, 0xea, 0xd3, 0x2b, 0xea, 0xe4, 0xe4, 0xeb, 
-    0xeb, 0xec, 0xec, 0xda, 0x30, 0xee, 0xd8, 0x2d, 0xee, 0xee, 0xf1, 0xf2, 0xdc, 
-    0x2e, 0xf3, 0xee, 0xee, 0xf3, 0xf3, 0xf4, 0xf4, 0xdf, 0x30, 0xf4, 0xe0, 0x3b, 
-    0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf8, 0xef, 0xaa, 0xfa, 0xe5, 0x32, 0xfa, 
-    0xf7, 0xf7, 0xfc, 0xf2, 0x8f, 0xfd, 0xec, 0x4a, 0xfd, 0xec, 0x52, 0xff, 0xeb, 
-    0x34, 0xff, 0xec, 0x3c, 0xff, 0xed, 0x44, 0xff, 0xef, 0x5a, 0xff, 0xf0, 0x36, 
-    0xff, 0xf0, 0x66, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x86, 0xff, 0xff, 0xff, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 
-    0xbd, 0x09, 0x1c, 0x48, 0xb0, 0x60, 0xc1, 0x16, 0x42, 0xe6, 0x18, 0x69, 0x61, 
-    0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x3a, 0xec, 0xb1, 0x89, 0x96, 0xb2, 0x6e, 
-    0x18, 0x9d, 0xd1, 0x9a, 0x24, 0x11, 0x22, 0x27, 0x5b, 0xbe, 0x72, 0x49, 0xea, 
-    0x48, 0x52, 0xe0, 0xa6, 0x8b, 0x18, 0x53, 0xa6, 0x24, 0x96, 0xa9, 0x24, 0xc1, 
-    0x58, 0xd0, 0xaa, 0xc9, 0x44, 0x46, 0xaa, 0x60, 0x30, 0x97, 0x04, 0xa3, 0xd0, 
-    0x52, 0xc9, 0x53, 0x65, 0x90, 0x05, 0x38, 0x9b, 0xc9, 0x1c, 0x6a, 0x8c, 0x13, 
-    0xc1, 0x62, 0xde, 0xa8, 0xb5, 0x72, 0x19, 0x05, 0x58, 0xcf, 0xa7, 0xaf, 0x00, 
-    0x00, 0x78, 0xe0, 0x52, 0xe8, 0xd0, 0x6a, 0xc2, 0x72, 0x19, 0xc5, 0x63, 0xab, 
-    0x9a, 0x52, 0x9c, 0x3b, 0x9f, 0xf6, 0x6c, 0x22, 0x15, 0x00, 0x50, 0x92, 0xad, 
-    0xae, 0x1a, 0x6b, 0x66, 0x6a, 0xd9, 0x32, 0xab, 0xbe, 0x70, 0x16, 0x12, 0xdb, 
-    0x33, 0xda, 0x83, 0xb2, 0x66, 0x4b, 0xb6, 0x8a, 0x29, 0xb3, 0x98, 0x24, 0x53, 
-    0x56, 0xab, 0x21, 0xb3, 0x66, 0xed, 0xda, 0xb5, 0x8e, 0xaf, 0xe8, 0xf2, 0xec, 
-    0x85, 0x17, 0xc0, 0x80, 0x8e, 0xa4, 0x72, 0x91, 0x22, 0xc5, 0xb7, 0x5a, 0x2c, 
-    0x49, 0xc2, 0xae, 0x42, 0x0b, 0x26, 0x6b, 0xa9, 0xc4, 0x5e, 0x8a, 0x55, 0xa6, 
-    0x6a, 0x0c, 0x80, 0x80, 0x44, 0x3e, 0xac, 0x9a, 0xb5, 0x42, 0x35, 0x74, 0x99, 
-    0xaf, 0xcc, 0x32, 0x73, 0x59, 0x2a, 0x89, 0x03, 0xa5, 0xb3, 0x63, 0x8a, 0x19, 
-    0x91, 0x06, 0x30, 0x21, 0xa2, 0xac, 0x65, 0xd0, 0x84, 0x79, 0x73, 0xe5, 0x2b, 
-    0xd8, 0xd5, 0x99, 0xb2, 0x4a, 0x56, 0x49, 0xf9, 0x89, 0x16, 0x68, 0xb1, 0x81, 
-    0x76, 0x27, 0x90, 0x68, 0x28, 0x97, 0x31, 0x6f, 0x99, 0x73, 0x55, 0x16, 0x2c, 
-    0xf3, 0x66, 0xc7, 0x4c, 0xdd, 0x68, 0x7d, 0xff, 0xba, 0xf8, 0xea, 0xd3, 0x27, 
-    0x58, 0xb8, 0x55, 0x7a, 0xd9, 0x0d, 0xa0, 0xe3, 0x22, 0x5f, 0xa8, 0x36, 0xfb, 
-    0xba, 0xda, 0xac, 0x99, 0x2d, 0x6a, 0xd3, 0x6c, 0x75, 0x54, 0xf5, 0xe9, 0xb9, 
-    0x4a, 0x62, 0xb4, 0xa8, 0xe2, 0xdf, 0x7a, 0xbb, 0x1d, 0x20, 0xd1, 0x23, 0xbe, 
-    0x40, 0xb3, 0x14, 0x27, 0xc2, 0x20, 0x23, 0x94, 0x71, 0xfa, 0x91, 0x74, 0x07, 
-    0x31, 0xc4, 0x5c, 0xa4, 0x49, 0x34, 0xbd, 0x78, 0xd1, 0x8d, 0x46, 0xce, 0xa8, 
-    0xc7, 0x9e, 0x81, 0x10, 0xed, 0x55, 0x4d, 0x30, 0xd6, 0x41, 0x03, 0x8d, 0x2f, 
-    0xad, 0x58, 0x93, 0xcb, 0x35, 0xde, 0x49, 0x74, 0x07, 0x6e, 0xb8, 0x74, 0x43, 
-    0x4c, 0x00, 0xb8, 0xa8, 0x02, 0x40, 0x58, 0xaa, 0xa8, 0x44, 0x07, 0x7b, 0xed, 
-    0x15, 0x64, 0x94, 0x40, 0xac, 0x0c, 0xd5, 0x8a, 0x29, 0xb2, 0x20, 0x63, 0x62, 
-    0x2d, 0xcc, 0xd4, 0x14, 0x57, 0x44, 0x51, 0xa8, 0x12, 0x4d, 0x37, 0xbd, 0x38, 
-    0x05, 0xcc, 0x01, 0xc4, 0x1c, 0x03, 0xc1, 0x27, 0x18, 0xf5, 0x42, 0x21, 0x46, 
-    0xba, 0xb1, 0x47, 0xd5, 0x40, 0x80, 0xc0, 0x27, 0xd0, 0x7c, 0x32, 0xfd, 0xf8, 
-    0xc8, 0x32, 0xac, 0x40, 0x83, 0x88, 0x40, 0xa1, 0x40, 0x64, 0x44, 0x2a, 0x1d, 
-    0x62, 0x44, 0x0b, 0x2e, 0x4f, 0x12, 0x83, 0x11, 0x31, 0x71, 0xc2, 0xd2, 0x0b, 
-    0x4a, 0x36, 0xb2, 0x37, 0xdd, 0x40, 0xac, 0xc8, 0x92, 0x8b, 0x2d, 0x08, 0xca, 
-    0x04, 0xcd, 0x6c, 0x02, 0xd9, 0xe2, 0x49, 0x30, 0x35, 0x45, 0xd4, 0x48, 0x7a, 
-    0xa1, 0x61, 0xf4, 0x64, 0x9c, 0xdd, 0x1c, 0x33, 0x00, 0x7b, 0x06, 0x14, 0xd4, 
-    0x4a, 0x30, 0x46, 0x1a, 0x57, 0x0d, 0x34, 0x89, 0x14, 0x44, 0xca, 0x23, 0x11, 
-    0xe5, 0x18, 0x69, 0x68, 0x3c, 0x60, 0x5a, 0x90, 0x27, 0xa4, 0xec, 0xc1, 0x89, 
-    0x25, 0xb5, 0x58, 0xff, 0xc6, 0x0a, 0x4e, 0xa6, 0x9e, 0xaa, 0xd8, 0x27, 0xec, 
-    0x09, 0xb0, 0x6a, 0x2b, 0xb9, 0x24, 0xd8, 0x8c, 0x2c, 0x8b, 0xc8, 0xb2, 0x64, 
-    0x47, 0x8d, 0xd8, 0x1a, 0xa9, 0x33, 0x18, 0x14, 0x58, 0xd0, 0x22, 0xb9, 0x08, 
-    0xe3, 0x8b, 0x2c, 0x86, 0x0c, 0xe4, 0x0b, 0x32, 0x9e, 0x45, 0xe4, 0x9f, 0xb1, 
-    0x74, 0xe1, 0x4a, 0x5a, 0xa6, 0x24, 0x19, 0x53, 0x4d, 0x2e, 0x4c, 0xf6, 0xa4, 
-    0x4c, 0x2f, 0xb8, 0x40, 0x4a, 0x17, 0x30, 0x8c, 0x78, 0x11, 0x88, 0x53, 0xc4, 
-    0x34, 0x40, 0xda, 0x9f, 0x24, 0x09, 0x13, 0xe1, 0x43, 0x93, 0xfc, 0x17, 0x84, 
-    0x00, 0x52, 0x0d, 0x80, 0x25, 0x5d, 0x9a, 0x80, 0x60, 0xc2, 0xbf, 0x2a, 0x74, 
-    0xa3, 0x8a, 0x37, 0x06, 0xe0, 0xc5, 0x2d, 0x4e, 0x11, 0xa5, 0xe2, 0x53, 0x63, 
-    0x4d, 0xd0, 0xf5, 0x0a, 0x09, 0x26, 0x90, 0xa0, 0x02, 0x1d, 0xb0, 0x74, 0x53, 
-    0x88, 0x40, 0x09, 0xe4, 0xfb, 0x25, 0xc2, 0x10, 0x25, 0x96, 0x12, 0x59, 0x65, 
-    0x61, 0x50, 0xf1, 0x53, 0xce, 0x44, 0x01, 0x02, 0x11, 0x23, 0x63, 0x64, 0xc4, 
-    0x40, 0x0f, 0x6c, 0xcc, 0x31, 0x44, 0x0a, 0xa7, 0xe4, 0x4c, 0x79, 0x02, 0x2a, 
-    0x06, 0x8a, 0x37, 0x8c, 0x3c, 0xa9, 0x12, 0x0e, 0x2f, 0xe3, 0x54, 0x2f, 0xb6, 
-    0x32, 0xfe, 0x20, 0x08, 0x2e, 0x4e, 0xa9, 0x54, 0x45, 0xcf, 0x2e, 0xf5, 0x80, 
-    0x92, 0xb1, 0x8d, 0x78, 0x33, 0x83, 0x40, 0x29, 0x13, 0xd3, 0x46, 0x11, 0x48, 
-    0x97, 0x14, 0xb3, 0xad, 0xb0, 0x14, 0xf4, 0x45, 0x34, 0xba, 0x10, 0xf2, 0x44, 
-    0x12, 0x43, 0x54, 0x5d, 0x52, 0x8c, 0xa7, 0xd2, 0xb2, 0x44, 0x41, 0x40, 0x48, 
-    0xf1, 0x75, 0x11, 0xa5, 0x30, 0x22, 0x76, 0x49, 0x1e, 0xd3, 0x75, 0xcc, 0x27, 
-    0x0d, 0x25, 0x91, 0x44, 0x1b, 0xb3, 0xd4, 0xd9, 0xc3, 0xdb, 0x24, 0x9d, 0x46, 
-    0x21, 0xe0, 0xd2, 0xe3, 0xbe, 0xd2, 0xb4, 0x43, 0x3e, 0x0c, 0xc3, 0xd3, 0xcd, 
-    0x7c, 0x97, 0x14, 0xc3, 0x0c, 0x3d, 0x3c, 0x2d, 0x11, 0x78, 0x3c, 0x11, 0x53, 
-    0x41, 0xe2, 0x94, 0x0f, 0x54, 0xb4, 0x4a, 0xb4, 0x28, 0x50, 0x39, 0xe5, 0xfb, 
-    0x56, 0x9a, 0x12, 0x2c, 0x00, 0x4c, 0xbe, 0xb9, 0xd8, 0x67, 0x50, 0x1a, 0x16, 
-    0x94, 0x00, 0xc0, 0x3b, 0xfa, 0xcb, 0x42, 0x5c, 0xde, 0x4d, 0xca, 0x96, 0x02, 
-    0x10, 0xc1, 0xea, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x9c, 
-    0x00, 0x2c, 0x04, 0x00, 0x10, 0x00, 0x43, 0x00, 0x26, 0x00, 0x87, 0x0e, 0x0e, 
-    0x0e, 0x14, 0x14, 0x14, 0x1c, 0x1b, 0x1c, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 
-    0x33, 0x33, 0x33, 0x39, 0x37, 0x45, 0x3b, 0x3b, 0x3b, 0x3f, 0x3f, 0x40, 0x42, 
-    0x40, 0x4d, 0x42, 0x42, 0x43, 0x46, 0x44, 0x51, 0x48, 0x47, 0x53, 0x4c, 0x4c, 
-    0x4c, 0x4e, 0x2e, 0x2b, 0x4e, 0x4d, 0x59, 0x4f, 0x4f, 0x50, 0x54, 0x53, 0x55, 
-    0x55, 0x54, 0x64, 0x56, 0x56, 0x6c, 0x57, 0x3e, 0x3f, 0x5a, 0x59, 0x6e, 0x5c, 
-    0x5c, 0x72, 0x5d, 0x5d, 0x5d, 0x61, 0x61, 0x76, 0x63, 0x63, 0x64, 0x65, 0x65, 
-    0x7a, 0x67, 0x67, 0x68, 0x6a, 0x4f, 0x4b, 0x6a, 0x6a, 0x7d, 0x6b, 0x6a, 0x74, 
-    0x6b, 0x6b, 0x6c, 0x6e, 0x6e, 0x81, 0x71, 0x4c, 0x52, 0x72, 0x34, 0x34, 0x72, 
-    0x59, 0x57, 0x73, 0x73, 0x73, 0x73, 0x73, 0x85, 0x76, 0x3c, 0x3c, 0x76, 0x75, 
-    0x7f, 0x76, 0x76, 0x88, 0x7b, 0x44, 0x44, 0x7b, 0x7b, 0x8c, 0x7c, 0x7b, 0x7c, 
-    0x80, 0x4e, 0x4e, 0x82, 0x82, 0x83, 0x83, 0x83, 0x93, 0x84, 0x52, 0x52, 0x85, 
-    0x69, 0x6a, 0x86, 0x71, 0x70, 0x88, 0x59, 0x59, 0x88, 0x88, 0x97, 0x8c, 0x8c, 
-    0x9b, 0x8d, 0x6b, 0x15, 0x8e, 0x62, 0x62, 0x8f, 0x6c, 0x1b, 0x90, 0x6e, 0x19, 
-    0x90, 0x90, 0x9f, 0x93, 0x6a, 0x6a, 0x93, 0x75, 0x33, 0x94, 0x94, 0xa2, 0x95, 
-    0x74, 0x1b, 0x96, 0x75, 0x23, 0x96, 0x76, 0x2a, 0x98, 0x77, 0x1d, 0x98, 0x78, 
-    0x24, 0x98, 0x97, 0xa5, 0x99, 0x77, 0x12, 0x99, 0x99, 0xa6, 0x9a, 0x7a, 0x24, 
-    0x9a, 0x7b, 0x2c, 0x9b, 0x74, 0x74, 0x9b, 0x7b, 0x1b, 0x9b, 0x7d, 0x33, 0x9c, 
-    0x7b, 0x15, 0x9d, 0x7f, 0x39, 0x9d, 0x9d, 0xa9, 0x9e, 0x81, 0x3a, 0x9f, 0x80, 
-    0x25, 0x9f, 0x83, 0x40, 0xa0, 0x7a, 0x7a, 0xa0, 0x81, 0x23, 0xa0, 0x82, 0x34, 
-    0xa1, 0x84, 0x3d, 0xa2, 0x82, 0x1d, 0xa2, 0x86, 0x43, 0xa3, 0x82, 0x17, 0xa3, 
-    0xa3, 0xaf, 0xa3, 0xa3, 0xb0, 0xa4, 0x89, 0x45, 0xa5, 0x88, 0x2d, 0xa6, 0x8a, 
-    0x3a, 0xa6, 0x8b, 0x4b, 0xa8, 0x8d, 0x4e, 0xa9, 0x8d, 0x45, 0xa9, 0x8f, 0x51, 
-    0xaa, 0x8a, 0x8a, 0xab, 0x90, 0x3d, 0xab, 0x91, 0x4a, 0xab, 0x91, 0x55, 0xad, 
-    0x95, 0x5b, 0xaf, 0x97, 0x60, 0xaf, 0x98, 0x60, 0xaf, 0xaf, 0xb9, 0xb0, 0x99, 
-    0x5e, 0xb2, 0x99, 0x53, 0xb2, 0x9b, 0x64, 0xb3, 0xb3, 0xbc, 0xb4, 0x98, 0x98, 
-    0xb4, 0x9e, 0x6a, 0xb6, 0xa0, 0x6d, 0xb7, 0x99, 0x23, 0xb7, 0xa2, 0x70, 0xb9, 
-    0xa4, 0x73, 0xba, 0xaf, 0xb4, 0xbb, 0xa7, 0x78, 0xbc, 0xa2, 0x36, 0xbc, 0xa8, 
-    0x77, 0xbd, 0xaa, 0x7b, 0xbf, 0xad, 0x81, 0xc0, 0xac, 0x7f, 0xc1, 0xae, 0x83, 
-    0xc4, 0xb2, 0x85, 0xc6, 0xad, 0x37, 0xc6, 0xb3, 0x6f, 0xc6, 0xb4, 0x8b, 0xc9, 
-    0xae, 0x2c, 0xca, 0xb4, 0x4d, 0xca, 0xba, 0x95, 0xcc, 0xbd, 0x99, 0xd1, 0xc0, 
-    0x77, 0xd5, 0xbe, 0x3e, 0xd6, 0xc3, 0x6d, 0xd8, 0xc3, 0x58, 0xda, 0xcf, 0xb2, 
-    0xde, 0xca, 0x4b, 0xea, 0xdf, 0x9d, 0xea, 0xe0, 0xa6, 0xed, 0xd9, 0x46, 0xf2, 
-    0xe3, 0x71, 0xf2, 0xe6, 0x82, 0xf4, 0xe3, 0x54, 0xf5, 0xe1, 0x40, 0xfe, 0xee, 
-    0x61, 0xff, 0xec, 0x3e, 0xff, 0xed, 0x44, 0xff, 0xee, 0x4b, 0xff, 0xee, 0x52, 
-    0xff, 0xf0, 0x63, 0xff, 0xf1, 0x6a, 0xff, 0xf1, 0x73, 0xff, 0xf2, 0x7b, 0xff, 
-    0xf3, 0x84, 0xff, 0xf3, 0x8b, 0xff, 0xf4, 0x92, 0xff, 0xf7, 0xac, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xde, 0x00, 0x39, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0x41, 0x17, 0x57, 0x0c, 0x2a, 
-    0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0xa4, 0x33, 0x51, 0xa2, 
-    0xc5, 0x8b, 0x10, 0x07, 0x15, 0xdc, 0x83, 0xb1, 0xa3, 0xc7, 0x86, 0x14, 0x0b, 
-    0x36, 0xfa, 0x48, 0xf2, 0x22, 0x45, 0x2f, 0x25, 0x53, 0xaa, 0x94, 0x78, 0x66, 
-    0x65, 0x49, 0x48, 0x02, 0x25, 0xb9, 0xfc, 0xc8, 0x71, 0x0f, 0xc7, 0x81, 0x1a, 
-    0x67, 0xea, 0x44, 0x29, 0xf0, 0xe6, 0xc2, 0x37, 0x3a, 0x1b, 0x22, 0x58, 0x99, 
-    0x33, 0xa8, 0xc7, 0x30, 0x46, 0x93, 0x12, 0x4c, 0xc3, 0xc9, 0xa7, 0xc1, 0x42, 
-    0x92, 0x22, 0x29, 0xed, 0x08, 0xb4, 0xe2, 0x54, 0x88, 0x02, 0xae, 0x12, 0x4c, 
-    0x98, 0x34, 0xa4, 0xc1, 0x3f, 0x22, 0x9d, 0x62, 0xcc, 0xea, 0x91, 0x80, 0x41, 
-    0x3f, 0x0c, 0xab, 0x72, 0x12, 0x03, 0x71, 0x86, 0x56, 0x82, 0x6a, 0x0d, 0x52, 
-    0x14, 0xab, 0x70, 0x4d, 0x52, 0xb2, 0x17, 0xf7, 0xc4, 0x4d, 0xba, 0x42, 0xe2, 
-    0x9e, 0x2d, 0x9c, 0xbc, 0xbe, 0x0d, 0x5a, 0x14, 0xa2, 0xdd, 0x95, 0x0d, 0x14, 
-    0xe2, 0x55, 0x88, 0x74, 0xb0, 0xc5, 0xc5, 0x8e, 0x23, 0x77, 0x6c, 0xe1, 0x71, 
-    0x84, 0xe4, 0x81, 0x94, 0x31, 0x5a, 0xbe, 0xec, 0x91, 0x42, 0x5f, 0x82, 0x6e, 
-    0x39, 0x93, 0x44, 0x21, 0xba, 0xf4, 0xd4, 0xc3, 0x0b, 0x65, 0x98, 0xbe, 0x08, 
-    0x66, 0xb5, 0x47, 0xd5, 0xae, 0x25, 0x42, 0x89, 0x5d, 0x10, 0xb5, 0x41, 0x18, 
-    0xb4, 0x05, 0x92, 0xce, 0xcd, 0x9b, 0x77, 0x82, 0xde, 0xc0, 0x23, 0xba, 0x28, 
-    0x1d, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0xdd, 0x00, 0x2c, 0x04, 
-    0x00, 0x0a, 0x00, 0x39, 0x00, 0x2c, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 
-    0x05, 0x0b, 0x0b, 0x0c, 0x13, 0x12, 0x0c, 0x13, 0x13, 0x14, 0x17, 0x16, 0x19, 
-    0x1b, 0x1b, 0x1b, 0x1f, 0x1e, 0x26, 0x22, 0x1e, 0x07, 0x23, 0x23, 0x24, 0x24, 
-    0x22, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2c, 0x39, 0x30, 0x2c, 0x0a, 0x33, 0x33, 
-    0x33, 0x34, 0x33, 0x3b, 0x39, 0x38, 0x43, 0x3b, 0x3b, 0x3c, 0x44, 0x44, 0x44, 
-    0x46, 0x41, 0x4e, 0x4b, 0x4b, 0x4c, 0x4c, 0x23, 0x1d, 0x4c, 0x46, 0x57, 0x4d, 
-    0x3d, 0x4b, 0x4d, 0x4b, 0x62, 0x4f, 0x2b, 0x28, 0x4f, 0x47, 0x0f, 0x50, 0x4f, 
-    0x65, 0x52, 0x3b, 0x45, 0x53, 0x53, 0x54, 0x55, 0x35, 0x38, 0x56, 0x2d, 0x2a, 
-    0x56, 0x55, 0x6c, 0x57, 0x4b, 0x57, 0x57, 0x57, 0x58, 0x58, 0x2d, 0x29, 0x58, 
-    0x58, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5a, 0x66, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 
-    0x72, 0x5f, 0x60, 0x75, 0x61, 0x61, 0x76, 0x64, 0x64, 0x64, 0x65, 0x65, 0x79, 
-    0x6a, 0x6a, 0x75, 0x6a, 0x6a, 0x7d, 0x6b, 0x52, 0x57, 0x6b, 0x6a, 0x6c, 0x6d, 
-    0x25, 0x26, 0x6d, 0x6d, 0x81, 0x6f, 0x32, 0x33, 0x72, 0x72, 0x85, 0x74, 0x74, 
-    0x74, 0x75, 0x37, 0x37, 0x76, 0x28, 0x28, 0x76, 0x76, 0x89, 0x77, 0x69, 0x6c, 
-    0x78, 0x5d, 0x0e, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8c, 0x7d, 0x47, 0x47, 0x7f, 
-    0x7e, 0x87, 0x7f, 0x7f, 0x90, 0x83, 0x5e, 0x09, 0x83, 0x83, 0x84, 0x83, 0x83, 
-    0x94, 0x84, 0x2b, 0x2b, 0x86, 0x54, 0x54, 0x89, 0x2d, 0x2e, 0x8a, 0x66, 0x09, 
-    0x8b, 0x2f, 0x30, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x9b, 0x8c, 0x6a, 0x19, 0x8d, 
-    0x72, 0x18, 0x8d, 0x8d, 0x92, 0x8e, 0x30, 0x31, 0x91, 0x6e, 0x0c, 0x91, 0x91, 
-    0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 0x93, 0x94, 0x71, 0x71, 0x94, 0x94, 0xa2, 
-    0x95, 0x6b, 0x6b, 0x95, 0x74, 0x1b, 0x95, 0x75, 0x23, 0x96, 0x74, 0x0d, 0x97, 
-    0x75, 0x16, 0x97, 0x77, 0x28, 0x97, 0x87, 0x1c, 0x98, 0x7b, 0x41, 0x98, 0x87, 
-    0x8f, 0x98, 0x98, 0xa6, 0x9a, 0x7a, 0x23, 0x9a, 0x9a, 0x9b, 0x9b, 0x35, 0x35, 
-    0x9b, 0x7b, 0x1c, 0x9b, 0x7c, 0x2c, 0x9b, 0x7d, 0x33, 0x9c, 0x7b, 0x14, 0x9c, 
-    0x7f, 0x39, 0x9d, 0x7b, 0x0e, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x35, 0x9e, 0x81, 
-    0x3a, 0x9f, 0x80, 0x29, 0xa0, 0x37, 0x37, 0xa1, 0x7d, 0x7d, 0xa1, 0x84, 0x3c, 
-    0xa2, 0x81, 0x0f, 0xa2, 0x83, 0x28, 0xa2, 0x85, 0x34, 0xa2, 0x86, 0x42, 0xa2, 
-    0xa2, 0xad, 0xa3, 0x83, 0x14, 0xa3, 0x83, 0x1a, 0xa3, 0xa3, 0xa3, 0xa5, 0x89, 
-    0x45, 0xa5, 0xa5, 0xb1, 0xa6, 0x8b, 0x4b, 0xa6, 0x8c, 0x4f, 0xa7, 0x88, 0x18, 
-    0xa7, 0x8d, 0x51, 0xa8, 0x8e, 0x51, 0xaa, 0x91, 0x54, 0xab, 0x8c, 0x15, 0xab, 
-    0x8c, 0x19, 0xab, 0xaa, 0xb5, 0xab, 0xab, 0xac, 0xad, 0x95, 0x5b, 0xae, 0xae, 
-    0xb9, 0xaf, 0x90, 0x18, 0xaf, 0x91, 0x91, 0xaf, 0x98, 0x61, 0xb0, 0x98, 0x29, 
-    0xb1, 0x9a, 0x63, 0xb2, 0x94, 0x17, 0xb3, 0x95, 0x19, 0xb3, 0x9a, 0x4f, 0xb3, 
-    0xb3, 0xb3, 0xb3, 0xb3, 0xbd, 0xb4, 0x9e, 0x6a, 0xb6, 0x99, 0x19, 0xb7, 0x99, 
-    0x17, 0xb7, 0xa8, 0x25, 0xb8, 0xa2, 0x6c, 0xb8, 0xb8, 0xc1, 0xb9, 0xa5, 0x74, 
-    0xba, 0x9c, 0x1a, 0xbb, 0xa3, 0x53, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc4, 0xbd, 
-    0xa7, 0xa8, 0xbe, 0xa1, 0x1a, 0xbe, 0xab, 0x7c, 0xc2, 0xa5, 0x1c, 0xc3, 0xb1, 
-    0x86, 0xc3, 0xc2, 0xc3, 0xc3, 0xc3, 0xcb, 0xc4, 0xb0, 0x6a, 0xc5, 0xb4, 0x8a, 
-    0xc6, 0xaa, 0x1d, 0xc6, 0xb4, 0x29, 0xc8, 0xad, 0x21, 0xc8, 0xb3, 0xb3, 0xc9, 
-    0xae, 0x1e, 0xca, 0xb1, 0x37, 0xcb, 0xcb, 0xcc, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 
-    0xd3, 0xcd, 0xb2, 0x20, 0xd1, 0xb6, 0x21, 0xd2, 0xd2, 0xd5, 0xd5, 0xbb, 0x23, 
-    0xd5, 0xd5, 0xda, 0xd6, 0xca, 0xca, 0xd7, 0xbf, 0x25, 0xda, 0xda, 0xdd, 0xdc, 
-    0xc3, 0x26, 0xdc, 0xc7, 0x2a, 0xdd, 0xdd, 0xe2, 0xde, 0xcb, 0x5c, 0xe0, 0xd4, 
-    0xa4, 0xe1, 0xc9, 0x27, 0xe3, 0xcc, 0x29, 0xe3, 0xe3, 0xe5, 0xe4, 0xda, 0xda, 
-    0xe6, 0xd0, 0x2b, 0xe6, 0xe6, 0xe9, 0xe9, 0xd4, 0x38, 0xeb, 0xd4, 0x2c, 0xeb, 
-    0xeb, 0xec, 0xee, 0xd9, 0x2d, 0xee, 0xe7, 0xe7, 0xef, 0xef, 0xf1, 0xf1, 0xee, 
-    0xee, 0xf2, 0xdc, 0x2f, 0xf2, 0xdd, 0x39, 0xf3, 0xf3, 0xf4, 0xf4, 0xdf, 0x30, 
-    0xf5, 0xe1, 0x3d, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xe5, 0x31, 0xf9, 
-    0xe6, 0x44, 0xf9, 0xf6, 0xf7, 0xfa, 0xe5, 0x32, 0xfd, 0xec, 0x53, 0xfe, 0xee, 
-    0x63, 0xfe, 0xf4, 0x94, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 0x43, 
-    0xff, 0xee, 0x4c, 0xff, 0xef, 0x5b, 0xff, 0xf0, 0x67, 0xff, 0xf1, 0x57, 0xff, 
-    0xf2, 0x77, 0xff, 0xf3, 0x85, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xbb, 
-    0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 
-    0x61, 0x43, 0x5b, 0x03, 0x4f, 0x39, 0x9c, 0x48, 0x11, 0x61, 0xb3, 0x6e, 0x10, 
-    0x2b, 0x6a, 0xd4, 0x58, 0xec, 0xda, 0x2c, 0x81, 0xd7, 0xac, 0x6d, 0x1c, 0x39, 
-    0x90, 0x53, 0xa5, 0x82, 0x95, 0x9e, 0x4d, 0x8b, 0x55, 0x8d, 0x9a, 0x32, 0x56, 
-    0x24, 0x37, 0x9e, 0x2a, 0x36, 0x6d, 0x5a, 0xb0, 0x59, 0x8f, 0xba, 0x71, 0x0a, 
-    0x56, 0x13, 0xd9, 0xb4, 0x62, 0x9a, 0x62, 0x0a, 0xc4, 0x41, 0x43, 0x46, 0x43, 
-    0x52, 0x2a, 0x6b, 0x4e, 0x43, 0xf6, 0x8b, 0x67, 0xd2, 0x69, 0xcc, 0x44, 0x91, 
-    0xfc, 0xe1, 0xe9, 0xd5, 0xb0, 0x65, 0xdc, 0x96, 0xe9, 0x42, 0x95, 0x44, 0x21, 
-    0x2f, 0xa5, 0x35, 0x71, 0xb1, 0x3a, 0xe4, 0xca, 0x97, 0x52, 0x5a, 0xb1, 0xc6, 
-    0x56, 0x14, 0xf2, 0xe9, 0x18, 0xb7, 0xb7, 0x70, 0xdf, 0x2e, 0x7b, 0x75, 0x06, 
-    0xe1, 0x2f, 0xb0, 0x3f, 0x7d, 0xb9, 0x3a, 0x64, 0x16, 0x6f, 0x33, 0x5a, 0x13, 
-    0xcf, 0xf4, 0x8a, 0x4b, 0x18, 0xae, 0xae, 0x05, 0x07, 0x4f, 0x3d, 0x05, 0x4b, 
-    0x0b, 0x97, 0xd2, 0x62, 0xc1, 0xae, 0x51, 0x94, 0xe3, 0xb6, 0x70, 0xe1, 0x1d, 
-    0x00, 0x04, 0x1c, 0x7c, 0x14, 0x2b, 0x97, 0x4f, 0xbc, 0x60, 0x83, 0x49, 0x75, 
-    0x98, 0x04, 0x98, 0xe5, 0xc2, 0xba, 0x00, 0xa8, 0x0e, 0xa0, 0x70, 0x15, 0xaf, 
-    0x5c, 0xb9, 0xbe, 0x2a, 0xc5, 0x45, 0x2d, 0xd8, 0x44, 0x55, 0xa7, 0x0b, 0x33, 
-    0x52, 0xad, 0x5a, 0x73, 0x41, 0xa9, 0x39, 0x0f, 0x31, 0x9b, 0x46, 0xab, 0x26, 
-    0x4d, 0x65, 0xa7, 0xaa, 0xc1, 0x6c, 0x38, 0x2c, 0x37, 0xe1, 0x20, 0xbc, 0x55, 
-    0x23, 0x26, 0x38, 0x6b, 0xd6, 0xaa, 0x45, 0xdd, 0x72, 0x31, 0xa3, 0x15, 0xcc, 
-    0x57, 0x30, 0x5a, 0xcd, 0x4e, 0x3a, 0xff, 0x9c, 0xe2, 0x9c, 0xb0, 0x84, 0xe8, 
-    0x00, 0x58, 0x13, 0xb4, 0xe3, 0x8b, 0x95, 0xab, 0xec, 0x80, 0x05, 0x9e, 0xfa, 
-    0x13, 0xeb, 0xd0, 0xc4, 0x46, 0xe5, 0xe1, 0x1e, 0x0b, 0x80, 0x1e, 0x40, 0x02, 
-    0x82, 0xa2, 0xb8, 0x56, 0xcc, 0x29, 0xc6, 0xc4, 0x22, 0x50, 0x25, 0xdc, 0x2d, 
-    0xe7, 0x90, 0x27, 0x86, 0xbd, 0x92, 0x5b, 0x6a, 0xfd, 0xa9, 0x37, 0x50, 0x25, 
-    0xb8, 0x28, 0x93, 0xcb, 0x34, 0xb8, 0xd0, 0xc2, 0xcb, 0x33, 0xb4, 0xb0, 0xc2, 
-    0xcb, 0x2c, 0x96, 0x38, 0xd4, 0x4a, 0x56, 0xa8, 0xe8, 0xf2, 0x0a, 0x2a, 0xbd, 
-    0x60, 0x45, 0x98, 0x2c, 0xfd, 0xa9, 0x66, 0x80, 0x41, 0x71, 0xf0, 0x14, 0x8c, 
-    0x2b, 0xcf, 0x04, 0xc3, 0x4a, 0x2c, 0xef, 0x4d, 0xd4, 0xcb, 0x2b, 0x9e, 0xa8, 
-    0xb8, 0x4c, 0x2d, 0xa8, 0x7c, 0x82, 0x4a, 0x2b, 0x2a, 0xb6, 0xd2, 0x22, 0x00, 
-    0x05, 0x18, 0xc4, 0x89, 0x52, 0xa7, 0x68, 0xa2, 0xa1, 0x82, 0x0d, 0x35, 0xd2, 
-    0x4a, 0x2d, 0x58, 0x99, 0x56, 0x4b, 0x2d, 0xdc, 0x00, 0x33, 0x58, 0x73, 0xdc, 
-    0xa0, 0x72, 0x24, 0x00, 0x06, 0x69, 0xa2, 0x94, 0x6d, 0x1a, 0x75, 0x71, 0x95, 
-    0x2e, 0xdc, 0xb4, 0x42, 0xc1, 0x32, 0x5f, 0x88, 0x50, 0x25, 0x9a, 0x6f, 0x19, 
-    0x79, 0xe4, 0x74, 0x04, 0xf5, 0x35, 0x0d, 0x29, 0x50, 0x32, 0x34, 0xc9, 0x31, 
-    0x3f, 0x62, 0x75, 0x49, 0x04, 0xcb, 0x5c, 0x02, 0xc0, 0x60, 0x69, 0x02, 0x83, 
-    0x15, 0x8b, 0x47, 0xfe, 0x37, 0x10, 0x59, 0xb1, 0xe0, 0xf2, 0x4b, 0x2e, 0x7f, 
-    0xcc, 0xe2, 0x8b, 0x44, 0x0b, 0x01, 0x02, 0x27, 0x30, 0xb5, 0xa0, 0x09, 0x0c, 
-    0x2a, 0x59, 0xf5, 0x18, 0x27, 0x95, 0xdc, 0xf4, 0xf2, 0xa5, 0x6f, 0xdd, 0x94, 
-    0xe5, 0x9a, 0x25, 0xb9, 0x14, 0x63, 0xdf, 0x2c, 0xd3, 0x7c, 0x84, 0xd0, 0x14, 
-    0xb2, 0x10, 0xff, 0xc6, 0xa5, 0x65, 0x7c, 0x56, 0xb6, 0x8c, 0x01, 0x47, 0x4a, 
-    0x18, 0x8b, 0x26, 0xc5, 0x58, 0x32, 0x69, 0x30, 0x7d, 0x08, 0xc4, 0x93, 0x81, 
-    0x06, 0x35, 0x52, 0x59, 0x7e, 0xa7, 0xc1, 0x70, 0x24, 0x01, 0x04, 0xd1, 0xb2, 
-    0x8a, 0x28, 0xc8, 0x3c, 0x42, 0x66, 0x37, 0xa7, 0x20, 0xa3, 0x4c, 0x4e, 0x04, 
-    0x4d, 0x82, 0x6c, 0x79, 0x75, 0x1c, 0xf9, 0x22, 0x4a, 0xac, 0x88, 0x82, 0xcb, 
-    0x42, 0x77, 0xa8, 0xb8, 0xed, 0x69, 0xaf, 0xcc, 0x49, 0x12, 0x96, 0xe7, 0xe6, 
-    0xb6, 0x0c, 0x05, 0x11, 0x92, 0xf4, 0x44, 0xbb, 0x96, 0x01, 0x23, 0x0b, 0x9a, 
-    0xbb, 0xa1, 0xa7, 0xe8, 0x46, 0x98, 0x10, 0xf6, 0x09, 0x12, 0x27, 0x9c, 0x80, 
-    0x84, 0x69, 0xb9, 0xf5, 0x82, 0x84, 0x07, 0x25, 0x8c, 0xc0, 0xc8, 0x31, 0xe7, 
-    0xf1, 0x16, 0x80, 0x04, 0x24, 0xe1, 0x06, 0xd7, 0x17, 0xe8, 0x05, 0x92, 0x1b, 
-    0x30, 0x2f, 0x24, 0xbc, 0x03, 0x23, 0xa6, 0xed, 0x20, 0xc0, 0x6a, 0x10, 0x47, 
-    0x1c, 0x17, 0xbc, 0xd1, 0x31, 0x78, 0x1a, 0x20, 0x1e, 0x30, 0x01, 0x67, 0x56, 
-    0x34, 0x3c, 0x60, 0x40, 0x02, 0x0e, 0x08, 0x35, 0x22, 0x5c, 0xad, 0x04, 0x51, 
-    0x03, 0x12, 0x8c, 0xb0, 0x6b, 0xd9, 0x2b, 0xdd, 0xf4, 0x1b, 0xd7, 0x32, 0x42, 
-    0x15, 0xf4, 0x09, 0xbd, 0x59, 0x3d, 0x31, 0x48, 0x2f, 0xb3, 0xbe, 0xf5, 0x43, 
-    0xd0, 0x03, 0xdd, 0x41, 0xf4, 0x27, 0x3c, 0x2c, 0xfd, 0x43, 0xac, 0x6f, 0x09, 
-    0xc3, 0xc6, 0x11, 0x4c, 0x0b, 0xa4, 0x33, 0xb2, 0xb5, 0x14, 0xe4, 0xf4, 0x2e, 
-    0x85, 0x34, 0x71, 0xc4, 0x10, 0x59, 0x77, 0x23, 0x87, 0xb9, 0xe5, 0x01, 0x33, 
-    0x45, 0x41, 0x44, 0xb0, 0x21, 0x36, 0x11, 0xa5, 0x30, 0x52, 0x76, 0x37, 0x83, 
-    0x1c, 0x9b, 0xdb, 0x2b, 0x6b, 0x17, 0x74, 0x44, 0x11, 0x54, 0xc0, 0x4e, 0xe2, 
-    0x4c, 0x96, 0x4b, 0x97, 0xfd, 0x84, 0x2a, 0x49, 0xc3, 0xd5, 0x8b, 0x2a, 0x5d, 
-    0x20, 0x94, 0xc3, 0x2e, 0xfe, 0xce, 0x2d, 0x10, 0x0d, 0x5d, 0x4c, 0xf2, 0xc9, 
-    0x27, 0x9e, 0x00, 0x12, 0x78, 0x42, 0x3e, 0xc7, 0xd5, 0x8b, 0x05, 0x8e, 0x6f, 
-    0x44, 0x70, 0x5c, 0xaf, 0x28, 0xd0, 0x79, 0x45, 0x43, 0xbf, 0x35, 0xab, 0x91, 
-    0x13, 0x8c, 0xee, 0xd0, 0xd9, 0x70, 0x51, 0xcd, 0x4d, 0x6a, 0x07, 0xa8, 0xce, 
-    0x90, 0x10, 0x9f, 0x73, 0xe3, 0xa0, 0xe9, 0x1f, 0x87, 0x3c, 0x52, 0x40, 0x00, 
-    0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x99, 0x00, 0x2c, 0x04, 0x00, 0x0a, 0x00, 
-    0x39, 0x00, 0x2c, 0x00, 0x87, 0x0e, 0x0e, 0x0e, 0x14, 0x14, 0x14, 0x1b, 0x1b, 
-    0x1b, 0x23, 0x23, 0x23, 0x27, 0x27, 0x28, 0x2a, 0x2a, 0x2b, 0x37, 0x37, 0x38, 
-    0x38, 0x36, 0x44, 0x43, 0x41, 0x4e, 0x44, 0x44, 0x44, 0x46, 0x44, 0x52, 0x48, 
-    0x26, 0x21, 0x4b, 0x4b, 0x4b, 0x4c, 0x4a, 0x57, 0x52, 0x52, 0x52, 0x56, 0x4f, 
-    0x5a, 0x57, 0x57, 0x6d, 0x58, 0x58, 0x6f, 0x5a, 0x36, 0x40, 0x5a, 0x3d, 0x3a, 
-    0x5b, 0x5a, 0x65, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x60, 0x5e, 0x6b, 0x61, 
-    0x5e, 0x71, 0x61, 0x61, 0x76, 0x64, 0x64, 0x65, 0x65, 0x65, 0x79, 0x68, 0x66, 
-    0x72, 0x6a, 0x6a, 0x76, 0x6a, 0x6a, 0x7e, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d, 0x81, 
-    0x70, 0x6f, 0x79, 0x71, 0x28, 0x29, 0x73, 0x73, 0x85, 0x74, 0x33, 0x32, 0x74, 
-    0x73, 0x74, 0x76, 0x3d, 0x3d, 0x77, 0x2f, 0x30, 0x7b, 0x44, 0x45, 0x7b, 0x66, 
-    0x66, 0x7b, 0x7b, 0x8d, 0x7c, 0x5e, 0x64, 0x7d, 0x7d, 0x7e, 0x7f, 0x4a, 0x4a, 
-    0x7f, 0x7f, 0x90, 0x81, 0x4e, 0x4e, 0x82, 0x82, 0x8a, 0x83, 0x83, 0x94, 0x86, 
-    0x57, 0x57, 0x87, 0x66, 0x1e, 0x88, 0x88, 0x97, 0x89, 0x72, 0x71, 0x8b, 0x8b, 
-    0x9b, 0x8c, 0x69, 0x14, 0x8d, 0x6c, 0x1d, 0x90, 0x6f, 0x1e, 0x90, 0x90, 0x9e, 
-    0x92, 0x92, 0x92, 0x93, 0x6a, 0x6a, 0x93, 0x93, 0xa2, 0x95, 0x73, 0x15, 0x96, 
-    0x75, 0x23, 0x96, 0x76, 0x2a, 0x97, 0x78, 0x2a, 0x98, 0x77, 0x15, 0x98, 0x77, 
-    0x1c, 0x98, 0x77, 0x22, 0x98, 0x79, 0x7c, 0x98, 0x98, 0x98, 0x99, 0x99, 0xa6, 
-    0x9a, 0x7a, 0x23, 0x9b, 0x7a, 0x1c, 0x9b, 0x7c, 0x2c, 0x9c, 0x7b, 0x15, 0x9c, 
-    0x7d, 0x33, 0x9c, 0x7f, 0x39, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x35, 0x9e, 0x81, 
-    0x3a, 0x9f, 0x81, 0x2c, 0xa0, 0x7c, 0x7b, 0xa0, 0x7f, 0x14, 0xa1, 0x83, 0x2d, 
-    0xa1, 0x84, 0x33, 0xa1, 0x84, 0x3c, 0xa1, 0x86, 0x4f, 0xa1, 0xa1, 0xad, 0xa2, 
-    0x82, 0x16, 0xa2, 0x84, 0x24, 0xa2, 0x86, 0x42, 0xa3, 0x83, 0x1c, 0xa5, 0x89, 
-    0x45, 0xa8, 0x8d, 0x4f, 0xa8, 0x8e, 0x51, 0xa9, 0x8d, 0x3c, 0xaa, 0x91, 0x54, 
-    0xab, 0xab, 0xb5, 0xac, 0x8c, 0x8c, 0xad, 0x95, 0x5b, 0xae, 0x91, 0x2b, 0xaf, 
-    0x98, 0x61, 0xb1, 0x94, 0x30, 0xb1, 0x98, 0x4b, 0xb4, 0x96, 0x22, 0xb4, 0x99, 
-    0x9a, 0xb4, 0x9e, 0x6a, 0xb6, 0xa1, 0x6d, 0xb7, 0x9f, 0x56, 0xb8, 0xa3, 0x6f, 
-    0xb9, 0xa5, 0x74, 0xba, 0x9f, 0x35, 0xba, 0xa2, 0x58, 0xbc, 0xa8, 0x78, 0xbd, 
-    0xa7, 0x6a, 0xbe, 0xa5, 0x49, 0xbe, 0xab, 0x7d, 0xbf, 0xa9, 0x63, 0xc0, 0xad, 
-    0x7f, 0xc1, 0xae, 0x81, 0xc2, 0xa8, 0x36, 0xc3, 0xb0, 0x7e, 0xc3, 0xb1, 0x86, 
-    0xc5, 0xb5, 0x8b, 0xc7, 0xb7, 0x90, 0xc8, 0xb8, 0x91, 0xd1, 0xc1, 0x8f, 0xd4, 
-    0xc8, 0xa9, 0xd6, 0xbf, 0x3f, 0xd7, 0xc4, 0x67, 0xde, 0xce, 0x72, 0xe0, 0xcb, 
-    0x47, 0xe0, 0xcd, 0x56, 0xe3, 0xcd, 0x3e, 0xe8, 0xd2, 0x36, 0xf5, 0xe4, 0x57, 
-    0xf5, 0xe6, 0x69, 0xf7, 0xef, 0xaa, 0xfe, 0xf3, 0x8a, 0xfe, 0xf4, 0x93, 0xfe, 
-    0xf6, 0xaf, 0xff, 0xec, 0x3d, 0xff, 0xed, 0x44, 0xff, 0xee, 0x53, 0xff, 0xef, 
-    0x5b, 0xff, 0xef, 0x62, 0xff, 0xf0, 0x65, 0xff, 0xf0, 0x6b, 0xff, 0xf1, 0x74, 
-    0xff, 0xf2, 0x7b, 0xff, 0xf3, 0x84, 0xff, 0xf5, 0x98, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe7, 0x00, 0x33, 0x09, 0x1c, 0x48, 
-    0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x81, 
-    0x76, 0x1e, 0x4a, 0x9c, 0x78, 0x90, 0x10, 0xc5, 0x8b, 0x18, 0x05, 0x42, 0x82, 
-    0x94, 0x31, 0x63, 0x1e, 0x83, 0x70, 0x04, 0x06, 0x7a, 0xd4, 0xb1, 0x24, 0xc1, 
-    0x90, 0x1f, 0x4d, 0xaa, 0x64, 0x98, 0x72, 0x65, 0xc3, 0x43, 0x12, 0xcf, 0xb8, 
-    0x1c, 0x78, 0x84, 0x22, 0x4c, 0x83, 0x81, 0x66, 0x0a, 0x2c, 0xa0, 0x73, 0x26, 
-    0x80, 0x83, 0x69, 0x32, 0x19, 0xea, 0x49, 0xf4, 0xa0, 0xa3, 0xa2, 0x04, 0x7f, 
-    0x16, 0x6c, 0x19, 0xf4, 0x60, 0x1e, 0x92, 0x48, 0x77, 0x52, 0x0c, 0x19, 0x15, 
-    0x21, 0x18, 0x82, 0x43, 0x09, 0x5e, 0x95, 0x59, 0x55, 0xe0, 0x00, 0x82, 0x2d, 
-    0x0b, 0x52, 0xed, 0xaa, 0x70, 0xec, 0xc0, 0xac, 0x64, 0x25, 0xe6, 0x14, 0x99, 
-    0x76, 0x60, 0x80, 0x97, 0x6d, 0xa3, 0xd6, 0x24, 0xe8, 0x00, 0x23, 0x81, 0xb8, 
-    0x12, 0xbf, 0x0e, 0x3c, 0x13, 0x68, 0x6d, 0xa6, 0xab, 0x37, 0x17, 0x8a, 0xd1, 
-    0xa9, 0x54, 0xe0, 0x4d, 0x3a, 0x38, 0xf1, 0x12, 0x0c, 0x84, 0x18, 0xef, 0x87, 
-    0x87, 0x1f, 0xcd, 0x2a, 0x46, 0x88, 0x72, 0x32, 0x41, 0x9e, 0x96, 0x07, 0x32, 
-    0xc8, 0x4c, 0xf1, 0x2e, 0xe7, 0xcf, 0x09, 0x59, 0x0c, 0x14, 0x0d, 0x7a, 0xc2, 
-    0x41, 0x03, 0x99, 0xf4, 0x82, 0x5e, 0x2d, 0xb0, 0x07, 0xeb, 0x87, 0x45, 0x5e, 
-    0xcb, 0x2e, 0x28, 0x43, 0x0a, 0xc1, 0xc1, 0xb3, 0x8b, 0xea, 0x58, 0x38, 0xd7, 
-    0x60, 0x8a, 0xb4, 0xbd, 0x33, 0xe1, 0xa6, 0xd8, 0x20, 0xb7, 0xf1, 0xe3, 0xc8, 
-    0x0f, 0x22, 0xe8, 0x18, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xe1, 
-    0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x33, 0x00, 0x32, 0x00, 0x87, 0x00, 0x00, 
-    0x00, 0x0a, 0x09, 0x03, 0x0b, 0x0b, 0x0b, 0x13, 0x12, 0x0c, 0x13, 0x13, 0x13, 
-    0x17, 0x16, 0x1a, 0x1b, 0x1b, 0x1b, 0x1e, 0x1e, 0x25, 0x21, 0x1d, 0x0a, 0x23, 
-    0x23, 0x23, 0x24, 0x22, 0x2b, 0x2c, 0x2c, 0x2c, 0x30, 0x2e, 0x35, 0x32, 0x2d, 
-    0x0a, 0x33, 0x33, 0x34, 0x34, 0x33, 0x3c, 0x3b, 0x3a, 0x43, 0x3c, 0x3c, 0x3c, 
-    0x43, 0x43, 0x43, 0x47, 0x27, 0x24, 0x47, 0x3f, 0x50, 0x47, 0x47, 0x48, 0x49, 
-    0x44, 0x37, 0x4b, 0x2c, 0x1b, 0x4c, 0x47, 0x58, 0x4c, 0x4c, 0x4c, 0x4d, 0x3e, 
-    0x4c, 0x4e, 0x4c, 0x63, 0x51, 0x3a, 0x43, 0x53, 0x52, 0x5f, 0x54, 0x54, 0x54, 
-    0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x56, 0x56, 0x6d, 0x57, 0x4e, 0x11, 0x57, 
-    0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 
-    0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 0x60, 0x5e, 0x6b, 0x61, 0x34, 0x3a, 
-    0x61, 0x61, 0x76, 0x63, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x69, 0x3f, 0x44, 0x69, 
-    0x6a, 0x7d, 0x6b, 0x6b, 0x74, 0x6c, 0x6b, 0x6c, 0x6d, 0x27, 0x27, 0x6e, 0x6e, 
-    0x81, 0x6f, 0x70, 0x83, 0x70, 0x6e, 0x7b, 0x72, 0x4b, 0x4c, 0x72, 0x57, 0x0d, 
-    0x72, 0x72, 0x85, 0x73, 0x73, 0x73, 0x74, 0x69, 0x16, 0x76, 0x38, 0x38, 0x76, 
-    0x76, 0x89, 0x77, 0x28, 0x29, 0x78, 0x77, 0x8a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 
-    0x8d, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x82, 0x4e, 0x4e, 0x83, 0x5d, 0x05, 
-    0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x86, 0x85, 0x8c, 0x87, 
-    0x57, 0x57, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8a, 0x65, 0x09, 0x8a, 0x75, 
-    0x19, 0x8b, 0x2f, 0x30, 0x8b, 0x8c, 0x9b, 0x8c, 0x6a, 0x16, 0x8c, 0x8c, 0x8c, 
-    0x8e, 0x30, 0x31, 0x8f, 0x6f, 0x2d, 0x91, 0x6e, 0x0b, 0x91, 0x91, 0x9e, 0x93, 
-    0x32, 0x32, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x73, 0x0c, 0x95, 0x75, 
-    0x24, 0x96, 0x6d, 0x6d, 0x96, 0x75, 0x18, 0x96, 0x76, 0x29, 0x97, 0x86, 0x8b, 
-    0x98, 0x7a, 0x35, 0x98, 0x84, 0x1e, 0x99, 0x76, 0x0d, 0x9a, 0x9a, 0xa6, 0x9b, 
-    0x35, 0x35, 0x9b, 0x7b, 0x24, 0x9b, 0x7c, 0x2b, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 
-    0x1c, 0x9c, 0x7d, 0x33, 0x9d, 0x7b, 0x0e, 0x9d, 0x7c, 0x14, 0x9d, 0x9d, 0xaa, 
-    0x9e, 0x81, 0x35, 0x9f, 0x80, 0x29, 0x9f, 0x82, 0x3b, 0xa0, 0x37, 0x37, 0xa0, 
-    0x7f, 0x0f, 0xa0, 0x7f, 0x15, 0xa1, 0x84, 0x3d, 0xa2, 0x7f, 0x7f, 0xa2, 0x85, 
-    0x38, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa3, 0xa3, 0xa3, 0xa4, 0x83, 0x13, 
-    0xa4, 0x84, 0x19, 0xa4, 0x85, 0x25, 0xa4, 0x89, 0x45, 0xa4, 0x95, 0x6f, 0xa6, 
-    0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x89, 0x19, 0xa8, 0x8e, 0x4d, 0xa8, 0x8e, 
-    0x52, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1a, 0xab, 0x92, 0x55, 
-    0xac, 0xab, 0xac, 0xae, 0x95, 0x5c, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 
-    0x90, 0x90, 0xb1, 0x98, 0x24, 0xb1, 0x98, 0x4c, 0xb2, 0x94, 0x16, 0xb2, 0x9a, 
-    0x5b, 0xb2, 0x9b, 0x64, 0xb3, 0x94, 0x19, 0xb3, 0xb3, 0xbd, 0xb4, 0x9e, 0x69, 
-    0xb4, 0xb4, 0xb4, 0xb6, 0x99, 0x19, 0xb7, 0xa1, 0x6c, 0xb8, 0x9a, 0x17, 0xb8, 
-    0xb8, 0xc2, 0xba, 0x9c, 0x19, 0xba, 0xa3, 0xa4, 0xba, 0xa5, 0x74, 0xbb, 0xbb, 
-    0xbc, 0xbb, 0xbb, 0xc4, 0xbc, 0xa5, 0x53, 0xbc, 0xa8, 0x79, 0xbc, 0xa9, 0x28, 
-    0xbe, 0xa1, 0x1b, 0xc2, 0xa5, 0x1c, 0xc3, 0xb1, 0x87, 0xc3, 0xc3, 0xc4, 0xc4, 
-    0xc4, 0xcb, 0xc6, 0xaa, 0x1d, 0xc6, 0xac, 0x2e, 0xc7, 0xb3, 0x6c, 0xc7, 0xb6, 
-    0x8e, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0x29, 0xc9, 0xb6, 0xb7, 0xcb, 0xcb, 0xcc, 
-    0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 0x21, 0xcf, 0xba, 0x54, 0xd1, 
-    0xb6, 0x22, 0xd3, 0xd3, 0xd4, 0xd4, 0xc7, 0xa6, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 
-    0xda, 0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 0xdb, 0xc6, 0x2a, 0xdb, 0xdb, 0xde, 
-    0xdc, 0xc4, 0x26, 0xde, 0xde, 0xe2, 0xe1, 0xc9, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 
-    0xe3, 0xe4, 0xe4, 0xcc, 0x29, 0xe6, 0xe6, 0xe9, 0xe7, 0xd0, 0x2b, 0xe7, 0xd4, 
-    0x58, 0xe9, 0xd5, 0x33, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 
-    0xef, 0xd9, 0x2e, 0xef, 0xef, 0xf1, 0xf1, 0xdc, 0x2e, 0xf2, 0xed, 0xed, 0xf4, 
-    0xde, 0x30, 0xf4, 0xf4, 0xf5, 0xf5, 0xe0, 0x2f, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 
-    0xf7, 0xf8, 0xe4, 0x48, 0xf8, 0xe5, 0x3b, 0xfa, 0xe5, 0x32, 0xfb, 0xeb, 0x6a, 
-    0xfe, 0xed, 0x5a, 0xfe, 0xf3, 0x90, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 
-    0xed, 0x42, 0xff, 0xed, 0x4b, 0xff, 0xee, 0x53, 0xff, 0xf0, 0x5d, 0xff, 0xf0, 
-    0x69, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x86, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xff, 0x00, 0xc3, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 
-    0x5c, 0xc8, 0xb0, 0xe1, 0xc0, 0x5c, 0x0e, 0x23, 0x4a, 0x14, 0x08, 0xac, 0x5a, 
-    0x38, 0x59, 0x13, 0x33, 0x32, 0x0c, 0x35, 0x6d, 0x5b, 0xa6, 0x70, 0xd9, 0xa6, 
-    0xd5, 0xd2, 0x48, 0x92, 0x60, 0xa5, 0x6b, 0xd7, 0x70, 0x61, 0xbb, 0x86, 0xb1, 
-    0xa4, 0xcb, 0x5e, 0x28, 0xa5, 0x5d, 0xeb, 0xe5, 0x32, 0xa2, 0x2c, 0x64, 0xd2, 
-    0x90, 0x01, 0xdb, 0x75, 0x4a, 0x18, 0x4a, 0x94, 0xd3, 0x1a, 0xd5, 0x6c, 0x08, 
-    0xeb, 0xe7, 0xb5, 0x67, 0xc2, 0x6a, 0x4d, 0x73, 0x26, 0xf3, 0x9a, 0x33, 0x64, 
-    0xd3, 0xa4, 0x11, 0x3b, 0x35, 0xf4, 0x60, 0x23, 0x67, 0x46, 0x85, 0x21, 0x0b, 
-    0x53, 0x08, 0x98, 0xcf, 0x9f, 0xd8, 0xb6, 0x55, 0x45, 0xe8, 0xca, 0x28, 0x50, 
-    0x96, 0xc8, 0xbe, 0x5e, 0x43, 0x36, 0x72, 0xac, 0xd5, 0xa6, 0x66, 0xa7, 0x01, 
-    0x33, 0xaa, 0xec, 0x1a, 0x30, 0xb7, 0x07, 0x4f, 0x01, 0x33, 0xa6, 0x6c, 0x1a, 
-    0x50, 0x62, 0x75, 0x7f, 0x1a, 0x23, 0xa6, 0xad, 0x65, 0xc9, 0x1e, 0x41, 0x1a, 
-    0x9e, 0xaa, 0x05, 0x6c, 0x1a, 0x2e, 0x94, 0x50, 0xaf, 0xad, 0x0a, 0x17, 0x4b, 
-    0xe3, 0x11, 0x52, 0xb6, 0x8e, 0x41, 0x83, 0x96, 0x4c, 0x57, 0xa9, 0x23, 0x0b, 
-    0x61, 0x12, 0x43, 0xf6, 0x6c, 0x2a, 0x31, 0x92, 0x43, 0x4a, 0x35, 0x03, 0xc7, 
-    0xba, 0x35, 0x6b, 0x68, 0xaf, 0xac, 0x24, 0x6c, 0x34, 0x8d, 0x6a, 0x2c, 0xaa, 
-    0x24, 0xef, 0x04, 0x73, 0xcd, 0xbb, 0xf5, 0xac, 0x05, 0x09, 0xa7, 0x7d, 0x74, 
-    0x39, 0x68, 0x75, 0xef, 0xde, 0x32, 0x00, 0x08, 0xc8, 0x60, 0x50, 0x54, 0x4a, 
-    0x97, 0x59, 0x92, 0x1d, 0xef, 0xfd, 0x0b, 0x80, 0xf5, 0x02, 0xcc, 0x09, 0xe6, 
-    0xba, 0x66, 0xcc, 0xe5, 0xac, 0xe9, 0xbd, 0x39, 0x59, 0xff, 0xb7, 0x4e, 0x40, 
-    0xe0, 0xa9, 0x5e, 0xbd, 0xe6, 0x5e, 0x83, 0x68, 0xd9, 0x38, 0xf8, 0xd6, 0x58, 
-    0xc6, 0x5b, 0x57, 0x10, 0x0e, 0x54, 0x2d, 0x66, 0xc6, 0x9e, 0x1d, 0x65, 0xa4, 
-    0xf1, 0xcf, 0x7b, 0xde, 0xc9, 0xc9, 0x07, 0x00, 0x20, 0x49, 0x31, 0x83, 0x8b, 
-    0x30, 0xce, 0x28, 0x43, 0x4c, 0x26, 0xfc, 0x49, 0xd4, 0xc9, 0x7f, 0xae, 0x49, 
-    0x20, 0x20, 0x00, 0x04, 0x78, 0xa2, 0x0c, 0x46, 0xb5, 0xd4, 0xe2, 0x8c, 0x29, 
-    0xc8, 0xe0, 0x82, 0x8b, 0x44, 0xad, 0xb4, 0x76, 0x0c, 0x2f, 0xe0, 0x41, 0x93, 
-    0xc0, 0x84, 0x00, 0x30, 0x42, 0x95, 0x2c, 0xbb, 0xc0, 0x52, 0x8b, 0x30, 0x7b, 
-    0xa8, 0xa2, 0xcc, 0x5d, 0x0e, 0xd9, 0xc2, 0xda, 0x2c, 0xbf, 0x94, 0xa2, 0x0b, 
-    0x34, 0xc7, 0x41, 0x23, 0x00, 0x8a, 0x06, 0x5c, 0x54, 0x0b, 0x2e, 0xae, 0x00, 
-    0x03, 0xcc, 0x48, 0x73, 0x7d, 0xd8, 0x50, 0x32, 0xbc, 0x70, 0x22, 0x1d, 0x38, 
-    0xc1, 0xb4, 0x42, 0x4a, 0x29, 0xad, 0xd8, 0xc8, 0x5a, 0x33, 0x3f, 0xa2, 0x88, 
-    0xc3, 0x54, 0xc0, 0xc0, 0xb2, 0xe0, 0x48, 0xb5, 0x5c, 0xc3, 0x4c, 0x43, 0x98, 
-    0xcc, 0x62, 0x0b, 0x8f, 0xab, 0xfd, 0x72, 0x0c, 0x38, 0xc7, 0x24, 0xc3, 0xd9, 
-    0x6b, 0x04, 0xa0, 0x08, 0x40, 0x03, 0xa2, 0x9c, 0x92, 0x4b, 0x28, 0xc6, 0x28, 
-    0xa2, 0x24, 0x2e, 0xc0, 0x34, 0x98, 0x50, 0x74, 0xd0, 0xfc, 0x02, 0x4e, 0x2b, 
-    0x32, 0x80, 0x93, 0x84, 0x0e, 0xac, 0xa9, 0xe9, 0xda, 0x02, 0x72, 0x16, 0x40, 
-    0x50, 0x28, 0x13, 0x49, 0x22, 0x1d, 0x89, 0xe0, 0x50, 0x92, 0x01, 0x38, 0x87, 
-    0x10, 0xf0, 0xe4, 0x2b, 0x6b, 0xb2, 0x76, 0x42, 0xa3, 0xb9, 0xe9, 0xc2, 0x5a, 
-    0x30, 0xbc, 0xac, 0xc9, 0x4b, 0x29, 0xe0, 0x34, 0xc3, 0x09, 0x8f, 0xe0, 0xcc, 
-    0x22, 0x2a, 0x6b, 0x46, 0xc8, 0xff, 0x09, 0x40, 0x46, 0x56, 0x7c, 0xe7, 0x9a, 
-    0x66, 0xd3, 0xb9, 0xe9, 0xde, 0x21, 0xb2, 0x4e, 0x34, 0xc8, 0x93, 0x10, 0x4e, 
-    0xf7, 0x4a, 0xaf, 0x11, 0x49, 0xc2, 0x6a, 0xb0, 0xb9, 0x16, 0x80, 0xa2, 0x00, 
-    0x11, 0xdd, 0x71, 0x2c, 0xb2, 0xd3, 0xc5, 0x3a, 0x61, 0x90, 0x0e, 0xbd, 0x0a, 
-    0x2d, 0x78, 0xad, 0xa0, 0x98, 0x80, 0x43, 0x59, 0x5c, 0xdb, 0x63, 0x30, 0xd2, 
-    0x41, 0xf3, 0xa9, 0x80, 0x11, 0x38, 0xf4, 0xa0, 0x6b, 0xb3, 0x9c, 0x61, 0x04, 
-    0x10, 0x67, 0x00, 0x7b, 0x5c, 0x32, 0x78, 0xa0, 0x40, 0xc2, 0x07, 0xa4, 0x80, 
-    0x83, 0x87, 0x80, 0xd4, 0x36, 0xf4, 0x8a, 0x6b, 0xbc, 0xca, 0x47, 0x09, 0x78, 
-    0xcd, 0xc8, 0x60, 0xc2, 0x07, 0x46, 0x38, 0x09, 0x4e, 0x16, 0xca, 0x5a, 0x97, 
-    0xaf, 0xbe, 0x11, 0x0a, 0xc8, 0x09, 0x78, 0x89, 0x90, 0x80, 0xc5, 0x6e, 0xaf, 
-    0xc1, 0x10, 0xce, 0x02, 0x0e, 0xd0, 0x27, 0xd1, 0xbe, 0xad, 0x91, 0x72, 0x42, 
-    0x05, 0x3a, 0xe0, 0x61, 0xeb, 0x71, 0xba, 0x84, 0x73, 0x6e, 0x6b, 0xcd, 0xb8, 
-    0xc4, 0xf1, 0xb5, 0xd0, 0x8c, 0x91, 0xc8, 0x31, 0xee, 0x81, 0x03, 0x4d, 0x62, 
-    0x24, 0x0d, 0xe2, 0x2d, 0x38, 0xa5, 0xf4, 0x00, 0xda, 0x11, 0xd6, 0x1e, 0xc3, 
-    0x05, 0x11, 0x25, 0x51, 0x8c, 0xec, 0x2f, 0x05, 0xd9, 0xec, 0xcb, 0x22, 0x53, 
-    0x3c, 0x81, 0x44, 0x49, 0x83, 0x3c, 0xfb, 0x5e, 0x32, 0x63, 0x14, 0xa4, 0x04, 
-    0x1d, 0x49, 0x2b, 0xc1, 0xca, 0x21, 0x2e, 0x19, 0x0b, 0xa1, 0x2d, 0x51, 0x17, 
-    0xf4, 0x04, 0x13, 0x5c, 0xdc, 0xc2, 0xe3, 0x31, 0x35, 0xb1, 0x71, 0xe6, 0xbb, 
-    0xb3, 0xfc, 0x81, 0x90, 0x12, 0xbe, 0xf0, 0x46, 0xca, 0x50, 0x42, 0x24, 0x42, 
-    0xe5, 0x2b, 0xa5, 0x74, 0x92, 0x45, 0x0f, 0x0a, 0x9d, 0xdc, 0x5a, 0x30, 0x18, 
-    0xe0, 0x2a, 0xe5, 0x50, 0xa7, 0xae, 0xd9, 0xa2, 0xb1, 0xdf, 0x0a, 0xa1, 0xca, 
-    0x1a, 0xb0, 0xb3, 0x00, 0x40, 0x01, 0xe1, 0x09, 0x39, 0xdb, 0x9a, 0xb5, 0xbc, 
-    0x00, 0x30, 0x38, 0xe3, 0x04, 0x1d, 0x01, 0x38, 0x38, 0x56, 0x82, 0x93, 0xcc, 
-    0x8f, 0x15, 0x48, 0x14, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xde, 
-    0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x33, 0x00, 0x32, 0x00, 0x87, 0x00, 0x00, 
-    0x00, 0x0a, 0x09, 0x03, 0x0b, 0x0b, 0x0b, 0x13, 0x12, 0x0c, 0x13, 0x13, 0x14, 
-    0x17, 0x16, 0x1a, 0x1b, 0x1b, 0x1c, 0x1f, 0x1d, 0x1f, 0x23, 0x23, 0x23, 0x24, 
-    0x22, 0x2b, 0x2c, 0x2c, 0x2c, 0x2f, 0x2d, 0x38, 0x32, 0x2d, 0x0a, 0x33, 0x33, 
-    0x34, 0x34, 0x33, 0x3c, 0x3b, 0x3a, 0x43, 0x3c, 0x3c, 0x3c, 0x43, 0x43, 0x43, 
-    0x47, 0x27, 0x24, 0x47, 0x3f, 0x50, 0x47, 0x47, 0x48, 0x4b, 0x2c, 0x18, 0x4c, 
-    0x47, 0x58, 0x4c, 0x4c, 0x4c, 0x4d, 0x3e, 0x4c, 0x4e, 0x4c, 0x63, 0x51, 0x3a, 
-    0x43, 0x53, 0x52, 0x5f, 0x54, 0x54, 0x54, 0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 
-    0x56, 0x56, 0x6d, 0x58, 0x2d, 0x2a, 0x58, 0x4f, 0x11, 0x59, 0x59, 0x65, 0x59, 
-    0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 
-    0x72, 0x60, 0x5e, 0x6b, 0x61, 0x61, 0x76, 0x62, 0x62, 0x63, 0x64, 0x64, 0x6b, 
-    0x65, 0x65, 0x7a, 0x69, 0x3f, 0x44, 0x69, 0x6a, 0x7d, 0x6b, 0x6b, 0x74, 0x6c, 
-    0x6b, 0x6c, 0x6d, 0x27, 0x27, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 0x70, 0x6e, 
-    0x7b, 0x72, 0x4b, 0x4c, 0x72, 0x72, 0x85, 0x73, 0x73, 0x73, 0x74, 0x6a, 0x17, 
-    0x75, 0x58, 0x0d, 0x76, 0x38, 0x38, 0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x7a, 
-    0x79, 0x86, 0x7b, 0x69, 0x3b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8d, 0x7f, 0x7f, 
-    0x90, 0x7f, 0x80, 0x91, 0x82, 0x4e, 0x4e, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 
-    0x84, 0x2b, 0x2c, 0x86, 0x7a, 0x1b, 0x86, 0x85, 0x8c, 0x87, 0x57, 0x57, 0x89, 
-    0x65, 0x07, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x6f, 
-    0x2d, 0x8b, 0x8c, 0x9b, 0x8c, 0x6a, 0x16, 0x8c, 0x8c, 0x8c, 0x8d, 0x69, 0x0b, 
-    0x8e, 0x30, 0x31, 0x91, 0x91, 0x9e, 0x92, 0x6f, 0x0b, 0x93, 0x32, 0x32, 0x94, 
-    0x86, 0x1e, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x72, 0x0c, 0x96, 0x6d, 
-    0x6d, 0x96, 0x74, 0x18, 0x96, 0x76, 0x26, 0x97, 0x86, 0x8b, 0x98, 0x76, 0x0c, 
-    0x99, 0x7b, 0x35, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x24, 0x9b, 
-    0x7c, 0x2c, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 0x1c, 0x9c, 0x7d, 0x32, 0x9d, 0x7b, 
-    0x0e, 0x9d, 0x7c, 0x14, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x34, 0x9f, 0x80, 0x29, 
-    0x9f, 0x82, 0x3b, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x14, 0xa1, 0x84, 0x3e, 0xa2, 
-    0x7f, 0x7f, 0xa2, 0x85, 0x38, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa3, 0x84, 
-    0x1a, 0xa3, 0xa3, 0xa3, 0xa4, 0x84, 0x14, 0xa4, 0x85, 0x24, 0xa4, 0x89, 0x46, 
-    0xa5, 0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x1a, 0xa8, 0x8e, 0x4d, 0xa8, 
-    0x8e, 0x53, 0xaa, 0xaa, 0xb5, 0xab, 0x8c, 0x15, 0xab, 0x8c, 0x1a, 0xab, 0x91, 
-    0x55, 0xac, 0xab, 0xac, 0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 
-    0xaf, 0x90, 0x90, 0xb1, 0x98, 0x24, 0xb1, 0x98, 0x4c, 0xb2, 0x94, 0x17, 0xb2, 
-    0x9a, 0x5a, 0xb2, 0x9b, 0x64, 0xb3, 0x95, 0x19, 0xb3, 0xb3, 0xbd, 0xb4, 0x9e, 
-    0x69, 0xb4, 0xa7, 0x87, 0xb4, 0xb4, 0xb4, 0xb6, 0x99, 0x19, 0xb7, 0x99, 0x17, 
-    0xb7, 0xa1, 0x6c, 0xb8, 0xb8, 0xc2, 0xba, 0x9d, 0x1a, 0xba, 0xa3, 0xa4, 0xba, 
-    0xa5, 0x74, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xc4, 0xbc, 0xa5, 0x53, 0xbc, 0xa9, 
-    0x28, 0xbd, 0xaa, 0x7c, 0xbe, 0xa1, 0x1b, 0xc1, 0xae, 0x81, 0xc2, 0xa6, 0x1c, 
-    0xc3, 0xc3, 0xc4, 0xc4, 0xb2, 0x87, 0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 0x1d, 0xc6, 
-    0xac, 0x2e, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xca, 0xb7, 0x29, 0xcb, 0xcb, 
-    0xcc, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xd2, 0xcd, 0xb3, 0x21, 0xcd, 0xb9, 0x5b, 
-    0xcd, 0xbe, 0x99, 0xd0, 0xb6, 0x21, 0xd3, 0xd3, 0xd4, 0xd4, 0xc7, 0xa6, 0xd5, 
-    0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 0xdb, 0xc7, 
-    0x2a, 0xdb, 0xdb, 0xde, 0xdd, 0xc4, 0x26, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x27, 
-    0xe1, 0xc9, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe4, 0xe4, 0xcc, 0x29, 0xe6, 
-    0xe6, 0xe9, 0xe7, 0xd0, 0x2b, 0xe7, 0xd4, 0x58, 0xe9, 0xd5, 0x33, 0xea, 0xe4, 
-    0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xef, 0xd9, 0x2e, 0xef, 0xef, 0xf1, 
-    0xf2, 0xdc, 0x2e, 0xf2, 0xed, 0xed, 0xf4, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 0xf5, 
-    0xe0, 0x2f, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf7, 0xf8, 0xe4, 0x48, 0xf8, 0xe5, 
-    0x3b, 0xfa, 0xe5, 0x32, 0xfb, 0xeb, 0x6a, 0xfe, 0xf3, 0x90, 0xff, 0xeb, 0x34, 
-    0xff, 0xec, 0x3b, 0xff, 0xed, 0x42, 0xff, 0xed, 0x4b, 0xff, 0xee, 0x53, 0xff, 
-    0xf0, 0x5d, 0xff, 0xf0, 0x69, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x86, 0xff, 0xff, 
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xff, 0x00, 0xbd, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 
-    0x5c, 0xc8, 0xb0, 0xe1, 0x40, 0x5b, 0x0e, 0x23, 0x4a, 0x14, 0xe8, 0x2b, 0x9b, 
-    0xb7, 0x57, 0x13, 0x33, 0x32, 0xf4, 0x14, 0x0d, 0x9b, 0x25, 0x6f, 0xd6, 0xa2, 
-    0xc9, 0xd2, 0x48, 0x92, 0xa0, 0x24, 0x6a, 0xd4, 0x6a, 0x55, 0xa3, 0x86, 0xb1, 
-    0xa4, 0x4b, 0x5b, 0x28, 0xa1, 0x51, 0xdb, 0xe5, 0x32, 0xe2, 0x2b, 0x63, 0xcd, 
-    0x8c, 0xf9, 0xaa, 0x55, 0x0a, 0x18, 0x4a, 0x94, 0xd1, 0x36, 0xd5, 0x6c, 0xf8, 
-    0xea, 0x27, 0xb5, 0x66, 0xc0, 0x64, 0x45, 0x63, 0x26, 0x93, 0x1a, 0x33, 0x63, 
-    0xd1, 0x9a, 0x09, 0x2b, 0x35, 0xf4, 0x60, 0xa2, 0x66, 0x46, 0x81, 0x19, 0xbb, 
-    0x12, 0xc8, 0x97, 0xcf, 0x9f, 0xd5, 0xb0, 0x55, 0x45, 0x58, 0xca, 0x28, 0x50, 
-    0x6a, 0xa8, 0x74, 0xfe, 0x34, 0x56, 0x6b, 0x2c, 0xc2, 0x44, 0x4d, 0xcd, 0x46, 
-    0xf3, 0x65, 0x14, 0xd9, 0x4c, 0xb7, 0x07, 0x4b, 0xf9, 0x22, 0x86, 0x2c, 0x1a, 
-    0x50, 0x61, 0x76, 0xd7, 0x0a, 0xbb, 0xd6, 0xb2, 0xe4, 0x0e, 0x20, 0x0d, 0x4b, 
-    0xc9, 0xda, 0x05, 0xad, 0x16, 0x4a, 0x62, 0x32, 0x51, 0x79, 0x6b, 0xa5, 0x51, 
-    0x48, 0xa8, 0x59, 0xc5, 0x9c, 0x39, 0x3b, 0x76, 0x6b, 0x54, 0x91, 0x85, 0xbb, 
-    0xa8, 0x09, 0xc3, 0x39, 0x55, 0x18, 0xc9, 0x22, 0xa3, 0x96, 0x75, 0x5b, 0xcd, 
-    0x7a, 0xb5, 0xb3, 0x55, 0x54, 0x12, 0x26, 0x8a, 0x06, 0x6a, 0x32, 0x55, 0x92, 
-    0x74, 0x7e, 0xb5, 0xde, 0xcd, 0x1a, 0x96, 0x82, 0x84, 0xd1, 0x3e, 0xba, 0xfc, 
-    0xa3, 0x9a, 0x37, 0x6f, 0x18, 0x00, 0x04, 0x5c, 0x30, 0xb8, 0x29, 0xa5, 0xcb, 
-    0x2c, 0xc7, 0x8c, 0xf3, 0xee, 0x05, 0xa0, 0x7a, 0x81, 0xe5, 0x17, 0x6b, 0x19, 
-    0xd3, 0x45, 0x0d, 0x19, 0xab, 0x92, 0xb0, 0xa4, 0xf3, 0xff, 0xce, 0x54, 0xbd, 
-    0x3a, 0x01, 0x6f, 0xb2, 0x64, 0xd1, 0xfd, 0x4a, 0x4d, 0x97, 0xc6, 0x22, 0xc5, 
-    0xc5, 0xb3, 0xc6, 0x52, 0xbe, 0x7a, 0x84, 0x44, 0xc0, 0x6a, 0x11, 0x13, 0xd6, 
-    0xbd, 0xbb, 0xaf, 0x8c, 0x7b, 0xc8, 0xb7, 0x1b, 0x72, 0xf5, 0x01, 0xc0, 0xc7, 
-    0x2e, 0xaf, 0xd8, 0x62, 0x8b, 0x32, 0xd1, 0x00, 0xb3, 0x8b, 0x2f, 0x85, 0x39, 
-    0xa4, 0x89, 0x80, 0xad, 0x45, 0x50, 0x20, 0x00, 0x0c, 0x78, 0x63, 0x0b, 0x22, 
-    0x17, 0x35, 0xb3, 0xcb, 0x2e, 0x96, 0xc8, 0xd2, 0x56, 0x44, 0xa9, 0xb0, 0x56, 
-    0x4c, 0x2e, 0xe2, 0x39, 0x73, 0xc0, 0x85, 0x00, 0x20, 0xf0, 0xd1, 0x2b, 0xb5, 
-    0xd8, 0xa2, 0x8a, 0x2f, 0x92, 0x6c, 0x02, 0xcd, 0x7f, 0x0e, 0xcd, 0xb2, 0x1a, 
-    0x2c, 0xbd, 0x8c, 0x72, 0x8b, 0x33, 0xc6, 0x39, 0x23, 0x00, 0x8b, 0x06, 0x64, 
-    0x27, 0x8b, 0x27, 0x0f, 0xb6, 0x45, 0xd7, 0x88, 0x0c, 0x1d, 0x93, 0x4b, 0x26, 
-    0xd1, 0x75, 0xf3, 0x4b, 0x2a, 0xa1, 0x8c, 0x92, 0x8a, 0x8e, 0xab, 0x2d, 0x33, 
-    0x24, 0x8b, 0x39, 0x00, 0x53, 0xca, 0x2b, 0xaa, 0x00, 0x13, 0xe6, 0x45, 0xd4, 
-    0x28, 0xd3, 0x50, 0x25, 0xb0, 0xcc, 0x02, 0xa4, 0x6a, 0xbd, 0x14, 0xd3, 0x4d, 
-    0x31, 0xc7, 0x6c, 0xe6, 0x1a, 0x01, 0x2c, 0x02, 0x20, 0x01, 0x28, 0xa5, 0xd8, 
-    0x52, 0x0a, 0x31, 0x86, 0x8c, 0x58, 0x8b, 0x2f, 0x1c, 0x2a, 0x14, 0x46, 0x9c, 
-    0xbd, 0x74, 0x93, 0x0a, 0x0c, 0xdd, 0x20, 0x71, 0xc3, 0x6a, 0x6d, 0xb6, 0xa6, 
-    0x40, 0x9d, 0x05, 0x10, 0x24, 0x5c, 0x44, 0x8e, 0x44, 0x87, 0x62, 0x37, 0x91, 
-    0x5c, 0xd0, 0xcd, 0x20, 0x04, 0x44, 0xb9, 0x8a, 0x9b, 0xab, 0x95, 0x00, 0x29, 
-    0x49, 0x7b, 0xdc, 0xb2, 0xda, 0x2f, 0xb9, 0xb8, 0x99, 0xcb, 0x28, 0xdd, 0x2c, 
-    0x93, 0x09, 0x90, 0xdd, 0xc0, 0xff, 0x62, 0xea, 0x6a, 0x44, 0xd4, 0x09, 0x40, 
-    0x46, 0x54, 0x84, 0xd7, 0x5a, 0x66, 0xd2, 0xc5, 0x19, 0xdf, 0x20, 0xb6, 0x4e, 
-    0xf4, 0x47, 0x94, 0x14, 0x4a, 0xb7, 0x4a, 0xb0, 0x94, 0xc2, 0x5a, 0x6c, 0xaf, 
-    0x05, 0xb0, 0x28, 0x40, 0x44, 0x74, 0x28, 0xbb, 0xac, 0x74, 0xb5, 0x5e, 0x58, 
-    0xa4, 0x43, 0xb3, 0x4e, 0x2b, 0x5e, 0x2a, 0x2c, 0x22, 0xe0, 0x10, 0x15, 0xda, 
-    0x06, 0xf9, 0x4b, 0x74, 0xce, 0x88, 0x5a, 0x20, 0x04, 0x12, 0xee, 0x06, 0x4b, 
-    0x19, 0x3f, 0xfc, 0x50, 0x06, 0xb1, 0xc6, 0x1d, 0x63, 0x87, 0x09, 0x20, 0x74, 
-    0x10, 0x4a, 0x37, 0x76, 0x14, 0x78, 0x40, 0x44, 0xab, 0xb4, 0x06, 0x6c, 0x7d, 
-    0x91, 0x88, 0xb7, 0x0c, 0x0c, 0x24, 0x74, 0x40, 0x04, 0x94, 0xdd, 0x64, 0xd1, 
-    0x6c, 0x75, 0xfb, 0xf2, 0x5b, 0x61, 0x81, 0x99, 0x88, 0x57, 0x08, 0x08, 0x58, 
-    0xe8, 0xe6, 0x9a, 0x0b, 0xde, 0x28, 0xd0, 0xc0, 0x6f, 0x12, 0xf5, 0xcb, 0x5a, 
-    0x28, 0x25, 0x50, 0x70, 0x83, 0x1d, 0xba, 0x1a, 0x77, 0x8b, 0x37, 0x13, 0xb6, 
-    0xb6, 0x8c, 0x4b, 0x1e, 0x6b, 0xeb, 0x4c, 0x16, 0x85, 0x14, 0x13, 0x5f, 0x37, 
-    0xce, 0x20, 0x46, 0x52, 0x21, 0xe1, 0x76, 0x33, 0x8a, 0x0d, 0x42, 0x78, 0x53, 
-    0xc4, 0xa5, 0x6f, 0x6e, 0x31, 0x44, 0x49, 0x16, 0x2f, 0xdb, 0x4b, 0x41, 0x7f, 
-    0x74, 0xc3, 0xcb, 0x21, 0x53, 0x34, 0x61, 0x44, 0x49, 0x7f, 0x48, 0x2b, 0xdf, 
-    0x31, 0x61, 0x14, 0x94, 0x44, 0x1c, 0x4d, 0x27, 0x71, 0xca, 0x20, 0x2e, 0x39, 
-    0x22, 0xb5, 0xc9, 0x55, 0x17, 0xd4, 0x04, 0x13, 0x5b, 0xd0, 0x02, 0x64, 0x31, 
-    0x35, 0xa9, 0xa1, 0x66, 0xbc, 0xb0, 0xec, 0x81, 0x50, 0x12, 0xbc, 0xec, 0x36, 
-    0xca, 0x50, 0x40, 0x14, 0x62, 0xe5, 0x2a, 0xa3, 0x68, 0x12, 0xc6, 0x0e, 0x0a, 
-    0xa5, 0x2f, 0xdc, 0xda, 0x2f, 0x16, 0xe0, 0xe5, 0x10, 0xa8, 0xad, 0xcd, 0x92, 
-    0x80, 0xe0, 0x0c, 0xb1, 0xba, 0x1a, 0xb1, 0xb0, 0x00, 0x30, 0x01, 0xe2, 0x09, 
-    0x45, 0xcb, 0x5a, 0xb6, 0xb9, 0x00, 0x70, 0x38, 0xe4, 0x06, 0x15, 0x41, 0x78, 
-    0x37, 0x58, 0x76, 0x73, 0xcc, 0x90, 0x14, 0x48, 0x14, 0x10, 0x00, 0x21, 0xf9, 
-    0x04, 0x09, 0x03, 0x00, 0xdf, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x2d, 0x00, 
-    0x36, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x04, 0x0b, 0x0b, 0x0c, 0x13, 
-    0x13, 0x14, 0x14, 0x12, 0x09, 0x17, 0x16, 0x1a, 0x1c, 0x1c, 0x1c, 0x1f, 0x1e, 
-    0x1f, 0x22, 0x22, 0x23, 0x24, 0x23, 0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x2b, 0x09, 
-    0x2f, 0x2d, 0x38, 0x33, 0x33, 0x33, 0x39, 0x39, 0x3b, 0x3a, 0x39, 0x43, 0x43, 
-    0x43, 0x43, 0x47, 0x27, 0x24, 0x47, 0x3f, 0x50, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 
-    0x4d, 0x4d, 0x29, 0x1a, 0x4d, 0x3e, 0x4c, 0x4e, 0x46, 0x0f, 0x4e, 0x4c, 0x63, 
-    0x51, 0x3a, 0x43, 0x54, 0x54, 0x54, 0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x56, 
-    0x55, 0x5b, 0x56, 0x56, 0x6d, 0x57, 0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 
-    0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 
-    0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x65, 
-    0x65, 0x7a, 0x69, 0x3f, 0x44, 0x69, 0x62, 0x5a, 0x69, 0x6a, 0x7d, 0x6c, 0x6c, 
-    0x6c, 0x6d, 0x27, 0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 
-    0x72, 0x4b, 0x4c, 0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x74, 0x58, 0x0c, 0x76, 
-    0x38, 0x38, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x78, 0x6e, 
-    0x18, 0x7a, 0x7a, 0x86, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8d, 0x7f, 0x7f, 0x90, 
-    0x82, 0x4e, 0x4e, 0x83, 0x83, 0x86, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 
-    0x5f, 0x05, 0x87, 0x57, 0x57, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8a, 0x66, 
-    0x0a, 0x8b, 0x2f, 0x30, 0x8b, 0x8c, 0x9b, 0x8c, 0x69, 0x17, 0x8c, 0x72, 0x12, 
-    0x8c, 0x8c, 0x8c, 0x8d, 0x6d, 0x23, 0x90, 0x90, 0x9e, 0x93, 0x32, 0x32, 0x93, 
-    0x93, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x1b, 0x95, 0x89, 0x8d, 0x96, 0x6d, 
-    0x6d, 0x96, 0x73, 0x0c, 0x96, 0x75, 0x23, 0x96, 0x76, 0x28, 0x96, 0x89, 0x1e, 
-    0x97, 0x75, 0x16, 0x98, 0x7b, 0x37, 0x9a, 0x7a, 0x23, 0x9a, 0x9a, 0xa6, 0x9b, 
-    0x35, 0x35, 0x9b, 0x7b, 0x2b, 0x9b, 0x7d, 0x33, 0x9b, 0x9b, 0x9c, 0x9c, 0x7b, 
-    0x15, 0x9c, 0x7c, 0x1b, 0x9d, 0x9d, 0xaa, 0x9e, 0x7c, 0x0e, 0x9e, 0x81, 0x33, 
-    0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x28, 0x9f, 0x83, 0x41, 0xa0, 0x37, 0x37, 0xa0, 
-    0x7f, 0x14, 0xa1, 0x84, 0x3d, 0xa2, 0x7f, 0x7f, 0xa2, 0x86, 0x43, 0xa2, 0xa2, 
-    0xae, 0xa3, 0x83, 0x1a, 0xa3, 0x84, 0x25, 0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x14, 
-    0xa4, 0x87, 0x38, 0xa4, 0x89, 0x45, 0xa6, 0x8b, 0x4b, 0xa6, 0x8d, 0x54, 0xa6, 
-    0xa6, 0xb2, 0xa8, 0x87, 0x13, 0xa8, 0x8e, 0x51, 0xa9, 0x8e, 0x4f, 0xaa, 0x8b, 
-    0x19, 0xaa, 0x91, 0x55, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0xab, 0xab, 
-    0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x90, 0xaf, 0x91, 0x18, 0xaf, 
-    0x98, 0x5f, 0xaf, 0x98, 0x62, 0xb0, 0x98, 0x2a, 0xb1, 0x9a, 0x63, 0xb2, 0x93, 
-    0x16, 0xb3, 0x95, 0x19, 0xb3, 0x9a, 0x53, 0xb4, 0x9e, 0x69, 0xb4, 0xb3, 0xb4, 
-    0xb4, 0xb4, 0xbd, 0xb6, 0x98, 0x16, 0xb6, 0x99, 0x19, 0xb6, 0xa1, 0x6d, 0xb7, 
-    0xa8, 0x25, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 0xc2, 0xb9, 0xa4, 0x6e, 0xb9, 0xa4, 
-    0x72, 0xba, 0xa3, 0x51, 0xba, 0xa3, 0xa4, 0xbb, 0x9d, 0x1a, 0xbb, 0xbb, 0xc4, 
-    0xbc, 0xbc, 0xbc, 0xbd, 0xaa, 0x7b, 0xbe, 0xa1, 0x1a, 0xc1, 0xaf, 0x83, 0xc2, 
-    0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xcb, 0xc5, 0xb4, 0x89, 0xc6, 0xaa, 
-    0x1d, 0xc7, 0xac, 0x22, 0xc7, 0xb6, 0x28, 0xc9, 0xae, 0x1f, 0xc9, 0xb6, 0xb7, 
-    0xc9, 0xb9, 0x93, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 
-    0xb3, 0x20, 0xd0, 0xbd, 0x67, 0xd1, 0xb6, 0x21, 0xd2, 0xba, 0x37, 0xd3, 0xc5, 
-    0xa4, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 
-    0xd8, 0xbf, 0x24, 0xda, 0xc5, 0x2a, 0xdb, 0xdb, 0xde, 0xdc, 0xc3, 0x26, 0xde, 
-    0xde, 0xe2, 0xe0, 0xc7, 0x27, 0xe1, 0xc9, 0x27, 0xe3, 0xd2, 0x67, 0xe3, 0xd9, 
-    0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xe6, 0xe9, 0xe7, 0xd0, 0x2b, 
-    0xe9, 0xd4, 0x34, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xef, 
-    0xd9, 0x2d, 0xef, 0xef, 0xf1, 0xf1, 0xde, 0x3e, 0xf1, 0xe1, 0x6f, 0xf2, 0xdc, 
-    0x2f, 0xf2, 0xe0, 0x56, 0xf2, 0xed, 0xed, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 
-    0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf6, 0xfa, 0xe5, 0x32, 0xfe, 
-    0xec, 0x46, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3c, 0xff, 0xee, 0x54, 0xff, 0xef, 
-    0x5b, 0xff, 0xf0, 0x56, 0xff, 0xf0, 0x68, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x7c, 
-    0xff, 0xf4, 0x87, 0xff, 0xf4, 0x93, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xbf, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 
-    0xc1, 0x83, 0x07, 0x85, 0x11, 0xe4, 0x85, 0xb0, 0xa1, 0x43, 0x87, 0xc8, 0xbe, 
-    0x29, 0xfc, 0x36, 0x4d, 0x59, 0xa6, 0x87, 0x18, 0x33, 0x7e, 0x7b, 0x45, 0x4d, 
-    0x5a, 0xa9, 0x6a, 0xd4, 0x48, 0x69, 0x1c, 0xd9, 0xf0, 0x13, 0x35, 0x6a, 0xc4, 
-    0xa8, 0x05, 0x23, 0xc9, 0xd2, 0xa0, 0xad, 0x93, 0x27, 0x5f, 0x7d, 0xcb, 0x74, 
-    0xb1, 0xe5, 0x43, 0x48, 0x9f, 0x20, 0xf1, 0x39, 0xf4, 0x12, 0x26, 0x35, 0x5b, 
-    0xcf, 0xa8, 0x4d, 0x33, 0x66, 0x13, 0xe1, 0xa2, 0x60, 0x30, 0x8d, 0x11, 0x43, 
-    0x6a, 0xcc, 0x27, 0x35, 0x6b, 0x45, 0x1b, 0x22, 0x85, 0x19, 0xac, 0x54, 0xa9, 
-    0x1d, 0xc4, 0xa4, 0x9d, 0x7c, 0x16, 0x8c, 0x55, 0xd4, 0x83, 0xa4, 0x9c, 0x3e, 
-    0xd3, 0x5a, 0x8a, 0x58, 0xd0, 0x8e, 0x41, 0x7f, 0x7d, 0x2d, 0x58, 0xcb, 0x29, 
-    0xcc, 0x67, 0x4d, 0x61, 0x0a, 0x13, 0x66, 0xad, 0xd6, 0xda, 0x81, 0xa6, 0xdc, 
-    0x9e, 0x24, 0x26, 0xec, 0xa4, 0xd6, 0x6a, 0x76, 0xef, 0x12, 0x7c, 0xf5, 0xeb, 
-    0x57, 0xb0, 0xc2, 0xc2, 0x70, 0x3d, 0xb3, 0xa5, 0x95, 0x18, 0x61, 0x86, 0x82, 
-    0x1b, 0xba, 0x71, 0x25, 0xed, 0x59, 0x2d, 0x85, 0xaf, 0xe2, 0xd8, 0x89, 0x7c, 
-    0x50, 0x16, 0x31, 0x63, 0xb6, 0x6a, 0xa9, 0x5d, 0x64, 0xab, 0xa9, 0x31, 0x65, 
-    0xb6, 0x38, 0x0f, 0xac, 0x55, 0x19, 0xee, 0xae, 0x67, 0x9f, 0xd2, 0x06, 0x0b, 
-    0xc6, 0xd3, 0xab, 0x6a, 0x61, 0x97, 0xa4, 0xa5, 0x72, 0x45, 0x4a, 0x9a, 0x32, 
-    0x52, 0x90, 0x8c, 0x2d, 0xfa, 0x15, 0xf8, 0x6b, 0x0e, 0x1f, 0x05, 0x17, 0x7d, 
-    0x52, 0x78, 0xc8, 0x55, 0x47, 0x53, 0xdf, 0x3a, 0x11, 0xfa, 0xf6, 0xa9, 0xe8, 
-    0x0f, 0x50, 0xb3, 0x8a, 0x41, 0x83, 0xe6, 0xec, 0x56, 0x28, 0x21, 0x02, 0x0f, 
-    0xa5, 0xff, 0x12, 0xd8, 0xf6, 0xa4, 0xac, 0xaf, 0x42, 0x42, 0x39, 0xf3, 0xc6, 
-    0xbe, 0x3d, 0x7b, 0x68, 0xab, 0x9e, 0x10, 0x64, 0xe5, 0xf3, 0xd5, 0x25, 0x9b, 
-    0x6f, 0x80, 0xb9, 0xdf, 0xdf, 0x3e, 0x96, 0x02, 0x82, 0x29, 0x99, 0x27, 0x4b, 
-    0x71, 0x1a, 0xf9, 0xb1, 0x1e, 0x7f, 0xfc, 0xb9, 0x00, 0x80, 0x00, 0x10, 0x08, 
-    0xb4, 0x07, 0x2e, 0xbf, 0x94, 0x06, 0x89, 0x30, 0x6a, 0x69, 0x24, 0xc5, 0x31, 
-    0x08, 0xf2, 0xe7, 0x0b, 0x00, 0x1c, 0x0a, 0x40, 0xc1, 0x37, 0xae, 0xe0, 0x22, 
-    0xcb, 0x2f, 0xaf, 0xd8, 0x22, 0x0b, 0x35, 0x04, 0x3a, 0x14, 0x4b, 0x86, 0xfc, 
-    0x6d, 0xc2, 0x61, 0x87, 0x3b, 0x10, 0x57, 0x4a, 0x33, 0xc1, 0x85, 0x45, 0x4c, 
-    0x46, 0x42, 0x1c, 0xc8, 0x62, 0x7b, 0x61, 0xbc, 0xc8, 0xe1, 0x05, 0xba, 0xe8, 
-    0xf2, 0xca, 0x33, 0x9d, 0x08, 0x93, 0xc9, 0x58, 0x90, 0x60, 0x84, 0xc7, 0x8e, 
-    0xfb, 0xf5, 0xe0, 0x23, 0x87, 0x36, 0x74, 0x92, 0xca, 0x2b, 0xa4, 0x1c, 0x32, 
-    0x53, 0x6a, 0x18, 0x69, 0xc2, 0xa4, 0x7b, 0x23, 0x3c, 0xb9, 0x60, 0x54, 0xa1, 
-    0xb4, 0x57, 0x4c, 0x2e, 0x3b, 0x3a, 0xe0, 0x25, 0x00, 0xff, 0xd9, 0x34, 0x0b, 
-    0x7b, 0xb1, 0xf8, 0x12, 0xca, 0x2d, 0xd0, 0x64, 0xa8, 0xc0, 0x99, 0x02, 0x14, 
-    0x75, 0x4c, 0x2e, 0x9b, 0x60, 0xe8, 0x0d, 0x30, 0xaa, 0x80, 0x12, 0x8a, 0x2a, 
-    0x6b, 0xb6, 0x37, 0xe7, 0x99, 0x08, 0xb4, 0x34, 0x49, 0x2c, 0xb3, 0xc4, 0xb9, 
-    0x9e, 0x2f, 0xc5, 0x78, 0x53, 0xcc, 0x31, 0xd0, 0xe8, 0xe9, 0x8d, 0x99, 0x67, 
-    0x1e, 0xc0, 0xd2, 0x85, 0xd0, 0xf8, 0xe2, 0x8d, 0x2a, 0x2e, 0x78, 0xd3, 0x44, 
-    0x0d, 0xec, 0x31, 0xea, 0x5e, 0x07, 0x67, 0x02, 0x50, 0x00, 0x49, 0x8e, 0x60, 
-    0x48, 0xa6, 0x37, 0x8d, 0x50, 0xe0, 0x0d, 0x20, 0x03, 0xe8, 0xff, 0xb9, 0x4a, 
-    0xa3, 0xec, 0xe1, 0x50, 0x2a, 0x00, 0x1a, 0xe1, 0x71, 0x0b, 0x7b, 0xc0, 0xe4, 
-    0xd2, 0x68, 0x2e, 0x61, 0x3a, 0xb3, 0x49, 0x9c, 0xde, 0xc4, 0xb2, 0x2b, 0x7b, 
-    0x3d, 0x96, 0x8a, 0xd1, 0x13, 0x2b, 0xba, 0xa7, 0x5d, 0x86, 0x90, 0xea, 0xe8, 
-    0xa2, 0xb2, 0x0e, 0xf9, 0x21, 0xe9, 0x96, 0x08, 0xe6, 0x72, 0xab, 0x43, 0x8e, 
-    0x10, 0x8b, 0x6d, 0x86, 0xd0, 0x40, 0x40, 0xed, 0x41, 0x6f, 0x78, 0xfb, 0x6d, 
-    0x86, 0x72, 0x9c, 0x39, 0x40, 0x43, 0xc7, 0x9e, 0xcb, 0xa2, 0xb6, 0x5e, 0x1a, 
-    0x80, 0xd0, 0x13, 0xee, 0x22, 0x08, 0x0d, 0x30, 0x7a, 0x3a, 0xf9, 0x64, 0x9a, 
-    0x06, 0x69, 0xe9, 0x5e, 0x2c, 0x61, 0xf4, 0xd0, 0x83, 0x1c, 0xd7, 0xf2, 0x77, 
-    0x8c, 0x1c, 0x24, 0x80, 0xb0, 0x01, 0x28, 0xde, 0xf8, 0x11, 0x80, 0x8f, 0x85, 
-    0x22, 0xb4, 0x8a, 0x7b, 0x80, 0x3c, 0xd9, 0x08, 0x8b, 0xce, 0xb8, 0x20, 0xc2, 
-    0x06, 0x41, 0x4c, 0x82, 0xa1, 0x14, 0x94, 0x02, 0x60, 0x69, 0x43, 0x13, 0xb7, 
-    0x27, 0xae, 0x8f, 0x9b, 0xb0, 0x28, 0x08, 0x08, 0x51, 0xe8, 0xf7, 0x5e, 0x0b, 
-    0xdf, 0x34, 0x30, 0x40, 0xc4, 0x24, 0xbb, 0x07, 0xca, 0x08, 0x10, 0xd4, 0x20, 
-    0x47, 0xb3, 0x08, 0xde, 0xf2, 0x0d, 0xc3, 0xee, 0x39, 0x43, 0x52, 0xc9, 0xee, 
-    0x42, 0xd3, 0x85, 0x20, 0xc5, 0xe8, 0xe8, 0x0d, 0x34, 0xc8, 0x69, 0x24, 0x48, 
-    0xbd, 0xde, 0x84, 0x42, 0xc3, 0x0f, 0xdf, 0x08, 0xb1, 0xaa, 0xa3, 0x55, 0x00, 
-    0x31, 0x92, 0xcb, 0xdf, 0xfa, 0x52, 0x90, 0x1f, 0xde, 0xf4, 0x32, 0x48, 0x12, 
-    0x49, 0x0c, 0x31, 0x92, 0x1f, 0xe6, 0xee, 0x78, 0x4c, 0x17, 0x05, 0x15, 0xd1, 
-    0x06, 0xd9, 0x45, 0x9c, 0xe2, 0x07, 0xaa, 0x69, 0xf7, 0xcc, 0x76, 0x41, 0x49, 
-    0x1c, 0x51, 0x05, 0x2d, 0x71, 0x16, 0x4b, 0xc3, 0x12, 0x19, 0x89, 0x22, 0x78, 
-    0x4c, 0x2c, 0x78, 0x20, 0x54, 0x44, 0x2f, 0xfb, 0x81, 0xd2, 0xd2, 0x0f, 0x82, 
-    0xfc, 0xb9, 0x4a, 0x28, 0x9a, 0x74, 0x91, 0x83, 0x43, 0xfe, 0xba, 0x07, 0xcc, 
-    0x04, 0xaa, 0x21, 0x44, 0xab, 0x7b, 0xb3, 0x24, 0x90, 0xb9, 0x41, 0x61, 0xb2, 
-    0x27, 0x69, 0x2c, 0x00, 0x7c, 0xf8, 0xb9, 0x40, 0xe5, 0xb6, 0xd7, 0xae, 0xb6, 
-    0x9e, 0x9f, 0x2e, 0xc4, 0xe6, 0xde, 0x04, 0xea, 0xcd, 0x31, 0x02, 0x00, 0x20, 
-    0x81, 0x43, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xdd, 0x00, 
-    0x2c, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x87, 0x00, 0x00, 0x00, 
-    0x0a, 0x09, 0x04, 0x0b, 0x0b, 0x0c, 0x13, 0x13, 0x14, 0x14, 0x12, 0x09, 0x17, 
-    0x16, 0x1a, 0x1c, 0x1c, 0x1c, 0x1f, 0x1e, 0x1f, 0x22, 0x22, 0x23, 0x24, 0x23, 
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x2b, 0x09, 0x2f, 0x2d, 0x38, 0x33, 0x33, 0x33, 
-    0x39, 0x39, 0x3b, 0x3a, 0x39, 0x43, 0x43, 0x43, 0x43, 0x47, 0x27, 0x24, 0x47, 
-    0x3f, 0x50, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 0x4d, 0x4d, 0x29, 0x1a, 0x4d, 0x3e, 
-    0x4c, 0x4e, 0x46, 0x0f, 0x4e, 0x4c, 0x63, 0x51, 0x3a, 0x43, 0x54, 0x54, 0x54, 
-    0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x56, 0x55, 0x5b, 0x56, 0x56, 0x6d, 0x57, 
-    0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 
-    0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x65, 0x65, 0x7a, 0x69, 0x3f, 0x44, 0x69, 
-    0x62, 0x5a, 0x69, 0x6a, 0x7d, 0x6c, 0x6c, 0x6c, 0x6d, 0x27, 0x27, 0x6d, 0x6c, 
-    0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 0x72, 0x4b, 0x4c, 0x72, 0x72, 0x85, 
-    0x73, 0x73, 0x74, 0x74, 0x58, 0x0c, 0x76, 0x38, 0x38, 0x76, 0x76, 0x7b, 0x76, 
-    0x76, 0x89, 0x77, 0x28, 0x29, 0x78, 0x6e, 0x18, 0x7a, 0x7a, 0x86, 0x7b, 0x7b, 
-    0x7c, 0x7b, 0x7b, 0x8d, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x82, 0x4e, 0x4e, 
-    0x83, 0x5f, 0x07, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 
-    0x83, 0x8f, 0x87, 0x57, 0x57, 0x88, 0x73, 0x17, 0x89, 0x89, 0x95, 0x8a, 0x2e, 
-    0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x68, 0x0b, 0x8b, 0x8c, 0x9b, 0x8c, 0x8c, 0x8c, 
-    0x8e, 0x30, 0x31, 0x90, 0x6e, 0x20, 0x90, 0x90, 0x9e, 0x91, 0x6e, 0x0b, 0x92, 
-    0x77, 0x36, 0x93, 0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x72, 
-    0x0c, 0x95, 0x74, 0x11, 0x95, 0x74, 0x1c, 0x95, 0x75, 0x23, 0x95, 0x89, 0x8d, 
-    0x96, 0x6d, 0x6d, 0x96, 0x76, 0x29, 0x96, 0x89, 0x1e, 0x98, 0x77, 0x19, 0x99, 
-    0x77, 0x0d, 0x9a, 0x7a, 0x23, 0x9a, 0x7b, 0x2b, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 
-    0x35, 0x9b, 0x7d, 0x32, 0x9b, 0x9b, 0x9c, 0x9c, 0x7b, 0x15, 0x9c, 0x7b, 0x1b, 
-    0x9d, 0x7c, 0x0e, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x33, 0x9e, 0x81, 0x3b, 0x9f, 
-    0x80, 0x28, 0xa0, 0x37, 0x37, 0xa1, 0x84, 0x3d, 0xa2, 0x7f, 0x7f, 0xa2, 0x83, 
-    0x24, 0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1a, 0xa3, 0x86, 0x37, 
-    0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x14, 0xa4, 0x89, 0x45, 0xa6, 0x8b, 0x4b, 0xa6, 
-    0xa6, 0xb2, 0xa8, 0x87, 0x12, 0xa8, 0x8e, 0x4f, 0xa8, 0x8e, 0x51, 0xaa, 0x8b, 
-    0x1a, 0xaa, 0xaa, 0xb5, 0xab, 0x8c, 0x15, 0xab, 0x91, 0x55, 0xab, 0xab, 0xab, 
-    0xad, 0x93, 0x46, 0xad, 0x95, 0x5b, 0xae, 0x97, 0x2a, 0xae, 0xae, 0xb9, 0xaf, 
-    0x90, 0x90, 0xaf, 0x91, 0x17, 0xaf, 0x98, 0x5f, 0xaf, 0x98, 0x60, 0xb2, 0x93, 
-    0x16, 0xb2, 0x99, 0x51, 0xb2, 0x9a, 0x64, 0xb3, 0x95, 0x19, 0xb4, 0x9e, 0x69, 
-    0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xbd, 0xb6, 0x98, 0x16, 0xb6, 0x99, 0x19, 0xb6, 
-    0xa1, 0x6d, 0xb7, 0xa8, 0x25, 0xb8, 0xa2, 0x6f, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 
-    0xc2, 0xba, 0xa3, 0xa4, 0xbb, 0x9d, 0x1a, 0xbb, 0xa7, 0x76, 0xbb, 0xbb, 0xc4, 
-    0xbc, 0xbc, 0xbc, 0xbe, 0xa1, 0x1b, 0xbf, 0xac, 0x80, 0xc1, 0xaf, 0x83, 0xc2, 
-    0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xb3, 0x89, 0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 
-    0x1d, 0xc7, 0xb6, 0x28, 0xc8, 0xad, 0x21, 0xc9, 0xad, 0x1f, 0xc9, 0xb6, 0xb7, 
-    0xc9, 0xb9, 0x93, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 
-    0xb3, 0x21, 0xd1, 0xb6, 0x21, 0xd1, 0xc4, 0xa3, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 
-    0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 0xda, 0xc5, 0x2a, 
-    0xdb, 0xdb, 0xde, 0xdc, 0xc3, 0x26, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x27, 0xe1, 
-    0xc9, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xe6, 
-    0xe9, 0xe7, 0xd0, 0x2b, 0xe7, 0xd6, 0x69, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 
-    0xeb, 0xd6, 0x36, 0xeb, 0xeb, 0xed, 0xef, 0xd9, 0x2d, 0xef, 0xef, 0xf1, 0xf1, 
-    0xe1, 0x6f, 0xf2, 0xdc, 0x2f, 0xf2, 0xe0, 0x56, 0xf2, 0xed, 0xed, 0xf3, 0xde, 
-    0x30, 0xf4, 0xf4, 0xf5, 0xf6, 0xe2, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf6, 
-    0xfa, 0xe5, 0x32, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3c, 0xff, 0xed, 0x46, 0xff, 
-    0xee, 0x54, 0xff, 0xef, 0x5b, 0xff, 0xf0, 0x56, 0xff, 0xf0, 0x68, 0xff, 0xf2, 
-    0x74, 0xff, 0xf4, 0x87, 0xff, 0xf4, 0x93, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 
-    0x00, 0xbb, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x07, 0x81, 0x11, 0xdc, 
-    0x85, 0xb0, 0xa1, 0xc3, 0x86, 0xc6, 0xba, 0x11, 0x13, 0x48, 0x8d, 0x99, 0xa6, 
-    0x87, 0x18, 0x33, 0xca, 0x92, 0x16, 0xcd, 0xd4, 0x34, 0x69, 0xa7, 0x32, 0x8a, 
-    0x74, 0x18, 0x4a, 0x9a, 0x34, 0x62, 0xd2, 0x14, 0x8e, 0x5c, 0x69, 0xd0, 0x96, 
-    0x49, 0x93, 0xaf, 0xba, 0x69, 0xba, 0xc8, 0xf2, 0xe1, 0xa4, 0x50, 0x93, 0x00, 
-    0x15, 0x72, 0xf9, 0x52, 0x9a, 0x2d, 0x67, 0xd2, 0xa8, 0x45, 0xac, 0x79, 0x90, 
-    0x11, 0xb0, 0x97, 0xc6, 0x88, 0x1d, 0x35, 0xd6, 0x53, 0x5a, 0x35, 0xa2, 0x0d, 
-    0x8f, 0xbe, 0x04, 0x66, 0xca, 0xd4, 0x0e, 0x62, 0xd1, 0x4c, 0x46, 0x03, 0xe6, 
-    0x0a, 0xea, 0xc1, 0x52, 0x4d, 0x9d, 0x65, 0x35, 0x45, 0x0c, 0x28, 0x47, 0xa0, 
-    0xbe, 0xbc, 0x16, 0xac, 0xd5, 0xf4, 0xa5, 0x33, 0xa6, 0x2f, 0x6b, 0xed, 0xaa, 
-    0x66, 0x4b, 0xed, 0xc0, 0x53, 0x6d, 0x4d, 0x0e, 0x1b, 0x66, 0x32, 0x99, 0xaf, 
-    0xb7, 0xb2, 0xec, 0x12, 0x7c, 0xe5, 0xab, 0xb0, 0x2f, 0x60, 0xc0, 0x70, 0x39, 
-    0xb3, 0x15, 0x2d, 0x9a, 0x2f, 0x69, 0xbe, 0x5c, 0xd5, 0x15, 0x6c, 0x50, 0x96, 
-    0xa7, 0x49, 0xb5, 0xa2, 0x2d, 0xce, 0x6c, 0xcb, 0x96, 0x2f, 0x9a, 0x94, 0x0f, 
-    0xae, 0x2a, 0xdc, 0x6d, 0xd8, 0xaa, 0xd0, 0x19, 0x4b, 0x39, 0x1b, 0x8d, 0x3a, 
-    0xa3, 0x29, 0x69, 0xce, 0x3c, 0xb5, 0xce, 0xe1, 0xc3, 0xe1, 0x2b, 0x8e, 0xa7, 
-    0xed, 0x12, 0x11, 0x35, 0xab, 0xd8, 0xb3, 0x67, 0xc7, 0x6e, 0x91, 0x22, 0xd2, 
-    0xf2, 0x65, 0x60, 0xa8, 0x44, 0x48, 0x35, 0xe3, 0xc6, 0xbc, 0x39, 0xf3, 0x67, 
-    0xad, 0xa2, 0x10, 0x74, 0xd5, 0xf3, 0x95, 0x6c, 0x96, 0x73, 0x7e, 0x39, 0xdf, 
-    0xde, 0x3c, 0x96, 0x02, 0x82, 0x7c, 0x4d, 0xca, 0xff, 0xaa, 0x55, 0x6b, 0xe5, 
-    0x9f, 0xe5, 0xdc, 0xb9, 0xbb, 0x00, 0x20, 0x00, 0x82, 0xc0, 0x41, 0x9e, 0x75, 
-    0x19, 0x9b, 0x44, 0x2c, 0x6d, 0x46, 0x2b, 0xc7, 0xd2, 0x73, 0xef, 0x05, 0xa0, 
-    0xbf, 0x00, 0x0a, 0xdd, 0xbc, 0xa2, 0x8b, 0x2c, 0xbe, 0xbc, 0x62, 0x0b, 0x5b, 
-    0xe5, 0x61, 0x14, 0x8b, 0x7e, 0xdc, 0x75, 0xd2, 0x9f, 0x7f, 0x3b, 0xf8, 0x52, 
-    0x8b, 0x29, 0x16, 0x19, 0x03, 0xd6, 0x44, 0x0f, 0x11, 0x81, 0x1e, 0x83, 0xcd, 
-    0x99, 0xf1, 0x60, 0x7f, 0x17, 0xe8, 0xa2, 0x8b, 0x2b, 0xb1, 0x0d, 0x33, 0x89, 
-    0x58, 0x93, 0x3c, 0xa4, 0x07, 0x87, 0xdb, 0xf5, 0xf0, 0x61, 0x7f, 0x36, 0x78, 
-    0xb2, 0x8a, 0x2c, 0xa7, 0x14, 0xd2, 0x8d, 0x27, 0x93, 0x39, 0xc4, 0x09, 0x8b, 
-    0xce, 0x8d, 0xf0, 0x22, 0x7b, 0x50, 0xb1, 0xd2, 0x5c, 0x31, 0xb9, 0x70, 0xe8, 
-    0xc0, 0x8f, 0x00, 0x7c, 0x57, 0xd3, 0x2c, 0xcc, 0xc5, 0xd2, 0x0b, 0x29, 0xb7, 
-    0x3c, 0xa3, 0x9f, 0x02, 0x48, 0x0a, 0x40, 0xd4, 0x31, 0xb9, 0x74, 0x92, 0x1f, 
-    0x37, 0xbf, 0xb0, 0x22, 0x0a, 0x29, 0xac, 0x30, 0xd9, 0x1c, 0x95, 0x48, 0x22, 
-    0xc0, 0xd2, 0x25, 0xb1, 0xcc, 0x22, 0xe5, 0x72, 0xbd, 0x14, 0xc3, 0x4d, 0x31, 
-    0xc7, 0x00, 0xd7, 0xdc, 0x91, 0x48, 0x1e, 0xb0, 0x12, 0x7e, 0xcf, 0xf4, 0xc2, 
-    0x0d, 0x2b, 0x2e, 0x70, 0x33, 0x44, 0x0d, 0xcc, 0xb5, 0xe9, 0x5c, 0x07, 0x48, 
-    0x02, 0x50, 0xc0, 0x48, 0x91, 0xe4, 0x57, 0x24, 0x37, 0x90, 0x50, 0xc0, 0x8d, 
-    0x20, 0x03, 0x6c, 0xd9, 0x8a, 0x9b, 0xcc, 0xb9, 0x58, 0x68, 0x46, 0x73, 0xdc, 
-    0xc2, 0xdc, 0x2f, 0xb9, 0xb8, 0x99, 0x0b, 0x29, 0xdc, 0x34, 0xd3, 0x89, 0x94, 
-    0xdc, 0xc4, 0xa2, 0x29, 0x73, 0x1e, 0x5e, 0xea, 0x50, 0x14, 0x0b, 0x3a, 0xe7, 
-    0x9b, 0x7e, 0x71, 0x6e, 0xff, 0xe8, 0xa0, 0xaa, 0x08, 0xfd, 0xb1, 0x25, 0x8f, 
-    0xfa, 0xe5, 0x52, 0x28, 0x00, 0x0d, 0x45, 0x42, 0x2a, 0xae, 0xfa, 0x3d, 0x03, 
-    0x01, 0xad, 0x05, 0xcd, 0xf1, 0x2b, 0xb0, 0xfa, 0xd9, 0x81, 0xe4, 0x00, 0x08, 
-    0x9d, 0x8a, 0x2c, 0x83, 0xba, 0xfe, 0x68, 0xc0, 0x41, 0x51, 0x3c, 0x9b, 0xde, 
-    0x33, 0xbf, 0x6c, 0x69, 0xe9, 0x87, 0x4a, 0x16, 0xb4, 0xa3, 0x73, 0xb1, 0x98, 
-    0x31, 0x44, 0x0f, 0x76, 0xdc, 0x9a, 0xde, 0x31, 0x76, 0x90, 0x00, 0xc2, 0x06, 
-    0xa2, 0x70, 0xf3, 0x47, 0x00, 0x1f, 0x9a, 0x79, 0x50, 0x2b, 0xce, 0x09, 0xf2, 
-    0x22, 0x24, 0x0c, 0x36, 0xe3, 0x82, 0x08, 0x1b, 0x0c, 0x71, 0x49, 0x7e, 0x56, 
-    0xd0, 0x09, 0x80, 0x9d, 0x08, 0xd1, 0xdb, 0xdc, 0xb0, 0x1f, 0x76, 0xc2, 0xa0, 
-    0x21, 0x20, 0x54, 0xa1, 0xdd, 0x73, 0x31, 0x74, 0xd3, 0xc0, 0x00, 0xf2, 0x16, 
-    0xec, 0x9c, 0x28, 0x23, 0x40, 0x50, 0x83, 0x1d, 0xad, 0xa6, 0x77, 0x4b, 0x37, 
-    0xdf, 0x36, 0xd7, 0xcc, 0x48, 0x06, 0x3f, 0xfb, 0x8c, 0x15, 0x86, 0x14, 0xb3, 
-    0x21, 0x37, 0xcf, 0xd4, 0x96, 0x91, 0x21, 0xd6, 0x72, 0x43, 0x0a, 0x0d, 0x46, 
-    0x74, 0x43, 0x84, 0xb3, 0xc5, 0x70, 0x11, 0x84, 0x48, 0x0f, 0x03, 0xdb, 0x4b, 
-    0x41, 0x7f, 0x70, 0xc3, 0xcb, 0x21, 0x4f, 0x2c, 0x51, 0x84, 0x48, 0x7f, 0x1c, 
-    0xcb, 0xe1, 0x31, 0x63, 0x14, 0x74, 0x04, 0x1c, 0x45, 0x1f, 0x91, 0xca, 0x1f, 
-    0x88, 0x2a, 0xed, 0x71, 0xd3, 0x05, 0x2d, 0xa1, 0x04, 0x17, 0xb4, 0x48, 0x59, 
-    0xcc, 0x4a, 0x6a, 0xa8, 0x79, 0x6e, 0x2c, 0x7a, 0x20, 0x74, 0x04, 0x2f, 0xdb, 
-    0x91, 0xc2, 0x92, 0x0f, 0x86, 0x80, 0xd9, 0x0a, 0x29, 0x9c, 0x8c, 0x91, 0x83, 
-    0x8e, 0xdc, 0xfd, 0x32, 0x41, 0x6b, 0x07, 0x51, 0xea, 0xdc, 0x2c, 0x09, 0xe0, 
-    0x21, 0x5d, 0x10, 0xa8, 0xcc, 0xdd, 0x1a, 0x0b, 0x00, 0x00, 0xfa, 0xdd, 0x8d, 
-    0xb1, 0xcd, 0x39, 0xab, 0x6b, 0xdf, 0x7e, 0x13, 0xa1, 0x37, 0x37, 0x62, 0x72, 
-    0x73, 0x8c, 0x00, 0x00, 0x48, 0xd0, 0x50, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 
-    0x03, 0x00, 0xdd, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x36, 0x00, 
-    0x87, 0x00, 0x00, 0x00, 0x09, 0x08, 0x04, 0x0b, 0x0b, 0x0c, 0x0e, 0x0e, 0x12, 
-    0x13, 0x13, 0x14, 0x17, 0x15, 0x05, 0x17, 0x17, 0x1a, 0x1c, 0x1c, 0x1c, 0x1e, 
-    0x1e, 0x25, 0x22, 0x22, 0x23, 0x24, 0x1f, 0x09, 0x24, 0x22, 0x2b, 0x28, 0x24, 
-    0x07, 0x2b, 0x2b, 0x2b, 0x2f, 0x2d, 0x38, 0x33, 0x33, 0x33, 0x34, 0x33, 0x3c, 
-    0x3a, 0x39, 0x43, 0x3b, 0x3b, 0x3c, 0x3d, 0x38, 0x0c, 0x44, 0x43, 0x44, 0x47, 
-    0x27, 0x24, 0x47, 0x3f, 0x50, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 0x4d, 0x4d, 0x3e, 
-    0x4c, 0x4e, 0x25, 0x1e, 0x4e, 0x4c, 0x63, 0x51, 0x3a, 0x43, 0x54, 0x54, 0x54, 
-    0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x56, 0x55, 0x5b, 0x56, 0x56, 0x6d, 0x57, 
-    0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 
-    0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 0x60, 0x5e, 0x6b, 0x61, 0x34, 0x3a, 
-    0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x64, 0x55, 0x17, 0x65, 
-    0x65, 0x7a, 0x69, 0x3f, 0x44, 0x69, 0x6a, 0x7d, 0x6c, 0x6c, 0x6c, 0x6d, 0x27, 
-    0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 0x72, 0x4b, 0x4c, 
-    0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x76, 0x38, 0x38, 0x76, 0x76, 0x89, 0x77, 
-    0x28, 0x29, 0x77, 0x66, 0x14, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8d, 0x7f, 0x7f, 
-    0x90, 0x7f, 0x80, 0x91, 0x82, 0x4e, 0x4e, 0x82, 0x5e, 0x09, 0x83, 0x83, 0x86, 
-    0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x87, 0x57, 0x57, 0x89, 0x89, 0x95, 0x8a, 
-    0x2e, 0x2e, 0x8a, 0x66, 0x09, 0x8b, 0x2f, 0x30, 0x8b, 0x78, 0x18, 0x8b, 0x8c, 
-    0x9b, 0x8c, 0x6a, 0x15, 0x8c, 0x8c, 0x8c, 0x8e, 0x30, 0x31, 0x8e, 0x75, 0x39, 
-    0x90, 0x90, 0x9e, 0x91, 0x6e, 0x0c, 0x93, 0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 
-    0x94, 0xa2, 0x96, 0x6d, 0x6d, 0x96, 0x75, 0x15, 0x96, 0x75, 0x1c, 0x96, 0x75, 
-    0x24, 0x96, 0x8a, 0x1e, 0x97, 0x75, 0x0d, 0x97, 0x77, 0x28, 0x97, 0x86, 0x8b, 
-    0x9a, 0x7b, 0x2c, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x23, 0x9b, 
-    0x9b, 0x9c, 0x9c, 0x7b, 0x0e, 0x9c, 0x7b, 0x1b, 0x9c, 0x7d, 0x33, 0x9d, 0x7f, 
-    0x3a, 0x9d, 0x9d, 0xaa, 0x9e, 0x7d, 0x14, 0x9e, 0x81, 0x35, 0x9f, 0x81, 0x3b, 
-    0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x14, 0xa0, 0x84, 0x3c, 0xa1, 0x82, 0x27, 0xa2, 
-    0x7f, 0x7f, 0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1b, 0xa3, 0xa3, 
-    0xa4, 0xa4, 0x83, 0x0f, 0xa4, 0x84, 0x13, 0xa4, 0x87, 0x35, 0xa5, 0x8a, 0x48, 
-    0xa6, 0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x16, 0xa9, 0x8f, 0x51, 0xaa, 
-    0x91, 0x55, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1a, 0xab, 0x9b, 
-    0x67, 0xab, 0xab, 0xab, 0xad, 0x99, 0x28, 0xae, 0x95, 0x5c, 0xae, 0xae, 0xb9, 
-    0xaf, 0x90, 0x17, 0xaf, 0x90, 0x90, 0xaf, 0x96, 0x4f, 0xaf, 0x98, 0x5f, 0xaf, 
-    0x98, 0x61, 0xb2, 0x93, 0x16, 0xb2, 0x9b, 0x64, 0xb3, 0x95, 0x19, 0xb4, 0x9e, 
-    0x6a, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xbd, 0xb6, 0x99, 0x19, 0xb7, 0x99, 0x17, 
-    0xb7, 0xa2, 0x6e, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 0xc2, 0xb9, 0xa7, 0x25, 0xba, 
-    0x9d, 0x1a, 0xba, 0xa3, 0xa4, 0xbb, 0xbb, 0xc4, 0xbc, 0xa8, 0x78, 0xbc, 0xbc, 
-    0xbc, 0xbe, 0xa1, 0x1b, 0xbf, 0xac, 0x80, 0xc1, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 
-    0xc4, 0xaf, 0x60, 0xc4, 0xc4, 0xcb, 0xc5, 0xa9, 0x1d, 0xc7, 0xb7, 0x90, 0xc8, 
-    0xad, 0x21, 0xc9, 0xad, 0x1f, 0xc9, 0xb6, 0xb7, 0xca, 0xb7, 0x2a, 0xcc, 0xb1, 
-    0x1f, 0xcc, 0xb2, 0x34, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 0x21, 
-    0xd1, 0xb6, 0x22, 0xd3, 0xbe, 0x2a, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 
-    0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd7, 0xc7, 0x8a, 0xd8, 0xbf, 0x24, 0xdb, 0xc6, 
-    0x2a, 0xdb, 0xdb, 0xde, 0xdc, 0xc4, 0x26, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x27, 
-    0xe0, 0xcd, 0x61, 0xe1, 0xc9, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 
-    0xcc, 0x29, 0xe6, 0xd1, 0x2b, 0xe6, 0xe6, 0xe9, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 
-    0x2c, 0xeb, 0xe0, 0xa5, 0xeb, 0xeb, 0xed, 0xec, 0xd8, 0x36, 0xee, 0xd8, 0x2d, 
-    0xef, 0xef, 0xf1, 0xf2, 0xdc, 0x2f, 0xf2, 0xed, 0xed, 0xf4, 0xde, 0x30, 0xf4, 
-    0xf4, 0xf5, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf8, 0xe3, 0x3b, 0xf9, 0xf6, 
-    0xf6, 0xfa, 0xe5, 0x32, 0xfe, 0xec, 0x47, 0xfe, 0xed, 0x53, 0xfe, 0xf4, 0x96, 
-    0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x62, 0xff, 
-    0xf0, 0x36, 0xff, 0xf1, 0x68, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x86, 0xff, 0xff, 
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0xff, 0x00, 0xbb, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 
-    0x02, 0x53, 0x41, 0xb3, 0x56, 0xab, 0x9b, 0x34, 0x6a, 0xa9, 0x10, 0x4a, 0x9c, 
-    0x28, 0xf1, 0x57, 0xb5, 0x5d, 0x0f, 0x77, 0x51, 0xdc, 0xc8, 0xb1, 0x9b, 0x2f, 
-    0x6a, 0xcc, 0xa0, 0x51, 0xbb, 0xd4, 0xb1, 0xe4, 0x41, 0x4e, 0x22, 0xa9, 0x51, 
-    0xfb, 0x85, 0xc8, 0x55, 0x2d, 0x57, 0x96, 0x4c, 0x4e, 0xf4, 0x44, 0x8b, 0x56, 
-    0xab, 0x54, 0xad, 0x98, 0xa9, 0x54, 0x89, 0x4c, 0x64, 0x35, 0x6b, 0x32, 0x25, 
-    0xd2, 0xda, 0x09, 0x4d, 0xd8, 0x29, 0x65, 0xc8, 0x90, 0xed, 0x54, 0x06, 0x2d, 
-    0xa8, 0xc4, 0x54, 0x3b, 0xa9, 0x19, 0x63, 0xb6, 0x45, 0xd4, 0xa9, 0x5f, 0x44, 
-    0x85, 0x45, 0x74, 0x6a, 0x10, 0x6b, 0x54, 0x91, 0xc5, 0x7e, 0x7d, 0x54, 0x69, 
-    0xcc, 0x19, 0x35, 0x5a, 0x5c, 0x0b, 0x1a, 0x8b, 0xfa, 0x35, 0xaa, 0xb2, 0x88, 
-    0xd0, 0x40, 0xa5, 0x1d, 0x58, 0x8b, 0xad, 0xca, 0x62, 0xbb, 0xd6, 0x42, 0xc3, 
-    0x5b, 0x0b, 0xd0, 0xdc, 0x82, 0x2e, 0x6b, 0xd1, 0xf2, 0x45, 0xcb, 0x95, 0xd2, 
-    0x5d, 0xd4, 0x94, 0x15, 0xf3, 0x95, 0xca, 0xd5, 0x5f, 0x84, 0xbf, 0x90, 0xd1, 
-    0xa4, 0xe6, 0x8a, 0x94, 0xae, 0x4b, 0x6f, 0x35, 0x3e, 0x36, 0x68, 0xc9, 0x99, 
-    0x30, 0x3c, 0xcc, 0x48, 0x09, 0x14, 0xc6, 0x4a, 0x99, 0xa7, 0xcd, 0x06, 0x45, 
-    0x09, 0xa3, 0xe6, 0xab, 0xd8, 0xad, 0x46, 0x58, 0x7f, 0x71, 0x42, 0x7d, 0x90, 
-    0xd4, 0xae, 0x5a, 0xca, 0x98, 0x29, 0xa5, 0x76, 0x4b, 0x34, 0xed, 0x83, 0x80, 
-    0x54, 0xb2, 0xbc, 0xf3, 0x7b, 0xc7, 0x8f, 0x83, 0x83, 0x76, 0x4a, 0x7e, 0x1c, 
-    0xe4, 0x53, 0x2c, 0x62, 0xcd, 0x9a, 0x1d, 0xb3, 0x15, 0xaa, 0x08, 0x41, 0x65, 
-    0x3b, 0x7f, 0xa5, 0xaa, 0x95, 0xeb, 0xb4, 0xcc, 0x20, 0xa1, 0x96, 0x71, 0xff, 
-    0x1b, 0x4f, 0x7e, 0x7c, 0xb3, 0x55, 0x52, 0x04, 0xb6, 0x4a, 0x99, 0xab, 0xdb, 
-    0x25, 0x61, 0xd0, 0x1a, 0x96, 0x94, 0x03, 0xac, 0xbc, 0x7d, 0xf2, 0xaf, 0x1a, 
-    0x74, 0x13, 0x45, 0x0b, 0x16, 0x2d, 0x61, 0xa2, 0x45, 0x82, 0xdd, 0x2d, 0x1d, 
-    0xf9, 0x21, 0xde, 0x7d, 0xf7, 0xc9, 0x00, 0x80, 0x02, 0x91, 0xfc, 0x02, 0x08, 
-    0x80, 0xbe, 0x08, 0x34, 0x14, 0x34, 0x88, 0x6c, 0x64, 0xc5, 0x31, 0x08, 0xde, 
-    0xd7, 0x0b, 0x00, 0x1c, 0x16, 0x60, 0x49, 0x1e, 0xd0, 0x18, 0x82, 0xcc, 0x40, 
-    0x86, 0x44, 0xc2, 0xd1, 0x2b, 0x19, 0xde, 0xb7, 0x09, 0x87, 0x1c, 0x2a, 0x10, 
-    0x05, 0x33, 0x88, 0xb4, 0x67, 0x52, 0x11, 0x07, 0xa6, 0x48, 0xde, 0x18, 0x2c, 
-    0x72, 0x68, 0x80, 0x28, 0x4e, 0xe9, 0x61, 0xa3, 0x7d, 0x3e, 0xe4, 0xc8, 0xa1, 
-    0x7e, 0x41, 0x65, 0xf2, 0x63, 0x79, 0x26, 0x08, 0x09, 0xc0, 0x00, 0x4e, 0xa9, 
-    0x42, 0x1e, 0x31, 0xb8, 0xd8, 0x28, 0x81, 0x92, 0x00, 0x10, 0x69, 0x52, 0x2c, 
-    0xe3, 0xbd, 0xd2, 0x4b, 0x28, 0xb6, 0x34, 0x93, 0x61, 0x03, 0x54, 0x32, 0x29, 
-    0xd3, 0x31, 0xb8, 0x6c, 0x82, 0x21, 0x37, 0xc0, 0xa8, 0xf2, 0x49, 0x28, 0xaa, 
-    0x60, 0x49, 0x1e, 0x98, 0x54, 0x26, 0x60, 0x12, 0x25, 0xaf, 0xc4, 0xe2, 0xa5, 
-    0x78, 0xbd, 0x10, 0x83, 0xe6, 0x31, 0xd2, 0x91, 0x37, 0x65, 0x9c, 0x25, 0x5d, 
-    0xd8, 0x4c, 0x2f, 0xdc, 0xa8, 0x22, 0x03, 0x37, 0x44, 0xe4, 0x30, 0x5e, 0x9e, 
-    0xe5, 0x81, 0x40, 0x25, 0x00, 0x06, 0x74, 0x04, 0x09, 0x86, 0x51, 0x72, 0xf3, 
-    0x08, 0x06, 0xdc, 0x08, 0x42, 0xc0, 0x99, 0xab, 0xe8, 0x39, 0x5e, 0x90, 0x8f, 
-    0x6e, 0xa4, 0x87, 0x2d, 0xe3, 0x01, 0x83, 0x8b, 0x9e, 0xb8, 0x84, 0xc2, 0xcd, 
-    0x32, 0x94, 0x78, 0xc9, 0xcd, 0x2b, 0xa4, 0x8e, 0xff, 0x87, 0x63, 0xa8, 0x12, 
-    0x49, 0x81, 0x62, 0x79, 0xd0, 0x65, 0xc8, 0x67, 0x8d, 0x2b, 0xd2, 0x7a, 0x90, 
-    0x1f, 0x67, 0x1e, 0x99, 0x21, 0x2e, 0x8f, 0x02, 0x80, 0x10, 0x24, 0xae, 0x0a, 
-    0x9b, 0x61, 0x33, 0x14, 0xf8, 0x4a, 0x90, 0x1c, 0xc9, 0x2a, 0x9b, 0x21, 0x1d, 
-    0x54, 0x12, 0x70, 0x50, 0xac, 0xd2, 0xa6, 0x48, 0xac, 0x92, 0x91, 0x16, 0x24, 
-    0x45, 0xb6, 0x08, 0x36, 0x03, 0xcc, 0x99, 0xa0, 0xe6, 0x68, 0xe5, 0x40, 0x46, 
-    0x96, 0xf7, 0xca, 0x18, 0x3e, 0xf8, 0x30, 0x46, 0x8d, 0x08, 0x1e, 0x43, 0xc7, 
-    0x09, 0x23, 0x78, 0xf0, 0x09, 0x37, 0x7e, 0x04, 0x90, 0xa3, 0x9c, 0x06, 0xad, 
-    0x52, 0x9e, 0x20, 0x42, 0x3e, 0x92, 0xe2, 0x32, 0x32, 0x94, 0xe0, 0x01, 0x11, 
-    0x94, 0x60, 0x68, 0xc5, 0x9f, 0x00, 0xf0, 0xdb, 0x6f, 0x79, 0xcd, 0xe6, 0xb8, 
-    0x49, 0x8a, 0x85, 0x8c, 0x50, 0x45, 0x7d, 0xe6, 0xc5, 0xd0, 0xcd, 0x03, 0x04, 
-    0x38, 0xfc, 0x30, 0x79, 0x9f, 0x98, 0x40, 0x41, 0x0e, 0x74, 0xdc, 0x8a, 0xa0, 
-    0x2d, 0xdd, 0xa4, 0x4b, 0xde, 0x32, 0x1d, 0xf9, 0x0b, 0x6e, 0x33, 0x60, 0x14, 
-    0x42, 0x0c, 0xbc, 0xcd, 0x1c, 0xb7, 0x51, 0x21, 0xe0, 0x72, 0x13, 0x0a, 0x0e, 
-    0x41, 0x74, 0x53, 0x04, 0xb6, 0xc4, 0x5c, 0x21, 0x04, 0x47, 0x18, 0x2b, 0xdb, 
-    0x4b, 0x41, 0x7e, 0x70, 0xc3, 0xcb, 0x21, 0x50, 0x2c, 0x61, 0x04, 0x47, 0x85, 
-    0x44, 0x6b, 0xe3, 0x31, 0x60, 0x14, 0x74, 0x04, 0x1c, 0x4d, 0x1f, 0x61, 0x4a, 
-    0x21, 0x1d, 0xb5, 0x7a, 0xa4, 0x2d, 0x55, 0x17, 0xb4, 0x44, 0x12, 0x57, 0xc8, 
-    0xe2, 0x25, 0x31, 0x25, 0xa1, 0x61, 0x67, 0xbc, 0xaf, 0xe8, 0x81, 0xd0, 0x11, 
-    0xbc, 0xd8, 0xf7, 0x89, 0x49, 0x3f, 0x14, 0xc2, 0xe6, 0x2a, 0xa1, 0x64, 0x62, 
-    0x05, 0x0e, 0x13, 0xa9, 0x2d, 0x4c, 0x1e, 0x30, 0x17, 0xfc, 0x66, 0x90, 0xa7, 
-    0xe5, 0xc5, 0xb2, 0x80, 0xe0, 0x04, 0xa9, 0x3a, 0x5e, 0xb0, 0xaf, 0x00, 0x60, 
-    0x01, 0xe2, 0xdd, 0x40, 0x4b, 0x1e, 0xb6, 0xc4, 0x1e, 0x2e, 0x78, 0x11, 0x84, 
-    0x73, 0xe3, 0x26, 0x37, 0xc7, 0x08, 0xe0, 0x38, 0x42, 0x01, 0x01, 0x00, 0x21, 
-    0xf9, 0x04, 0x09, 0x03, 0x00, 0x9f, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x2b, 
-    0x00, 0x36, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x13, 0x13, 0x13, 0x17, 0x17, 0x18, 
-    0x1d, 0x1c, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x30, 0x2f, 0x30, 0x32, 
-    0x32, 0x33, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x43, 0x43, 
-    0x43, 0x46, 0x25, 0x20, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4f, 0x4e, 0x5b, 
-    0x54, 0x35, 0x32, 0x54, 0x54, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x57, 
-    0x57, 0x6d, 0x58, 0x57, 0x58, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 
-    0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x61, 0x61, 0x76, 0x62, 0x61, 0x6e, 
-    0x63, 0x45, 0x41, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x69, 0x54, 0x58, 0x69, 
-    0x69, 0x7d, 0x6a, 0x69, 0x76, 0x6b, 0x6b, 0x6c, 0x6c, 0x50, 0x4d, 0x6d, 0x29, 
-    0x2a, 0x6e, 0x4c, 0x51, 0x6e, 0x6e, 0x81, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 0x7b, 
-    0x72, 0x72, 0x85, 0x73, 0x73, 0x75, 0x76, 0x76, 0x89, 0x77, 0x36, 0x36, 0x77, 
-    0x3d, 0x3d, 0x78, 0x77, 0x8a, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8d, 0x7c, 0x46, 
-    0x46, 0x7f, 0x4a, 0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4f, 0x4f, 0x83, 0x83, 0x84, 
-    0x83, 0x83, 0x93, 0x84, 0x83, 0x8f, 0x85, 0x54, 0x55, 0x88, 0x88, 0x97, 0x89, 
-    0x87, 0x91, 0x8a, 0x5c, 0x5c, 0x8a, 0x68, 0x16, 0x8b, 0x8b, 0x9a, 0x8c, 0x69, 
-    0x0c, 0x8d, 0x6b, 0x14, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x91, 0x8b, 0x93, 
-    0x93, 0x69, 0x69, 0x94, 0x94, 0xa2, 0x96, 0x75, 0x25, 0x96, 0x76, 0x2a, 0x97, 
-    0x78, 0x28, 0x98, 0x77, 0x20, 0x99, 0x74, 0x73, 0x99, 0x99, 0xa6, 0x9a, 0x7b, 
-    0x2c, 0x9a, 0x91, 0x7a, 0x9b, 0x7b, 0x1c, 0x9b, 0x7b, 0x24, 0x9c, 0x7d, 0x33, 
-    0x9d, 0x7f, 0x3a, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x35, 0x9f, 
-    0x7e, 0x15, 0x9f, 0x80, 0x2a, 0x9f, 0x81, 0x3b, 0xa0, 0x7f, 0x14, 0xa0, 0x84, 
-    0x3c, 0xa1, 0x83, 0x2a, 0xa1, 0x83, 0x34, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 
-    0xa2, 0x83, 0x25, 0xa2, 0x86, 0x43, 0xa3, 0x84, 0x1d, 0xa4, 0x84, 0x16, 0xa4, 
-    0x88, 0x46, 0xa5, 0x8a, 0x47, 0xa6, 0x83, 0x83, 0xa6, 0x8b, 0x4b, 0xa7, 0xa7, 
-    0xb2, 0xa8, 0x89, 0x1c, 0xa8, 0x8b, 0x38, 0xa8, 0x8e, 0x4e, 0xa9, 0x8f, 0x51, 
-    0xaa, 0x91, 0x55, 0xab, 0x8f, 0x35, 0xab, 0x91, 0x4d, 0xad, 0xad, 0xb8, 0xae, 
-    0x95, 0x5c, 0xaf, 0x97, 0x60, 0xaf, 0x98, 0x5f, 0xb0, 0x98, 0x5f, 0xb2, 0x9a, 
-    0x64, 0xb3, 0x9a, 0x49, 0xb4, 0x9e, 0x6a, 0xb4, 0xb4, 0xbe, 0xb5, 0x9a, 0x35, 
-    0xb7, 0xa1, 0x6e, 0xb9, 0x9d, 0x26, 0xb9, 0xa4, 0x6d, 0xba, 0xa5, 0x74, 0xba, 
-    0xa5, 0x75, 0xbb, 0xa4, 0x53, 0xbe, 0xaa, 0x7c, 0xc0, 0xa5, 0x31, 0xc0, 0xad, 
-    0x7f, 0xc2, 0xab, 0x5b, 0xc3, 0xb2, 0x89, 0xca, 0xba, 0x94, 0xcb, 0xb4, 0x47, 
-    0xcb, 0xbc, 0x99, 0xd1, 0xc5, 0xa4, 0xd5, 0xc5, 0x85, 0xd7, 0xbf, 0x36, 0xd7, 
-    0xc1, 0x45, 0xd9, 0xcb, 0x94, 0xda, 0xc6, 0x5b, 0xe0, 0xcf, 0x71, 0xed, 0xde, 
-    0x73, 0xef, 0xda, 0x3c, 0xf0, 0xe6, 0xa9, 0xf6, 0xe1, 0x38, 0xf8, 0xe6, 0x55, 
-    0xfe, 0xed, 0x4c, 0xff, 0xec, 0x3d, 0xff, 0xed, 0x44, 0xff, 0xee, 0x53, 0xff, 
-    0xef, 0x5d, 0xff, 0xef, 0x62, 0xff, 0xf0, 0x65, 0xff, 0xf2, 0x6c, 0xff, 0xf2, 
-    0x74, 0xff, 0xf2, 0x7a, 0xff, 0xf3, 0x83, 0xff, 0xf4, 0x8a, 0xff, 0xf5, 0xa2, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe4, 0x00, 0x3f, 0x09, 0x1c, 0x48, 0xb0, 
-    0xa0, 0xc1, 0x83, 0x02, 0x09, 0x7d, 0xba, 0x24, 0xb0, 0xd2, 0x27, 0x85, 0x08, 
-    0x23, 0x4a, 0x8c, 0x38, 0xe9, 0x93, 0xc3, 0x89, 0x18, 0x33, 0x1e, 0xcc, 0xa3, 
-    0xb1, 0xe3, 0xc1, 0x3f, 0x11, 0xfb, 0x78, 0x94, 0x08, 0x12, 0x63, 0xc5, 0x91, 
-    0x11, 0x11, 0x65, 0x8c, 0x84, 0x52, 0xa3, 0x23, 0x89, 0x10, 0x5b, 0xca, 0x9c, 
-    0x49, 0x53, 0x60, 0x24, 0x91, 0x35, 0x3d, 0xb2, 0xc9, 0x69, 0x50, 0x25, 0xcf, 
-    0x96, 0x7f, 0x7c, 0x0a, 0xe4, 0xf8, 0xf3, 0x20, 0xce, 0x31, 0x1f, 0x8b, 0x12, 
-    0x2c, 0x99, 0x54, 0xa9, 0x53, 0x99, 0x3b, 0x9f, 0x4e, 0x8c, 0x2a, 0x10, 0x27, 
-    0xcd, 0x1b, 0x08, 0xb1, 0x4e, 0x64, 0xda, 0x51, 0x6b, 0x4b, 0xa2, 0x89, 0xa4, 
-    0x16, 0x14, 0x7a, 0x47, 0xec, 0x40, 0x8e, 0x54, 0x05, 0x86, 0xfd, 0x44, 0xc7, 
-    0xec, 0xc0, 0x97, 0x02, 0xd9, 0x94, 0x15, 0x3b, 0x60, 0xa6, 0x57, 0x94, 0x02, 
-    0xdc, 0xea, 0x95, 0x78, 0x61, 0xaf, 0x41, 0x04, 0x7e, 0x03, 0x0b, 0x16, 0xbc, 
-    0xa4, 0xe0, 0x88, 0x89, 0x15, 0xcc, 0x06, 0x18, 0xcc, 0x58, 0xac, 0x9b, 0xc6, 
-    0x8c, 0xb9, 0xb8, 0xcd, 0xcb, 0x98, 0xb2, 0x59, 0x1b, 0x33, 0x31, 0x6b, 0xcc, 
-    0x00, 0x59, 0xf3, 0xde, 0xc7, 0x08, 0x0f, 0x04, 0x20, 0xd0, 0xb1, 0x2f, 0x64, 
-    0x8c, 0x85, 0x67, 0x82, 0x96, 0x79, 0xf7, 0x93, 0x92, 0xd3, 0x19, 0x57, 0xb7, 
-    0xe4, 0xd1, 0x85, 0xa0, 0x6c, 0xd8, 0x33, 0xcd, 0x20, 0xe4, 0xf1, 0x34, 0xf5, 
-    0x48, 0x07, 0xb8, 0x07, 0x37, 0x08, 0xfe, 0xb3, 0xf5, 0x41, 0x05, 0x08, 0x03, 
-    0x02, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0xde, 0x00, 0x2c, 0x04, 0x00, 
-    0x00, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x87, 0x00, 0x00, 0x00, 0x09, 0x08, 0x03, 
-    0x0c, 0x0b, 0x0c, 0x0e, 0x0e, 0x11, 0x14, 0x14, 0x14, 0x17, 0x15, 0x05, 0x17, 
-    0x16, 0x1a, 0x1b, 0x1b, 0x1c, 0x1e, 0x1e, 0x25, 0x22, 0x22, 0x23, 0x24, 0x23, 
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x2d, 0x38, 0x33, 0x33, 0x33, 0x36, 0x30, 0x0b, 
-    0x3a, 0x39, 0x3b, 0x3a, 0x39, 0x43, 0x43, 0x43, 0x43, 0x47, 0x27, 0x24, 0x47, 
-    0x3f, 0x50, 0x4b, 0x45, 0x0f, 0x4c, 0x2a, 0x1b, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 
-    0x4d, 0x4d, 0x3e, 0x4c, 0x4e, 0x4c, 0x63, 0x51, 0x3a, 0x43, 0x54, 0x54, 0x54, 
-    0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x56, 0x55, 0x5b, 0x56, 0x56, 0x6d, 0x57, 
-    0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 
-    0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 
-    0x62, 0x5f, 0x61, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x65, 0x65, 0x7a, 0x69, 
-    0x3f, 0x44, 0x69, 0x6a, 0x7d, 0x6a, 0x56, 0x22, 0x6b, 0x55, 0x0e, 0x6c, 0x6c, 
-    0x6c, 0x6d, 0x27, 0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 
-    0x71, 0x66, 0x17, 0x72, 0x4b, 0x4c, 0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x76, 
-    0x38, 0x38, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x7b, 0x7b, 
-    0x8d, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x82, 0x4e, 0x4e, 
-    0x82, 0x5d, 0x08, 0x83, 0x83, 0x86, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x87, 
-    0x57, 0x57, 0x89, 0x65, 0x08, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8b, 0x2f, 
-    0x30, 0x8b, 0x6b, 0x18, 0x8b, 0x78, 0x19, 0x8b, 0x8c, 0x9b, 0x8c, 0x8c, 0x8c, 
-    0x8d, 0x6a, 0x0b, 0x8d, 0x6d, 0x28, 0x8e, 0x30, 0x31, 0x90, 0x90, 0x9e, 0x91, 
-    0x66, 0x66, 0x91, 0x6e, 0x0c, 0x93, 0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 0x94, 
-    0xa2, 0x95, 0x72, 0x0b, 0x95, 0x75, 0x24, 0x95, 0x89, 0x8d, 0x96, 0x75, 0x18, 
-    0x97, 0x77, 0x29, 0x99, 0x76, 0x0c, 0x9a, 0x7a, 0x23, 0x9a, 0x7b, 0x2c, 0x9a, 
-    0x7d, 0x3a, 0x9a, 0x88, 0x1e, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x74, 
-    0x74, 0x9b, 0x7d, 0x34, 0x9b, 0x9b, 0x9c, 0x9c, 0x7a, 0x0e, 0x9c, 0x7b, 0x15, 
-    0x9c, 0x7c, 0x1b, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x35, 0x9e, 0x81, 0x3b, 0x9f, 
-    0x88, 0x27, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x12, 0xa1, 0x80, 0x0f, 0xa1, 0x84, 
-    0x3d, 0xa2, 0x7f, 0x7f, 0xa2, 0x83, 0x27, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 
-    0xa3, 0x88, 0x46, 0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x13, 0xa4, 0x84, 0x1a, 0xa4, 
-    0x87, 0x37, 0xa6, 0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x1a, 0xa8, 0x8e, 
-    0x4e, 0xa8, 0x8e, 0x51, 0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x92, 0x55, 
-    0xab, 0xab, 0xab, 0xac, 0x8c, 0x1a, 0xac, 0x96, 0x2a, 0xad, 0x95, 0x5b, 0xad, 
-    0x98, 0x6b, 0xae, 0x90, 0x19, 0xae, 0x92, 0x8f, 0xae, 0xae, 0xb9, 0xb1, 0x98, 
-    0x59, 0xb2, 0x93, 0x16, 0xb2, 0x9b, 0x64, 0xb3, 0x94, 0x18, 0xb4, 0x9e, 0x6a, 
-    0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xbd, 0xb6, 0x99, 0x17, 0xb6, 0x99, 0x19, 0xb7, 
-    0xa1, 0x6d, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 0xc2, 0xba, 0x9d, 0x19, 0xba, 0xa3, 
-    0xa4, 0xba, 0xa5, 0x75, 0xba, 0xa6, 0x2d, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 
-    0xbe, 0xa1, 0x1b, 0xbf, 0xac, 0x80, 0xc2, 0xa5, 0x1c, 0xc3, 0xaf, 0x70, 0xc3, 
-    0xc3, 0xc4, 0xc4, 0xb3, 0x8c, 0xc4, 0xc4, 0xcb, 0xc5, 0xaa, 0x1d, 0xc5, 0xb3, 
-    0x8b, 0xc7, 0xb7, 0x28, 0xc8, 0xac, 0x22, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 
-    0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 0x21, 0xd1, 
-    0xb6, 0x23, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 
-    0xc7, 0xd8, 0xbf, 0x24, 0xdb, 0xdb, 0xde, 0xdc, 0xc3, 0x26, 0xdc, 0xc6, 0x29, 
-    0xdc, 0xcb, 0x70, 0xde, 0xde, 0xe2, 0xe0, 0xc8, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 
-    0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xd1, 0x2c, 0xe6, 0xe6, 0xe9, 0xe7, 0xd4, 
-    0x58, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xed, 0xd9, 0x33, 
-    0xef, 0xd8, 0x2d, 0xef, 0xef, 0xf1, 0xf2, 0xdc, 0x2f, 0xf2, 0xdd, 0x39, 0xf2, 
-    0xed, 0xed, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 0xf6, 0xe2, 0x31, 0xf7, 0xe1, 
-    0x2f, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf6, 0xfa, 0xe5, 0x32, 0xfb, 0xf1, 0xa3, 
-    0xfc, 0xed, 0x6a, 0xfc, 0xf2, 0x98, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 
-    0xed, 0x47, 0xff, 0xef, 0x56, 0xff, 0xf0, 0x59, 0xff, 0xf0, 0x65, 0xff, 0xf1, 
-    0x6d, 0xff, 0xf2, 0x78, 0xff, 0xf4, 0x89, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xbd, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x02, 0x69, 0x59, 0xb3, 0x46, 0xc9, 0x5b, 
-    0x35, 0x62, 0x08, 0x23, 0x4a, 0x94, 0x08, 0xad, 0x1a, 0xad, 0x6a, 0xd4, 0x50, 
-    0x4d, 0xdc, 0xc8, 0xf1, 0x0f, 0x34, 0x6a, 0xcc, 0xa8, 0xf9, 0xe2, 0x48, 0x52, 
-    0xe2, 0x2d, 0x6a, 0x28, 0xa9, 0xbd, 0x7a, 0x75, 0xab, 0xd7, 0xad, 0x92, 0x1b, 
-    0x69, 0xe9, 0xba, 0x75, 0xcb, 0x95, 0xaf, 0x94, 0x28, 0x43, 0x52, 0xb3, 0x06, 
-    0x53, 0x22, 0x26, 0x62, 0x29, 0x8b, 0x1d, 0xdb, 0xe4, 0x8b, 0xd8, 0x47, 0x94, 
-    0xc2, 0x90, 0xf5, 0x94, 0xd8, 0x0b, 0xa7, 0x30, 0x5f, 0xaf, 0x9a, 0x1c, 0xbb, 
-    0x99, 0x92, 0x98, 0xab, 0xa5, 0x07, 0x29, 0x1d, 0xc5, 0x49, 0x8d, 0x98, 0xaf, 
-    0x62, 0x29, 0x7d, 0x7d, 0x7c, 0x85, 0xb5, 0xe0, 0x26, 0xae, 0x68, 0x71, 0x92, 
-    0x05, 0x56, 0xb6, 0x60, 0x53, 0xae, 0xd0, 0x66, 0x86, 0x64, 0x26, 0x96, 0x6d, 
-    0x5b, 0x83, 0xae, 0x68, 0xbd, 0x8a, 0xb5, 0x6a, 0x25, 0x35, 0x68, 0x37, 0x7d, 
-    0x21, 0xc3, 0xf4, 0xf2, 0xee, 0x46, 0x5f, 0xcc, 0xfe, 0xa0, 0x02, 0x76, 0xca, 
-    0x30, 0x49, 0x54, 0xca, 0x1c, 0xf7, 0xa4, 0x44, 0x2d, 0x95, 0xe4, 0x92, 0xab, 
-    0xa8, 0x09, 0xbb, 0x1c, 0xd3, 0x97, 0x2d, 0x94, 0xba, 0x38, 0x0f, 0xe4, 0xe1, 
-    0x83, 0x20, 0x25, 0x57, 0xab, 0x68, 0xfd, 0xa5, 0xa6, 0x2b, 0xef, 0xc8, 0xb6, 
-    0x45, 0x44, 0xc9, 0x1a, 0xe6, 0xcc, 0x99, 0xb1, 0x5a, 0xa4, 0x8a, 0x6c, 0xd2, 
-    0xd5, 0x0b, 0x95, 0x48, 0x6a, 0xbd, 0xfa, 0xd2, 0xf2, 0x15, 0x6b, 0x69, 0x11, 
-    0x52, 0xcb, 0xba, 0x29, 0x5f, 0xae, 0xdc, 0x59, 0xab, 0x29, 0xde, 0x7a, 0xc9, 
-    0x14, 0x26, 0x4c, 0x99, 0xae, 0x55, 0xba, 0x80, 0xc3, 0xb4, 0xf3, 0x8b, 0xb9, 
-    0xf7, 0xe5, 0xb0, 0x28, 0xd0, 0xff, 0x1a, 0x7f, 0xcc, 0x93, 0x2e, 0x5f, 0xc2, 
-    0x5e, 0x1d, 0x63, 0x4d, 0x32, 0x50, 0xf2, 0xef, 0xdf, 0x63, 0x00, 0x70, 0xb0, 
-    0x89, 0x16, 0x76, 0x5f, 0xa5, 0x04, 0xc6, 0xf2, 0x15, 0x7a, 0x23, 0x16, 0x63, 
-    0xf0, 0x7d, 0xc7, 0x0b, 0x00, 0x04, 0x16, 0x60, 0x83, 0x2d, 0x2c, 0x15, 0x06, 
-    0x13, 0x2c, 0x01, 0x7e, 0xd7, 0x09, 0x81, 0x04, 0x0a, 0x40, 0x14, 0x28, 0x64, 
-    0xc1, 0x54, 0xc4, 0x7b, 0x0d, 0x2e, 0x77, 0x06, 0x84, 0x04, 0x4a, 0x60, 0x08, 
-    0x56, 0x7d, 0x64, 0xe8, 0xdd, 0x0f, 0x1c, 0x12, 0xb8, 0x00, 0x56, 0x9c, 0x88, 
-    0xc8, 0x1c, 0x09, 0x25, 0x02, 0x30, 0x00, 0x56, 0xac, 0x2c, 0x37, 0x4c, 0x2e, 
-    0x19, 0x3e, 0xd0, 0x22, 0x00, 0x27, 0xf6, 0x24, 0x8b, 0x72, 0xb0, 0xf0, 0x42, 
-    0x4a, 0x2d, 0xce, 0x04, 0xb8, 0xc0, 0x8d, 0x2f, 0xf6, 0x64, 0x4c, 0x2e, 0x9d, 
-    0x00, 0xd8, 0xcd, 0x2f, 0xac, 0x88, 0x42, 0x0a, 0x2b, 0x3b, 0x2e, 0x37, 0xe4, 
-    0x8d, 0x09, 0xc0, 0x64, 0x09, 0x2c, 0xb2, 0x04, 0x99, 0x1c, 0x2f, 0xc3, 0x74, 
-    0x33, 0x8c, 0x31, 0xb6, 0x2d, 0x67, 0x23, 0x95, 0x25, 0xfd, 0xe7, 0x0c, 0x2f, 
-    0xdd, 0xb0, 0x12, 0x43, 0x37, 0x44, 0xe4, 0xa0, 0x1c, 0x97, 0xcc, 0x79, 0x70, 
-    0x23, 0x00, 0x07, 0x90, 0x24, 0x09, 0x80, 0x34, 0x76, 0x13, 0xc9, 0x05, 0xdd, 
-    0x10, 0x42, 0x80, 0x92, 0xad, 0x74, 0xa9, 0xdc, 0x0e, 0x73, 0x06, 0xb0, 0x51, 
-    0x1f, 0xb5, 0x28, 0xf7, 0x4b, 0x2e, 0x5d, 0xe6, 0x42, 0x4a, 0x37, 0xcb, 0x58, 
-    0x12, 0x64, 0x37, 0xb0, 0x24, 0xaa, 0xdc, 0x86, 0x73, 0x4a, 0x34, 0x05, 0x83, 
-    0xcc, 0xd1, 0x16, 0x20, 0x98, 0x18, 0x3e, 0x98, 0x29, 0x42, 0x81, 0x28, 0xa9, 
-    0x62, 0x80, 0xb9, 0xcc, 0x09, 0x00, 0x42, 0x92, 0x4c, 0x7a, 0x6a, 0x80, 0xce, 
-    0x44, 0xff, 0x30, 0x6a, 0x41, 0x76, 0xb8, 0xfa, 0x6a, 0x80, 0x78, 0xdc, 0x48, 
-    0xc0, 0x41, 0x96, 0xde, 0xda, 0x60, 0xaa, 0x2d, 0xd6, 0x59, 0xd0, 0x14, 0xbe, 
-    0xc2, 0xe7, 0xcc, 0x2f, 0x4a, 0x92, 0x58, 0x62, 0x8e, 0x04, 0xa5, 0xc8, 0x1c, 
-    0x2c, 0x67, 0xfc, 0xf0, 0x03, 0x1e, 0xa6, 0xc2, 0x67, 0x0c, 0x1e, 0x25, 0x84, 
-    0xc0, 0x81, 0x28, 0xdd, 0x04, 0x12, 0x00, 0x87, 0x55, 0x1a, 0xd4, 0x0a, 0x73, 
-    0x84, 0x94, 0x18, 0x49, 0x83, 0xcb, 0xc4, 0x30, 0x02, 0x07, 0x44, 0x58, 0x02, 
-    0x20, 0x16, 0x63, 0x02, 0x10, 0xae, 0xb8, 0xcc, 0xc9, 0xca, 0x61, 0x27, 0x0d, 
-    0x2e, 0x12, 0xc2, 0x15, 0xdd, 0x35, 0x47, 0x83, 0x37, 0x0d, 0x10, 0x30, 0x2f, 
-    0xbd, 0xcb, 0x89, 0x42, 0x42, 0x04, 0x39, 0xe0, 0xc1, 0x29, 0x7c, 0xb5, 0x78, 
-    0xe3, 0xec, 0x72, 0xcb, 0x90, 0x34, 0x6e, 0xb1, 0xce, 0x60, 0xb1, 0xc8, 0x30, 
-    0x18, 0x76, 0xe3, 0x4c, 0x69, 0x1b, 0x2d, 0x52, 0x6c, 0x37, 0xa4, 0xe0, 0x50, 
-    0x84, 0x37, 0x45, 0xf4, 0x3a, 0x4c, 0x19, 0x42, 0x70, 0xd4, 0xef, 0xab, 0xbc, 
-    0x14, 0x14, 0x48, 0x37, 0xbb, 0x28, 0x22, 0xc5, 0x12, 0x46, 0x70, 0x14, 0x88, 
-    0xad, 0x19, 0x1a, 0x33, 0x46, 0x41, 0x47, 0xcc, 0x31, 0xf3, 0x11, 0xaa, 0x04, 
-    0x62, 0x27, 0xce, 0x0c, 0xef, 0x5c, 0xd0, 0x12, 0x4a, 0x94, 0x31, 0x4b, 0x90, 
-    0xc3, 0x94, 0xb4, 0x46, 0x96, 0xd6, 0xc2, 0xd2, 0x07, 0x42, 0x47, 0xec, 0xe2, 
-    0x1d, 0x29, 0x30, 0xf9, 0xb0, 0xc8, 0x93, 0xad, 0x90, 0xc2, 0xc9, 0x18, 0x3c, 
-    0x48, 0xf4, 0xf0, 0x72, 0xbf, 0x58, 0x20, 0x9a, 0x41, 0x82, 0x32, 0x27, 0x8b, 
-    0x02, 0x67, 0x13, 0xf4, 0xa8, 0x72, 0xa6, 0xc2, 0x02, 0xc0, 0x04, 0x6d, 0x7b, 
-    0x53, 0xeb, 0x72, 0xbd, 0xa6, 0xca, 0xf6, 0xd9, 0x45, 0xa4, 0x0b, 0xdd, 0x4d, 
-    0x94, 0xdd, 0x18, 0x23, 0xc0, 0xdc, 0x08, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 
-    0x09, 0x03, 0x00, 0xdc, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x36, 
-    0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x04, 0x0b, 0x0b, 0x0c, 0x0e, 0x0e, 
-    0x11, 0x14, 0x14, 0x14, 0x17, 0x15, 0x06, 0x17, 0x16, 0x1a, 0x1c, 0x1c, 0x1c, 
-    0x1f, 0x1d, 0x1f, 0x22, 0x22, 0x23, 0x24, 0x23, 0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 
-    0x2d, 0x38, 0x33, 0x33, 0x33, 0x36, 0x30, 0x0b, 0x3a, 0x39, 0x3b, 0x3a, 0x39, 
-    0x43, 0x43, 0x43, 0x43, 0x47, 0x27, 0x24, 0x47, 0x3f, 0x50, 0x4b, 0x45, 0x0f, 
-    0x4c, 0x2a, 0x1b, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 0x4d, 0x4d, 0x3e, 0x4c, 0x4e, 
-    0x4c, 0x63, 0x51, 0x3a, 0x43, 0x54, 0x54, 0x54, 0x55, 0x34, 0x36, 0x55, 0x3b, 
-    0x46, 0x56, 0x56, 0x6d, 0x57, 0x55, 0x59, 0x58, 0x2d, 0x2a, 0x59, 0x57, 0x65, 
-    0x59, 0x59, 0x6f, 0x5a, 0x29, 0x22, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4d, 0x5c, 
-    0x5c, 0x72, 0x60, 0x5e, 0x6b, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x50, 
-    0x22, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x65, 0x65, 0x7a, 0x68, 0x59, 0x12, 
-    0x69, 0x3f, 0x44, 0x69, 0x6a, 0x7d, 0x6c, 0x6c, 0x6c, 0x6d, 0x27, 0x27, 0x6d, 
-    0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x70, 0x83, 0x71, 0x67, 0x17, 0x72, 0x4b, 
-    0x4c, 0x72, 0x52, 0x08, 0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x76, 0x38, 0x38, 
-    0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x79, 0x77, 0x7a, 0x7a, 0x7a, 0x86, 0x7b, 
-    0x71, 0x49, 0x7b, 0x7b, 0x8d, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 
-    0x4e, 0x83, 0x5d, 0x06, 0x83, 0x83, 0x86, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 
-    0x87, 0x57, 0x57, 0x8a, 0x2e, 0x2e, 0x8a, 0x66, 0x0a, 0x8a, 0x6f, 0x18, 0x8a, 
-    0x89, 0x95, 0x8b, 0x2f, 0x30, 0x8b, 0x8c, 0x9b, 0x8c, 0x8c, 0x8c, 0x8d, 0x6d, 
-    0x28, 0x8e, 0x30, 0x31, 0x90, 0x90, 0x9e, 0x91, 0x66, 0x66, 0x91, 0x6e, 0x0b, 
-    0x93, 0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x89, 0x8d, 0x96, 
-    0x74, 0x18, 0x96, 0x76, 0x26, 0x97, 0x74, 0x0c, 0x9a, 0x7b, 0x23, 0x9a, 0x7b, 
-    0x2c, 0x9a, 0x7d, 0x3a, 0x9a, 0x87, 0x1c, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 
-    0x9b, 0x74, 0x74, 0x9b, 0x7d, 0x33, 0x9b, 0x9b, 0x9c, 0x9c, 0x7b, 0x0e, 0x9c, 
-    0x7b, 0x15, 0x9c, 0x7c, 0x1c, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x35, 0x9e, 0x81, 
-    0x3b, 0x9e, 0x91, 0x20, 0x9f, 0x80, 0x2c, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x10, 
-    0xa1, 0x84, 0x3c, 0xa2, 0x7f, 0x7f, 0xa2, 0x81, 0x0f, 0xa2, 0x84, 0x27, 0xa2, 
-    0x86, 0x43, 0xa2, 0xa2, 0xae, 0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x14, 0xa4, 0x84, 
-    0x1a, 0xa4, 0x86, 0x37, 0xa4, 0x89, 0x46, 0xa5, 0x93, 0x46, 0xa6, 0x8b, 0x4b, 
-    0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x1c, 0xa8, 0x8e, 0x51, 0xa9, 0x8e, 0x4e, 0xaa, 
-    0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1a, 0xab, 0x92, 0x55, 0xab, 0xab, 
-    0xab, 0xad, 0x95, 0x5b, 0xad, 0x98, 0x6b, 0xae, 0x92, 0x8f, 0xae, 0x96, 0x2c, 
-    0xae, 0xae, 0xb9, 0xaf, 0x90, 0x18, 0xb1, 0x98, 0x57, 0xb2, 0x93, 0x19, 0xb2, 
-    0x94, 0x16, 0xb2, 0x9b, 0x64, 0xb4, 0x9e, 0x6a, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 
-    0xbd, 0xb6, 0x99, 0x19, 0xb7, 0x99, 0x17, 0xb7, 0xa1, 0x6d, 0xb8, 0xa5, 0x2c, 
-    0xb8, 0xb8, 0xc2, 0xba, 0x9d, 0x1a, 0xba, 0xa3, 0xa4, 0xbb, 0xa7, 0x76, 0xbb, 
-    0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbe, 0xa1, 0x1b, 0xc2, 0xa5, 0x1c, 0xc2, 0xb0, 
-    0x87, 0xc3, 0xaf, 0x70, 0xc3, 0xc3, 0xc4, 0xc4, 0xb3, 0x89, 0xc4, 0xc4, 0xcb, 
-    0xc5, 0xa9, 0x1d, 0xc7, 0xac, 0x22, 0xc7, 0xb7, 0x28, 0xc9, 0xad, 0x1e, 0xc9, 
-    0xb6, 0xb7, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 
-    0x21, 0xd1, 0xb6, 0x23, 0xd3, 0xd3, 0xd4, 0xd4, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 
-    0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 0xdb, 0xc6, 0x2a, 0xdb, 0xdb, 0xde, 0xdc, 
-    0xc3, 0x26, 0xdc, 0xcb, 0x70, 0xde, 0xde, 0xe2, 0xe0, 0xc8, 0x27, 0xe3, 0xd1, 
-    0x55, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe6, 0xd1, 0x2c, 
-    0xe6, 0xe6, 0xe9, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xed, 
-    0xd9, 0x33, 0xef, 0xd9, 0x2d, 0xef, 0xe5, 0xa8, 0xef, 0xef, 0xf1, 0xf2, 0xdc, 
-    0x2f, 0xf2, 0xdd, 0x39, 0xf2, 0xed, 0xed, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 
-    0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf6, 0xfa, 0xe5, 0x32, 0xfb, 
-    0xe8, 0x32, 0xfc, 0xed, 0x6a, 0xfc, 0xf2, 0x98, 0xff, 0xeb, 0x34, 0xff, 0xec, 
-    0x3b, 0xff, 0xed, 0x47, 0xff, 0xef, 0x56, 0xff, 0xf0, 0x59, 0xff, 0xf0, 0x65, 
-    0xff, 0xf1, 0x6d, 0xff, 0xf2, 0x78, 0xff, 0xf4, 0x89, 0xff, 0xff, 0xff, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xb9, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 
-    0x83, 0x02, 0x65, 0x51, 0xa3, 0x36, 0x89, 0xdb, 0x34, 0x61, 0x08, 0x23, 0x4a, 
-    0x94, 0xb8, 0x6c, 0x9a, 0xac, 0x69, 0xcf, 0x4a, 0x4d, 0xdc, 0xc8, 0x11, 0x90, 
-    0x33, 0x69, 0xcb, 0xa4, 0x01, 0xe3, 0x48, 0x52, 0xe2, 0x2c, 0x69, 0x28, 0xa5, 
-    0xb5, 0x7a, 0x35, 0x8b, 0xd7, 0xac, 0x92, 0x1b, 0x65, 0xe1, 0x9a, 0x35, 0x8b, 
-    0x55, 0x2f, 0x69, 0xcf, 0x52, 0x86, 0x94, 0x46, 0x0d, 0xa6, 0x44, 0x4c, 0xc2, 
-    0x52, 0x0a, 0x33, 0x66, 0xa9, 0x97, 0xb0, 0x8f, 0x38, 0x81, 0x1d, 0xf3, 0x29, 
-    0x91, 0x57, 0x4a, 0x91, 0xbd, 0x5a, 0x31, 0x19, 0x76, 0x53, 0x28, 0x2b, 0xa6, 
-    0x07, 0x27, 0x21, 0x7d, 0x2a, 0x4d, 0x58, 0xaf, 0x61, 0x29, 0x7b, 0x3d, 0x7b, 
-    0xd6, 0x0a, 0x6b, 0x41, 0x4b, 0x5c, 0xd3, 0x3e, 0x2d, 0x3b, 0xd2, 0x2c, 0x41, 
-    0xa7, 0x5c, 0x9d, 0xcd, 0x0c, 0xb9, 0xac, 0x97, 0xb3, 0x5c, 0x6e, 0x0f, 0xb6, 
-    0x92, 0xb5, 0x32, 0x55, 0xab, 0x56, 0xd2, 0x9c, 0x89, 0xed, 0x75, 0x0c, 0xd3, 
-    0xcb, 0xbc, 0x1b, 0x7b, 0x2d, 0x1b, 0x54, 0x2a, 0x97, 0x29, 0xc4, 0x24, 0x4b, 
-    0x25, 0x83, 0xec, 0x73, 0x92, 0xb4, 0x54, 0x94, 0x49, 0x4e, 0x4a, 0x25, 0x32, 
-    0xf3, 0xc6, 0x57, 0xc9, 0xaa, 0xd6, 0xb5, 0xe4, 0x99, 0x1b, 0x8f, 0x20, 0x04, 
-    0x31, 0xbd, 0xa2, 0x2a, 0x2d, 0x19, 0xca, 0x5e, 0x6b, 0x10, 0x0f, 0x09, 0x05, 
-    0x2b, 0x18, 0x33, 0x66, 0xca, 0x68, 0x8d, 0x3a, 0xc2, 0x4d, 0x96, 0x2c, 0xa7, 
-    0x8a, 0x8d, 0xcd, 0x4a, 0xc5, 0xab, 0xd7, 0x2b, 0xa6, 0x47, 0x46, 0x29, 0xdb, 
-    0xc6, 0xbc, 0x39, 0x73, 0x66, 0xab, 0x40, 0xad, 0xfc, 0x8d, 0x2b, 0x19, 0xa6, 
-    0x44, 0xdc, 0x80, 0x49, 0xe3, 0x05, 0xb3, 0x8e, 0x2f, 0xe7, 0xe0, 0x9b, 0xbb, 
-    0xff, 0xb2, 0x91, 0x48, 0x56, 0xaf, 0x52, 0xc0, 0xb8, 0x73, 0xb3, 0x14, 0x12, 
-    0x17, 0xc9, 0x40, 0xcb, 0xc3, 0x87, 0x8f, 0x01, 0xc0, 0xc1, 0x9c, 0x5e, 0xa4, 
-    0x48, 0xe1, 0x17, 0xd8, 0xaa, 0x97, 0xfb, 0x8d, 0x58, 0x14, 0x23, 0x5f, 0x78, 
-    0xbb, 0x00, 0x60, 0x60, 0x01, 0x6b, 0xb0, 0x82, 0xcb, 0x4c, 0x4c, 0xb9, 0x32, 
-    0x60, 0x78, 0x9c, 0x18, 0x68, 0xa0, 0x00, 0x45, 0x79, 0x52, 0x16, 0x4c, 0x47, 
-    0xc4, 0xf7, 0x60, 0x73, 0x65, 0x48, 0x68, 0xa0, 0x04, 0xd8, 0x31, 0xd5, 0xc7, 
-    0x86, 0xe0, 0xf9, 0xe0, 0xa1, 0x81, 0x0b, 0x60, 0xb5, 0x09, 0x89, 0xce, 0x91, 
-    0x70, 0x22, 0x00, 0x03, 0x60, 0xa5, 0x4a, 0x73, 0xc1, 0xdc, 0xb2, 0xe1, 0x03, 
-    0x2f, 0x02, 0x90, 0xa2, 0x4f, 0xb0, 0x30, 0xe7, 0xca, 0x2e, 0xa3, 0xd0, 0xc2, 
-    0xcc, 0x80, 0x0b, 0xe4, 0x18, 0xa3, 0x4f, 0xc5, 0xdc, 0xc2, 0x89, 0x80, 0xdb, 
-    0xf8, 0xa2, 0x4a, 0x28, 0xa3, 0xa8, 0xd2, 0x63, 0x73, 0x45, 0xe6, 0x98, 0x00, 
-    0x4c, 0x92, 0xb8, 0x02, 0xcb, 0x90, 0xcb, 0xed, 0x12, 0xcc, 0x36, 0xc1, 0x14, 
-    0xc3, 0x0c, 0x93, 0xdb, 0xe0, 0x98, 0x23, 0x02, 0x25, 0x05, 0xc8, 0xcc, 0x2e, 
-    0xdb, 0xa8, 0x12, 0xc3, 0x36, 0x50, 0xe8, 0xc0, 0x9c, 0x97, 0xce, 0x7d, 0x90, 
-    0x23, 0x00, 0x06, 0x90, 0x24, 0x89, 0x80, 0x36, 0x6e, 0x13, 0xc9, 0x05, 0xdb, 
-    0x14, 0x42, 0x00, 0x93, 0xab, 0x7c, 0xc9, 0x9c, 0x89, 0x77, 0x6e, 0x54, 0x07, 
-    0x2d, 0xcc, 0xf9, 0x72, 0xcb, 0x97, 0xb7, 0x8c, 0xb2, 0x8d, 0x32, 0x9c, 0x0c, 
-    0xb9, 0x8d, 0x2b, 0x8c, 0x32, 0xd7, 0x61, 0xa2, 0x11, 0x4d, 0xe1, 0xa0, 0x73, 
-    0xb6, 0x0d, 0x28, 0xa6, 0x86, 0x11, 0x72, 0x7a, 0x50, 0x20, 0x64, 0xb2, 0x28, 
-    0xdf, 0x2d, 0x77, 0x02, 0x80, 0x90, 0x24, 0x96, 0xaa, 0xff, 0x3a, 0x20, 0x33, 
-    0x11, 0x98, 0x4a, 0x50, 0x1d, 0xb1, 0xca, 0x3a, 0xa0, 0x1d, 0x39, 0x12, 0x70, 
-    0x50, 0xa6, 0xba, 0x3e, 0xc8, 0xea, 0x8b, 0x79, 0x16, 0x34, 0x45, 0xb0, 0xf2, 
-    0x31, 0xe3, 0x0b, 0x93, 0x42, 0xbc, 0xb8, 0x23, 0x41, 0x2b, 0x3a, 0xe7, 0x4a, 
-    0x19, 0x42, 0x08, 0x61, 0x47, 0xaa, 0xe1, 0x15, 0x63, 0x47, 0x07, 0x20, 0x70, 
-    0x10, 0xca, 0x36, 0x81, 0x04, 0xe0, 0x21, 0x9a, 0x06, 0xad, 0xe2, 0x5c, 0x21, 
-    0x27, 0x46, 0xf2, 0xa0, 0x32, 0x31, 0x8c, 0xc0, 0x81, 0x11, 0x7b, 0x6e, 0x83, 
-    0x85, 0x99, 0x00, 0x90, 0x5b, 0xae, 0x73, 0xb5, 0x7a, 0xc8, 0xc9, 0x83, 0x8a, 
-    0x80, 0x70, 0xc5, 0x77, 0xcf, 0xc1, 0xc0, 0x4d, 0x03, 0x04, 0x5c, 0x89, 0x90, 
-    0xb9, 0xcd, 0x85, 0x42, 0x42, 0x04, 0x3a, 0xd8, 0xf1, 0xa9, 0x7c, 0xb4, 0x70, 
-    0x13, 0x6d, 0x73, 0xca, 0x90, 0x84, 0x70, 0xb0, 0xcc, 0x84, 0xa1, 0x48, 0x30, 
-    0x1a, 0x6e, 0xc3, 0x0c, 0x6a, 0x1b, 0x29, 0x82, 0xec, 0x36, 0xa3, 0xf0, 0xc0, 
-    0xdb, 0x11, 0x7d, 0x82, 0x39, 0x06, 0x11, 0x1c, 0x01, 0x2c, 0xeb, 0x2e, 0x05, 
-    0x05, 0xb2, 0x8d, 0x2e, 0x88, 0x48, 0xe1, 0x04, 0x12, 0x1c, 0x05, 0x92, 0xeb, 
-    0x86, 0xc5, 0x84, 0x51, 0x50, 0x12, 0x71, 0x48, 0xa1, 0x44, 0x12, 0xa8, 0x04, 
-    0xa2, 0xe7, 0xce, 0x10, 0xfb, 0x5c, 0x90, 0x13, 0x4a, 0x8c, 0x11, 0xcb, 0x90, 
-    0xbe, 0x94, 0x94, 0xc6, 0x96, 0xf2, 0x15, 0xe3, 0x4a, 0x1f, 0x08, 0x25, 0xa1, 
-    0x0b, 0x78, 0xa3, 0xc0, 0x34, 0x84, 0x22, 0x51, 0xae, 0x32, 0xca, 0x26, 0x61, 
-    0xe4, 0x20, 0xd1, 0xc4, 0xcd, 0xf9, 0x62, 0x41, 0x69, 0x06, 0x19, 0xea, 0x1c, 
-    0x2c, 0x0a, 0xb0, 0x4d, 0x90, 0xa4, 0xcc, 0x91, 0xe9, 0x0a, 0x00, 0x17, 0xc8, 
-    0xcd, 0x0d, 0xae, 0xcd, 0x01, 0x12, 0xcb, 0x6a, 0xdc, 0x6c, 0x1f, 0xe1, 0xf6, 
-    0x36, 0x53, 0x6e, 0x53, 0x8c, 0x00, 0x00, 0x4c, 0x80, 0x50, 0x40, 0x00, 0x21, 
-    0xf9, 0x04, 0x05, 0x03, 0x00, 0xdf, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x2b, 
-    0x00, 0x36, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x03, 0x0c, 0x0c, 0x0c, 
-    0x0e, 0x0e, 0x12, 0x14, 0x13, 0x14, 0x17, 0x16, 0x1a, 0x18, 0x15, 0x04, 0x1b, 
-    0x1b, 0x1c, 0x1f, 0x1e, 0x1f, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 0x2b, 0x2b, 
-    0x2b, 0x2f, 0x2d, 0x35, 0x32, 0x2d, 0x0a, 0x33, 0x33, 0x33, 0x3a, 0x39, 0x3b, 
-    0x3a, 0x39, 0x43, 0x43, 0x43, 0x44, 0x45, 0x41, 0x35, 0x47, 0x27, 0x24, 0x47, 
-    0x3f, 0x50, 0x4b, 0x27, 0x19, 0x4b, 0x45, 0x0f, 0x4c, 0x46, 0x59, 0x4c, 0x4c, 
-    0x4d, 0x4d, 0x3e, 0x4c, 0x4d, 0x4b, 0x62, 0x50, 0x4f, 0x65, 0x51, 0x3a, 0x43, 
-    0x54, 0x54, 0x54, 0x55, 0x34, 0x36, 0x55, 0x3b, 0x46, 0x55, 0x54, 0x5c, 0x56, 
-    0x56, 0x6d, 0x57, 0x56, 0x67, 0x58, 0x2d, 0x2a, 0x59, 0x59, 0x6f, 0x5a, 0x29, 
-    0x22, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4d, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 
-    0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x65, 0x65, 0x7a, 0x67, 
-    0x63, 0x60, 0x69, 0x3f, 0x44, 0x69, 0x6a, 0x7d, 0x6b, 0x6b, 0x6c, 0x6d, 0x27, 
-    0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x6f, 0x58, 0x0d, 0x6f, 0x70, 0x83, 
-    0x72, 0x4b, 0x4c, 0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x76, 0x38, 0x38, 0x76, 
-    0x6b, 0x16, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x7b, 0x7b, 
-    0x7c, 0x7b, 0x7b, 0x8d, 0x7f, 0x7f, 0x90, 0x7f, 0x80, 0x91, 0x80, 0x76, 0x5a, 
-    0x82, 0x4e, 0x4e, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 
-    0x83, 0x8f, 0x87, 0x57, 0x57, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8a, 0x66, 
-    0x0a, 0x8a, 0x69, 0x17, 0x8b, 0x2f, 0x30, 0x8b, 0x8c, 0x9b, 0x8c, 0x8c, 0x8c, 
-    0x8e, 0x30, 0x31, 0x8e, 0x6e, 0x2b, 0x8e, 0x75, 0x17, 0x90, 0x90, 0x9e, 0x91, 
-    0x66, 0x66, 0x91, 0x6e, 0x0e, 0x93, 0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 0x94, 
-    0xa2, 0x95, 0x75, 0x23, 0x96, 0x75, 0x1c, 0x96, 0x88, 0x1d, 0x97, 0x74, 0x0d, 
-    0x97, 0x75, 0x17, 0x97, 0x77, 0x28, 0x97, 0x86, 0x8b, 0x9a, 0x7a, 0x24, 0x9a, 
-    0x7b, 0x2b, 0x9a, 0x7c, 0x38, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x74, 
-    0x74, 0x9b, 0x9b, 0x9c, 0x9c, 0x7a, 0x0e, 0x9c, 0x7c, 0x1c, 0x9c, 0x7d, 0x33, 
-    0x9c, 0x80, 0x44, 0x9d, 0x7c, 0x15, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x34, 0x9e, 
-    0x81, 0x3b, 0x9e, 0x88, 0x26, 0xa0, 0x37, 0x37, 0xa1, 0x84, 0x3d, 0xa2, 0x7f, 
-    0x7f, 0xa2, 0x84, 0x34, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1a, 
-    0xa3, 0x84, 0x26, 0xa3, 0xa3, 0xa4, 0xa4, 0x83, 0x14, 0xa4, 0x89, 0x46, 0xa5, 
-    0x8b, 0x4a, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x17, 0xa7, 0x8c, 0x4d, 0xa7, 0x8d, 
-    0x54, 0xa9, 0x8f, 0x51, 0xaa, 0x8b, 0x1a, 0xaa, 0x91, 0x55, 0xaa, 0x96, 0x27, 
-    0xaa, 0xaa, 0xb5, 0xab, 0x8b, 0x15, 0xab, 0xab, 0xab, 0xad, 0x95, 0x5b, 0xad, 
-    0x97, 0x63, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x18, 0xaf, 0x90, 0x90, 0xaf, 0x98, 
-    0x5e, 0xb0, 0x98, 0x55, 0xb1, 0x9a, 0x63, 0xb3, 0x94, 0x16, 0xb3, 0x95, 0x19, 
-    0xb4, 0x9e, 0x69, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xbd, 0xb6, 0x98, 0x19, 0xb7, 
-    0xa1, 0x6c, 0xb8, 0x9a, 0x17, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 0xc2, 0xb9, 0xa5, 
-    0x25, 0xba, 0x9d, 0x1a, 0xba, 0xa3, 0xa4, 0xba, 0xa5, 0x74, 0xba, 0xaa, 0x85, 
-    0xbb, 0xa7, 0x78, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 0xaa, 0x7b, 0xbe, 
-    0xa1, 0x1b, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xcb, 0xc5, 0xb3, 
-    0x88, 0xc6, 0xaa, 0x1d, 0xc6, 0xb6, 0x8f, 0xc8, 0xad, 0x24, 0xc8, 0xb1, 0x45, 
-    0xc9, 0xae, 0x1e, 0xc9, 0xb6, 0xb7, 0xca, 0xb9, 0x29, 0xcc, 0xb1, 0x1f, 0xcc, 
-    0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 0x21, 0xd1, 0xb6, 0x21, 0xd3, 0xd3, 
-    0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 
-    0xdb, 0xdb, 0xde, 0xdc, 0xc3, 0x26, 0xdc, 0xc5, 0x29, 0xde, 0xc7, 0x37, 0xde, 
-    0xde, 0xe2, 0xe0, 0xce, 0x67, 0xe1, 0xc8, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 
-    0xe5, 0xe4, 0xcd, 0x29, 0xe6, 0xd1, 0x2c, 0xe6, 0xe6, 0xe9, 0xea, 0xe4, 0xe4, 
-    0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xee, 0xd8, 0x2d, 0xef, 0xdb, 0x30, 0xef, 
-    0xe3, 0x9b, 0xef, 0xef, 0xf1, 0xf2, 0xdc, 0x2f, 0xf2, 0xed, 0xed, 0xf4, 0xdf, 
-    0x30, 0xf4, 0xf4, 0xf5, 0xf6, 0xe1, 0x30, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf6, 
-    0xfa, 0xe5, 0x32, 0xfb, 0xeb, 0x64, 0xfe, 0xee, 0x57, 0xff, 0xeb, 0x34, 0xff, 
-    0xec, 0x3c, 0xff, 0xec, 0x47, 0xff, 0xf0, 0x6a, 0xff, 0xf1, 0x5a, 0xff, 0xf2, 
-    0x78, 0xff, 0xf3, 0x84, 0xff, 0xf4, 0x97, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xbf, 0x09, 0x1c, 0x48, 0xb0, 
-    0xa0, 0xc1, 0x83, 0x02, 0x79, 0x61, 0x83, 0x26, 0xf0, 0x9a, 0x31, 0x84, 0x10, 
-    0x23, 0x42, 0x5c, 0x64, 0x0d, 0xdb, 0xaa, 0x6b, 0xd3, 0x48, 0x49, 0xdc, 0xc8, 
-    0x31, 0x92, 0x35, 0x6b, 0xcc, 0xac, 0x09, 0xe3, 0x48, 0x32, 0x22, 0xaf, 0x8f, 
-    0x1f, 0x55, 0xc9, 0xe2, 0x25, 0x0c, 0x57, 0xc9, 0x8d, 0xab, 0x66, 0xc9, 0x5a, 
-    0x45, 0x4a, 0x18, 0xca, 0x8f, 0xc9, 0xac, 0x5d, 0xc3, 0xf6, 0x32, 0xe2, 0x28, 
-    0x63, 0x28, 0x91, 0x19, 0xdb, 0x05, 0x0d, 0xe8, 0xc7, 0x69, 0xce, 0xaa, 0xf5, 
-    0x8c, 0x68, 0xf4, 0xe3, 0x30, 0x57, 0xb8, 0x6a, 0x24, 0x83, 0x86, 0x92, 0x99, 
-    0xb0, 0x55, 0x4b, 0x0f, 0xaa, 0xba, 0x69, 0x6d, 0xda, 0x47, 0x5c, 0xc2, 0xa8, 
-    0x76, 0x45, 0x86, 0x11, 0x6b, 0x56, 0x82, 0xb8, 0xb8, 0xa2, 0x9c, 0xe6, 0x15, 
-    0xa5, 0xb3, 0x51, 0xdf, 0x7c, 0x9d, 0x25, 0x88, 0xaa, 0xed, 0xcd, 0x69, 0xc2, 
-    0x6c, 0x82, 0x74, 0x76, 0x8d, 0xd7, 0x5c, 0x83, 0xab, 0x7e, 0x09, 0xdb, 0xc5, 
-    0x0b, 0x17, 0x61, 0xbc, 0x5e, 0x7f, 0xb1, 0x74, 0xf9, 0xf7, 0xe0, 0xaa, 0x61, 
-    0xc8, 0x70, 0x91, 0x82, 0x86, 0x4c, 0xd5, 0x2c, 0xaf, 0xc3, 0x28, 0x6f, 0x6a, 
-    0x5c, 0x10, 0x97, 0xac, 0x90, 0xc3, 0x70, 0x0d, 0x73, 0xc4, 0x6c, 0x1a, 0x34, 
-    0x67, 0xa4, 0x54, 0x69, 0xe4, 0x4c, 0x70, 0x18, 0x2f, 0x52, 0xbf, 0x7e, 0x21, 
-    0xe3, 0xf5, 0x2b, 0xd2, 0xb7, 0x51, 0xb3, 0x58, 0x1b, 0x84, 0x2b, 0xb0, 0xd6, 
-    0xb4, 0x5f, 0xba, 0x49, 0x0e, 0xeb, 0x6a, 0x36, 0xf8, 0xb7, 0x1e, 0x40, 0x0e, 
-    0x0e, 0xef, 0x9a, 0x9b, 0xb3, 0x91, 0x52, 0xb6, 0x8e, 0x45, 0x8b, 0xb6, 0x2c, 
-    0x97, 0x29, 0x23, 0x03, 0x4f, 0x1e, 0x45, 0x85, 0xcb, 0x18, 0xb2, 0x61, 0xcd, 
-    0x4b, 0x1a, 0xff, 0x31, 0xf5, 0xcc, 0x9b, 0xf9, 0xf3, 0xe6, 0xa3, 0xc5, 0xa2, 
-    0xf2, 0x4d, 0x53, 0xce, 0xae, 0x9b, 0xbf, 0x69, 0x37, 0xe6, 0x88, 0xa4, 0x1d, 
-    0x62, 0xe8, 0xf3, 0x9f, 0xa7, 0xb5, 0x80, 0x10, 0xae, 0xff, 0xbc, 0xf8, 0x25, 
-    0xd0, 0x63, 0xb5, 0x90, 0x54, 0x48, 0x79, 0xfa, 0xe9, 0x37, 0x03, 0x00, 0x0d, 
-    0xa0, 0xb2, 0xca, 0x2e, 0xaf, 0x20, 0x93, 0x55, 0x16, 0xcb, 0x24, 0xa8, 0x5f, 
-    0x30, 0x00, 0x64, 0x68, 0x00, 0x06, 0xc3, 0xa8, 0x92, 0x4c, 0x7c, 0x2f, 0xd1, 
-    0x62, 0xa1, 0x7e, 0xa1, 0x64, 0x98, 0x61, 0x02, 0xbb, 0xd4, 0xb2, 0x4b, 0x78, 
-    0x24, 0x19, 0x81, 0xe0, 0x88, 0xe7, 0x9d, 0x61, 0x62, 0x86, 0x35, 0x68, 0x92, 
-    0x55, 0x1f, 0x30, 0xe6, 0xf7, 0xc3, 0x8c, 0x19, 0x2e, 0x90, 0x15, 0x28, 0x39, 
-    0xa2, 0x67, 0x02, 0x8f, 0x00, 0x0c, 0x90, 0x15, 0x2c, 0xe7, 0x1d, 0xd3, 0x0b, 
-    0x8c, 0x0f, 0x10, 0x09, 0x80, 0x8f, 0x3d, 0xd9, 0x62, 0x1e, 0x2d, 0xc1, 0x98, 
-    0x92, 0x4b, 0x34, 0x16, 0x2e, 0xe0, 0xa4, 0x91, 0x3d, 0x2d, 0xd3, 0x4b, 0x28, 
-    0x15, 0x7a, 0x43, 0x0c, 0x2c, 0xa5, 0x98, 0x02, 0x8b, 0x94, 0xe7, 0x69, 0xe9, 
-    0x64, 0x02, 0x2f, 0x61, 0x42, 0x8b, 0x2d, 0x58, 0x96, 0x17, 0xcc, 0x31, 0xde, 
-    0x1c, 0xb3, 0x0c, 0x75, 0xe7, 0x35, 0xe9, 0x24, 0x02, 0x25, 0x51, 0x18, 0x4d, 
-    0x30, 0xde, 0xc0, 0x12, 0x83, 0x37, 0x50, 0xe4, 0x60, 0xde, 0x9c, 0xe8, 0x75, 
-    0xe0, 0x24, 0x00, 0x07, 0x90, 0x44, 0x49, 0x85, 0x4b, 0x7a, 0x33, 0x09, 0x06, 
-    0xde, 0x1c, 0x42, 0x40, 0x98, 0xb1, 0xd0, 0x69, 0x1e, 0x0f, 0x8b, 0x02, 0xb0, 
-    0x51, 0x1f, 0xb9, 0x98, 0x47, 0x4c, 0x2f, 0x74, 0xf6, 0x62, 0x8a, 0x37, 0xcf, 
-    0x60, 0x82, 0xa5, 0x37, 0xb4, 0x84, 0x6a, 0x9e, 0x8c, 0x8b, 0x46, 0xff, 0x44, 
-    0x85, 0x88, 0xe8, 0x49, 0x67, 0xe1, 0x9d, 0x2f, 0x96, 0x18, 0x2b, 0x42, 0x85, 
-    0x84, 0x19, 0xa4, 0x85, 0xbd, 0x74, 0x8a, 0x10, 0x25, 0xab, 0xfe, 0x6a, 0x61, 
-    0x34, 0x11, 0xec, 0x5a, 0x90, 0x1d, 0xc5, 0x1a, 0x6b, 0x61, 0x1e, 0x4e, 0x12, 
-    0x70, 0x90, 0xab, 0xce, 0x8e, 0x18, 0x2c, 0x91, 0x8d, 0x16, 0x44, 0x45, 0xb5, 
-    0x09, 0x46, 0x43, 0x4c, 0x98, 0x45, 0x10, 0x09, 0x25, 0x41, 0x40, 0xa2, 0x47, 
-    0xcb, 0x19, 0x45, 0xfc, 0x70, 0x86, 0xaf, 0x09, 0x2e, 0x93, 0xc7, 0x09, 0x23, 
-    0x78, 0x50, 0x8a, 0x37, 0x85, 0x04, 0x30, 0x23, 0x9b, 0x06, 0xc5, 0x82, 0xde, 
-    0x21, 0x3c, 0x4e, 0x32, 0xe2, 0x33, 0x31, 0x94, 0xe0, 0x41, 0x11, 0x98, 0x54, 
-    0x98, 0x85, 0x9e, 0x00, 0xf0, 0x79, 0x90, 0xbe, 0xe7, 0x25, 0x3b, 0x63, 0x28, 
-    0x23, 0x2a, 0x32, 0x02, 0x16, 0xf8, 0xa5, 0x07, 0xc3, 0x37, 0x0e, 0x10, 0x80, 
-    0xef, 0xc2, 0xe8, 0x95, 0x62, 0x42, 0x04, 0x39, 0x9c, 0x41, 0x6b, 0x82, 0xb9, 
-    0x7c, 0x53, 0xee, 0x79, 0xcf, 0x90, 0xc4, 0x70, 0xb5, 0xd1, 0x64, 0xa1, 0xc8, 
-    0x31, 0x2f, 0x7a, 0x13, 0x4d, 0x72, 0x1b, 0x15, 0xc2, 0xad, 0x37, 0xa6, 0xe0, 
-    0x80, 0xc4, 0x37, 0x46, 0x50, 0x7b, 0x8c, 0x19, 0x44, 0x70, 0x54, 0xb1, 0xb1, 
-    0xc1, 0x14, 0x64, 0x33, 0x30, 0x8c, 0x44, 0xe1, 0xc4, 0x11, 0x1c, 0x15, 0xd2, 
-    0x2c, 0x8c, 0xcb, 0x90, 0x51, 0x50, 0x12, 0x73, 0x44, 0xb1, 0x44, 0x12, 0xad, 
-    0x14, 0x42, 0x92, 0xaa, 0x41, 0xe6, 0x22, 0x75, 0x41, 0x4e, 0x2c, 0x61, 0xc6, 
-    0x2d, 0x58, 0x12, 0x53, 0x52, 0x1b, 0x70, 0xb6, 0x4b, 0x4b, 0x1f, 0x08, 0x25, 
-    0x01, 0x4c, 0x7e, 0xa6, 0xbc, 0x04, 0x84, 0x22, 0x66, 0xc6, 0x62, 0x0a, 0x28, 
-    0x64, 0xf4, 0x10, 0xd1, 0xc9, 0xe7, 0x11, 0x2b, 0x73, 0x81, 0x71, 0x06, 0x69, 
-    0x8a, 0x9e, 0x2d, 0x0a, 0x00, 0x4e, 0xd0, 0xa9, 0xe6, 0xf9, 0x4a, 0x0b, 0x00, 
-    0x18, 0x18, 0xfe, 0x0d, 0xb3, 0xe7, 0x51, 0x1b, 0x6c, 0xe1, 0x80, 0x1b, 0x21, 
-    0xb8, 0x37, 0x68, 0x7a, 0xb3, 0x8c, 0x00, 0x00, 0x44, 0x80, 0x50, 0x40, 0x00, 
-    0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x9f, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 
-    0x2b, 0x00, 0x36, 0x00, 0x87, 0x0d, 0x0d, 0x0d, 0x12, 0x12, 0x12, 0x17, 0x17, 
-    0x18, 0x1c, 0x1c, 0x1c, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x30, 0x2f, 0x30, 
-    0x31, 0x2b, 0x20, 0x32, 0x32, 0x33, 0x3b, 0x3b, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 
-    0x3f, 0x4d, 0x43, 0x43, 0x43, 0x46, 0x25, 0x20, 0x48, 0x46, 0x53, 0x4b, 0x49, 
-    0x56, 0x4f, 0x4e, 0x5b, 0x54, 0x35, 0x32, 0x54, 0x54, 0x54, 0x55, 0x54, 0x5c, 
-    0x56, 0x54, 0x60, 0x57, 0x57, 0x6d, 0x59, 0x59, 0x6f, 0x5b, 0x5c, 0x5d, 0x5c, 
-    0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x61, 0x61, 0x76, 0x62, 0x61, 
-    0x6e, 0x63, 0x45, 0x41, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x69, 0x54, 0x58, 
-    0x69, 0x69, 0x7d, 0x6a, 0x69, 0x76, 0x6b, 0x6b, 0x6b, 0x6c, 0x50, 0x4d, 0x6d, 
-    0x29, 0x2a, 0x6e, 0x4c, 0x51, 0x6e, 0x67, 0x55, 0x6e, 0x6e, 0x81, 0x70, 0x2f, 
-    0x2f, 0x70, 0x6e, 0x7b, 0x72, 0x72, 0x85, 0x73, 0x73, 0x75, 0x76, 0x76, 0x89, 
-    0x77, 0x36, 0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x8a, 0x7a, 0x7a, 0x7b, 0x7b, 
-    0x7b, 0x8d, 0x7c, 0x46, 0x46, 0x7f, 0x4a, 0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4f, 
-    0x4f, 0x83, 0x83, 0x93, 0x85, 0x54, 0x55, 0x86, 0x64, 0x1a, 0x88, 0x88, 0x97, 
-    0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9a, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x91, 
-    0x6f, 0x18, 0x91, 0x8b, 0x93, 0x92, 0x70, 0x0e, 0x93, 0x69, 0x69, 0x94, 0x75, 
-    0x36, 0x94, 0x94, 0xa2, 0x95, 0x75, 0x1c, 0x95, 0x75, 0x23, 0x96, 0x74, 0x17, 
-    0x96, 0x76, 0x2b, 0x97, 0x78, 0x29, 0x98, 0x77, 0x16, 0x98, 0x77, 0x1a, 0x98, 
-    0x77, 0x20, 0x99, 0x74, 0x73, 0x99, 0x99, 0xa6, 0x9a, 0x7a, 0x24, 0x9a, 0x7b, 
-    0x2b, 0x9b, 0x7b, 0x1c, 0x9c, 0x7d, 0x33, 0x9d, 0x7b, 0x15, 0x9d, 0x7f, 0x39, 
-    0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 0x9f, 
-    0x81, 0x2f, 0xa1, 0x83, 0x34, 0xa1, 0x84, 0x3d, 0xa1, 0x8d, 0x61, 0xa1, 0xa1, 
-    0xad, 0xa2, 0x7f, 0x7e, 0xa2, 0x81, 0x14, 0xa2, 0x83, 0x1b, 0xa2, 0x83, 0x23, 
-    0xa2, 0x86, 0x42, 0xa3, 0x84, 0x2a, 0xa3, 0x87, 0x48, 0xa4, 0x89, 0x46, 0xa5, 
-    0x8b, 0x4a, 0xa6, 0x83, 0x83, 0xa7, 0x8a, 0x29, 0xa7, 0x8d, 0x51, 0xa7, 0x8e, 
-    0x5a, 0xa7, 0xa7, 0xb2, 0xa8, 0x89, 0x1c, 0xa8, 0x8e, 0x4f, 0xa9, 0x8c, 0x32, 
-    0xa9, 0x8f, 0x51, 0xaa, 0x91, 0x55, 0xac, 0x92, 0x4b, 0xad, 0x90, 0x2d, 0xad, 
-    0x95, 0x5b, 0xad, 0xad, 0xb8, 0xaf, 0x97, 0x60, 0xaf, 0x98, 0x60, 0xb0, 0x97, 
-    0x5f, 0xb0, 0xa6, 0x90, 0xb1, 0x97, 0x44, 0xb1, 0x99, 0x5e, 0xb1, 0x9a, 0x63, 
-    0xb2, 0x9a, 0x56, 0xb4, 0x99, 0x31, 0xb4, 0x9e, 0x69, 0xb4, 0xb4, 0xbe, 0xb5, 
-    0x9f, 0x70, 0xb6, 0xa0, 0x6c, 0xba, 0xa5, 0x6b, 0xba, 0xa5, 0x74, 0xbb, 0xa7, 
-    0x78, 0xbd, 0xaa, 0x7b, 0xc1, 0xa9, 0x45, 0xc1, 0xaf, 0x84, 0xc3, 0xb1, 0x86, 
-    0xc4, 0xb3, 0x8a, 0xc7, 0xb7, 0x91, 0xc9, 0xba, 0x94, 0xcc, 0xbe, 0x9b, 0xcd, 
-    0xbd, 0x8d, 0xcf, 0xb8, 0x45, 0xd6, 0xc4, 0x71, 0xdb, 0xc8, 0x57, 0xde, 0xd1, 
-    0x96, 0xf3, 0xe4, 0x6b, 0xfe, 0xed, 0x54, 0xff, 0xec, 0x3f, 0xff, 0xed, 0x44, 
-    0xff, 0xed, 0x4a, 0xff, 0xef, 0x5b, 0xff, 0xef, 0x61, 0xff, 0xf0, 0x66, 0xff, 
-    0xf0, 0x6b, 0xff, 0xf1, 0x74, 0xff, 0xf2, 0x7b, 0xff, 0xf3, 0x84, 0xff, 0xf6, 
-    0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb2, 0x00, 0x3f, 0x09, 0x1c, 0x48, 
-    0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0x78, 0x50, 0xce, 0x40, 0x4a, 
-    0x9f, 0x0c, 0x31, 0x9c, 0xb8, 0xb0, 0x0f, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0x74, 
-    0xc4, 0x51, 0x22, 0x42, 0x4b, 0x1a, 0x43, 0x12, 0xc4, 0x24, 0xb2, 0xa4, 0x40, 
-    0x8f, 0x26, 0x53, 0xaa, 0xbc, 0x08, 0x49, 0x25, 0x4a, 0x86, 0x2d, 0x57, 0xca, 
-    0x5c, 0xf9, 0x72, 0x26, 0xc5, 0x3c, 0x04, 0x25, 0xd6, 0x94, 0x59, 0x13, 0xa7, 
-    0xcd, 0x9f, 0x40, 0x83, 0x0a, 0x1d, 0x78, 0x03, 0x61, 0x51, 0xa0, 0x47, 0x55, 
-    0xfa, 0x1c, 0xca, 0xb4, 0xa9, 0xd3, 0xa7, 0x06, 0x93, 0x42, 0xcd, 0x18, 0x63, 
-    0xea, 0xc0, 0x0b, 0x06, 0x01, 0x34, 0x4d, 0x60, 0xb5, 0xab, 0x57, 0xa0, 0x4e, 
-    0x64, 0x0a, 0x18, 0x5a, 0xf5, 0xab, 0x59, 0x8c, 0x74, 0xce, 0x42, 0xed, 0xc2, 
-    0x74, 0xac, 0xda, 0xb7, 0x26, 0x33, 0xc0, 0x6d, 0x1a, 0xc1, 0x20, 0x8a, 0x4f, 
-    0x08, 0x02, 0x60, 0xc4, 0x3a, 0xd7, 0x60, 0xd8, 0x83, 0x30, 0x86, 0xb6, 0x28, 
-    0x2a, 0xb5, 0xaf, 0xd0, 0x1d, 0x5e, 0x08, 0xa6, 0x7d, 0x2a, 0x24, 0xe8, 0x1a, 
-    0x84, 0x3b, 0xc0, 0x86, 0x7c, 0x60, 0xb8, 0xa9, 0x83, 0xca, 0x25, 0x0b, 0x1f, 
-    0x5c, 0x80, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0xe6, 0x00, 
-    0x2c, 0x04, 0x00, 0x00, 0x00, 0x29, 0x00, 0x36, 0x00, 0x87, 0x00, 0x00, 0x00, 
-    0x0b, 0x09, 0x04, 0x0b, 0x0b, 0x0c, 0x10, 0x0e, 0x0d, 0x14, 0x13, 0x14, 0x17, 
-    0x16, 0x1a, 0x19, 0x17, 0x05, 0x1c, 0x1c, 0x1c, 0x1e, 0x1e, 0x25, 0x22, 0x22, 
-    0x23, 0x24, 0x22, 0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x2d, 0x3a, 0x31, 0x2b, 0x09, 
-    0x33, 0x33, 0x33, 0x39, 0x39, 0x3b, 0x3a, 0x39, 0x43, 0x43, 0x43, 0x43, 0x45, 
-    0x35, 0x10, 0x4c, 0x29, 0x28, 0x4c, 0x3e, 0x4c, 0x4c, 0x46, 0x58, 0x4c, 0x4c, 
-    0x4d, 0x4e, 0x40, 0x4f, 0x4e, 0x4c, 0x62, 0x50, 0x4f, 0x65, 0x51, 0x48, 0x0e, 
-    0x52, 0x3b, 0x45, 0x54, 0x54, 0x54, 0x55, 0x53, 0x65, 0x55, 0x54, 0x5c, 0x56, 
-    0x34, 0x35, 0x56, 0x55, 0x6c, 0x57, 0x2c, 0x29, 0x58, 0x46, 0x52, 0x59, 0x59, 
-    0x6f, 0x5a, 0x2a, 0x23, 0x5b, 0x5b, 0x5b, 0x5c, 0x53, 0x12, 0x5c, 0x5c, 0x72, 
-    0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x64, 0x62, 0x6c, 0x65, 
-    0x65, 0x7a, 0x69, 0x3f, 0x44, 0x6a, 0x6a, 0x7d, 0x6b, 0x56, 0x0e, 0x6b, 0x67, 
-    0x5b, 0x6c, 0x6c, 0x6c, 0x6d, 0x27, 0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 
-    0x72, 0x72, 0x85, 0x73, 0x73, 0x74, 0x74, 0x4b, 0x4a, 0x75, 0x6b, 0x18, 0x75, 
-    0x75, 0x7e, 0x76, 0x38, 0x38, 0x76, 0x76, 0x89, 0x77, 0x28, 0x29, 0x7a, 0x79, 
-    0x88, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8c, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 0x4e, 
-    0x82, 0x5d, 0x07, 0x83, 0x83, 0x86, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x87, 
-    0x57, 0x57, 0x89, 0x6c, 0x2b, 0x89, 0x88, 0x96, 0x8a, 0x2e, 0x2e, 0x8a, 0x67, 
-    0x09, 0x8a, 0x75, 0x18, 0x8b, 0x2f, 0x30, 0x8b, 0x8c, 0x9b, 0x8c, 0x69, 0x16, 
-    0x8c, 0x8c, 0x8c, 0x8e, 0x30, 0x31, 0x90, 0x90, 0x9e, 0x91, 0x6d, 0x0b, 0x93, 
-    0x32, 0x32, 0x93, 0x93, 0x94, 0x94, 0x6e, 0x6e, 0x94, 0x94, 0xa2, 0x95, 0x73, 
-    0x0c, 0x96, 0x76, 0x27, 0x96, 0x84, 0x1a, 0x97, 0x98, 0xa6, 0x99, 0x77, 0x17, 
-    0x99, 0x7b, 0x38, 0x9a, 0x9a, 0xa6, 0x9b, 0x35, 0x35, 0x9b, 0x7b, 0x24, 0x9b, 
-    0x7c, 0x2b, 0x9b, 0x9b, 0x9c, 0x9c, 0x7d, 0x33, 0x9c, 0x86, 0x47, 0x9c, 0x91, 
-    0x2b, 0x9d, 0x7b, 0x0e, 0x9d, 0x7c, 0x1b, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 
-    0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3a, 0x9e, 0x82, 0x28, 0x9e, 0x91, 0x96, 0xa0, 
-    0x37, 0x37, 0xa0, 0x7f, 0x15, 0xa1, 0x84, 0x3c, 0xa1, 0xa1, 0xae, 0xa2, 0x7f, 
-    0x7f, 0xa2, 0x84, 0x34, 0xa2, 0x86, 0x42, 0xa3, 0x83, 0x1a, 0xa3, 0x84, 0x26, 
-    0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x14, 0xa4, 0x89, 0x45, 0xa6, 0x8b, 0x4b, 0xa6, 
-    0xa6, 0xb2, 0xa7, 0x88, 0x17, 0xa7, 0xa8, 0xb4, 0xa8, 0x8e, 0x52, 0xa9, 0x8e, 
-    0x49, 0xa9, 0x99, 0x22, 0xaa, 0x8b, 0x15, 0xaa, 0x91, 0x54, 0xaa, 0xaa, 0xb5, 
-    0xab, 0x8c, 0x1a, 0xab, 0x91, 0x48, 0xab, 0xab, 0xab, 0xae, 0x95, 0x5b, 0xae, 
-    0xae, 0xb9, 0xaf, 0x90, 0x19, 0xaf, 0x90, 0x90, 0xaf, 0x98, 0x5d, 0xaf, 0x98, 
-    0x60, 0xb1, 0x99, 0x5c, 0xb1, 0x9a, 0x62, 0xb2, 0x94, 0x16, 0xb3, 0x94, 0x19, 
-    0xb3, 0x98, 0x3c, 0xb4, 0x9e, 0x6a, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xbd, 0xb6, 
-    0x98, 0x1a, 0xb6, 0x9b, 0x26, 0xb7, 0xa1, 0x6e, 0xb8, 0xb6, 0xbe, 0xb8, 0xb8, 
-    0xc1, 0xb9, 0xa8, 0x26, 0xba, 0xa3, 0xa4, 0xba, 0xa5, 0x74, 0xbb, 0x9d, 0x1a, 
-    0xbb, 0xbb, 0xc4, 0xbc, 0xa8, 0x77, 0xbc, 0xbc, 0xbc, 0xbd, 0xad, 0x89, 0xbe, 
-    0xa1, 0x1b, 0xc0, 0xad, 0x7d, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xb4, 
-    0x27, 0xc4, 0xc4, 0xcb, 0xc5, 0xaa, 0x1d, 0xc5, 0xb4, 0x89, 0xc7, 0xac, 0x23, 
-    0xc8, 0xb4, 0x42, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xcc, 0xb1, 0x1f, 0xcc, 
-    0xb4, 0x36, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd3, 0xcd, 0xb3, 0x21, 0xd0, 0xb6, 
-    0x1f, 0xd1, 0xb6, 0x22, 0xd2, 0xbb, 0x2b, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 
-    0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xda, 0xc9, 0x72, 0xdb, 0xc4, 0x33, 0xdb, 
-    0xdb, 0xde, 0xdc, 0xc3, 0x26, 0xdc, 0xc6, 0x29, 0xde, 0xde, 0xe2, 0xe1, 0xc9, 
-    0x27, 0xe2, 0xcc, 0x39, 0xe3, 0xd7, 0x9e, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 
-    0xe4, 0xcc, 0x29, 0xe5, 0xd1, 0x2c, 0xe5, 0xd4, 0x65, 0xe5, 0xe5, 0xe9, 0xea, 
-    0xe5, 0xe5, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xed, 0xec, 0xd8, 0x33, 0xee, 0xee, 
-    0xf1, 0xef, 0xd8, 0x2d, 0xf2, 0xdc, 0x2e, 0xf2, 0xed, 0xed, 0xf4, 0xdf, 0x31, 
-    0xf4, 0xf4, 0xf5, 0xf5, 0xe1, 0x3d, 0xf6, 0xe1, 0x2f, 0xf6, 0xe1, 0x31, 0xf7, 
-    0xf7, 0xf8, 0xf8, 0xe7, 0x4e, 0xf9, 0xf6, 0xf6, 0xfa, 0xe5, 0x32, 0xfa, 0xea, 
-    0x64, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 0x44, 0xff, 0xed, 0x4c, 
-    0xff, 0xee, 0x53, 0xff, 0xef, 0x5c, 0xff, 0xf1, 0x5d, 0xff, 0xf1, 0x6c, 0xff, 
-    0xf2, 0x76, 0xff, 0xf4, 0x87, 0xff, 0xf5, 0x96, 0xff, 0xff, 0xff, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 
-    0x00, 0xcd, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x04, 0x4f, 0x21, 0x5c, 
-    0xc8, 0x90, 0x61, 0x31, 0x73, 0xc0, 0x04, 0x76, 0xd3, 0xd5, 0xb0, 0x62, 0x43, 
-    0x5d, 0xdd, 0x22, 0x6e, 0x73, 0x66, 0xb1, 0x23, 0xc2, 0x5e, 0xda, 0x8a, 0x6d, 
-    0xd3, 0x46, 0x4b, 0x20, 0x24, 0x8f, 0x28, 0xcd, 0x35, 0xd3, 0x06, 0x4d, 0x9b, 
-    0x33, 0x42, 0xba, 0x96, 0x89, 0x4b, 0xd9, 0xf1, 0x97, 0xb6, 0x9b, 0xda, 0x74, 
-    0x39, 0xd3, 0xe6, 0x8d, 0xe6, 0xc1, 0x4a, 0xba, 0x7a, 0xe9, 0xd2, 0xe5, 0x6a, 
-    0x19, 0xce, 0xa3, 0xdd, 0x7c, 0x1a, 0x4c, 0xd5, 0xf2, 0x66, 0xb2, 0x64, 0xa5, 
-    0x8a, 0x25, 0xc3, 0x09, 0xad, 0x18, 0x30, 0x5d, 0x27, 0x95, 0x0a, 0x9c, 0x8a, 
-    0xb3, 0x98, 0xad, 0x5e, 0x26, 0xa0, 0xed, 0xc4, 0xc9, 0x6d, 0xdb, 0x32, 0xad, 
-    0xe6, 0x54, 0x1d, 0x3d, 0x5a, 0xec, 0x17, 0xb5, 0x9b, 0xd8, 0x22, 0xa2, 0x15, 
-    0x48, 0x6b, 0xad, 0xdd, 0xa3, 0x72, 0xd1, 0x56, 0x6a, 0x7a, 0x94, 0xda, 0x2f, 
-    0x90, 0xda, 0xa8, 0x01, 0x23, 0xc6, 0x71, 0xae, 0x39, 0x48, 0xb4, 0x74, 0xd1, 
-    0x52, 0xe5, 0x8a, 0x16, 0xc8, 0x65, 0xce, 0xa8, 0x15, 0x3b, 0x6b, 0xc8, 0x30, 
-    0x41, 0x5a, 0x90, 0x64, 0x1d, 0x6e, 0x96, 0x4c, 0x60, 0x2e, 0x48, 0x44, 0x2d, 
-    0x0f, 0xa4, 0xd5, 0xcc, 0x95, 0x2d, 0x73, 0xba, 0x1e, 0x9a, 0x1b, 0x55, 0x4c, 
-    0x15, 0xad, 0x50, 0xa2, 0x0f, 0x8f, 0x22, 0xb6, 0xac, 0x19, 0x2d, 0x6a, 0x7e, 
-    0x68, 0x41, 0xeb, 0xe5, 0xac, 0x97, 0xe8, 0x1d, 0x3f, 0xaa, 0xb8, 0x4e, 0x06, 
-    0x8d, 0x18, 0xb6, 0x95, 0xce, 0x64, 0x71, 0x9a, 0x4b, 0x84, 0xd4, 0x2d, 0x65, 
-    0xd5, 0xaa, 0x45, 0xdb, 0x65, 0xea, 0x89, 0x39, 0x9b, 0xd8, 0x12, 0xf7, 0x6a, 
-    0xa5, 0x95, 0x88, 0xa9, 0x68, 0xe5, 0xc2, 0x8b, 0xff, 0x0f, 0x5f, 0x0d, 0x96, 
-    0xda, 0x9b, 0x58, 0xb5, 0xff, 0x02, 0xd6, 0xba, 0x23, 0x9c, 0x63, 0xe3, 0xe3, 
-    0x8b, 0xaf, 0x85, 0xc3, 0xa8, 0x36, 0x57, 0xba, 0x80, 0x25, 0xc3, 0x16, 0x18, 
-    0x76, 0x45, 0x41, 0xe0, 0xc9, 0x27, 0x5f, 0x0c, 0x00, 0x48, 0xa0, 0x0b, 0x34, 
-    0xa3, 0x0c, 0x04, 0x9a, 0x2b, 0x16, 0x59, 0xc1, 0x8c, 0x80, 0xf2, 0x0d, 0x03, 
-    0xc0, 0x84, 0x06, 0x54, 0x92, 0x17, 0x4a, 0xb5, 0x40, 0x28, 0xdf, 0x27, 0x13, 
-    0x52, 0x08, 0x0c, 0x21, 0x29, 0x11, 0x11, 0xa0, 0x86, 0xe2, 0x85, 0xd1, 0xe1, 
-    0x84, 0x2f, 0xf8, 0xe7, 0x91, 0x1e, 0x24, 0xc6, 0xe7, 0xc3, 0x89, 0x13, 0x6a, 
-    0x90, 0x52, 0x27, 0x2d, 0x8e, 0x57, 0x02, 0x8c, 0x00, 0x0c, 0x90, 0xd2, 0x2b, 
-    0xe2, 0x29, 0xe3, 0x0b, 0x89, 0x0f, 0xe0, 0x08, 0xc0, 0x02, 0x28, 0xdd, 0x12, 
-    0x5e, 0x2d, 0xc3, 0x98, 0xb2, 0x4b, 0x35, 0x10, 0x2e, 0x20, 0xa4, 0x8e, 0x1e, 
-    0x31, 0xe3, 0xcb, 0x27, 0x0f, 0x96, 0x73, 0xcc, 0x2b, 0xa4, 0x98, 0xf2, 0x8a, 
-    0x91, 0xe2, 0x39, 0x29, 0x64, 0x02, 0x1d, 0x5d, 0x52, 0xcb, 0x2d, 0x4c, 0x82, 
-    0x37, 0x8c, 0x32, 0xe5, 0x28, 0xc3, 0x4c, 0x35, 0x55, 0x96, 0x13, 0xe4, 0x97, 
-    0x0d, 0xae, 0x39, 0x4c, 0x39, 0xaf, 0xc4, 0x50, 0xce, 0x13, 0x36, 0x84, 0x77, 
-    0xe6, 0x78, 0x1c, 0x08, 0x09, 0x40, 0x01, 0x15, 0x4d, 0xf2, 0xe0, 0x8f, 0xe5, 
-    0x48, 0x62, 0x41, 0x39, 0x85, 0x10, 0x50, 0x25, 0x2c, 0x68, 0x86, 0xf7, 0xa2, 
-    0x9f, 0x0c, 0xe9, 0xb1, 0x4b, 0x78, 0xc7, 0xf8, 0x82, 0xa6, 0x2f, 0xa6, 0x94, 
-    0x13, 0xcd, 0x27, 0x4c, 0x96, 0x53, 0xcb, 0xa4, 0xe1, 0x99, 0x08, 0xe9, 0x41, 
-    0x51, 0x64, 0x38, 0x1e, 0x74, 0x10, 0xae, 0x39, 0x22, 0x87, 0xa3, 0x16, 0x74, 
-    0x48, 0x9b, 0x35, 0x0a, 0xff, 0xe8, 0x8b, 0x9f, 0x00, 0x18, 0x34, 0x49, 0xa7, 
-    0xb1, 0x42, 0x58, 0x4d, 0x04, 0xad, 0x0a, 0x04, 0x07, 0xae, 0xb9, 0x42, 0x68, 
-    0x87, 0x90, 0x04, 0x14, 0x04, 0x6a, 0xb0, 0x1a, 0xce, 0x8a, 0x23, 0xa0, 0x03, 
-    0x45, 0x81, 0x6c, 0x8d, 0x43, 0xe0, 0x48, 0xe4, 0x40, 0x34, 0x8e, 0x57, 0x4b, 
-    0x18, 0x43, 0xf8, 0x10, 0xc6, 0x88, 0xba, 0xbe, 0xf2, 0xc4, 0x13, 0xe1, 0x09, 
-    0x12, 0xc0, 0x89, 0x60, 0x12, 0x04, 0xcb, 0x78, 0x85, 0xc0, 0x28, 0x09, 0x89, 
-    0xb7, 0xc4, 0x00, 0xc3, 0x27, 0x01, 0x5a, 0xf1, 0x26, 0x00, 0xe5, 0x9a, 0x3b, 
-    0x1e, 0xaf, 0x27, 0x7e, 0xa2, 0xe1, 0x2d, 0x1b, 0x48, 0x82, 0x6b, 0x35, 0x2e, 
-    0x98, 0xe3, 0x00, 0x01, 0xf5, 0xda, 0x2b, 0x1e, 0x29, 0x25, 0x44, 0x60, 0x43, 
-    0x18, 0xa6, 0x0a, 0xa8, 0x8c, 0x77, 0xf1, 0x45, 0x53, 0xd1, 0xb9, 0xcf, 0x96, 
-    0x23, 0x48, 0x27, 0xca, 0x70, 0x5b, 0xcd, 0x0f, 0x0d, 0x1d, 0x52, 0x71, 0x2d, 
-    0x34, 0x20, 0x61, 0x0e, 0x11, 0xc7, 0x2a, 0x53, 0x45, 0x10, 0x0d, 0xc1, 0x17, 
-    0xec, 0x31, 0x44, 0x10, 0x24, 0x48, 0x39, 0xc2, 0x24, 0x02, 0x05, 0x13, 0x45, 
-    0x34, 0x24, 0x08, 0xb0, 0x24, 0x32, 0xd3, 0x45, 0x41, 0x46, 0xc4, 0x31, 0xb3, 
-    0x11, 0xac, 0x08, 0x52, 0xd1, 0x25, 0x38, 0x0b, 0x78, 0xcb, 0xce, 0x05, 0x31, 
-    0x91, 0x44, 0x15, 0xb8, 0x30, 0xa9, 0x8c, 0x45, 0x68, 0x90, 0x29, 0x20, 0x33, 
-    0xb5, 0xe8, 0x81, 0x90, 0x11, 0xc2, 0xc4, 0x47, 0x4a, 0x47, 0x40, 0x1c, 0xa2, 
-    0xe5, 0x2b, 0xa6, 0x74, 0xa2, 0x45, 0x0d, 0x0c, 0x55, 0x3b, 0xde, 0x31, 0x15, 
-    0xc4, 0x56, 0x50, 0xa3, 0xe3, 0xdd, 0xa2, 0x80, 0xda, 0x03, 0x65, 0x1a, 0x5e, 
-    0x9b, 0xb5, 0x00, 0x60, 0x01, 0xdc, 0xbf, 0x8a, 0x77, 0xec, 0xac, 0x6f, 0xc7, 
-    0x0f, 0x46, 0x04, 0xdb, 0xe5, 0x70, 0x59, 0x0e, 0x33, 0x02, 0x00, 0x10, 0x81, 
-    0x41, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x9f, 0x00, 0x2c, 
-    0x04, 0x00, 0x00, 0x00, 0x29, 0x00, 0x36, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 
-    0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 
-    0x2b, 0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 
-    0x42, 0x42, 0x42, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4c, 0x4c, 0x4d, 0x4f, 
-    0x4e, 0x5b, 0x54, 0x49, 0x58, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 0x56, 
-    0x6d, 0x59, 0x59, 0x6f, 0x5a, 0x3c, 0x38, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 
-    0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x61, 0x50, 0x5d, 0x61, 0x61, 0x76, 0x63, 
-    0x60, 0x6d, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x66, 0x5d, 0x46, 0x6a, 0x69, 
-    0x76, 0x6a, 0x69, 0x7d, 0x6b, 0x6b, 0x6b, 0x6d, 0x29, 0x2a, 0x6e, 0x4c, 0x51, 
-    0x6e, 0x6e, 0x81, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 0x7b, 0x72, 0x72, 0x85, 0x73, 
-    0x73, 0x75, 0x77, 0x36, 0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x8a, 0x78, 0x78, 
-    0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 0x46, 0x46, 0x7f, 0x4a, 0x4b, 0x7f, 0x7f, 0x90, 
-    0x82, 0x4f, 0x4f, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x6e, 0x6c, 0x84, 
-    0x83, 0x8f, 0x85, 0x54, 0x55, 0x85, 0x63, 0x1d, 0x88, 0x87, 0x95, 0x88, 0x88, 
-    0x97, 0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9a, 0x8d, 0x6a, 0x10, 0x8d, 0x7c, 0x7e, 
-    0x8d, 0x8d, 0x8d, 0x8e, 0x6d, 0x28, 0x90, 0x6d, 0x0f, 0x90, 0x90, 0x9e, 0x91, 
-    0x6f, 0x1a, 0x93, 0x69, 0x69, 0x94, 0x94, 0xa2, 0x95, 0x77, 0x34, 0x96, 0x75, 
-    0x1d, 0x96, 0x75, 0x23, 0x96, 0x76, 0x25, 0x97, 0x78, 0x2f, 0x99, 0x74, 0x73, 
-    0x99, 0x78, 0x17, 0x99, 0x99, 0xa6, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2b, 0x9b, 
-    0x7e, 0x3a, 0x9c, 0x7c, 0x1c, 0x9c, 0x7e, 0x33, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 
-    0x2d, 0x9e, 0x81, 0x34, 0x9f, 0x80, 0x24, 0x9f, 0x81, 0x3a, 0x9f, 0x83, 0x43, 
-    0xa0, 0x7f, 0x18, 0xa1, 0x84, 0x3c, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 0xa2, 
-    0x83, 0x23, 0xa2, 0x83, 0x2b, 0xa2, 0x84, 0x35, 0xa2, 0x86, 0x42, 0xa3, 0x84, 
-    0x1d, 0xa3, 0x89, 0x50, 0xa4, 0x89, 0x45, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 
-    0xa6, 0x8b, 0x4b, 0xa8, 0x8e, 0x4c, 0xa9, 0x8e, 0x41, 0xa9, 0x8f, 0x52, 0xaa, 
-    0x91, 0x54, 0xad, 0x8f, 0x1a, 0xad, 0x95, 0x5b, 0xad, 0xad, 0xb8, 0xae, 0x92, 
-    0x3b, 0xaf, 0x98, 0x5d, 0xaf, 0x98, 0x60, 0xb1, 0x98, 0x57, 0xb1, 0x9a, 0x62, 
-    0xb2, 0x9a, 0x5e, 0xb4, 0x9e, 0x6a, 0xb4, 0xb4, 0xbe, 0xb6, 0x9c, 0x3c, 0xb7, 
-    0xa1, 0x6e, 0xb7, 0xa2, 0x70, 0xba, 0xa4, 0x5f, 0xba, 0xa5, 0x74, 0xbb, 0xa7, 
-    0x79, 0xbb, 0xac, 0x90, 0xbd, 0xa9, 0x76, 0xbe, 0xaa, 0x7c, 0xc1, 0xae, 0x81, 
-    0xc2, 0xa9, 0x45, 0xc4, 0xb3, 0x8b, 0xc9, 0xb9, 0x92, 0xca, 0xb9, 0x85, 0xce, 
-    0xc0, 0x9e, 0xd3, 0xc6, 0xa7, 0xd9, 0xc8, 0x74, 0xdc, 0xca, 0x6c, 0xdd, 0xc9, 
-    0x58, 0xdd, 0xce, 0x83, 0xe3, 0xd2, 0x6f, 0xe6, 0xd3, 0x52, 0xe7, 0xd8, 0x7d, 
-    0xea, 0xd7, 0x4c, 0xf5, 0xe4, 0x62, 0xfb, 0xec, 0x6e, 0xff, 0xec, 0x3d, 0xff, 
-    0xed, 0x45, 0xff, 0xed, 0x4c, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5c, 0xff, 0xef, 
-    0x60, 0xff, 0xf0, 0x67, 0xff, 0xf1, 0x5d, 0xff, 0xf1, 0x6d, 0xff, 0xf1, 0x73, 
-    0xff, 0xf3, 0x7b, 0xff, 0xf4, 0x85, 0xff, 0xf4, 0x93, 0xff, 0xf5, 0x8c, 0xff, 
-    0xf5, 0x9a, 0xff, 0xf7, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb3, 0x00, 
-    0x3f, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x04, 0xff, 0x20, 0x5c, 0xc8, 
-    0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x0b, 0x3e, 0x8a, 0x48, 0x11, 0xe1, 0xc4, 0x81, 
-    0x75, 0x2a, 0x6a, 0x2c, 0xe8, 0x68, 0xa3, 0xc7, 0x49, 0x1e, 0x0b, 0x66, 0x0c, 
-    0x49, 0xb2, 0xa4, 0x49, 0x82, 0x90, 0x2e, 0x9e, 0x5c, 0xc9, 0xf2, 0xe4, 0xc8, 
-    0x96, 0x0d, 0x5f, 0x2e, 0x64, 0xf4, 0x09, 0x0e, 0x4c, 0x8c, 0x04, 0x0b, 0xdd, 
-    0x64, 0xa8, 0x50, 0x60, 0x4f, 0x97, 0x3f, 0x05, 0x9e, 0xd9, 0x29, 0x90, 0x06, 
-    0x43, 0x99, 0x44, 0x93, 0xc6, 0x0c, 0xa9, 0x45, 0xa9, 0xd3, 0xa7, 0x50, 0xa3, 
-    0x86, 0x1c, 0x23, 0xb5, 0x62, 0x85, 0xaa, 0x07, 0xaa, 0x6a, 0xdd, 0x8a, 0x70, 
-    0xc0, 0xc6, 0x10, 0x1e, 0x05, 0xec, 0x64, 0xb1, 0x91, 0x2a, 0x57, 0xa5, 0x6c, 
-    0xce, 0x3a, 0x6d, 0x9a, 0x54, 0xac, 0x54, 0xb7, 0x3b, 0x65, 0x6c, 0x94, 0x1b, 
-    0xd1, 0x87, 0x8f, 0xa8, 0x1c, 0xa2, 0x5e, 0x40, 0x68, 0x20, 0x00, 0x81, 0x87, 
-    0x57, 0x1f, 0xd6, 0x50, 0x1b, 0x31, 0xed, 0xc6, 0x1c, 0x07, 0x95, 0x10, 0xbe, 
-    0xa9, 0x63, 0x0b, 0x41, 0xc3, 0x8b, 0x57, 0xea, 0x88, 0xcc, 0x20, 0xb2, 0xd2, 
-    0x05, 0x30, 0xd9, 0x5a, 0xfe, 0x94, 0xc0, 0x60, 0x40, 0x00, 0x21, 0xf9, 0x04, 
-    0x05, 0x03, 0x00, 0xd9, 0x00, 0x2c, 0x04, 0x00, 0x03, 0x00, 0x29, 0x00, 0x33, 
-    0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x06, 0x0b, 0x0b, 0x0c, 0x0f, 0x0e, 
-    0x0f, 0x14, 0x13, 0x14, 0x17, 0x15, 0x05, 0x17, 0x17, 0x1a, 0x1c, 0x1b, 0x1c, 
-    0x1c, 0x1c, 0x23, 0x20, 0x1f, 0x28, 0x22, 0x1f, 0x07, 0x23, 0x23, 0x23, 0x24, 
-    0x22, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2c, 0x34, 0x30, 0x29, 0x0a, 0x31, 0x2f, 
-    0x39, 0x33, 0x33, 0x34, 0x34, 0x33, 0x3c, 0x39, 0x34, 0x0b, 0x3b, 0x39, 0x43, 
-    0x3b, 0x3b, 0x3b, 0x43, 0x3d, 0x0e, 0x43, 0x43, 0x43, 0x4b, 0x49, 0x57, 0x4c, 
-    0x4c, 0x4d, 0x51, 0x49, 0x10, 0x54, 0x54, 0x54, 0x55, 0x53, 0x5a, 0x56, 0x56, 
-    0x6c, 0x58, 0x4b, 0x4d, 0x59, 0x59, 0x6f, 0x5a, 0x57, 0x63, 0x5b, 0x5b, 0x5b, 
-    0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x62, 0x5a, 0x67, 0x63, 
-    0x63, 0x63, 0x64, 0x64, 0x6b, 0x65, 0x65, 0x7a, 0x6a, 0x6a, 0x7d, 0x6c, 0x26, 
-    0x27, 0x6c, 0x6c, 0x6c, 0x6d, 0x58, 0x33, 0x6d, 0x6c, 0x73, 0x6e, 0x5b, 0x17, 
-    0x6e, 0x6e, 0x81, 0x72, 0x68, 0x17, 0x72, 0x69, 0x53, 0x72, 0x72, 0x85, 0x73, 
-    0x2d, 0x2d, 0x73, 0x73, 0x74, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x76, 
-    0x89, 0x77, 0x4b, 0x4c, 0x7b, 0x7b, 0x8c, 0x7c, 0x28, 0x29, 0x7c, 0x7c, 0x7c, 
-    0x7f, 0x65, 0x28, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 0x83, 0x83, 0x84, 0x83, 
-    0x83, 0x94, 0x84, 0x2b, 0x2c, 0x85, 0x83, 0x8e, 0x87, 0x58, 0x58, 0x89, 0x88, 
-    0x96, 0x8a, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x6e, 0x12, 0x8c, 0x8c, 0x8c, 
-    0x8c, 0x8c, 0x9b, 0x8e, 0x30, 0x31, 0x8e, 0x6b, 0x68, 0x8e, 0x77, 0x35, 0x8f, 
-    0x83, 0x1c, 0x90, 0x7f, 0x87, 0x90, 0x90, 0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 
-    0x94, 0x94, 0x94, 0xa2, 0x95, 0x75, 0x24, 0x97, 0x74, 0x0c, 0x98, 0x77, 0x18, 
-    0x99, 0x88, 0x4f, 0x9a, 0x9a, 0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 
-    0x7b, 0x23, 0x9b, 0x7c, 0x2c, 0x9b, 0x7d, 0x32, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 
-    0x1c, 0x9c, 0x7e, 0x38, 0x9d, 0x7b, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x91, 0x24, 
-    0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x35, 0x9e, 0x81, 0x3b, 0x9f, 0x81, 0x2a, 0xa0, 
-    0x37, 0x37, 0xa0, 0x7f, 0x16, 0xa1, 0x85, 0x3c, 0xa2, 0x7f, 0x7f, 0xa2, 0x82, 
-    0x1b, 0xa2, 0x85, 0x34, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x13, 
-    0xa3, 0x84, 0x26, 0xa3, 0xa3, 0xa3, 0xa5, 0x89, 0x45, 0xa5, 0x98, 0x21, 0xa6, 
-    0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x96, 0x6d, 0xa8, 0x88, 0x18, 0xa9, 0x8f, 
-    0x52, 0xaa, 0xaa, 0xb6, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x1b, 0xab, 0x92, 0x54, 
-    0xab, 0xab, 0xab, 0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x18, 0xaf, 
-    0x90, 0x90, 0xaf, 0x95, 0x54, 0xaf, 0x98, 0x5f, 0xaf, 0xa1, 0x24, 0xb2, 0x93, 
-    0x16, 0xb2, 0x94, 0x19, 0xb2, 0x9b, 0x63, 0xb4, 0x9e, 0x6b, 0xb4, 0xb3, 0xb4, 
-    0xb4, 0xb4, 0xbd, 0xb7, 0x99, 0x1a, 0xb7, 0x9c, 0x31, 0xb8, 0x9a, 0x16, 0xb8, 
-    0xa2, 0x6c, 0xb8, 0xb9, 0xc3, 0xb9, 0xa5, 0x74, 0xba, 0x9c, 0x1a, 0xba, 0xa3, 
-    0xa4, 0xbb, 0xa6, 0x24, 0xbb, 0xbb, 0xc4, 0xbc, 0xbb, 0xbc, 0xbd, 0xa7, 0x4b, 
-    0xbd, 0xa9, 0x7a, 0xbe, 0xa2, 0x1b, 0xc1, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 
-    0xaa, 0x2c, 0xc4, 0xb1, 0x71, 0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 0x1e, 0xc7, 0xb2, 
-    0x49, 0xc7, 0xb7, 0x92, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xcb, 0xb9, 0x29, 
-    0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x1f, 0xcd, 0xb2, 0x21, 0xd1, 
-    0xb6, 0x1f, 0xd1, 0xb6, 0x21, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 
-    0xda, 0xd6, 0xc7, 0xc7, 0xd7, 0xbe, 0x25, 0xda, 0xc7, 0x2b, 0xdb, 0xd0, 0xb7, 
-    0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 0x26, 0xde, 0xde, 0xe2, 0xe0, 0xcf, 0x6d, 0xe1, 
-    0xc9, 0x27, 0xe3, 0xda, 0xc7, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe4, 0xda, 
-    0xd8, 0xe5, 0xd1, 0x4d, 0xe6, 0xd1, 0x2c, 0xe6, 0xe6, 0xe9, 0xe7, 0xd3, 0x38, 
-    0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xeb, 0xec, 0xec, 0xe7, 0xd9, 0xef, 
-    0xd8, 0x2d, 0xef, 0xef, 0xf1, 0xf2, 0xdc, 0x2e, 0xf3, 0xee, 0xeb, 0xf3, 0xf3, 
-    0xf4, 0xf4, 0xdf, 0x30, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 0xf8, 0xf8, 0xea, 0x7e, 
-    0xf9, 0xf7, 0xf6, 0xfa, 0xe6, 0x32, 0xfe, 0xed, 0x49, 0xfe, 0xee, 0x62, 0xff, 
-    0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 0x42, 0xff, 0xee, 0x55, 0xff, 0xf0, 
-    0x5e, 0xff, 0xf0, 0x69, 0xff, 0xf2, 0x78, 0xff, 0xf3, 0x85, 0xff, 0xf5, 0x97, 
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xb3, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 
-    0x83, 0x08, 0x13, 0x2a, 0x5c, 0x68, 0x90, 0x18, 0xc3, 0x87, 0x09, 0x75, 0x65, 
-    0xab, 0x95, 0x6d, 0x1a, 0x34, 0x59, 0x10, 0x33, 0x16, 0xdc, 0xd4, 0x4c, 0x9a, 
-    0xab, 0x68, 0xcf, 0x18, 0x65, 0xc3, 0xf4, 0x49, 0xa3, 0x46, 0x62, 0xcf, 0x88, 
-    0x1d, 0xfb, 0xf5, 0x49, 0x18, 0x34, 0x93, 0x1a, 0x7f, 0x3d, 0x7b, 0x86, 0x0c, 
-    0xd9, 0xb3, 0x97, 0x30, 0x21, 0x32, 0x62, 0x36, 0x73, 0x26, 0xb1, 0x5a, 0x22, 
-    0x73, 0x2a, 0x04, 0x74, 0x4a, 0x66, 0xcf, 0xa3, 0xb8, 0x84, 0x16, 0xfc, 0x84, 
-    0xeb, 0x98, 0xb0, 0x5d, 0xaf, 0x90, 0x09, 0x43, 0x39, 0x13, 0x19, 0x2e, 0x64, 
-    0xce, 0x94, 0x0e, 0x3c, 0xc5, 0xf3, 0xd9, 0xab, 0x5d, 0xcc, 0x98, 0x8d, 0xfa, 
-    0x65, 0xb3, 0x27, 0x45, 0xad, 0x02, 0x77, 0x1d, 0x3d, 0xaa, 0xf6, 0x19, 0xb3, 
-    0x5e, 0xbb, 0x90, 0xa1, 0xcd, 0xd6, 0x86, 0xea, 0x51, 0x66, 0xb8, 0x52, 0xd9, 
-    0x14, 0x26, 0x2c, 0x1b, 0x9f, 0xb9, 0xa9, 0x84, 0xad, 0x7d, 0x86, 0xeb, 0x99, 
-    0x5a, 0xbe, 0x12, 0xe7, 0x0a, 0x3c, 0xd5, 0x93, 0x98, 0xab, 0x55, 0xb5, 0x0c, 
-    0xbf, 0x52, 0x4c, 0x10, 0x88, 0x26, 0x5b, 0xb6, 0x72, 0x15, 0x33, 0x16, 0x4b, 
-    0xd4, 0x2b, 0x66, 0xc8, 0x5e, 0x4d, 0x52, 0x0c, 0xa4, 0x93, 0x31, 0x6c, 0xa8, 
-    0x53, 0xa3, 0x4e, 0xa6, 0xe9, 0xd5, 0xcc, 0x5f, 0xa9, 0xb4, 0xba, 0xe1, 0xa5, 
-    0xba, 0x76, 0x6a, 0x55, 0x3c, 0x8c, 0x8e, 0x12, 0x9a, 0xe7, 0xb4, 0x6d, 0xdb, 
-    0x2b, 0x00, 0x4c, 0x70, 0x3d, 0x19, 0xa6, 0x94, 0x61, 0xbf, 0x6d, 0xdf, 0x02, 
-    0xc0, 0x5c, 0xc1, 0xab, 0x55, 0xaf, 0x4e, 0x85, 0x72, 0xf5, 0x0a, 0x23, 0x43, 
-    0x55, 0xc9, 0x6d, 0x57, 0x62, 0xde, 0x3c, 0x46, 0x2a, 0xbb, 0xbf, 0x18, 0x02, 
-    0xff, 0xf1, 0x9d, 0x3d, 0x75, 0x17, 0xee, 0xcc, 0x0d, 0x08, 0x74, 0x25, 0xb3, 
-    0xb8, 0xc2, 0x3a, 0xe5, 0x6b, 0xef, 0x40, 0xcf, 0xbc, 0xc1, 0xc0, 0xa0, 0x0b, 
-    0x29, 0xc5, 0x57, 0x1d, 0x82, 0x3e, 0x80, 0x01, 0x26, 0x91, 0x92, 0x1a, 0x30, 
-    0xb3, 0x94, 0x57, 0x81, 0x7f, 0x00, 0xd8, 0x97, 0x11, 0x2b, 0xa8, 0xa9, 0x72, 
-    0x4b, 0x27, 0xb1, 0x24, 0x93, 0x5c, 0x03, 0x08, 0x02, 0x98, 0xd1, 0x30, 0xb3, 
-    0x54, 0x82, 0x1c, 0x36, 0xbc, 0x90, 0xa2, 0x49, 0x27, 0xa4, 0x30, 0x98, 0x1a, 
-    0x85, 0x08, 0x2e, 0x00, 0x91, 0x22, 0xaa, 0xb0, 0x22, 0xa1, 0x84, 0xb7, 0x00, 
-    0x83, 0x0d, 0x30, 0xc3, 0x24, 0xb3, 0x21, 0x36, 0x07, 0x96, 0xf8, 0xd0, 0x71, 
-    0xc9, 0xdc, 0x82, 0x0d, 0x29, 0x2b, 0x60, 0xf3, 0x03, 0x0d, 0xa8, 0xb5, 0xa8, 
-    0xda, 0x06, 0x08, 0x02, 0xa0, 0xde, 0x42, 0x8a, 0x20, 0x57, 0x20, 0x36, 0x89, 
-    0x64, 0x80, 0x4d, 0x1f, 0x04, 0x6c, 0x58, 0x8a, 0x8b, 0xa8, 0xcd, 0x57, 0xe4, 
-    0x7b, 0x4b, 0xf2, 0x32, 0x8b, 0x8b, 0xb3, 0x74, 0x82, 0x8d, 0x31, 0x95, 0x48, 
-    0x88, 0x8d, 0x2a, 0xb1, 0x98, 0x57, 0x24, 0x00, 0x08, 0x3d, 0x81, 0x9d, 0x6a, 
-    0xc0, 0x88, 0x69, 0x5b, 0x8c, 0xe4, 0x6d, 0x77, 0xa5, 0x41, 0x79, 0xcc, 0xb8, 
-    0xdf, 0x6f, 0xb3, 0x9c, 0x69, 0x90, 0x22, 0x6e, 0xde, 0xf9, 0x5b, 0x32, 0x17, 
-    0xcc, 0x39, 0x90, 0x1b, 0x7d, 0xfa, 0xf9, 0x5b, 0x1c, 0x08, 0x12, 0x50, 0x50, 
-    0x99, 0x86, 0x96, 0x97, 0xa7, 0x7f, 0x47, 0x0a, 0xf4, 0x44, 0xa3, 0xc9, 0xc5, 
-    0xa2, 0x23, 0x36, 0x56, 0xa2, 0xa7, 0xa0, 0x40, 0xfa, 0xa9, 0xa6, 0x4a, 0x17, 
-    0x3b, 0xec, 0x10, 0x07, 0x79, 0xc9, 0x25, 0x43, 0x4a, 0x32, 0xc6, 0xa8, 0x62, 
-    0x4c, 0x1e, 0x01, 0xa0, 0x67, 0x22, 0x41, 0xa5, 0xa8, 0xbe, 0xd6, 0x07, 0x7d, 
-    0x89, 0xc4, 0x17, 0x61, 0x6a, 0xb7, 0x48, 0x51, 0x23, 0x00, 0xaf, 0xc2, 0xaa, 
-    0x5a, 0xa0, 0xe8, 0x55, 0x52, 0xde, 0x30, 0x22, 0xae, 0x96, 0x42, 0x36, 0x11, 
-    0x10, 0xd0, 0xab, 0xaf, 0xa9, 0x69, 0x12, 0xc2, 0x05, 0x34, 0x74, 0xb1, 0x66, 
-    0x76, 0xd3, 0xa2, 0x66, 0x0c, 0x43, 0xb1, 0x52, 0xda, 0x2c, 0xa9, 0xc9, 0xe4, 
-    0xb0, 0xd0, 0x1f, 0xda, 0x62, 0x33, 0x4b, 0x1d, 0xd9, 0x00, 0x71, 0xe9, 0x8b, 
-    0x59, 0xf8, 0xb0, 0x10, 0x6d, 0x86, 0xb2, 0x46, 0xd0, 0x23, 0xd8, 0xe4, 0x12, 
-    0x88, 0x12, 0x46, 0x04, 0xb1, 0x50, 0x1e, 0x85, 0x66, 0xb7, 0x6a, 0x41, 0x4b, 
-    0xa8, 0x41, 0xef, 0x10, 0xa2, 0xe4, 0xc1, 0x10, 0x9f, 0xfb, 0xc5, 0x72, 0x85, 
-    0x41, 0x46, 0x14, 0x91, 0x45, 0x2b, 0xcb, 0xbc, 0xf8, 0xd0, 0x18, 0x2a, 0xfe, 
-    0x36, 0x8c, 0x2a, 0xe4, 0x1e, 0x34, 0x44, 0x2e, 0xb5, 0x69, 0x02, 0x51, 0x0e, 
-    0x7f, 0x80, 0x58, 0x4a, 0x27, 0x94, 0x5c, 0x71, 0x83, 0x42, 0x9d, 0xaa, 0xc6, 
-    0x0b, 0x06, 0x94, 0x19, 0x44, 0xa5, 0x6a, 0xac, 0x30, 0x90, 0x32, 0x41, 0x5e, 
-    0xa2, 0x36, 0xa3, 0x2a, 0x00, 0x64, 0xf0, 0x72, 0x36, 0x84, 0xa6, 0xc6, 0xa8, 
-    0xb8, 0x00, 0x24, 0xf0, 0x32, 0x10, 0x2b, 0x63, 0x53, 0xec, 0x30, 0x02, 0x00, 
-    0x70, 0x81, 0x41, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x8f, 
-    0x00, 0x2c, 0x04, 0x00, 0x03, 0x00, 0x29, 0x00, 0x33, 0x00, 0x87, 0x0c, 0x0c, 
-    0x0c, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 0x1c, 0x1d, 0x23, 0x23, 0x23, 
-    0x2b, 0x2b, 0x2b, 0x30, 0x2f, 0x30, 0x32, 0x32, 0x33, 0x3d, 0x3c, 0x44, 0x41, 
-    0x3f, 0x4d, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4f, 0x4e, 0x5b, 0x54, 0x54, 
-    0x54, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 0x6f, 
-    0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x62, 
-    0x61, 0x6e, 0x62, 0x61, 0x76, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x69, 
-    0x76, 0x6a, 0x6a, 0x7d, 0x6e, 0x4c, 0x51, 0x6e, 0x6e, 0x81, 0x70, 0x2f, 0x2f, 
-    0x70, 0x6e, 0x7b, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 
-    0x36, 0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 
-    0x8c, 0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x80, 0x76, 0x6a, 
-    0x82, 0x4e, 0x4e, 0x83, 0x52, 0x53, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x88, 
-    0x56, 0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x8a, 0x5c, 0x5c, 0x8a, 0x67, 
-    0x10, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x6d, 0x0f, 0x90, 0x90, 0x9e, 
-    0x93, 0x69, 0x69, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x1c, 0x97, 0x78, 0x24, 0x97, 
-    0x78, 0x2c, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9a, 0x7b, 0x24, 0x9b, 0x7c, 
-    0x2c, 0x9b, 0x7d, 0x32, 0x9c, 0x7b, 0x1d, 0x9d, 0x7c, 0x17, 0x9d, 0x9d, 0xaa, 
-    0x9e, 0x80, 0x35, 0x9f, 0x81, 0x26, 0x9f, 0x81, 0x2b, 0xa1, 0x82, 0x2c, 0xa1, 
-    0x84, 0x32, 0xa1, 0x85, 0x3d, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 0xa2, 0x84, 
-    0x24, 0xa2, 0x86, 0x42, 0xa3, 0x84, 0x1b, 0xa4, 0x84, 0x16, 0xa4, 0x88, 0x3d, 
-    0xa4, 0x88, 0x45, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa6, 0x8b, 0x4b, 0xa7, 
-    0x88, 0x23, 0xa9, 0x8e, 0x45, 0xa9, 0x8f, 0x52, 0xaa, 0x8b, 0x1b, 0xab, 0x92, 
-    0x54, 0xac, 0x92, 0x4c, 0xad, 0x95, 0x5b, 0xad, 0xad, 0xb8, 0xaf, 0x90, 0x1a, 
-    0xb0, 0x97, 0x53, 0xb0, 0x97, 0x5d, 0xb2, 0x9b, 0x63, 0xb3, 0x98, 0x39, 0xb4, 
-    0xb4, 0xbe, 0xb5, 0x9e, 0x6b, 0xb6, 0xa0, 0x66, 0xb6, 0xa1, 0x6d, 0xb8, 0xa2, 
-    0x6c, 0xb9, 0xa2, 0x5a, 0xba, 0xa6, 0x78, 0xbc, 0xa3, 0x43, 0xbd, 0xa9, 0x76, 
-    0xbe, 0xa8, 0x67, 0xbe, 0xaa, 0x7b, 0xbf, 0xa6, 0x4a, 0xc0, 0xab, 0x65, 0xc1, 
-    0xad, 0x75, 0xc3, 0xa8, 0x33, 0xc3, 0xac, 0x4a, 0xc4, 0xb3, 0x8b, 0xc6, 0xb8, 
-    0x98, 0xc7, 0xb0, 0x50, 0xca, 0xba, 0x93, 0xcc, 0xba, 0x78, 0xd2, 0xc1, 0x76, 
-    0xd7, 0xcb, 0xae, 0xde, 0xc9, 0x4b, 0xe0, 0xcd, 0x59, 0xe7, 0xd3, 0x47, 0xe9, 
-    0xd9, 0x79, 0xf7, 0xe8, 0x68, 0xfc, 0xe8, 0x37, 0xfe, 0xf5, 0x9a, 0xff, 0xed, 
-    0x3f, 0xff, 0xed, 0x43, 0xff, 0xee, 0x4b, 0xff, 0xee, 0x53, 0xff, 0xef, 0x59, 
-    0xff, 0xef, 0x62, 0xff, 0xf0, 0x64, 0xff, 0xf1, 0x6d, 0xff, 0xf2, 0x73, 0xff, 
-    0xf3, 0x7e, 0xff, 0xf3, 0x83, 0xff, 0xf4, 0x8b, 0xff, 0xf4, 0x93, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xa0, 0x00, 0x1f, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 
-    0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x1d, 0x16, 0x12, 0x08, 0x68, 0xcd, 
-    0xa3, 0x35, 0x76, 0x22, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x0c, 0xb9, 
-    0x80, 0x1c, 0xf9, 0xe8, 0xcf, 0xa1, 0x91, 0x80, 0x0a, 0xa6, 0x34, 0xb8, 0x87, 
-    0xe4, 0xc2, 0x95, 0x2e, 0x1d, 0x62, 0x89, 0xa9, 0xb0, 0x4f, 0x4c, 0x98, 0x34, 
-    0x1f, 0xb6, 0xcc, 0xb9, 0x30, 0x0f, 0xcf, 0x9f, 0x40, 0x83, 0x0a, 0x1d, 0x8a, 
-    0x50, 0x80, 0x46, 0x2a, 0x44, 0x37, 0x4a, 0x48, 0xca, 0xb4, 0x29, 0x4d, 0x32, 
-    0x23, 0x07, 0x34, 0xf4, 0xe1, 0x34, 0xa2, 0x89, 0x8d, 0x48, 0xab, 0x0a, 0xf5, 
-    0xa2, 0x75, 0x28, 0x93, 0xa0, 0x46, 0xbb, 0x8a, 0x1d, 0xc9, 0x75, 0x6c, 0xd0, 
-    0x0e, 0x8f, 0x0e, 0x04, 0x70, 0xb8, 0xd4, 0xac, 0xcb, 0xb2, 0x24, 0x7f, 0xb8, 
-    0x2d, 0x08, 0x77, 0xe3, 0x8a, 0x2a, 0x02, 0x61, 0x3c, 0xaa, 0x8b, 0x10, 0xaa, 
-    0xc7, 0x1c, 0x49, 0x67, 0xc4, 0xa4, 0xaa, 0x71, 0xc1, 0x5c, 0xa0, 0x0a, 0x0e, 
-    0xff, 0x4c, 0x60, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0xd7, 
-    0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x00, 0x00, 
-    0x00, 0x0b, 0x0a, 0x05, 0x0b, 0x0b, 0x0c, 0x0e, 0x0e, 0x12, 0x11, 0x0f, 0x04, 
-    0x14, 0x13, 0x14, 0x17, 0x16, 0x1a, 0x19, 0x17, 0x05, 0x1c, 0x1c, 0x1c, 0x1c, 
-    0x1c, 0x23, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 0x25, 0x1f, 
-    0x06, 0x2b, 0x26, 0x08, 0x2b, 0x2b, 0x2c, 0x31, 0x2f, 0x36, 0x33, 0x33, 0x33, 
-    0x34, 0x33, 0x3c, 0x38, 0x33, 0x0b, 0x3a, 0x39, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 
-    0x43, 0x44, 0x43, 0x43, 0x48, 0x47, 0x3e, 0x0c, 0x4b, 0x49, 0x57, 0x4c, 0x4c, 
-    0x4d, 0x51, 0x4a, 0x10, 0x54, 0x54, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x55, 0x63, 
-    0x56, 0x56, 0x6c, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4e, 0x5c, 
-    0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x64, 0x64, 0x64, 
-    0x6b, 0x65, 0x65, 0x7a, 0x6a, 0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6b, 0x5d, 0x20, 
-    0x6b, 0x6b, 0x6c, 0x6c, 0x26, 0x27, 0x6d, 0x6d, 0x72, 0x6e, 0x6e, 0x81, 0x70, 
-    0x6e, 0x7b, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 0x73, 0x73, 0x74, 0x75, 0x75, 
-    0x7e, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x76, 0x88, 0x78, 0x4b, 0x4b, 
-    0x79, 0x6e, 0x18, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8d, 0x7c, 0x28, 0x29, 0x7f, 
-    0x7f, 0x90, 0x82, 0x4d, 0x4d, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x84, 
-    0x84, 0x86, 0x79, 0x1a, 0x87, 0x58, 0x58, 0x8a, 0x2e, 0x2e, 0x8a, 0x89, 0x95, 
-    0x8b, 0x2f, 0x30, 0x8b, 0x8b, 0x8c, 0x8c, 0x6a, 0x0c, 0x8c, 0x8c, 0x9b, 0x8e, 
-    0x30, 0x31, 0x90, 0x82, 0x1c, 0x90, 0x90, 0x9e, 0x91, 0x66, 0x66, 0x93, 0x32, 
-    0x32, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x76, 0x27, 0x98, 0x77, 0x17, 
-    0x98, 0x88, 0x4c, 0x99, 0x77, 0x0d, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 
-    0x7b, 0x1c, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2c, 0x9b, 0x9b, 0xa5, 0x9b, 0x9c, 
-    0x9c, 0x9c, 0x7d, 0x33, 0x9d, 0x82, 0x36, 0x9d, 0x82, 0x84, 0x9d, 0x91, 0x23, 
-    0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x2b, 0x9e, 0x81, 0x3b, 0xa0, 0x37, 0x37, 0xa1, 
-    0x7f, 0x11, 0xa1, 0x84, 0x3c, 0xa2, 0x7f, 0x7f, 0xa2, 0x82, 0x1b, 0xa2, 0x86, 
-    0x42, 0xa2, 0xa2, 0xae, 0xa3, 0x84, 0x26, 0xa3, 0x85, 0x35, 0xa3, 0xa3, 0xa4, 
-    0xa5, 0x84, 0x14, 0xa6, 0x8b, 0x49, 0xa6, 0xa6, 0xb1, 0xa9, 0x8f, 0x51, 0xa9, 
-    0x9a, 0x22, 0xaa, 0x8b, 0x14, 0xab, 0x8b, 0x15, 0xab, 0x8c, 0x19, 0xab, 0x91, 
-    0x54, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xac, 0x92, 0x45, 0xad, 0x95, 0x5b, 
-    0xae, 0xae, 0xb9, 0xaf, 0x90, 0x90, 0xb1, 0x99, 0x5f, 0xb2, 0x94, 0x16, 0xb2, 
-    0x9a, 0x64, 0xb3, 0x95, 0x1a, 0xb3, 0x97, 0x32, 0xb3, 0xb3, 0xb4, 0xb4, 0x9e, 
-    0x6a, 0xb4, 0xa6, 0x25, 0xb4, 0xb4, 0xbd, 0xb6, 0x99, 0x18, 0xb8, 0xa2, 0x6d, 
-    0xb8, 0xa7, 0x25, 0xba, 0x9d, 0x19, 0xba, 0xa3, 0xa4, 0xbb, 0xa7, 0x76, 0xbb, 
-    0xbb, 0xc4, 0xbc, 0xa4, 0x4c, 0xbc, 0xbc, 0xbc, 0xbe, 0xa1, 0x1a, 0xbf, 0xad, 
-    0x80, 0xc1, 0xae, 0x82, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcb, 
-    0xc5, 0xb2, 0x6f, 0xc6, 0xaa, 0x1d, 0xc6, 0xb5, 0x8b, 0xc7, 0xb5, 0x28, 0xc8, 
-    0xb3, 0x49, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xca, 0xaf, 0x20, 0xcb, 0xbc, 
-    0x97, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x1f, 0xce, 0xb4, 0x21, 
-    0xd1, 0xb6, 0x21, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 
-    0xc7, 0xc7, 0xd7, 0xbe, 0x25, 0xd8, 0xcd, 0xb2, 0xdb, 0xc7, 0x2b, 0xdb, 0xdb, 
-    0xdd, 0xdc, 0xc4, 0x26, 0xdc, 0xc4, 0x32, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x28, 
-    0xe2, 0xc9, 0x27, 0xe2, 0xcf, 0x5d, 0xe3, 0xcc, 0x3b, 0xe3, 0xdb, 0xc8, 0xe3, 
-    0xe3, 0xe4, 0xe4, 0xcc, 0x29, 0xe4, 0xda, 0xd8, 0xe6, 0xd1, 0x2d, 0xe6, 0xe6, 
-    0xe9, 0xea, 0xd4, 0x2c, 0xea, 0xd7, 0x33, 0xea, 0xe4, 0xd6, 0xea, 0xe4, 0xe4, 
-    0xeb, 0xeb, 0xec, 0xed, 0xe2, 0xa4, 0xef, 0xd9, 0x2d, 0xef, 0xef, 0xf1, 0xf2, 
-    0xdc, 0x2e, 0xf2, 0xed, 0xe8, 0xf3, 0xde, 0x31, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 
-    0xeb, 0xf6, 0xe0, 0x2f, 0xf6, 0xe1, 0x31, 0xf7, 0xe9, 0x76, 0xf7, 0xf7, 0xf8, 
-    0xf8, 0xee, 0x99, 0xf9, 0xe5, 0x32, 0xf9, 0xf7, 0xf5, 0xfe, 0xed, 0x59, 0xfe, 
-    0xee, 0x61, 0xfe, 0xf5, 0x97, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 
-    0x43, 0xff, 0xed, 0x4b, 0xff, 0xf0, 0x56, 0xff, 0xf0, 0x69, 0xff, 0xf2, 0x77, 
-    0xff, 0xf3, 0x87, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xff, 0x00, 0xaf, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 
-    0x5c, 0x98, 0x6c, 0xa1, 0xc3, 0x85, 0xa6, 0xae, 0x41, 0xfb, 0xf5, 0xb0, 0x62, 
-    0xc1, 0x68, 0xd1, 0xa0, 0xd5, 0x2a, 0xd6, 0xeb, 0x9a, 0x23, 0x58, 0xc5, 0x2c, 
-    0x3e, 0x64, 0x54, 0xcb, 0x99, 0xb3, 0x5a, 0xc4, 0x18, 0x15, 0x73, 0x26, 0xb2, 
-    0xa2, 0x23, 0x93, 0x26, 0x93, 0x39, 0x8b, 0xd6, 0x72, 0x24, 0x4c, 0x93, 0xbf, 
-    0x6e, 0xd5, 0x1a, 0x55, 0x33, 0x61, 0xa1, 0x5b, 0x37, 0x63, 0x66, 0xc4, 0xd4, 
-    0x73, 0x20, 0xa3, 0x55, 0xab, 0x6a, 0xfd, 0x4a, 0x86, 0x2b, 0xd8, 0x4a, 0x93, 
-    0xb7, 0x3e, 0x15, 0x1d, 0x38, 0x4a, 0xe6, 0x2c, 0x53, 0xb5, 0x92, 0xa1, 0xc2, 
-    0xd5, 0xea, 0x66, 0x32, 0x46, 0x53, 0x11, 0xc9, 0x74, 0xd6, 0x6b, 0xac, 0xb3, 
-    0x64, 0x4f, 0x77, 0xae, 0x9a, 0x7a, 0xcd, 0x54, 0xd0, 0xb7, 0xc9, 0x6a, 0xbd, 
-    0x62, 0x8b, 0xc8, 0x6d, 0x50, 0x5c, 0xb5, 0x6a, 0xdd, 0xba, 0x65, 0x6a, 0xd5, 
-    0xdc, 0xa9, 0xad, 0x6e, 0x99, 0x75, 0x36, 0x2b, 0x18, 0x4c, 0x58, 0x8e, 0xd8, 
-    0x5e, 0xfb, 0xc1, 0x29, 0xd6, 0x29, 0x9d, 0xbc, 0x72, 0x71, 0x7a, 0x45, 0x99, 
-    0xd7, 0x2a, 0xb2, 0xab, 0x00, 0xf5, 0x4c, 0x63, 0xcb, 0x9a, 0xe7, 0xcf, 0xa0, 
-    0x3d, 0x8b, 0xca, 0x81, 0xcb, 0x59, 0x30, 0x44, 0x2d, 0xef, 0x08, 0x0b, 0xcd, 
-    0xda, 0xb3, 0x0b, 0x00, 0x13, 0x50, 0x39, 0x0b, 0x25, 0x12, 0x8a, 0xaf, 0xd6, 
-    0xac, 0x65, 0x01, 0xd8, 0xdd, 0xc0, 0x54, 0x62, 0x8b, 0xa2, 0x70, 0xb3, 0x6e, 
-    0xb4, 0x9b, 0xf7, 0x25, 0x8b, 0x3f, 0x56, 0x0b, 0x07, 0xbd, 0xa5, 0xf8, 0xee, 
-    0x15, 0xb7, 0x2a, 0x3d, 0x7c, 0xb3, 0x3c, 0xb4, 0x0e, 0xe7, 0xbb, 0x0f, 0x05, 
-    0x03, 0xbb, 0x70, 0x51, 0x75, 0xd0, 0x21, 0xb0, 0xc3, 0xff, 0x0e, 0x56, 0xcb, 
-    0x61, 0xa7, 0xcf, 0xbb, 0x58, 0x2d, 0xaf, 0x20, 0x1e, 0xc0, 0x20, 0x67, 0x85, 
-    0x16, 0x92, 0x12, 0x2d, 0x6b, 0x52, 0xaa, 0x63, 0xb8, 0x1f, 0xb4, 0x9f, 0xa0, 
-    0x79, 0xa1, 0x2f, 0x56, 0x8d, 0xdc, 0x66, 0x8d, 0x2d, 0x9d, 0x48, 0x32, 0x49, 
-    0x27, 0xf3, 0x7d, 0xa6, 0x5f, 0x7b, 0x0b, 0x2c, 0x44, 0x88, 0x28, 0xa4, 0xe0, 
-    0xb7, 0x9a, 0x2c, 0xbb, 0x58, 0xb3, 0x8b, 0x2f, 0xc7, 0x08, 0x68, 0x0d, 0x7b, 
-    0x0c, 0x2a, 0x64, 0xdb, 0x31, 0xb2, 0x58, 0xd3, 0x09, 0x0b, 0xd6, 0x04, 0x31, 
-    0x83, 0x67, 0x14, 0x82, 0xc6, 0x41, 0x7b, 0x00, 0x18, 0x90, 0x10, 0x21, 0xb7, 
-    0xa9, 0x67, 0x4d, 0x20, 0x1a, 0x58, 0x63, 0x47, 0x01, 0x02, 0x7a, 0x52, 0xa1, 
-    0x67, 0xd7, 0xb1, 0x78, 0xd0, 0x1b, 0xa9, 0x78, 0x66, 0x0b, 0x2b, 0x15, 0xb2, 
-    0x32, 0x89, 0x35, 0xc2, 0x34, 0x82, 0x9f, 0x35, 0xa2, 0x04, 0xe9, 0x59, 0x73, 
-    0x3e, 0x12, 0xc4, 0x44, 0x70, 0xa0, 0xed, 0xb2, 0x24, 0x6b, 0x18, 0x2a, 0x67, 
-    0x0d, 0x71, 0x51, 0x0a, 0x74, 0x87, 0x86, 0xdf, 0xb5, 0xc6, 0x0a, 0x8b, 0x00, 
-    0x0c, 0x44, 0xc8, 0x95, 0x61, 0xb6, 0x76, 0x8c, 0x05, 0x51, 0xa6, 0x81, 0x66, 
-    0x9a, 0xa0, 0xf9, 0xb2, 0x1a, 0x1b, 0xed, 0x15, 0x20, 0x90, 0x93, 0x70, 0x86, 
-    0xd6, 0x89, 0x2c, 0xac, 0x34, 0xd9, 0x9e, 0x8b, 0x4c, 0xe4, 0xc9, 0xda, 0x7d, 
-    0x9f, 0x79, 0xd2, 0xa3, 0x73, 0x0f, 0x5c, 0xe3, 0x1d, 0x68, 0xa2, 0x6c, 0xa1, 
-    0x83, 0x0e, 0x5b, 0x68, 0x89, 0x9b, 0x27, 0x55, 0xde, 0x11, 0x80, 0x73, 0x0d, 
-    0x5e, 0x43, 0xe9, 0x67, 0x76, 0x60, 0x17, 0xc8, 0x72, 0xa4, 0x80, 0x69, 0x0d, 
-    0x14, 0x1c, 0x02, 0x90, 0xc0, 0x40, 0x9b, 0x7a, 0xc6, 0xa6, 0x73, 0x8d, 0x80, 
-    0x1a, 0xda, 0x31, 0x2a, 0x5c, 0xa8, 0x13, 0x41, 0x01, 0x99, 0x0a, 0x94, 0xaa, 
-    0x35, 0x92, 0x84, 0x70, 0xc1, 0x0c, 0x5b, 0x50, 0x89, 0xdb, 0x31, 0x78, 0x7a, 
-    0x26, 0x4c, 0x42, 0xb7, 0xe6, 0x29, 0x4c, 0x27, 0x92, 0x1e, 0xb3, 0x03, 0x42, 
-    0x77, 0x08, 0xea, 0x19, 0x2b, 0x69, 0x2c, 0x16, 0xa2, 0x67, 0xbb, 0x58, 0xe1, 
-    0x03, 0x42, 0x9d, 0xc1, 0x79, 0xcc, 0x24, 0x04, 0x11, 0x62, 0x0d, 0x2d, 0x7b, 
-    0x28, 0x61, 0x04, 0x10, 0xcc, 0xbe, 0x29, 0x9c, 0x30, 0x77, 0x14, 0xd4, 0x84, 
-    0x19, 0x4a, 0x10, 0x31, 0x84, 0x26, 0xe9, 0x22, 0x74, 0xe6, 0x77, 0xa9, 0x68, 
-    0x61, 0x90, 0x11, 0x44, 0x58, 0x51, 0x0a, 0x7e, 0xbb, 0x28, 0x04, 0x46, 0x84, 
-    0xad, 0xf9, 0x22, 0xca, 0x1b, 0x08, 0x0d, 0x41, 0x4b, 0x68, 0xdc, 0x2a, 0xb4, 
-    0x83, 0x1e, 0x07, 0x7a, 0x32, 0xc9, 0x22, 0x50, 0xdc, 0xa0, 0xd0, 0xa2, 0xa0, 
-    0xd9, 0x92, 0x81, 0x62, 0x06, 0xed, 0x08, 0x1a, 0x29, 0x0c, 0x60, 0x4c, 0xd0, 
-    0x91, 0x9e, 0x69, 0x28, 0x0a, 0x00, 0x1a, 0x78, 0x7c, 0x8d, 0x9b, 0x9f, 0xe1, 
-    0x39, 0xa6, 0x02, 0x1e, 0xff, 0xa0, 0xb1, 0x35, 0x09, 0x5a, 0xe3, 0x8b, 0x00, 
-    0x00, 0x5c, 0x30, 0x50, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x92, 
-    0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 
-    0x0c, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x2b, 0x2b, 0x2b, 
-    0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x44, 0x3e, 0x38, 0x2a, 0x41, 
-    0x3f, 0x4d, 0x42, 0x42, 0x43, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 
-    0x4d, 0x4f, 0x4e, 0x5b, 0x53, 0x53, 0x54, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 
-    0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 
-    0x5e, 0x6b, 0x62, 0x61, 0x76, 0x63, 0x62, 0x6c, 0x64, 0x63, 0x65, 0x65, 0x65, 
-    0x7a, 0x68, 0x5e, 0x55, 0x6a, 0x69, 0x76, 0x6a, 0x6a, 0x7d, 0x6e, 0x4c, 0x51, 
-    0x70, 0x2f, 0x2f, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 
-    0x36, 0x36, 0x77, 0x3d, 0x3d, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 0x46, 
-    0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x82, 0x4e, 0x4e, 0x83, 0x6d, 0x14, 
-    0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x85, 0x54, 0x55, 0x88, 
-    0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 
-    0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x93, 0x69, 0x69, 0x94, 0x94, 0xa2, 
-    0x95, 0x75, 0x22, 0x97, 0x75, 0x17, 0x97, 0x77, 0x2a, 0x97, 0x78, 0x2b, 0x98, 
-    0x76, 0x17, 0x98, 0x77, 0x1f, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9a, 0x82, 
-    0x49, 0x9b, 0x7a, 0x1c, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2c, 0x9c, 0x7d, 0x33, 
-    0x9e, 0x81, 0x36, 0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x25, 0xa0, 0x83, 0x35, 0xa1, 
-    0x82, 0x2b, 0xa1, 0x85, 0x3d, 0xa1, 0xa1, 0xad, 0xa2, 0x82, 0x1a, 0xa2, 0x83, 
-    0x23, 0xa2, 0x86, 0x42, 0xa5, 0x89, 0x46, 0xa5, 0x8a, 0x4b, 0xa5, 0xa5, 0xb1, 
-    0xa6, 0x83, 0x83, 0xa7, 0x8a, 0x35, 0xa7, 0x8e, 0x51, 0xa8, 0x8d, 0x4f, 0xa9, 
-    0x8b, 0x23, 0xa9, 0x8f, 0x51, 0xaa, 0x91, 0x55, 0xac, 0x92, 0x43, 0xac, 0x92, 
-    0x4a, 0xad, 0x95, 0x5b, 0xad, 0xad, 0xb8, 0xae, 0x92, 0x35, 0xaf, 0x91, 0x21, 
-    0xb1, 0x94, 0x36, 0xb1, 0x9a, 0x5f, 0xb1, 0x9a, 0x64, 0xb3, 0x97, 0x2f, 0xb4, 
-    0x9e, 0x6a, 0xb4, 0xb4, 0xbe, 0xb5, 0x9a, 0x37, 0xb6, 0xa0, 0x6e, 0xb7, 0xa2, 
-    0x70, 0xb8, 0xa3, 0x6d, 0xb9, 0x9d, 0x22, 0xba, 0xa1, 0x42, 0xba, 0xa5, 0x75, 
-    0xbc, 0xa4, 0x4e, 0xbd, 0xa1, 0x28, 0xbd, 0xa6, 0x53, 0xbe, 0xaa, 0x7b, 0xbf, 
-    0xa9, 0x67, 0xc0, 0xad, 0x7c, 0xc1, 0xaf, 0x84, 0xc3, 0xb1, 0x86, 0xc5, 0xae, 
-    0x4e, 0xca, 0xb6, 0x61, 0xca, 0xba, 0x8e, 0xcb, 0xbb, 0x93, 0xcd, 0xbe, 0x98, 
-    0xd4, 0xc7, 0xa7, 0xd8, 0xc1, 0x40, 0xdd, 0xcb, 0x63, 0xe6, 0xdb, 0xa0, 0xe7, 
-    0xd4, 0x5c, 0xec, 0xdc, 0x75, 0xf7, 0xe6, 0x5b, 0xfe, 0xed, 0x53, 0xfe, 0xf4, 
-    0x94, 0xfe, 0xf7, 0xaf, 0xff, 0xec, 0x3d, 0xff, 0xed, 0x44, 0xff, 0xed, 0x4b, 
-    0xff, 0xef, 0x5c, 0xff, 0xf0, 0x53, 0xff, 0xf0, 0x5c, 0xff, 0xf0, 0x65, 0xff, 
-    0xf0, 0x6c, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x7d, 0xff, 0xf2, 0x83, 0xff, 0xf3, 
-    0x8a, 0xff, 0xf5, 0x98, 0xff, 0xf6, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0xbb, 0x00, 0x25, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 
-    0x5c, 0xc8, 0xb0, 0xa1, 0xc2, 0x3d, 0x92, 0x0c, 0x39, 0x9c, 0x68, 0xb0, 0x10, 
-    0x41, 0x37, 0x14, 0x1d, 0x62, 0x24, 0xf8, 0x26, 0xe3, 0xc4, 0x8d, 0x04, 0x2d, 
-    0x7a, 0x1c, 0x49, 0x32, 0xa1, 0x99, 0x84, 0x86, 0xec, 0x94, 0x94, 0xb4, 0x06, 
-    0xe2, 0xca, 0x97, 0x1c, 0x4b, 0x9e, 0x6c, 0xe8, 0x12, 0xa6, 0x4d, 0x84, 0x20, 
-    0x17, 0xf2, 0xb9, 0x99, 0x30, 0x27, 0xc9, 0x3c, 0x92, 0xfa, 0x48, 0xf2, 0x23, 
-    0x34, 0x8f, 0x9f, 0xa3, 0x7d, 0x76, 0x0a, 0x9c, 0xc9, 0x33, 0xa1, 0x9a, 0xa6, 
-    0x50, 0x33, 0xee, 0x59, 0x13, 0xb5, 0x2a, 0xc5, 0x3a, 0x0d, 0xa5, 0x58, 0xdd, 
-    0xca, 0x75, 0x29, 0x4f, 0x02, 0x08, 0x99, 0xda, 0x04, 0x3b, 0xb2, 0x0c, 0x45, 
-    0x03, 0x08, 0x07, 0x28, 0xfc, 0x71, 0x53, 0x40, 0xd3, 0x12, 0x14, 0xb5, 0x76, 
-    0x9d, 0xdb, 0x65, 0xae, 0x5d, 0x26, 0x5c, 0xdd, 0xce, 0xd5, 0xdb, 0x94, 0x85, 
-    0x41, 0xb2, 0x76, 0xa3, 0xa2, 0x15, 0xa8, 0x76, 0x6b, 0x81, 0x00, 0x0b, 0x27, 
-    0x04, 0x5e, 0x69, 0x02, 0x61, 0xdd, 0xc5, 0x25, 0xcd, 0xda, 0x9d, 0xe2, 0x50, 
-    0x72, 0xc9, 0x1b, 0x5d, 0x67, 0xd8, 0x64, 0xeb, 0x91, 0x01, 0xe4, 0xb9, 0x0b, 
-    0x6e, 0xe2, 0xfd, 0xbc, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 
-    0xd6, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x00, 
-    0x00, 0x00, 0x0b, 0x0a, 0x05, 0x0c, 0x0b, 0x0c, 0x0f, 0x0f, 0x0d, 0x14, 0x14, 
-    0x14, 0x17, 0x16, 0x1a, 0x19, 0x16, 0x06, 0x1b, 0x1b, 0x1c, 0x1e, 0x1e, 0x25, 
-    0x23, 0x22, 0x23, 0x24, 0x23, 0x2b, 0x26, 0x1f, 0x06, 0x2a, 0x25, 0x08, 0x2b, 
-    0x2b, 0x2b, 0x2f, 0x2d, 0x3a, 0x33, 0x33, 0x33, 0x34, 0x33, 0x3c, 0x38, 0x33, 
-    0x0b, 0x3b, 0x3a, 0x43, 0x3c, 0x3c, 0x3c, 0x43, 0x3d, 0x0d, 0x44, 0x43, 0x44, 
-    0x4b, 0x4a, 0x56, 0x4c, 0x4c, 0x4d, 0x52, 0x4a, 0x10, 0x54, 0x54, 0x55, 0x55, 
-    0x54, 0x5c, 0x56, 0x55, 0x63, 0x56, 0x56, 0x6c, 0x59, 0x59, 0x6e, 0x5b, 0x5b, 
-    0x5c, 0x5c, 0x42, 0x4e, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 
-    0x62, 0x5a, 0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6c, 0x64, 0x5b, 0x14, 0x65, 
-    0x65, 0x7a, 0x6a, 0x6a, 0x7d, 0x6b, 0x6b, 0x6c, 0x6c, 0x26, 0x27, 0x6d, 0x6c, 
-    0x73, 0x6e, 0x6e, 0x81, 0x72, 0x5e, 0x2d, 0x72, 0x6e, 0x77, 0x72, 0x72, 0x85, 
-    0x73, 0x73, 0x74, 0x75, 0x28, 0x29, 0x75, 0x6d, 0x56, 0x75, 0x75, 0x7e, 0x76, 
-    0x38, 0x38, 0x76, 0x76, 0x88, 0x7a, 0x49, 0x4a, 0x7b, 0x6f, 0x18, 0x7b, 0x7b, 
-    0x8c, 0x7c, 0x28, 0x29, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 
-    0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x83, 0x8f, 0x84, 0x84, 0x84, 0x87, 
-    0x58, 0x58, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8a, 0x70, 0x14, 0x8b, 0x2f, 
-    0x30, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8d, 0x80, 0x1c, 0x8e, 0x30, 0x31, 
-    0x8f, 0x69, 0x6a, 0x90, 0x90, 0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 0x93, 0x94, 
-    0x75, 0x26, 0x94, 0x94, 0xa2, 0x95, 0x88, 0x1d, 0x97, 0x74, 0x0c, 0x99, 0x78, 
-    0x19, 0x99, 0x8c, 0x59, 0x9a, 0x9a, 0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 
-    0x9b, 0x7c, 0x2c, 0x9c, 0x7c, 0x1b, 0x9c, 0x7c, 0x24, 0x9c, 0x7e, 0x32, 0x9c, 
-    0x7e, 0x38, 0x9c, 0x9c, 0x9c, 0x9d, 0x7b, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x91, 
-    0x23, 0x9d, 0x9d, 0xaa, 0x9e, 0x82, 0x38, 0x9f, 0x80, 0x2a, 0xa0, 0x37, 0x37, 
-    0xa0, 0x7f, 0x10, 0xa0, 0x83, 0x34, 0xa0, 0x84, 0x3d, 0xa2, 0x7f, 0x7f, 0xa2, 
-    0x82, 0x19, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa4, 0x84, 0x13, 0xa4, 0xa3, 
-    0xa4, 0xa5, 0x86, 0x27, 0xa5, 0x8a, 0x48, 0xa5, 0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 
-    0xa7, 0x97, 0x22, 0xab, 0x8c, 0x15, 0xab, 0x8c, 0x1a, 0xab, 0x92, 0x55, 0xab, 
-    0xab, 0xab, 0xab, 0xab, 0xb6, 0xac, 0x92, 0x50, 0xae, 0x96, 0x5c, 0xae, 0xae, 
-    0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x90, 0x90, 0xaf, 0x98, 0x61, 0xb1, 0x9b, 0x63, 
-    0xb2, 0x93, 0x16, 0xb3, 0xb3, 0xb3, 0xb4, 0x95, 0x19, 0xb4, 0xb4, 0xbd, 0xb5, 
-    0x9f, 0x6a, 0xb6, 0x99, 0x19, 0xb7, 0xa1, 0x6d, 0xb7, 0xa6, 0x2b, 0xb9, 0x9d, 
-    0x2d, 0xba, 0x9c, 0x17, 0xba, 0x9d, 0x1a, 0xba, 0xa3, 0xa4, 0xba, 0xaa, 0x25, 
-    0xbb, 0xa2, 0x4b, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xc4, 0xbc, 0xa8, 0x78, 0xbe, 
-    0xa1, 0x1a, 0xc1, 0xae, 0x82, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 
-    0xcb, 0xc4, 0xb0, 0x6f, 0xc4, 0xb2, 0x88, 0xc6, 0xaa, 0x1d, 0xc9, 0xad, 0x1e, 
-    0xc9, 0xb5, 0x4a, 0xc9, 0xb6, 0xb7, 0xca, 0xb8, 0x29, 0xcb, 0xb1, 0x2b, 0xcc, 
-    0xb1, 0x1f, 0xcc, 0xbc, 0x97, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd2, 0xce, 0xb3, 
-    0x21, 0xd0, 0xb5, 0x1f, 0xd1, 0xb6, 0x22, 0xd3, 0xc5, 0x94, 0xd3, 0xd3, 0xd4, 
-    0xd4, 0xba, 0x22, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd7, 0xbe, 0x25, 0xd7, 
-    0xcb, 0xaf, 0xd9, 0xc7, 0x2b, 0xdb, 0xc8, 0x62, 0xdb, 0xdb, 0xde, 0xdc, 0xc3, 
-    0x26, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x26, 0xe1, 0xc9, 0x27, 0xe3, 0xe3, 0xe5, 
-    0xe4, 0xcc, 0x29, 0xe4, 0xda, 0xd3, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2c, 0xea, 
-    0xd7, 0x32, 0xea, 0xe4, 0xe4, 0xeb, 0xd5, 0x2c, 0xeb, 0xeb, 0xec, 0xed, 0xe7, 
-    0xda, 0xee, 0xda, 0x4c, 0xef, 0xd9, 0x2d, 0xef, 0xef, 0xf1, 0xf1, 0xed, 0xe6, 
-    0xf2, 0xdc, 0x2f, 0xf4, 0xdf, 0x31, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 0xeb, 0xf6, 
-    0xe1, 0x31, 0xf6, 0xe3, 0x49, 0xf7, 0xe2, 0x2f, 0xf7, 0xf7, 0xf8, 0xf9, 0xf7, 
-    0xf5, 0xfa, 0xe5, 0x32, 0xfc, 0xeb, 0x5b, 0xfd, 0xee, 0x69, 0xfe, 0xeb, 0x3b, 
-    0xfe, 0xee, 0x54, 0xff, 0xeb, 0x34, 0xff, 0xed, 0x43, 0xff, 0xed, 0x4b, 0xff, 
-    0xf0, 0x69, 0xff, 0xf1, 0x59, 0xff, 0xf1, 0x74, 0xff, 0xf4, 0x88, 0xff, 0xf6, 
-    0x9a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0xff, 0x00, 0xad, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 
-    0x2a, 0x54, 0xc8, 0x8c, 0xd7, 0xc2, 0x87, 0x0b, 0x5b, 0x59, 0x73, 0x56, 0x6b, 
-    0xa0, 0x21, 0x88, 0x18, 0x57, 0x0d, 0x5b, 0x46, 0xb1, 0x58, 0xc5, 0x4d, 0xb8, 
-    0x9e, 0x61, 0x1c, 0x09, 0xab, 0x59, 0x33, 0x5c, 0xb6, 0x4a, 0x71, 0x1c, 0x39, 
-    0xd2, 0x90, 0xc9, 0x66, 0xc8, 0x96, 0x21, 0x5b, 0xc5, 0x12, 0xe3, 0xa6, 0x97, 
-    0x26, 0x87, 0x21, 0x43, 0xf6, 0xaa, 0xa6, 0xc2, 0x48, 0xb6, 0x70, 0xc2, 0xb4, 
-    0xf5, 0xec, 0x19, 0x26, 0x9f, 0x04, 0x1f, 0xb5, 0x6a, 0x55, 0x8b, 0x57, 0x31, 
-    0x59, 0x4e, 0x5f, 0x22, 0x93, 0x88, 0x74, 0x20, 0x2a, 0x64, 0xcd, 0x64, 0xa1, 
-    0xe2, 0xb5, 0xac, 0x96, 0xad, 0x92, 0x26, 0x91, 0x89, 0xac, 0x6a, 0xcd, 0x10, 
-    0xd6, 0x66, 0xbc, 0xce, 0xc2, 0x5c, 0x66, 0xb2, 0xe2, 0x22, 0xb2, 0xd6, 0x50, 
-    0x09, 0x9d, 0x8b, 0xac, 0x16, 0x4d, 0xb8, 0xa5, 0xe6, 0xe2, 0xaa, 0xc5, 0x57, 
-    0xd6, 0xa0, 0x48, 0x77, 0xab, 0x82, 0xc2, 0xa5, 0x96, 0x27, 0x30, 0x93, 0xcb, 
-    0x64, 0x3d, 0x82, 0x6b, 0xad, 0x47, 0xa5, 0x51, 0xa3, 0xf6, 0xa6, 0xd2, 0x95, 
-    0x6a, 0x95, 0xe5, 0x51, 0xab, 0x96, 0xf1, 0x6a, 0x75, 0xd1, 0xa7, 0x9a, 0x5c, 
-    0xd5, 0x42, 0x8b, 0x1e, 0x1d, 0x9a, 0xd4, 0x8d, 0xa0, 0xc0, 0x3a, 0x8f, 0xb4, 
-    0x13, 0x8c, 0xb4, 0xeb, 0xd0, 0x2b, 0x00, 0x44, 0x50, 0xd5, 0x4c, 0x14, 0xcb, 
-    0x27, 0xbd, 0x5e, 0xbb, 0x8e, 0x05, 0xa0, 0xf7, 0x02, 0x55, 0xaa, 0x21, 0x92, 
-    0xd2, 0xed, 0x9a, 0x51, 0x6f, 0xdf, 0x96, 0x46, 0xf6, 0x68, 0x4d, 0x7c, 0x34, 
-    0x97, 0xe3, 0xbd, 0x4d, 0xa8, 0xc2, 0x08, 0xa7, 0x39, 0x69, 0x1d, 0xd0, 0x7b, 
-    0x2b, 0xea, 0xf9, 0xb0, 0x91, 0xf5, 0xd1, 0x1e, 0xb2, 0xcb, 0xff, 0xfe, 0xb5, 
-    0x78, 0xa1, 0x27, 0xd1, 0xb9, 0x5c, 0x35, 0x9f, 0x20, 0x1e, 0x40, 0x21, 0x54, 
-    0x0f, 0x4d, 0x95, 0x8e, 0xe5, 0x89, 0x95, 0x31, 0xdd, 0x0d, 0xda, 0x53, 0x78, 
-    0xbb, 0xb0, 0x97, 0x2b, 0x46, 0xb9, 0x55, 0x43, 0x8b, 0x27, 0x92, 0x4c, 0xe2, 
-    0x89, 0x7c, 0xa2, 0xe5, 0xd7, 0x5e, 0x02, 0x0b, 0x05, 0x42, 0x8a, 0x29, 0xf7, 
-    0xb5, 0x16, 0x0b, 0x68, 0xb9, 0xf4, 0x62, 0x4c, 0x80, 0xd5, 0xb0, 0xd7, 0x1e, 
-    0x02, 0x0a, 0xe1, 0x66, 0x4c, 0x2c, 0xd5, 0x78, 0x92, 0x42, 0x35, 0x40, 0xc0, 
-    0x10, 0xda, 0x84, 0xa3, 0x65, 0xd0, 0x1e, 0x00, 0x07, 0x24, 0x14, 0x48, 0x6e, 
-    0xea, 0x55, 0xf3, 0xc7, 0x05, 0xd5, 0xd4, 0x41, 0x40, 0x80, 0x9f, 0x80, 0x16, 
-    0x1a, 0x76, 0x2b, 0x1e, 0x04, 0x47, 0x8c, 0xb4, 0xb8, 0x02, 0x9a, 0x2b, 0x93, 
-    0x54, 0x13, 0x0c, 0x23, 0xf7, 0x55, 0x43, 0x0a, 0x2b, 0xa2, 0x3d, 0xd7, 0x23, 
-    0x41, 0x4b, 0x0c, 0x37, 0x5a, 0x2e, 0x49, 0xba, 0x66, 0x21, 0x73, 0xd5, 0x18, 
-    0xf7, 0xa4, 0x40, 0x76, 0x60, 0xf8, 0xdd, 0x6b, 0xae, 0xac, 0x08, 0xc0, 0x40, 
-    0x81, 0x54, 0xf9, 0xe5, 0x6b, 0xc6, 0x54, 0xf0, 0xa4, 0x1a, 0x66, 0x9e, 0x89, 
-    0x1e, 0x29, 0xa4, 0x04, 0xc3, 0x46, 0x7b, 0x04, 0x08, 0xc4, 0xa4, 0x9b, 0xa4, 
-    0xf5, 0x72, 0x27, 0x2b, 0xa4, 0xb4, 0x57, 0x80, 0x35, 0x4b, 0xe0, 0xe9, 0x1a, 
-    0x82, 0xa1, 0x79, 0xc2, 0x23, 0x74, 0x0d, 0x58, 0xe3, 0xdd, 0x68, 0xa4, 0x70, 
-    0xa1, 0x83, 0x0e, 0x5c, 0x60, 0x89, 0xe6, 0x79, 0xa2, 0x05, 0x63, 0x47, 0x00, 
-    0xd0, 0x31, 0x68, 0xcd, 0x27, 0xa3, 0xd5, 0x91, 0xdd, 0x1f, 0xcd, 0x51, 0x3a, 
-    0xda, 0x13, 0x1a, 0x02, 0xa0, 0xe9, 0xa6, 0xa3, 0xa9, 0x09, 0x1d, 0x23, 0xc4, 
-    0x19, 0x13, 0xa3, 0x68, 0xc6, 0xa0, 0xa3, 0x60, 0xcd, 0x03, 0x04, 0x9c, 0x8a, 
-    0xaa, 0x68, 0x92, 0x78, 0x50, 0x01, 0x0c, 0x5c, 0x48, 0xa9, 0x9b, 0x31, 0x77, 
-    0x56, 0x9a, 0x10, 0xa7, 0x82, 0x86, 0x66, 0x8c, 0x24, 0x92, 0x1a, 0x83, 0x03, 
-    0x42, 0x76, 0x14, 0x5b, 0x8d, 0x2b, 0x6a, 0x34, 0x06, 0x62, 0x68, 0xb9, 0x58, 
-    0xc1, 0x03, 0x42, 0xb4, 0xe0, 0x69, 0xcc, 0x24, 0x04, 0x79, 0x37, 0xcb, 0x1e, 
-    0x49, 0x14, 0xe1, 0x03, 0xb3, 0x6d, 0x12, 0x67, 0x69, 0x41, 0x4a, 0x9c, 0x91, 
-    0xc4, 0x10, 0x41, 0x64, 0x62, 0x87, 0x8b, 0xe5, 0x0e, 0x4a, 0x85, 0x41, 0x45, 
-    0x0c, 0x61, 0xc5, 0x29, 0xf7, 0xe5, 0xa2, 0x10, 0x18, 0x10, 0xbe, 0xd6, 0x0b, 
-    0x29, 0x70, 0x20, 0x14, 0xc4, 0x2c, 0xa4, 0x71, 0xab, 0x10, 0x0e, 0x79, 0x4c, 
-    0xf2, 0xc9, 0x27, 0x93, 0x34, 0x42, 0xc5, 0x0b, 0x0a, 0x2d, 0x3a, 0x1a, 0x2d, 
-    0x16, 0x30, 0x66, 0x90, 0x8e, 0xa3, 0x99, 0xa2, 0x80, 0xc5, 0x04, 0x15, 0x19, 
-    0x1a, 0x86, 0x7d, 0x5e, 0xc0, 0xb1, 0x35, 0x6c, 0x8a, 0x16, 0x6c, 0x98, 0x1b, 
-    0x5b, 0xdc, 0x03, 0xc6, 0xd5, 0x10, 0xda, 0x8b, 0x00, 0x00, 0x54, 0x30, 0x50, 
-    0x40, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x95, 0x00, 0x2c, 0x04, 0x00, 
-    0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 
-    0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x32, 
-    0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 
-    0x43, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 
-    0x53, 0x53, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 
-    0x59, 0x6e, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 
-    0x6b, 0x62, 0x61, 0x6e, 0x62, 0x61, 0x76, 0x63, 0x63, 0x64, 0x65, 0x65, 0x7a, 
-    0x6a, 0x69, 0x76, 0x6a, 0x6a, 0x7d, 0x6e, 0x4c, 0x51, 0x70, 0x2f, 0x2f, 0x70, 
-    0x6e, 0x7b, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 
-    0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x6e, 0x5a, 
-    0x7b, 0x7b, 0x8c, 0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x82, 
-    0x4e, 0x4e, 0x83, 0x52, 0x53, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 
-    0x8f, 0x88, 0x56, 0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 
-    0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x8e, 0x6c, 0x1c, 0x90, 
-    0x90, 0x9e, 0x93, 0x69, 0x69, 0x94, 0x74, 0x24, 0x94, 0x94, 0xa2, 0x96, 0x76, 
-    0x29, 0x97, 0x76, 0x1e, 0x98, 0x77, 0x1c, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 
-    0x9b, 0x7c, 0x24, 0x9b, 0x7c, 0x2c, 0x9b, 0x8a, 0x63, 0x9c, 0x7b, 0x1c, 0x9c, 
-    0x7e, 0x32, 0x9c, 0x7e, 0x38, 0x9d, 0x9d, 0xaa, 0x9e, 0x7d, 0x16, 0x9e, 0x81, 
-    0x35, 0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x24, 0x9f, 0x80, 0x2a, 0xa0, 0x81, 0x2b, 
-    0xa0, 0x83, 0x31, 0xa0, 0x84, 0x3d, 0xa1, 0x85, 0x42, 0xa1, 0xa1, 0xad, 0xa2, 
-    0x7f, 0x7e, 0xa2, 0x82, 0x15, 0xa2, 0x82, 0x1a, 0xa3, 0x84, 0x24, 0xa4, 0x89, 
-    0x45, 0xa5, 0x8a, 0x4b, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa8, 0x8e, 0x4f, 
-    0xa9, 0x8e, 0x50, 0xaa, 0x8b, 0x25, 0xaa, 0x8c, 0x29, 0xab, 0x92, 0x55, 0xad, 
-    0x90, 0x28, 0xad, 0xad, 0xb8, 0xae, 0x93, 0x48, 0xae, 0x96, 0x5c, 0xb1, 0x9a, 
-    0x63, 0xb2, 0x9a, 0x5f, 0xb4, 0xb4, 0xbe, 0xb5, 0x9f, 0x6b, 0xb6, 0x9b, 0x32, 
-    0xb6, 0xa1, 0x6d, 0xb8, 0xa2, 0x6e, 0xb9, 0xa0, 0x43, 0xba, 0xa2, 0x4a, 0xbb, 
-    0x9e, 0x2b, 0xbc, 0xa7, 0x76, 0xbd, 0xa4, 0x52, 0xbd, 0xaa, 0x7b, 0xbf, 0xa6, 
-    0x3e, 0xbf, 0xab, 0x80, 0xc0, 0xad, 0x7e, 0xc1, 0xac, 0x5e, 0xc1, 0xae, 0x82, 
-    0xc2, 0xad, 0x63, 0xc3, 0xb0, 0x79, 0xc3, 0xb1, 0x87, 0xc5, 0xb3, 0x8a, 0xcb, 
-    0xb6, 0x63, 0xcc, 0xbc, 0x96, 0xce, 0xc0, 0x9b, 0xd7, 0xc4, 0x68, 0xdb, 0xc9, 
-    0x70, 0xdc, 0xcc, 0x83, 0xdd, 0xd2, 0xb9, 0xde, 0xca, 0x4e, 0xeb, 0xd7, 0x4a, 
-    0xec, 0xd9, 0x58, 0xf3, 0xdf, 0x42, 0xf4, 0xe3, 0x59, 0xfa, 0xe6, 0x39, 0xfc, 
-    0xed, 0x6d, 0xfe, 0xf6, 0x9e, 0xff, 0xed, 0x44, 0xff, 0xef, 0x5c, 0xff, 0xef, 
-    0x62, 0xff, 0xf0, 0x65, 0xff, 0xf1, 0x59, 0xff, 0xf1, 0x6c, 0xff, 0xf1, 0x73, 
-    0xff, 0xf2, 0x7b, 0xff, 0xf3, 0x83, 0xff, 0xf4, 0x8c, 0xff, 0xf5, 0x96, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa9, 0x00, 0x2b, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 
-    0xc3, 0x81, 0x6c, 0x1e, 0x32, 0x14, 0x24, 0x50, 0x91, 0xc4, 0x8b, 0x18, 0x33, 
-    0x12, 0x8c, 0x28, 0xf0, 0x90, 0x40, 0x8a, 0x1a, 0x25, 0x7a, 0x0c, 0x79, 0x50, 
-    0x0e, 0xc9, 0x85, 0x6e, 0x4e, 0x3a, 0x1c, 0x99, 0x90, 0xa5, 0xca, 0x85, 0x26, 
-    0x5f, 0xca, 0xd4, 0x98, 0x46, 0xce, 0x1f, 0x95, 0x2c, 0x5d, 0x0a, 0x4c, 0x79, 
-    0x52, 0x0f, 0x20, 0x40, 0x95, 0x06, 0x01, 0xad, 0xf4, 0xf3, 0xa7, 0x9f, 0x81, 
-    0x69, 0x66, 0x2e, 0x4c, 0xaa, 0xb4, 0xe9, 0x45, 0x9e, 0x4e, 0xa3, 0x2a, 0xd5, 
-    0x22, 0x35, 0x24, 0x05, 0x84, 0x50, 0xab, 0x6a, 0xdd, 0xaa, 0xf1, 0x8c, 0xc4, 
-    0x03, 0x08, 0x07, 0x70, 0xad, 0x24, 0x40, 0xe9, 0x09, 0x89, 0x54, 0xc7, 0xaa, 
-    0x5d, 0x1b, 0x75, 0x0a, 0x5b, 0xa9, 0x65, 0x9b, 0xbe, 0x78, 0xbb, 0x15, 0xec, 
-    0x58, 0x03, 0x01, 0x08, 0xd0, 0x55, 0x2b, 0x46, 0xa9, 0x90, 0xbd, 0x4a, 0xb7, 
-    0x08, 0x94, 0xb1, 0xd0, 0x2b, 0xc9, 0x1d, 0x5b, 0x6d, 0xbc, 0x0c, 0x32, 0x02, 
-    0xb0, 0x63, 0x83, 0x0b, 0x1e, 0x3b, 0x4d, 0x30, 0x30, 0x20, 0x00, 0x21, 0xf9, 
-    0x04, 0x05, 0x03, 0x00, 0xda, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 
-    0x32, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x04, 0x0b, 0x0b, 0x0c, 0x0e, 
-    0x0e, 0x12, 0x14, 0x13, 0x14, 0x17, 0x15, 0x05, 0x18, 0x17, 0x19, 0x1b, 0x1b, 
-    0x1c, 0x1f, 0x1d, 0x19, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 
-    0x2a, 0x24, 0x07, 0x2b, 0x2b, 0x2c, 0x2f, 0x2d, 0x3a, 0x33, 0x33, 0x33, 0x34, 
-    0x2f, 0x0b, 0x34, 0x33, 0x3c, 0x3a, 0x39, 0x43, 0x3b, 0x35, 0x0b, 0x3b, 0x3b, 
-    0x3b, 0x44, 0x44, 0x44, 0x47, 0x47, 0x48, 0x4b, 0x4a, 0x56, 0x4c, 0x4c, 0x4c, 
-    0x51, 0x49, 0x10, 0x54, 0x54, 0x54, 0x55, 0x55, 0x5b, 0x56, 0x56, 0x6c, 0x58, 
-    0x57, 0x64, 0x59, 0x59, 0x6e, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4e, 0x5c, 0x5c, 
-    0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x64, 0x65, 0x65, 0x7a, 
-    0x66, 0x64, 0x6b, 0x69, 0x5c, 0x1c, 0x6a, 0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6b, 
-    0x6b, 0x6c, 0x6c, 0x26, 0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x72, 0x72, 
-    0x85, 0x73, 0x2d, 0x2d, 0x73, 0x73, 0x74, 0x74, 0x73, 0x7f, 0x76, 0x25, 0x26, 
-    0x76, 0x38, 0x38, 0x76, 0x76, 0x88, 0x77, 0x6c, 0x18, 0x7a, 0x49, 0x4a, 0x7b, 
-    0x7b, 0x7b, 0x7b, 0x7b, 0x8c, 0x7c, 0x28, 0x29, 0x7d, 0x72, 0x18, 0x7d, 0x7c, 
-    0x83, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 
-    0x84, 0x83, 0x8f, 0x84, 0x84, 0x84, 0x87, 0x58, 0x58, 0x88, 0x7a, 0x1a, 0x89, 
-    0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 
-    0x9b, 0x8e, 0x30, 0x31, 0x8e, 0x6b, 0x0c, 0x90, 0x6f, 0x21, 0x90, 0x90, 0x9e, 
-    0x91, 0x66, 0x66, 0x93, 0x32, 0x32, 0x93, 0x85, 0x1d, 0x93, 0x93, 0x93, 0x94, 
-    0x94, 0xa2, 0x96, 0x76, 0x25, 0x98, 0x75, 0x0c, 0x99, 0x78, 0x17, 0x9a, 0x9a, 
-    0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 0x7c, 0x24, 0x9b, 0x7c, 0x2c, 
-    0x9b, 0x7d, 0x34, 0x9b, 0x88, 0x47, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 0x1b, 0x9d, 
-    0x7b, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x91, 0x24, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 
-    0x34, 0x9e, 0x81, 0x3a, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x13, 0xa1, 0x85, 0x3d, 
-    0xa1, 0x85, 0x42, 0xa2, 0x7f, 0x7f, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1a, 0xa3, 
-    0xa3, 0xa4, 0xa4, 0x83, 0x13, 0xa4, 0x89, 0x44, 0xa5, 0x86, 0x24, 0xa5, 0x89, 
-    0x36, 0xa6, 0x8b, 0x4b, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x1a, 0xa7, 0x99, 0x22, 
-    0xa8, 0x8e, 0x4d, 0xa8, 0x8e, 0x51, 0xab, 0x8b, 0x14, 0xab, 0x8c, 0x19, 0xab, 
-    0x91, 0x54, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xad, 0x95, 0x5b, 0xae, 0x96, 
-    0x55, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x90, 0x90, 0xb2, 0x93, 0x16, 
-    0xb2, 0x96, 0x34, 0xb3, 0x9c, 0x66, 0xb4, 0x95, 0x19, 0xb4, 0xb3, 0xb4, 0xb4, 
-    0xb4, 0xbd, 0xb5, 0xa6, 0x24, 0xb6, 0xa1, 0x6d, 0xb9, 0x9b, 0x17, 0xb9, 0xa3, 
-    0x6b, 0xba, 0x9c, 0x19, 0xba, 0xa3, 0xa4, 0xba, 0xa8, 0x29, 0xbb, 0xbb, 0xbc, 
-    0xbb, 0xbb, 0xc4, 0xbc, 0xa7, 0x77, 0xbe, 0xa2, 0x1b, 0xbf, 0xac, 0x82, 0xc1, 
-    0xa5, 0x1c, 0xc1, 0xae, 0x82, 0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xcb, 0xc5, 0xb4, 
-    0x8a, 0xc6, 0xaa, 0x1d, 0xc8, 0xae, 0x2a, 0xc9, 0xad, 0x1e, 0xc9, 0xb3, 0x49, 
-    0xc9, 0xb6, 0xb7, 0xc9, 0xba, 0x94, 0xca, 0xba, 0x29, 0xcc, 0xcc, 0xcd, 0xcc, 
-    0xcc, 0xd2, 0xcd, 0xb2, 0x1f, 0xcd, 0xb2, 0x21, 0xd0, 0xb5, 0x1f, 0xd1, 0xb6, 
-    0x22, 0xd3, 0xd3, 0xd4, 0xd4, 0xbb, 0x23, 0xd4, 0xc7, 0xa9, 0xd5, 0xd5, 0xda, 
-    0xd6, 0xc7, 0xc7, 0xd7, 0xbf, 0x26, 0xda, 0xc5, 0x4a, 0xdb, 0xc6, 0x2a, 0xdb, 
-    0xd0, 0xb3, 0xdb, 0xdb, 0xdd, 0xdc, 0xc4, 0x26, 0xde, 0xde, 0xe2, 0xe0, 0xc8, 
-    0x27, 0xe2, 0xd9, 0xc4, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 
-    0xe4, 0xcf, 0x31, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2c, 0xe7, 0xdc, 0xa9, 0xea, 
-    0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xe5, 0xd7, 0xeb, 0xeb, 0xec, 0xec, 0xd9, 
-    0x32, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xde, 0x54, 0xf1, 0xed, 0xe7, 
-    0xf2, 0xdc, 0x2e, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf4, 0xf5, 0xe0, 0x2f, 0xf6, 
-    0xe1, 0x31, 0xf6, 0xf3, 0xec, 0xf7, 0xe3, 0x38, 0xf7, 0xf7, 0xf8, 0xf8, 0xe4, 
-    0x45, 0xf8, 0xea, 0x78, 0xf9, 0xe5, 0x32, 0xf9, 0xf7, 0xf5, 0xfc, 0xf3, 0x95, 
-    0xfd, 0xee, 0x64, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 0x44, 0xff, 
-    0xee, 0x4c, 0xff, 0xee, 0x56, 0xff, 0xf0, 0x5a, 0xff, 0xf0, 0x69, 0xff, 0xf2, 
-    0x79, 0xff, 0xf3, 0x89, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xb5, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 
-    0xc1, 0x83, 0xaa, 0x0e, 0x2a, 0x5c, 0xc8, 0x50, 0x20, 0x35, 0x5a, 0x0d, 0x23, 
-    0x32, 0xac, 0x55, 0x4a, 0x5b, 0xb4, 0x55, 0x03, 0x35, 0x49, 0xdc, 0x58, 0xcb, 
-    0x58, 0xb4, 0x68, 0xb4, 0x98, 0xc1, 0xd2, 0x96, 0xaa, 0x18, 0xb5, 0x8d, 0x28, 
-    0x6f, 0x41, 0x83, 0xa6, 0x0b, 0x16, 0x2d, 0x68, 0xd2, 0x50, 0xa2, 0xd4, 0xb4, 
-    0x12, 0x1a, 0x33, 0x68, 0xbf, 0x4a, 0x05, 0x92, 0x29, 0x31, 0x55, 0xcd, 0x95, 
-    0x37, 0xa1, 0x8d, 0xe4, 0xb9, 0x50, 0x53, 0xb1, 0x9f, 0xd0, 0x8a, 0xd5, 0x52, 
-    0x46, 0xd4, 0xa0, 0x22, 0x57, 0xa9, 0x74, 0x0d, 0xfb, 0x75, 0x4b, 0x57, 0xd0, 
-    0x95, 0x18, 0x9b, 0x0e, 0x4c, 0x75, 0x93, 0x56, 0xa7, 0x61, 0xcc, 0x6a, 0xf5, 
-    0x52, 0x69, 0x53, 0x18, 0x53, 0xad, 0xda, 0x2e, 0xd5, 0xb4, 0x5a, 0xf3, 0xaa, 
-    0x2e, 0x6d, 0x6f, 0xd0, 0x6a, 0x5b, 0x85, 0xb4, 0xae, 0x30, 0x58, 0x09, 0xe5, 
-    0xaa, 0xaa, 0xab, 0xab, 0xd6, 0xad, 0x5b, 0x43, 0xe5, 0x6a, 0xd3, 0x44, 0x16, 
-    0xe8, 0xaa, 0x61, 0x35, 0x6b, 0x41, 0x12, 0xcc, 0x83, 0x93, 0x2a, 0x55, 0x54, 
-    0x71, 0xed, 0x62, 0x85, 0x0b, 0x18, 0x30, 0x5c, 0x7b, 0x7b, 0xad, 0x42, 0xd4, 
-    0x34, 0x0d, 0xaf, 0x6c, 0xa0, 0x9b, 0x81, 0x1e, 0x3d, 0x9a, 0x94, 0x8e, 0x5e, 
-    0xd0, 0x86, 0x71, 0x96, 0xa9, 0x87, 0x18, 0xe9, 0xd7, 0xa4, 0x59, 0x00, 0x98, 
-    0x40, 0x77, 0x94, 0xcc, 0x28, 0xbe, 0x60, 0xeb, 0x9e, 0x05, 0xa0, 0x37, 0x83, 
-    0x54, 0x8a, 0x64, 0x92, 0xd2, 0xad, 0xbb, 0x51, 0xef, 0xde, 0x05, 0x24, 0xa1, 
-    0xf4, 0xe1, 0x9a, 0xf8, 0x6b, 0x2e, 0xc7, 0x7b, 0x9f, 0xa8, 0x28, 0x31, 0x8e, 
-    0x73, 0xd8, 0x37, 0xa2, 0xf7, 0x36, 0x94, 0x4a, 0xa2, 0xa3, 0xeb, 0xaf, 0x3f, 
-    0x68, 0xff, 0x07, 0x00, 0xe1, 0x96, 0x44, 0x4f, 0xa3, 0x79, 0xbd, 0xba, 0x4e, 
-    0x61, 0x3c, 0x00, 0x43, 0x3b, 0x1b, 0x9e, 0x02, 0x4d, 0x6a, 0x16, 0xa5, 0x56, 
-    0xc9, 0x88, 0x37, 0x70, 0x3f, 0x41, 0xa2, 0xaf, 0x57, 0x8d, 0xe4, 0x96, 0x8d, 
-    0x2d, 0x9e, 0x50, 0x42, 0x89, 0x27, 0xf3, 0x8d, 0xb6, 0x9f, 0x7b, 0x0a, 0x34, 
-    0x54, 0x08, 0x29, 0xa7, 0xe4, 0xe7, 0xda, 0x2c, 0x9f, 0xf1, 0xe2, 0x4b, 0x32, 
-    0x02, 0x66, 0xd3, 0x1e, 0x83, 0x0c, 0xe1, 0x96, 0xcc, 0x2c, 0xd9, 0x78, 0xa2, 
-    0x42, 0x36, 0x41, 0xc0, 0x00, 0x1a, 0x85, 0xa4, 0x6d, 0xe0, 0x1e, 0x00, 0x06, 
-    0x2c, 0x54, 0x48, 0x6e, 0xeb, 0x65, 0x43, 0x08, 0x06, 0xd9, 0xe4, 0x41, 0x80, 
-    0x80, 0x9f, 0x7c, 0x06, 0x5a, 0x76, 0x2b, 0x1e, 0x14, 0x47, 0x2b, 0xa0, 0xd9, 
-    0xf2, 0xca, 0x67, 0xaf, 0x54, 0x92, 0x0d, 0x31, 0x8d, 0xe4, 0x97, 0x0d, 0x29, 
-    0x40, 0x82, 0x06, 0x5d, 0x8f, 0x04, 0x31, 0x31, 0x1c, 0x69, 0xbc, 0x28, 0x09, 
-    0xdb, 0x85, 0xcd, 0x65, 0x63, 0x1c, 0x94, 0x02, 0xe9, 0x91, 0x21, 0x78, 0xc4, 
-    0xbd, 0xb2, 0x22, 0x00, 0x03, 0x15, 0x62, 0x25, 0x98, 0xc4, 0x25, 0x53, 0x01, 
-    0x94, 0x69, 0x9c, 0x89, 0x26, 0x69, 0xad, 0x90, 0x42, 0x0a, 0x2f, 0x6b, 0xb8, 
-    0x47, 0x80, 0x40, 0x4d, 0xbe, 0xf9, 0x1a, 0x2f, 0x20, 0x66, 0x33, 0x8b, 0x27, 
-    0xee, 0x1d, 0xa0, 0x0d, 0x13, 0x7a, 0xea, 0x36, 0x25, 0x68, 0x9e, 0xec, 0x30, 
-    0x5e, 0x03, 0xda, 0x7c, 0x47, 0x1a, 0x29, 0x5c, 0xec, 0x70, 0x03, 0x17, 0x59, 
-    0xea, 0x46, 0xcc, 0xa1, 0xd9, 0x24, 0xa3, 0x87, 0x00, 0xd1, 0x35, 0xa8, 0xcd, 
-    0x27, 0xa4, 0xe5, 0xa1, 0x1d, 0x21, 0xd7, 0xa1, 0xf7, 0x5a, 0x14, 0x1b, 0x02, 
-    0xe0, 0xe9, 0xa7, 0xa4, 0xad, 0x19, 0x5d, 0x23, 0xce, 0x25, 0xac, 0x93, 0x27, 
-    0x68, 0xc9, 0xa4, 0xa0, 0xcd, 0x03, 0x04, 0xac, 0xca, 0xea, 0x68, 0x94, 0x7c, 
-    0x60, 0x01, 0x0c, 0x6b, 0x60, 0x0a, 0x5b, 0x32, 0x09, 0x8e, 0x46, 0xcc, 0x42, 
-    0xa0, 0x16, 0x3a, 0x5a, 0x32, 0x94, 0x54, 0x9a, 0x0c, 0x0e, 0x0a, 0xf5, 0xa1, 
-    0x2c, 0x68, 0xaf, 0xa4, 0xa1, 0x8d, 0x0f, 0x7d, 0x66, 0xc3, 0xcb, 0x15, 0x3d, 
-    0x28, 0x64, 0x4b, 0xa1, 0xcc, 0x12, 0x04, 0xab, 0x2c, 0x7f, 0x24, 0x61, 0xc4, 
-    0x0f, 0x0a, 0xe9, 0xe1, 0xa6, 0x73, 0xc4, 0xe8, 0x51, 0x50, 0x13, 0x68, 0x98, 
-    0x2b, 0xc4, 0x26, 0xee, 0x2a, 0x64, 0x26, 0x98, 0xad, 0x84, 0x61, 0x90, 0x11, 
-    0x45, 0x5c, 0x81, 0x4a, 0x7e, 0xbc, 0x30, 0x14, 0x46, 0x84, 0xba, 0xf9, 0x42, 
-    0x4a, 0x1c, 0x0a, 0x09, 0x21, 0xcb, 0x6b, 0x95, 0x34, 0xc4, 0x43, 0x1f, 0x95, 
-    0x78, 0xf2, 0x49, 0x25, 0x8e, 0x44, 0x41, 0x03, 0x43, 0x8e, 0x92, 0x66, 0xcb, 
-    0x05, 0x82, 0x19, 0xa4, 0x23, 0x69, 0xa7, 0x2c, 0xd0, 0x31, 0x41, 0x46, 0x82, 
-    0x96, 0x21, 0x29, 0x00, 0x58, 0x30, 0xb2, 0x36, 0x6d, 0x8e, 0x96, 0xa7, 0x98, 
-    0x09, 0x8c, 0xec, 0xc3, 0xc7, 0xd9, 0x14, 0xeb, 0x0b, 0xa7, 0x15, 0x0c, 0x14, 
-    0x10, 0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x97, 0x00, 0x2c, 0x04, 0x00, 
-    0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 
-    0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3a, 
-    0x3a, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x43, 0x48, 0x46, 
-    0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x53, 0x53, 0x54, 
-    0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 0x6e, 0x5b, 
-    0x5b, 0x5c, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x62, 0x61, 
-    0x6e, 0x62, 0x61, 0x76, 0x63, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x69, 0x76, 
-    0x6a, 0x6a, 0x7d, 0x6e, 0x4c, 0x51, 0x6e, 0x67, 0x69, 0x70, 0x2f, 0x2f, 0x70, 
-    0x6e, 0x7b, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 
-    0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 
-    0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x82, 0x4e, 0x4e, 0x83, 
-    0x52, 0x53, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x88, 0x56, 
-    0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8a, 0x5c, 0x5c, 
-    0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x93, 0x69, 0x69, 0x94, 
-    0x73, 0x1c, 0x94, 0x94, 0xa2, 0x96, 0x75, 0x23, 0x97, 0x77, 0x2a, 0x98, 0x77, 
-    0x1c, 0x98, 0x77, 0x20, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9b, 0x7b, 0x24, 
-    0x9b, 0x7c, 0x2c, 0x9c, 0x7b, 0x1b, 0x9c, 0x7e, 0x33, 0x9c, 0x7e, 0x39, 0x9e, 
-    0x7d, 0x17, 0x9e, 0x80, 0x35, 0x9f, 0x83, 0x40, 0xa0, 0x7f, 0x17, 0xa1, 0x84, 
-    0x33, 0xa1, 0x85, 0x3d, 0xa1, 0x85, 0x42, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 
-    0xa2, 0x82, 0x1b, 0xa2, 0x84, 0x2b, 0xa3, 0x83, 0x17, 0xa3, 0x84, 0x23, 0xa4, 
-    0x89, 0x45, 0xa5, 0x8b, 0x4b, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa7, 0x88, 
-    0x17, 0xa7, 0x8e, 0x51, 0xa8, 0x8c, 0x38, 0xa8, 0x8e, 0x4d, 0xa9, 0x8f, 0x52, 
-    0xaa, 0x91, 0x4d, 0xab, 0x91, 0x54, 0xac, 0x91, 0x3e, 0xad, 0x95, 0x5b, 0xad, 
-    0xad, 0xb8, 0xaf, 0x91, 0x1c, 0xb0, 0x95, 0x41, 0xb0, 0x98, 0x5d, 0xb1, 0x96, 
-    0x3e, 0xb2, 0x9b, 0x63, 0xb4, 0x9e, 0x6a, 0xb4, 0xb4, 0xbe, 0xb6, 0xa1, 0x6d, 
-    0xb7, 0x9a, 0x24, 0xb7, 0xa2, 0x70, 0xb8, 0xa1, 0x67, 0xb9, 0xa2, 0x5f, 0xb9, 
-    0xa4, 0x6f, 0xba, 0xa6, 0x74, 0xbb, 0xa0, 0x35, 0xbb, 0xa7, 0x79, 0xbe, 0xaa, 
-    0x7c, 0xc1, 0xaa, 0x55, 0xc1, 0xae, 0x82, 0xc4, 0xab, 0x3d, 0xc4, 0xad, 0x47, 
-    0xc4, 0xb3, 0x87, 0xc8, 0xb0, 0x49, 0xc8, 0xb7, 0x8e, 0xcc, 0xbd, 0x98, 0xce, 
-    0xb7, 0x43, 0xd1, 0xbc, 0x53, 0xd1, 0xc3, 0xa4, 0xd6, 0xca, 0xad, 0xd7, 0xc2, 
-    0x51, 0xdc, 0xc7, 0x47, 0xdf, 0xd3, 0xa3, 0xef, 0xde, 0x66, 0xf2, 0xdd, 0x41, 
-    0xf2, 0xe7, 0x98, 0xf5, 0xe5, 0x68, 0xf9, 0xe7, 0x51, 0xfa, 0xe7, 0x46, 0xfe, 
-    0xf3, 0x8b, 0xff, 0xec, 0x3c, 0xff, 0xed, 0x44, 0xff, 0xee, 0x53, 0xff, 0xef, 
-    0x5a, 0xff, 0xef, 0x63, 0xff, 0xf0, 0x57, 0xff, 0xf0, 0x5b, 0xff, 0xf0, 0x63, 
-    0xff, 0xf1, 0x6a, 0xff, 0xf2, 0x74, 0xff, 0xf2, 0x7b, 0xff, 0xf3, 0x86, 0xff, 
-    0xf6, 0x94, 0xff, 0xf8, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa8, 0x00, 0x2f, 0x09, 
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x80, 0x0e, 0x2a, 0x5c, 0xc8, 0x50, 0xe0, 
-    0xa2, 0x86, 0x10, 0x23, 0x5e, 0x4a, 0x24, 0xb1, 0xa2, 0x41, 0x8a, 0x16, 0x33, 
-    0x6a, 0xdc, 0x38, 0x90, 0x8f, 0x41, 0x8f, 0x1c, 0x43, 0x8a, 0x1c, 0x88, 0x47, 
-    0xa1, 0xa1, 0x91, 0x97, 0xe0, 0x40, 0x4c, 0x88, 0x12, 0xe2, 0xc9, 0x90, 0x75, 
-    0x24, 0x6a, 0x69, 0xd9, 0xf0, 0x0f, 0xcd, 0x9b, 0x1c, 0x55, 0x8a, 0x7c, 0x91, 
-    0x07, 0x10, 0xcb, 0x40, 0x97, 0x02, 0x05, 0x12, 0x24, 0x28, 0x90, 0x4d, 0x81, 
-    0x3a, 0x71, 0x2a, 0x54, 0xa3, 0xb4, 0xa9, 0xc5, 0xa4, 0x4e, 0x07, 0xc6, 0x8c, 
-    0xca, 0xd1, 0x0a, 0xd5, 0xab, 0x54, 0xa1, 0xa2, 0x24, 0x80, 0x55, 0x20, 0xd7, 
-    0x8d, 0x68, 0x2c, 0x1a, 0x50, 0x38, 0xa0, 0xab, 0x59, 0x86, 0x56, 0xcf, 0x52, 
-    0x0d, 0xa3, 0xf6, 0xaa, 0x93, 0xab, 0x02, 0xda, 0x62, 0xfd, 0x2a, 0x97, 0xe6, 
-    0x58, 0xb3, 0x05, 0x02, 0x34, 0x9c, 0x50, 0xf7, 0x26, 0xdb, 0xbe, 0x80, 0x1b, 
-    0xe6, 0xb8, 0x22, 0x30, 0x06, 0xd6, 0x1c, 0x58, 0x6b, 0xb4, 0x04, 0x12, 0xb8, 
-    0x71, 0x41, 0x05, 0x8e, 0x95, 0x22, 0x18, 0x18, 0x10, 0x00, 0x21, 0xf9, 0x04, 
-    0x05, 0x03, 0x00, 0xdb, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 
-    0x00, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x04, 0x0c, 0x0b, 0x0c, 0x0e, 0x0e, 
-    0x12, 0x14, 0x14, 0x14, 0x17, 0x17, 0x1a, 0x18, 0x15, 0x05, 0x1c, 0x1c, 0x1c, 
-    0x1c, 0x1c, 0x23, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x23, 0x2b, 0x27, 
-    0x1f, 0x05, 0x2a, 0x25, 0x08, 0x2b, 0x2b, 0x2b, 0x2f, 0x2d, 0x38, 0x33, 0x33, 
-    0x33, 0x34, 0x33, 0x3c, 0x3a, 0x35, 0x0c, 0x3a, 0x39, 0x43, 0x3b, 0x3b, 0x3b, 
-    0x43, 0x43, 0x43, 0x45, 0x3d, 0x14, 0x4b, 0x49, 0x57, 0x4c, 0x4c, 0x4c, 0x51, 
-    0x4a, 0x10, 0x54, 0x54, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x56, 0x6c, 0x59, 0x59, 
-    0x6f, 0x5a, 0x59, 0x61, 0x5b, 0x5b, 0x5b, 0x5c, 0x42, 0x4e, 0x5c, 0x5c, 0x72, 
-    0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 0x65, 0x7a, 0x66, 
-    0x64, 0x6b, 0x6a, 0x5c, 0x13, 0x6a, 0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6b, 0x6b, 
-    0x6c, 0x6c, 0x26, 0x27, 0x6d, 0x6c, 0x73, 0x6e, 0x6e, 0x81, 0x70, 0x6e, 0x7b, 
-    0x72, 0x5e, 0x2d, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 0x73, 0x73, 0x73, 0x76, 
-    0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x75, 0x7b, 0x76, 0x76, 0x88, 0x77, 0x6c, 
-    0x18, 0x7a, 0x49, 0x4a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x85, 0x7b, 0x7b, 0x8c, 
-    0x7c, 0x28, 0x29, 0x7d, 0x72, 0x18, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 0x83, 
-    0x83, 0x83, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x85, 0x84, 0x8d, 0x87, 0x58, 
-    0x58, 0x87, 0x7a, 0x1b, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8b, 0x2f, 0x30, 
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8e, 0x30, 0x31, 0x8e, 0x6b, 0x0d, 0x90, 
-    0x6f, 0x21, 0x90, 0x90, 0x9e, 0x91, 0x66, 0x66, 0x93, 0x32, 0x32, 0x93, 0x85, 
-    0x1d, 0x93, 0x93, 0x94, 0x94, 0x94, 0xa2, 0x96, 0x76, 0x26, 0x98, 0x75, 0x0c, 
-    0x99, 0x78, 0x17, 0x9a, 0x9a, 0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 
-    0x7c, 0x24, 0x9b, 0x7c, 0x2c, 0x9b, 0x7d, 0x34, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 
-    0x1b, 0x9d, 0x7b, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x3b, 
-    0x9e, 0x82, 0x33, 0x9e, 0x87, 0x27, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x12, 0xa1, 
-    0x84, 0x3d, 0xa1, 0x85, 0x42, 0xa2, 0x7f, 0x7f, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 
-    0x1a, 0xa3, 0xa3, 0xa4, 0xa4, 0x84, 0x13, 0xa4, 0x85, 0x25, 0xa4, 0x87, 0x38, 
-    0xa4, 0x89, 0x45, 0xa6, 0x8b, 0x4c, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 0x1a, 0xa7, 
-    0x99, 0x22, 0xa8, 0x8d, 0x4b, 0xa8, 0x8e, 0x51, 0xab, 0x8b, 0x14, 0xab, 0x91, 
-    0x55, 0xab, 0xab, 0xb6, 0xac, 0x8d, 0x19, 0xac, 0xac, 0xac, 0xae, 0x95, 0x5b, 
-    0xae, 0xae, 0xb9, 0xaf, 0x90, 0x17, 0xaf, 0x90, 0x90, 0xb0, 0x97, 0x4d, 0xb1, 
-    0x95, 0x2b, 0xb1, 0x9e, 0x4b, 0xb2, 0x93, 0x16, 0xb2, 0x9b, 0x63, 0xb3, 0xb3, 
-    0xb4, 0xb4, 0x95, 0x19, 0xb4, 0x9f, 0x6a, 0xb4, 0xb4, 0xbd, 0xb5, 0xa6, 0x24, 
-    0xb6, 0xa1, 0x6c, 0xb8, 0x9b, 0x18, 0xba, 0x9c, 0x19, 0xba, 0xa3, 0xa4, 0xba, 
-    0xa4, 0x6a, 0xba, 0xa8, 0x2b, 0xbb, 0xbb, 0xc4, 0xbc, 0xa8, 0x79, 0xbc, 0xbc, 
-    0xbc, 0xbe, 0xa2, 0x1b, 0xc0, 0xae, 0x7f, 0xc1, 0xa5, 0x1c, 0xc1, 0xae, 0x82, 
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 0x1d, 0xc6, 0xb5, 0x8b, 0xc8, 
-    0xac, 0x22, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xc9, 0xb9, 0x93, 0xca, 0xb4, 
-    0x45, 0xcb, 0xba, 0x29, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x1f, 
-    0xcd, 0xb2, 0x21, 0xd1, 0xb6, 0x21, 0xd3, 0xd3, 0xd4, 0xd4, 0xba, 0x23, 0xd4, 
-    0xc7, 0xa8, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd7, 0xbe, 0x26, 0xd8, 0xc3, 
-    0x51, 0xd8, 0xcd, 0xb2, 0xdb, 0xc7, 0x2a, 0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 0x25, 
-    0xdc, 0xc6, 0x3d, 0xde, 0xd3, 0xbc, 0xde, 0xde, 0xe2, 0xe1, 0xc8, 0x27, 0xe2, 
-    0xd9, 0xc4, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe4, 0xcf, 
-    0x31, 0xe5, 0xda, 0xa2, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2c, 0xe9, 0xd7, 0x62, 
-    0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xd8, 0x33, 0xeb, 0xe5, 0xd7, 0xeb, 
-    0xeb, 0xec, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xed, 0xe7, 0xf2, 0xdc, 
-    0x2f, 0xf3, 0xde, 0x31, 0xf4, 0xf4, 0xf5, 0xf6, 0xe1, 0x2f, 0xf6, 0xe1, 0x31, 
-    0xf6, 0xf3, 0xec, 0xf7, 0xf7, 0xf8, 0xf9, 0xee, 0x92, 0xf9, 0xf7, 0xf5, 0xfa, 
-    0xe5, 0x32, 0xfb, 0xec, 0x67, 0xfd, 0xeb, 0x44, 0xff, 0xeb, 0x34, 0xff, 0xec, 
-    0x3b, 0xff, 0xed, 0x4b, 0xff, 0xef, 0x57, 0xff, 0xf0, 0x68, 0xff, 0xf1, 0x5b, 
-    0xff, 0xf2, 0x7b, 0xff, 0xf4, 0x88, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xb7, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 
-    0x83, 0xb1, 0x0e, 0x2a, 0x5c, 0xc8, 0x50, 0x20, 0xb5, 0x5c, 0x0d, 0x23, 0x32, 
-    0xcc, 0xb5, 0x6a, 0xdb, 0x34, 0x57, 0x03, 0x3f, 0x49, 0xdc, 0x18, 0x4b, 0xd9, 
-    0x34, 0x69, 0xb8, 0x9e, 0xd1, 0xda, 0xb6, 0xea, 0x58, 0xb5, 0x8d, 0x28, 0x79, 
-    0x49, 0x93, 0x06, 0x0c, 0x17, 0x2e, 0x69, 0xd4, 0x50, 0xa2, 0x2c, 0xb5, 0x52, 
-    0xda, 0x33, 0x69, 0xc4, 0x4e, 0x05, 0x92, 0x29, 0x71, 0x55, 0xcd, 0x95, 0x37, 
-    0xa5, 0x8d, 0xe4, 0xb9, 0xf0, 0x93, 0xb2, 0x9f, 0xd2, 0x8e, 0xe5, 0x52, 0x46, 
-    0xd4, 0xe0, 0x24, 0x58, 0xab, 0x7e, 0x1d, 0x23, 0xc6, 0xeb, 0x57, 0xd0, 0x95, 
-    0x09, 0x9b, 0x0e, 0x5c, 0x75, 0x13, 0x17, 0x28, 0x63, 0xcf, 0x72, 0x01, 0x53, 
-    0x69, 0xd3, 0x18, 0x53, 0xad, 0xdb, 0x32, 0xd5, 0xfc, 0xf5, 0xf3, 0x2a, 0xb0, 
-    0x6d, 0x75, 0xd0, 0x6e, 0x73, 0x85, 0xb4, 0xae, 0x31, 0x5a, 0xac, 0xe4, 0x6e, 
-    0x8b, 0x55, 0xf7, 0x17, 0xaf, 0xbf, 0x43, 0xf5, 0x7e, 0xca, 0xd5, 0xd6, 0xd5, 
-    0xb1, 0x9a, 0xb9, 0x26, 0xe9, 0x0d, 0xe2, 0xa9, 0x57, 0x2f, 0xaa, 0xba, 0x82, 
-    0xb5, 0xd2, 0xe5, 0x58, 0x17, 0x2b, 0x96, 0xb1, 0x04, 0x35, 0x55, 0x23, 0x4c, 
-    0x9b, 0x67, 0x67, 0x9e, 0x43, 0x87, 0x36, 0xd5, 0x03, 0x58, 0xd2, 0x9d, 0x32, 
-    0xf3, 0x20, 0x13, 0xcd, 0x5a, 0x34, 0x0b, 0x00, 0x12, 0xe8, 0x96, 0x92, 0x39, 
-    0x65, 0x58, 0xeb, 0xdb, 0xb7, 0x00, 0xe8, 0x66, 0xb0, 0x8a, 0x91, 0x4c, 0x53, 
-    0xb7, 0x6f, 0x4b, 0xd2, 0xbd, 0xbb, 0x12, 0xca, 0x20, 0xab, 0x83, 0xb3, 0xee, 
-    0x42, 0x5c, 0xf7, 0x89, 0x53, 0x1b, 0xe5, 0x28, 0x6f, 0x9d, 0xa3, 0xb9, 0xee, 
-    0x44, 0x15, 0x23, 0x42, 0x9a, 0xce, 0xfa, 0x83, 0x75, 0xd8, 0x10, 0x23, 0x86, 
-    0xff, 0x0a, 0x2d, 0x6c, 0xd6, 0x74, 0x0a, 0xdf, 0x01, 0xd0, 0x91, 0x98, 0xca, 
-    0xb3, 0xa9, 0x5b, 0x97, 0x5e, 0x31, 0x0b, 0xee, 0x20, 0x7d, 0x03, 0x89, 0xc3, 
-    0x66, 0x49, 0xb2, 0xad, 0x6d, 0x57, 0xa8, 0x4b, 0x98, 0x84, 0xd2, 0x5e, 0x68, 
-    0xf5, 0xa5, 0xa7, 0x40, 0x43, 0x88, 0x98, 0x92, 0xca, 0x7c, 0xab, 0xdd, 0xd2, 
-    0x99, 0x30, 0xc3, 0x30, 0xc3, 0x9f, 0x36, 0xe8, 0xa5, 0x77, 0x00, 0x43, 0xb5, 
-    0x31, 0x73, 0x8b, 0x36, 0xa1, 0xa8, 0xa0, 0xcd, 0x10, 0x32, 0x78, 0xe6, 0xa0, 
-    0x68, 0x1a, 0xa4, 0x07, 0x40, 0x01, 0x0b, 0x21, 0x62, 0x9b, 0x79, 0xda, 0x14, 
-    0x82, 0x81, 0x36, 0x7b, 0x10, 0xc0, 0x9f, 0x28, 0x9d, 0x79, 0x56, 0x83, 0x89, 
-    0x00, 0x1c, 0x24, 0xc7, 0x2b, 0x9e, 0xed, 0x32, 0x4b, 0x67, 0xb3, 0x60, 0xa2, 
-    0x0d, 0x32, 0x92, 0xcc, 0xa7, 0x8d, 0x29, 0x3c, 0x7a, 0xc6, 0x9c, 0x89, 0x05, 
-    0x39, 0x01, 0x9c, 0x68, 0xc2, 0x18, 0xd9, 0x5a, 0x84, 0xc9, 0x69, 0x33, 0x1c, 
-    0x93, 0x03, 0xe5, 0x31, 0x21, 0x77, 0xc1, 0xcd, 0x82, 0xe3, 0x40, 0x88, 0x48, 
-    0xc9, 0x65, 0x70, 0xcc, 0x54, 0x80, 0xa5, 0x1a, 0x62, 0x8e, 0x29, 0xda, 0x2c, 
-    0xa6, 0xbc, 0xc7, 0x46, 0x7a, 0x04, 0x08, 0x94, 0xa4, 0x9a, 0xad, 0x3d, 0x29, 
-    0xcc, 0x25, 0xe9, 0xa1, 0xe8, 0x04, 0x9d, 0xb7, 0x89, 0x52, 0x65, 0x28, 0xd5, 
-    0x59, 0xe7, 0xc0, 0x36, 0xdb, 0x89, 0x66, 0x4a, 0x17, 0x40, 0xe4, 0xd0, 0x45, 
-    0x95, 0xb7, 0x09, 0x53, 0x63, 0x68, 0x79, 0x04, 0xd0, 0xdc, 0x81, 0xdb, 0x88, 
-    0x22, 0xda, 0x1e, 0xd6, 0x15, 0x32, 0xdd, 0x78, 0xac, 0x4d, 0x51, 0x21, 0x00, 
-    0x94, 0x56, 0x2a, 0x9a, 0x99, 0xcd, 0x49, 0xa2, 0x1c, 0x33, 0x73, 0x7a, 0xc6, 
-    0x4c, 0x0a, 0xdb, 0x40, 0x40, 0x40, 0xa8, 0xa2, 0x86, 0x9e, 0x76, 0xc9, 0x07, 
-    0x15, 0xc8, 0xd0, 0xc5, 0x93, 0x64, 0xa6, 0x3a, 0xe4, 0x42, 0x96, 0xf2, 0x19, 
-    0x1a, 0x32, 0xa1, 0x30, 0xca, 0xcc, 0x0e, 0x0a, 0xf5, 0xe1, 0xab, 0x67, 0xb3, 
-    0xa8, 0xb1, 0x4d, 0x10, 0x1b, 0x7a, 0x26, 0x4c, 0x16, 0x3f, 0x28, 0xb4, 0x0b, 
-    0x9f, 0xcc, 0x5c, 0x42, 0xd0, 0x76, 0xb6, 0xfc, 0xb1, 0x04, 0x12, 0x42, 0x28, 
-    0x94, 0x47, 0x9a, 0xca, 0x21, 0x93, 0x47, 0x41, 0x4f, 0xa4, 0xb1, 0x2d, 0x11, 
-    0x9d, 0x14, 0x92, 0x22, 0xb8, 0xad, 0xbd, 0x12, 0x86, 0x41, 0x48, 0x1c, 0x91, 
-    0x85, 0x2a, 0xf3, 0x09, 0xc3, 0x50, 0x18, 0x0b, 0xde, 0x36, 0x8c, 0x29, 0x72, 
-    0x28, 0x44, 0x84, 0x2d, 0xac, 0x59, 0xcb, 0xd0, 0x0e, 0x7d, 0x04, 0x28, 0x0a, 
-    0x26, 0x90, 0x5c, 0x61, 0x03, 0x43, 0x85, 0x8a, 0xb6, 0xcb, 0x05, 0x7a, 0x19, 
-    0xf4, 0x68, 0x68, 0xa9, 0x2c, 0x10, 0x31, 0x41, 0x42, 0x7a, 0x36, 0xa1, 0x29, 
-    0x00, 0x60, 0x70, 0xf1, 0x36, 0x68, 0x86, 0x36, 0xa7, 0x97, 0x09, 0x5c, 0x1c, 
-    0xc4, 0xc4, 0x03, 0x6a, 0x33, 0x8c, 0x00, 0x00, 0x54, 0x30, 0x50, 0x40, 0x00, 
-    0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x98, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 
-    0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 0x17, 0x17, 
-    0x18, 0x1d, 0x1d, 0x1d, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 
-    0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x43, 0x45, 0x3b, 0x21, 0x48, 
-    0x46, 0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x53, 0x53, 
-    0x54, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 
-    0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x62, 0x61, 0x76, 0x63, 
-    0x62, 0x6c, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x69, 0x76, 0x6a, 0x6a, 
-    0x7d, 0x6e, 0x4c, 0x51, 0x6e, 0x67, 0x69, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 0x7b, 
-    0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 0x36, 0x77, 
-    0x3d, 0x3d, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 0x46, 0x46, 0x7e, 0x52, 
-    0x55, 0x7f, 0x4a, 0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 0x4e, 0x83, 0x83, 0x84, 
-    0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x85, 0x54, 0x55, 0x88, 0x87, 0x98, 0x88, 
-    0x88, 0x97, 0x89, 0x87, 0x91, 0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 
-    0x8d, 0x90, 0x90, 0x9e, 0x93, 0x69, 0x69, 0x93, 0x72, 0x1b, 0x94, 0x94, 0xa2, 
-    0x95, 0x74, 0x17, 0x96, 0x75, 0x23, 0x97, 0x77, 0x2a, 0x98, 0x77, 0x17, 0x98, 
-    0x77, 0x1c, 0x98, 0x77, 0x20, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9b, 0x7b, 
-    0x1b, 0x9b, 0x7b, 0x24, 0x9b, 0x7c, 0x2c, 0x9c, 0x7e, 0x32, 0x9c, 0x7f, 0x38, 
-    0x9d, 0x9d, 0xaa, 0x9e, 0x7d, 0x17, 0x9e, 0x81, 0x34, 0x9f, 0x80, 0x22, 0x9f, 
-    0x80, 0x2b, 0xa0, 0x80, 0x16, 0xa0, 0x84, 0x3d, 0xa1, 0x82, 0x24, 0xa1, 0x82, 
-    0x28, 0xa1, 0x85, 0x42, 0xa1, 0xa1, 0xad, 0xa3, 0x82, 0x1a, 0xa4, 0x86, 0x34, 
-    0xa4, 0x89, 0x45, 0xa5, 0x88, 0x3b, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa6, 
-    0x8b, 0x4b, 0xa7, 0x8e, 0x51, 0xa8, 0x8f, 0x51, 0xa9, 0x8d, 0x47, 0xa9, 0x8e, 
-    0x4f, 0xa9, 0x90, 0x4d, 0xab, 0x91, 0x55, 0xad, 0xad, 0xb8, 0xae, 0x90, 0x1d, 
-    0xae, 0x93, 0x44, 0xae, 0x95, 0x5b, 0xb0, 0x95, 0x3c, 0xb0, 0x96, 0x57, 0xb1, 
-    0x94, 0x25, 0xb2, 0x97, 0x44, 0xb2, 0x9b, 0x64, 0xb3, 0x9b, 0x52, 0xb4, 0x9f, 
-    0x6a, 0xb4, 0xb4, 0xbe, 0xb5, 0x9d, 0x4a, 0xb6, 0xa1, 0x6c, 0xb7, 0xa2, 0x70, 
-    0xb9, 0xa3, 0x73, 0xba, 0xa4, 0x6a, 0xbb, 0xa0, 0x3a, 0xbb, 0xa7, 0x7a, 0xbd, 
-    0xaa, 0x7c, 0xbe, 0xa7, 0x4e, 0xc0, 0xad, 0x82, 0xc0, 0xae, 0x7f, 0xc3, 0xac, 
-    0x47, 0xc5, 0xb4, 0x8b, 0xc9, 0xb9, 0x91, 0xca, 0xb3, 0x44, 0xca, 0xb9, 0x8f, 
-    0xcc, 0xb5, 0x4b, 0xd0, 0xc2, 0xa3, 0xd7, 0xc3, 0x58, 0xd8, 0xcd, 0xb0, 0xd9, 
-    0xc3, 0x45, 0xe3, 0xd7, 0xa4, 0xed, 0xd8, 0x3a, 0xf3, 0xe4, 0x72, 0xf5, 0xe8, 
-    0x81, 0xf5, 0xea, 0x99, 0xf7, 0xe3, 0x42, 0xfb, 0xed, 0x6c, 0xfd, 0xf3, 0x97, 
-    0xfe, 0xee, 0x62, 0xff, 0xec, 0x3e, 0xff, 0xed, 0x44, 0xff, 0xed, 0x4b, 0xff, 
-    0xee, 0x53, 0xff, 0xef, 0x5a, 0xff, 0xf0, 0x55, 0xff, 0xf0, 0x66, 0xff, 0xf0, 
-    0x6a, 0xff, 0xf1, 0x5c, 0xff, 0xf2, 0x77, 0xff, 0xf2, 0x7c, 0xff, 0xf3, 0x84, 
-    0xff, 0xf4, 0x8e, 0xff, 0xf6, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93, 0x00, 0x31, 0x09, 0x1c, 0x48, 
-    0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x54, 0xd8, 0x68, 0xa1, 0xc3, 0x87, 
-    0x98, 0x14, 0x11, 0xbc, 0x03, 0xb1, 0xa2, 0x44, 0x83, 0x0d, 0x2b, 0x6a, 0xdc, 
-    0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x15, 0xf5, 0x20, 0x34, 0x04, 0x52, 0x60, 0x9c, 
-    0x92, 0x28, 0x07, 0x92, 0xfc, 0x48, 0xf1, 0x21, 0x97, 0x94, 0x0b, 0xfd, 0x94, 
-    0x04, 0x04, 0x53, 0xa1, 0xc8, 0x85, 0x27, 0x61, 0x0a, 0x1a, 0xf8, 0x87, 0xa0, 
-    0x4c, 0x81, 0x6c, 0x6a, 0x2e, 0x3c, 0x23, 0xb4, 0x28, 0xc7, 0x9c, 0x46, 0x93, 
-    0x0a, 0xbd, 0xa2, 0xb4, 0xa9, 0xd3, 0xa7, 0x50, 0x39, 0xae, 0xd1, 0x68, 0x00, 
-    0xe1, 0x00, 0x85, 0x41, 0xa2, 0x3e, 0x65, 0xaa, 0xb5, 0xab, 0x57, 0xa1, 0x52, 
-    0xbe, 0x8a, 0x1d, 0x4b, 0x56, 0x61, 0xd5, 0xa8, 0x05, 0x02, 0x94, 0x85, 0x0a, 
-    0x66, 0x6d, 0xc5, 0xa9, 0x51, 0xb1, 0x68, 0xc5, 0xf1, 0x94, 0x46, 0xca, 0xac, 
-    0x1c, 0x19, 0xb8, 0x2d, 0xba, 0x60, 0xaf, 0x50, 0x04, 0x03, 0x03, 0x02, 0x00, 
-    0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x53, 0x00, 0x2c, 0x04, 0x00, 0x06, 0x00, 
-    0x26, 0x00, 0x30, 0x00, 0x86, 0x13, 0x13, 0x13, 0x17, 0x17, 0x18, 0x1d, 0x1d, 
-    0x1d, 0x1e, 0x1e, 0x21, 0x20, 0x20, 0x1f, 0x23, 0x23, 0x24, 0x2b, 0x2b, 0x2b, 
-    0x33, 0x33, 0x34, 0x3b, 0x3b, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x48, 0x43, 
-    0x43, 0x43, 0x4c, 0x4c, 0x4d, 0x54, 0x53, 0x62, 0x55, 0x54, 0x5c, 0x59, 0x59, 
-    0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x62, 0x61, 0x6e, 0x62, 0x61, 0x76, 
-    0x64, 0x63, 0x64, 0x65, 0x65, 0x7a, 0x6a, 0x69, 0x76, 0x6a, 0x6a, 0x7d, 0x6b, 
-    0x6b, 0x6c, 0x6e, 0x6e, 0x81, 0x74, 0x74, 0x74, 0x75, 0x75, 0x7e, 0x76, 0x76, 
-    0x89, 0x78, 0x77, 0x89, 0x7b, 0x7b, 0x7c, 0x7f, 0x7f, 0x90, 0x83, 0x83, 0x94, 
-    0x84, 0x84, 0x84, 0x89, 0x87, 0x94, 0x89, 0x89, 0x96, 0x8b, 0x8b, 0x9b, 0x8c, 
-    0x8c, 0x8c, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x17, 0x95, 0x95, 0x95, 0x9a, 0x9a, 
-    0x9a, 0x9b, 0x7a, 0x17, 0x9b, 0x7b, 0x1b, 0x9b, 0x7b, 0x24, 0x9b, 0x7c, 0x2c, 
-    0x9c, 0x7e, 0x32, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 0xa0, 
-    0x84, 0x3d, 0xa1, 0x82, 0x28, 0xa1, 0x85, 0x42, 0xa2, 0x81, 0x18, 0xa2, 0xa2, 
-    0xac, 0xa3, 0xa3, 0xa3, 0xa6, 0x8b, 0x4b, 0xa8, 0x8f, 0x51, 0xa9, 0x8d, 0x47, 
-    0xa9, 0x90, 0x4d, 0xab, 0x91, 0x55, 0xad, 0xad, 0xae, 0xb4, 0xb4, 0xbe, 0xb5, 
-    0xb5, 0xb5, 0xb7, 0xa2, 0x70, 0xbc, 0xbc, 0xbc, 0xbd, 0xaa, 0x7c, 0xbf, 0xa7, 
-    0x4a, 0xc4, 0xc4, 0xc4, 0xc7, 0xb6, 0x8c, 0xc9, 0xb9, 0x91, 0xcb, 0xcb, 0xcb, 
-    0xd4, 0xd4, 0xd4, 0xdc, 0xdc, 0xdc, 0xe3, 0xe3, 0xe3, 0xe7, 0xe7, 0xe8, 0xec, 
-    0xec, 0xec, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0xfe, 0xff, 0xed, 0x4b, 0xff, 0xf1, 
-    0x5c, 0xff, 0xf2, 0x7c, 0xff, 0xf4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0xb1, 0x80, 0x53, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 
-    0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 
-    0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0x8c, 0x36, 0x4b, 0x84, 0x4e, 0x87, 
-    0x48, 0xa0, 0xa4, 0x97, 0x4d, 0xa8, 0xac, 0xad, 0x8a, 0xa5, 0xae, 0x8e, 0xb0, 
-    0x94, 0x47, 0xb2, 0x98, 0xa5, 0x4a, 0x53, 0x49, 0x88, 0xb3, 0x99, 0x4b, 0xb5, 
-    0xb5, 0x53, 0xb0, 0xbd, 0x95, 0xb0, 0x4a, 0x4c, 0x87, 0xc4, 0x84, 0x04, 0x8f, 
-    0xb5, 0x4e, 0x21, 0xc2, 0x86, 0xca, 0x8e, 0x4d, 0xa5, 0xb0, 0x0c, 0xa5, 0x00, 
-    0x85, 0xd3, 0x90, 0xa3, 0x89, 0xc3, 0x93, 0xb3, 0xdc, 0xb1, 0xe4, 0xdf, 0x8b, 
-    0x36, 0x98, 0xa7, 0x37, 0xa0, 0x4e, 0xa7, 0x53, 0xc8, 0xaf, 0x95, 0xbb, 0x84, 
-    0x1e, 0x8d, 0xed, 0x82, 0xf5, 0xab, 0x89, 0x4d, 0xee, 0x83, 0x3d, 0x85, 0xcc, 
-    0x2c, 0x29, 0x23, 0x16, 0x70, 0x1b, 0x24, 0x26, 0xde, 0x10, 0x15, 0x78, 0x34, 
-    0x0e, 0xa1, 0x2b, 0x26, 0xfd, 0xec, 0x4d, 0x42, 0xd7, 0xcd, 0x52, 0x90, 0x71, 
-    0x94, 0xf4, 0x29, 0xfa, 0x57, 0xac, 0x9c, 0x39, 0x8f, 0x53, 0x12, 0xb2, 0x8a, 
-    0x88, 0x8a, 0xe4, 0x25, 0x8a, 0x20, 0x15, 0x05, 0x02, 0x00, 0x21, 0xf9, 0x04, 
-    0x05, 0x03, 0x00, 0x41, 0x00, 0x2c, 0x04, 0x00, 0x06, 0x00, 0x26, 0x00, 0x30, 
-    0x00, 0x86, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x23, 0x23, 
-    0x23, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x40, 0x3f, 0x42, 
-    0x41, 0x3f, 0x4d, 0x42, 0x42, 0x42, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x54, 0x56, 
-    0x54, 0x60, 0x59, 0x59, 0x6f, 0x5c, 0x5c, 0x72, 0x62, 0x61, 0x6e, 0x62, 0x61, 
-    0x76, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x6a, 0x7d, 0x6b, 0x6b, 0x6d, 
-    0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7f, 
-    0x7f, 0x90, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x88, 0x87, 
-    0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 
-    0x90, 0x90, 0x9e, 0x98, 0x77, 0x17, 0x98, 0x98, 0xa6, 0x9b, 0x7b, 0x1b, 0x9b, 
-    0x7c, 0x2c, 0x9c, 0x7e, 0x32, 0x9d, 0x9d, 0xaa, 0x9e, 0x7d, 0x17, 0x9e, 0x81, 
-    0x34, 0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x2b, 0xa0, 0x80, 0x16, 0xa0, 0x84, 0x3d, 
-    0xa1, 0xa1, 0xad, 0xa3, 0x82, 0x1a, 0xa4, 0x86, 0x34, 0xa4, 0x89, 0x45, 0xa5, 
-    0x88, 0x3b, 0xa9, 0x8e, 0x4f, 0xab, 0x91, 0x55, 0xae, 0x93, 0x44, 0xae, 0x95, 
-    0x5b, 0xb6, 0xa1, 0x6c, 0xbb, 0xa7, 0x7a, 0xbe, 0xa7, 0x4e, 0xc5, 0xb4, 0x8b, 
-    0xca, 0xb9, 0x8f, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5a, 0xff, 0xf2, 0x77, 0xff, 
-    0xf3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x80, 0x41, 
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 
-    0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 
-    0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa0, 0x14, 0xa1, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 
-    0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 
-    0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0x95, 0x81, 0x00, 0x21, 0xf9, 
-    0x04, 0x05, 0x03, 0x00, 0x5d, 0x00, 0x2c, 0x04, 0x00, 0x05, 0x00, 0x26, 0x00, 
-    0x31, 0x00, 0x86, 0x0b, 0x0b, 0x0c, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x20, 
-    0x20, 0x1f, 0x21, 0x21, 0x28, 0x23, 0x23, 0x24, 0x2b, 0x2b, 0x2b, 0x2f, 0x2f, 
-    0x30, 0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x3e, 0x3e, 0x42, 0x42, 0x42, 0x42, 
-    0x48, 0x46, 0x53, 0x4c, 0x4c, 0x4c, 0x54, 0x52, 0x62, 0x54, 0x54, 0x54, 0x5a, 
-    0x5a, 0x5a, 0x5c, 0x5c, 0x72, 0x61, 0x61, 0x76, 0x65, 0x65, 0x66, 0x65, 0x65, 
-    0x7a, 0x6a, 0x6a, 0x7d, 0x6b, 0x6a, 0x74, 0x6b, 0x6b, 0x6c, 0x6e, 0x6e, 0x81, 
-    0x73, 0x73, 0x74, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x89, 0x79, 0x79, 0x79, 0x7b, 
-    0x7b, 0x8c, 0x7c, 0x7b, 0x84, 0x7f, 0x7f, 0x90, 0x83, 0x83, 0x84, 0x83, 0x83, 
-    0x94, 0x89, 0x87, 0x94, 0x8a, 0x8a, 0x95, 0x8b, 0x8b, 0x9b, 0x8e, 0x8d, 0x8e, 
-    0x92, 0x92, 0x9d, 0x93, 0x93, 0x93, 0x95, 0x74, 0x17, 0x98, 0x98, 0xa6, 0x9b, 
-    0x7a, 0x17, 0x9b, 0x7b, 0x1b, 0x9b, 0x7b, 0x24, 0x9b, 0x7c, 0x2c, 0x9c, 0x7e, 
-    0x32, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 
-    0xa0, 0x84, 0x3d, 0xa1, 0x82, 0x28, 0xa1, 0x85, 0x42, 0xa2, 0x81, 0x18, 0xa2, 
-    0xa2, 0xac, 0xa3, 0xa3, 0xa4, 0xa4, 0x89, 0x45, 0xa6, 0x8b, 0x4b, 0xa8, 0x8f, 
-    0x51, 0xa9, 0x8e, 0x4f, 0xa9, 0xa9, 0xa9, 0xab, 0x91, 0x55, 0xac, 0x92, 0x47, 
-    0xae, 0x95, 0x5b, 0xb0, 0xaf, 0xaf, 0xb2, 0x97, 0x44, 0xb4, 0xb4, 0xb4, 0xb5, 
-    0xb5, 0xbc, 0xb7, 0xa2, 0x70, 0xbb, 0xbb, 0xbc, 0xbd, 0xaa, 0x7c, 0xbf, 0xa7, 
-    0x4a, 0xc0, 0xad, 0x82, 0xc2, 0xc2, 0xc2, 0xc7, 0xb6, 0x8c, 0xc9, 0xb9, 0x91, 
-    0xcb, 0xb3, 0x46, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xdc, 0xdc, 0xdc, 0xe5, 
-    0xe5, 0xe5, 0xeb, 0xeb, 0xeb, 0xef, 0xef, 0xf0, 0xf3, 0xf3, 0xf4, 0xf7, 0xe6, 
-    0x4f, 0xfd, 0xf3, 0x97, 0xfd, 0xfd, 0xfd, 0xff, 0xee, 0x53, 0xff, 0xf0, 0x55, 
-    0xff, 0xf1, 0x5c, 0xff, 0xf2, 0x7c, 0xff, 0xf4, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0x80, 
-    0x5d, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 
-    0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x87, 0x55, 0x97, 0x9a, 
-    0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0x90, 0x57, 0xa3, 0xa6, 0x8f, 
-    0x51, 0xa7, 0xaa, 0x84, 0x2f, 0xab, 0x1c, 0xab, 0x9c, 0x52, 0x8a, 0xa5, 0x9a, 
-    0x4f, 0x8b, 0xb4, 0x96, 0x4a, 0x53, 0x88, 0xb4, 0xb8, 0x92, 0x44, 0xb6, 0x5d, 
-    0xbe, 0x5d, 0x52, 0xbb, 0xbb, 0xc2, 0x95, 0xc7, 0x89, 0xb2, 0x82, 0x57, 0x10, 
-    0xbf, 0xc8, 0xb8, 0x57, 0x3d, 0x5d, 0xca, 0x52, 0xb4, 0xaf, 0x95, 0xcc, 0x83, 
-    0x46, 0xcd, 0xde, 0x5d, 0xad, 0x8d, 0x26, 0xc8, 0x8d, 0xbb, 0x54, 0x92, 0xca, 
-    0xb0, 0x93, 0xc3, 0x9f, 0x51, 0x4f, 0x4f, 0xe9, 0x84, 0x01, 0x9a, 0x57, 0xc1, 
-    0x50, 0x4e, 0x89, 0x26, 0xec, 0x94, 0xf8, 0x8f, 0xe1, 0xe1, 0x89, 0xea, 0x15, 
-    0x0a, 0xd2, 0x88, 0xda, 0x23, 0x27, 0xbe, 0xf6, 0x19, 0x52, 0x88, 0x68, 0x4a, 
-    0xaa, 0x42, 0x18, 0x1a, 0x29, 0x19, 0xf4, 0x22, 0x58, 0xc3, 0x87, 0xa6, 0xa4, 
-    0x3c, 0x39, 0x37, 0x88, 0xa1, 0xa7, 0x6d, 0xf4, 0x0a, 0x75, 0x73, 0xe4, 0x91, 
-    0x10, 0x47, 0x42, 0xd9, 0x06, 0x11, 0x44, 0x44, 0xa4, 0x13, 0x48, 0x48, 0xf1, 
-    0x0e, 0x95, 0x54, 0x77, 0xe9, 0xe5, 0xa9, 0x98, 0xab, 0x08, 0xc4, 0x6a, 0x08, 
-    0xa0, 0x50, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x40, 0x00, 0x2c, 
-    0x04, 0x00, 0x05, 0x00, 0x26, 0x00, 0x31, 0x00, 0x85, 0x0c, 0x0c, 0x0c, 0x12, 
-    0x12, 0x12, 0x1d, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x3e, 0x3d, 
-    0x43, 0x42, 0x42, 0x42, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x54, 
-    0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x61, 
-    0x61, 0x76, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x6a, 0x7d, 0x73, 0x73, 
-    0x75, 0x73, 0x73, 0x85, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 
-    0x7f, 0x7f, 0x90, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8d, 
-    0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x98, 0x77, 0x17, 0x9b, 0x7b, 0x1b, 0x9b, 0x7c, 
-    0x2c, 0x9c, 0x7e, 0x32, 0x9e, 0x7d, 0x17, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 
-    0x9f, 0x80, 0x2b, 0xa0, 0x80, 0x16, 0xa0, 0x84, 0x3d, 0xa1, 0xa1, 0xad, 0xa3, 
-    0x82, 0x1a, 0xa4, 0x86, 0x34, 0xa5, 0x88, 0x3b, 0xa6, 0x8b, 0x4b, 0xa8, 0x8f, 
-    0x51, 0xa9, 0x8e, 0x4f, 0xa9, 0x90, 0x4d, 0xab, 0x91, 0x55, 0xae, 0x93, 0x44, 
-    0xb4, 0xb4, 0xbe, 0xb6, 0xa1, 0x6c, 0xbb, 0xa7, 0x7a, 0xbe, 0xa7, 0x4e, 0xc0, 
-    0xae, 0x7f, 0xc5, 0xb4, 0x8b, 0xca, 0xb3, 0x44, 0xca, 0xb9, 0x8f, 0xcc, 0xb5, 
-    0x4b, 0xff, 0xed, 0x4b, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5a, 0xff, 0xf2, 0x77, 
-    0xff, 0xf3, 0x84, 0xff, 0xf4, 0x8e, 0x07, 0x3f, 0x80, 0x40, 0x82, 0x83, 0x84, 
-    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 
-    0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 
-    0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 
-    0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 
-    0xb9, 0xba, 0xbb, 0xbc, 0xa0, 0x81, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 
-    0x56, 0x00, 0x2c, 0x05, 0x00, 0x05, 0x00, 0x25, 0x00, 0x31, 0x00, 0x86, 0x0c, 
-    0x0c, 0x0c, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x20, 0x20, 0x1f, 0x22, 0x22, 
-    0x29, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x37, 0x37, 0x38, 
-    0x3b, 0x3b, 0x3c, 0x3d, 0x3c, 0x44, 0x43, 0x43, 0x43, 0x48, 0x46, 0x53, 0x4c, 
-    0x4c, 0x4d, 0x4e, 0x4d, 0x5b, 0x54, 0x54, 0x55, 0x55, 0x55, 0x5b, 0x59, 0x59, 
-    0x6f, 0x5b, 0x5a, 0x5b, 0x63, 0x63, 0x64, 0x63, 0x63, 0x6c, 0x6a, 0x69, 0x76, 
-    0x6b, 0x67, 0x69, 0x6c, 0x6c, 0x6c, 0x73, 0x73, 0x7b, 0x73, 0x73, 0x85, 0x74, 
-    0x74, 0x74, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8c, 0x83, 0x83, 0x94, 0x84, 0x84, 
-    0x85, 0x88, 0x88, 0x97, 0x89, 0x87, 0x94, 0x8b, 0x8b, 0x8b, 0x90, 0x90, 0x9e, 
-    0x93, 0x93, 0x93, 0x95, 0x74, 0x17, 0x9b, 0x7a, 0x17, 0x9b, 0x7b, 0x1b, 0x9b, 
-    0x7b, 0x24, 0x9b, 0x7c, 0x2c, 0x9c, 0x7e, 0x32, 0x9c, 0x9c, 0x9c, 0x9e, 0x81, 
-    0x34, 0x9e, 0x81, 0x3b, 0xa0, 0x84, 0x3d, 0xa1, 0x82, 0x28, 0xa1, 0x85, 0x42, 
-    0xa2, 0x81, 0x18, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xac, 0xa4, 0x89, 0x45, 0xa6, 
-    0x8b, 0x4b, 0xa8, 0x8f, 0x51, 0xa9, 0x8e, 0x4f, 0xab, 0x91, 0x55, 0xac, 0x92, 
-    0x47, 0xac, 0xac, 0xac, 0xae, 0x95, 0x5b, 0xb2, 0x97, 0x44, 0xb4, 0xb4, 0xbd, 
-    0xb6, 0xb6, 0xb6, 0xb7, 0xa2, 0x70, 0xbc, 0xbc, 0xbd, 0xbd, 0xaa, 0x7c, 0xbf, 
-    0xa7, 0x4a, 0xc0, 0xad, 0x82, 0xc3, 0xc2, 0xc3, 0xc7, 0xb6, 0x8c, 0xc9, 0xb9, 
-    0x91, 0xcb, 0xb3, 0x46, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xdb, 0xdb, 0xdb, 
-    0xe3, 0xe3, 0xe4, 0xec, 0xec, 0xed, 0xef, 0xef, 0xf2, 0xf4, 0xf4, 0xf4, 0xf7, 
-    0xe6, 0x4f, 0xfd, 0xf3, 0x97, 0xfe, 0xfe, 0xfe, 0xff, 0xee, 0x53, 0xff, 0xf0, 
-    0x55, 0xff, 0xf1, 0x5c, 0xff, 0xf2, 0x7c, 0xff, 0xf4, 0x8e, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x79, 0x80, 0x56, 0x82, 0x83, 0x84, 
-    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 
-    0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 
-    0x9f, 0xa0, 0xa1, 0x95, 0x17, 0x95, 0x4c, 0x8d, 0x4a, 0xa2, 0x82, 0x3f, 0xa9, 
-    0x56, 0x2a, 0xac, 0xaf, 0xaf, 0x09, 0xb0, 0x95, 0xab, 0x87, 0x49, 0xb3, 0x82, 
-    0x08, 0x9a, 0x21, 0x89, 0x10, 0x88, 0x01, 0xb8, 0x8f, 0x3d, 0x9d, 0x4b, 0x89, 
-    0xa6, 0x84, 0xb5, 0x8b, 0xc7, 0xc1, 0xcc, 0x88, 0x4d, 0x82, 0x4d, 0x31, 0xa0, 
-    0x47, 0x82, 0x49, 0x48, 0x9f, 0xb7, 0xa9, 0xd4, 0x83, 0xcf, 0x9e, 0xdd, 0x84, 
-    0xba, 0x90, 0xc9, 0x86, 0x4d, 0xd9, 0xa1, 0xe5, 0xa9, 0x4b, 0xdb, 0xac, 0xa8, 
-    0xcd, 0xee, 0x8e, 0xe6, 0xef, 0xf2, 0xf3, 0xf4, 0x8c, 0x04, 0xc1, 0x81, 0x00, 
-    0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x3c, 0x00, 0x2c, 0x05, 0x00, 0x04, 0x00, 
-    0x25, 0x00, 0x32, 0x00, 0x85, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x23, 0x23, 
-    0x23, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x42, 
-    0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x53, 0x53, 0x54, 0x55, 0x54, 0x5c, 0x5b, 
-    0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x60, 0x5e, 0x6b, 0x62, 0x61, 0x6e, 0x64, 0x63, 
-    0x65, 0x6b, 0x6b, 0x6c, 0x6e, 0x67, 0x69, 0x73, 0x73, 0x75, 0x7a, 0x7a, 0x7b, 
-    0x7f, 0x7f, 0x90, 0x83, 0x83, 0x84, 0x88, 0x87, 0x98, 0x89, 0x87, 0x91, 0x8d, 
-    0x8d, 0x8d, 0x98, 0x77, 0x17, 0x9b, 0x7b, 0x1b, 0x9b, 0x7c, 0x2c, 0x9c, 0x7e, 
-    0x32, 0x9e, 0x7d, 0x17, 0x9e, 0x81, 0x34, 0x9e, 0x81, 0x3b, 0x9f, 0x80, 0x2b, 
-    0xa0, 0x80, 0x16, 0xa0, 0x84, 0x3d, 0xa1, 0xa1, 0xad, 0xa3, 0x82, 0x1a, 0xa4, 
-    0x86, 0x34, 0xa5, 0x88, 0x3b, 0xa6, 0x8b, 0x4b, 0xa8, 0x8f, 0x51, 0xa9, 0x8e, 
-    0x4f, 0xa9, 0x90, 0x4d, 0xab, 0x91, 0x55, 0xae, 0x93, 0x44, 0xb4, 0xb4, 0xbe, 
-    0xb6, 0xa1, 0x6c, 0xbb, 0xa7, 0x7a, 0xbe, 0xa7, 0x4e, 0xc0, 0xae, 0x7f, 0xc5, 
-    0xb4, 0x8b, 0xca, 0xb3, 0x44, 0xca, 0xb9, 0x8f, 0xcc, 0xb5, 0x4b, 0xff, 0xed, 
-    0x4b, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5a, 0xff, 0xf2, 0x77, 0xff, 0xf3, 0x84, 
-    0xff, 0xf4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x38, 0x40, 0x9e, 0x70, 0x48, 0x2c, 0x1a, 0x8f, 0xc8, 0xa4, 
-    0x72, 0xc9, 0x6c, 0x3a, 0x9f, 0xd0, 0xa8, 0x74, 0x4a, 0xad, 0x5a, 0xaf, 0xd8, 
-    0xac, 0x76, 0xcb, 0xed, 0x7a, 0xbf, 0xe0, 0xb0, 0x78, 0x4c, 0x2e, 0x9b, 0xcf, 
-    0xe8, 0xb4, 0x7a, 0xcd, 0x6e, 0xbb, 0xdf, 0xf0, 0xb8, 0x7c, 0x4e, 0xaf, 0xdb, 
-    0xef, 0xf8, 0xbc, 0x7e, 0xcf, 0xa7, 0x06, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 
-    0x03, 0x00, 0xd9, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 
-    0x87, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x04, 0x0b, 0x0b, 0x0c, 0x0f, 0x0e, 0x0f, 
-    0x14, 0x14, 0x14, 0x17, 0x16, 0x1a, 0x19, 0x17, 0x05, 0x1b, 0x1b, 0x1c, 0x1d, 
-    0x1d, 0x23, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 0x25, 0x1f, 0x05, 0x29, 0x24, 
-    0x08, 0x2c, 0x2c, 0x2c, 0x2d, 0x2a, 0x12, 0x2f, 0x2d, 0x3a, 0x33, 0x33, 0x34, 
-    0x35, 0x33, 0x3b, 0x3a, 0x34, 0x0b, 0x3a, 0x39, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 
-    0x3d, 0x0d, 0x43, 0x43, 0x44, 0x45, 0x3b, 0x21, 0x4b, 0x49, 0x57, 0x4c, 0x4c, 
-    0x4d, 0x4e, 0x4e, 0x60, 0x53, 0x53, 0x54, 0x54, 0x4c, 0x11, 0x55, 0x54, 0x5c, 
-    0x56, 0x56, 0x6c, 0x58, 0x56, 0x61, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 
-    0x42, 0x4e, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 
-    0x63, 0x65, 0x65, 0x7a, 0x66, 0x64, 0x6b, 0x6a, 0x5c, 0x13, 0x6a, 0x63, 0x5e, 
-    0x6a, 0x6a, 0x7d, 0x6c, 0x26, 0x27, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6e, 
-    0x6e, 0x81, 0x72, 0x5e, 0x2d, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 0x73, 0x73, 
-    0x73, 0x74, 0x73, 0x7f, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x6a, 0x17, 
-    0x76, 0x76, 0x88, 0x7a, 0x49, 0x4a, 0x7b, 0x7b, 0x8c, 0x7c, 0x28, 0x29, 0x7c, 
-    0x7b, 0x84, 0x7c, 0x7c, 0x7c, 0x7e, 0x73, 0x19, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 
-    0x4d, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x83, 0x8f, 
-    0x86, 0x79, 0x1b, 0x87, 0x58, 0x58, 0x89, 0x89, 0x95, 0x8a, 0x2e, 0x2e, 0x8b, 
-    0x2f, 0x30, 0x8c, 0x68, 0x0b, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x9b, 0x8e, 0x30, 
-    0x31, 0x91, 0x66, 0x66, 0x91, 0x91, 0x9e, 0x93, 0x32, 0x32, 0x93, 0x93, 0x93, 
-    0x94, 0x94, 0xa2, 0x95, 0x76, 0x26, 0x95, 0x87, 0x1d, 0x96, 0x8d, 0x4e, 0x97, 
-    0x74, 0x0b, 0x99, 0x79, 0x16, 0x9a, 0x9a, 0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 
-    0x74, 0x9b, 0x7b, 0x24, 0x9b, 0x7d, 0x33, 0x9c, 0x7c, 0x1b, 0x9c, 0x7d, 0x2c, 
-    0x9c, 0x9c, 0x9c, 0x9d, 0x7b, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 
-    0x81, 0x34, 0x9e, 0x81, 0x3b, 0x9e, 0x88, 0x26, 0xa0, 0x37, 0x37, 0xa0, 0x83, 
-    0x3c, 0xa2, 0x7f, 0x7f, 0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xae, 0xa3, 0x83, 0x1a, 
-    0xa3, 0x86, 0x38, 0xa3, 0xa3, 0xa4, 0xa4, 0x83, 0x0f, 0xa4, 0x83, 0x12, 0xa4, 
-    0x85, 0x24, 0xa4, 0x89, 0x46, 0xa5, 0x8b, 0x4a, 0xa6, 0x98, 0x22, 0xa6, 0xa6, 
-    0xb2, 0xa8, 0x8e, 0x4a, 0xa8, 0x8e, 0x51, 0xab, 0x8b, 0x14, 0xab, 0x91, 0x55, 
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xac, 0x8c, 0x19, 0xae, 0x96, 0x5b, 0xae, 
-    0xae, 0xb9, 0xaf, 0x90, 0x16, 0xaf, 0x90, 0x90, 0xaf, 0x98, 0x61, 0xb0, 0x96, 
-    0x52, 0xb2, 0x94, 0x16, 0xb2, 0x9b, 0x64, 0xb3, 0x9d, 0x69, 0xb3, 0xb3, 0xb4, 
-    0xb4, 0x96, 0x19, 0xb4, 0x98, 0x31, 0xb4, 0xb4, 0xbd, 0xb6, 0xa1, 0x6d, 0xb7, 
-    0x99, 0x18, 0xb8, 0xa9, 0x25, 0xba, 0x9c, 0x1a, 0xba, 0xa3, 0xa4, 0xba, 0xb9, 
-    0xc3, 0xbb, 0xa5, 0x68, 0xbb, 0xbb, 0xc4, 0xbc, 0xa8, 0x77, 0xbc, 0xbc, 0xbc, 
-    0xbe, 0xa2, 0x1b, 0xc1, 0xae, 0x83, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 
-    0xb2, 0x88, 0xc4, 0xc4, 0xcb, 0xc6, 0xaa, 0x1d, 0xc7, 0xac, 0x29, 0xc7, 0xb3, 
-    0x6e, 0xc8, 0xb8, 0x28, 0xc9, 0xad, 0x1e, 0xc9, 0xb3, 0x46, 0xc9, 0xb6, 0xb7, 
-    0xc9, 0xb9, 0x93, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x1e, 0xcd, 
-    0xb2, 0x21, 0xd3, 0xd3, 0xd4, 0xd4, 0xbb, 0x24, 0xd4, 0xc6, 0xa7, 0xd5, 0xbb, 
-    0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xdb, 0xc6, 0x2a, 0xdb, 0xdb, 0xdd, 
-    0xdc, 0xc3, 0x25, 0xdd, 0xd2, 0xba, 0xde, 0xde, 0xe2, 0xe0, 0xd4, 0xa1, 0xe2, 
-    0xc9, 0x27, 0xe2, 0xcc, 0x32, 0xe3, 0xd0, 0x5b, 0xe3, 0xd9, 0xd9, 0xe3, 0xe3, 
-    0xe5, 0xe4, 0xcc, 0x29, 0xe4, 0xdc, 0xc9, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2c, 
-    0xea, 0xd4, 0x2c, 0xea, 0xe4, 0xe4, 0xeb, 0xeb, 0xec, 0xec, 0xd9, 0x33, 0xed, 
-    0xe7, 0xdb, 0xee, 0xd8, 0x2d, 0xee, 0xef, 0xf1, 0xf2, 0xdc, 0x2e, 0xf2, 0xed, 
-    0xe7, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 0xf5, 0xe0, 0x2f, 0xf6, 0xe1, 0x31, 
-    0xf6, 0xf3, 0xed, 0xf7, 0xe5, 0x47, 0xf7, 0xf7, 0xf8, 0xf8, 0xe5, 0x3e, 0xf9, 
-    0xf7, 0xf4, 0xfa, 0xe5, 0x32, 0xfd, 0xf2, 0x96, 0xfe, 0xee, 0x57, 0xff, 0xeb, 
-    0x34, 0xff, 0xec, 0x3b, 0xff, 0xed, 0x44, 0xff, 0xee, 0x4c, 0xff, 0xef, 0x61, 
-    0xff, 0xf0, 0x66, 0xff, 0xf1, 0x5a, 0xff, 0xf2, 0x7a, 0xff, 0xf3, 0x86, 0xff, 
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0xff, 0x00, 0xb3, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 
-    0xb2, 0x0e, 0x2a, 0x5c, 0xc8, 0x50, 0xa0, 0xb4, 0x84, 0x0d, 0x23, 0x2e, 0x9c, 
-    0xd5, 0x2a, 0xdb, 0xb3, 0x5c, 0x03, 0x33, 0x49, 0xdc, 0x38, 0x6b, 0x58, 0x34, 
-    0x68, 0xb2, 0x98, 0x61, 0x34, 0x15, 0xcc, 0xd9, 0xc6, 0x93, 0xb6, 0x9e, 0x3d, 
-    0xd3, 0x25, 0x6b, 0xd5, 0x33, 0x69, 0x27, 0x4f, 0x7a, 0x52, 0xf9, 0x8c, 0xd9, 
-    0xb3, 0x5f, 0xa6, 0xfc, 0xc4, 0x94, 0x88, 0x8a, 0xa6, 0x4a, 0x9b, 0xcf, 0x20, 
-    0xee, 0x54, 0xe8, 0x69, 0x98, 0xcf, 0x67, 0xc5, 0x72, 0x21, 0x1b, 0x6a, 0xb0, 
-    0x52, 0x2b, 0x54, 0xba, 0x82, 0x05, 0xcb, 0xa5, 0x0b, 0xa8, 0x4a, 0xa1, 0x4c, 
-    0xb3, 0xa1, 0xb2, 0x69, 0xcb, 0xd4, 0x30, 0x91, 0xbd, 0x72, 0xfd, 0x0c, 0xb6, 
-    0x34, 0x6b, 0x36, 0x4d, 0x40, 0x7f, 0x59, 0xb5, 0xaa, 0x2b, 0x5b, 0x1d, 0xb3, 
-    0xd9, 0x5a, 0x1d, 0x9d, 0x1b, 0x4c, 0xd6, 0x2c, 0xb8, 0x71, 0xe7, 0xea, 0xca, 
-    0x45, 0x15, 0xab, 0x59, 0x4f, 0x62, 0x69, 0x32, 0x5b, 0x65, 0x54, 0xa5, 0xad, 
-    0x49, 0x78, 0x85, 0x80, 0x9a, 0x05, 0x6b, 0x2f, 0x2c, 0x5f, 0xb0, 0x60, 0xcd, 
-    0x62, 0xec, 0xf2, 0xd7, 0xaa, 0x43, 0x4c, 0xd5, 0xf0, 0xc2, 0xc6, 0x79, 0x19, 
-    0xe7, 0xcf, 0x9f, 0x4b, 0xf9, 0xe8, 0xf5, 0x6c, 0x18, 0xe6, 0x98, 0x7a, 0x88, 
-    0x81, 0x5e, 0x0d, 0xba, 0x05, 0x00, 0x09, 0x2e, 0x49, 0xc5, 0x94, 0x02, 0x8c, 
-    0xb5, 0xed, 0x5a, 0x00, 0x72, 0x2f, 0x58, 0xc5, 0x28, 0x66, 0x29, 0xdb, 0xb6, 
-    0x25, 0xe5, 0xd6, 0x5d, 0xe9, 0xa4, 0x10, 0xd5, 0xc0, 0x57, 0x7f, 0x19, 0x9e, 
-    0x3b, 0x85, 0xa9, 0x8d, 0x74, 0x92, 0xb3, 0xee, 0xc1, 0x3c, 0xf7, 0x22, 0x54, 
-    0x12, 0x21, 0x49, 0x5f, 0x1d, 0xa2, 0xfa, 0x6b, 0x8c, 0x11, 0x43, 0x7d, 0xff, 
-    0xe6, 0xf5, 0x4a, 0x3a, 0x05, 0xef, 0x00, 0xe6, 0x48, 0x4c, 0xc5, 0xb9, 0x54, 
-    0x2d, 0x4c, 0xac, 0x92, 0x01, 0x6f, 0x80, 0xde, 0x81, 0x44, 0x60, 0xaf, 0x24, 
-    0xd5, 0xc6, 0x86, 0x2b, 0x94, 0x25, 0x4c, 0xa1, 0xb0, 0xf7, 0x19, 0x7d, 0xe8, 
-    0x25, 0xd0, 0x10, 0x22, 0xa5, 0xa4, 0x22, 0x9f, 0x6a, 0xb5, 0x6c, 0xc6, 0x0b, 
-    0x30, 0xc9, 0xec, 0x87, 0xcd, 0x79, 0xe8, 0x21, 0xc0, 0x10, 0x6d, 0xc9, 0xd4, 
-    0x82, 0x4d, 0x28, 0x2d, 0x60, 0xb3, 0xc4, 0x0c, 0x9c, 0x35, 0x08, 0x5a, 0x07, 
-    0xe8, 0x01, 0x70, 0xc0, 0x42, 0x88, 0xd4, 0x56, 0x1e, 0x36, 0x85, 0x64, 0x80, 
-    0x4d, 0x1e, 0x04, 0xec, 0x27, 0xca, 0x66, 0x9c, 0x51, 0x57, 0xe2, 0x41, 0x74, 
-    0xb0, 0xc2, 0x19, 0x2e, 0xaf, 0x6c, 0xf6, 0x0a, 0x26, 0xd8, 0x10, 0x23, 0x89, 
-    0x7c, 0xd8, 0x94, 0xa2, 0x23, 0x67, 0xcb, 0xdd, 0x48, 0xd0, 0x13, 0xbf, 0x81, 
-    0xc6, 0x0b, 0x91, 0xac, 0x41, 0x88, 0x1c, 0x36, 0xc2, 0x29, 0x29, 0x90, 0x1e, 
-    0x12, 0x6e, 0x07, 0xdc, 0x2b, 0x25, 0x02, 0x30, 0x10, 0x22, 0x50, 0x6a, 0x09, 
-    0x5c, 0x32, 0x16, 0x28, 0xa9, 0x46, 0x98, 0x62, 0xae, 0x56, 0x0b, 0x2e, 0xd8, 
-    0xb4, 0x81, 0x1e, 0x01, 0x02, 0x1d, 0x99, 0xe6, 0x6a, 0xc9, 0x84, 0x42, 0x0c, 
-    0x30, 0x46, 0xa2, 0x57, 0x80, 0x40, 0x73, 0xda, 0xa6, 0xe0, 0x67, 0xa1, 0x04, 
-    0xe1, 0x5d, 0x03, 0x7c, 0x82, 0x56, 0xca, 0x17, 0x41, 0xf4, 0xf0, 0xc5, 0x94, 
-    0xc0, 0x89, 0x02, 0x1a, 0x30, 0x7a, 0x04, 0xc0, 0x9c, 0x81, 0x85, 0x72, 0x96, 
-    0x47, 0x75, 0x85, 0x48, 0x57, 0x0a, 0xa3, 0xd8, 0x48, 0x41, 0x21, 0x00, 0x16, 
-    0x0e, 0x04, 0x5a, 0x99, 0xcc, 0x49, 0x92, 0x5c, 0x32, 0x72, 0x72, 0x96, 0xcc, 
-    0x0b, 0xd9, 0x40, 0x40, 0x00, 0xa5, 0xa2, 0x7e, 0x9d, 0x66, 0x49, 0x08, 0x16, 
-    0xcc, 0xf0, 0x45, 0x93, 0x63, 0xa6, 0x1a, 0x24, 0x43, 0x7d, 0x3e, 0x6a, 0x27, 
-    0x68, 0xc9, 0xe8, 0xb0, 0x50, 0xaf, 0x9c, 0xbd, 0xa2, 0x46, 0x36, 0x47, 0x68, 
-    0xc8, 0x19, 0x2f, 0x5a, 0x00, 0xa1, 0x10, 0x9b, 0x73, 0x26, 0x63, 0x09, 0x41, 
-    0x8e, 0x60, 0x43, 0xcb, 0x1f, 0x4d, 0x24, 0x31, 0x84, 0x42, 0x7a, 0xa0, 0x99, 
-    0x1c, 0x31, 0x7a, 0x14, 0xe4, 0x04, 0x1a, 0x4d, 0x20, 0x61, 0xc4, 0x27, 0xe1, 
-    0x2a, 0x04, 0xa6, 0x96, 0xac, 0x60, 0x61, 0x50, 0x12, 0x48, 0x68, 0xa1, 0x8a, 
-    0x7c, 0xbc, 0x30, 0x24, 0xc6, 0x9f, 0x51, 0x96, 0x42, 0x87, 0x42, 0x46, 0xd0, 
-    0xb2, 0xda, 0xb4, 0x0c, 0xfd, 0xd0, 0x07, 0x80, 0xa2, 0x60, 0x02, 0x09, 0x16, 
-    0x38, 0x30, 0xa4, 0xdd, 0x6a, 0xb8, 0x60, 0x80, 0x97, 0x41, 0x34, 0x82, 0x96, 
-    0x8a, 0x02, 0x0f, 0x13, 0x04, 0x24, 0x67, 0x12, 0x96, 0x02, 0x40, 0x06, 0x15, 
-    0x67, 0x73, 0xe6, 0x67, 0x72, 0x72, 0x49, 0xf1, 0xc3, 0x42, 0x44, 0x8c, 0x8d, 
-    0x80, 0xd8, 0x00, 0x23, 0x00, 0x00, 0x16, 0x0c, 0x14, 0x10, 0x00, 0x21, 0xf9, 
-    0x04, 0x09, 0x03, 0x00, 0x93, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 
-    0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 
-    0x1d, 0x1d, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3b, 0x3b, 0x3c, 0x3d, 0x3c, 
-    0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x42, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 
-    0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x53, 0x53, 0x54, 0x55, 0x54, 0x5c, 0x56, 
-    0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 
-    0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x62, 0x61, 0x6e, 0x62, 0x61, 0x76, 
-    0x64, 0x63, 0x65, 0x6a, 0x6a, 0x7d, 0x6b, 0x6a, 0x74, 0x6b, 0x6b, 0x6c, 0x6e, 
-    0x4c, 0x51, 0x6e, 0x67, 0x69, 0x6e, 0x6e, 0x81, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 
-    0x7b, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 0x36, 
-    0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 
-    0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 
-    0x4e, 0x83, 0x52, 0x53, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 
-    0x88, 0x56, 0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8a, 
-    0x5c, 0x5c, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x93, 0x69, 
-    0x69, 0x94, 0x74, 0x18, 0x94, 0x94, 0xa2, 0x96, 0x76, 0x22, 0x97, 0x77, 0x29, 
-    0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9b, 0x7b, 0x1c, 0x9b, 0x7b, 0x24, 0x9c, 
-    0x7c, 0x2c, 0x9c, 0x7e, 0x32, 0x9d, 0x9d, 0xaa, 0x9e, 0x7e, 0x16, 0x9e, 0x80, 
-    0x2c, 0x9e, 0x81, 0x36, 0x9f, 0x80, 0x24, 0xa0, 0x83, 0x3c, 0xa1, 0x82, 0x24, 
-    0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 0xa2, 0x83, 0x28, 0xa2, 0x84, 0x33, 0xa3, 
-    0x84, 0x1b, 0xa4, 0x89, 0x3d, 0xa4, 0x89, 0x45, 0xa5, 0x8b, 0x4a, 0xa5, 0xa5, 
-    0xb1, 0xa6, 0x83, 0x83, 0xa7, 0x8d, 0x50, 0xa8, 0x8d, 0x45, 0xa9, 0x8e, 0x4d, 
-    0xa9, 0x8f, 0x51, 0xaa, 0x91, 0x55, 0xad, 0x92, 0x39, 0xad, 0xad, 0xb8, 0xae, 
-    0x94, 0x44, 0xae, 0x95, 0x5b, 0xb0, 0x96, 0x57, 0xb0, 0x98, 0x5c, 0xb1, 0x98, 
-    0x4f, 0xb2, 0x9b, 0x64, 0xb3, 0x97, 0x36, 0xb3, 0x9d, 0x69, 0xb4, 0xb4, 0xbe, 
-    0xb6, 0x98, 0x1d, 0xb7, 0x9a, 0x22, 0xb7, 0x9c, 0x38, 0xba, 0x9f, 0x37, 0xba, 
-    0xa5, 0x74, 0xbb, 0xa6, 0x73, 0xbb, 0xa7, 0x79, 0xbc, 0xa7, 0x69, 0xbe, 0xa8, 
-    0x66, 0xbe, 0xab, 0x7b, 0xc0, 0xac, 0x6f, 0xc1, 0xae, 0x84, 0xc2, 0xa8, 0x3b, 
-    0xc3, 0xaa, 0x44, 0xc3, 0xaf, 0x79, 0xc4, 0xb1, 0x85, 0xcb, 0xbb, 0x94, 0xcc, 
-    0xb4, 0x42, 0xd1, 0xc3, 0xa0, 0xd3, 0xbf, 0x61, 0xd4, 0xbf, 0x50, 0xdc, 0xce, 
-    0x98, 0xdf, 0xcc, 0x60, 0xe1, 0xcf, 0x69, 0xe8, 0xd4, 0x49, 0xef, 0xdb, 0x37, 
-    0xf5, 0xe4, 0x5f, 0xf5, 0xea, 0x96, 0xf6, 0xed, 0xab, 0xf7, 0xe5, 0x4a, 0xf8, 
-    0xe5, 0x40, 0xfe, 0xf3, 0x8b, 0xff, 0xed, 0x44, 0xff, 0xee, 0x4c, 0xff, 0xee, 
-    0x53, 0xff, 0xef, 0x5b, 0xff, 0xef, 0x61, 0xff, 0xf0, 0x65, 0xff, 0xf1, 0x6a, 
-    0xff, 0xf1, 0x76, 0xff, 0xf2, 0x7b, 0xff, 0xf3, 0x83, 0xff, 0xf4, 0x94, 0xff, 
-    0xf5, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xa9, 0x00, 0x27, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 
-    0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x81, 0x73, 0x1e, 
-    0x32, 0xec, 0x23, 0xb1, 0xa2, 0xc5, 0x8b, 0x0d, 0x01, 0x4d, 0xe2, 0x82, 0xb1, 
-    0xa3, 0x47, 0x86, 0x81, 0x3e, 0x4e, 0x8a, 0x28, 0x10, 0x90, 0x46, 0x91, 0x18, 
-    0x09, 0x79, 0x24, 0xa9, 0xf0, 0xcf, 0x24, 0x2c, 0x28, 0x17, 0x52, 0x8c, 0x49, 
-    0xd3, 0x20, 0x1e, 0x86, 0x6a, 0x50, 0xfa, 0xe1, 0x33, 0xc9, 0xa5, 0x40, 0x3e, 
-    0x7e, 0xfc, 0x4c, 0xd2, 0x33, 0x30, 0x4d, 0xcd, 0xa3, 0x17, 0x6f, 0x22, 0x35, 
-    0x98, 0x73, 0x69, 0x41, 0x96, 0x4e, 0x2d, 0x56, 0x79, 0x88, 0x22, 0xaa, 0x55, 
-    0x84, 0x06, 0xae, 0x0a, 0x24, 0xa0, 0x75, 0x12, 0xd7, 0x8b, 0x66, 0x50, 0x0e, 
-    0x50, 0x08, 0x24, 0xa6, 0x80, 0x9a, 0x55, 0x1f, 0x4e, 0xed, 0xca, 0xb6, 0xed, 
-    0xd2, 0x26, 0x56, 0xcf, 0x6a, 0x95, 0x7b, 0xf5, 0xab, 0xdb, 0xbb, 0x1f, 0x35, 
-    0x4c, 0x2a, 0x10, 0x00, 0xaf, 0xdf, 0x8b, 0x35, 0xfe, 0x46, 0xb5, 0x22, 0x70, 
-    0xc6, 0xd5, 0x1d, 0x57, 0x6f, 0xa0, 0x2c, 0x6b, 0x71, 0x81, 0xe0, 0xa5, 0x0a, 
-    0x1e, 0x23, 0x45, 0x30, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 
-    0xd8, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x00, 
-    0x00, 0x00, 0x0b, 0x0b, 0x0c, 0x0c, 0x0b, 0x04, 0x0e, 0x0e, 0x12, 0x14, 0x14, 
-    0x14, 0x17, 0x17, 0x1a, 0x19, 0x16, 0x05, 0x1c, 0x1b, 0x1c, 0x1d, 0x1c, 0x23, 
-    0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 0x25, 0x1f, 0x06, 0x29, 
-    0x24, 0x08, 0x2b, 0x2b, 0x2c, 0x2f, 0x2d, 0x38, 0x33, 0x33, 0x33, 0x35, 0x31, 
-    0x0e, 0x35, 0x33, 0x3b, 0x3a, 0x39, 0x43, 0x3b, 0x3b, 0x3c, 0x44, 0x43, 0x44, 
-    0x45, 0x3d, 0x14, 0x4b, 0x49, 0x57, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x60, 0x50, 
-    0x3c, 0x47, 0x51, 0x49, 0x10, 0x53, 0x53, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x49, 
-    0x50, 0x56, 0x56, 0x6c, 0x58, 0x56, 0x61, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 
-    0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 0x63, 0x63, 0x63, 0x65, 
-    0x65, 0x7a, 0x66, 0x64, 0x6b, 0x6a, 0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6c, 0x26, 
-    0x27, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x72, 0x6e, 0x6e, 0x81, 0x6f, 0x5e, 0x1b, 
-    0x70, 0x6e, 0x7b, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 0x73, 0x73, 0x74, 0x74, 
-    0x69, 0x17, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x76, 0x88, 0x7a, 0x49, 
-    0x4a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8c, 0x7c, 0x28, 0x29, 0x7f, 0x7f, 0x90, 
-    0x82, 0x4d, 0x4d, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x85, 
-    0x84, 0x8d, 0x87, 0x58, 0x58, 0x8a, 0x2e, 0x2e, 0x8a, 0x6e, 0x11, 0x8a, 0x89, 
-    0x95, 0x8b, 0x2f, 0x30, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x9b, 0x8e, 0x30, 0x31, 
-    0x8f, 0x63, 0x63, 0x90, 0x7f, 0x87, 0x91, 0x91, 0x9e, 0x92, 0x67, 0x68, 0x93, 
-    0x32, 0x32, 0x93, 0x86, 0x1d, 0x94, 0x76, 0x29, 0x94, 0x94, 0x94, 0x94, 0x94, 
-    0xa2, 0x96, 0x8d, 0x4e, 0x97, 0x75, 0x0b, 0x99, 0x78, 0x16, 0x9a, 0x7d, 0x35, 
-    0x9a, 0x9a, 0xa5, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 0x7b, 0x24, 0x9b, 
-    0x7c, 0x2c, 0x9b, 0x9b, 0x9c, 0x9c, 0x7c, 0x1b, 0x9d, 0x7b, 0x0e, 0x9d, 0x82, 
-    0x84, 0x9d, 0x91, 0x23, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x3a, 0x9e, 0x82, 0x34, 
-    0x9f, 0x80, 0x27, 0xa0, 0x37, 0x37, 0xa0, 0x7f, 0x12, 0xa2, 0x83, 0x1b, 0xa2, 
-    0x85, 0x3c, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xae, 0xa3, 0xa3, 0xa4, 0xa4, 0x84, 
-    0x13, 0xa4, 0x85, 0x27, 0xa4, 0x89, 0x45, 0xa5, 0x89, 0x3c, 0xa6, 0x8c, 0x4c, 
-    0xa6, 0xa6, 0xb2, 0xa8, 0x9a, 0x22, 0xab, 0x8b, 0x14, 0xab, 0x8c, 0x19, 0xab, 
-    0x92, 0x55, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xac, 0x92, 0x4e, 0xad, 0x95, 
-    0x5b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x18, 0xaf, 0x90, 0x90, 0xaf, 0x98, 0x5d, 
-    0xb2, 0x9a, 0x5b, 0xb3, 0x94, 0x16, 0xb3, 0x9c, 0x66, 0xb3, 0xb3, 0xb3, 0xb4, 
-    0x95, 0x19, 0xb4, 0xb4, 0xbd, 0xb7, 0xa1, 0x6b, 0xb7, 0xa9, 0x25, 0xb8, 0x9a, 
-    0x17, 0xb9, 0x9d, 0x2c, 0xb9, 0xa9, 0x25, 0xba, 0x9d, 0x1a, 0xba, 0xa3, 0xa4, 
-    0xba, 0xa5, 0x75, 0xba, 0xb9, 0xc3, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 0xbd, 
-    0xa9, 0x7a, 0xbe, 0xa2, 0x1b, 0xc1, 0xae, 0x82, 0xc2, 0xa5, 0x1c, 0xc3, 0xad, 
-    0xad, 0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xcb, 0xc4, 0xb3, 0x89, 0xc5, 0xa9, 0x1d, 
-    0xc8, 0xb8, 0x92, 0xc9, 0xad, 0x1e, 0xc9, 0xaf, 0x32, 0xc9, 0xb6, 0x7c, 0xca, 
-    0xb8, 0xb9, 0xcb, 0xb6, 0x4c, 0xcc, 0xb1, 0x1f, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 
-    0xd2, 0xcd, 0xb2, 0x21, 0xcd, 0xb9, 0x2b, 0xcf, 0xc0, 0x9e, 0xd1, 0xb8, 0x23, 
-    0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd7, 
-    0xcb, 0xaf, 0xd8, 0xbf, 0x24, 0xda, 0xc6, 0x2a, 0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 
-    0x25, 0xde, 0xde, 0xe2, 0xdf, 0xcc, 0x50, 0xe1, 0xc9, 0x27, 0xe3, 0xd9, 0xd9, 
-    0xe3, 0xe3, 0xe4, 0xe4, 0xcc, 0x29, 0xe5, 0xd1, 0x2c, 0xe5, 0xe5, 0xe9, 0xe6, 
-    0xde, 0xcc, 0xe8, 0xd4, 0x33, 0xe8, 0xd9, 0x7a, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 
-    0x2c, 0xeb, 0xeb, 0xec, 0xec, 0xe7, 0xda, 0xee, 0xd9, 0x2d, 0xee, 0xee, 0xf1, 
-    0xf2, 0xdc, 0x2e, 0xf2, 0xe8, 0x9d, 0xf2, 0xed, 0xe8, 0xf3, 0xde, 0x31, 0xf4, 
-    0xf3, 0xf4, 0xf5, 0xe0, 0x2f, 0xf5, 0xf3, 0xec, 0xf6, 0xe1, 0x31, 0xf7, 0xf7, 
-    0xf8, 0xf9, 0xf7, 0xf5, 0xfa, 0xe5, 0x32, 0xfb, 0xe7, 0x39, 0xfc, 0xec, 0x69, 
-    0xfe, 0xee, 0x59, 0xff, 0xeb, 0x34, 0xff, 0xec, 0x3c, 0xff, 0xec, 0x43, 0xff, 
-    0xed, 0x4c, 0xff, 0xf0, 0x59, 0xff, 0xf0, 0x6a, 0xff, 0xf2, 0x73, 0xff, 0xf2, 
-    0x7a, 0xff, 0xf3, 0x86, 0xff, 0xf5, 0x97, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0xff, 0x00, 0xb1, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 
-    0x2a, 0x54, 0xc8, 0x4c, 0xd8, 0xc2, 0x87, 0x0b, 0x61, 0x61, 0x7b, 0x76, 0x6b, 
-    0xe0, 0x21, 0x88, 0x18, 0x5f, 0xf5, 0x52, 0xf6, 0x4c, 0x17, 0x31, 0x5a, 0xd8, 
-    0x34, 0xdd, 0x82, 0x86, 0xb1, 0xa4, 0xaa, 0x66, 0xcd, 0x74, 0xf5, 0x22, 0xc5, 
-    0xb1, 0x64, 0xc9, 0x3d, 0xca, 0x50, 0x2a, 0x53, 0x46, 0x4c, 0xd5, 0x1b, 0x97, 
-    0x10, 0x35, 0xa1, 0xdc, 0x69, 0xac, 0x99, 0xb2, 0x59, 0x38, 0x15, 0x6a, 0xea, 
-    0xb5, 0x13, 0x65, 0x32, 0x5a, 0xca, 0x82, 0x1a, 0xbc, 0x04, 0x6b, 0xd5, 0xad, 
-    0x5b, 0xc4, 0x56, 0xf5, 0xea, 0xb9, 0x13, 0xa8, 0xd2, 0x81, 0x27, 0x9b, 0x35, 
-    0x15, 0xd6, 0xac, 0xd7, 0x2d, 0x58, 0x32, 0x89, 0x25, 0xbd, 0x8a, 0x0d, 0x52, 
-    0xcc, 0x66, 0xc2, 0x92, 0xed, 0x3c, 0xdb, 0x15, 0x1b, 0x1e, 0xb2, 0xd8, 0x4c, 
-    0x15, 0x9d, 0x8b, 0xd2, 0xd8, 0xac, 0x57, 0x70, 0xb1, 0x91, 0xa2, 0xab, 0x8b, 
-    0x16, 0xad, 0xaf, 0x6f, 0xf3, 0x6a, 0xd2, 0xa5, 0xb6, 0xee, 0x2a, 0xae, 0x28, 
-    0x67, 0x41, 0xca, 0xfb, 0x03, 0x13, 0xae, 0x54, 0xb7, 0x1e, 0xf3, 0x4a, 0x85, 
-    0xab, 0x32, 0xae, 0x57, 0x5d, 0x57, 0x5d, 0x0c, 0xaa, 0x66, 0xd7, 0xb5, 0xcf, 
-    0xa0, 0x43, 0x7f, 0x2e, 0x45, 0x43, 0x17, 0xda, 0xcd, 0x25, 0xef, 0x0c, 0x13, 
-    0xcd, 0xfa, 0x73, 0x0b, 0x00, 0x11, 0x56, 0x35, 0x23, 0xe5, 0x52, 0x8a, 0xaf, 
-    0xd6, 0xac, 0x65, 0x01, 0xd8, 0xcd, 0x40, 0x15, 0x6a, 0x88, 0xa5, 0x70, 0xb3, 
-    0x76, 0xb4, 0x9b, 0xf7, 0xa5, 0x92, 0x3f, 0x56, 0x0b, 0x0f, 0xcd, 0xa5, 0xf8, 
-    0xee, 0x17, 0xb4, 0x21, 0xc6, 0x59, 0x2e, 0x3a, 0x87, 0xf3, 0xdd, 0x85, 0x54, 
-    0x41, 0x6c, 0x44, 0x3d, 0xb4, 0x88, 0xeb, 0xb0, 0x41, 0x3e, 0xff, 0xfc, 0x04, 
-    0x7a, 0x97, 0xab, 0xe5, 0x14, 0xc0, 0x03, 0x90, 0x03, 0xf1, 0xd4, 0x68, 0x59, 
-    0x95, 0x58, 0x1d, 0xc3, 0xed, 0x40, 0x7d, 0x04, 0x88, 0xbe, 0x5c, 0x39, 0xba, 
-    0x7d, 0xad, 0xd6, 0x27, 0x4a, 0x95, 0x7c, 0xe2, 0x1e, 0x68, 0xf5, 0xa9, 0xa7, 
-    0xc0, 0x42, 0x83, 0x94, 0x72, 0xca, 0x7c, 0xab, 0xc9, 0xe2, 0xd9, 0x2e, 0xbe, 
-    0x1c, 0xc3, 0xdf, 0x35, 0xe9, 0xa9, 0x87, 0x80, 0x42, 0x57, 0x44, 0x28, 0xcb, 
-    0x35, 0x9f, 0xb0, 0x70, 0xcd, 0x11, 0x33, 0x7c, 0xe6, 0x60, 0x68, 0x1d, 0xa8, 
-    0x07, 0x40, 0x01, 0x09, 0x0d, 0x72, 0xdb, 0x79, 0xd7, 0x04, 0x82, 0xc1, 0x35, 
-    0x76, 0x10, 0xc0, 0x1f, 0x28, 0x9e, 0x7d, 0x66, 0x9d, 0x89, 0x07, 0xc5, 0xc1, 
-    0xca, 0x67, 0xb5, 0xb8, 0xe2, 0x99, 0x2b, 0x94, 0x5c, 0x33, 0x8c, 0x23, 0xf3, 
-    0x5d, 0x53, 0xca, 0x8e, 0x9f, 0x35, 0x87, 0x23, 0x41, 0x4c, 0x04, 0x17, 0xda, 
-    0x2e, 0x45, 0xb2, 0x16, 0xa1, 0x72, 0xd7, 0x10, 0xb7, 0xa4, 0x40, 0x77, 0x4c, 
-    0xd8, 0x5d, 0x6b, 0xae, 0x98, 0x08, 0xc0, 0x40, 0x83, 0x44, 0xb9, 0x65, 0x6b, 
-    0xc7, 0x54, 0xb0, 0xa4, 0x1a, 0x62, 0x8e, 0x19, 0x5a, 0x84, 0xd7, 0xac, 0xa1, 
-    0x1e, 0x01, 0x02, 0x21, 0xa9, 0xa6, 0x68, 0x9f, 0xc8, 0xe2, 0xca, 0x91, 0xea, 
-    0x1d, 0x80, 0x0d, 0x13, 0x73, 0xb2, 0x26, 0x1f, 0x68, 0xa5, 0xdc, 0xe8, 0x9c, 
-    0x03, 0xd8, 0x70, 0x17, 0x5a, 0x29, 0x5c, 0xf8, 0x90, 0xc3, 0x1a, 0x54, 0xe2, 
-    0x06, 0xca, 0x93, 0x77, 0x04, 0xe0, 0xdc, 0x81, 0xd8, 0x3c, 0x0a, 0x9a, 0x1d, 
-    0xd7, 0x05, 0xb2, 0xdc, 0x29, 0x5a, 0x5e, 0x23, 0x45, 0x85, 0x00, 0x5c, 0x28, 
-    0x90, 0xa5, 0x9f, 0x99, 0xe9, 0x9c, 0x23, 0xc2, 0x1d, 0x33, 0x20, 0x68, 0xc7, 
-    0xa8, 0x80, 0x0d, 0x04, 0x04, 0x50, 0xa0, 0x3a, 0x6a, 0x68, 0x94, 0x88, 0x50, 
-    0xc1, 0x0c, 0x5c, 0x38, 0x89, 0xdb, 0x31, 0x72, 0x7e, 0x36, 0x4c, 0x42, 0xa4, 
-    0xf6, 0xe9, 0xcb, 0x27, 0x8d, 0x1e, 0xa3, 0x03, 0x42, 0x77, 0xf4, 0xf9, 0x99, 
-    0x2b, 0x6a, 0x60, 0xf3, 0xc3, 0x86, 0x9f, 0xed, 0x92, 0x45, 0x0f, 0x08, 0xd5, 
-    0x32, 0xe7, 0x31, 0x94, 0x10, 0xc4, 0xc8, 0x35, 0xb1, 0xf0, 0x91, 0x84, 0x11, 
-    0x40, 0x20, 0x9b, 0xa6, 0x70, 0xc3, 0xdc, 0x51, 0x50, 0x13, 0x5f, 0x18, 0x31, 
-    0x84, 0x10, 0x9c, 0x98, 0x8b, 0x50, 0x98, 0xdd, 0xb1, 0x12, 0x86, 0x41, 0xea, 
-    0x36, 0x81, 0xca, 0x7c, 0xbb, 0x28, 0x14, 0xc6, 0x82, 0xad, 0xf9, 0x52, 0x4a, 
-    0x1c, 0x08, 0x09, 0x11, 0x8b, 0x68, 0xd9, 0x2a, 0xa4, 0x83, 0x1e, 0x01, 0x82, 
-    0x52, 0x49, 0x23, 0x57, 0xdc, 0xa0, 0x90, 0xa1, 0xa1, 0xd5, 0x72, 0x41, 0x5e, 
-    0x06, 0xd5, 0x18, 0xda, 0x29, 0x0b, 0x50, 0x4c, 0x50, 0x25, 0xa0, 0x4d, 0x58, 
-    0x0a, 0x00, 0x13, 0x6b, 0x8c, 0x26, 0x68, 0x72, 0x76, 0x99, 0x31, 0xc5, 0x3f, 
-    0x58, 0x7c, 0xcd, 0xaa, 0xbe, 0x48, 0x5a, 0xc1, 0x40, 0x01, 0x01, 0x00, 0x21, 
-    0xf9, 0x04, 0x09, 0x03, 0x00, 0x8e, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 
-    0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 
-    0x1d, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3d, 
-    0x3c, 0x44, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x42, 0x45, 0x3b, 0x21, 0x48, 0x46, 
-    0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x55, 0x54, 0x5c, 
-    0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 
-    0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 0x62, 0x61, 0x6e, 0x62, 0x61, 
-    0x76, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 0x6a, 0x7d, 0x6b, 0x6a, 0x74, 
-    0x6b, 0x6b, 0x6c, 0x6e, 0x4c, 0x51, 0x6e, 0x67, 0x69, 0x6e, 0x6e, 0x81, 0x70, 
-    0x2f, 0x2f, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 
-    0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 
-    0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 0x4b, 0x82, 0x4e, 0x4e, 0x83, 
-    0x52, 0x53, 0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x83, 0x8f, 0x88, 0x56, 
-    0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 0x8a, 0x5c, 0x5c, 
-    0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x6f, 0x1f, 0x90, 0x90, 0x9e, 0x93, 
-    0x69, 0x69, 0x94, 0x94, 0xa2, 0x95, 0x74, 0x1b, 0x95, 0x75, 0x26, 0x96, 0x76, 
-    0x2b, 0x98, 0x77, 0x1d, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 0x9a, 0x7a, 0x24, 
-    0x9b, 0x7c, 0x2c, 0x9b, 0x7d, 0x33, 0x9c, 0x7b, 0x1b, 0x9d, 0x7f, 0x39, 0x9d, 
-    0x9d, 0xaa, 0x9e, 0x80, 0x2c, 0x9e, 0x81, 0x35, 0xa0, 0x80, 0x1c, 0xa0, 0x81, 
-    0x23, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 0xa2, 0x83, 0x2b, 0xa2, 0x85, 0x3c, 
-    0xa2, 0x86, 0x42, 0xa4, 0x84, 0x15, 0xa4, 0x87, 0x39, 0xa4, 0x89, 0x45, 0xa5, 
-    0x88, 0x2f, 0xa5, 0x8a, 0x3e, 0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa6, 0x8b, 
-    0x4b, 0xa8, 0x8a, 0x2c, 0xa8, 0x8e, 0x4e, 0xa9, 0x8f, 0x52, 0xab, 0x90, 0x49, 
-    0xab, 0x91, 0x55, 0xad, 0x95, 0x5b, 0xad, 0xad, 0xb8, 0xb0, 0x96, 0x57, 0xb2, 
-    0x9b, 0x5c, 0xb2, 0x9b, 0x64, 0xb3, 0x99, 0x4a, 0xb4, 0x9e, 0x6a, 0xb4, 0xb4, 
-    0xbe, 0xb6, 0x9b, 0x34, 0xb6, 0xa0, 0x6b, 0xb8, 0xa2, 0x69, 0xb9, 0x9e, 0x2e, 
-    0xba, 0xa5, 0x74, 0xbc, 0xa8, 0x77, 0xbd, 0xaa, 0x7b, 0xc1, 0xaa, 0x4b, 0xc1, 
-    0xae, 0x83, 0xc2, 0xa9, 0x3f, 0xc3, 0xb2, 0x85, 0xc6, 0xb4, 0x8a, 0xc9, 0xb6, 
-    0x7c, 0xca, 0xb3, 0x50, 0xcc, 0xb2, 0x2e, 0xcf, 0xc1, 0x9d, 0xd1, 0xbb, 0x52, 
-    0xd5, 0xc8, 0xa9, 0xd6, 0xbd, 0x34, 0xe4, 0xd4, 0x73, 0xea, 0xdc, 0x7e, 0xf5, 
-    0xe5, 0x5e, 0xf5, 0xe7, 0x78, 0xff, 0xeb, 0x3d, 0xff, 0xec, 0x43, 0xff, 0xed, 
-    0x4d, 0xff, 0xee, 0x54, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x61, 0xff, 0xf0, 0x52, 
-    0xff, 0xf0, 0x5f, 0xff, 0xf0, 0x64, 0xff, 0xf0, 0x6b, 0xff, 0xf2, 0x73, 0xff, 
-    0xf2, 0x7a, 0xff, 0xf3, 0x82, 0xff, 0xf4, 0x8d, 0xff, 0xf4, 0x9a, 0xff, 0xf5, 
-    0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9d, 0x00, 0x1d, 0x09, 0x1c, 0x48, 0xb0, 
-    0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x81, 0x67, 
-    0x1e, 0x3a, 0xf4, 0x73, 0x10, 0x90, 0xc4, 0x86, 0x79, 0x2e, 0x6a, 0x4c, 0x98, 
-    0x47, 0xcb, 0xc6, 0x8f, 0x20, 0x1f, 0xf2, 0x09, 0x49, 0xb2, 0xa4, 0xc9, 0x8d, 
-    0x5d, 0x42, 0x66, 0x64, 0x78, 0xe7, 0x64, 0xc2, 0x94, 0x24, 0xeb, 0xb8, 0x5c, 
-    0xa8, 0x07, 0x8f, 0x23, 0x3d, 0x04, 0xf5, 0xe8, 0xd9, 0x43, 0x30, 0xa2, 0xc6, 
-    0x26, 0x1a, 0x7d, 0xce, 0x1c, 0x2a, 0x51, 0x0d, 0xd1, 0x83, 0x70, 0x8e, 0x86, 
-    0xbc, 0x42, 0x72, 0xa5, 0xd2, 0xa7, 0x50, 0x09, 0x16, 0x88, 0x2a, 0x70, 0xea, 
-    0x46, 0x33, 0x26, 0x07, 0x28, 0x0c, 0x42, 0x75, 0x23, 0x0a, 0x89, 0x4c, 0xbb, 
-    0x8a, 0x1d, 0x7b, 0x14, 0xe8, 0x53, 0x01, 0x63, 0x75, 0x44, 0xb5, 0x4a, 0xf6, 
-    0x28, 0x01, 0xa5, 0x20, 0x1c, 0x19, 0x08, 0xd0, 0xb6, 0xae, 0xdd, 0xbb, 0x0b, 
-    0x45, 0x60, 0x11, 0x28, 0x23, 0xea, 0x8e, 0xa8, 0x36, 0xf0, 0x32, 0xc0, 0x7b, 
-    0x74, 0x01, 0x61, 0xa2, 0x08, 0x06, 0x06, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 
-    0x03, 0x00, 0xd9, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 
-    0x87, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x04, 0x0c, 0x0b, 0x0c, 0x0e, 0x0e, 0x12, 
-    0x14, 0x14, 0x14, 0x17, 0x16, 0x1a, 0x19, 0x16, 0x05, 0x1c, 0x1c, 0x1c, 0x1c, 
-    0x1c, 0x22, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 0x27, 0x1f, 
-    0x05, 0x29, 0x24, 0x08, 0x2b, 0x2b, 0x2c, 0x2f, 0x2d, 0x3a, 0x33, 0x33, 0x33, 
-    0x34, 0x33, 0x3c, 0x3a, 0x35, 0x0b, 0x3b, 0x3a, 0x42, 0x3b, 0x3b, 0x3b, 0x43, 
-    0x43, 0x44, 0x44, 0x3d, 0x0d, 0x45, 0x3b, 0x21, 0x4b, 0x49, 0x57, 0x4c, 0x4c, 
-    0x4d, 0x50, 0x3c, 0x47, 0x50, 0x4f, 0x61, 0x54, 0x4c, 0x11, 0x54, 0x54, 0x54, 
-    0x55, 0x55, 0x5b, 0x56, 0x56, 0x6c, 0x58, 0x56, 0x61, 0x59, 0x59, 0x6f, 0x5b, 
-    0x5b, 0x5b, 0x5c, 0x42, 0x4e, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 
-    0x76, 0x63, 0x63, 0x64, 0x65, 0x65, 0x7a, 0x66, 0x64, 0x6b, 0x68, 0x5c, 0x13, 
-    0x6a, 0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6c, 0x26, 0x27, 0x6c, 0x6c, 0x6c, 0x6d, 
-    0x6d, 0x72, 0x6e, 0x6e, 0x81, 0x72, 0x5e, 0x2d, 0x72, 0x72, 0x85, 0x73, 0x2d, 
-    0x2d, 0x73, 0x73, 0x74, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 0x76, 0x88, 
-    0x78, 0x6d, 0x18, 0x7a, 0x49, 0x4a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x8c, 0x7c, 
-    0x28, 0x29, 0x7d, 0x7c, 0x83, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 0x83, 0x83, 
-    0x84, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x83, 0x8f, 0x85, 0x7a, 0x1b, 
-    0x87, 0x58, 0x58, 0x8a, 0x2e, 0x2e, 0x8a, 0x66, 0x0c, 0x8a, 0x89, 0x95, 0x8b, 
-    0x2f, 0x30, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8e, 0x30, 0x31, 0x90, 0x7f, 
-    0x87, 0x90, 0x90, 0x9e, 0x91, 0x66, 0x66, 0x92, 0x85, 0x1d, 0x93, 0x32, 0x32, 
-    0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0x95, 0x76, 0x29, 0x96, 0x75, 0x1a, 0x97, 
-    0x74, 0x0b, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 
-    0x2b, 0x9b, 0x7d, 0x34, 0x9b, 0x9b, 0xa5, 0x9b, 0x9c, 0x9c, 0x9c, 0x7c, 0x14, 
-    0x9c, 0x7c, 0x1b, 0x9d, 0x7c, 0x0e, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 
-    0x81, 0x37, 0x9e, 0x8a, 0x25, 0xa0, 0x37, 0x37, 0xa1, 0x84, 0x3d, 0xa2, 0x83, 
-    0x1a, 0xa2, 0x86, 0x42, 0xa2, 0xa2, 0xad, 0xa4, 0x83, 0x13, 0xa4, 0x86, 0x26, 
-    0xa4, 0x87, 0x38, 0xa4, 0x89, 0x45, 0xa4, 0xa3, 0xa4, 0xa6, 0x8c, 0x4c, 0xa6, 
-    0x98, 0x22, 0xa6, 0xa6, 0xb2, 0xa8, 0x87, 0x12, 0xa8, 0x8e, 0x4d, 0xa9, 0x8f, 
-    0x51, 0xab, 0x8b, 0x14, 0xab, 0x8c, 0x19, 0xab, 0x92, 0x55, 0xab, 0xab, 0xab, 
-    0xab, 0xab, 0xb6, 0xad, 0x95, 0x5b, 0xae, 0xae, 0xb9, 0xaf, 0x90, 0x16, 0xaf, 
-    0x90, 0x90, 0xaf, 0x9c, 0x4e, 0xb0, 0x96, 0x4e, 0xb2, 0x93, 0x16, 0xb3, 0x94, 
-    0x19, 0xb3, 0x9d, 0x66, 0xb4, 0x98, 0x32, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbd, 
-    0xb6, 0xa6, 0x25, 0xb7, 0x99, 0x18, 0xb7, 0xa1, 0x6d, 0xba, 0x9d, 0x19, 0xba, 
-    0xa3, 0xa4, 0xba, 0xa7, 0x2b, 0xbb, 0xa5, 0x60, 0xbb, 0xa7, 0x78, 0xbb, 0xbb, 
-    0xc4, 0xbc, 0xbc, 0xbc, 0xbe, 0xa2, 0x1b, 0xbe, 0xaa, 0x80, 0xc1, 0xae, 0x82, 
-    0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 0xa9, 0x2c, 0xc4, 0xc4, 0xcb, 0xc5, 
-    0xb2, 0x7a, 0xc6, 0xaa, 0x1d, 0xc6, 0xb4, 0x88, 0xc8, 0xad, 0x1e, 0xc8, 0xb8, 
-    0x92, 0xc9, 0xb5, 0x4e, 0xc9, 0xb6, 0xb7, 0xc9, 0xb8, 0x28, 0xcc, 0xb1, 0x1e, 
-    0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x21, 0xd0, 0xb5, 0x1f, 0xd2, 
-    0xb8, 0x23, 0xd2, 0xc3, 0x94, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xc8, 
-    0xab, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd8, 0xbf, 0x24, 0xdb, 0xc7, 0x2b, 
-    0xdb, 0xdb, 0xdd, 0xdc, 0xc3, 0x26, 0xde, 0xde, 0xe2, 0xe1, 0xc8, 0x27, 0xe3, 
-    0xd9, 0xd9, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 0x29, 0xe4, 0xcf, 0x38, 0xe4, 0xdc, 
-    0xc9, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2d, 0xe8, 0xd7, 0x5d, 0xea, 0xe4, 0xe4, 
-    0xeb, 0xd4, 0x2c, 0xeb, 0xd8, 0x32, 0xeb, 0xe5, 0xd7, 0xeb, 0xeb, 0xec, 0xec, 
-    0xdf, 0x8a, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xed, 0xe6, 0xf2, 0xdd, 
-    0x2f, 0xf3, 0xdf, 0x30, 0xf4, 0xf4, 0xf5, 0xf6, 0xe0, 0x2e, 0xf6, 0xe1, 0x31, 
-    0xf6, 0xe8, 0x78, 0xf6, 0xf3, 0xed, 0xf7, 0xf7, 0xf8, 0xf9, 0xf6, 0xf4, 0xfa, 
-    0xe5, 0x32, 0xfa, 0xf8, 0xf5, 0xfd, 0xed, 0x63, 0xfe, 0xf5, 0x9b, 0xff, 0xeb, 
-    0x34, 0xff, 0xec, 0x3a, 0xff, 0xec, 0x43, 0xff, 0xed, 0x4b, 0xff, 0xee, 0x58, 
-    0xff, 0xf0, 0x5a, 0xff, 0xf1, 0x67, 0xff, 0xf2, 0x7a, 0xff, 0xf3, 0x84, 0xff, 
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0xff, 0x00, 0xb3, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 
-    0xd9, 0x38, 0x21, 0x5c, 0xc8, 0x70, 0x21, 0xb4, 0x44, 0x0d, 0x23, 0x32, 0xa4, 
-    0x55, 0x49, 0xda, 0x32, 0x82, 0x8c, 0x24, 0x6a, 0xdc, 0xb5, 0x2c, 0xda, 0x30, 
-    0x8e, 0xd9, 0x16, 0xd1, 0x32, 0xa6, 0xb1, 0xa4, 0xa6, 0x65, 0xcf, 0x38, 0x56, 
-    0x32, 0xf6, 0xac, 0xa4, 0x4b, 0x61, 0xcf, 0x62, 0x2e, 0x5b, 0x46, 0x6b, 0x8e, 
-    0x4b, 0x89, 0x89, 0x50, 0xc6, 0x7c, 0x66, 0x6c, 0xe6, 0xad, 0x9b, 0x0b, 0xd9, 
-    0x7c, 0xda, 0xb5, 0x53, 0xa6, 0xae, 0x65, 0xd2, 0x58, 0x01, 0x25, 0x28, 0x6a, 
-    0xd6, 0x2c, 0x5d, 0xb0, 0x96, 0x9d, 0x02, 0x36, 0xac, 0x28, 0xad, 0xa5, 0x04, 
-    0x5d, 0xc5, 0x9c, 0x05, 0x8b, 0xe5, 0x30, 0xa8, 0x3b, 0x91, 0x62, 0x15, 0x98, 
-    0x53, 0xa6, 0xce, 0x67, 0x67, 0x77, 0x65, 0x1b, 0x34, 0x36, 0xdb, 0xa9, 0xa2, 
-    0x70, 0x65, 0xd2, 0x52, 0xda, 0x76, 0x54, 0x5c, 0x5d, 0xb7, 0x6e, 0xe9, 0xa2, 
-    0x05, 0x28, 0x1b, 0x5d, 0xac, 0xa2, 0xa8, 0xee, 0x1c, 0xe6, 0xaa, 0x6a, 0x4c, 
-    0x5a, 0x90, 0xda, 0x66, 0xf3, 0xb1, 0x09, 0x17, 0x2a, 0x5f, 0xbe, 0x6a, 0x05, 
-    0x7b, 0x8c, 0x0b, 0x97, 0x2f, 0x56, 0x29, 0x59, 0xb1, 0x05, 0x9a, 0xa6, 0x17, 
-    0xb6, 0xcf, 0xa0, 0x43, 0x7f, 0x36, 0x85, 0x83, 0xe8, 0xb0, 0xcd, 0x25, 0xf3, 
-    0x10, 0x13, 0xcd, 0xfa, 0xf3, 0x0b, 0x00, 0x12, 0x30, 0x8f, 0x72, 0x39, 0xe5, 
-    0x57, 0x6b, 0xd6, 0xb2, 0x00, 0xe8, 0x66, 0xb0, 0x0a, 0x62, 0x49, 0x53, 0xb7, 
-    0x59, 0x3f, 0xd2, 0xbd, 0xbb, 0x52, 0xc9, 0x20, 0xab, 0x83, 0x87, 0xee, 0x42, 
-    0x5c, 0xb7, 0x0a, 0x52, 0x1a, 0xe3, 0x28, 0x17, 0xad, 0xa3, 0xb9, 0x6e, 0x43, 
-    0xab, 0x24, 0x3a, 0x9a, 0x1e, 0x5a, 0x84, 0x75, 0xd8, 0x57, 0x23, 0x82, 0xff, 
-    0x02, 0xdd, 0xeb, 0x95, 0x72, 0x0a, 0xdf, 0x01, 0xc0, 0x91, 0x98, 0x6a, 0xb4, 
-    0x2c, 0x4b, 0xad, 0x92, 0xdd, 0x76, 0x90, 0xbe, 0x81, 0xc4, 0x5f, 0xaf, 0x1e, 
-    0xd9, 0xc6, 0x66, 0x0b, 0x14, 0x25, 0x4b, 0xa0, 0xb4, 0x07, 0x1a, 0x7d, 0xe9, 
-    0x29, 0xd0, 0x50, 0x21, 0xa6, 0xa4, 0x22, 0xdf, 0x6a, 0xb2, 0x78, 0xd6, 0xcb, 
-    0x2f, 0xc9, 0xec, 0x87, 0x0d, 0x7a, 0xe9, 0x21, 0xc0, 0x50, 0x6d, 0xc9, 0xc8, 
-    0x82, 0x0d, 0x28, 0x2e, 0x60, 0xa3, 0x04, 0x0d, 0x9f, 0x35, 0x18, 0x9a, 0x07, 
-    0xe9, 0x01, 0x50, 0xc0, 0x42, 0x85, 0xd8, 0x66, 0x1e, 0x36, 0x84, 0x64, 0x80, 
-    0x0d, 0x1e, 0x04, 0xec, 0x17, 0x8a, 0x67, 0x9f, 0x55, 0x57, 0xe2, 0x41, 0x71, 
-    0xac, 0x68, 0xcb, 0x2b, 0x9e, 0xbd, 0x62, 0x09, 0x36, 0xc4, 0x3c, 0x22, 0x1f, 
-    0x36, 0xa6, 0xb4, 0x02, 0x1a, 0x73, 0x37, 0x12, 0xe4, 0x04, 0x70, 0xa1, 0xf5, 
-    0x32, 0x24, 0x6b, 0x10, 0x26, 0x87, 0xcd, 0x70, 0x49, 0x0a, 0x94, 0x87, 0x84, 
-    0xdc, 0xb5, 0xf6, 0x4a, 0x89, 0x00, 0x0c, 0x54, 0xc8, 0x93, 0x59, 0xb6, 0x96, 
-    0x4c, 0x05, 0x49, 0xa6, 0x01, 0x66, 0x98, 0xa1, 0x0d, 0xe9, 0x46, 0x7a, 0x04, 
-    0x08, 0x64, 0x24, 0x9a, 0xac, 0x81, 0xd2, 0x4a, 0x2a, 0xa9, 0x6c, 0xf9, 0xdd, 
-    0x89, 0x4e, 0xc0, 0xc9, 0x5a, 0x7c, 0x9f, 0x25, 0x63, 0x4a, 0x0f, 0xdf, 0x39, 
-    0x90, 0xcd, 0x76, 0xa1, 0x99, 0xd2, 0x45, 0x0f, 0x3a, 0x74, 0x21, 0xe5, 0x6d, 
-    0x4c, 0x7e, 0x66, 0x4b, 0x1e, 0x01, 0x34, 0x67, 0x60, 0x36, 0xa1, 0x84, 0x86, 
-    0x87, 0x75, 0x84, 0x28, 0x97, 0x0a, 0x8d, 0xa0, 0x4d, 0x41, 0x21, 0x00, 0x16, 
-    0x0a, 0x54, 0x29, 0x68, 0x64, 0x36, 0xf7, 0x48, 0x70, 0xc9, 0x08, 0x08, 0x5a, 
-    0x32, 0x2c, 0x64, 0x03, 0x01, 0x01, 0x93, 0x8a, 0xa0, 0x1a, 0x1a, 0x25, 0x22, 
-    0x54, 0x40, 0x43, 0x17, 0x8d, 0x8a, 0xf9, 0x26, 0x68, 0xc4, 0x2c, 0x34, 0xaa, 
-    0x9e, 0xd8, 0xfc, 0x02, 0xca, 0xa2, 0xc9, 0xec, 0x80, 0xd0, 0x1e, 0xc0, 0x62, 
-    0xf3, 0x4a, 0x1a, 0xd9, 0x04, 0xa1, 0xe1, 0x67, 0xbd, 0x60, 0xf1, 0x03, 0x42, 
-    0xb6, 0xc0, 0x99, 0x0c, 0x25, 0x04, 0x6d, 0x17, 0x4b, 0x1f, 0x4c, 0x24, 0x21, 
-    0x04, 0x42, 0x79, 0x9c, 0x19, 0x1c, 0x31, 0x79, 0x14, 0xf4, 0x44, 0x18, 0xdd, 
-    0x16, 0xd1, 0x49, 0xb9, 0x08, 0x7d, 0xc9, 0x5d, 0x2b, 0x5c, 0x18, 0x94, 0x84, 
-    0x11, 0x58, 0xa8, 0x22, 0x5f, 0x2f, 0x0c, 0x89, 0xa1, 0x60, 0x6b, 0xbf, 0x98, 
-    0x12, 0x07, 0x42, 0x45, 0xc4, 0x22, 0x1a, 0xb6, 0x0c, 0xed, 0xb0, 0x07, 0x80, 
-    0xa1, 0x58, 0xe2, 0xc8, 0x14, 0x37, 0x30, 0x44, 0x68, 0x68, 0xb6, 0x60, 0xa0, 
-    0x98, 0x41, 0x9c, 0x82, 0x96, 0xca, 0x02, 0x13, 0x13, 0xf4, 0xe3, 0x67, 0x12, 
-    0x9a, 0x02, 0x40, 0x06, 0x19, 0x67, 0x63, 0x26, 0x68, 0xbb, 0x6e, 0x89, 0xf1, 
-    0xc4, 0x41, 0x54, 0xac, 0xea, 0x2f, 0x02, 0x00, 0x50, 0xc1, 0x40, 0x01, 0x01, 
-    0x00, 0x21, 0xf9, 0x04, 0x09, 0x03, 0x00, 0x93, 0x00, 0x2c, 0x04, 0x00, 0x04, 
-    0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x12, 0x17, 
-    0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x2b, 0x2b, 0x2b, 0x32, 0x32, 
-    0x33, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x42, 0x41, 0x3f, 0x4d, 0x42, 0x42, 0x42, 
-    0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 0x4f, 0x4e, 0x5b, 0x53, 
-    0x53, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 0x56, 0x6d, 0x59, 0x59, 
-    0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 0x41, 0x60, 0x5e, 0x6b, 
-    0x62, 0x61, 0x6e, 0x62, 0x61, 0x76, 0x64, 0x63, 0x65, 0x65, 0x65, 0x7a, 0x6a, 
-    0x69, 0x76, 0x6a, 0x6a, 0x7d, 0x6b, 0x6b, 0x6d, 0x6e, 0x4c, 0x51, 0x6e, 0x67, 
-    0x69, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 0x7b, 0x73, 0x73, 0x75, 0x73, 0x73, 0x85, 
-    0x76, 0x76, 0x89, 0x77, 0x36, 0x36, 0x77, 0x3d, 0x3d, 0x78, 0x77, 0x89, 0x78, 
-    0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 0x4a, 
-    0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 0x4e, 0x83, 0x52, 0x53, 0x83, 0x83, 0x94, 
-    0x84, 0x83, 0x8f, 0x88, 0x56, 0x56, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 
-    0x87, 0x91, 0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 
-    0x9e, 0x93, 0x69, 0x69, 0x94, 0x74, 0x1d, 0x94, 0x94, 0xa2, 0x95, 0x75, 0x24, 
-    0x97, 0x76, 0x17, 0x97, 0x77, 0x2a, 0x98, 0x77, 0x1c, 0x98, 0x98, 0xa6, 0x99, 
-    0x74, 0x73, 0x9b, 0x7b, 0x1b, 0x9b, 0x7b, 0x23, 0x9b, 0x7c, 0x2b, 0x9c, 0x7e, 
-    0x32, 0x9d, 0x7f, 0x39, 0x9d, 0x9d, 0xaa, 0x9e, 0x7d, 0x16, 0x9e, 0x80, 0x2c, 
-    0x9e, 0x81, 0x39, 0x9f, 0x80, 0x22, 0x9f, 0x82, 0x35, 0xa0, 0x80, 0x18, 0xa0, 
-    0x81, 0x23, 0xa0, 0x84, 0x3e, 0xa1, 0xa1, 0xad, 0xa2, 0x7f, 0x7e, 0xa2, 0x86, 
-    0x42, 0xa3, 0x84, 0x29, 0xa3, 0x84, 0x34, 0xa4, 0x89, 0x45, 0xa5, 0x89, 0x3c, 
-    0xa5, 0xa5, 0xb1, 0xa6, 0x83, 0x83, 0xa6, 0x8c, 0x4c, 0xa8, 0x89, 0x21, 0xa9, 
-    0x89, 0x15, 0xa9, 0x8e, 0x4d, 0xab, 0x8d, 0x2d, 0xab, 0x91, 0x54, 0xad, 0x93, 
-    0x47, 0xad, 0xad, 0xb8, 0xb0, 0x96, 0x49, 0xb2, 0x96, 0x39, 0xb3, 0x99, 0x4d, 
-    0xb3, 0x9b, 0x64, 0xb4, 0x98, 0x34, 0xb4, 0x9b, 0x5b, 0xb4, 0xb4, 0xbe, 0xb5, 
-    0x9e, 0x6a, 0xb6, 0x99, 0x2b, 0xb7, 0xa1, 0x6d, 0xb7, 0xa2, 0x71, 0xb9, 0xa4, 
-    0x73, 0xba, 0xa1, 0x4a, 0xbd, 0xa2, 0x2e, 0xbd, 0xa6, 0x52, 0xbe, 0xaa, 0x80, 
-    0xbe, 0xab, 0x7c, 0xbf, 0xa4, 0x37, 0xc0, 0xaa, 0x5b, 0xc0, 0xae, 0x82, 0xc1, 
-    0xa7, 0x3c, 0xc4, 0xb3, 0x83, 0xc6, 0xb4, 0x89, 0xc7, 0xb4, 0x79, 0xc8, 0xae, 
-    0x2b, 0xc8, 0xb8, 0x8f, 0xc9, 0xb8, 0x86, 0xcd, 0xb6, 0x4d, 0xd0, 0xc1, 0x94, 
-    0xda, 0xca, 0x80, 0xe4, 0xce, 0x3f, 0xe7, 0xd8, 0x76, 0xea, 0xd5, 0x45, 0xf4, 
-    0xe5, 0x76, 0xf5, 0xe4, 0x66, 0xf8, 0xea, 0x79, 0xff, 0xec, 0x44, 0xff, 0xed, 
-    0x3b, 0xff, 0xed, 0x4c, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5b, 0xff, 0xef, 0x61, 
-    0xff, 0xf0, 0x56, 0xff, 0xf0, 0x5b, 0xff, 0xf0, 0x63, 0xff, 0xf1, 0x6c, 0xff, 
-    0xf1, 0x71, 0xff, 0xf3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xaa, 0x00, 0x27, 0x09, 0x1c, 
-    0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x93, 0xfc, 0x20, 0x5c, 0xc8, 0x90, 0x21, 0x9c, 
-    0x86, 0x10, 0x1b, 0xde, 0x39, 0x14, 0xb1, 0xa2, 0xc1, 0x41, 0x06, 0x1f, 0x5a, 
-    0xb4, 0xb8, 0x87, 0xe0, 0x9d, 0x8d, 0x20, 0x0d, 0x06, 0xda, 0x12, 0xb2, 0xa1, 
-    0xc6, 0x92, 0x15, 0xb1, 0x20, 0xc4, 0x88, 0xb2, 0xa5, 0x4b, 0x88, 0x89, 0x5c, 
-    0xbe, 0xa9, 0x48, 0xe6, 0xa5, 0xcd, 0x9b, 0x35, 0x01, 0xdd, 0x74, 0xf8, 0x32, 
-    0xc6, 0x24, 0x41, 0x3f, 0x81, 0x0a, 0x14, 0x44, 0xb4, 0xe0, 0x99, 0x9d, 0x10, 
-    0x8f, 0x22, 0x5d, 0x5a, 0xf2, 0x24, 0xd3, 0xa7, 0x4c, 0xb3, 0x40, 0x9d, 0x4a, 
-    0x95, 0x6a, 0x81, 0xaa, 0x03, 0xaf, 0x96, 0x4c, 0xb3, 0xf1, 0x00, 0xc2, 0x01, 
-    0x0c, 0x85, 0xec, 0x14, 0xb0, 0x34, 0xc5, 0x46, 0xa9, 0x58, 0xd3, 0xaa, 0x55, 
-    0x2b, 0x65, 0x6d, 0x55, 0xb2, 0x69, 0xb5, 0xba, 0x5d, 0xea, 0x55, 0x20, 0x81, 
-    0xaa, 0x06, 0x02, 0xcc, 0xdd, 0x2b, 0x66, 0xe9, 0x90, 0xbd, 0x4c, 0x77, 0x68, 
-    0x11, 0x38, 0xa3, 0x21, 0x57, 0x97, 0x3b, 0xb0, 0xde, 0xb8, 0x29, 0x36, 0x24, 
-    0x03, 0xc0, 0x55, 0x17, 0x40, 0xa6, 0x9a, 0x60, 0x60, 0x40, 0x00, 0x21, 0xf9, 
-    0x04, 0x05, 0x03, 0x00, 0xd6, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 
-    0x32, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x04, 0x0c, 0x0b, 0x0c, 0x0e, 
-    0x0e, 0x12, 0x14, 0x14, 0x14, 0x17, 0x16, 0x1a, 0x1a, 0x17, 0x05, 0x1c, 0x1c, 
-    0x1c, 0x1c, 0x1c, 0x22, 0x20, 0x1f, 0x28, 0x23, 0x23, 0x23, 0x24, 0x22, 0x2b, 
-    0x29, 0x24, 0x08, 0x2b, 0x2b, 0x2c, 0x2c, 0x29, 0x11, 0x2f, 0x2d, 0x3a, 0x33, 
-    0x33, 0x33, 0x34, 0x33, 0x3c, 0x3a, 0x35, 0x0c, 0x3b, 0x3a, 0x42, 0x3b, 0x3b, 
-    0x3b, 0x43, 0x3c, 0x0d, 0x43, 0x43, 0x44, 0x45, 0x3b, 0x21, 0x4b, 0x49, 0x57, 
-    0x4c, 0x4c, 0x4d, 0x50, 0x3c, 0x47, 0x50, 0x48, 0x10, 0x50, 0x4f, 0x61, 0x54, 
-    0x54, 0x54, 0x55, 0x55, 0x5b, 0x56, 0x56, 0x6c, 0x58, 0x56, 0x61, 0x59, 0x59, 
-    0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x61, 0x34, 0x3a, 0x61, 0x61, 0x76, 
-    0x63, 0x63, 0x64, 0x65, 0x65, 0x7a, 0x66, 0x64, 0x6b, 0x68, 0x5c, 0x14, 0x6a, 
-    0x63, 0x5e, 0x6a, 0x6a, 0x7d, 0x6c, 0x26, 0x27, 0x6c, 0x6c, 0x6c, 0x6d, 0x6d, 
-    0x72, 0x6e, 0x6e, 0x81, 0x72, 0x5e, 0x2d, 0x72, 0x72, 0x85, 0x73, 0x2d, 0x2d, 
-    0x73, 0x73, 0x74, 0x74, 0x73, 0x7f, 0x76, 0x25, 0x26, 0x76, 0x38, 0x38, 0x76, 
-    0x76, 0x88, 0x77, 0x6c, 0x18, 0x7a, 0x49, 0x4a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 
-    0x8c, 0x7c, 0x28, 0x29, 0x7d, 0x7c, 0x83, 0x7f, 0x7f, 0x90, 0x82, 0x4d, 0x4d, 
-    0x83, 0x83, 0x84, 0x83, 0x83, 0x94, 0x84, 0x2b, 0x2c, 0x84, 0x83, 0x8f, 0x87, 
-    0x58, 0x58, 0x89, 0x6e, 0x12, 0x8a, 0x2e, 0x2e, 0x8a, 0x89, 0x95, 0x8b, 0x2f, 
-    0x30, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0x8e, 0x30, 0x31, 0x90, 0x7f, 0x87, 
-    0x90, 0x90, 0x9e, 0x91, 0x66, 0x66, 0x93, 0x32, 0x32, 0x94, 0x87, 0x1e, 0x94, 
-    0x94, 0x94, 0x94, 0x94, 0xa2, 0x96, 0x75, 0x1a, 0x96, 0x77, 0x27, 0x99, 0x77, 
-    0x0d, 0x9b, 0x35, 0x35, 0x9b, 0x74, 0x74, 0x9b, 0x7b, 0x23, 0x9b, 0x7d, 0x2c, 
-    0x9b, 0x7d, 0x34, 0x9b, 0x9b, 0xa5, 0x9b, 0x9c, 0x9c, 0x9c, 0x7b, 0x1b, 0x9d, 
-    0x7d, 0x15, 0x9d, 0x82, 0x84, 0x9d, 0x9d, 0xaa, 0x9e, 0x81, 0x34, 0x9e, 0x81, 
-    0x3a, 0x9e, 0x88, 0x24, 0xa0, 0x37, 0x37, 0xa1, 0x84, 0x3b, 0xa2, 0x83, 0x1a, 
-    0xa2, 0x86, 0x43, 0xa2, 0xa2, 0xad, 0xa4, 0x89, 0x44, 0xa4, 0xa3, 0xa4, 0xa5, 
-    0x84, 0x13, 0xa5, 0x86, 0x26, 0xa5, 0x8a, 0x4a, 0xa6, 0xa6, 0xb2, 0xa7, 0x88, 
-    0x16, 0xa8, 0x8e, 0x4e, 0xa8, 0x99, 0x22, 0xab, 0x8c, 0x14, 0xab, 0x8c, 0x19, 
-    0xab, 0x92, 0x55, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xad, 0x95, 0x5b, 0xae, 
-    0xae, 0xb9, 0xaf, 0x90, 0x18, 0xaf, 0x90, 0x90, 0xaf, 0x95, 0x4b, 0xaf, 0x98, 
-    0x60, 0xb2, 0x93, 0x16, 0xb2, 0x9b, 0x64, 0xb3, 0x95, 0x19, 0xb3, 0x97, 0x30, 
-    0xb3, 0x9a, 0x57, 0xb4, 0x9e, 0x69, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbd, 0xb7, 
-    0x99, 0x18, 0xb7, 0xa1, 0x6a, 0xb7, 0xa5, 0x29, 0xb7, 0xa6, 0x25, 0xba, 0xa3, 
-    0xa4, 0xbb, 0x9d, 0x1a, 0xbb, 0xa7, 0x76, 0xbb, 0xbb, 0xc4, 0xbc, 0xbc, 0xbc, 
-    0xbe, 0xa2, 0x1b, 0xc1, 0xaf, 0x82, 0xc2, 0xa5, 0x1c, 0xc3, 0xc3, 0xc4, 0xc4, 
-    0xb3, 0x89, 0xc4, 0xc4, 0xcb, 0xc5, 0xa9, 0x1d, 0xc7, 0xad, 0x2e, 0xc8, 0xb6, 
-    0x63, 0xc9, 0xad, 0x1e, 0xc9, 0xb6, 0xb7, 0xc9, 0xb7, 0x29, 0xca, 0xba, 0x95, 
-    0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xd2, 0xcd, 0xb2, 0x1e, 0xcd, 0xb2, 0x20, 0xd1, 
-    0xb6, 0x1f, 0xd1, 0xc2, 0x92, 0xd3, 0xd3, 0xd4, 0xd5, 0xbb, 0x23, 0xd5, 0xbc, 
-    0x24, 0xd5, 0xd5, 0xda, 0xd6, 0xc7, 0xc7, 0xd7, 0xcb, 0xae, 0xdb, 0xdb, 0xdd, 
-    0xdc, 0xc3, 0x26, 0xdc, 0xc8, 0x2a, 0xde, 0xde, 0xe2, 0xe0, 0xc7, 0x26, 0xe1, 
-    0xc9, 0x27, 0xe3, 0xd9, 0xd9, 0xe3, 0xdb, 0xc7, 0xe3, 0xe3, 0xe5, 0xe4, 0xcc, 
-    0x29, 0xe4, 0xcf, 0x38, 0xe5, 0xe5, 0xe9, 0xe6, 0xd1, 0x2c, 0xe7, 0xd5, 0x5e, 
-    0xea, 0xe3, 0xd5, 0xea, 0xe4, 0xe4, 0xeb, 0xd4, 0x2c, 0xeb, 0xd8, 0x33, 0xeb, 
-    0xeb, 0xec, 0xee, 0xee, 0xf1, 0xef, 0xd9, 0x2d, 0xf1, 0xed, 0xe7, 0xf2, 0xdc, 
-    0x2f, 0xf3, 0xde, 0x30, 0xf4, 0xf4, 0xf5, 0xf5, 0xe0, 0x2f, 0xf6, 0xe1, 0x31, 
-    0xf6, 0xf3, 0xec, 0xf7, 0xf7, 0xf8, 0xf9, 0xf7, 0xf5, 0xfa, 0xe5, 0x32, 0xfb, 
-    0xeb, 0x65, 0xfc, 0xec, 0x5b, 0xfd, 0xf3, 0x97, 0xff, 0xeb, 0x34, 0xff, 0xec, 
-    0x3b, 0xff, 0xec, 0x43, 0xff, 0xed, 0x4b, 0xff, 0xee, 0x53, 0xff, 0xf0, 0x59, 
-    0xff, 0xf0, 0x65, 0xff, 0xf0, 0x6a, 0xff, 0xf2, 0x74, 0xff, 0xf2, 0x7a, 0xff, 
-    0xf3, 0x86, 0xff, 0xf8, 0xb5, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xad, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 
-    0xc1, 0x83, 0xd6, 0x2c, 0x21, 0x5c, 0xc8, 0x70, 0xe1, 0x32, 0x4a, 0x0d, 0x23, 
-    0x32, 0xbc, 0x55, 0x89, 0x59, 0xb2, 0x3c, 0x03, 0xf7, 0x48, 0xdc, 0x88, 0xab, 
-    0x18, 0xb3, 0x60, 0xb7, 0x92, 0x59, 0x3b, 0xc4, 0x2a, 0xd8, 0xc6, 0x93, 0x90, 
-    0x8a, 0x25, 0xc3, 0x95, 0x0c, 0x12, 0x30, 0x91, 0x27, 0x4f, 0xee, 0x4a, 0x46, 
-    0xb3, 0x58, 0xb1, 0x58, 0x31, 0x37, 0x1e, 0x52, 0x49, 0x33, 0x59, 0x30, 0x9b, 
-    0xb3, 0x72, 0x2e, 0x2c, 0xe3, 0x29, 0x64, 0xcf, 0x64, 0xc5, 0x6e, 0x15, 0x6b, 
-    0x96, 0x4a, 0x28, 0xc1, 0x4c, 0xb0, 0x62, 0xcd, 0x4a, 0x55, 0x6c, 0xd4, 0xae, 
-    0x5e, 0x47, 0x71, 0x3a, 0x1d, 0x88, 0x8a, 0x26, 0x2c, 0x56, 0x2f, 0x7d, 0xe1, 
-    0x62, 0xd5, 0xd3, 0xe3, 0x56, 0x81, 0x80, 0x78, 0xda, 0x2c, 0xdb, 0x13, 0x97, 
-    0x35, 0x40, 0x67, 0xad, 0x7d, 0x3a, 0x4a, 0xb7, 0xe6, 0xd4, 0xb8, 0xd6, 0x3c, 
-    0xd5, 0xbd, 0x35, 0x6b, 0xd6, 0xad, 0x58, 0x70, 0x9b, 0x9e, 0xcd, 0xd4, 0x0b, 
-    0x2b, 0x4d, 0x5f, 0xa8, 0x5e, 0x7a, 0x75, 0x84, 0xd7, 0x87, 0x24, 0x5a, 0xa6, 
-    0x68, 0xd1, 0x72, 0xc5, 0x2b, 0xb2, 0x64, 0x5a, 0xa9, 0x56, 0xa6, 0x3a, 0xe4, 
-    0x14, 0x4d, 0xae, 0x6a, 0xa0, 0x43, 0x8b, 0x06, 0x1d, 0x0a, 0x07, 0x4b, 0x5f, 
-    0x85, 0x72, 0xda, 0xf9, 0x35, 0xba, 0x35, 0x68, 0x17, 0x00, 0x24, 0x64, 0xfe, 
-    0x14, 0x53, 0x8a, 0x2e, 0xd7, 0xad, 0x5f, 0x01, 0xd8, 0x6d, 0x60, 0x94, 0xa2, 
-    0x98, 0xa1, 0x70, 0xb7, 0x6e, 0xb4, 0x9b, 0x37, 0xc4, 0x8d, 0x41, 0x58, 0x0b, 
-    0x17, 0xcd, 0xa5, 0xf8, 0xee, 0x14, 0xa2, 0x36, 0xba, 0x59, 0x3e, 0x5a, 0x87, 
-    0xf3, 0xdd, 0x88, 0x46, 0x49, 0x64, 0x44, 0x5d, 0xb4, 0x88, 0xeb, 0xb1, 0xb5, 
-    0x36, 0xff, 0xdc, 0x14, 0x3a, 0x97, 0xaa, 0xe5, 0x14, 0xc0, 0x03, 0x88, 0x23, 
-    0x91, 0x14, 0xe9, 0x57, 0x93, 0x4e, 0x0d, 0xc3, 0xdd, 0x40, 0xbd, 0x03, 0x89, 
-    0xba, 0x54, 0x35, 0xba, 0x5d, 0x4d, 0xd6, 0xa6, 0x48, 0x93, 0x6c, 0xe2, 0x5e, 
-    0x68, 0xf5, 0xa9, 0xa7, 0x40, 0x43, 0x84, 0x84, 0x42, 0xca, 0x7c, 0xac, 0xbd, 
-    0xf2, 0x59, 0x2e, 0xba, 0x0c, 0xc3, 0x5f, 0x35, 0xe9, 0xa9, 0x87, 0x00, 0x43, 
-    0xb6, 0x0d, 0xf3, 0x4a, 0x35, 0x9b, 0xb4, 0x50, 0x0d, 0x10, 0x33, 0x80, 0xe6, 
-    0xa0, 0x68, 0x1e, 0xa8, 0x07, 0x40, 0x01, 0x0b, 0x11, 0x72, 0xdb, 0x79, 0xd5, 
-    0x0c, 0x92, 0x41, 0x35, 0x75, 0x10, 0xc0, 0x1f, 0x27, 0x9f, 0x81, 0x66, 0x9d, 
-    0x89, 0x07, 0xb9, 0x71, 0x0a, 0x68, 0xb2, 0xa8, 0xf2, 0x99, 0x2a, 0x93, 0x54, 
-    0xf3, 0x4b, 0x23, 0xf3, 0x55, 0x13, 0xca, 0x8e, 0xa0, 0x35, 0x87, 0x23, 0x41, 
-    0x4d, 0x04, 0x27, 0x5a, 0x2e, 0x45, 0xb6, 0x16, 0xa1, 0x72, 0xd5, 0x10, 0xb7, 
-    0xa4, 0x40, 0x76, 0x4c, 0xd8, 0x9d, 0x6b, 0xaa, 0x98, 0x08, 0xc0, 0x40, 0x84, 
-    0x44, 0xb9, 0xa5, 0x6b, 0xc3, 0x58, 0xb0, 0x24, 0x1a, 0x62, 0x8e, 0x29, 0x5a, 
-    0x91, 0x6a, 0xa8, 0x47, 0x80, 0x40, 0x48, 0xaa, 0x39, 0xda, 0x26, 0xa7, 0x90, 
-    0x42, 0x4a, 0x97, 0xe0, 0x1d, 0x60, 0x4d, 0x13, 0x72, 0xb6, 0x26, 0x1f, 0x68, 
-    0xc3, 0x84, 0xd2, 0x03, 0x78, 0x0b, 0x58, 0xc3, 0x9d, 0x68, 0xa1, 0x70, 0xd1, 
-    0x83, 0x0e, 0x5c, 0x50, 0x89, 0x9b, 0x93, 0x3c, 0xda, 0x11, 0x80, 0x73, 0x07, 
-    0x5a, 0xc3, 0x89, 0x68, 0x75, 0x5c, 0x37, 0xc8, 0x72, 0xa4, 0xd4, 0x18, 0x9a, 
-    0x14, 0x15, 0x02, 0x70, 0xa1, 0x40, 0x97, 0x86, 0x66, 0xa6, 0x73, 0x8d, 0x08, 
-    0x37, 0xcc, 0x80, 0xa1, 0x0d, 0xb3, 0x82, 0x35, 0x10, 0x10, 0xa2, 0x50, 0x29, 
-    0xa9, 0xa2, 0x45, 0x22, 0x82, 0x05, 0x33, 0x70, 0x01, 0x29, 0x99, 0x71, 0x82, 
-    0xf6, 0xcb, 0x42, 0xa5, 0xf6, 0x59, 0x8d, 0x2e, 0x9b, 0x38, 0x3a, 0xcc, 0x0e, 
-    0x08, 0xe1, 0x21, 0x6c, 0x35, 0xaa, 0xa0, 0x61, 0x4d, 0x10, 0x1b, 0x82, 0x96, 
-    0xcb, 0x15, 0x3f, 0x20, 0x24, 0x8b, 0x9c, 0xc3, 0x44, 0x42, 0x10, 0x77, 0xad, 
-    0xe8, 0xb1, 0x04, 0x12, 0x42, 0x20, 0x64, 0x47, 0x9a, 0xc2, 0xfd, 0x62, 0x47, 
-    0x41, 0x4e, 0x7c, 0xf1, 0x2d, 0x11, 0x98, 0x9c, 0x8b, 0x50, 0x98, 0xdd, 0x9d, 
-    0xb2, 0x85, 0x41, 0x48, 0x18, 0x71, 0x45, 0x29, 0xf3, 0xe5, 0xc2, 0x10, 0x18, 
-    0x0b, 0xba, 0xa6, 0x4b, 0x28, 0x6e, 0x20, 0x44, 0x44, 0x2b, 0xa3, 0x69, 0xcb, 
-    0x90, 0x0f, 0x78, 0x04, 0xc8, 0xc9, 0x24, 0x8c, 0x48, 0x71, 0x03, 0x43, 0x87, 
-    0x8a, 0x26, 0x0b, 0x06, 0x78, 0x19, 0xe4, 0x69, 0x68, 0xa4, 0x14, 0x5a, 0xf1, 
-    0x40, 0x41, 0x82, 0x36, 0x61, 0x28, 0x00, 0x64, 0xb0, 0xb1, 0x35, 0x68, 0x86, 
-    0x16, 0x67, 0x97, 0x09, 0x6c, 0x1c, 0xc4, 0xc5, 0xac, 0xea, 0x22, 0x00, 0x00, 
-    0x16, 0x0c, 0x14, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0c, 0x00, 0x8e, 0x00, 
-    0x2c, 0x04, 0x00, 0x04, 0x00, 0x26, 0x00, 0x32, 0x00, 0x87, 0x0c, 0x0c, 0x0c, 
-    0x12, 0x12, 0x12, 0x17, 0x17, 0x18, 0x1d, 0x1d, 0x1d, 0x20, 0x20, 0x1f, 0x2b, 
-    0x2b, 0x2b, 0x32, 0x32, 0x33, 0x3a, 0x3a, 0x3b, 0x3d, 0x3c, 0x42, 0x41, 0x3f, 
-    0x4d, 0x42, 0x42, 0x42, 0x48, 0x46, 0x53, 0x4b, 0x49, 0x56, 0x4d, 0x4d, 0x4d, 
-    0x4f, 0x4e, 0x5b, 0x53, 0x53, 0x54, 0x55, 0x54, 0x5c, 0x56, 0x54, 0x60, 0x56, 
-    0x56, 0x6d, 0x59, 0x59, 0x6f, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x72, 0x5e, 0x39, 
-    0x41, 0x60, 0x5e, 0x6b, 0x62, 0x61, 0x6e, 0x62, 0x61, 0x76, 0x64, 0x63, 0x65, 
-    0x65, 0x65, 0x7a, 0x6a, 0x69, 0x76, 0x6a, 0x6a, 0x7d, 0x6b, 0x6b, 0x6d, 0x6e, 
-    0x4c, 0x51, 0x6e, 0x67, 0x69, 0x70, 0x2f, 0x2f, 0x70, 0x6e, 0x7b, 0x73, 0x73, 
-    0x75, 0x73, 0x73, 0x85, 0x76, 0x76, 0x89, 0x77, 0x36, 0x36, 0x77, 0x3d, 0x3d, 
-    0x78, 0x78, 0x7d, 0x7b, 0x7b, 0x8c, 0x7c, 0x46, 0x46, 0x7e, 0x52, 0x55, 0x7f, 
-    0x4a, 0x4b, 0x7f, 0x7f, 0x90, 0x82, 0x4e, 0x4e, 0x83, 0x83, 0x94, 0x84, 0x83, 
-    0x8f, 0x85, 0x54, 0x55, 0x88, 0x87, 0x98, 0x88, 0x88, 0x97, 0x89, 0x87, 0x91, 
-    0x8a, 0x5c, 0x5c, 0x8b, 0x8b, 0x9b, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x9e, 0x93, 
-    0x69, 0x69, 0x94, 0x74, 0x1d, 0x94, 0x94, 0xa2, 0x97, 0x77, 0x22, 0x97, 0x77, 
-    0x2c, 0x97, 0x78, 0x29, 0x98, 0x77, 0x1f, 0x98, 0x98, 0xa6, 0x99, 0x74, 0x73, 
-    0x9a, 0x7b, 0x23, 0x9b, 0x7b, 0x1b, 0x9b, 0x7c, 0x2d, 0x9b, 0x7d, 0x32, 0x9c, 
-    0x7e, 0x38, 0x9d, 0x9d, 0xaa, 0x9e, 0x80, 0x2c, 0x9e, 0x81, 0x3a, 0x9f, 0x7e, 
-    0x16, 0x9f, 0x80, 0x22, 0x9f, 0x81, 0x36, 0xa1, 0x84, 0x3d, 0xa1, 0xa1, 0xad, 
-    0xa2, 0x82, 0x1b, 0xa2, 0x83, 0x23, 0xa2, 0x86, 0x43, 0xa3, 0x84, 0x2a, 0xa3, 
-    0x85, 0x33, 0xa4, 0x89, 0x44, 0xa5, 0x85, 0x17, 0xa5, 0x8a, 0x4b, 0xa5, 0xa5, 
-    0xb1, 0xa6, 0x83, 0x83, 0xa8, 0x8b, 0x2c, 0xa8, 0x8e, 0x4e, 0xa8, 0x8e, 0x51, 
-    0xab, 0x91, 0x55, 0xad, 0x8f, 0x26, 0xad, 0x92, 0x42, 0xad, 0xad, 0xb8, 0xae, 
-    0x95, 0x5c, 0xb0, 0x96, 0x57, 0xb0, 0x97, 0x5a, 0xb1, 0x95, 0x31, 0xb2, 0x9b, 
-    0x64, 0xb4, 0x9e, 0x69, 0xb4, 0xb4, 0xbe, 0xb5, 0x9d, 0x53, 0xb6, 0x9d, 0x4c, 
-    0xb6, 0xa1, 0x6d, 0xb8, 0x9f, 0x4b, 0xb9, 0xa3, 0x61, 0xba, 0xa5, 0x74, 0xbc, 
-    0xa9, 0x78, 0xbd, 0xa1, 0x2c, 0xbd, 0xa6, 0x5e, 0xbd, 0xaa, 0x7c, 0xc1, 0xae, 
-    0x6a, 0xc1, 0xaf, 0x81, 0xc3, 0xa9, 0x35, 0xc3, 0xb1, 0x85, 0xc3, 0xb2, 0x89, 
-    0xc8, 0xb6, 0x7e, 0xc8, 0xb8, 0x8d, 0xc9, 0xaf, 0x2e, 0xd0, 0xc1, 0x93, 0xd4, 
-    0xc4, 0x85, 0xdf, 0xcc, 0x58, 0xe4, 0xce, 0x3e, 0xe4, 0xd3, 0x74, 0xf4, 0xe3, 
-    0x5b, 0xf6, 0xe7, 0x68, 0xf8, 0xed, 0x94, 0xff, 0xec, 0x3f, 0xff, 0xed, 0x44, 
-    0xff, 0xed, 0x4b, 0xff, 0xee, 0x53, 0xff, 0xef, 0x5b, 0xff, 0xef, 0x63, 0xff, 
-    0xf0, 0x53, 0xff, 0xf0, 0x5e, 0xff, 0xf2, 0x74, 0xff, 0xf3, 0x84, 0xff, 0xf4, 
-    0x8e, 0xff, 0xf5, 0x97, 0xff, 0xf5, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa5, 
-    0x00, 0x1d, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 
-    0xe8, 0x68, 0x0e, 0xc3, 0x87, 0x0a, 0x09, 0x39, 0xea, 0x02, 0xb1, 0x62, 0x42, 
-    0x35, 0x16, 0x2b, 0x3a, 0x1c, 0xe8, 0x26, 0xa3, 0xc7, 0x8f, 0x16, 0x31, 0x82, 
-    0x84, 0x38, 0x45, 0x61, 0xa1, 0x91, 0x28, 0x53, 0xaa, 0x3c, 0x28, 0x72, 0xa5, 
-    0xca, 0x3d, 0x2e, 0x17, 0xc2, 0x1c, 0x89, 0x87, 0x61, 0x47, 0x94, 0x2f, 0xee, 
-    0xf4, 0x71, 0xd4, 0x67, 0xa7, 0xc0, 0x9e, 0x3d, 0x67, 0x3a, 0x6a, 0x19, 0xb3, 
-    0xa8, 0xd1, 0xa3, 0x48, 0x09, 0x6e, 0x4c, 0xfa, 0xf1, 0x0a, 0xd3, 0xa7, 0x50, 
-    0x63, 0x16, 0x88, 0xea, 0x68, 0xea, 0x47, 0x33, 0x16, 0x0f, 0x20, 0x24, 0xa0, 
-    0x10, 0x88, 0x4b, 0x01, 0x45, 0x51, 0x58, 0x74, 0x4a, 0xb5, 0xac, 0x59, 0xa4, 
-    0x4e, 0xce, 0x26, 0x05, 0x1b, 0xd5, 0xea, 0x53, 0xae, 0x48, 0xb5, 0x0a, 0x84, 
-    0x9b, 0xd4, 0x40, 0x00, 0xb5, 0x67, 0xbf, 0xe0, 0x7d, 0xaa, 0x77, 0x64, 0x0e, 
-    0x2c, 0x10, 0xb1, 0xa2, 0xcc, 0x01, 0xb5, 0xc6, 0x4a, 0xaf, 0x1e, 0x19, 0xec, 
-    0x65, 0xba, 0x60, 0x71, 0xd2, 0x04, 0x03, 0x03, 0x02, 0x00, 0x3b
-};
-
-const lv_img_dsc_t snoopy = {
-  .header.cf = LV_COLOR_FORMAT_RAW,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 74,
-  .header.h = 54,
-  .data_size = 70393,
-  .data = snoopy_map,
-};
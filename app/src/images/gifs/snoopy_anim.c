@@ -0,0 +1,15 @@
+#include <lvgl.h>
+
+// Generated by gif_to_zsw_anim.py, played by zsw_ui_anim.
+static const uint8_t snoopy_anim_map[] = {
+#include "snoopy_anim.bin.inc"
+};
+
+const lv_image_dsc_t snoopy_anim = {
+    .header.cf = LV_COLOR_FORMAT_RAW,
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 74,
+    .header.h = 54,
+    .data_size = sizeof(snoopy_anim_map),
+    .data = snoopy_anim_map,
+};
@@ -42,6 +42,7 @@
 
 #include "ui/zsw_ui.h"
 #include "ui/popup/zsw_popup_window.h"
+#include "ui/utils/zsw_ui_cache.h"
 #include "zsw_ui_controller.h"
 
 #include "ble/ble_comm.h"
@@ -56,6 +57,7 @@
 #include "sensors/zsw_magnetometer.h"
 #include "sensors/zsw_pressure_sensor.h"
 #include "sensors/zsw_light_sensor.h"
+#include "sensors/zsw_pressure_history.h"
 
 #include "drivers/zsw_vibration_motor.h"
 #include "drivers/zsw_display_control.h"
@@ -71,6 +73,8 @@
 
 #include "fuel_gauge/zsw_pmic.h"
 #include "managers/zsw_microphone_manager.h"
+#include "zsw_zbus_trace.h"
+#include "zsw_boot.h"
 
 #ifdef CONFIG_APPLICATIONS_USE_VOICE_MEMO
 #include "managers/zsw_recording_manager.h"
@@ -89,48 +93,111 @@ static void on_zbus_ble_data_callback(const struct zbus_channel *chan);
 K_WORK_DEFINE(init_work, run_init_work);
 
 ZBUS_CHAN_DECLARE(ble_comm_data_chan);
-ZBUS_LISTENER_DEFINE(main_ble_comm_lis, on_zbus_ble_data_callback);
-ZBUS_LISTENER_DEFINE(main_notification_lis, on_zbus_notification_callback);
+ZSW_ZBUS_LISTENER_DEFINE(main_ble_comm_lis, on_zbus_ble_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(main_notification_lis, on_zbus_notification_callback);
 
 static bool pending_not_open = false;
 
-static void run_init_work(struct k_work *item)
+static int boot_display(void)
 {
-    zsw_coredump_init();
-
     zsw_display_control_init();
     zsw_display_control_sleep_ctrl(true);
 
+    return 0;
+}
+
+static int boot_notifications(void)
+{
     zsw_notification_manager_init();
 
+    return 0;
+}
+
+static int boot_bluetooth(void)
+{
     enable_bluetooth();
 
+    return 0;
+}
+
+static int boot_sensors(void)
+{
     zsw_imu_init();
     zsw_magnetometer_init();
     zsw_pressure_sensor_init();
     zsw_light_sensor_init();
 
-    zsw_power_manager_init();
+    return 0;
+}
 
-    zsw_ui_controller_init();
+static int boot_ui_cache(void)
+{
+    zsw_ui_cache_init();
 
-#ifdef CONFIG_AUDIO_DMIC
-    zsw_microphone_manager_init();
-#endif
+    return 0;
+}
 
 #ifdef CONFIG_APPLICATIONS_USE_VOICE_MEMO
-    zsw_recording_manager_init();
+static int boot_voice_memo(void)
+{
+    int ret = zsw_recording_manager_init();
+
     zsw_voice_memo_popup_init();
+
+    return ret;
+}
 #endif
 
-    print_retention_ram();
 #ifdef CONFIG_SPI_FLASH_LOADER
+static int boot_check_raw_fs(void)
+{
     if (NUM_RAW_FS_FILES != zsw_filesytem_get_num_rawfs_files()) {
         LOG_ERR("Number of rawfs files does not match the number of files in the file table: %d / %d",
                 zsw_filesytem_get_num_rawfs_files(), NUM_RAW_FS_FILES);
         zsw_popup_show("Warning", "Missing files in external flash\nPlease run:\nwest upload_fs", NULL, 5, false);
     }
+
+    return 0;
+}
+#endif
+
+static zsw_boot_task_t notifications_task = {
+    .name = "notifications", .init = boot_notifications, .stage = ZSW_BOOT_STAGE_DEFERRED
+};
+
+// Only what the watchface needs is critical, everything else is brought up after its first frame.
+static zsw_boot_task_t boot_tasks[] = {
+    { .name = "display", .init = boot_display, .stage = ZSW_BOOT_STAGE_CRITICAL },
+    { .name = "power_manager", .init = zsw_power_manager_init, .stage = ZSW_BOOT_STAGE_CRITICAL },
+    { .name = "ui_cache", .init = boot_ui_cache, .stage = ZSW_BOOT_STAGE_CRITICAL },
+    { .name = "ui", .init = zsw_ui_controller_init, .stage = ZSW_BOOT_STAGE_CRITICAL },
+    // ANCS adds notifications as soon as it is connected
+    { .name = "bluetooth", .init = boot_bluetooth, .stage = ZSW_BOOT_STAGE_DEFERRED, .depends_on = &notifications_task },
+    { .name = "sensors", .init = boot_sensors, .stage = ZSW_BOOT_STAGE_DEFERRED },
+#ifdef CONFIG_AUDIO_DMIC
+    { .name = "microphone", .init = zsw_microphone_manager_init, .stage = ZSW_BOOT_STAGE_DEFERRED },
 #endif
+#ifdef CONFIG_APPLICATIONS_USE_VOICE_MEMO
+    { .name = "voice_memo", .init = boot_voice_memo, .stage = ZSW_BOOT_STAGE_DEFERRED },
+#endif
+    { .name = "coredump", .init = zsw_coredump_init, .stage = ZSW_BOOT_STAGE_IDLE },
+#ifdef CONFIG_ZSW_PRESSURE_HISTORY
+    { .name = "pressure_history", .init = zsw_pressure_history_init, .stage = ZSW_BOOT_STAGE_IDLE },
+#endif
+#ifdef CONFIG_SPI_FLASH_LOADER
+    { .name = "raw_fs_check", .init = boot_check_raw_fs, .stage = ZSW_BOOT_STAGE_IDLE },
+#endif
+};
+
+static void run_init_work(struct k_work *item)
+{
+    zsw_boot_add_task(&notifications_task);
+    for (int i = 0; i < ARRAY_SIZE(boot_tasks); i++) {
+        zsw_boot_add_task(&boot_tasks[i]);
+    }
+
+    print_retention_ram();
+    zsw_boot_start();
 
     LOG_INF("ZSWatch application started");
 }
@@ -229,18 +296,18 @@ static void on_zbus_ble_data_callback(const struct zbus_channel *chan)
 {
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
 
-    switch (event->data.type) {
+    switch (event->data->type) {
         case BLE_COMM_DATA_TYPE_SET_TIME: {
-            if (event->data.data.time.seconds > 0) {
+            if (event->data->data.time.seconds > 0) {
                 zsw_timeval_t ztm;
-                memcpy(&ztm.tm, localtime((const time_t *)&event->data.data.time.seconds), sizeof(ztm.tm));
+                memcpy(&ztm.tm, localtime((const time_t *)&event->data->data.time.seconds), sizeof(ztm.tm));
                 zsw_clock_set_time(&ztm);
             }
 
-            if (event->data.data.time.tz_offset != 0) {
+            if (event->data->data.time.tz_offset != 0) {
                 char tz[sizeof("UTC+01")] = { '\0' };
-                char sign = (event->data.data.time.tz_offset < 0) ? '+' : '-';
-                snprintf(tz, sizeof(tz), "UTC%c%d", sign, MIN(abs(event->data.data.time.tz_offset), 99));
+                char sign = (event->data->data.time.tz_offset < 0) ? '+' : '-';
+                snprintf(tz, sizeof(tz), "UTC%c%d", sign, MIN(abs(event->data->data.time.tz_offset), 99));
 
 #ifdef CONFIG_RTC
                 if (zsw_clock_rtc_available()) {
@@ -25,12 +25,15 @@
 
 #include "ui/zsw_ui.h"
 #include "ui/app_picker/app_picker_ui.h"
+#include "ui/utils/zsw_ui_cache.h"
 #include "managers/zsw_app_manager.h"
 #include "events/activity_event.h"
+#include "zsw_zbus_trace.h"
+#include "zsw_boot.h"
 
 LOG_MODULE_REGISTER(app_manager, LOG_LEVEL_INF);
 
-#define MAX_APPS        25
+#define MAX_APPS        CONFIG_ZSW_APP_MANAGER_MAX_APPS
 #define INVALID_APP_ID  0xFF
 
 static void draw_app_and_folder_view(void);
@@ -40,12 +43,15 @@ static void async_app_close(lv_timer_t *timer);
 static void transition_app_to_ui_hidden(application_t *app);
 static void transition_app_to_ui_visible(application_t *app);
 static void zbus_activity_event_callback(const struct zbus_channel *chan);
+static int init_background_apps(void);
 
 ZBUS_CHAN_DECLARE(activity_state_data_chan);
-ZBUS_LISTENER_DEFINE(app_manager_activity_state_event_lis, zbus_activity_event_callback);
+ZSW_ZBUS_LISTENER_DEFINE(app_manager_activity_state_event_lis, zbus_activity_event_callback);
 
 ZSW_LV_IMG_DECLARE(folder_icon);
 
+BUILD_ASSERT(MAX_APPS < INVALID_APP_ID, "App index must fit in current_app");
+
 static application_t *apps[MAX_APPS];
 static uint8_t num_apps;
 static uint8_t num_visible_apps;
@@ -59,6 +65,12 @@ static lv_timer_t *async_app_start_timer;
 static lv_timer_t *async_app_close_timer;
 static bool screen_is_on = true;
 
+static zsw_boot_task_t background_apps_task = {
+    .name = "background_apps",
+    .init = init_background_apps,
+    .stage = ZSW_BOOT_STAGE_DEFERRED,
+};
+
 // TODO: Add icons for app folders
 static const zsw_app_folder_info_t app_folders[ZSW_APP_CATEGORY_COUNT] = {
     [ZSW_APP_CATEGORY_ROOT] = {
@@ -113,6 +125,53 @@ static void delete_root_object(void)
     }
 }
 
+static int init_app(application_t *app)
+{
+    int ret;
+
+    if (app->initialized) {
+        return 0;
+    }
+
+    if (app->init_func) {
+        ret = app->init_func();
+        if (ret != 0) {
+            LOG_ERR("Failed to init %s: %d", app->name, ret);
+            return ret;
+        }
+    }
+    app->initialized = true;
+
+    return 0;
+}
+
+static void stop_app(application_t *app)
+{
+    app->current_state = ZSW_APP_STATE_STOPPED;
+    app->stop_func();
+    zsw_ui_cache_evict(ZSW_UI_CACHE_APP);
+
+    if (!app->background && app->initialized) {
+        if (app->deinit_func) {
+            app->deinit_func();
+        }
+        app->initialized = false;
+    }
+}
+
+static int init_background_apps(void)
+{
+    int ret = 0;
+
+    for (int i = 0; i < num_apps; i++) {
+        if (apps[i]->background && init_app(apps[i]) != 0) {
+            ret = -EIO;
+        }
+    }
+
+    return ret;
+}
+
 static void on_app_selected(application_t *app)
 {
     if (app == NULL) {
@@ -138,12 +197,23 @@ static void async_app_start(lv_timer_t *timer)
 {
     async_app_start_timer = NULL;
     LOG_DBG("Start %d", current_app);
-    delete_root_object();
 
     application_t *app = apps[current_app];
+    if (init_app(app) != 0) {
+        // Stay in the picker, or go back to where the app was launched from.
+        current_app = INVALID_APP_ID;
+        if (app_launch_only) {
+            zsw_app_manager_delete();
+            close_cb_func();
+        }
+        return;
+    }
+
+    delete_root_object();
     __ASSERT(screen_is_on, "Screen expected to be on when starting app.");
     app->current_state = ZSW_APP_STATE_UI_VISIBLE;
 
+    zsw_ui_cache_set_category(ZSW_UI_CACHE_APP);
     app->start_func(root_obj, group_obj);
 }
 
@@ -157,8 +227,7 @@ static void async_app_close(lv_timer_t *timer)
         }
 
         if (!back_button_consumed) {
-            apps[current_app]->current_state = ZSW_APP_STATE_STOPPED;
-            apps[current_app]->stop_func();
+            stop_app(apps[current_app]);
             current_app = INVALID_APP_ID;
             if (app_launch_only) {
                 zsw_app_manager_delete();
@@ -228,8 +297,32 @@ static void zbus_activity_event_callback(const struct zbus_channel *chan)
     }
 }
 
+static void pin_app_icons(void)
+{
+    static bool icons_pinned;
+
+    if (icons_pinned) {
+        return;
+    }
+
+    for (int i = 0; i < num_apps; i++) {
+        if (!apps[i]->hidden && apps[i]->icon) {
+            zsw_ui_cache_pin(ZSW_UI_CACHE_APP_ICON, apps[i]->icon);
+        }
+    }
+    for (int i = 0; i < ARRAY_SIZE(app_folders); i++) {
+        if (app_folders[i].icon) {
+            zsw_ui_cache_pin(ZSW_UI_CACHE_APP_ICON, app_folders[i].icon);
+        }
+    }
+    icons_pinned = true;
+}
+
 static void draw_app_and_folder_view(void)
 {
+    zsw_ui_cache_set_category(ZSW_UI_CACHE_APP_ICON);
+    pin_app_icons();
+
     /* Use new circular app picker UI */
     app_picker_root = app_picker_ui_create(root_obj, group_obj, on_app_selected, app_folders);
 
@@ -274,10 +367,10 @@ void zsw_app_manager_delete(void)
 {
     if (current_app < num_apps) {
         LOG_DBG("Stop force %d", current_app);
-        apps[current_app]->current_state = ZSW_APP_STATE_STOPPED;
-        apps[current_app]->stop_func();
+        stop_app(apps[current_app]);
     }
     delete_root_object();
+    zsw_ui_cache_set_category(ZSW_UI_CACHE_WATCHFACE);
 }
 
 void zsw_app_manager_add_application(application_t *app)
@@ -285,6 +378,7 @@ void zsw_app_manager_add_application(application_t *app)
     __ASSERT_NO_MSG(num_apps < MAX_APPS);
 
     app->current_state = ZSW_APP_STATE_STOPPED;
+    app->initialized = false;
     apps[num_apps] = app;
     num_apps++;
     if (!app->hidden) {
@@ -335,6 +429,9 @@ static int application_manager_init(void)
     async_app_start_timer = NULL;
     screen_is_on = true;
 
+    // Runs after all apps are registered, the first frame doesn't wait for background apps.
+    zsw_boot_add_task(&background_apps_task);
+
     // Subscribe to activity events to track screen state
     zbus_chan_add_obs(&activity_state_data_chan, &app_manager_activity_state_event_lis, K_MSEC(100));
 
@@ -55,6 +55,12 @@ typedef enum {
 
 typedef void(*application_ui_unavailable_fn)(void);
 typedef void(*application_ui_available_fn)(void);
+/*
+* Create the state the app needs to run, for example buffers. Return 0 on success, the app is not
+* started on failure.
+*/
+typedef int(*application_init_fn)(void);
+typedef void(*application_deinit_fn)(void);
 
 typedef struct application_t {
     application_start_fn            start_func;
@@ -62,9 +68,17 @@ typedef struct application_t {
     application_back_fn             back_func;
     application_ui_unavailable_fn   ui_unavailable_func;
     application_ui_available_fn     ui_available_func;
+    // Optional, called before the first start and again after each deinit_func.
+    application_init_fn             init_func;
+    // Optional, called after stop_func to release what init_func created.
+    application_deinit_fn           deinit_func;
     char                            *name;
     const void                      *icon;
     bool                            hidden;
+    // Background service, init_func is called at boot instead of on first start and
+    // deinit_func is never called. Only for apps that must run while closed.
+    bool                            background;
+    bool                            initialized;
     zsw_app_category_t              category;
     uint8_t                         private_list_index;
     zsw_app_state_t                 current_state;
@@ -26,6 +26,7 @@
 #include "events/ble_event.h"
 #include "events/zsw_notification_event.h"
 #include "zsw_notification_manager.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(notification_mgr, LOG_LEVEL_DBG);
 
@@ -39,7 +40,7 @@ static uint8_t num_notifications;
 static zsw_not_mngr_notification_t notifications[ZSW_NOTIFICATION_MGR_MAX_STORED];
 
 static K_WORK_DEFINE(notification_work, notification_mgr_update_worker);
-ZBUS_LISTENER_DEFINE(notification_mgr_ble_comm_lis, notification_mgr_zbus_ble_comm_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(notification_mgr_ble_comm_lis, notification_mgr_zbus_ble_comm_data_callback);
 ZBUS_CHAN_DECLARE(zsw_notification_mgr_chan);
 ZBUS_CHAN_DECLARE(zsw_notification_mgr_remove_chan);
 
@@ -127,12 +128,12 @@ static void notification_mgr_zbus_ble_comm_data_callback(const struct zbus_chann
     // We are here in host bluetooth thread.
     const struct ble_data_event *event = zbus_chan_const_msg(chan);
 
-    if (event->data.type == BLE_COMM_DATA_TYPE_NOTIFY) {
+    if (event->data->type == BLE_COMM_DATA_TYPE_NOTIFY) {
         // Notification source is empty, ignore.
-        if (event->data.data.notify.src_len == 0) {
+        if (event->data->data.notify.src_len == 0) {
             return;
         }
-        not = zsw_notification_manager_add(&event->data.data.notify);
+        not = zsw_notification_manager_add(&event->data->data.notify);
         if (!not) {
             return;
         }
@@ -145,11 +146,11 @@ static void notification_mgr_zbus_ble_comm_data_callback(const struct zbus_chann
         LOG_DBG("Time: %u", not->timestamp);
 
         k_work_submit(&notification_work);
-    } else if (event->data.type == BLE_COMM_DATA_TYPE_NOTIFY_REMOVE) {
-        LOG_DBG("Remove notification with ID %u", event->data.data.notify_remove.id);
+    } else if (event->data->type == BLE_COMM_DATA_TYPE_NOTIFY_REMOVE) {
+        LOG_DBG("Remove notification with ID %u", event->data->data.notify_remove.id);
 
-        if (zsw_notification_manager_remove(event->data.data.notify_remove.id) != 0) {
-            LOG_WRN("Notification %d not found", event->data.data.notify_remove.id);
+        if (zsw_notification_manager_remove(event->data->data.notify_remove.id) != 0) {
+            LOG_WRN("Notification %d not found", event->data->data.notify_remove.id);
         }
     }
 }
@@ -285,7 +286,6 @@ int32_t zsw_notification_manager_remove(uint32_t id)
         // handle the notification, because the data in the notification buffer can change before
         // the listeners have ececuted their operations.
         memcpy(&evt.notification, &notifications[idx], sizeof(zsw_not_mngr_notification_t));
-        zbus_chan_pub(&zsw_notification_mgr_remove_chan, &evt, K_NO_WAIT);
 
         notifications[idx].id = ZSW_NOTIFICATION_MGR_INVALID_ID;
 
@@ -295,6 +295,9 @@ int32_t zsw_notification_manager_remove(uint32_t id)
 
         LOG_DBG("Notifications: %u", num_notifications);
 
+        // Publish after the removal so listeners see the new count.
+        zbus_chan_pub(&zsw_notification_mgr_remove_chan, &evt, K_NO_WAIT);
+
         return 0;
     }
 
@@ -32,6 +32,7 @@
 #include "managers/zsw_power_manager.h"
 #include "events/zsw_notification_event.h"
 #include "sensors/zsw_imu.h"
+#include "zsw_zbus_trace.h"
 #if defined(CONFIG_BT_HRS)
 #include "sensors/zsw_health_data.h"
 #endif
@@ -45,8 +46,8 @@ static void handle_delayed_send_status(struct k_work *item);
 
 ZBUS_CHAN_DECLARE(battery_sample_data_chan);
 ZBUS_CHAN_DECLARE(zsw_notification_mgr_remove_chan);
-ZBUS_LISTENER_DEFINE(zsw_phone_app_publisher_battery_event, zbus_send_status_data_callback);
-ZBUS_LISTENER_DEFINE(zsw_phone_app_publisher_notification_remove_event, zbus_notification_remove_callback);
+ZSW_ZBUS_LISTENER_DEFINE(zsw_phone_app_publisher_battery_event, zbus_send_status_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(zsw_phone_app_publisher_notification_remove_event, zbus_notification_remove_callback);
 ZBUS_CHAN_ADD_OBS(zsw_notification_mgr_remove_chan, zsw_phone_app_publisher_notification_remove_event, 1);
 
 K_WORK_DELAYABLE_DEFINE(delayed_send_status_work, handle_delayed_send_status);
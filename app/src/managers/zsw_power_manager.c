@@ -34,6 +34,7 @@
 #include "zsw_power_manager.h"
 #include "zsw_display_control.h"
 #include "zsw_vibration_motor.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(zsw_power_manager, CONFIG_ZSW_PWR_MANAGER_LOG_LEVEL);
 
@@ -78,12 +79,12 @@ K_WORK_DELAYABLE_DEFINE(tilt_work, tilt_detection_work_handler);
 
 ZBUS_CHAN_DECLARE(activity_state_data_chan);
 
-ZBUS_LISTENER_DEFINE(power_manager_accel_lis, zbus_accel_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(power_manager_accel_lis, zbus_accel_data_callback);
 
 ZBUS_CHAN_DECLARE(battery_sample_data_chan);
 ZBUS_OBS_DECLARE(zsw_power_manager_bat_listener);
 ZBUS_CHAN_ADD_OBS(battery_sample_data_chan, zsw_power_manager_bat_listener, 1);
-ZBUS_LISTENER_DEFINE(zsw_power_manager_bat_listener, zbus_battery_sample_data_callback);
+ZSW_ZBUS_LISTENER_DEFINE(zsw_power_manager_bat_listener, zbus_battery_sample_data_callback);
 
 typedef enum {
     TILT_STATE_IDLE,
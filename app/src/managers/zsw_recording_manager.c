@@ -23,6 +23,7 @@
 
 #include "zsw_recording_manager.h"
 #include "zsw_recording_manager_store.h"
+#include "zsw_recording_manager_vad.h"
 #include "zsw_microphone_manager.h"
 #include "zsw_audio_codec.h"
 #include "events/zsw_voice_memo_event.h"
@@ -35,6 +36,17 @@ LOG_MODULE_REGISTER(zsw_recording_manager, CONFIG_ZSW_VOICE_MEMO_LOG_LEVEL);
 #define CODEC_THREAD_PRIO      K_PRIO_PREEMPT(5)
 #define MAX_OPUS_FRAME_BYTES   160
 #define OVERFLOW_LOG_INTERVAL_MS 1000
+#define FRAME_DURATION_MS      (CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES / 16)
+#define FRAME_BUDGET_US        (FRAME_DURATION_MS * 1000)
+/*
+ * Encoder tuning: step down when a frame takes more than 3/4 of its duration or half the
+ * ring buffer is waiting, at most once per TUNE_DOWN_HOLD_FRAMES so a backlog that is already
+ * draining does not walk the encoder all the way down. Step up after a window where all frames
+ * took less than 1/3 and the ring buffer stayed almost empty.
+ */
+#define TUNE_WINDOW_FRAMES     50
+#define TUNE_DOWN_HOLD_FRAMES  10
+#define TUNE_BITRATE_STEP      4000
 
 ZBUS_CHAN_DECLARE(voice_memo_recording_chan);
 
@@ -50,6 +62,13 @@ static struct k_spinlock pcm_ring_buf_lock;
 static uint32_t ring_buf_dropped_bytes;
 static uint32_t last_overflow_log_ms;
 
+static zsw_recording_stats_t stats;
+static uint64_t encode_total_us;
+static uint32_t window_frames;
+static uint32_t window_max_us;
+static uint32_t window_ring_peak;
+static uint32_t down_hold_frames;
+
 /* Codec thread */
 static K_THREAD_STACK_DEFINE(codec_stack, CODEC_THREAD_STACK);
 static struct k_thread codec_thread_data;
@@ -91,6 +110,7 @@ static void mic_data_callback(zsw_mic_event_t event, zsw_mic_event_data_t *data,
         uint32_t now = k_uptime_get_32();
         uint32_t used = ring_buf_size_get(&pcm_ring_buf);
         ring_buf_dropped_bytes += (pcm_bytes - written);
+        stats.dropped_bytes += (pcm_bytes - written);
         if ((now - last_overflow_log_ms) >= OVERFLOW_LOG_INTERVAL_MS) {
             LOG_WRN("PCM overflow: used=%u/%u dropped=%u bytes",
                     used, CODEC_RING_BUF_SIZE, ring_buf_dropped_bytes);
@@ -102,6 +122,141 @@ static void mic_data_callback(zsw_mic_event_t event, zsw_mic_event_data_t *data,
     k_sem_give(&codec_sem);
 }
 
+static void request_auto_stop(void)
+{
+    if (!auto_stop_pending) {
+        auto_stop_pending = true;
+        k_work_submit(&auto_stop_work);
+    }
+}
+
+static void reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    stats.frame_budget_us = FRAME_BUDGET_US;
+    stats.ring_size_bytes = CODEC_RING_BUF_SIZE;
+    stats.complexity = zsw_audio_codec_get_complexity();
+    stats.min_complexity = stats.complexity;
+    stats.bitrate = zsw_audio_codec_get_bitrate();
+    stats.min_bitrate = stats.bitrate;
+    encode_total_us = 0;
+    window_frames = 0;
+    window_max_us = 0;
+    window_ring_peak = 0;
+    down_hold_frames = 0;
+}
+
+static void update_stats(uint32_t encode_us, uint32_t ring_used)
+{
+    stats.frames++;
+    encode_total_us += encode_us;
+    stats.encode_avg_us = (uint32_t)(encode_total_us / stats.frames);
+    stats.encode_max_us = MAX(stats.encode_max_us, encode_us);
+    stats.ring_peak_bytes = MAX(stats.ring_peak_bytes, ring_used);
+    if (encode_us > FRAME_BUDGET_US) {
+        stats.late_frames++;
+    }
+}
+
+#ifdef CONFIG_ZSW_OPUS_ADAPTIVE
+/** Lower complexity first as that is what costs CPU, the bitrate when complexity is at 0. */
+static void tune_encoder_down(void)
+{
+    int complexity = zsw_audio_codec_get_complexity();
+    int32_t bitrate = zsw_audio_codec_get_bitrate();
+
+    if (complexity > 0) {
+        zsw_audio_codec_set_complexity(complexity - 1);
+    } else if (bitrate > CONFIG_ZSW_OPUS_MIN_BITRATE) {
+        zsw_audio_codec_set_bitrate(MAX(bitrate - TUNE_BITRATE_STEP, CONFIG_ZSW_OPUS_MIN_BITRATE));
+    }
+}
+
+/** Undo tune_encoder_down() one step, never above the configured values. */
+static void tune_encoder_up(void)
+{
+    int complexity = zsw_audio_codec_get_complexity();
+    int32_t bitrate = zsw_audio_codec_get_bitrate();
+
+    if (bitrate < CONFIG_ZSW_OPUS_BITRATE) {
+        zsw_audio_codec_set_bitrate(MIN(bitrate + TUNE_BITRATE_STEP, CONFIG_ZSW_OPUS_BITRATE));
+    } else if (complexity < CONFIG_ZSW_OPUS_COMPLEXITY) {
+        zsw_audio_codec_set_complexity(complexity + 1);
+    }
+}
+
+static void tune_encoder(uint32_t encode_us, uint32_t ring_used)
+{
+    window_frames++;
+    window_max_us = MAX(window_max_us, encode_us);
+    window_ring_peak = MAX(window_ring_peak, ring_used);
+    if (down_hold_frames > 0) {
+        down_hold_frames--;
+    }
+
+    if (encode_us > FRAME_BUDGET_US * 3 / 4 || ring_used > CODEC_RING_BUF_SIZE / 2) {
+        if (down_hold_frames > 0) {
+            return;
+        }
+        tune_encoder_down();
+        down_hold_frames = TUNE_DOWN_HOLD_FRAMES;
+    } else if (window_frames >= TUNE_WINDOW_FRAMES) {
+        if (window_max_us < FRAME_BUDGET_US / 3 && window_ring_peak < CODEC_RING_BUF_SIZE / 8) {
+            tune_encoder_up();
+        }
+    } else {
+        return;
+    }
+
+    // Any change needs a full window to show its effect before stepping up.
+    window_frames = 0;
+    window_max_us = 0;
+    window_ring_peak = 0;
+
+    if (zsw_audio_codec_get_complexity() != stats.complexity || zsw_audio_codec_get_bitrate() != stats.bitrate) {
+        stats.complexity = zsw_audio_codec_get_complexity();
+        stats.bitrate = zsw_audio_codec_get_bitrate();
+        stats.min_complexity = MIN(stats.min_complexity, stats.complexity);
+        stats.min_bitrate = MIN(stats.min_bitrate, stats.bitrate);
+        LOG_DBG("Encoder tuned: complexity=%u bitrate=%u (encode=%u us, ring=%u)",
+                stats.complexity, stats.bitrate, encode_us, ring_used);
+    }
+}
+#endif
+
+/**
+ * Encode a frame and append it to the file. Returns negative if the recording must stop.
+ * Only frames taken from the ring buffer with ring_used left behind feed the encoder tuning.
+ */
+static int encode_and_store(const int16_t *pcm_frame, uint8_t *opus_frame, size_t opus_frame_size,
+                            uint32_t ring_used, bool tune)
+{
+    uint32_t start_cycles = k_cycle_get_32();
+    int encoded = zsw_audio_codec_encode(pcm_frame,
+                                         CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES,
+                                         opus_frame, opus_frame_size);
+    uint32_t encode_us = k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles);
+
+    update_stats(encode_us, ring_used);
+#ifdef CONFIG_ZSW_OPUS_ADAPTIVE
+    if (tune) {
+        tune_encoder(encode_us, ring_used);
+    }
+#else
+    ARG_UNUSED(tune);
+#endif
+    if (encoded < 0) {
+        LOG_ERR("Opus encode error: %d", encoded);
+        return 0;
+    }
+    int ret = zsw_recording_manager_store_write_frame(opus_frame, encoded);
+    if (ret < 0) {
+        LOG_ERR("Store write error: %d, stopping recording", ret);
+        request_auto_stop();
+    }
+    return ret;
+}
+
 static void codec_thread_fn(void *p1, void *p2, void *p3)
 {
     ARG_UNUSED(p1);
@@ -110,6 +265,10 @@ static void codec_thread_fn(void *p1, void *p2, void *p3)
     int16_t pcm_frame[CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES];
     uint8_t opus_frame[MAX_OPUS_FRAME_BYTES];
     const size_t frame_bytes = CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES * sizeof(int16_t);
+    /* Last skipped frame, stored in front of the speech so its onset is not cut. */
+    int16_t preroll_frame[CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES];
+    bool has_preroll = false;
+    uint32_t silent_frames = 0;
     LOG_INF("Codec thread started");
     while (codec_thread_running) {
         k_sem_take(&codec_sem, K_MSEC(100));
@@ -118,30 +277,38 @@ static void codec_thread_fn(void *p1, void *p2, void *p3)
         }
         while (true) {
             uint32_t got;
+            uint32_t ring_used;
             k_spinlock_key_t key = k_spin_lock(&pcm_ring_buf_lock);
             if (ring_buf_size_get(&pcm_ring_buf) < frame_bytes) {
                 k_spin_unlock(&pcm_ring_buf_lock, key);
                 break;
             }
             got = ring_buf_get(&pcm_ring_buf, (uint8_t *)pcm_frame, frame_bytes);
+            ring_used = ring_buf_size_get(&pcm_ring_buf);
             k_spin_unlock(&pcm_ring_buf_lock, key);
             if (got < frame_bytes) {
                 break;
             }
-            int encoded = zsw_audio_codec_encode(pcm_frame,
-                                                 CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES,
-                                                 opus_frame, sizeof(opus_frame));
-            if (encoded < 0) {
-                LOG_ERR("Opus encode error: %d", encoded);
+            bool speech = zsw_recording_manager_vad_is_speech(pcm_frame, CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES);
+            silent_frames = speech ? 0 : silent_frames + 1;
+            if (CONFIG_ZSW_VOICE_MEMO_SILENCE_AUTO_STOP_S > 0 && !auto_stop_pending &&
+                silent_frames * FRAME_DURATION_MS >= CONFIG_ZSW_VOICE_MEMO_SILENCE_AUTO_STOP_S * 1000) {
+                LOG_INF("Voice memo: silence auto-stop");
+                request_auto_stop();
+            }
+            if (IS_ENABLED(CONFIG_ZSW_VOICE_MEMO_TRIM_SILENCE) && !speech) {
+                memcpy(preroll_frame, pcm_frame, frame_bytes);
+                has_preroll = true;
                 continue;
             }
-            int ret = zsw_recording_manager_store_write_frame(opus_frame, encoded);
-            if (ret < 0) {
-                LOG_ERR("Store write error: %d, stopping recording", ret);
-                if (!auto_stop_pending) {
-                    auto_stop_pending = true;
-                    k_work_submit(&auto_stop_work);
+            if (has_preroll) {
+                has_preroll = false;
+                // Held back earlier, the ring level belongs to the frame below.
+                if (encode_and_store(preroll_frame, opus_frame, sizeof(opus_frame), ring_used, false) < 0) {
+                    break;
                 }
+            }
+            if (encode_and_store(pcm_frame, opus_frame, sizeof(opus_frame), ring_used, true) < 0) {
                 break;
             }
         }
@@ -149,16 +316,14 @@ static void codec_thread_fn(void *p1, void *p2, void *p3)
         if (!auto_stop_pending &&
             elapsed >= (uint32_t)ZSW_RECORDING_MAX_DURATION_S * 1000) {
             LOG_INF("Voice memo: max duration reached");
-            auto_stop_pending = true;
-            k_work_submit(&auto_stop_work);
+            request_auto_stop();
         }
         uint32_t free_bytes = 0;
         if (!auto_stop_pending && zsw_recording_manager_store_get_free_space(&free_bytes) == 0) {
             if (free_bytes < (uint32_t)ZSW_RECORDING_MIN_FREE_SPACE_KB * 1024) {
                 LOG_WRN("Voice memo: low space auto-stop, free=%u KB",
                         free_bytes / 1024);
-                auto_stop_pending = true;
-                k_work_submit(&auto_stop_work);
+                request_auto_stop();
             }
         }
     }
@@ -190,6 +355,12 @@ int zsw_recording_manager_start(void)
         return -EALREADY;
     }
 
+#ifdef CONFIG_ZSW_VOICE_MEMO_PLAYBACK
+    if (zsw_recording_manager_is_playing()) {
+        return -EBUSY;
+    }
+#endif
+
     if (!pcm_ring_buf_data) {
         pcm_ring_buf_data = k_malloc(CODEC_RING_BUF_SIZE);
         if (!pcm_ring_buf_data) {
@@ -221,6 +392,8 @@ int zsw_recording_manager_start(void)
     }
 
     ring_buf_reset(&pcm_ring_buf);
+    zsw_recording_manager_vad_reset();
+    reset_stats();
     codec_thread_running = true;
     is_recording = true;
     auto_stop_pending = false;
@@ -276,6 +449,11 @@ static void shutdown_pipeline(void)
     }
     auto_stop_pending = false;
     zsw_audio_codec_deinit();
+
+    LOG_INF("Encoder: frames=%u avg=%u us max=%u us late=%u ring_peak=%u dropped=%u "
+            "min_complexity=%u min_bitrate=%u",
+            stats.frames, stats.encode_avg_us, stats.encode_max_us, stats.late_frames,
+            stats.ring_peak_bytes, stats.dropped_bytes, stats.min_complexity, stats.min_bitrate);
 }
 
 int zsw_recording_manager_stop(void)
@@ -299,7 +477,7 @@ int zsw_recording_manager_stop(void)
         saved_filename[0] = '\0';
     }
 
-    int store_ret = zsw_recording_manager_store_stop_recording(&duration_ms, &size_bytes);
+    int store_ret = zsw_recording_manager_store_stop_recording(stats.min_bitrate, &duration_ms, &size_bytes);
     if (store_ret < 0) {
         LOG_ERR("Store stop failed: %d", store_ret);
     }
@@ -359,9 +537,14 @@ uint32_t zsw_recording_manager_get_elapsed_ms(void)
     return k_uptime_get_32() - recording_start_time;
 }
 
-int zsw_recording_manager_list(zsw_recording_entry_t *entries, size_t max_entries)
+void zsw_recording_manager_get_stats(zsw_recording_stats_t *stats_out)
+{
+    *stats_out = stats;
+}
+
+int zsw_recording_manager_list(zsw_recording_entry_t *entries, size_t offset, size_t max_entries)
 {
-    return zsw_recording_manager_store_list(entries, max_entries);
+    return zsw_recording_manager_store_list(entries, offset, max_entries);
 }
 
 int zsw_recording_manager_delete(const char *filename)
@@ -32,6 +32,22 @@ typedef struct {
     uint32_t timestamp;
 } zsw_recording_result_t;
 
+/** @brief Encoder timing of the current or last recording. */
+typedef struct {
+    uint32_t frames;            /**< Frames encoded. */
+    uint32_t encode_avg_us;
+    uint32_t encode_max_us;
+    uint32_t frame_budget_us;   /**< Duration of a frame, encoding must stay below it. */
+    uint32_t late_frames;       /**< Frames that took longer than the budget to encode. */
+    uint32_t ring_peak_bytes;   /**< Most PCM waiting to be encoded. */
+    uint32_t ring_size_bytes;
+    uint32_t dropped_bytes;     /**< PCM lost because the buffer was full. */
+    uint8_t complexity;         /**< Current Opus complexity. */
+    uint8_t min_complexity;     /**< Lowest Opus complexity used. */
+    uint32_t bitrate;           /**< Current Opus bitrate. */
+    uint32_t min_bitrate;       /**< Lowest Opus bitrate used. */
+} zsw_recording_stats_t;
+
 /** @brief Initialize recording manager and storage. Call once at startup. */
 int zsw_recording_manager_init(void);
 
@@ -53,8 +69,18 @@ uint8_t zsw_recording_manager_get_audio_level(void);
 /** @brief Get elapsed recording time in milliseconds. Returns 0 if not recording. */
 uint32_t zsw_recording_manager_get_elapsed_ms(void);
 
-/** @brief List stored recordings. Returns count on success, negative on error. */
-int zsw_recording_manager_list(zsw_recording_entry_t *entries, size_t max_entries);
+/** @brief Get the encoder timing of the current or last recording. */
+void zsw_recording_manager_get_stats(zsw_recording_stats_t *stats);
+
+/**
+ * @brief List a page of stored recordings, oldest first.
+ *
+ * @param entries      Filled in with the recordings.
+ * @param offset       Index of the first recording, see zsw_recording_manager_get_count().
+ * @param max_entries  Size of entries.
+ * @return Number of entries filled in on success, negative on error.
+ */
+int zsw_recording_manager_list(zsw_recording_entry_t *entries, size_t offset, size_t max_entries);
 
 /** @brief Delete a recording by filename. */
 int zsw_recording_manager_delete(const char *filename);
@@ -64,3 +90,30 @@ int zsw_recording_manager_get_free_space(uint32_t *free_bytes);
 
 /** @brief Get number of stored recordings. */
 int zsw_recording_manager_get_count(void);
+
+/**
+ * @brief Play a recording on the speaker from a position.
+ *
+ * Seeks with the index stored at the end of the recording, so playback starts right away from
+ * any position. Not possible while recording.
+ *
+ * @param filename  Recording name without extension.
+ * @param start_ms  Position to start from.
+ * @return 0 on success, -EBUSY if recording or already playing, -ERANGE if start_ms is at or
+ *         past the end, negative on other errors.
+ */
+int zsw_recording_manager_play(const char *filename, uint32_t start_ms);
+
+/**
+ * @brief Stop playback started with zsw_recording_manager_play().
+ *
+ * @return 0 on success, -EAGAIN if the speaker did not stop in time. The stop is then retried
+ *         in the background.
+ */
+int zsw_recording_manager_stop_playback(void);
+
+/** @brief Check if a recording is being played. */
+bool zsw_recording_manager_is_playing(void);
+
+/** @brief Get the playback position in the recording in milliseconds. */
+uint32_t zsw_recording_manager_get_playback_ms(void);
@@ -0,0 +1,331 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2026 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * A decode thread reads frames from the recording and decodes them straight to the speaker rate,
+ * Opus resamples internally. The speaker streaming thread has a small stack and must never wait
+ * on flash, so decoded frames are handed over through a short queue and the fill callback only
+ * copies them out as stereo. The decode stack and the queue are only allocated while playing.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+#include "zsw_recording_manager.h"
+#include "zsw_recording_manager_store.h"
+#include "zsw_speaker_manager.h"
+#include "zsw_audio_codec.h"
+
+LOG_MODULE_REGISTER(zsw_recording_manager_playback, CONFIG_ZSW_VOICE_MEMO_LOG_LEVEL);
+
+#define PLAYBACK_SAMPLE_RATE   48000
+#define PCM_FRAME_SAMPLES      (CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES * (PLAYBACK_SAMPLE_RATE / 16000))
+#define PCM_QUEUE_FRAMES       4
+// Playback starts when this many frames are decoded, or the recording ended before that.
+#define PRIME_FRAMES           2
+#define PRIME_TIMEOUT_MS       200
+#define MAX_OPUS_FRAME_BYTES   500
+// Opus decoding needs less stack than encoding, but still several KB on ARM.
+#define DECODE_THREAD_STACK    8192
+#define DECODE_THREAD_PRIO     K_PRIO_PREEMPT(6)
+// Retry a stop that timed out waiting for the speaker thread.
+#define STOP_RETRY_MS          100
+
+struct pcm_frame {
+    uint16_t samples;
+    int16_t pcm[PCM_FRAME_SAMPLES];
+};
+
+/* The frame being played is kept after the queue buffer, in the same allocation. */
+struct playback_buffers {
+    struct pcm_frame queue[PCM_QUEUE_FRAMES];
+    struct pcm_frame current;
+};
+
+static struct k_msgq playback_pcm_queue;
+static struct playback_buffers *buffers;
+
+static K_MUTEX_DEFINE(playback_mutex);
+static K_SEM_DEFINE(playback_primed_sem, 0, 1);
+static k_thread_stack_t *decode_stack;
+static struct k_thread decode_thread_data;
+
+static void playback_done_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(playback_done_work, playback_done_work_fn);
+
+static zsw_recording_reader_t reader;
+static bool playing;
+/* Counts playbacks, so a done event of a stopped playback does not stop the next one. */
+static uint32_t playback_generation;
+static atomic_t done_generation;
+static volatile bool decode_done;
+static volatile bool stop_requested;
+static uint32_t start_position_ms;
+static uint32_t played_samples;
+
+/* Only used from the speaker streaming thread. */
+static size_t current_pos;
+
+static void decode_thread_fn(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    uint8_t opus_frame[MAX_OPUS_FRAME_BYTES];
+    struct pcm_frame frame;
+    uint32_t decoded_frames = 0;
+
+    while (!stop_requested) {
+        int len = zsw_recording_manager_store_reader_read_frame(&reader, opus_frame, sizeof(opus_frame));
+        if (len <= 0) {
+            if (len < 0) {
+                LOG_ERR("Failed to read frame %u: %d", reader.frame, len);
+            }
+            break;
+        }
+
+        int samples = zsw_audio_codec_decode(opus_frame, len, frame.pcm, ARRAY_SIZE(frame.pcm));
+        if (samples < 0) {
+            break;
+        }
+        frame.samples = samples;
+
+        /* Blocks while the queue is full, a purge on stop makes it return. */
+        while (!stop_requested && k_msgq_put(&playback_pcm_queue, &frame, K_MSEC(100)) != 0) {
+        }
+
+        if (++decoded_frames == PRIME_FRAMES) {
+            k_sem_give(&playback_primed_sem);
+        }
+    }
+
+    decode_done = true;
+    k_sem_give(&playback_primed_sem);
+}
+
+static uint32_t playback_fill_cb(int16_t *buf, uint32_t num_frames)
+{
+    struct pcm_frame *current_frame = &buffers->current;
+    uint32_t written = 0;
+
+    while (written < num_frames) {
+        if (current_pos == current_frame->samples) {
+            /* Checked before the queue, so an empty queue after the last frame is the end. */
+            bool done = decode_done;
+            if (k_msgq_get(&playback_pcm_queue, current_frame, K_NO_WAIT) != 0) {
+                if (done) {
+                    return written;
+                }
+                /* Decoding fell behind, play silence rather than stopping. */
+                memset(&buf[written * 2], 0, (num_frames - written) * 2 * sizeof(int16_t));
+                return num_frames;
+            }
+            current_pos = 0;
+        }
+
+        size_t num = MIN(num_frames - written, current_frame->samples - current_pos);
+        for (size_t i = 0; i < num; i++) {
+            buf[(written + i) * 2] = current_frame->pcm[current_pos + i];
+            buf[(written + i) * 2 + 1] = current_frame->pcm[current_pos + i];
+        }
+        written += num;
+        current_pos += num;
+        played_samples += num;
+    }
+
+    return written;
+}
+
+static void playback_event_cb(zsw_speaker_event_t event, void *user_data)
+{
+    if (event == ZSW_SPEAKER_EVENT_PLAYBACK_ERROR) {
+        LOG_ERR("Speaker error during playback");
+    }
+    /* Called from the speaker thread, which must not wait for the decode thread. */
+    atomic_set(&done_generation, (atomic_val_t)(uintptr_t)user_data);
+    k_work_schedule(&playback_done_work, K_NO_WAIT);
+}
+
+static void free_buffers(void)
+{
+    if (decode_stack) {
+        k_thread_stack_free(decode_stack);
+        decode_stack = NULL;
+    }
+    k_free(buffers);
+    buffers = NULL;
+}
+
+static int alloc_buffers(void)
+{
+    buffers = k_malloc(sizeof(*buffers));
+    decode_stack = k_thread_stack_alloc(DECODE_THREAD_STACK, 0);
+    if (!buffers || !decode_stack) {
+        free_buffers();
+        return -ENOMEM;
+    }
+
+    k_msgq_init(&playback_pcm_queue, (char *)buffers->queue, sizeof(struct pcm_frame), PCM_QUEUE_FRAMES);
+    buffers->current.samples = 0;
+    return 0;
+}
+
+static void stop_decoding(void)
+{
+    stop_requested = true;
+    k_msgq_purge(&playback_pcm_queue);
+    k_thread_join(&decode_thread_data, K_FOREVER);
+    k_msgq_purge(&playback_pcm_queue);
+
+    zsw_recording_manager_store_reader_close(&reader);
+    zsw_audio_codec_decoder_deinit();
+    free_buffers();
+}
+
+/* Called with the playback mutex held. */
+static int stop_playback(void)
+{
+    int ret;
+
+    if (!playing) {
+        return 0;
+    }
+
+    ret = zsw_speaker_manager_stop();
+    if (ret < 0) {
+        /* The speaker thread may still read the buffers, keep them until a retry stops it. */
+        LOG_ERR("Speaker did not stop: %d", ret);
+        atomic_set(&done_generation, playback_generation);
+        k_work_schedule(&playback_done_work, K_MSEC(STOP_RETRY_MS));
+        return ret;
+    }
+
+    stop_decoding();
+    playing = false;
+
+    LOG_INF("Playback stopped at %u ms", zsw_recording_manager_get_playback_ms());
+
+    return 0;
+}
+
+static void playback_done_work_fn(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    k_mutex_lock(&playback_mutex, K_FOREVER);
+    if ((uint32_t)atomic_get(&done_generation) == playback_generation) {
+        (void)stop_playback();
+    }
+    k_mutex_unlock(&playback_mutex);
+}
+
+int zsw_recording_manager_play(const char *filename, uint32_t start_ms)
+{
+    int ret;
+
+    if (zsw_recording_manager_is_recording()) {
+        return -EBUSY;
+    }
+
+    k_mutex_lock(&playback_mutex, K_FOREVER);
+    if (playing) {
+        k_mutex_unlock(&playback_mutex);
+        return -EBUSY;
+    }
+
+    ret = zsw_recording_manager_store_reader_open(&reader, filename);
+    if (ret < 0) {
+        LOG_ERR("Failed to open %s: %d", filename, ret);
+        k_mutex_unlock(&playback_mutex);
+        return ret;
+    }
+
+    ret = zsw_recording_manager_store_reader_seek(&reader, start_ms);
+    if (ret == 0 && reader.frame >= reader.header.total_frames) {
+        ret = -ERANGE;
+    }
+    if (ret == 0) {
+        ret = alloc_buffers();
+    }
+    if (ret == 0) {
+        ret = zsw_audio_codec_decoder_init(PLAYBACK_SAMPLE_RATE);
+        if (ret < 0) {
+            free_buffers();
+        }
+    }
+    if (ret < 0) {
+        LOG_ERR("Failed to prepare playback of %s: %d", filename, ret);
+        zsw_recording_manager_store_reader_close(&reader);
+        k_mutex_unlock(&playback_mutex);
+        return ret;
+    }
+
+    start_position_ms = zsw_recording_manager_store_reader_get_position_ms(&reader);
+    played_samples = 0;
+    current_pos = 0;
+    decode_done = false;
+    stop_requested = false;
+    k_sem_reset(&playback_primed_sem);
+
+    k_thread_create(&decode_thread_data, decode_stack, DECODE_THREAD_STACK,
+                    decode_thread_fn, NULL, NULL, NULL, DECODE_THREAD_PRIO, 0, K_NO_WAIT);
+    k_thread_name_set(&decode_thread_data, "voice_memo_play");
+
+    k_sem_take(&playback_primed_sem, K_MSEC(PRIME_TIMEOUT_MS));
+
+    zsw_speaker_config_t config = {
+        .source = ZSW_SPEAKER_SOURCE_CALLBACK,
+        .callback.fill_cb = playback_fill_cb,
+    };
+    playback_generation++;
+    ret = zsw_speaker_manager_start(&config, playback_event_cb, (void *)(uintptr_t)playback_generation);
+    if (ret < 0) {
+        LOG_ERR("Failed to start speaker: %d", ret);
+        stop_decoding();
+        k_mutex_unlock(&playback_mutex);
+        return ret;
+    }
+
+    playing = true;
+    LOG_INF("Playing %s from %u ms", filename, start_position_ms);
+    k_mutex_unlock(&playback_mutex);
+
+    return 0;
+}
+
+int zsw_recording_manager_stop_playback(void)
+{
+    int ret;
+
+    k_mutex_lock(&playback_mutex, K_FOREVER);
+    ret = stop_playback();
+    k_mutex_unlock(&playback_mutex);
+
+    return ret;
+}
+
+bool zsw_recording_manager_is_playing(void)
+{
+    return playing;
+}
+
+uint32_t zsw_recording_manager_get_playback_ms(void)
+{
+    return start_position_ms + played_samples / (PLAYBACK_SAMPLE_RATE / 1000);
+}
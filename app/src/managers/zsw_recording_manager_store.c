@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <time.h>
 
+#include "zsw_recording_manager.h"
 #include "zsw_recording_manager_store.h"
 #include "zsw_clock.h"
 #include "filesystem/zsw_filesystem.h"
@@ -31,6 +32,44 @@ LOG_MODULE_REGISTER(zsw_recording_manager_store, CONFIG_ZSW_VOICE_MEMO_LOG_LEVEL
 #define FLASH_WRITE_BUF_SIZE   ZSW_USER_LFS_CACHE_SIZE
 #define MAX_PATH_LEN           64
 #define COUNTER_FILE_PATH      VOICE_MEMO_DIR "/.counter"
+#define CATALOG_FILE_PATH      VOICE_MEMO_DIR "/.catalog"
+#define CATALOG_MAGIC          "ZSWC"
+#define CATALOG_VERSION        1
+/* Entries read at a time when the whole catalog is walked. */
+#define CATALOG_CHUNK_ENTRIES  8
+#define NOT_FINALIZED          0xFFFFFFFF
+/* Largest Opus frame accepted when walking the frames of a recording. */
+#define MAX_FRAME_BYTES        500
+#define INDEX_INTERVAL_FRAMES  MAX(CONFIG_ZSW_VOICE_MEMO_SEEK_INDEX_INTERVAL_MS * 16 / \
+                                   CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES, 1)
+/* Enough for the longest recording, a longer repaired file gets no entries past it. */
+#define INDEX_MAX_ENTRIES      (ZSW_RECORDING_MAX_DURATION_S * 1000 / CONFIG_ZSW_VOICE_MEMO_SEEK_INDEX_INTERVAL_MS + 1)
+
+/*
+ * The catalog is a header followed by one zsw_recording_entry_t per recording, oldest first, so
+ * listing a page or counting is a single read. The number of entries follows from the file size,
+ * so appending does not rewrite the header at the start of the file. Every change is done within one open and close of
+ * the file, LittleFS commits a file on close, so a power loss leaves either the old or the new
+ * catalog. A recording being written is in the catalog with duration NOT_FINALIZED, the same
+ * marker as in the file header, and is repaired on the next init.
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t  magic[4];
+    uint16_t version;
+    uint16_t entry_size;
+    uint32_t reserved[2];
+}
+catalog_header_t;
+
+_Static_assert(sizeof(zsw_recording_entry_t) == VOICE_MEMO_MAX_FILENAME + 3 * sizeof(uint32_t),
+               "zsw_recording_entry_t is stored as is in the catalog and must not have padding");
+
+static K_MUTEX_DEFINE(catalog_mutex);
+static bool catalog_loaded;
+static uint32_t catalog_count;
+static uint32_t current_index;
+
 static struct fs_file_t current_file;
 static bool file_open;
 static bool recording_active;
@@ -38,6 +77,14 @@ static uint32_t frame_count;
 static char current_filepath[MAX_PATH_LEN];
 static char current_filename[VOICE_MEMO_MAX_FILENAME];
 
+/*
+ * Offsets of every INDEX_INTERVAL_FRAMES frame of the recording being written or repaired, from
+ * the system heap only while there is one.
+ */
+static uint32_t *index_entries;
+static uint32_t index_count;
+static uint32_t write_offset;
+
 /* Batched flash write buffer */
 static uint8_t write_buf[FLASH_WRITE_BUF_SIZE];
 static size_t write_buf_pos;
@@ -86,6 +133,66 @@ static int buffered_write(const void *data, size_t len)
     return 0;
 }
 
+static void index_free(void)
+{
+    k_free(index_entries);
+    index_entries = NULL;
+    index_count = 0;
+}
+
+/** Without memory for the index the recording is written without one. */
+static void index_reset(void)
+{
+    index_free();
+    index_entries = k_malloc(INDEX_MAX_ENTRIES * sizeof(index_entries[0]));
+    if (index_entries == NULL) {
+        LOG_WRN("No memory for the seek index");
+    }
+}
+
+/** Called for every frame before it is written, offset is where it will start. */
+static void index_add_frame(uint32_t frame, uint32_t offset)
+{
+    if (index_entries && frame % INDEX_INTERVAL_FRAMES == 0 && index_count < INDEX_MAX_ENTRIES) {
+        index_entries[index_count++] = offset;
+    }
+}
+
+/** Write the seek index at offset, right after the last frame, and point the header to it. */
+static int index_write(struct fs_file_t *fp, uint32_t offset, zsw_recording_manager_store_header_t *hdr)
+{
+    zsw_recording_manager_store_index_header_t index_hdr = {
+        .end_marker = 0,
+        .interval_frames = INDEX_INTERVAL_FRAMES,
+        .count = index_count,
+    };
+    ssize_t n;
+    int ret;
+
+    if (index_entries == NULL) {
+        return -ENOMEM;
+    }
+
+    ret = fs_seek(fp, offset, FS_SEEK_SET);
+    if (ret < 0) {
+        return ret;
+    }
+
+    n = fs_write(fp, &index_hdr, sizeof(index_hdr));
+    if (n != sizeof(index_hdr)) {
+        return n < 0 ? (int)n : -EIO;
+    }
+
+    n = fs_write(fp, index_entries, index_count * sizeof(index_entries[0]));
+    if (n != (ssize_t)(index_count * sizeof(index_entries[0]))) {
+        return n < 0 ? (int)n : -EIO;
+    }
+
+    hdr->version = VOICE_MEMO_HEADER_VERSION;
+    hdr->index_offset = offset;
+    return 0;
+}
+
 static bool is_time_valid(void)
 {
     zsw_timeval_t ztm;
@@ -164,17 +271,33 @@ static void generate_filename(char *buf, size_t buflen)
     }
 }
 
+static void fill_entry(const char *filepath, const zsw_recording_manager_store_header_t *hdr,
+                       zsw_recording_entry_t *entry)
+{
+    struct fs_dirent stat_entry;
+
+    entry->timestamp = hdr->timestamp;
+    entry->duration_ms = hdr->duration_ms;
+    entry->size_bytes = 0;
+    if (fs_stat(filepath, &stat_entry) == 0) {
+        entry->size_bytes = stat_entry.size;
+    }
+}
+
 /**
  * Attempt to recover a recording whose header was never finalized (crash/power-loss).
  *
  * A "dirty" file has total_frames == 0xFFFFFFFF, meaning stop_recording() never ran.
  * Recovery walks the frame chain (each frame: uint16_t length prefix + payload) and counts
- * valid frames until the first corrupted or truncated entry. The header is then patched
- * with the recovered frame count and computed duration so the file becomes playable.
+ * valid frames until the first corrupted or truncated entry. The seek index is written after
+ * the last valid frame and the header is patched with the recovered frame count and computed
+ * duration so the file becomes playable.
  *
  * Files that are too small, have bad magic, or contain zero valid frames are deleted.
+ * For a file that is kept, finalized or repaired, the catalog fields of entry are filled in.
+ * Returns -ENOENT if there is no file, or it was deleted.
  */
-static int repair_dirty_file(const char *filepath)
+static int repair_dirty_file(const char *filepath, zsw_recording_entry_t *entry)
 {
     struct fs_file_t fp;
     zsw_recording_manager_store_header_t hdr;
@@ -191,29 +314,32 @@ static int repair_dirty_file(const char *filepath)
         LOG_WRN("Dirty file too small, deleting: %s", filepath);
         fs_close(&fp);
         fs_unlink(filepath);
-        return 0;
+        return -ENOENT;
     }
 
     if (memcmp(hdr.magic, VOICE_MEMO_MAGIC, 4) != 0) {
         LOG_WRN("Bad magic in dirty file, deleting: %s", filepath);
         fs_close(&fp);
         fs_unlink(filepath);
-        return 0;
+        return -ENOENT;
     }
 
-    if (hdr.total_frames != 0xFFFFFFFF) {
+    if (hdr.total_frames != NOT_FINALIZED) {
         fs_close(&fp);
+        fill_entry(filepath, &hdr, entry);
         return 0;
     }
 
     uint32_t counted_frames = 0;
+    off_t frames_end = sizeof(hdr);
+    index_reset();
     while (true) {
         uint16_t frame_len;
         ssize_t n = fs_read(&fp, &frame_len, sizeof(frame_len));
         if (n < (ssize_t)sizeof(frame_len)) {
             break;
         }
-        if (frame_len == 0 || frame_len > 500) {
+        if (frame_len == 0 || frame_len > MAX_FRAME_BYTES) {
             break;
         }
         off_t pos = fs_tell(&fp);
@@ -223,19 +349,33 @@ static int repair_dirty_file(const char *filepath)
         if (fs_tell(&fp) != pos + frame_len) {
             break;
         }
+        index_add_frame(counted_frames, frames_end);
+        frames_end = pos + frame_len;
         counted_frames++;
     }
 
     if (counted_frames == 0) {
+        index_free();
         LOG_WRN("No valid frames in dirty file, deleting: %s", filepath);
         fs_close(&fp);
         fs_unlink(filepath);
-        return 0;
+        return -ENOENT;
     }
 
     hdr.total_frames = counted_frames;
     hdr.duration_ms = (uint32_t)((uint64_t)counted_frames * hdr.frame_size * 1000 / hdr.sample_rate);
 
+    /* Without an index the recording can still be played, so only warn. */
+    ret = index_write(&fp, frames_end, &hdr);
+    index_free();
+    if (ret == 0) {
+        ret = fs_truncate(&fp, fs_tell(&fp));
+    }
+    if (ret < 0) {
+        LOG_WRN("Repair index write failed: %d", ret);
+        hdr.index_offset = 0;
+    }
+
     ret = fs_seek(&fp, 0, FS_SEEK_SET);
     if (ret < 0) {
         LOG_ERR("Repair seek failed: %d", ret);
@@ -251,49 +391,397 @@ static int repair_dirty_file(const char *filepath)
     }
 
     fs_close(&fp);
+    fill_entry(filepath, &hdr, entry);
 
     LOG_INF("Repaired dirty recording: %s, frames=%u, duration_ms=%u",
             filepath, counted_frames, hdr.duration_ms);
     return 0;
 }
 
-int zsw_recording_manager_store_init(void)
+/** Copy the name of a recording file without extension, returns false if it is not a recording. */
+static bool filename_from_entry(const char *name, char *filename)
+{
+    const char *ext = strstr(name, ".zsw_opus");
+    size_t name_len;
+
+    if (name[0] == '.' || ext == NULL) {
+        return false;
+    }
+
+    name_len = MIN(ext - name, VOICE_MEMO_MAX_FILENAME - 1);
+    memcpy(filename, name, name_len);
+    filename[name_len] = '\0';
+    return true;
+}
+
+static void make_filepath(char *path, size_t len, const char *filename)
 {
+    snprintf(path, len, "%s/%s.zsw_opus", VOICE_MEMO_DIR, filename);
+}
+
+static off_t catalog_offset(uint32_t index)
+{
+    return sizeof(catalog_header_t) + (off_t)index * sizeof(zsw_recording_entry_t);
+}
+
+static int catalog_open(struct fs_file_t *fp, uint32_t *count)
+{
+    catalog_header_t hdr;
     int ret;
-    struct fs_dir_t dirp;
-    struct fs_dirent entry;
 
-    fs_dir_t_init(&dirp);
+    fs_file_t_init(fp);
+    ret = fs_open(fp, CATALOG_FILE_PATH, FS_O_RDWR);
+    if (ret < 0) {
+        return ret;
+    }
 
-    ret = fs_mkdir(VOICE_MEMO_DIR);
-    if (ret < 0 && ret != -EEXIST) {
-        LOG_ERR("Failed to create recordings dir: %d", ret);
+    if (fs_read(fp, &hdr, sizeof(hdr)) != sizeof(hdr) ||
+        memcmp(hdr.magic, CATALOG_MAGIC, 4) != 0 ||
+        hdr.version != CATALOG_VERSION ||
+        hdr.entry_size != sizeof(zsw_recording_entry_t)) {
+        fs_close(fp);
+        return -EBADMSG;
+    }
+
+    ret = fs_seek(fp, 0, FS_SEEK_END);
+    off_t size = ret < 0 ? ret : fs_tell(fp);
+    if (size < 0 || (size - sizeof(hdr)) % sizeof(zsw_recording_entry_t) != 0) {
+        fs_close(fp);
+        return size < 0 ? (int)size : -EBADMSG;
+    }
+
+    *count = (size - sizeof(hdr)) / sizeof(zsw_recording_entry_t);
+    return 0;
+}
+
+static int catalog_write_header(struct fs_file_t *fp)
+{
+    catalog_header_t hdr = {
+        .version = CATALOG_VERSION,
+        .entry_size = sizeof(zsw_recording_entry_t),
+    };
+    memcpy(hdr.magic, CATALOG_MAGIC, 4);
+
+    int ret = fs_seek(fp, 0, FS_SEEK_SET);
+    if (ret < 0) {
         return ret;
     }
+    ssize_t n = fs_write(fp, &hdr, sizeof(hdr));
+    return n == sizeof(hdr) ? 0 : (n < 0 ? (int)n : -EIO);
+}
 
-    ret = fs_opendir(&dirp, VOICE_MEMO_DIR);
+static int catalog_write_entries(struct fs_file_t *fp, uint32_t index, const zsw_recording_entry_t *entries,
+                                 size_t num)
+{
+    int ret = fs_seek(fp, catalog_offset(index), FS_SEEK_SET);
     if (ret < 0) {
-        LOG_ERR("Failed to open recordings dir: %d", ret);
         return ret;
     }
+    ssize_t n = fs_write(fp, entries, num * sizeof(*entries));
+    return n == (ssize_t)(num * sizeof(*entries)) ? 0 : (n < 0 ? (int)n : -EIO);
+}
 
-    while (fs_readdir(&dirp, &entry) == 0 && entry.name[0] != '\0') {
+/** Returns the number of entries read. */
+static int catalog_read_entries(struct fs_file_t *fp, uint32_t index, zsw_recording_entry_t *entries, size_t num)
+{
+    int ret = fs_seek(fp, catalog_offset(index), FS_SEEK_SET);
+    if (ret < 0) {
+        return ret;
+    }
+    ssize_t n = fs_read(fp, entries, num * sizeof(*entries));
+    return n < 0 ? (int)n : (int)(n / sizeof(*entries));
+}
+
+/** Close the catalog, which commits the changes. */
+static int catalog_commit(struct fs_file_t *fp, int ret)
+{
+    int close_ret = fs_close(fp);
+    return ret < 0 ? ret : close_ret;
+}
+
+static int catalog_append(const zsw_recording_entry_t *entry, uint32_t *index)
+{
+    struct fs_file_t fp;
+    uint32_t count;
+    int ret = catalog_open(&fp, &count);
+    if (ret < 0) {
+        return ret;
+    }
+
+    ret = catalog_commit(&fp, catalog_write_entries(&fp, count, entry, 1));
+    if (ret == 0) {
+        *index = count;
+        catalog_count = count + 1;
+    }
+    return ret;
+}
+
+/**
+ * Index of the entry for filename, newest first as the one looked for is usually the last one
+ * recorded. chunk is scratch space of CATALOG_CHUNK_ENTRIES entries.
+ */
+static int64_t catalog_find(struct fs_file_t *fp, uint32_t count, const char *filename,
+                            zsw_recording_entry_t *chunk)
+{
+    for (uint32_t end = count; end > 0;) {
+        uint32_t start = end > CATALOG_CHUNK_ENTRIES ? end - CATALOG_CHUNK_ENTRIES : 0;
+        if (catalog_read_entries(fp, start, chunk, end - start) != (int)(end - start)) {
+            return -EIO;
+        }
+        for (uint32_t i = end - start; i > 0; i--) {
+            if (strncmp(chunk[i - 1].filename, filename, VOICE_MEMO_MAX_FILENAME) == 0) {
+                return start + i - 1;
+            }
+        }
+        end = start;
+    }
+
+    return -ENOENT;
+}
+
+/** index is a hint, older entries may have been removed since it was taken. */
+static int catalog_update(uint32_t index, const zsw_recording_entry_t *entry)
+{
+    struct fs_file_t fp;
+    zsw_recording_entry_t chunk[CATALOG_CHUNK_ENTRIES];
+    uint32_t count;
+    int64_t found = index;
+    int ret = catalog_open(&fp, &count);
+    if (ret < 0) {
+        return ret;
+    }
+
+    if (index >= count || catalog_read_entries(&fp, index, chunk, 1) != 1 ||
+        strncmp(chunk[0].filename, entry->filename, VOICE_MEMO_MAX_FILENAME) != 0) {
+        found = catalog_find(&fp, count, entry->filename, chunk);
+    }
+    if (found < 0) {
+        fs_close(&fp);
+        return (int)found;
+    }
+
+    return catalog_commit(&fp, catalog_write_entries(&fp, found, entry, 1));
+}
+
+static int catalog_remove(const char *filename)
+{
+    struct fs_file_t fp;
+    zsw_recording_entry_t chunk[CATALOG_CHUNK_ENTRIES];
+    uint32_t count;
+    int64_t found;
+    int ret = catalog_open(&fp, &count);
+    if (ret < 0) {
+        return ret;
+    }
+
+    found = catalog_find(&fp, count, filename, chunk);
+    if (found < 0) {
+        fs_close(&fp);
+        return (int)found;
+    }
+
+    /* Move the newer entries down over the removed one. */
+    for (uint32_t from = found + 1; from < count && ret == 0;) {
+        uint32_t num = MIN(count - from, CATALOG_CHUNK_ENTRIES);
+        if (catalog_read_entries(&fp, from, chunk, num) != (int)num) {
+            ret = -EIO;
+            break;
+        }
+        ret = catalog_write_entries(&fp, from - 1, chunk, num);
+        from += num;
+    }
+    if (ret == 0) {
+        ret = fs_truncate(&fp, catalog_offset(count - 1));
+    }
+    ret = catalog_commit(&fp, ret);
+    if (ret == 0) {
+        catalog_count = count - 1;
+    }
+    return ret;
+}
+
+/** Rebuild the catalog from the recording files, repairing dirty ones on the way. */
+static int catalog_rebuild(void)
+{
+    struct fs_file_t fp;
+    struct fs_dir_t dirp;
+    struct fs_dirent entry;
+    zsw_recording_entry_t recording;
+    char path[MAX_PATH_LEN];
+    uint32_t count = 0;
+    int ret;
+
+    fs_file_t_init(&fp);
+    ret = fs_open(&fp, CATALOG_FILE_PATH, FS_O_CREATE | FS_O_RDWR);
+    if (ret < 0) {
+        return ret;
+    }
+    ret = fs_truncate(&fp, 0);
+    if (ret == 0) {
+        ret = catalog_write_header(&fp);
+    }
+
+    fs_dir_t_init(&dirp);
+    if (ret == 0) {
+        ret = fs_opendir(&dirp, VOICE_MEMO_DIR);
+    }
+    if (ret < 0) {
+        return catalog_commit(&fp, ret);
+    }
+
+    while (ret == 0 && fs_readdir(&dirp, &entry) == 0 && entry.name[0] != '\0') {
         if (entry.type != FS_DIR_ENTRY_FILE) {
             continue;
         }
-        if (entry.name[0] == '.' || strstr(entry.name, ".zsw_opus") == NULL) {
+        memset(&recording, 0, sizeof(recording));
+        if (!filename_from_entry(entry.name, recording.filename)) {
             continue;
         }
-        char path[MAX_PATH_LEN];
         snprintf(path, sizeof(path), "%s/%s", VOICE_MEMO_DIR, entry.name);
-        repair_dirty_file(path);
+        if (repair_dirty_file(path, &recording) < 0) {
+            continue;
+        }
+        ret = catalog_write_entries(&fp, count, &recording, 1);
+        count++;
     }
-
     fs_closedir(&dirp);
-    LOG_INF("Voice memo store initialized");
+
+    ret = catalog_commit(&fp, ret);
+    if (ret == 0) {
+        catalog_count = count;
+        LOG_INF("Voice memo catalog rebuilt, %u recordings", count);
+    }
+    return ret;
+}
+
+/** Repair the recordings that were being written when the watch reset. */
+static int catalog_repair(uint32_t count)
+{
+    zsw_recording_entry_t chunk[CATALOG_CHUNK_ENTRIES];
+    char path[MAX_PATH_LEN];
+    struct fs_file_t fp;
+    uint32_t catalog_entries;
+    int ret;
+
+    for (uint32_t index = 0; index < count;) {
+        uint32_t num = MIN(count - index, CATALOG_CHUNK_ENTRIES);
+        int dirty = -1;
+
+        ret = catalog_open(&fp, &catalog_entries);
+        if (ret < 0) {
+            return ret;
+        }
+        ret = catalog_read_entries(&fp, index, chunk, num);
+        fs_close(&fp);
+        if (ret != (int)num) {
+            return -EIO;
+        }
+
+        for (uint32_t i = 0; i < num && dirty < 0; i++) {
+            if (chunk[i].duration_ms == NOT_FINALIZED) {
+                dirty = i;
+            }
+        }
+        if (dirty < 0) {
+            index += num;
+            continue;
+        }
+
+        make_filepath(path, sizeof(path), chunk[dirty].filename);
+        if (repair_dirty_file(path, &chunk[dirty]) == 0) {
+            ret = catalog_update(index + dirty, &chunk[dirty]);
+            index += dirty + 1;
+        } else {
+            ret = catalog_remove(chunk[dirty].filename);
+            count--;
+            index += dirty;
+        }
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
     return 0;
 }
 
+/** Number of recording files, only the directory is read. */
+static uint32_t count_recording_files(void)
+{
+    struct fs_dir_t dirp;
+    struct fs_dirent entry;
+    char filename[VOICE_MEMO_MAX_FILENAME];
+    uint32_t count = 0;
+
+    fs_dir_t_init(&dirp);
+    if (fs_opendir(&dirp, VOICE_MEMO_DIR) < 0) {
+        return 0;
+    }
+
+    while (fs_readdir(&dirp, &entry) == 0 && entry.name[0] != '\0') {
+        if (entry.type == FS_DIR_ENTRY_FILE && filename_from_entry(entry.name, filename)) {
+            count++;
+        }
+    }
+
+    fs_closedir(&dirp);
+    return count;
+}
+
+/**
+ * Load the catalog, or rebuild it if it is missing, damaged or does not match the recording
+ * files. The files and the catalog are not changed together, a reset in between is caught by
+ * the count not matching.
+ */
+static int catalog_load(void)
+{
+    struct fs_file_t fp;
+    uint32_t count;
+    int ret;
+
+    ret = catalog_open(&fp, &count);
+    if (ret == 0) {
+        fs_close(&fp);
+        if (count != count_recording_files()) {
+            ret = -ESTALE;
+        }
+    }
+
+    if (ret == 0) {
+        catalog_count = count;
+        ret = catalog_repair(count);
+    }
+
+    if (ret < 0) {
+        LOG_INF("Rebuilding voice memo catalog: %d", ret);
+        ret = catalog_rebuild();
+    }
+
+    return ret;
+}
+
+int zsw_recording_manager_store_init(void)
+{
+    int ret;
+
+    ret = fs_mkdir(VOICE_MEMO_DIR);
+    if (ret < 0 && ret != -EEXIST) {
+        LOG_ERR("Failed to create recordings dir: %d", ret);
+        return ret;
+    }
+
+    k_mutex_lock(&catalog_mutex, K_FOREVER);
+    ret = catalog_loaded ? 0 : catalog_load();
+    if (ret < 0) {
+        LOG_ERR("Failed to load voice memo catalog: %d", ret);
+    } else if (!catalog_loaded) {
+        catalog_loaded = true;
+        LOG_INF("Voice memo store initialized");
+    }
+    k_mutex_unlock(&catalog_mutex);
+
+    return ret;
+}
+
 int zsw_recording_manager_store_start_recording(void)
 {
     int ret;
@@ -315,13 +803,29 @@ int zsw_recording_manager_store_start_recording(void)
     }
 
     generate_filename(current_filename, sizeof(current_filename));
-    snprintf(current_filepath, sizeof(current_filepath),
-             "%s/%s.zsw_opus", VOICE_MEMO_DIR, current_filename);
+    make_filepath(current_filepath, sizeof(current_filepath), current_filename);
+
+    /* In the catalog before the file exists, so a reset while recording leaves a dirty entry. */
+    zsw_recording_entry_t entry = {
+        .timestamp = get_unix_timestamp(),
+        .duration_ms = NOT_FINALIZED,
+    };
+    strncpy(entry.filename, current_filename, sizeof(entry.filename) - 1);
+    k_mutex_lock(&catalog_mutex, K_FOREVER);
+    ret = catalog_append(&entry, &current_index);
+    k_mutex_unlock(&catalog_mutex);
+    if (ret < 0) {
+        LOG_ERR("Failed to add recording to catalog: %d", ret);
+        return ret;
+    }
 
     fs_file_t_init(&current_file);
     ret = fs_open(&current_file, current_filepath, FS_O_CREATE | FS_O_RDWR);
     if (ret < 0) {
         LOG_ERR("Failed to create recording file: %d", ret);
+        k_mutex_lock(&catalog_mutex, K_FOREVER);
+        catalog_remove(current_filename);
+        k_mutex_unlock(&catalog_mutex);
         return ret;
     }
     file_open = true;
@@ -332,9 +836,9 @@ int zsw_recording_manager_store_start_recording(void)
     hdr.sample_rate = 16000;
     hdr.frame_size = CONFIG_ZSW_OPUS_FRAME_SIZE_SAMPLES;
     hdr.bitrate = CONFIG_ZSW_OPUS_BITRATE;
-    hdr.timestamp = get_unix_timestamp();
-    hdr.total_frames = 0xFFFFFFFF;
-    hdr.duration_ms = 0xFFFFFFFF;
+    hdr.timestamp = entry.timestamp;
+    hdr.total_frames = NOT_FINALIZED;
+    hdr.duration_ms = NOT_FINALIZED;
 
     ssize_t written = fs_write(&current_file, &hdr, sizeof(hdr));
     if (written != sizeof(hdr)) {
@@ -342,10 +846,15 @@ int zsw_recording_manager_store_start_recording(void)
         fs_close(&current_file);
         file_open = false;
         fs_unlink(current_filepath);
+        k_mutex_lock(&catalog_mutex, K_FOREVER);
+        catalog_remove(current_filename);
+        k_mutex_unlock(&catalog_mutex);
         return -EIO;
     }
 
     frame_count = 0;
+    write_offset = sizeof(hdr);
+    index_reset();
     write_buf_pos = 0;
     recording_active = true;
 
@@ -372,6 +881,8 @@ int zsw_recording_manager_store_write_frame(const uint8_t *opus_data, size_t len
         return ret;
     }
 
+    index_add_frame(frame_count, write_offset);
+    write_offset += sizeof(frame_len) + len;
     frame_count++;
     return 0;
 }
@@ -381,7 +892,7 @@ int zsw_recording_manager_store_flush(void)
     return flush_write_buf();
 }
 
-int zsw_recording_manager_store_stop_recording(uint32_t *out_duration_ms, uint32_t *out_size_bytes)
+int zsw_recording_manager_store_stop_recording(uint32_t bitrate, uint32_t *out_duration_ms, uint32_t *out_size_bytes)
 {
     if (!recording_active) {
         LOG_WRN("stop_recording: not active");
@@ -415,6 +926,13 @@ int zsw_recording_manager_store_stop_recording(uint32_t *out_duration_ms, uint32
 
     hdr.total_frames = frame_count;
     hdr.duration_ms = duration_ms;
+    hdr.bitrate = bitrate;
+
+    ret = index_write(&current_file, write_offset, &hdr);
+    if (ret < 0) {
+        LOG_WRN("Index write failed: %d", ret);
+        hdr.index_offset = 0;
+    }
 
     ret = fs_seek(&current_file, 0, FS_SEEK_SET);
     if (ret < 0) {
@@ -435,6 +953,7 @@ int zsw_recording_manager_store_stop_recording(uint32_t *out_duration_ms, uint32
     }
 
 cleanup:
+    index_free();
     fs_close(&current_file);
 
     struct fs_dirent stat_entry;
@@ -446,6 +965,22 @@ cleanup:
     file_open = false;
     recording_active = false;
 
+    /* On failure the entry stays dirty and is repaired from the file on the next init. */
+    if (ret == 0) {
+        zsw_recording_entry_t entry = {
+            .timestamp = hdr.timestamp,
+            .duration_ms = duration_ms,
+            .size_bytes = file_size,
+        };
+        strncpy(entry.filename, current_filename, sizeof(entry.filename) - 1);
+        k_mutex_lock(&catalog_mutex, K_FOREVER);
+        int catalog_ret = catalog_update(current_index, &entry);
+        k_mutex_unlock(&catalog_mutex);
+        if (catalog_ret < 0) {
+            LOG_ERR("Failed to update catalog: %d", catalog_ret);
+        }
+    }
+
     if (ret == 0 && out_duration_ms) {
         *out_duration_ms = duration_ms;
     }
@@ -466,6 +1001,7 @@ int zsw_recording_manager_store_abort_recording(void)
     }
 
     write_buf_pos = 0;
+    index_free();
 
     if (file_open) {
         fs_close(&current_file);
@@ -477,62 +1013,41 @@ int zsw_recording_manager_store_abort_recording(void)
         LOG_ERR("abort_recording: failed to delete %s: %d", current_filepath, ret);
     }
 
+    k_mutex_lock(&catalog_mutex, K_FOREVER);
+    ret = catalog_remove(current_filename);
+    k_mutex_unlock(&catalog_mutex);
+    if (ret < 0) {
+        LOG_ERR("abort_recording: failed to remove from catalog: %d", ret);
+    }
+
     recording_active = false;
 
     LOG_INF("Recording aborted: %s", current_filename);
     return 0;
 }
 
-int zsw_recording_manager_store_list(zsw_recording_entry_t *entries, size_t max_entries)
+int zsw_recording_manager_store_list(zsw_recording_entry_t *entries, size_t offset, size_t max_entries)
 {
-    struct fs_dir_t dirp;
-    struct fs_dirent entry;
-    int count = 0;
+    struct fs_file_t fp;
+    uint32_t count;
+    int ret;
 
-    fs_dir_t_init(&dirp);
-    int ret = fs_opendir(&dirp, VOICE_MEMO_DIR);
-    if (ret < 0) {
-        return ret;
+    k_mutex_lock(&catalog_mutex, K_FOREVER);
+    if (!catalog_loaded) {
+        k_mutex_unlock(&catalog_mutex);
+        return -ENODEV;
     }
 
-    while (fs_readdir(&dirp, &entry) == 0 && entry.name[0] != '\0') {
-        if (entry.type != FS_DIR_ENTRY_FILE) {
-            continue;
-        }
-        const char *ext = strstr(entry.name, ".zsw_opus");
-        if (!ext) {
-            continue;
-        }
-        if ((size_t)count >= max_entries) {
-            break;
-        }
-
-        char path[MAX_PATH_LEN];
-        snprintf(path, sizeof(path), "%s/%s", VOICE_MEMO_DIR, entry.name);
-
-        struct fs_file_t fp;
-        zsw_recording_manager_store_header_t hdr;
-        fs_file_t_init(&fp);
-        if (fs_open(&fp, path, FS_O_READ) == 0) {
-            if (fs_read(&fp, &hdr, sizeof(hdr)) == sizeof(hdr) &&
-                memcmp(hdr.magic, VOICE_MEMO_MAGIC, 4) == 0) {
-                size_t name_len = ext - entry.name;
-                if (name_len >= VOICE_MEMO_MAX_FILENAME) {
-                    name_len = VOICE_MEMO_MAX_FILENAME - 1;
-                }
-                memcpy(entries[count].filename, entry.name, name_len);
-                entries[count].filename[name_len] = '\0';
-                entries[count].timestamp = hdr.timestamp;
-                entries[count].duration_ms = hdr.duration_ms;
-                entries[count].size_bytes = entry.size;
-                count++;
-            }
-            fs_close(&fp);
+    ret = catalog_open(&fp, &count);
+    if (ret == 0) {
+        if (offset < count && max_entries > 0) {
+            ret = catalog_read_entries(&fp, offset, entries, MIN(count - offset, max_entries));
         }
+        fs_close(&fp);
     }
+    k_mutex_unlock(&catalog_mutex);
 
-    fs_closedir(&dirp);
-    return count;
+    return ret;
 }
 
 int zsw_recording_manager_store_delete(const char *filename)
@@ -545,13 +1060,21 @@ int zsw_recording_manager_store_delete(const char *filename)
     }
 
     char path[MAX_PATH_LEN];
-    snprintf(path, sizeof(path), "%s/%s.zsw_opus", VOICE_MEMO_DIR, filename);
+    make_filepath(path, sizeof(path), filename);
 
     int ret = fs_unlink(path);
-    if (ret < 0) {
+    if (ret < 0 && ret != -ENOENT) {
         LOG_ERR("Failed to delete %s: %d", path, ret);
-    } else {
+        return ret;
+    }
+
+    /* Also drops a catalog entry whose file is already gone. */
+    k_mutex_lock(&catalog_mutex, K_FOREVER);
+    int catalog_ret = catalog_remove(filename);
+    k_mutex_unlock(&catalog_mutex);
+    if (ret == 0 || catalog_ret == 0) {
         LOG_INF("Deleted recording: %s", filename);
+        return 0;
     }
     return ret;
 }
@@ -573,31 +1096,149 @@ int zsw_recording_manager_store_get_free_space(uint32_t *free_bytes)
 
 int zsw_recording_manager_store_get_count(void)
 {
-    struct fs_dir_t dirp;
-    struct fs_dirent entry;
-    int count = 0;
+    return catalog_loaded ? (int)catalog_count : 0;
+}
 
-    fs_dir_t_init(&dirp);
-    if (fs_opendir(&dirp, VOICE_MEMO_DIR) < 0) {
-        return 0;
+const char *zsw_recording_manager_store_get_current_filename(void)
+{
+    return recording_active ? current_filename : NULL;
+}
+
+bool zsw_recording_manager_store_is_recording(void)
+{
+    return recording_active;
+}
+
+int zsw_recording_manager_store_reader_open(zsw_recording_reader_t *reader, const char *filename)
+{
+    zsw_recording_manager_store_header_t *hdr = &reader->header;
+    char path[MAX_PATH_LEN];
+    int ret;
+
+    if (recording_active && strcmp(filename, current_filename) == 0) {
+        return -EBUSY;
     }
 
-    while (fs_readdir(&dirp, &entry) == 0 && entry.name[0] != '\0') {
-        if (entry.type == FS_DIR_ENTRY_FILE && strstr(entry.name, ".zsw_opus")) {
-            count++;
+    memset(reader, 0, sizeof(*reader));
+    make_filepath(path, sizeof(path), filename);
+    fs_file_t_init(&reader->file);
+    ret = fs_open(&reader->file, path, FS_O_READ);
+    if (ret < 0) {
+        return ret;
+    }
+
+    if (fs_read(&reader->file, hdr, sizeof(*hdr)) != sizeof(*hdr) ||
+        memcmp(hdr->magic, VOICE_MEMO_MAGIC, 4) != 0 ||
+        hdr->total_frames == NOT_FINALIZED || hdr->sample_rate == 0 || hdr->frame_size == 0) {
+        fs_close(&reader->file);
+        return -EBADMSG;
+    }
+
+    /* Version 1 files have no seek index, the field was reserved. */
+    if (hdr->version >= 2 && hdr->index_offset != 0) {
+        ret = fs_seek(&reader->file, hdr->index_offset, FS_SEEK_SET);
+        if (ret < 0 || fs_read(&reader->file, &reader->index, sizeof(reader->index)) != sizeof(reader->index) ||
+            reader->index.end_marker != 0 || reader->index.interval_frames == 0) {
+            LOG_WRN("Bad seek index in %s, seeking without it", filename);
+            memset(&reader->index, 0, sizeof(reader->index));
         }
     }
 
-    fs_closedir(&dirp);
-    return count;
+    ret = fs_seek(&reader->file, sizeof(*hdr), FS_SEEK_SET);
+    if (ret < 0) {
+        fs_close(&reader->file);
+    }
+    return ret;
 }
 
-const char *zsw_recording_manager_store_get_current_filename(void)
+static int reader_skip_frame(zsw_recording_reader_t *reader)
 {
-    return recording_active ? current_filename : NULL;
+    uint16_t frame_len;
+    ssize_t n = fs_read(&reader->file, &frame_len, sizeof(frame_len));
+    if (n != sizeof(frame_len) || frame_len == 0 || frame_len > MAX_FRAME_BYTES) {
+        return n < 0 ? (int)n : -EBADMSG;
+    }
+
+    int ret = fs_seek(&reader->file, frame_len, FS_SEEK_CUR);
+    if (ret == 0) {
+        reader->frame++;
+    }
+    return ret;
 }
 
-bool zsw_recording_manager_store_is_recording(void)
+int zsw_recording_manager_store_reader_seek(zsw_recording_reader_t *reader, uint32_t position_ms)
 {
-    return recording_active;
+    const zsw_recording_manager_store_header_t *hdr = &reader->header;
+    uint32_t target = (uint64_t)position_ms * hdr->sample_rate / ((uint64_t)hdr->frame_size * 1000);
+    uint32_t frame = 0;
+    uint32_t offset = sizeof(*hdr);
+    int ret;
+
+    target = MIN(target, hdr->total_frames);
+
+    if (reader->index.count > 0) {
+        uint32_t entry = MIN(target / reader->index.interval_frames, reader->index.count - 1);
+
+        ret = fs_seek(&reader->file, hdr->index_offset + sizeof(reader->index) + entry * sizeof(uint32_t),
+                      FS_SEEK_SET);
+        if (ret < 0) {
+            return ret;
+        }
+        ssize_t n = fs_read(&reader->file, &offset, sizeof(offset));
+        if (n != sizeof(offset)) {
+            return n < 0 ? (int)n : -EIO;
+        }
+        frame = entry * reader->index.interval_frames;
+    }
+
+    ret = fs_seek(&reader->file, offset, FS_SEEK_SET);
+    if (ret < 0) {
+        return ret;
+    }
+    reader->frame = frame;
+
+    while (reader->frame < target) {
+        ret = reader_skip_frame(reader);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+int zsw_recording_manager_store_reader_read_frame(zsw_recording_reader_t *reader, uint8_t *buf, size_t max_len)
+{
+    uint16_t frame_len;
+    ssize_t n;
+
+    if (reader->frame >= reader->header.total_frames) {
+        return 0;
+    }
+
+    n = fs_read(&reader->file, &frame_len, sizeof(frame_len));
+    if (n != sizeof(frame_len) || frame_len == 0 || frame_len > MAX_FRAME_BYTES) {
+        return n < 0 ? (int)n : -EBADMSG;
+    }
+    if (frame_len > max_len) {
+        return -ENOBUFS;
+    }
+
+    n = fs_read(&reader->file, buf, frame_len);
+    if (n != frame_len) {
+        return n < 0 ? (int)n : -EIO;
+    }
+
+    reader->frame++;
+    return frame_len;
+}
+
+uint32_t zsw_recording_manager_store_reader_get_position_ms(const zsw_recording_reader_t *reader)
+{
+    return (uint32_t)((uint64_t)reader->frame * reader->header.frame_size * 1000 / reader->header.sample_rate);
+}
+
+void zsw_recording_manager_store_reader_close(zsw_recording_reader_t *reader)
+{
+    fs_close(&reader->file);
 }
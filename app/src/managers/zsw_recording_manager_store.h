@@ -19,8 +19,9 @@
  * @file zsw_recording_manager_store.h
  * @brief Low-level storage for voice recordings in .zsw_opus format on LittleFS.
  *
- * Internal header — only include from zsw_recording_manager.c.
- * Handles file creation, buffered writes, crash recovery, and directory listing.
+ * Internal header — only include from the zsw_recording_manager sources.
+ * Handles file creation, buffered writes, crash recovery, the catalog used for listing, and reading
+ * recordings back with seeking.
  */
 
 #pragma once
@@ -28,11 +29,12 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <zephyr/fs/fs.h>
 
 #define VOICE_MEMO_DIR            "/user/recordings"
 #define VOICE_MEMO_MAX_FILENAME   32
 #define VOICE_MEMO_MAGIC          "ZSWO"
-#define VOICE_MEMO_HEADER_VERSION 1
+#define VOICE_MEMO_HEADER_VERSION 2
 #define VOICE_MEMO_HEADER_SIZE    32
 
 /** Maximum number of stored recordings. */
@@ -40,6 +42,12 @@
 /** Minimum free space required to start a recording (KB). */
 #define ZSW_RECORDING_MIN_FREE_SPACE_KB 500
 
+/*
+ * A recording is the header, the frames, each a uint16_t length followed by the Opus packet, and
+ * from version 2 a seek index. The index is written when the recording is stopped or repaired and
+ * starts with a zero length where the next frame would be, so it ends the frame chain for readers
+ * that do not know about it.
+ */
 typedef struct __attribute__((packed))
 {
     uint8_t  magic[4];
@@ -47,17 +55,26 @@ typedef struct __attribute__((packed))
     uint16_t sample_rate;
     uint16_t frame_size;
     uint16_t reserved1;
-    uint32_t bitrate;
+    uint32_t bitrate;        /**< Lowest Opus bitrate used, the encoder lowers it under load. */
     uint32_t timestamp;
     uint32_t total_frames;   /**< 0xFFFFFFFF means the file was not finalized (dirty). */
     uint32_t duration_ms;    /**< 0xFFFFFFFF means the file was not finalized (dirty). */
-    uint32_t reserved2;
+    uint32_t index_offset;   /**< File offset of the seek index, 0 if there is none. */
 }
 zsw_recording_manager_store_header_t;
 
 _Static_assert(sizeof(zsw_recording_manager_store_header_t) == VOICE_MEMO_HEADER_SIZE,
                "zsw_recording_manager_store_header_t must be exactly 32 bytes");
 
+/** @brief Seek index, followed by count uint32_t file offsets of every interval_frames frame. */
+typedef struct __attribute__((packed))
+{
+    uint16_t end_marker;        /**< 0, no frame has this length. */
+    uint16_t interval_frames;
+    uint32_t count;
+}
+zsw_recording_manager_store_index_header_t;
+
 /** @brief A single recording entry as returned by the list function. */
 typedef struct {
     char     filename[VOICE_MEMO_MAX_FILENAME];
@@ -66,6 +83,14 @@ typedef struct {
     uint32_t size_bytes;
 } zsw_recording_entry_t;
 
+/** @brief A recording opened for reading. */
+typedef struct {
+    struct fs_file_t file;
+    zsw_recording_manager_store_header_t header;
+    zsw_recording_manager_store_index_header_t index;   /**< count is 0 without a seek index. */
+    uint32_t frame;                                     /**< Next frame to be read. */
+} zsw_recording_reader_t;
+
 /** @brief Initialize storage. Scans for and repairs dirty (incomplete) files. */
 int zsw_recording_manager_store_init(void);
 
@@ -78,14 +103,21 @@ int zsw_recording_manager_store_write_frame(const uint8_t *opus_data, size_t len
 /** @brief Force-flush the write buffer to flash. */
 int zsw_recording_manager_store_flush(void);
 
-/** @brief Finalize the recording: update header with frame count and duration. */
-int zsw_recording_manager_store_stop_recording(uint32_t *out_duration_ms, uint32_t *out_size_bytes);
+/** @brief Finalize the recording: update header with frame count, duration and the lowest bitrate used. */
+int zsw_recording_manager_store_stop_recording(uint32_t bitrate, uint32_t *out_duration_ms, uint32_t *out_size_bytes);
 
 /** @brief Discard the current recording and delete the file. */
 int zsw_recording_manager_store_abort_recording(void);
 
-/** @brief List all stored recordings, sorted by timestamp. */
-int zsw_recording_manager_store_list(zsw_recording_entry_t *entries, size_t max_entries);
+/**
+ * @brief List stored recordings from the catalog, oldest first.
+ *
+ * @param entries      Filled in with the recordings.
+ * @param offset       Index of the first recording to list.
+ * @param max_entries  Size of entries.
+ * @return Number of entries filled in, or negative error code.
+ */
+int zsw_recording_manager_store_list(zsw_recording_entry_t *entries, size_t offset, size_t max_entries);
 
 /** @brief Delete a recording by filename (without extension). */
 int zsw_recording_manager_store_delete(const char *filename);
@@ -93,7 +125,7 @@ int zsw_recording_manager_store_delete(const char *filename);
 /** @brief Get free space on the recording partition. */
 int zsw_recording_manager_store_get_free_space(uint32_t *free_bytes);
 
-/** @brief Get the number of stored recordings. */
+/** @brief Get the number of stored recordings, kept with the catalog so nothing is read. */
 int zsw_recording_manager_store_get_count(void);
 
 /** @brief Get the filename of the recording currently being written. */
@@ -104,3 +136,35 @@ bool zsw_recording_manager_store_is_recording(void);
 
 /** @brief Get current UNIX timestamp from the RTC. */
 uint32_t zsw_recording_manager_store_get_unix_timestamp(void);
+
+/**
+ * @brief Open a stored recording for reading, positioned at the first frame.
+ *
+ * @return 0 on success, -EBUSY if it is being recorded, -EBADMSG if it is not a valid recording,
+ *         or other negative error code.
+ */
+int zsw_recording_manager_store_reader_open(zsw_recording_reader_t *reader, const char *filename);
+
+/**
+ * @brief Move to the frame at a position in the recording.
+ *
+ * Looks up the closest earlier frame in the seek index and skips at most the index interval from
+ * there, files without an index are skipped through from the start.
+ *
+ * @param position_ms Position from the start, past the end moves to the end.
+ * @return 0 on success, or negative error code.
+ */
+int zsw_recording_manager_store_reader_seek(zsw_recording_reader_t *reader, uint32_t position_ms);
+
+/**
+ * @brief Read the next Opus frame.
+ *
+ * @return Frame size in bytes, 0 at the end of the recording, or negative error code.
+ */
+int zsw_recording_manager_store_reader_read_frame(zsw_recording_reader_t *reader, uint8_t *buf, size_t max_len);
+
+/** @brief Get the position of the next frame from the start of the recording in milliseconds. */
+uint32_t zsw_recording_manager_store_reader_get_position_ms(const zsw_recording_reader_t *reader);
+
+/** @brief Close a recording opened with zsw_recording_manager_store_reader_open(). */
+void zsw_recording_manager_store_reader_close(zsw_recording_reader_t *reader);
@@ -0,0 +1,95 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * A frame is speech when its level is well above the noise floor. Unvoiced sounds like "s" and
+ * "f" are quiet but cross zero often, so a frame that crosses zero often only needs to be a
+ * little above the floor. The noise floor follows quieter frames quickly and louder frames
+ * slowly, so it settles between words and adapts to a changed background within seconds.
+ * It starts low instead of at the first frame, so a recording that starts mid-word does not
+ * take the word as the background and drop what follows.
+ */
+
+#include <zephyr/sys/util.h>
+
+#include "zsw_recording_manager_vad.h"
+
+#define SAMPLES_PER_MS          16
+// Mean absolute sample value below which a frame is always silence, about -56 dBFS.
+#define MIN_SPEECH_LEVEL        50
+// Level above the noise floor for speech, as a ratio in 1/4 steps: 3x or about 10 dB.
+#define SPEECH_RATIO_Q2         12
+// Level above the noise floor for speech when the frame crosses zero often, 1.5x.
+#define FRICATIVE_RATIO_Q2      6
+// Zero crossings in percent of the samples in a frame for it to count as crossing often.
+#define FRICATIVE_ZCR_PERCENT   30
+// The floor moves 1/8 of the way down to a quieter frame, and up by 1/512 per louder frame.
+#define FLOOR_FALL_SHIFT        3
+#define FLOOR_RISE_SHIFT        9
+// Noise floor at the start of a recording, below any speech.
+#define INITIAL_NOISE_FLOOR     (MIN_SPEECH_LEVEL / 2)
+
+static uint32_t noise_floor = INITIAL_NOISE_FLOOR;
+static uint32_t hangover_frames_left;
+
+void zsw_recording_manager_vad_reset(void)
+{
+    noise_floor = INITIAL_NOISE_FLOOR;
+    hangover_frames_left = 0;
+}
+
+bool zsw_recording_manager_vad_is_speech(const int16_t *samples, size_t count)
+{
+    uint32_t sum = 0;
+    uint32_t crossings = 0;
+    uint32_t level;
+    bool speech;
+
+    if (count == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        sum += samples[i] < 0 ? -samples[i] : samples[i];
+        if (i > 0 && (samples[i - 1] ^ samples[i]) < 0) {
+            crossings++;
+        }
+    }
+    level = sum / count;
+
+    speech = level >= MIN_SPEECH_LEVEL &&
+             (level * 4 > noise_floor * SPEECH_RATIO_Q2 ||
+              (level * 4 > noise_floor * FRICATIVE_RATIO_Q2 && crossings * 100 > count * FRICATIVE_ZCR_PERCENT));
+
+    if (level < noise_floor) {
+        noise_floor -= (noise_floor - level) >> FLOOR_FALL_SHIFT;
+    } else {
+        noise_floor += MAX(noise_floor >> FLOOR_RISE_SHIFT, 1);
+    }
+
+    if (speech) {
+        hangover_frames_left = DIV_ROUND_UP(CONFIG_ZSW_VOICE_MEMO_VAD_HANGOVER_MS * SAMPLES_PER_MS, count);
+        return true;
+    }
+
+    if (hangover_frames_left > 0) {
+        hangover_frames_left--;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file zsw_recording_manager_vad.h
+ * @brief Voice activity detection for voice recordings, based on frame energy and zero crossings.
+ *
+ * Internal header — only include from zsw_recording_manager.c.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** @brief Forget the noise floor and hangover, call when a new recording starts. */
+void zsw_recording_manager_vad_reset(void);
+
+/**
+ * @brief Classify a PCM frame.
+ *
+ * @param samples  16-bit PCM samples at 16 kHz.
+ * @param count    Number of samples, one codec frame.
+ * @return true if the frame contains speech or is within the hangover after speech.
+ */
+bool zsw_recording_manager_vad_is_speech(const int16_t *samples, size_t count);
@@ -214,6 +214,15 @@ int zsw_speaker_manager_start(const zsw_speaker_config_t *config,
         return -EBUSY;
     }
 
+    /* After a stop that timed out the old thread may still be running on the same thread data. */
+    if (spk.thread_id) {
+        if (k_thread_join(&spk.thread_data, K_NO_WAIT) != 0) {
+            LOG_WRN("Previous stream thread still running");
+            return -EBUSY;
+        }
+        spk.thread_id = NULL;
+    }
+
     switch (config->source) {
         case ZSW_SPEAKER_SOURCE_CALLBACK:
             if (!config->callback.fill_cb) {
@@ -349,28 +358,33 @@ start_fail:
 
 int zsw_speaker_manager_stop(void)
 {
-    if (!spk.streaming) {
+    int ret;
+
+    /* The thread clears streaming itself at the end of the stream, it may still be exiting. */
+    if (!spk.streaming && !spk.thread_id) {
         return 0;
     }
 
     LOG_INF("Stopping speaker playback");
 
-    spk.streaming = false;
+    if (spk.streaming) {
+        spk.streaming = false;
 
-    audio_codec_stop_output(spk.codec_dev);
+        audio_codec_stop_output(spk.codec_dev);
 
-    int ret = i2s_trigger(spk.i2s_dev, I2S_DIR_TX, I2S_TRIGGER_DROP);
-    if (ret < 0) {
-        LOG_WRN("I2S drop trigger failed: %d", ret);
+        ret = i2s_trigger(spk.i2s_dev, I2S_DIR_TX, I2S_TRIGGER_DROP);
+        if (ret < 0) {
+            LOG_WRN("I2S drop trigger failed: %d", ret);
+        }
     }
 
     if (spk.thread_id) {
         ret = k_thread_join(&spk.thread_data, K_MSEC(500));
-        if (ret == 0) {
-            spk.thread_id = NULL;
-        } else {
+        if (ret != 0) {
             LOG_WRN("Thread join failed/timed out: %d", ret);
+            return ret;
         }
+        spk.thread_id = NULL;
     }
 
     LOG_INF("Speaker playback stopped");
@@ -94,7 +94,8 @@ int zsw_speaker_manager_start(const zsw_speaker_config_t *config,
  *
  * Blocks until the streaming thread exits and hardware is shut down.
  *
- * @return 0 on success, negative error code on failure
+ * @return 0 on success, -EAGAIN if the streaming thread did not exit in time. It may then still
+ *         call the fill callback, so its buffers must be kept until a later stop succeeds.
  */
 int zsw_speaker_manager_stop(void);
 
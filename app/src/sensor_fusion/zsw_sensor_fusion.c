@@ -71,17 +71,19 @@ static const FusionMatrix accelerometerMisalignment = {.element.xx = 1.0f,
 static const FusionVector accelerometerSensitivity = {{1.0f, 1.0f, 1.0f}};
 static const FusionVector accelerometerOffset = {{0.0f, 0.0f, 0.0f}};
 #ifdef CONFIG_SENSOR_FUSION_INCLUDE_MAGNETOMETER
-static const FusionMatrix softIronMatrix = {.element.xx = 1.0f,
-                                            .element.xy = 0.0f,
-                                            .element.xz = 0.0f,
-                                            .element.yx = 0.0f,
-                                            .element.yy = 1.0f,
-                                            .element.yz = 0.0f,
-                                            .element.zx = 0.0f,
-                                            .element.zy = 0.0f,
-                                            .element.zz = 1.0f
-                                           };
-static const FusionVector hardIronOffset = {{0.0f, 0.0f, 0.0f}};
+// Fitted in the background by zsw_magnetometer, updated when a new fit is available.
+static FusionMatrix softIronMatrix = {.element.xx = 1.0f,
+                                      .element.xy = 0.0f,
+                                      .element.xz = 0.0f,
+                                      .element.yx = 0.0f,
+                                      .element.yy = 1.0f,
+                                      .element.yz = 0.0f,
+                                      .element.zx = 0.0f,
+                                      .element.zy = 0.0f,
+                                      .element.zz = 1.0f
+                                     };
+static FusionVector hardIronOffset = {{0.0f, 0.0f, 0.0f}};
+static uint32_t magnetometer_calibration_updates;
 #endif
 
 // Initialise algorithms
@@ -99,6 +101,22 @@ static atomic_t sensor_fusion_users = ATOMIC_INIT(0);
 static uint8_t up_buffer[UP_BUFFER_SIZE];
 #endif
 
+#ifdef CONFIG_SENSOR_FUSION_INCLUDE_MAGNETOMETER
+static void update_magnetometer_calibration(void)
+{
+    zsw_magnetometer_calibration_t calibration;
+
+    zsw_magnetometer_get_calibration(&calibration);
+    if (calibration.updates == magnetometer_calibration_updates) {
+        return;
+    }
+
+    magnetometer_calibration_updates = calibration.updates;
+    memcpy(softIronMatrix.array, calibration.soft_iron, sizeof(softIronMatrix.array));
+    memcpy(hardIronOffset.array, calibration.hard_iron, sizeof(hardIronOffset.array));
+}
+#endif
+
 static void sensor_fusion_timeout(struct k_work *work)
 {
     int ret = 0;
@@ -129,10 +147,11 @@ static void sensor_fusion_timeout(struct k_work *work)
     accelerometer.axis.z /= SENSOR_GF;
 
 #ifdef CONFIG_SENSOR_FUSION_INCLUDE_MAGNETOMETER
-    ret = zsw_magnetometer_get_all(&magnetometer.axis.x, &magnetometer.axis.y, &magnetometer.axis.z);
+    ret = zsw_magnetometer_get_raw(&magnetometer.axis.x, &magnetometer.axis.y, &magnetometer.axis.z);
     if (ret != 0) {
-        LOG_ERR("zsw_magnetometer_get_all err: %d", ret);
+        LOG_ERR("zsw_magnetometer_get_raw err: %d", ret);
     }
+    update_magnetometer_calibration();
 #endif
 
     // Apply calibration
@@ -53,7 +53,8 @@ static void bmi270_trigger_handler(const struct device *dev, const struct sensor
             if (sensor_channel_get(bmi270, SENSOR_CHAN_STEPS, &sensor_val) == 0) {
 
                 evt.type = ZSW_IMU_EVT_TYPE_STEP;
-                evt.data.step.count = sensor_val.val1;
+                // Same as zsw_imu_fetch_num_steps, listeners show the event value directly.
+                evt.data.step.count = sensor_val.val1 + step_offset;
 
                 LOG_DBG("No of steps counted  = %u", evt.data.step.count);
             }
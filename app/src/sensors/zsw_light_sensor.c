@@ -16,35 +16,13 @@
  */
 
 #include <zephyr/logging/log.h>
-#include <zephyr/zbus/zbus.h>
 
-#include "events/zsw_periodic_event.h"
-#include "events/light_event.h"
 #include "sensors/zsw_light_sensor.h"
 
 LOG_MODULE_REGISTER(zsw_light_sensor, CONFIG_ZSW_SENSORS_LOG_LEVEL);
 
-static void zbus_periodic_slow_callback(const struct zbus_channel *chan);
-
-ZBUS_CHAN_DECLARE(light_data_chan);
-ZBUS_CHAN_DECLARE(periodic_event_10s_chan);
-ZBUS_LISTENER_DEFINE(zsw_light_sensor_lis, zbus_periodic_slow_callback);
 static const struct device *const apds9306 = DEVICE_DT_GET_OR_NULL(DT_NODELABEL(apds9306));
 
-static void zbus_periodic_slow_callback(const struct zbus_channel *chan)
-{
-    float light = 0.0;
-
-    if (zsw_light_sensor_get_light(&light)) {
-        return;
-    }
-
-    struct light_event evt = {
-        .light = light,
-    };
-    zbus_chan_pub(&light_data_chan, &evt, K_MSEC(250));
-}
-
 int zsw_light_sensor_init(void)
 {
     if (!device_is_ready(apds9306)) {
@@ -53,8 +31,6 @@ int zsw_light_sensor_init(void)
         return -ENODEV;
     }
 
-    zsw_periodic_chan_add_obs(&periodic_event_10s_chan, &zsw_light_sensor_lis);
-
     return 0;
 }
 
@@ -24,12 +24,16 @@
 #include <zephyr/pm/policy.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/zbus/zbus.h>
+#include <zephyr/sys/atomic.h>
 #include <inttypes.h>
 #include <math.h>
+#include <string.h>
 
 #include "events/zsw_periodic_event.h"
 #include "events/magnetometer_event.h"
 #include "sensors/zsw_magnetometer.h"
+#include "sensors/zsw_magnetometer_calibration.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(zsw_magnetometer, CONFIG_ZSW_SENSORS_LOG_LEVEL);
 
@@ -39,31 +43,36 @@ LOG_MODULE_REGISTER(zsw_magnetometer, CONFIG_ZSW_SENSORS_LOG_LEVEL);
 
 #define SETTINGS_NAME_MAGN              "magn"
 #define SETTINGS_KEY_CALIB              "calibr"
+#define SETTINGS_KEY_FIT                "fit"
 #define SETTINGS_MAGN_CALIB             SETTINGS_NAME_MAGN "/" SETTINGS_KEY_CALIB
+#define SETTINGS_MAGN_FIT               SETTINGS_NAME_MAGN "/" SETTINGS_KEY_FIT
 
+// The fit keeps improving while the watch moves, saved at most this often.
+#define CALIBRATION_SAVE_DELAY_S        60
+
+// Hard iron offset from the min/max calibration used before the ellipsoid fit.
 typedef struct {
     float offset_x;
     float offset_y;
     float offset_z;
 } magn_calib_data_t;
 
-static double last_x;
-static double last_y;
-static double last_z;
-static double max_x;
-static double max_y;
-static double max_z;
-static double min_x;
-static double min_y;
-static double min_z;
-static bool is_calibrating;
-static magn_calib_data_t calibration_data;
+static struct k_spinlock lock;
+static float last_raw[3];
+static float last_calibrated[3];
+static zsw_magnetometer_calibration_t calibration = {
+    .soft_iron = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } },
+};
+static atomic_t reset_requested;
 
 static void zbus_periodic_slow_callback(const struct zbus_channel *chan);
+static void calibration_save_work_handler(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(calibration_save_work, calibration_save_work_handler);
 
 ZBUS_CHAN_DECLARE(magnetometer_data_chan);
 ZBUS_CHAN_DECLARE(periodic_event_1s_chan);
-ZBUS_LISTENER_DEFINE(zsw_magnetometer_lis, zbus_periodic_slow_callback);
+ZSW_ZBUS_LISTENER_DEFINE(zsw_magnetometer_lis, zbus_periodic_slow_callback);
 static const struct device *const magnetometer = DEVICE_DT_GET_OR_NULL(DT_NODELABEL(lis2mdl));
 
 static void zbus_periodic_slow_callback(const struct zbus_channel *chan)
@@ -90,6 +99,11 @@ static void lis2mdl_trigger_handler(const struct device *dev,
 {
     struct sensor_value die_temp2;
     struct sensor_value magn[3];
+    zsw_magnetometer_calibration_t new_calibration;
+    float sample[3];
+    k_spinlock_key_t key;
+    bool fitted;
+
     sensor_sample_fetch_chan(dev, SENSOR_CHAN_ALL);
 
     sensor_channel_get(magnetometer, SENSOR_CHAN_MAGN_XYZ, magn);
@@ -101,41 +115,44 @@ static void lis2mdl_trigger_handler(const struct device *dev,
             sensor_value_to_float(&magn[2]));
 
     // Convert Guass to micro Tesla
-    last_x = sensor_value_to_float(&magn[1]) * 10; // Swap x, y to match IMU orientation
-    last_y = sensor_value_to_float(&magn[0]) * 10;
-    last_z = sensor_value_to_float(&magn[2]) * 10;
+    sample[0] = sensor_value_to_float(&magn[1]) * 10; // Swap x, y to match IMU orientation
+    sample[1] = sensor_value_to_float(&magn[0]) * 10;
+    sample[2] = sensor_value_to_float(&magn[2]) * 10;
 
-    if (is_calibrating) {
-        if (last_x < min_x) {
-            min_x = last_x;
-        }
-        if (last_x > max_x) {
-            max_x = last_x;
-        }
+    // The fit is only touched from here, so a reset is done here too.
+    if (atomic_cas(&reset_requested, 1, 0)) {
+        zsw_magnetometer_calibration_reset();
+    }
+    fitted = zsw_magnetometer_calibration_add(sample, &new_calibration);
 
-        if (last_y < min_y) {
-            min_y = last_y;
-        }
-        if (last_y > max_y) {
-            max_y = last_y;
-        }
+    key = k_spin_lock(&lock);
+    if (fitted) {
+        new_calibration.updates = calibration.updates + 1;
+        calibration = new_calibration;
+    }
+    memcpy(last_raw, sample, sizeof(last_raw));
+    zsw_magnetometer_calibration_apply(&calibration, sample, last_calibrated);
+    k_spin_unlock(&lock, key);
 
-        if (last_z < min_z) {
-            min_z = last_z;
-        }
-        if (last_z > max_z) {
-            max_z = last_z;
-        }
+    if (fitted) {
+        k_work_schedule(&calibration_save_work, K_SECONDS(CALIBRATION_SAVE_DELAY_S));
     }
+}
 
-    last_x = last_x - calibration_data.offset_x;
-    last_y = last_y - calibration_data.offset_y;
-    last_z = last_z - calibration_data.offset_z;
+static void calibration_save_work_handler(struct k_work *work)
+{
+    zsw_magnetometer_calibration_t saved;
+
+    zsw_magnetometer_get_calibration(&saved);
+    settings_save_one(SETTINGS_MAGN_FIT, &saved, sizeof(saved));
+    LOG_DBG("Calibration saved, field strength %.1f uT", (double)saved.field_strength);
 }
 
 static int magn_cal_load(const char *p_key, size_t len,
                          settings_read_cb read_cb, void *p_cb_arg, void *p_param)
 {
+    magn_calib_data_t calibration_data;
+
     ARG_UNUSED(p_key);
 
     if (len != sizeof(magn_calib_data_t)) {
@@ -148,12 +165,39 @@ static int magn_cal_load(const char *p_key, size_t len,
         return -EIO;
     }
 
+    calibration.hard_iron[0] = calibration_data.offset_x;
+    calibration.hard_iron[1] = calibration_data.offset_y;
+    calibration.hard_iron[2] = calibration_data.offset_z;
+    // Sensor fusion only picks up the calibration when the update count changed.
+    calibration.updates = 1;
+
     LOG_WRN("Calibration data loaded: x: %f, y: %f, z: %f",
             calibration_data.offset_x, calibration_data.offset_y, calibration_data.offset_z);
 
     return 0;
 }
 
+static int magn_fit_load(const char *p_key, size_t len,
+                         settings_read_cb read_cb, void *p_cb_arg, void *p_param)
+{
+    ARG_UNUSED(p_key);
+
+    if (len != sizeof(zsw_magnetometer_calibration_t)) {
+        LOG_ERR("Invalid length of magn calibration fit");
+        return -EINVAL;
+    }
+
+    if (read_cb(p_cb_arg, &calibration, len) != sizeof(zsw_magnetometer_calibration_t)) {
+        LOG_ERR("Error reading magn calibration fit");
+        return -EIO;
+    }
+
+    LOG_INF("Calibration fit loaded: hard iron %.1f %.1f %.1f uT, field %.1f uT", (double)calibration.hard_iron[0],
+            (double)calibration.hard_iron[1], (double)calibration.hard_iron[2], (double)calibration.field_strength);
+
+    return 0;
+}
+
 int zsw_magnetometer_init(void)
 {
     if (!device_is_ready(magnetometer)) {
@@ -166,11 +210,15 @@ int zsw_magnetometer_init(void)
         return -EFAULT;
     }
 
-    if (settings_load_subtree_direct(SETTINGS_MAGN_CALIB, magn_cal_load, NULL)) {
+    // Loaded after the old offset, so a fit replaces it.
+    if (settings_load_subtree_direct(SETTINGS_MAGN_CALIB, magn_cal_load, NULL) ||
+        settings_load_subtree_direct(SETTINGS_MAGN_FIT, magn_fit_load, NULL)) {
         LOG_ERR("Error during settings_load_subtree!");
         return -EFAULT;
     }
 
+    zsw_magnetometer_calibration_reset();
+
     struct sensor_trigger trig;
     struct sensor_value odr_attr;
 
@@ -223,48 +271,55 @@ int zsw_magnetometer_set_enable(bool enabled)
     return 0;
 }
 
-int zsw_magnetometer_start_calibration(void)
+int zsw_magnetometer_reset_calibration(void)
 {
     if (!device_is_ready(magnetometer)) {
         return -ENODEV;
     }
 
-    max_x = -100000;
-    max_y = -100000;
-    max_z = -100000;
-    min_x = 100000;
-    min_y = 100000;
-    min_z = 100000;
-    is_calibrating = true;
+    atomic_set(&reset_requested, 1);
 
     return 0;
 }
 
-int zsw_magnetometer_stop_calibration(void)
+void zsw_magnetometer_get_calibration(zsw_magnetometer_calibration_t *p_calibration)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    *p_calibration = calibration;
+    k_spin_unlock(&lock, key);
+}
+
+int zsw_magnetometer_get_all(float *x, float *y, float *z)
 {
+    k_spinlock_key_t key;
+
     if (!device_is_ready(magnetometer)) {
         return -ENODEV;
     }
 
-    is_calibrating = false;
-    calibration_data.offset_x = (max_x + min_x) / 2;
-    calibration_data.offset_y = (max_y + min_y) / 2;
-    calibration_data.offset_z = (max_z + min_z) / 2;
-
-    settings_save_one(SETTINGS_MAGN_CALIB, &calibration_data, sizeof(magn_calib_data_t));
+    key = k_spin_lock(&lock);
+    *x = last_calibrated[0];
+    *y = last_calibrated[1];
+    *z = last_calibrated[2];
+    k_spin_unlock(&lock, key);
 
     return 0;
 }
 
-int zsw_magnetometer_get_all(float *x, float *y, float *z)
+int zsw_magnetometer_get_raw(float *x, float *y, float *z)
 {
+    k_spinlock_key_t key;
+
     if (!device_is_ready(magnetometer)) {
         return -ENODEV;
     }
 
-    *x = last_x;
-    *y = last_y;
-    *z = last_z;
+    key = k_spin_lock(&lock);
+    *x = last_raw[0];
+    *y = last_raw[1];
+    *z = last_raw[2];
+    k_spin_unlock(&lock, key);
 
     return 0;
 }
@@ -18,6 +18,16 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Calibrated sample = soft_iron * (sample - hard_iron), on a sphere with radius field_strength. */
+typedef struct zsw_magnetometer_calibration_t {
+    float hard_iron[3];
+    float soft_iron[3][3];
+    float field_strength;
+    // Incremented every time a new calibration is fitted
+    uint32_t updates;
+} zsw_magnetometer_calibration_t;
 
 int zsw_magnetometer_init(void);
 int zsw_magnetometer_set_enable(bool enabled);
@@ -35,5 +45,27 @@ double zsw_magnetometer_get_heading(void);
 
 */
 int zsw_magnetometer_get_all(float *x, float *y, float *z);
-int zsw_magnetometer_start_calibration(void);
-int zsw_magnetometer_stop_calibration(void);
+
+/*
+* Get the magnetometer data in micro Tesla without calibration applied,
+* for users applying zsw_magnetometer_get_calibration themselves.
+*
+* @return 0 on success, negative error code on failure.
+*/
+int zsw_magnetometer_get_raw(float *x, float *y, float *z);
+
+/*
+* Get the hard and soft iron calibration. It is fitted in the background from the samples
+* while the magnetometer is enabled and gets better as the watch is turned around.
+*
+* @param calibration Filled in with the latest calibration.
+*/
+void zsw_magnetometer_get_calibration(zsw_magnetometer_calibration_t *calibration);
+
+/*
+* Throw away the samples collected so far and fit a new calibration, for example
+* after the watch was magnetized. The current calibration is used until then.
+*
+* @return 0 on success, negative error code on failure.
+*/
+int zsw_magnetometer_reset_calibration(void);
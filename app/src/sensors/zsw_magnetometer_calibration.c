@@ -0,0 +1,360 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Incremental ellipsoid fit of the magnetometer samples.
+ *
+ * Uncalibrated samples lie on an ellipsoid, its center is the hard iron offset and its shape
+ * the soft iron distortion. The ellipsoid is written as
+ *   x²+y²+z² = u0(x²+y²-2z²) + u1(x²+z²-2y²) + u2 2xy + u3 2xz + u4 2yz + u5 2x + u6 2y + u7 2z + u8
+ * which is linear in u and can't collapse to the trivial solution, so u is estimated with
+ * recursive least squares, one 9x9 update per sample. A forgetting factor lets the fit follow
+ * when the hard iron changes.
+ *
+ * Only samples that are not close to one of the last RESERVOIR_SIZE used are added, so the
+ * fit isn't pulled towards the orientation the watch is held in most of the time and a watch
+ * lying still costs almost nothing. The reservoir is also used to check a fit before it is
+ * handed out.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+#include "sensors/zsw_magnetometer_calibration.h"
+
+LOG_MODULE_REGISTER(zsw_magnetometer_calibration, CONFIG_ZSW_SENSORS_LOG_LEVEL);
+
+#define NUM_PARAMS              9
+#define RESERVOIR_SIZE          32
+// Samples are scaled to around 1 to keep the squared terms in range for float.
+#define SCALE_UT                50.0f
+#define MIN_DISTANCE_UT         6.0f
+// Per added sample, older samples count for half after around 35 new ones.
+#define FORGETTING_FACTOR       0.98f
+#define INITIAL_COVARIANCE      1000.0f
+// Forgetting stops while the samples don't tell anything new, so the covariance can't blow up.
+#define MAX_COVARIANCE_TRACE    (NUM_PARAMS * INITIAL_COVARIANCE)
+#define MIN_SAMPLES             12
+// Samples are needed this far up the sphere on both sides of each axis, a flat turn can fit many ellipsoids.
+#define MIN_COVERAGE            0.3f
+#define COVERAGE_ALL            BIT_MASK(6)
+#define MIN_FIELD_UT            15.0f
+#define MAX_FIELD_UT            100.0f
+#define MAX_AXIS_RATIO          2.0f
+#define MAX_RESIDUAL            0.05f
+#define JACOBI_MAX_SWEEPS       8
+
+static float params[NUM_PARAMS];
+static float covariance[NUM_PARAMS][NUM_PARAMS];
+static float reservoir[RESERVOIR_SIZE][3];
+static uint8_t reservoir_next;
+static uint8_t reservoir_count;
+static uint32_t num_samples;
+
+void zsw_magnetometer_calibration_reset(void)
+{
+    memset(params, 0, sizeof(params));
+    memset(covariance, 0, sizeof(covariance));
+    for (int i = 0; i < NUM_PARAMS; i++) {
+        covariance[i][i] = INITIAL_COVARIANCE;
+    }
+    reservoir_next = 0;
+    reservoir_count = 0;
+    num_samples = 0;
+}
+
+static bool is_new_sample(const float sample[3])
+{
+    float dx;
+    float dy;
+    float dz;
+
+    for (int i = 0; i < reservoir_count; i++) {
+        dx = sample[0] - reservoir[i][0];
+        dy = sample[1] - reservoir[i][1];
+        dz = sample[2] - reservoir[i][2];
+        if (dx * dx + dy * dy + dz * dz < MIN_DISTANCE_UT * MIN_DISTANCE_UT) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void rls_update(const float sample[3])
+{
+    const float x = sample[0] / SCALE_UT;
+    const float y = sample[1] / SCALE_UT;
+    const float z = sample[2] / SCALE_UT;
+    const float phi[NUM_PARAMS] = {
+        x * x + y * y - 2 * z * z, x * x + z * z - 2 * y * y, 2 * x * y, 2 * x * z, 2 * y * z, 2 * x, 2 * y, 2 * z, 1,
+    };
+    float p_phi[NUM_PARAMS];
+    float denominator = 0;
+    float error = x * x + y * y + z * z;
+    float lambda = FORGETTING_FACTOR;
+    float trace = 0;
+
+    for (int i = 0; i < NUM_PARAMS; i++) {
+        p_phi[i] = 0;
+        for (int j = 0; j < NUM_PARAMS; j++) {
+            p_phi[i] += covariance[i][j] * phi[j];
+        }
+        denominator += phi[i] * p_phi[i];
+        error -= phi[i] * params[i];
+        trace += covariance[i][i];
+    }
+    denominator += FORGETTING_FACTOR;
+
+    if (trace > MAX_COVARIANCE_TRACE) {
+        lambda = 1.0f;
+    }
+
+    for (int i = 0; i < NUM_PARAMS; i++) {
+        params[i] += p_phi[i] * error / denominator;
+    }
+
+    // Only the upper half is computed, the covariance stays symmetric.
+    for (int i = 0; i < NUM_PARAMS; i++) {
+        for (int j = i; j < NUM_PARAMS; j++) {
+            covariance[i][j] = (covariance[i][j] - p_phi[i] * p_phi[j] / denominator) / lambda;
+            covariance[j][i] = covariance[i][j];
+        }
+    }
+}
+
+static bool invert_3x3(const float m[3][3], float inv[3][3])
+{
+    float det;
+
+    inv[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    inv[0][1] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+    inv[0][2] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    inv[1][0] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    inv[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+    inv[1][2] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+    inv[2][0] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    inv[2][1] = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+    inv[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+
+    det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0];
+    if (fabsf(det) < 1e-9f) {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            inv[i][j] /= det;
+        }
+    }
+
+    return true;
+}
+
+// Cyclic Jacobi, a becomes diagonal with the eigenvalues and the columns of v are the eigenvectors.
+static void eigen_symmetric_3x3(float a[3][3], float v[3][3])
+{
+    static const uint8_t pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    float theta;
+    float t;
+    float c;
+    float s;
+    float kp;
+    float kq;
+    int p;
+    int q;
+
+    memset(v, 0, sizeof(float) * 9);
+    v[0][0] = v[1][1] = v[2][2] = 1;
+
+    for (int sweep = 0; sweep < JACOBI_MAX_SWEEPS; sweep++) {
+        if (a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2] < 1e-12f) {
+            break;
+        }
+
+        for (int i = 0; i < ARRAY_SIZE(pairs); i++) {
+            p = pairs[i][0];
+            q = pairs[i][1];
+            if (fabsf(a[p][q]) < 1e-12f) {
+                continue;
+            }
+
+            theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+            t = copysignf(1.0f, theta) / (fabsf(theta) + sqrtf(theta * theta + 1));
+            c = 1 / sqrtf(t * t + 1);
+            s = t * c;
+
+            for (int k = 0; k < 3; k++) {
+                kp = a[k][p];
+                kq = a[k][q];
+                a[k][p] = c * kp - s * kq;
+                a[k][q] = s * kp + c * kq;
+            }
+            for (int k = 0; k < 3; k++) {
+                kp = a[p][k];
+                kq = a[q][k];
+                a[p][k] = c * kp - s * kq;
+                a[q][k] = s * kp + c * kq;
+            }
+            for (int k = 0; k < 3; k++) {
+                kp = v[k][p];
+                kq = v[k][q];
+                v[k][p] = c * kp - s * kq;
+                v[k][q] = s * kp + c * kq;
+            }
+        }
+    }
+}
+
+void zsw_magnetometer_calibration_apply(const zsw_magnetometer_calibration_t *calibration, const float sample[3],
+                                        float out[3])
+{
+    float d[3];
+
+    for (int i = 0; i < 3; i++) {
+        d[i] = sample[i] - calibration->hard_iron[i];
+    }
+    for (int i = 0; i < 3; i++) {
+        out[i] = calibration->soft_iron[i][0] * d[0] + calibration->soft_iron[i][1] * d[1] +
+                 calibration->soft_iron[i][2] * d[2];
+    }
+}
+
+// Relative RMS distance of the reservoir samples from the sphere, and which sides of it they cover.
+static float get_residual(const zsw_magnetometer_calibration_t *calibration, uint8_t *coverage)
+{
+    const float limit = MIN_COVERAGE * calibration->field_strength;
+    float out[3];
+    float error;
+    float sum = 0;
+
+    *coverage = 0;
+    for (int i = 0; i < reservoir_count; i++) {
+        zsw_magnetometer_calibration_apply(calibration, reservoir[i], out);
+        error = sqrtf(out[0] * out[0] + out[1] * out[1] + out[2] * out[2]) / calibration->field_strength - 1;
+        sum += error * error;
+        for (int axis = 0; axis < 3; axis++) {
+            if (out[axis] > limit) {
+                *coverage |= BIT(2 * axis);
+            } else if (out[axis] < -limit) {
+                *coverage |= BIT(2 * axis + 1);
+            }
+        }
+    }
+
+    return sqrtf(sum / reservoir_count);
+}
+
+static bool fit(zsw_magnetometer_calibration_t *calibration)
+{
+    const float *u = params;
+    float shape[3][3] = {
+        { u[0] + u[1] - 1, u[2], u[3] },
+        { u[2], u[0] - 2 * u[1] - 1, u[4] },
+        { u[3], u[4], u[1] - 2 * u[0] - 1 },
+    };
+    const float linear[3] = { u[5], u[6], u[7] };
+    float inverse[3][3];
+    float vectors[3][3];
+    float center[3];
+    float scale = u[8];
+    float radii[3];
+    float radius;
+    float residual;
+    uint8_t coverage;
+
+    if (!invert_3x3(shape, inverse)) {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        center[i] = -(inverse[i][0] * linear[0] + inverse[i][1] * linear[1] + inverse[i][2] * linear[2]);
+        scale += linear[i] * center[i];
+    }
+    if (fabsf(scale) < 1e-9f) {
+        return false;
+    }
+
+    // (x - center)' shape (x - center) = 1
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            shape[i][j] /= -scale;
+        }
+    }
+
+    eigen_symmetric_3x3(shape, vectors);
+    for (int i = 0; i < 3; i++) {
+        if (shape[i][i] <= 0) {
+            return false;
+        }
+        radii[i] = 1 / sqrtf(shape[i][i]);
+    }
+
+    // Scaled so the volume stays the same, the average field strength is kept.
+    radius = cbrtf(radii[0] * radii[1] * radii[2]);
+    if (MAX(radii[0], MAX(radii[1], radii[2])) > MAX_AXIS_RATIO * MIN(radii[0], MIN(radii[1], radii[2])) ||
+        radius * SCALE_UT < MIN_FIELD_UT || radius * SCALE_UT > MAX_FIELD_UT) {
+        return false;
+    }
+
+    // Soft iron is the symmetric square root, so the axes are not rotated.
+    for (int i = 0; i < 3; i++) {
+        calibration->hard_iron[i] = center[i] * SCALE_UT;
+        for (int j = 0; j < 3; j++) {
+            calibration->soft_iron[i][j] = 0;
+            for (int k = 0; k < 3; k++) {
+                calibration->soft_iron[i][j] += vectors[i][k] * (radius / radii[k]) * vectors[j][k];
+            }
+        }
+    }
+    calibration->field_strength = radius * SCALE_UT;
+
+    residual = get_residual(calibration, &coverage);
+    if (residual > MAX_RESIDUAL || coverage != COVERAGE_ALL) {
+        LOG_DBG("Fit rejected, residual %.3f, coverage 0x%02x", (double)residual, coverage);
+        return false;
+    }
+
+    LOG_DBG("Fit: hard iron %.1f %.1f %.1f uT, field %.1f uT, residual %.3f", (double)calibration->hard_iron[0],
+            (double)calibration->hard_iron[1], (double)calibration->hard_iron[2],
+            (double)calibration->field_strength, (double)residual);
+
+    return true;
+}
+
+bool zsw_magnetometer_calibration_add(const float sample[3], zsw_magnetometer_calibration_t *calibration)
+{
+    if (!is_new_sample(sample)) {
+        return false;
+    }
+
+    memcpy(reservoir[reservoir_next], sample, sizeof(reservoir[0]));
+    reservoir_next = (reservoir_next + 1) % RESERVOIR_SIZE;
+    reservoir_count = MIN(reservoir_count + 1, RESERVOIR_SIZE);
+    num_samples++;
+
+    rls_update(sample);
+
+    if (num_samples < MIN_SAMPLES) {
+        return false;
+    }
+
+    return fit(calibration);
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "sensors/zsw_magnetometer.h"
+
+/** @brief Forget all samples and start a new fit. The last fitted calibration is not changed. */
+void zsw_magnetometer_calibration_reset(void);
+
+/** @brief              Add a sample to the fit. Samples close to one already used are skipped, so
+ *                      a watch lying still only costs the distance checks.
+ *  @param sample       Uncalibrated sample in micro Tesla
+ *  @param calibration  Filled in when a new calibration is fitted
+ *  @return             true if calibration was filled in
+*/
+bool zsw_magnetometer_calibration_add(const float sample[3], zsw_magnetometer_calibration_t *calibration);
+
+/** @brief              Apply a calibration to a sample.
+ *  @param calibration  Calibration to apply
+ *  @param sample       Uncalibrated sample in micro Tesla
+ *  @param out          Calibrated sample
+*/
+void zsw_magnetometer_calibration_apply(const zsw_magnetometer_calibration_t *calibration, const float sample[3],
+                                        float out[3]);
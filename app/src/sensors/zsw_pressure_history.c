@@ -0,0 +1,330 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Barometric altitude history. The pressure sensor measures into its FIFO and the frames are
+ * processed in batches, so the CPU sleeps between drains. Every frame updates a filtered
+ * altitude. Floors are counted when it changes one floor height quickly enough to not be
+ * weather. One sample per interval is kept in a zsw_history. Its buffer is stored in blocks
+ * of samples, each under its own settings key, so a new sample only rewrites its block and
+ * the write position instead of the whole week.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+
+#include "history/zsw_history.h"
+#include "sensors/zsw_pressure_sensor.h"
+#include "sensors/zsw_pressure_history.h"
+
+LOG_MODULE_REGISTER(zsw_pressure_history, CONFIG_ZSW_SENSORS_LOG_LEVEL);
+
+#define SETTING_PRESSURE_HIST       "pressure/hist"
+#define SAMPLE_INTERVAL_MIN         15
+#define SAMPLE_INTERVAL_MS          (SAMPLE_INTERVAL_MIN * 60 * 1000)
+#define MAX_SAMPLES                 (7 * 24 * (60 / SAMPLE_INTERVAL_MIN)) // One week of 15 minute samples
+#define BLOCK_SAMPLES               24 // Six hours of samples per settings key
+#define NUM_BLOCKS                  (MAX_SAMPLES / BLOCK_SAMPLES)
+#define SETTING_KEY_LEN             (sizeof(SETTING_PRESSURE_HIST) + 8)
+
+BUILD_ASSERT(MAX_SAMPLES % BLOCK_SAMPLES == 0, "History must be a whole number of blocks");
+
+// A frame every 4 s, delivered 30 at a time. About 2 m of change delivers them early so
+// stairs are picked up without waiting for the FIFO to fill.
+#define FIFO_FRAME_PERIOD_MS        4000
+#define FIFO_THRESHOLD              30
+#define FIFO_WINDOW_PA              24
+
+#define SEA_LEVEL_PRESSURE_PA       101325.0f
+#define ALTITUDE_FILTER_WEIGHT      0.3f
+// Altitude changes smaller than this are sensor noise.
+#define ALTITUDE_HYSTERESIS_M       1.0f
+#define FLOOR_HEIGHT_M              3.0f
+// Climbing a floor slower than this is weather or a ramp, not stairs.
+#define FLOOR_MAX_DURATION_MS       (60 * 1000)
+
+typedef struct stored_position_t {
+    uint32_t write_index;
+    uint32_t num_samples;
+} stored_position_t;
+
+static void store_work_handler(struct k_work *item);
+
+static K_WORK_DEFINE(store_work, store_work_handler);
+
+static zsw_pressure_history_sample_t samples[MAX_SAMPLES];
+static zsw_history_t history_context;
+
+static struct k_spinlock lock;
+static zsw_pressure_history_status_t status;
+static bool has_altitude;
+static float climb_ref_m;
+static float floor_ref_m;
+static int64_t floor_ref_ms;
+
+static int64_t interval_start_ms;
+static float interval_pressure_sum;
+static uint32_t interval_num_frames;
+static uint8_t interval_floors_up;
+static uint8_t interval_floors_down;
+
+float zsw_pressure_history_altitude_m(float pressure)
+{
+    return 44330.0f * (1.0f - powf(pressure / SEA_LEVEL_PRESSURE_PA, 1.0f / 5.255f));
+}
+
+// Called with the lock held.
+static void add_frame(int64_t time_ms, float pressure)
+{
+    float altitude = zsw_pressure_history_altitude_m(pressure);
+    float delta;
+
+    if (!has_altitude) {
+        has_altitude = true;
+        status.altitude_m = altitude;
+        climb_ref_m = altitude;
+        floor_ref_m = altitude;
+        floor_ref_ms = time_ms;
+    }
+
+    status.altitude_m += ALTITUDE_FILTER_WEIGHT * (altitude - status.altitude_m);
+    interval_pressure_sum += pressure;
+    interval_num_frames++;
+
+    delta = status.altitude_m - climb_ref_m;
+    if (delta >= ALTITUDE_HYSTERESIS_M) {
+        status.ascent_m += delta;
+        climb_ref_m = status.altitude_m;
+    } else if (delta <= -ALTITUDE_HYSTERESIS_M) {
+        status.descent_m -= delta;
+        climb_ref_m = status.altitude_m;
+    }
+
+    delta = status.altitude_m - floor_ref_m;
+    if (fabsf(delta) >= FLOOR_HEIGHT_M && (time_ms - floor_ref_ms) <= FLOOR_MAX_DURATION_MS) {
+        if (delta > 0) {
+            status.floors_up++;
+            interval_floors_up = MIN(interval_floors_up + 1, UINT8_MAX);
+            floor_ref_m += FLOOR_HEIGHT_M;
+        } else {
+            status.floors_down++;
+            interval_floors_down = MIN(interval_floors_down + 1, UINT8_MAX);
+            floor_ref_m -= FLOOR_HEIGHT_M;
+        }
+        floor_ref_ms = time_ms;
+    } else if ((time_ms - floor_ref_ms) > FLOOR_MAX_DURATION_MS) {
+        floor_ref_m = status.altitude_m;
+        floor_ref_ms = time_ms;
+    }
+}
+
+static void on_pressure_frames(const float *pressure, uint8_t count, uint32_t frame_period_ms)
+{
+    int64_t now = k_uptime_get();
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < count; i++) {
+        add_frame(now - (int64_t)(count - 1 - i) * frame_period_ms, pressure[i]);
+    }
+
+    if ((now - interval_start_ms) >= SAMPLE_INTERVAL_MS) {
+        k_work_submit(&store_work);
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static int save_block(uint32_t block)
+{
+    char key[SETTING_KEY_LEN];
+
+    snprintf(key, sizeof(key), "%s/%u", SETTING_PRESSURE_HIST, block);
+
+    return settings_save_one(key, &samples[block * BLOCK_SAMPLES], BLOCK_SAMPLES * sizeof(samples[0]));
+}
+
+static int save_position(void)
+{
+    stored_position_t position = {
+        .write_index = history_context.write_index,
+        .num_samples = history_context.num_samples,
+    };
+
+    return settings_save_one(SETTING_PRESSURE_HIST "/pos", &position, sizeof(position));
+}
+
+static int load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg, void *param)
+{
+    stored_position_t position;
+    char *end;
+    unsigned long block;
+
+    ARG_UNUSED(param);
+
+    if (key == NULL) {
+        return 0;
+    }
+
+    if (strcmp(key, "pos") == 0) {
+        if (len != sizeof(position) ||
+            read_cb(cb_arg, &position, sizeof(position)) != (ssize_t)sizeof(position) ||
+            position.write_index >= MAX_SAMPLES || position.num_samples > MAX_SAMPLES) {
+            LOG_ERR("Invalid history position");
+            return 0;
+        }
+        history_context.write_index = position.write_index;
+        history_context.num_samples = position.num_samples;
+        return 0;
+    }
+
+    block = strtoul(key, &end, 10);
+    if (*end != '\0' || block >= NUM_BLOCKS || len != BLOCK_SAMPLES * sizeof(samples[0])) {
+        // Left by an older layout, or a history of another size.
+        return 0;
+    }
+    if (read_cb(cb_arg, &samples[block * BLOCK_SAMPLES], len) != (ssize_t)len) {
+        LOG_ERR("Failed to read history block %lu", block);
+        memset(&samples[block * BLOCK_SAMPLES], 0, BLOCK_SAMPLES * sizeof(samples[0]));
+    }
+
+    return 0;
+}
+
+static void store_work_handler(struct k_work *item)
+{
+    uint32_t block;
+    zsw_pressure_history_sample_t sample;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (interval_num_frames == 0) {
+        k_spin_unlock(&lock, key);
+        return;
+    }
+
+    sample.pressure = CLAMP(interval_pressure_sum / interval_num_frames / 2, 0, UINT16_MAX);
+    sample.floors_up = interval_floors_up;
+    sample.floors_down = interval_floors_down;
+
+    interval_start_ms = k_uptime_get();
+    interval_pressure_sum = 0;
+    interval_num_frames = 0;
+    interval_floors_up = 0;
+    interval_floors_down = 0;
+    k_spin_unlock(&lock, key);
+
+    block = history_context.write_index / BLOCK_SAMPLES;
+    zsw_history_add(&history_context, &sample);
+    // Block first, so a reset in between never points the position at samples not stored.
+    if (save_block(block) || save_position()) {
+        LOG_ERR("Error during saving of pressure samples!");
+    }
+}
+
+int zsw_pressure_history_init(void)
+{
+    int ret;
+
+    zsw_history_init(&history_context, MAX_SAMPLES, sizeof(zsw_pressure_history_sample_t), samples,
+                     SETTING_PRESSURE_HIST);
+
+    if (settings_load_subtree_direct(SETTING_PRESSURE_HIST, load_cb, NULL)) {
+        LOG_ERR("Error during settings_load_subtree!");
+    }
+
+    interval_start_ms = k_uptime_get();
+
+    ret = zsw_pressure_sensor_fifo_start(FIFO_FRAME_PERIOD_MS, FIFO_THRESHOLD, FIFO_WINDOW_PA, on_pressure_frames);
+    if (ret != 0) {
+        LOG_ERR("Failed to start pressure FIFO: %d", ret);
+    }
+
+    return ret;
+}
+
+int zsw_pressure_history_samples(void)
+{
+    return zsw_history_samples(&history_context);
+}
+
+void zsw_pressure_history_get(zsw_pressure_history_sample_t *sample, uint32_t index)
+{
+    zsw_history_get(&history_context, sample, index);
+}
+
+int zsw_pressure_history_get_status(zsw_pressure_history_status_t *p_status)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    int ret = has_altitude ? 0 : -ENODATA;
+
+    *p_status = status;
+    k_spin_unlock(&lock, key);
+
+    return ret;
+}
+
+void zsw_pressure_history_clear(void)
+{
+    char key[SETTING_KEY_LEN];
+    int ret = 0;
+
+    zsw_history_init(&history_context, MAX_SAMPLES, sizeof(zsw_pressure_history_sample_t), samples,
+                     SETTING_PRESSURE_HIST);
+
+    ret |= settings_delete(SETTING_PRESSURE_HIST "/pos");
+    for (int i = 0; i < NUM_BLOCKS; i++) {
+        snprintf(key, sizeof(key), "%s/%d", SETTING_PRESSURE_HIST, i);
+        ret |= settings_delete(key);
+    }
+    if (ret != 0) {
+        LOG_ERR("Error during settings_delete!");
+    }
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_pressure_history(const struct shell *sh, size_t argc, char **argv)
+{
+    zsw_pressure_history_status_t current;
+    zsw_pressure_history_sample_t sample;
+    int num_samples = zsw_pressure_history_samples();
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    if (zsw_pressure_history_get_status(&current) == 0) {
+        shell_print(sh, "pressure_history altitude_m=%.1f ascent_m=%.1f descent_m=%.1f floors_up=%u floors_down=%u",
+                    (double)current.altitude_m, (double)current.ascent_m, (double)current.descent_m,
+                    current.floors_up, current.floors_down);
+    }
+
+    shell_print(sh, "pressure_history samples=%d interval_min=%d", num_samples, SAMPLE_INTERVAL_MIN);
+    for (int i = 0; i < num_samples; i++) {
+        zsw_pressure_history_get(&sample, i);
+        shell_print(sh, "pressure_history index=%d pressure_pa=%u floors_up=%u floors_down=%u", i,
+                    sample.pressure * 2, sample.floors_up, sample.floors_down);
+    }
+
+    return 0;
+}
+
+SHELL_CMD_REGISTER(pressure_history, NULL, "Barometric altitude and floors history", cmd_pressure_history);
+#endif
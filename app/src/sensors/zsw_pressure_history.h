@@ -0,0 +1,68 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** @brief One history sample per interval. */
+typedef struct zsw_pressure_history_sample_t {
+    uint16_t pressure;      // Mean over the interval in 2 Pa steps
+    uint8_t floors_up;
+    uint8_t floors_down;
+} zsw_pressure_history_sample_t;
+
+typedef struct zsw_pressure_history_status_t {
+    // From the standard atmosphere, so only differences are accurate without calibration.
+    float altitude_m;
+    // Since boot, changes below the noise level are not counted.
+    float ascent_m;
+    float descent_m;
+    uint32_t floors_up;
+    uint32_t floors_down;
+} zsw_pressure_history_status_t;
+
+/** @brief  Load the history and start logging pressure from the sensor FIFO.
+ *  @return 0 on success
+*/
+int zsw_pressure_history_init(void);
+
+/** @brief  Get the number of stored samples.
+ *  @return Number of samples
+*/
+int zsw_pressure_history_samples(void);
+
+/** @brief          Get a stored sample, oldest first.
+ *  @param sample   Sample to fill in
+ *  @param index    Index below zsw_pressure_history_samples()
+*/
+void zsw_pressure_history_get(zsw_pressure_history_sample_t *sample, uint32_t index);
+
+/** @brief          Get the live altitude and what was climbed since boot.
+ *  @param status   Status to fill in
+ *  @return         0 on success, -ENODATA before the first pressure frames arrived
+*/
+int zsw_pressure_history_get_status(zsw_pressure_history_status_t *status);
+
+/** @brief          Altitude from pressure using the standard atmosphere.
+ *  @param pressure Pressure in Pa
+ *  @return         Altitude in meters
+*/
+float zsw_pressure_history_altitude_m(float pressure);
+
+/** @brief Clear the stored samples. */
+void zsw_pressure_history_clear(void);
@@ -15,50 +15,270 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
-#include <zephyr/zbus/zbus.h>
+#include <zephyr/pm/device.h>
 
-#include "events/pressure_event.h"
-#include "events/zsw_periodic_event.h"
 #include "sensors/zsw_pressure_sensor.h"
 
 LOG_MODULE_REGISTER(zsw_pressure_sensor, CONFIG_ZSW_SENSORS_LOG_LEVEL);
 
-static void zbus_periodic_10s_callback(const struct zbus_channel *chan);
+typedef struct odr_entry_t {
+    uint32_t period_ms;
+    uint8_t odr;
+} odr_entry_t;
+
+static void fifo_drain_work_handler(struct k_work *item);
 
-ZBUS_CHAN_DECLARE(pressure_data_chan);
-ZBUS_CHAN_DECLARE(periodic_event_10s_chan);
-ZBUS_LISTENER_DEFINE(zsw_pressure_sensor_perioidc_lis, zbus_periodic_10s_callback);
 static const struct device *const bmp581 = DEVICE_DT_GET_OR_NULL(DT_NODELABEL(bmp581));
 
-static void zbus_periodic_10s_callback(const struct zbus_channel *chan)
+// Slowest first, the first one fast enough for the requested interval is used.
+static const odr_entry_t odr_table[] = {
+    { 8000, BOSCH_BMP581_ODR_0_125_HZ },
+    { 4000, BOSCH_BMP581_ODR_0_250_HZ },
+    { 2000, BOSCH_BMP581_ODR_0_5_HZ },
+    { 1000, BOSCH_BMP581_ODR_01_HZ },
+    { 500, BOSCH_BMP581_ODR_02_HZ },
+    { 200, BOSCH_BMP581_ODR_05_HZ },
+    { 100, BOSCH_BMP581_ODR_10_HZ },
+    { 50, BOSCH_BMP581_ODR_20_HZ },
+    { 20, BOSCH_BMP581_ODR_50_HZ },
+    { 10, BOSCH_BMP581_ODR_100_2_HZ },
+};
+
+static K_MUTEX_DEFINE(sensor_mutex);
+static K_WORK_DELAYABLE_DEFINE(fifo_drain_work, fifo_drain_work_handler);
+
+static struct sensor_trigger fifo_trigger = {
+    .type = SENSOR_TRIG_FIFO_WATERMARK,
+    .chan = SENSOR_CHAN_ALL,
+};
+
+static struct sensor_trigger window_trigger = {
+    .type = SENSOR_TRIG_THRESHOLD,
+    .chan = SENSOR_CHAN_PRESS,
+};
+
+// Interval the sensor hub fetches at, 0 when it doesn't.
+static uint32_t sample_interval_ms;
+
+static zsw_pressure_sensor_fifo_cb fifo_cb;
+static uint32_t fifo_wanted_period_ms;
+// Period of the frames in the FIFO, depends on the ODR the hub needs. 0 when the FIFO is off.
+static uint32_t fifo_frame_period_ms;
+static uint8_t fifo_threshold;
+static int32_t window_pa;
+static bool has_trigger;
+
+// Only used with the mutex held, too large for the callers' stacks.
+static struct sensor_value fifo_values[BOSCH_BMP581_FIFO_MAX_FRAMES + 1];
+static float fifo_pressure[BOSCH_BMP581_FIFO_MAX_FRAMES];
+
+static const odr_entry_t *odr_for_interval(uint32_t interval_ms)
 {
-    float pressure;
-    float temperature;
+    for (int i = 0; i < ARRAY_SIZE(odr_table); i++) {
+        if (odr_table[i].period_ms <= interval_ms) {
+            return &odr_table[i];
+        }
+    }
+
+    return &odr_table[ARRAY_SIZE(odr_table) - 1];
+}
+
+static int set_attr(enum sensor_channel chan, int attr, int32_t value)
+{
+    struct sensor_value sensor_val = {
+        .val1 = value,
+    };
 
-    if (zsw_pressure_sensor_get_pressure(&pressure) || zsw_pressure_sensor_get_temperature(&temperature)) {
+    if (sensor_attr_set(bmp581, chan, (enum sensor_attribute)attr, &sensor_val) != 0) {
+        return -EIO;
+    }
+
+    return 0;
+}
+
+static void set_window(float center)
+{
+    if (window_pa == 0 || !has_trigger) {
         return;
     }
 
-    LOG_INF("Pressure: %.2f hPa, Temperature: %.2f C", pressure, temperature);
+    if (set_attr(SENSOR_CHAN_PRESS, SENSOR_ATTR_LOWER_THRESH, (int32_t)center - window_pa) != 0 ||
+        set_attr(SENSOR_CHAN_PRESS, SENSOR_ATTR_UPPER_THRESH, (int32_t)center + window_pa) != 0) {
+        LOG_WRN("Failed to move pressure window");
+    }
+}
 
-    struct pressure_event evt = {
-        .pressure = pressure,
-        .temperature = temperature
-    };
-    zbus_chan_pub(&pressure_data_chan, &evt, K_MSEC(250));
+// Called with the mutex held.
+static void drain_fifo(void)
+{
+    int count;
+
+    if (fifo_frame_period_ms == 0 || fifo_cb == NULL) {
+        return;
+    }
+
+    if (sensor_sample_fetch_chan(bmp581, SENSOR_CHAN_BMP581_FIFO) != 0 ||
+        sensor_channel_get(bmp581, SENSOR_CHAN_BMP581_FIFO, fifo_values) != 0) {
+        LOG_WRN("Failed to drain FIFO");
+        return;
+    }
+
+    count = fifo_values[0].val1;
+    for (int i = 0; i < count; i++) {
+        fifo_pressure[i] = sensor_value_to_float(&fifo_values[1 + i]);
+    }
+
+    LOG_DBG("Drained %d frames", count);
+
+    if (count > 0) {
+        set_window(fifo_pressure[count - 1]);
+        fifo_cb(fifo_pressure, count, fifo_frame_period_ms);
+    }
+
+    if (!has_trigger) {
+        k_work_reschedule(&fifo_drain_work, K_MSEC(fifo_frame_period_ms * fifo_threshold));
+    }
+}
+
+static void fifo_drain_work_handler(struct k_work *item)
+{
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    drain_fifo();
+    k_mutex_unlock(&sensor_mutex);
+}
+
+static void on_trigger(const struct device *dev, const struct sensor_trigger *trigger)
+{
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    drain_fifo();
+    k_mutex_unlock(&sensor_mutex);
+}
+
+// Called with the mutex held.
+static int read_sample(float *pressure, float *temperature)
+{
+    struct sensor_value sensor_val;
+
+    if (sensor_sample_fetch(bmp581) != 0) {
+        return -ENODATA;
+    }
+
+    if (pressure) {
+        if (sensor_channel_get(bmp581, SENSOR_CHAN_PRESS, &sensor_val) != 0) {
+            return -ENODATA;
+        }
+        *pressure = sensor_value_to_float(&sensor_val);
+    }
+
+    if (temperature) {
+        if (sensor_channel_get(bmp581, SENSOR_CHAN_AMBIENT_TEMP, &sensor_val) != 0) {
+            return -ENODATA;
+        }
+        *temperature = sensor_value_to_float(&sensor_val);
+    }
+
+    return 0;
+}
+
+// Called with the mutex held. Runs the sensor at the fastest rate needed by the sensor hub and the
+// FIFO, the FIFO is decimated to stay close to its own rate.
+static int apply_config(uint32_t *first_sample_ms)
+{
+    uint32_t interval_ms = UINT32_MAX;
+    const odr_entry_t *entry;
+    uint8_t decimation = 0;
+    int ret;
+
+    // Frames in the FIFO were taken at the old rate, and configuring it clears it.
+    drain_fifo();
+
+    if (sample_interval_ms == 0 && fifo_cb == NULL) {
+        fifo_frame_period_ms = 0;
+        k_work_cancel_delayable(&fifo_drain_work);
+        set_attr(SENSOR_CHAN_ALL, SENSOR_ATTR_BMP581_FIFO_THRESHOLD, 0);
+
+        ret = pm_device_action_run(bmp581, PM_DEVICE_ACTION_SUSPEND);
+        if (ret != 0 && ret != -EALREADY) {
+            LOG_ERR("Failed to suspend BMP581: %d", ret);
+            return -EFAULT;
+        }
+        return 0;
+    }
+
+    if (sample_interval_ms != 0) {
+        interval_ms = sample_interval_ms;
+    }
+    if (fifo_cb != NULL) {
+        interval_ms = MIN(interval_ms, fifo_wanted_period_ms);
+    }
+    entry = odr_for_interval(interval_ms);
+
+    ret = pm_device_action_run(bmp581, PM_DEVICE_ACTION_RESUME);
+    if (ret != 0 && ret != -EALREADY) {
+        LOG_ERR("Failed to resume BMP581: %d", ret);
+        return -EFAULT;
+    }
+
+    ret = zsw_pressure_sensor_set_odr(entry->odr);
+    if (ret != 0) {
+        return ret;
+    }
+
+    if (fifo_cb != NULL) {
+        while (decimation < 7 && (entry->period_ms << (decimation + 1)) <= fifo_wanted_period_ms) {
+            decimation++;
+        }
+        if (set_attr(SENSOR_CHAN_ALL, SENSOR_ATTR_BMP581_FIFO_DECIMATION, decimation) != 0 ||
+            set_attr(SENSOR_CHAN_ALL, SENSOR_ATTR_BMP581_FIFO_THRESHOLD, fifo_threshold) != 0) {
+            LOG_ERR("Failed to configure FIFO");
+            return -EIO;
+        }
+        fifo_frame_period_ms = entry->period_ms << decimation;
+        if (!has_trigger) {
+            k_work_reschedule(&fifo_drain_work, K_MSEC(fifo_frame_period_ms * fifo_threshold));
+        }
+    } else if (fifo_frame_period_ms != 0) {
+        fifo_frame_period_ms = 0;
+        k_work_cancel_delayable(&fifo_drain_work);
+        set_attr(SENSOR_CHAN_ALL, SENSOR_ATTR_BMP581_FIFO_THRESHOLD, 0);
+    }
+
+    LOG_DBG("ODR period %u ms, FIFO frame period %u ms", entry->period_ms, fifo_frame_period_ms);
+
+    if (first_sample_ms) {
+        *first_sample_ms = entry->period_ms;
+    }
+
+    return 0;
 }
 
 int zsw_pressure_sensor_init(void)
 {
+    int ret;
+
     if (!device_is_ready(bmp581)) {
         return -ENODEV;
     }
 
-    zsw_periodic_chan_add_obs(&periodic_event_10s_chan, &zsw_pressure_sensor_perioidc_lis);
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    // The sensor hub or a FIFO user may have started it already, don't undo their configuration.
+    if (sample_interval_ms != 0 || fifo_cb != NULL) {
+        k_mutex_unlock(&sensor_mutex);
+        return 0;
+    }
 
     zsw_pressure_sensor_set_odr(BOSCH_BMP581_ODR_DEFAULT);
 
+    // Kept in standby until someone subscribes to it in the sensor hub.
+    ret = pm_device_action_run(bmp581, PM_DEVICE_ACTION_SUSPEND);
+    k_mutex_unlock(&sensor_mutex);
+    if (ret != 0 && ret != -EALREADY) {
+        LOG_ERR("Failed to suspend BMP581: %d", ret);
+        return -EFAULT;
+    }
+
     return 0;
 }
 
@@ -79,44 +299,109 @@ int zsw_pressure_sensor_set_odr(uint8_t odr)
     return 0;
 }
 
-int zsw_pressure_sensor_get_pressure(float *pressure)
+int zsw_pressure_sensor_start(uint32_t interval_ms, uint32_t *first_sample_ms)
 {
-    struct sensor_value sensor_val;
+    int ret;
 
     if (!device_is_ready(bmp581)) {
         return -ENODEV;
     }
 
-    if (sensor_sample_fetch(bmp581) != 0) {
-        return -ENODATA;
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    sample_interval_ms = interval_ms;
+    ret = apply_config(first_sample_ms);
+    k_mutex_unlock(&sensor_mutex);
+
+    return ret;
+}
+
+int zsw_pressure_sensor_stop(void)
+{
+    int ret;
+
+    if (!device_is_ready(bmp581)) {
+        return -ENODEV;
     }
 
-    if (sensor_channel_get(bmp581, SENSOR_CHAN_PRESS, &sensor_val) != 0) {
-        return -ENODATA;
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    sample_interval_ms = 0;
+    ret = apply_config(NULL);
+    k_mutex_unlock(&sensor_mutex);
+
+    return ret;
+}
+
+int zsw_pressure_sensor_fifo_start(uint32_t frame_period_ms, uint8_t threshold, uint16_t window,
+                                   zsw_pressure_sensor_fifo_cb cb)
+{
+    int ret;
+
+    if (!device_is_ready(bmp581)) {
+        return -ENODEV;
     }
 
-    *pressure = sensor_value_to_float(&sensor_val);
+    if (cb == NULL || frame_period_ms == 0 || threshold == 0 || threshold >= BOSCH_BMP581_FIFO_MAX_FRAMES ||
+        window > BOSCH_BMP581_THRESHOLD_MAX_RANGE) {
+        return -EINVAL;
+    }
 
-    return 0;
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+
+    has_trigger = sensor_trigger_set(bmp581, &fifo_trigger, on_trigger) == 0;
+    if (has_trigger && window > 0 && sensor_trigger_set(bmp581, &window_trigger, on_trigger) != 0) {
+        window = 0;
+    }
+    LOG_DBG("FIFO %s interrupt", has_trigger ? "with" : "without");
+
+    fifo_cb = cb;
+    fifo_wanted_period_ms = frame_period_ms;
+    fifo_threshold = threshold;
+    window_pa = window;
+    ret = apply_config(NULL);
+    if (ret != 0) {
+        fifo_cb = NULL;
+    }
+
+    k_mutex_unlock(&sensor_mutex);
+
+    return ret;
 }
 
-int zsw_pressure_sensor_get_temperature(float *temperature)
+int zsw_pressure_sensor_fifo_stop(void)
 {
-    struct sensor_value sensor_val;
+    int ret;
 
     if (!device_is_ready(bmp581)) {
         return -ENODEV;
     }
 
-    if (sensor_sample_fetch(bmp581) != 0) {
-        return -ENODATA;
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+
+    if (has_trigger) {
+        sensor_trigger_set(bmp581, &fifo_trigger, NULL);
+        sensor_trigger_set(bmp581, &window_trigger, NULL);
     }
 
-    if (sensor_channel_get(bmp581, SENSOR_CHAN_AMBIENT_TEMP, &sensor_val) != 0) {
-        return -ENODATA;
+    drain_fifo();
+    fifo_cb = NULL;
+    ret = apply_config(NULL);
+
+    k_mutex_unlock(&sensor_mutex);
+
+    return ret;
+}
+
+int zsw_pressure_sensor_fetch(float *pressure, float *temperature)
+{
+    int ret;
+
+    if (!device_is_ready(bmp581)) {
+        return -ENODEV;
     }
 
-    *temperature = sensor_value_to_float(&sensor_val);
+    k_mutex_lock(&sensor_mutex, K_FOREVER);
+    ret = read_sample(pressure, temperature);
+    k_mutex_unlock(&sensor_mutex);
 
-    return 0;
+    return ret;
 }
@@ -21,10 +21,47 @@
 
 #include "../../drivers/sensor/bmp581/zsw_bosch_bmp581.h"
 
+/** @brief                  Called with FIFO frames, oldest first. The newest was measured about now.
+ *  @param pressure         Pressure in Pa
+ *  @param count            Number of frames
+ *  @param frame_period_ms  Time between the frames
+*/
+typedef void (*zsw_pressure_sensor_fifo_cb)(const float *pressure, uint8_t count, uint32_t frame_period_ms);
+
 int zsw_pressure_sensor_init(void);
 
 int zsw_pressure_sensor_set_odr(uint8_t odr);
 
-int zsw_pressure_sensor_get_pressure(float *pressure);
+/** @brief                  Take the sensor out of standby with an ODR fast enough for the interval.
+ *                          Used by the sensor hub, others subscribe there instead.
+ *  @param interval_ms      Fastest interval samples are fetched at
+ *  @param first_sample_ms  Set to the time until the first measurement is ready, can be NULL
+ *  @return                 0 on success
+*/
+int zsw_pressure_sensor_start(uint32_t interval_ms, uint32_t *first_sample_ms);
+
+int zsw_pressure_sensor_stop(void);
+
+/** @brief                  Keep the sensor measuring into its FIFO and get the frames in batches, without waking
+ *                          up the CPU for every measurement. The frame period can be shorter while the sensor hub
+ *                          needs a higher rate. Without an interrupt pin the FIFO is drained by a timer instead.
+ *  @param frame_period_ms  Wanted time between frames
+ *  @param threshold        Frames to collect before they are delivered, below BOSCH_BMP581_FIFO_MAX_FRAMES
+ *  @param window           Deliver early when the pressure moves this many Pa from the last frame, 0 to disable
+ *  @param cb               Called with the frames, from the system workqueue or the thread starting the hub
+ *  @return                 0 on success
+*/
+int zsw_pressure_sensor_fifo_start(uint32_t frame_period_ms, uint8_t threshold, uint16_t window,
+                                   zsw_pressure_sensor_fifo_cb cb);
+
+/** @brief  Deliver what is left in the FIFO and stop it.
+ *  @return 0 on success
+*/
+int zsw_pressure_sensor_fifo_stop(void);
 
-int zsw_pressure_sensor_get_temperature(float *temperature);
+/** @brief              Read pressure and temperature from the same measurement.
+ *  @param pressure     Pressure in Pa, can be NULL
+ *  @param temperature  Temperature in C, can be NULL
+ *  @return             0 on success, -ENODATA if the sensor is in standby or the read failed
+*/
+int zsw_pressure_sensor_fetch(float *pressure, float *temperature);
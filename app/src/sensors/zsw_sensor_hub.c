@@ -0,0 +1,282 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Samples the environment sensors at the rate their subscribers ask for. A sensor without
+ * subscribers is put in standby and not fetched. All due sensors are fetched in the same
+ * wakeup, a sensor that is due soon is fetched early instead of waking up again when that
+ * stays within the latency its subscribers accept.
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+
+#include "sensors/zsw_sensor_hub.h"
+#include "sensors/zsw_pressure_sensor.h"
+#include "sensors/zsw_light_sensor.h"
+#include "events/pressure_event.h"
+#include "events/light_event.h"
+
+LOG_MODULE_REGISTER(zsw_sensor_hub, CONFIG_ZSW_SENSORS_LOG_LEVEL);
+
+typedef struct hub_sensor_t {
+    const char *name;
+    int (*start)(uint32_t interval_ms, uint32_t *first_sample_ms);
+    int (*stop)(void);
+    int (*sample)(void);
+    sys_slist_t subs;
+    bool running;
+    uint32_t interval_ms;
+    uint32_t latency_ms;
+    int64_t due_ms;
+    uint32_t num_samples;
+    uint32_t num_errors;
+} hub_sensor_t;
+
+static int sample_pressure(void);
+static int sample_light(void);
+static void hub_work_handler(struct k_work *item);
+
+ZBUS_CHAN_DECLARE(pressure_data_chan);
+ZBUS_CHAN_DECLARE(light_data_chan);
+
+static K_MUTEX_DEFINE(hub_mutex);
+static K_WORK_DELAYABLE_DEFINE(hub_work, hub_work_handler);
+
+static hub_sensor_t sensors[ZSW_SENSOR_HUB_NUM_SENSORS] = {
+    [ZSW_SENSOR_HUB_PRESSURE] = {
+        .name = "pressure",
+        .start = zsw_pressure_sensor_start,
+        .stop = zsw_pressure_sensor_stop,
+        .sample = sample_pressure,
+    },
+    [ZSW_SENSOR_HUB_LIGHT] = {
+        // Measures on fetch, nothing to start or stop.
+        .name = "light",
+        .sample = sample_light,
+    },
+};
+
+static int sample_pressure(void)
+{
+    struct pressure_event evt;
+    int ret;
+
+    ret = zsw_pressure_sensor_fetch(&evt.pressure, &evt.temperature);
+    if (ret != 0) {
+        return ret;
+    }
+
+    return zbus_chan_pub(&pressure_data_chan, &evt, K_MSEC(250));
+}
+
+static int sample_light(void)
+{
+    struct light_event evt;
+    int ret;
+
+    ret = zsw_light_sensor_get_light(&evt.light);
+    if (ret != 0) {
+        return ret;
+    }
+
+    return zbus_chan_pub(&light_data_chan, &evt, K_MSEC(250));
+}
+
+// Wake up when the first running sensor is due.
+static void reschedule(void)
+{
+    int64_t wakeup_ms = INT64_MAX;
+
+    for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+        if (sensors[i].running) {
+            wakeup_ms = MIN(wakeup_ms, sensors[i].due_ms);
+        }
+    }
+
+    if (wakeup_ms == INT64_MAX) {
+        k_work_cancel_delayable(&hub_work);
+        return;
+    }
+
+    k_work_reschedule(&hub_work, K_MSEC(MAX(wakeup_ms - k_uptime_get(), 0)));
+}
+
+static void hub_work_handler(struct k_work *item)
+{
+    hub_sensor_t *sensor;
+    int64_t now;
+
+    k_mutex_lock(&hub_mutex, K_FOREVER);
+
+    now = k_uptime_get();
+    for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+        sensor = &sensors[i];
+        // Take the sample early if it is due within the latency the subscribers accept.
+        if (!sensor->running || sensor->due_ms > now + sensor->latency_ms) {
+            continue;
+        }
+        if (sensor->sample() == 0) {
+            sensor->num_samples++;
+        } else {
+            sensor->num_errors++;
+            LOG_DBG("Sampling %s failed", sensor->name);
+        }
+        // Keep the cadence when sampled early, don't catch up on missed samples.
+        sensor->due_ms += sensor->interval_ms;
+        if (sensor->due_ms <= now) {
+            sensor->due_ms = now + sensor->interval_ms;
+        }
+    }
+
+    reschedule();
+
+    k_mutex_unlock(&hub_mutex);
+}
+
+// Start, re-rate or stop the sensor from its subscribers.
+static int update_sensor(hub_sensor_t *sensor)
+{
+    zsw_sensor_hub_sub_t *sub;
+    uint32_t interval_ms = UINT32_MAX;
+    uint32_t latency_ms = UINT32_MAX;
+    uint32_t first_sample_ms = 0;
+    int64_t now = k_uptime_get();
+    int ret;
+
+    if (sys_slist_is_empty(&sensor->subs)) {
+        if (sensor->running && sensor->stop) {
+            sensor->stop();
+        }
+        sensor->running = false;
+        return 0;
+    }
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&sensor->subs, sub, node) {
+        interval_ms = MIN(interval_ms, sub->interval_ms);
+        latency_ms = MIN(latency_ms, sub->latency_ms);
+    }
+
+    sensor->latency_ms = latency_ms;
+    if (sensor->running && sensor->interval_ms == interval_ms) {
+        return 0;
+    }
+
+    if (sensor->start) {
+        ret = sensor->start(interval_ms, &first_sample_ms);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    if (sensor->running) {
+        sensor->due_ms = MIN(sensor->due_ms, now + MAX(interval_ms, first_sample_ms));
+    } else {
+        sensor->due_ms = now + first_sample_ms;
+    }
+    sensor->interval_ms = interval_ms;
+    sensor->running = true;
+
+    LOG_DBG("%s interval %u ms latency %u ms", sensor->name, interval_ms, latency_ms);
+
+    return 0;
+}
+
+int zsw_sensor_hub_subscribe(zsw_sensor_hub_sub_t *sub)
+{
+    hub_sensor_t *sensor;
+    sys_snode_t *prev;
+    int ret;
+
+    if (sub == NULL || sub->sensor >= ZSW_SENSOR_HUB_NUM_SENSORS || sub->interval_ms == 0) {
+        return -EINVAL;
+    }
+
+    sensor = &sensors[sub->sensor];
+
+    k_mutex_lock(&hub_mutex, K_FOREVER);
+
+    if (!sys_slist_find(&sensor->subs, &sub->node, &prev)) {
+        sys_slist_append(&sensor->subs, &sub->node);
+    }
+
+    ret = update_sensor(sensor);
+    if (ret != 0) {
+        LOG_ERR("Failed to start %s: %d", sensor->name, ret);
+        sys_slist_find_and_remove(&sensor->subs, &sub->node);
+        update_sensor(sensor);
+    }
+
+    reschedule();
+
+    k_mutex_unlock(&hub_mutex);
+
+    return ret;
+}
+
+void zsw_sensor_hub_unsubscribe(zsw_sensor_hub_sub_t *sub)
+{
+    hub_sensor_t *sensor;
+
+    if (sub == NULL || sub->sensor >= ZSW_SENSOR_HUB_NUM_SENSORS) {
+        return;
+    }
+
+    sensor = &sensors[sub->sensor];
+
+    k_mutex_lock(&hub_mutex, K_FOREVER);
+
+    if (sys_slist_find_and_remove(&sensor->subs, &sub->node)) {
+        update_sensor(sensor);
+        reschedule();
+    }
+
+    k_mutex_unlock(&hub_mutex);
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_sensor_hub(const struct shell *sh, size_t argc, char **argv)
+{
+    hub_sensor_t *sensor;
+    sys_snode_t *node;
+    int num_subs;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    k_mutex_lock(&hub_mutex, K_FOREVER);
+    for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+        sensor = &sensors[i];
+        num_subs = 0;
+        SYS_SLIST_FOR_EACH_NODE(&sensor->subs, node) {
+            num_subs++;
+        }
+        shell_print(sh, "sensor_hub sensor=%s subscribers=%d running=%d interval_ms=%u latency_ms=%u samples=%u errors=%u",
+                    sensor->name, num_subs, sensor->running, sensor->interval_ms, sensor->latency_ms,
+                    sensor->num_samples, sensor->num_errors);
+    }
+    k_mutex_unlock(&hub_mutex);
+
+    return 0;
+}
+
+SHELL_CMD_REGISTER(sensor_hub, NULL, "Sensor hub subscribers and sample counts", cmd_sensor_hub);
+#endif
@@ -0,0 +1,52 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/sys/slist.h>
+
+/** @brief Sensors sampled by the hub. Samples are published on the sensor's zbus channel,
+ *         pressure_data_chan and light_data_chan, read the latest with zbus_chan_read.
+*/
+typedef enum zsw_sensor_hub_sensor_t {
+    ZSW_SENSOR_HUB_PRESSURE,
+    ZSW_SENSOR_HUB_LIGHT,
+    ZSW_SENSOR_HUB_NUM_SENSORS
+} zsw_sensor_hub_sensor_t;
+
+typedef struct zsw_sensor_hub_sub_t {
+    zsw_sensor_hub_sensor_t sensor;
+    // Wanted time between samples.
+    uint32_t interval_ms;
+    // How late a sample may be, so it can be taken together with the samples of other sensors.
+    uint32_t latency_ms;
+    // Used by zsw_sensor_hub
+    sys_snode_t node;
+} zsw_sensor_hub_sub_t;
+
+/** @brief     Start getting samples of a sensor. The sensor is sampled at the shortest interval
+ *             and latency of its subscribers and powered down when it has none.
+ *  @param sub Subscription, must stay valid until unsubscribed. Subscribing again updates the rate.
+ *  @return    0 on success, -EINVAL on bad parameters, else the error from starting the sensor
+*/
+int zsw_sensor_hub_subscribe(zsw_sensor_hub_sub_t *sub);
+
+/** @brief     Stop getting samples. Does nothing if not subscribed.
+ *  @param sub Subscription passed to zsw_sensor_hub_subscribe
+*/
+void zsw_sensor_hub_unsubscribe(zsw_sensor_hub_sub_t *sub);
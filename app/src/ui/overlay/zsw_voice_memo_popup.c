@@ -30,6 +30,7 @@
 #include "ble/gadgetbridge/ble_gadgetbridge.h"
 #include "ui/zsw_ui.h"
 #include "ui/zsw_ui_controller.h"
+#include "zsw_zbus_trace.h"
 
 LOG_MODULE_REGISTER(zsw_voice_memo_popup, LOG_LEVEL_INF);
 
@@ -209,7 +210,7 @@ static void on_voice_memo_result(const struct zbus_channel *chan)
     k_work_submit(&show_popup_work);
 }
 
-ZBUS_LISTENER_DEFINE(voice_memo_popup_result_lis, on_voice_memo_result);
+ZSW_ZBUS_LISTENER_DEFINE(voice_memo_popup_result_lis, on_voice_memo_result);
 
 void zsw_voice_memo_popup_init(void)
 {
@@ -0,0 +1,382 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/logging/log.h>
+
+#include "ui/utils/zsw_ui_anim.h"
+
+LOG_MODULE_REGISTER(zsw_ui_anim, LOG_LEVEL_INF);
+
+// File format, see app/scripts/gif_to_zsw_anim.py
+#define ANIM_MAGIC          0x4D4E415A
+#define ANIM_VERSION        1
+#define ANIM_FLAG_ALPHA     BIT(0)
+#define ANIM_HEADER_SIZE    24
+#define RECORD_HEADER_SIZE  8
+#define RECT_HEADER_SIZE    8
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t num_frames;
+    uint16_t loop_count;
+    uint32_t loop_offset;
+    uint32_t max_record;
+    bool alpha;
+} anim_info_t;
+
+typedef struct {
+    lv_fs_file_t file;
+    bool file_open;
+    // Set when the animation is linked into the firmware instead of read from a file.
+    const uint8_t *data;
+    uint32_t data_size;
+    uint32_t pos;
+    anim_info_t info;
+    lv_image_dsc_t frame;
+    uint8_t *frame_buf;
+    uint8_t *record_buf;
+    lv_timer_t *timer;
+    uint16_t frame_index;
+    uint16_t loops;
+} zsw_ui_anim_t;
+
+static int anim_read(zsw_ui_anim_t *anim, void *buf, uint32_t len)
+{
+    uint32_t br;
+
+    if (anim->data) {
+        if (len > anim->data_size - anim->pos) {
+            return -EIO;
+        }
+        memcpy(buf, &anim->data[anim->pos], len);
+    } else if (lv_fs_read(&anim->file, buf, len, &br) != LV_FS_RES_OK || br != len) {
+        return -EIO;
+    }
+    anim->pos += len;
+
+    return 0;
+}
+
+static int anim_seek(zsw_ui_anim_t *anim, uint32_t pos)
+{
+    if (anim->data) {
+        if (pos > anim->data_size) {
+            return -EIO;
+        }
+    } else if (lv_fs_seek(&anim->file, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        return -EIO;
+    }
+    anim->pos = pos;
+
+    return 0;
+}
+
+static int read_info(zsw_ui_anim_t *anim)
+{
+    uint8_t header[ANIM_HEADER_SIZE];
+
+    if (anim_read(anim, header, sizeof(header)) != 0) {
+        return -EIO;
+    }
+    if (sys_get_le32(&header[0]) != ANIM_MAGIC || sys_get_le16(&header[4]) != ANIM_VERSION) {
+        return -EINVAL;
+    }
+
+    anim->info.alpha = sys_get_le16(&header[6]) & ANIM_FLAG_ALPHA;
+    anim->info.width = sys_get_le16(&header[8]);
+    anim->info.height = sys_get_le16(&header[10]);
+    anim->info.num_frames = sys_get_le16(&header[12]);
+    anim->info.loop_count = sys_get_le16(&header[14]);
+    anim->info.loop_offset = sys_get_le32(&header[16]);
+    anim->info.max_record = sys_get_le32(&header[20]);
+
+    if (anim->info.width == 0 || anim->info.height == 0 || anim->info.num_frames == 0) {
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+/*
+ * The first record is a single rect covering the whole frame, color plane followed by the alpha plane.
+ * That is the RGB565(A8) layout of the frame buffer, so it is read in place.
+ */
+static int read_first_frame(zsw_ui_anim_t *anim, uint16_t *delay)
+{
+    uint8_t header[RECORD_HEADER_SIZE + RECT_HEADER_SIZE];
+
+    if (anim_read(anim, header, sizeof(header)) != 0) {
+        return -EIO;
+    }
+    if (sys_get_le32(&header[0]) != sizeof(header) + anim->frame.data_size || sys_get_le16(&header[6]) != 1 ||
+        sys_get_le16(&header[8]) != 0 || sys_get_le16(&header[10]) != 0 ||
+        sys_get_le16(&header[12]) != anim->info.width || sys_get_le16(&header[14]) != anim->info.height) {
+        return -EINVAL;
+    }
+    *delay = sys_get_le16(&header[4]);
+
+    return anim_read(anim, anim->frame_buf, anim->frame.data_size);
+}
+
+static int read_record(zsw_ui_anim_t *anim, const uint8_t **record, uint32_t *size)
+{
+    uint8_t header[RECORD_HEADER_SIZE];
+
+    if (anim->data) {
+        if (anim->data_size - anim->pos < RECORD_HEADER_SIZE) {
+            return -EIO;
+        }
+        *size = sys_get_le32(&anim->data[anim->pos]);
+        if (*size < RECORD_HEADER_SIZE || *size > anim->data_size - anim->pos) {
+            return -EINVAL;
+        }
+        *record = &anim->data[anim->pos];
+        anim->pos += *size;
+        return 0;
+    }
+
+    // One read per frame, the file system is the expensive part on external flash.
+    if (anim_read(anim, header, sizeof(header)) != 0) {
+        return -EIO;
+    }
+    *size = sys_get_le32(header);
+    if (*size < RECORD_HEADER_SIZE || *size > anim->info.max_record) {
+        return -EINVAL;
+    }
+    memcpy(anim->record_buf, header, sizeof(header));
+    *record = anim->record_buf;
+
+    return anim_read(anim, &anim->record_buf[RECORD_HEADER_SIZE], *size - RECORD_HEADER_SIZE);
+}
+
+static int apply_record(lv_obj_t *obj, zsw_ui_anim_t *anim, const uint8_t *record, uint32_t size)
+{
+    const uint8_t *pos = &record[RECORD_HEADER_SIZE];
+    const uint8_t *end = &record[size];
+    uint16_t num_rects = sys_get_le16(&record[6]);
+    uint32_t width = anim->info.width;
+    uint32_t bytes_per_px = anim->info.alpha ? 3 : 2;
+    uint8_t *alpha_plane = &anim->frame_buf[width * anim->info.height * 2];
+    lv_area_t coords;
+    lv_area_t area;
+
+    lv_obj_get_coords(obj, &coords);
+
+    for (int i = 0; i < num_rects; i++) {
+        uint16_t x, y, w, h;
+        uint32_t num_px;
+
+        if (end - pos < RECT_HEADER_SIZE) {
+            return -EINVAL;
+        }
+        x = sys_get_le16(&pos[0]);
+        y = sys_get_le16(&pos[2]);
+        w = sys_get_le16(&pos[4]);
+        h = sys_get_le16(&pos[6]);
+        pos += RECT_HEADER_SIZE;
+        num_px = (uint32_t)w * h;
+
+        if (x + w > width || y + h > anim->info.height || (uint32_t)(end - pos) < num_px * bytes_per_px) {
+            return -EINVAL;
+        }
+
+        for (int row = 0; row < h; row++) {
+            memcpy(&anim->frame_buf[((y + row) * width + x) * 2], &pos[row * w * 2], w * 2);
+        }
+        if (anim->info.alpha) {
+            for (int row = 0; row < h; row++) {
+                memcpy(&alpha_plane[(y + row) * width + x], &pos[num_px * 2 + row * w], w);
+            }
+        }
+        pos += num_px * bytes_per_px;
+
+        area.x1 = coords.x1 + x;
+        area.y1 = coords.y1 + y;
+        area.x2 = area.x1 + w - 1;
+        area.y2 = area.y1 + h - 1;
+        lv_obj_invalidate_area(obj, &area);
+    }
+
+    return sys_get_le16(&record[4]);
+}
+
+static void next_frame_timer(lv_timer_t *timer)
+{
+    lv_obj_t *obj = lv_timer_get_user_data(timer);
+    zsw_ui_anim_t *anim = lv_obj_get_user_data(obj);
+    uint16_t next = anim->frame_index + 1;
+    const uint8_t *record;
+    uint32_t size;
+    int delay;
+
+    if (next == anim->info.num_frames) {
+        // The wrap record brought back the first frame, continue with the second.
+        if (anim_seek(anim, anim->info.loop_offset) != 0) {
+            goto error;
+        }
+        next = 1;
+    } else if (next == anim->info.num_frames - 1 && anim->info.loop_count > 0 &&
+               ++anim->loops >= anim->info.loop_count) {
+        // Done, stay on the last frame like a GIF does.
+        lv_timer_pause(timer);
+        return;
+    }
+
+    if (read_record(anim, &record, &size) != 0) {
+        goto error;
+    }
+    delay = apply_record(obj, anim, record, size);
+    if (delay < 0) {
+        goto error;
+    }
+
+    anim->frame_index = next;
+    lv_timer_set_period(timer, MAX(delay, 1));
+    return;
+
+error:
+    LOG_ERR("Broken animation at frame %d", next);
+    lv_timer_pause(timer);
+}
+
+static void close_src(zsw_ui_anim_t *anim)
+{
+    if (anim->file_open) {
+        lv_fs_close(&anim->file);
+        anim->file_open = false;
+    }
+    k_free(anim->record_buf);
+    anim->record_buf = NULL;
+    anim->data = NULL;
+}
+
+static void anim_free(zsw_ui_anim_t *anim)
+{
+    if (anim->timer) {
+        lv_timer_delete(anim->timer);
+        anim->timer = NULL;
+    }
+    close_src(anim);
+    if (anim->frame_buf) {
+        lv_image_cache_drop(&anim->frame);
+    }
+    k_free(anim->frame_buf);
+    anim->frame_buf = NULL;
+}
+
+static void delete_event(lv_event_t *e)
+{
+    zsw_ui_anim_t *anim = lv_event_get_user_data(e);
+
+    anim_free(anim);
+    k_free(anim);
+}
+
+lv_obj_t *zsw_ui_anim_create(lv_obj_t *parent)
+{
+    zsw_ui_anim_t *anim = k_malloc(sizeof(zsw_ui_anim_t));
+    lv_obj_t *obj;
+
+    if (anim == NULL) {
+        return NULL;
+    }
+    memset(anim, 0, sizeof(zsw_ui_anim_t));
+
+    obj = lv_image_create(parent);
+    lv_obj_add_event_cb(obj, delete_event, LV_EVENT_DELETE, anim);
+    lv_obj_set_user_data(obj, anim);
+
+    return obj;
+}
+
+int zsw_ui_anim_set_src(lv_obj_t *obj, const void *src)
+{
+    zsw_ui_anim_t *anim = lv_obj_get_user_data(obj);
+    uint16_t delay;
+    int ret;
+
+    lv_image_set_src(obj, NULL);
+    anim_free(anim);
+    anim->pos = 0;
+    anim->frame_index = 0;
+    anim->loops = 0;
+
+    if (lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t *dsc = src;
+
+        anim->data = dsc->data;
+        anim->data_size = dsc->data_size;
+    } else if (lv_image_src_get_type(src) == LV_IMAGE_SRC_FILE) {
+        if (lv_fs_open(&anim->file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            LOG_ERR("Failed to open %s", (const char *)src);
+            return -ENOENT;
+        }
+        anim->file_open = true;
+    } else {
+        return -EINVAL;
+    }
+
+    ret = read_info(anim);
+    if (ret != 0) {
+        goto error;
+    }
+
+    anim->frame.header.magic = LV_IMAGE_HEADER_MAGIC;
+    anim->frame.header.cf = anim->info.alpha ? LV_COLOR_FORMAT_RGB565A8 : LV_COLOR_FORMAT_RGB565;
+    anim->frame.header.w = anim->info.width;
+    anim->frame.header.h = anim->info.height;
+    anim->frame.header.stride = anim->info.width * 2;
+    anim->frame.data_size = anim->info.width * anim->info.height * (anim->info.alpha ? 3 : 2);
+
+    anim->frame_buf = k_malloc(anim->frame.data_size);
+    // Animations linked into the firmware are applied straight from flash.
+    if (!anim->data && anim->info.num_frames > 1) {
+        anim->record_buf = k_malloc(anim->info.max_record);
+    }
+    if (!anim->frame_buf || (!anim->data && anim->info.num_frames > 1 && !anim->record_buf)) {
+        LOG_ERR("No memory for %dx%d animation", anim->info.width, anim->info.height);
+        ret = -ENOMEM;
+        goto error;
+    }
+    anim->frame.data = anim->frame_buf;
+
+    ret = read_first_frame(anim, &delay);
+    if (ret != 0) {
+        goto error;
+    }
+    lv_image_set_src(obj, &anim->frame);
+
+    if (anim->info.num_frames > 1) {
+        anim->timer = lv_timer_create(next_frame_timer, MAX(delay, 1), obj);
+    } else {
+        // Nothing more to read, only the frame is kept.
+        close_src(anim);
+    }
+
+    return 0;
+
+error:
+    LOG_ERR("Failed to load animation: %d", ret);
+    anim_free(anim);
+    return ret;
+}
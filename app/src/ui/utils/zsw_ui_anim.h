@@ -0,0 +1,38 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <lvgl.h>
+
+/** @brief          Create an animation player, a lightweight replacement for lv_gif.
+ *                  Animations are converted from GIF with app/scripts/gif_to_zsw_anim.py. Each frame only
+ *                  stores the rects that changed, the player copies them into its frame buffer and
+ *                  invalidates just those areas. Nothing is decoded on the watch.
+ *  @param parent   Parent object
+ *  @return         The player object, an lv_image, NULL if out of memory
+*/
+lv_obj_t *zsw_ui_anim_create(lv_obj_t *parent);
+
+/** @brief          Load an animation and start playing it.
+ *  @param obj      Player object
+ *  @param src      File path, for example ZSW_LV_IMG_USE_WITH_MOUNT(snoopy_anim, "/lvgl_lfs"),
+ *                  or an lv_image_dsc_t holding the converted file
+ *  @return         0 on success, negative error code if the animation can't be played
+*/
+int zsw_ui_anim_set_src(lv_obj_t *obj, const void *src);
@@ -0,0 +1,228 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+#include "ui/utils/zsw_ui_atlas.h"
+
+LOG_MODULE_REGISTER(zsw_ui_atlas, LOG_LEVEL_INF);
+
+// LVGL draws variable images directly from the buffer, keep every sprite aligned.
+#define SPRITE_ALIGN    4
+
+static int read_image_header(const char *path, lv_image_header_t *header, uint32_t *data_size)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res;
+    uint32_t br;
+    uint32_t file_size = 0;
+
+    res = lv_fs_open(&file, path, LV_FS_MODE_RD);
+    if (res != LV_FS_RES_OK) {
+        return -ENOENT;
+    }
+
+    res = lv_fs_read(&file, header, sizeof(*header), &br);
+    if (res == LV_FS_RES_OK && br == sizeof(*header)) {
+        lv_fs_seek(&file, 0, LV_FS_SEEK_END);
+        lv_fs_tell(&file, &file_size);
+    }
+    lv_fs_close(&file);
+
+    if (file_size <= sizeof(*header) || header->magic != LV_IMAGE_HEADER_MAGIC) {
+        return -EINVAL;
+    }
+    // Compressed images need the decoder, they stay file based.
+    if (header->flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        return -ENOTSUP;
+    }
+
+    *data_size = file_size - sizeof(*header);
+
+    return 0;
+}
+
+static int read_image_data(const char *path, uint8_t *buf, uint32_t len)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res;
+    uint32_t br = 0;
+
+    res = lv_fs_open(&file, path, LV_FS_MODE_RD);
+    if (res != LV_FS_RES_OK) {
+        return -ENOENT;
+    }
+
+    res = lv_fs_seek(&file, sizeof(lv_image_header_t), LV_FS_SEEK_SET);
+    if (res == LV_FS_RES_OK) {
+        res = lv_fs_read(&file, buf, len, &br);
+    }
+    lv_fs_close(&file);
+
+    return (res == LV_FS_RES_OK && br == len) ? 0 : -EIO;
+}
+
+static uint32_t group_size(zsw_ui_atlas_t *atlas, zsw_ui_atlas_group_t *group)
+{
+    lv_image_dsc_t *sprite;
+    uint32_t size = 0;
+
+    for (int i = 0; i < group->num_srcs; i++) {
+        sprite = &atlas->sprites[group->first_sprite + i];
+        // Images linked into the firmware are already in memory.
+        if (lv_image_src_get_type(group->srcs[i]) != LV_IMAGE_SRC_FILE ||
+            read_image_header(group->srcs[i], &sprite->header, &sprite->data_size) != 0) {
+            return 0;
+        }
+        size += ROUND_UP(sprite->data_size, SPRITE_ALIGN);
+    }
+
+    return size;
+}
+
+int zsw_ui_atlas_add_group(zsw_ui_atlas_t *atlas, const void **srcs, uint8_t num_srcs)
+{
+    zsw_ui_atlas_group_t *group;
+    uint32_t first_sprite = 0;
+
+    if (atlas->num_groups == ZSW_UI_ATLAS_MAX_GROUPS) {
+        return -ENOMEM;
+    }
+
+    if (atlas->num_groups > 0) {
+        group = &atlas->groups[atlas->num_groups - 1];
+        first_sprite = group->first_sprite + group->num_srcs;
+    }
+    if (first_sprite + num_srcs > UINT8_MAX) {
+        return -ENOMEM;
+    }
+
+    group = &atlas->groups[atlas->num_groups++];
+    group->srcs = srcs;
+    group->num_srcs = num_srcs;
+    group->first_sprite = first_sprite;
+    group->loaded = false;
+
+    return 0;
+}
+
+int zsw_ui_atlas_load(zsw_ui_atlas_t *atlas)
+{
+    zsw_ui_atlas_group_t *group;
+    uint32_t sizes[ZSW_UI_ATLAS_MAX_GROUPS];
+    uint32_t num_sprites;
+    uint32_t total = 0;
+    uint8_t *data;
+
+    if (CONFIG_ZSW_UI_ATLAS_MAX_SIZE == 0 || atlas->num_groups == 0 || atlas->data) {
+        return 0;
+    }
+
+    group = &atlas->groups[atlas->num_groups - 1];
+    num_sprites = group->first_sprite + group->num_srcs;
+    atlas->sprites = k_calloc(num_sprites, sizeof(lv_image_dsc_t));
+    if (atlas->sprites == NULL) {
+        return -ENOMEM;
+    }
+
+    // Groups are added in priority order, take as many as fit in the budget.
+    for (int i = 0; i < atlas->num_groups; i++) {
+        sizes[i] = group_size(atlas, &atlas->groups[i]);
+        if (sizes[i] == 0 || total + sizes[i] > CONFIG_ZSW_UI_ATLAS_MAX_SIZE) {
+            sizes[i] = 0;
+            continue;
+        }
+        total += sizes[i];
+    }
+
+    if (total == 0) {
+        k_free(atlas->sprites);
+        atlas->sprites = NULL;
+        return 0;
+    }
+
+    // From the system heap and only while the watchface is shown.
+    atlas->data = k_aligned_alloc(SPRITE_ALIGN, total);
+    if (atlas->data == NULL) {
+        LOG_WRN("No memory for %d bytes atlas", total);
+        k_free(atlas->sprites);
+        atlas->sprites = NULL;
+        return -ENOMEM;
+    }
+    atlas->data_size = total;
+
+    data = atlas->data;
+    for (int i = 0; i < atlas->num_groups; i++) {
+        group = &atlas->groups[i];
+        if (sizes[i] == 0) {
+            continue;
+        }
+
+        for (int j = 0; j < group->num_srcs; j++) {
+            lv_image_dsc_t *sprite = &atlas->sprites[group->first_sprite + j];
+
+            if (read_image_data(group->srcs[j], data, sprite->data_size) != 0) {
+                break;
+            }
+            sprite->data = data;
+            data += ROUND_UP(sprite->data_size, SPRITE_ALIGN);
+            group->loaded = j == group->num_srcs - 1;
+        }
+    }
+
+    LOG_DBG("Atlas loaded, %d bytes", total);
+
+    return total;
+}
+
+const void *zsw_ui_atlas_get(const zsw_ui_atlas_t *atlas, const void **srcs, uint32_t index)
+{
+    for (int i = 0; i < atlas->num_groups; i++) {
+        const zsw_ui_atlas_group_t *group = &atlas->groups[i];
+
+        if (group->srcs == srcs) {
+            if (group->loaded && index < group->num_srcs) {
+                return &atlas->sprites[group->first_sprite + index];
+            }
+            break;
+        }
+    }
+
+    return srcs[index];
+}
+
+void zsw_ui_atlas_free(zsw_ui_atlas_t *atlas)
+{
+    // LVGL caches decoded images by source, make sure no entry points into the atlas.
+    if (atlas->sprites) {
+        for (int i = 0; i < atlas->num_groups; i++) {
+            zsw_ui_atlas_group_t *group = &atlas->groups[i];
+
+            for (int j = 0; group->loaded && j < group->num_srcs; j++) {
+                lv_image_cache_drop(&atlas->sprites[group->first_sprite + j]);
+            }
+        }
+    }
+
+    k_free(atlas->data);
+    k_free(atlas->sprites);
+    memset(atlas, 0, sizeof(*atlas));
+}
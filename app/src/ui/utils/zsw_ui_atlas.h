@@ -0,0 +1,72 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#define ZSW_UI_ATLAS_MAX_GROUPS     8
+
+typedef struct {
+    const void **srcs;
+    uint8_t num_srcs;
+    uint8_t first_sprite;
+    bool loaded;
+} zsw_ui_atlas_group_t;
+
+/** @brief Sprite atlas for image groups, such as the digits of a watchface.
+ *  All images of the loaded groups are kept decoded in one RAM buffer, so switching
+ *  between them does not touch the file system.
+*/
+typedef struct {
+    zsw_ui_atlas_group_t groups[ZSW_UI_ATLAS_MAX_GROUPS];
+    uint8_t num_groups;
+    lv_image_dsc_t *sprites;
+    uint8_t *data;
+    uint32_t data_size;
+} zsw_ui_atlas_t;
+
+/** @brief          Add an image group to the atlas, call before zsw_ui_atlas_load.
+ *                  Groups are loaded in the order they are added until CONFIG_ZSW_UI_ATLAS_MAX_SIZE is used.
+ *  @param atlas    Atlas to add to
+ *  @param srcs     Image sources of the group, same as passed to lv_image_set_src
+ *  @param num_srcs Number of images in the group
+ *  @return         0 on success, -ENOMEM if there are already ZSW_UI_ATLAS_MAX_GROUPS groups
+*/
+int zsw_ui_atlas_add_group(zsw_ui_atlas_t *atlas, const void **srcs, uint8_t num_srcs);
+
+/** @brief          Read all images of the added groups into RAM.
+ *                  Groups that are not stored as files, are compressed or don't fit keep using their sources.
+ *  @param atlas    Atlas to load
+ *  @return         Number of bytes used by the atlas or negative error code
+*/
+int zsw_ui_atlas_load(zsw_ui_atlas_t *atlas);
+
+/** @brief          Get the image source to use for one image of a group.
+ *  @param atlas    Atlas
+ *  @param srcs     Group, same pointer as passed to zsw_ui_atlas_add_group
+ *  @param index    Image index in the group
+ *  @return         The atlas sprite if the group is loaded, otherwise srcs[index]
+*/
+const void *zsw_ui_atlas_get(const zsw_ui_atlas_t *atlas, const void **srcs, uint32_t index);
+
+/** @brief          Free the atlas and forget all groups.
+ *                  No image may use a sprite from the atlas anymore.
+ *  @param atlas    Atlas to free
+*/
+void zsw_ui_atlas_free(zsw_ui_atlas_t *atlas);
@@ -0,0 +1,493 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * LVGL has one image cache and one image header cache without statistics. Lookups are counted
+ * by wrapping the get callback of both cache classes, and attributed to the category that is
+ * shown. The image cache is sized to the sum of the category budgets, its add, remove and
+ * drop_all callbacks are wrapped too so every decoded image is tracked with the category that
+ * added it. On a miss the least recently used images of the category are dropped until it is
+ * under its budget, before LVGL decodes the new one and evicts from any category. Everything
+ * here runs on the LVGL thread, the shell only reads counters and resets them through
+ * lv_async_call.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
+#include <lvgl.h>
+#include <lvgl_private.h>
+
+#include "ui/utils/zsw_ui_cache.h"
+
+LOG_MODULE_REGISTER(zsw_ui_cache, LOG_LEVEL_INF);
+
+// Images looked up by the running app, dropped when it exits.
+#define MAX_APP_SOURCES     32
+#define MAX_SOURCE_LEN      40
+
+// Decoded images tracked per category, more than fit in the budgets.
+#define MAX_CACHED_IMAGES   32
+
+#define IMAGE_CACHE_SIZE    (CONFIG_ZSW_UI_CACHE_WATCHFACE_SIZE + CONFIG_ZSW_UI_CACHE_APP_ICON_SIZE + \
+                             CONFIG_ZSW_UI_CACHE_APP_SIZE)
+
+BUILD_ASSERT(CONFIG_ZSW_UI_CACHE_MAX_PINS < CONFIG_ZSW_UI_CACHE_HEADER_CNT,
+             "Pins would fill the image header cache");
+
+typedef enum cache_kind_t {
+    CACHE_KIND_HEADER,
+    CACHE_KIND_IMAGE,
+    CACHE_KIND_NUM
+} cache_kind_t;
+
+typedef struct counted_cache_t {
+    lv_cache_t *cache;
+    lv_cache_class_t clz;
+    lv_cache_get_cb_t get_cb;
+    lv_cache_add_cb_t add_cb;
+    lv_cache_remove_cb_t remove_cb;
+    lv_cache_drop_all_cb_t drop_all_cb;
+} counted_cache_t;
+
+typedef struct category_stats_t {
+    uint32_t hits[CACHE_KIND_NUM];
+    uint32_t misses[CACHE_KIND_NUM];
+    uint32_t evictions;
+    uint32_t num_pins;
+    uint32_t pinned_bytes;
+    // Decoded bytes at the last image miss, read by the shell without touching the cache.
+    uint32_t used_bytes;
+} category_stats_t;
+
+typedef struct cached_image_t {
+    lv_cache_entry_t *entry;
+    zsw_ui_cache_category_t category;
+    uint32_t last_used;
+} cached_image_t;
+
+typedef struct pin_t {
+    const void *src;
+    zsw_ui_cache_category_t category;
+    lv_cache_entry_t *header_entry;
+    lv_cache_entry_t *image_entry;
+    uint32_t size;
+} pin_t;
+
+static const char *const category_names[ZSW_UI_CACHE_NUM_CATEGORIES] = {
+    [ZSW_UI_CACHE_WATCHFACE] = "watchface",
+    [ZSW_UI_CACHE_APP_ICON] = "app_icon",
+    [ZSW_UI_CACHE_APP] = "app",
+};
+
+static const uint32_t budgets[ZSW_UI_CACHE_NUM_CATEGORIES] = {
+    [ZSW_UI_CACHE_WATCHFACE] = CONFIG_ZSW_UI_CACHE_WATCHFACE_SIZE,
+    [ZSW_UI_CACHE_APP_ICON] = CONFIG_ZSW_UI_CACHE_APP_ICON_SIZE,
+    [ZSW_UI_CACHE_APP] = CONFIG_ZSW_UI_CACHE_APP_SIZE,
+};
+
+static counted_cache_t counted_caches[CACHE_KIND_NUM];
+static category_stats_t stats[ZSW_UI_CACHE_NUM_CATEGORIES];
+static zsw_ui_cache_category_t current_category = ZSW_UI_CACHE_WATCHFACE;
+// Set while this module looks up entries itself, those are not counted.
+static bool counting_paused;
+
+static pin_t pins[CONFIG_ZSW_UI_CACHE_MAX_PINS];
+
+static cached_image_t cached_images[MAX_CACHED_IMAGES];
+static uint32_t use_count;
+
+static char app_sources[MAX_APP_SOURCES][MAX_SOURCE_LEN];
+static uint8_t num_app_sources;
+
+static void record_app_source(const void *src, lv_image_src_t src_type)
+{
+    // Variable images are drawn from flash and never decoded into the cache.
+    if (src_type != LV_IMAGE_SRC_FILE || num_app_sources >= MAX_APP_SOURCES ||
+        strlen((const char *)src) >= MAX_SOURCE_LEN) {
+        return;
+    }
+
+    for (int i = 0; i < num_app_sources; i++) {
+        if (strcmp(app_sources[i], src) == 0) {
+            return;
+        }
+    }
+    strcpy(app_sources[num_app_sources++], src);
+}
+
+static cached_image_t *find_cached_image(const lv_cache_entry_t *entry)
+{
+    for (int i = 0; i < ARRAY_SIZE(cached_images); i++) {
+        if (cached_images[i].entry == entry) {
+            return &cached_images[i];
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t cached_image_size(const cached_image_t *image)
+{
+    const lv_image_cache_data_t *data = lv_cache_entry_get_data(image->entry);
+
+    return data->decoded ? data->decoded->data_size : 0;
+}
+
+static uint32_t used_bytes(zsw_ui_cache_category_t category)
+{
+    uint32_t total = 0;
+
+    for (int i = 0; i < ARRAY_SIZE(cached_images); i++) {
+        if (cached_images[i].entry && cached_images[i].category == category) {
+            total += cached_image_size(&cached_images[i]);
+        }
+    }
+    stats[category].used_bytes = total;
+
+    return total;
+}
+
+// Same as lv_cache_drop, which can't be used here as the cache is locked during get.
+static void drop_entry(lv_cache_t *cache, lv_cache_entry_t *entry)
+{
+    cache->clz->remove_cb(cache, entry, NULL);
+    cache->ops.free_cb(lv_cache_entry_get_data(entry), NULL);
+    lv_cache_entry_delete(entry);
+}
+
+static void enforce_budget(lv_cache_t *cache, zsw_ui_cache_category_t category)
+{
+    cached_image_t *victim;
+
+    while (used_bytes(category) >= budgets[category]) {
+        victim = NULL;
+        for (int i = 0; i < ARRAY_SIZE(cached_images); i++) {
+            // Entries in use, pinned or drawn right now, can't be dropped.
+            if (cached_images[i].entry == NULL || cached_images[i].category != category ||
+                lv_cache_entry_get_ref(cached_images[i].entry) > 0) {
+                continue;
+            }
+            if (victim == NULL || cached_images[i].last_used < victim->last_used) {
+                victim = &cached_images[i];
+            }
+        }
+        if (victim == NULL) {
+            return;
+        }
+        drop_entry(cache, victim->entry);
+        stats[category].evictions++;
+    }
+}
+
+static lv_cache_entry_t *counted_get_cb(lv_cache_t *cache, const void *key, void *user_data)
+{
+    cache_kind_t kind = cache == counted_caches[CACHE_KIND_HEADER].cache ? CACHE_KIND_HEADER : CACHE_KIND_IMAGE;
+    lv_cache_entry_t *entry = counted_caches[kind].get_cb(cache, key, user_data);
+    const void *src;
+    lv_image_src_t src_type;
+
+    if (counting_paused) {
+        return entry;
+    }
+
+    if (entry) {
+        stats[current_category].hits[kind]++;
+        if (kind == CACHE_KIND_IMAGE) {
+            cached_image_t *image = find_cached_image(entry);
+            if (image) {
+                image->last_used = ++use_count;
+            }
+        }
+        return entry;
+    }
+
+    stats[current_category].misses[kind]++;
+    if (kind == CACHE_KIND_IMAGE) {
+        // LVGL decodes and adds the image next, make room in the category first.
+        enforce_budget(cache, current_category);
+    }
+    if (current_category == ZSW_UI_CACHE_APP) {
+        if (kind == CACHE_KIND_HEADER) {
+            src = ((const lv_image_header_cache_data_t *)key)->src;
+            src_type = ((const lv_image_header_cache_data_t *)key)->src_type;
+        } else {
+            src = ((const lv_image_cache_data_t *)key)->src;
+            src_type = ((const lv_image_cache_data_t *)key)->src_type;
+        }
+        record_app_source(src, src_type);
+    }
+
+    return entry;
+}
+
+static lv_cache_entry_t *counted_add_cb(lv_cache_t *cache, const void *key, void *user_data)
+{
+    lv_cache_entry_t *entry = counted_caches[CACHE_KIND_IMAGE].add_cb(cache, key, user_data);
+    cached_image_t *image;
+
+    if (entry == NULL) {
+        return entry;
+    }
+
+    // Images that don't fit in the table are still cached, only not held to a budget.
+    image = find_cached_image(NULL);
+    if (image) {
+        image->entry = entry;
+        image->category = current_category;
+        image->last_used = ++use_count;
+    }
+
+    return entry;
+}
+
+static void counted_remove_cb(lv_cache_t *cache, lv_cache_entry_t *entry, void *user_data)
+{
+    cached_image_t *image = find_cached_image(entry);
+
+    if (image) {
+        memset(image, 0, sizeof(*image));
+    }
+    counted_caches[CACHE_KIND_IMAGE].remove_cb(cache, entry, user_data);
+}
+
+static void counted_drop_all_cb(lv_cache_t *cache, void *user_data)
+{
+    memset(cached_images, 0, sizeof(cached_images));
+    counted_caches[CACHE_KIND_IMAGE].drop_all_cb(cache, user_data);
+}
+
+static void wrap_cache(cache_kind_t kind, lv_cache_t *cache)
+{
+    counted_cache_t *counted = &counted_caches[kind];
+
+    if (cache == NULL) {
+        return;
+    }
+
+    counted->cache = cache;
+    counted->clz = *cache->clz;
+    counted->get_cb = cache->clz->get_cb;
+    counted->clz.get_cb = counted_get_cb;
+    if (kind == CACHE_KIND_IMAGE) {
+        counted->add_cb = cache->clz->add_cb;
+        counted->remove_cb = cache->clz->remove_cb;
+        counted->drop_all_cb = cache->clz->drop_all_cb;
+        counted->clz.add_cb = counted_add_cb;
+        counted->clz.remove_cb = counted_remove_cb;
+        counted->clz.drop_all_cb = counted_drop_all_cb;
+    }
+    cache->clz = &counted->clz;
+}
+
+void zsw_ui_cache_init(void)
+{
+    lv_image_cache_resize(IMAGE_CACHE_SIZE, true);
+    lv_image_header_cache_resize(CONFIG_ZSW_UI_CACHE_HEADER_CNT, true);
+
+    wrap_cache(CACHE_KIND_HEADER, LV_GLOBAL_DEFAULT()->img_header_cache);
+    wrap_cache(CACHE_KIND_IMAGE, LV_GLOBAL_DEFAULT()->img_cache);
+
+    LOG_INF("Image cache %u bytes (watchface %u, app icons %u, app %u), %d headers", IMAGE_CACHE_SIZE,
+            CONFIG_ZSW_UI_CACHE_WATCHFACE_SIZE, CONFIG_ZSW_UI_CACHE_APP_ICON_SIZE, CONFIG_ZSW_UI_CACHE_APP_SIZE,
+            CONFIG_ZSW_UI_CACHE_HEADER_CNT);
+}
+
+void zsw_ui_cache_set_category(zsw_ui_cache_category_t category)
+{
+    __ASSERT_NO_MSG(category < ZSW_UI_CACHE_NUM_CATEGORIES);
+    current_category = category;
+}
+
+static bool is_same_src(const void *a, const void *b)
+{
+    if (a == b) {
+        return true;
+    }
+
+    return lv_image_src_get_type(a) == LV_IMAGE_SRC_FILE && lv_image_src_get_type(b) == LV_IMAGE_SRC_FILE &&
+           strcmp(a, b) == 0;
+}
+
+int zsw_ui_cache_pin(zsw_ui_cache_category_t category, const void *src)
+{
+    lv_image_header_t header;
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    lv_image_header_cache_data_t header_key = { .src = src, .src_type = src_type };
+    lv_image_cache_data_t image_key = { .src = src, .src_type = src_type };
+    const lv_image_cache_data_t *image_data;
+    pin_t *pin = NULL;
+
+    if (counted_caches[CACHE_KIND_HEADER].cache == NULL || counted_caches[CACHE_KIND_IMAGE].cache == NULL) {
+        return -ENODEV;
+    }
+
+    if (src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) {
+        return -ENOTSUP;
+    }
+
+    for (int i = 0; i < ARRAY_SIZE(pins); i++) {
+        if (pins[i].src == NULL) {
+            pin = pin ? pin : &pins[i];
+        } else if (is_same_src(pins[i].src, src)) {
+            return 0;
+        }
+    }
+    if (pin == NULL) {
+        return -ENOMEM;
+    }
+
+    counting_paused = true;
+    // Puts the header in the header cache if it is not there already
+    if (lv_image_decoder_get_info(src, &header) != LV_RESULT_OK) {
+        counting_paused = false;
+        return -ENOENT;
+    }
+    pin->header_entry = lv_cache_acquire(counted_caches[CACHE_KIND_HEADER].cache, &header_key, NULL);
+    pin->image_entry = lv_cache_acquire(counted_caches[CACHE_KIND_IMAGE].cache, &image_key, NULL);
+    counting_paused = false;
+
+    pin->size = 0;
+    if (pin->image_entry) {
+        image_data = lv_cache_entry_get_data(pin->image_entry);
+        pin->size = image_data->decoded ? image_data->decoded->data_size : 0;
+        // Pinned entries can't be dropped, leave the other half of the budget for the rest.
+        if (stats[category].pinned_bytes + pin->size > budgets[category] / 2) {
+            lv_cache_release(counted_caches[CACHE_KIND_IMAGE].cache, pin->image_entry, NULL);
+            pin->image_entry = NULL;
+            pin->size = 0;
+        }
+    }
+
+    if (pin->header_entry == NULL && pin->image_entry == NULL) {
+        return -ENOTSUP;
+    }
+
+    pin->src = src;
+    pin->category = category;
+    stats[category].num_pins++;
+    stats[category].pinned_bytes += pin->size;
+
+    return 0;
+}
+
+void zsw_ui_cache_evict(zsw_ui_cache_category_t category)
+{
+    counting_paused = true;
+
+    for (int i = 0; i < ARRAY_SIZE(pins); i++) {
+        if (pins[i].src == NULL || pins[i].category != category) {
+            continue;
+        }
+        if (pins[i].header_entry) {
+            lv_cache_release(counted_caches[CACHE_KIND_HEADER].cache, pins[i].header_entry, NULL);
+        }
+        if (pins[i].image_entry) {
+            lv_cache_release(counted_caches[CACHE_KIND_IMAGE].cache, pins[i].image_entry, NULL);
+        }
+        memset(&pins[i], 0, sizeof(pins[i]));
+    }
+    stats[category].num_pins = 0;
+    stats[category].pinned_bytes = 0;
+
+    if (category == ZSW_UI_CACHE_APP) {
+        for (int i = 0; i < num_app_sources; i++) {
+            lv_image_cache_drop(app_sources[i]);
+            lv_image_header_cache_drop(app_sources[i]);
+        }
+        num_app_sources = 0;
+    }
+
+    counting_paused = false;
+    stats[category].evictions++;
+}
+
+#ifdef CONFIG_SHELL
+static uint32_t hit_rate_percent(uint32_t hits, uint32_t misses)
+{
+    return hits + misses > 0 ? (hits * 100) / (hits + misses) : 0;
+}
+
+static int cmd_ui_cache_stats(const struct shell *sh, size_t argc, char **argv)
+{
+    const category_stats_t *s;
+    lv_cache_t *header_cache = counted_caches[CACHE_KIND_HEADER].cache;
+    lv_cache_t *image_cache = counted_caches[CACHE_KIND_IMAGE].cache;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    if (header_cache == NULL || image_cache == NULL) {
+        shell_error(sh, "Not initialized");
+        return -ENODEV;
+    }
+
+    shell_print(sh, "ui_cache kind=header used=%u max=%u", lv_cache_get_size(header_cache, NULL),
+                lv_cache_get_max_size(header_cache, NULL));
+    shell_print(sh, "ui_cache kind=image used=%u max=%u", lv_cache_get_size(image_cache, NULL),
+                lv_cache_get_max_size(image_cache, NULL));
+
+    for (int i = 0; i < ZSW_UI_CACHE_NUM_CATEGORIES; i++) {
+        s = &stats[i];
+        shell_print(sh, "ui_cache category=%s header_hits=%u header_misses=%u header_hit_rate=%u "
+                    "image_hits=%u image_misses=%u image_hit_rate=%u used_bytes=%u budget=%u pins=%u pinned_bytes=%u "
+                    "evictions=%u",
+                    category_names[i],
+                    s->hits[CACHE_KIND_HEADER], s->misses[CACHE_KIND_HEADER],
+                    hit_rate_percent(s->hits[CACHE_KIND_HEADER], s->misses[CACHE_KIND_HEADER]),
+                    s->hits[CACHE_KIND_IMAGE], s->misses[CACHE_KIND_IMAGE],
+                    hit_rate_percent(s->hits[CACHE_KIND_IMAGE], s->misses[CACHE_KIND_IMAGE]),
+                    s->used_bytes, budgets[i], s->num_pins, s->pinned_bytes, s->evictions);
+    }
+
+    return 0;
+}
+
+static void reset_counters_async(void *user_data)
+{
+    ARG_UNUSED(user_data);
+
+    for (int i = 0; i < ZSW_UI_CACHE_NUM_CATEGORIES; i++) {
+        memset(stats[i].hits, 0, sizeof(stats[i].hits));
+        memset(stats[i].misses, 0, sizeof(stats[i].misses));
+        stats[i].evictions = 0;
+    }
+}
+
+static int cmd_ui_cache_reset(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    // The counters are written by the LVGL thread.
+    lv_async_call(reset_counters_async, NULL);
+    shell_print(sh, "ui_cache counters reset");
+
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_ui_cache,
+                               SHELL_CMD_ARG(stats, NULL, "Hit and miss counters per category", cmd_ui_cache_stats, 1, 0),
+                               SHELL_CMD_ARG(reset, NULL, "Reset the counters", cmd_ui_cache_reset, 1, 0),
+                               SHELL_SUBCMD_SET_END
+                              );
+
+SHELL_CMD_REGISTER(ui_cache, &sub_ui_cache, "LVGL image cache usage and hit rates", NULL);
+#endif
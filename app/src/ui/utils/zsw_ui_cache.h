@@ -0,0 +1,57 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <lvgl.h>
+
+/** @brief Who an LVGL image cache lookup is made for, each has its own counters and pins. */
+typedef enum zsw_ui_cache_category_t {
+    ZSW_UI_CACHE_WATCHFACE,
+    ZSW_UI_CACHE_APP_ICON,
+    ZSW_UI_CACHE_APP,
+    ZSW_UI_CACHE_NUM_CATEGORIES
+} zsw_ui_cache_category_t;
+
+/** @brief Size the LVGL image and image header caches and start counting hits and misses.
+ *         Call once from the LVGL thread after LVGL is initialized.
+*/
+void zsw_ui_cache_init(void);
+
+/** @brief          Count image lookups from now on for a category, for example when an app is started.
+ *  @param category Category that is shown
+*/
+void zsw_ui_cache_set_category(zsw_ui_cache_category_t category);
+
+/** @brief          Keep an image in the caches until the category is evicted.
+ *                  The header is always kept, the decoded image only when LVGL has it cached and all
+ *                  pinned images of the category stay within half of its budget. Images streamed from their file are not
+ *                  cached by LVGL, pinning them still saves the header read.
+ *  @param category Category that owns the pin
+ *  @param src      Image source, same as passed to lv_image_set_src. Must stay valid while pinned.
+ *  @return         0 on success or if already pinned, -ENOMEM if out of pins, -ENOENT if the image
+ *                  can't be opened, -ENOTSUP if nothing could be cached
+*/
+int zsw_ui_cache_pin(zsw_ui_cache_category_t category, const void *src);
+
+/** @brief          Release all pins of a category and drop the images looked up for it.
+ *                  Called by the app manager when an app exits so its images don't push out the
+ *                  watchface and app icons.
+ *  @param category Category to evict
+*/
+void zsw_ui_cache_evict(zsw_ui_cache_category_t category);
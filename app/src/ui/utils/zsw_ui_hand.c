@@ -0,0 +1,156 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "ui/utils/zsw_ui_hand.h"
+
+typedef struct {
+    int32_t x_ofs;
+    int32_t y_ofs;
+    uint16_t length;
+    uint16_t tail;
+    uint8_t width;
+    uint8_t hub_radius;
+    lv_color_t color;
+    int32_t angle;
+    // Tip, tail end and pivot relative to the top left corner of the object.
+    lv_point_precise_t tip;
+    lv_point_precise_t end;
+    lv_point_precise_t pivot;
+} zsw_ui_hand_t;
+
+static void draw_event(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    zsw_ui_hand_t *hand = lv_event_get_user_data(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_draw_line_dsc_t line_dsc;
+
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = hand->color;
+    line_dsc.width = hand->width;
+    line_dsc.round_start = 1;
+    line_dsc.round_end = 1;
+    line_dsc.p1.x = obj->coords.x1 + hand->end.x;
+    line_dsc.p1.y = obj->coords.y1 + hand->end.y;
+    line_dsc.p2.x = obj->coords.x1 + hand->tip.x;
+    line_dsc.p2.y = obj->coords.y1 + hand->tip.y;
+    lv_draw_line(layer, &line_dsc);
+
+    if (hand->hub_radius > 0) {
+        lv_draw_rect_dsc_t rect_dsc;
+        lv_area_t area;
+
+        lv_draw_rect_dsc_init(&rect_dsc);
+        rect_dsc.bg_color = hand->color;
+        rect_dsc.radius = LV_RADIUS_CIRCLE;
+        area.x1 = obj->coords.x1 + (int32_t)hand->pivot.x - hand->hub_radius;
+        area.y1 = obj->coords.y1 + (int32_t)hand->pivot.y - hand->hub_radius;
+        area.x2 = area.x1 + 2 * hand->hub_radius;
+        area.y2 = area.y1 + 2 * hand->hub_radius;
+        lv_draw_rect(layer, &rect_dsc, &area);
+    }
+}
+
+static void delete_event(lv_event_t *e)
+{
+    k_free(lv_event_get_user_data(e));
+}
+
+static void update_position(lv_obj_t *obj, zsw_ui_hand_t *hand)
+{
+    lv_obj_t *parent = lv_obj_get_parent(obj);
+    float rad = hand->angle * (float)M_PI / 1800.0f;
+    float dx = sinf(rad);
+    float dy = -cosf(rad);
+    int32_t margin = MAX(hand->width / 2 + 1, hand->hub_radius + 1);
+    int32_t pivot_x = lv_obj_get_content_width(parent) / 2 + hand->x_ofs;
+    int32_t pivot_y = lv_obj_get_content_height(parent) / 2 + hand->y_ofs;
+    float tip_x = pivot_x + dx * hand->length;
+    float tip_y = pivot_y + dy * hand->length;
+    float end_x = pivot_x - dx * hand->tail;
+    float end_y = pivot_y - dy * hand->tail;
+    int32_t x1 = (int32_t)floorf(MIN(MIN(tip_x, end_x), pivot_x)) - margin;
+    int32_t y1 = (int32_t)floorf(MIN(MIN(tip_y, end_y), pivot_y)) - margin;
+    int32_t x2 = (int32_t)ceilf(MAX(MAX(tip_x, end_x), pivot_x)) + margin;
+    int32_t y2 = (int32_t)ceilf(MAX(MAX(tip_y, end_y), pivot_y)) + margin;
+
+    hand->tip.x = tip_x - x1;
+    hand->tip.y = tip_y - y1;
+    hand->end.x = end_x - x1;
+    hand->end.y = end_y - y1;
+    hand->pivot.x = pivot_x - x1;
+    hand->pivot.y = pivot_y - y1;
+
+    // Old and new bounding box, the hand is redrawn even when the box stays the same.
+    lv_obj_invalidate(obj);
+    lv_obj_set_pos(obj, x1, y1);
+    lv_obj_set_size(obj, x2 - x1 + 1, y2 - y1 + 1);
+    lv_obj_invalidate(obj);
+}
+
+lv_obj_t *zsw_ui_hand_create(lv_obj_t *parent, int32_t x_ofs, int32_t y_ofs, uint16_t length, uint16_t tail,
+                             uint8_t width, lv_color_t color)
+{
+    zsw_ui_hand_t *hand = k_malloc(sizeof(zsw_ui_hand_t));
+    lv_obj_t *obj;
+
+    if (hand == NULL) {
+        return NULL;
+    }
+    memset(hand, 0, sizeof(zsw_ui_hand_t));
+    hand->x_ofs = x_ofs;
+    hand->y_ofs = y_ofs;
+    hand->length = length;
+    hand->tail = tail;
+    hand->width = width;
+    hand->color = color;
+
+    obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(obj, draw_event, LV_EVENT_DRAW_MAIN, hand);
+    lv_obj_add_event_cb(obj, delete_event, LV_EVENT_DELETE, hand);
+    lv_obj_set_user_data(obj, hand);
+    update_position(obj, hand);
+
+    return obj;
+}
+
+void zsw_ui_hand_set_hub(lv_obj_t *obj, uint8_t radius)
+{
+    zsw_ui_hand_t *hand = lv_obj_get_user_data(obj);
+
+    hand->hub_radius = radius;
+    update_position(obj, hand);
+}
+
+void zsw_ui_hand_set_angle(lv_obj_t *obj, int32_t angle)
+{
+    zsw_ui_hand_t *hand = lv_obj_get_user_data(obj);
+
+    if (hand->angle == angle) {
+        return;
+    }
+
+    hand->angle = angle;
+    update_position(obj, hand);
+}
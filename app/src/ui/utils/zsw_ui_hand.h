@@ -0,0 +1,48 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <lvgl.h>
+
+/** @brief          Create a clock hand drawn as an anti-aliased line.
+ *                  The object only covers the bounding box of the hand, so moving it only
+ *                  redraws the area of the old and new position, unlike rotating a full size image.
+ *  @param parent   Parent object, the hand rotates around its center
+ *  @param x_ofs    Pivot x offset from the center of the parent
+ *  @param y_ofs    Pivot y offset from the center of the parent
+ *  @param length   Length from the pivot to the tip in px
+ *  @param tail     Length of the part behind the pivot in px
+ *  @param width    Line width in px
+ *  @param color    Line color
+ *  @return         The hand object, NULL if out of memory
+*/
+lv_obj_t *zsw_ui_hand_create(lv_obj_t *parent, int32_t x_ofs, int32_t y_ofs, uint16_t length, uint16_t tail,
+                             uint8_t width, lv_color_t color);
+
+/** @brief          Draw a filled circle on the pivot.
+ *  @param hand     Hand object
+ *  @param radius   Radius in px, 0 for none
+*/
+void zsw_ui_hand_set_hub(lv_obj_t *hand, uint8_t radius);
+
+/** @brief          Set the hand angle.
+ *  @param hand     Hand object
+ *  @param angle    Angle in 0.1 degree clockwise from 12 o'clock, same as lv_image_set_rotation
+*/
+void zsw_ui_hand_set_angle(lv_obj_t *hand, int32_t angle);
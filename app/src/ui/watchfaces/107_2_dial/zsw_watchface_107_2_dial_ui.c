@@ -11,12 +11,14 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
 LOG_MODULE_REGISTER(watchface_107_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_107_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_107_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -155,6 +157,7 @@ static void watchface_107_2_dial_remove(void)
 
     lv_obj_del(face_107_2_dial);
     face_107_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_107_2_dial_invalidate_cached(void)
@@ -188,39 +191,39 @@ static void watchface_107_2_dial_set_datetime(int day_of_week, int date, int day
     month += 1;
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_107_2_dial_2_58391, face_107_2_dial_2_58391_group[(day / 1) % 10]);
+        lv_image_set_src(face_107_2_dial_2_58391, zsw_ui_atlas_get(&atlas, face_107_2_dial_2_58391_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_107_2_dial_3_58391, face_107_2_dial_2_58391_group[(day / 10) % 10]);
+        lv_image_set_src(face_107_2_dial_3_58391, zsw_ui_atlas_get(&atlas, face_107_2_dial_2_58391_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_107_2_dial_4_58391, face_107_2_dial_2_58391_group[(month / 1) % 10]);
+        lv_image_set_src(face_107_2_dial_4_58391, zsw_ui_atlas_get(&atlas, face_107_2_dial_2_58391_group, (month / 1) % 10));
     }
 
     if (getPlaceValue(last_month, 2) != getPlaceValue(month, 2)) {
-        lv_image_set_src(face_107_2_dial_5_58391, face_107_2_dial_2_58391_group[(month / 10) % 10]);
+        lv_image_set_src(face_107_2_dial_5_58391, zsw_ui_atlas_get(&atlas, face_107_2_dial_2_58391_group, (month / 10) % 10));
     }
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_107_2_dial_7_60782, face_107_2_dial_7_60782_group[(hour / 1) % 10]);
+        lv_image_set_src(face_107_2_dial_7_60782, zsw_ui_atlas_get(&atlas, face_107_2_dial_7_60782_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_107_2_dial_8_60782, face_107_2_dial_7_60782_group[(hour / 10) % 10]);
+        lv_image_set_src(face_107_2_dial_8_60782, zsw_ui_atlas_get(&atlas, face_107_2_dial_7_60782_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_107_2_dial_9_60782, face_107_2_dial_7_60782_group[(minute / 1) % 10]);
+        lv_image_set_src(face_107_2_dial_9_60782, zsw_ui_atlas_get(&atlas, face_107_2_dial_7_60782_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_107_2_dial_10_60782, face_107_2_dial_7_60782_group[(minute / 10) % 10]);
+        lv_image_set_src(face_107_2_dial_10_60782, zsw_ui_atlas_get(&atlas, face_107_2_dial_7_60782_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_107_2_dial_12_85153, face_107_2_dial_12_85153_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_107_2_dial_12_85153, zsw_ui_atlas_get(&atlas, face_107_2_dial_12_85153_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -295,6 +298,10 @@ void watchface_107_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_107_2_dial = lv_obj_create(parent);
     watchface_107_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_107_2_dial_2_58391_group, ARRAY_SIZE(face_107_2_dial_2_58391_group));
+    zsw_ui_atlas_add_group(&atlas, face_107_2_dial_7_60782_group, ARRAY_SIZE(face_107_2_dial_7_60782_group));
+    zsw_ui_atlas_add_group(&atlas, face_107_2_dial_12_85153_group, ARRAY_SIZE(face_107_2_dial_12_85153_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_107_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_107_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -436,7 +443,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_107_2_dial_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_107_2_dial_invalidate_cached,
     .get_preview_img = watchface_107_2_dial_get_preview_img,
-    .name = "Tetris"
+    .name = "Tetris",
+    .asset_prefix = "face_107_2_dial_",
 };
 
 static int watchface_107_2_dial_init(void)
@@ -11,11 +11,13 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 
 LOG_MODULE_REGISTER(watchface_116_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_116_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_116_2_dial_evt_cb;
 
 static int last_date = -1;
@@ -190,6 +192,7 @@ static void watchface_116_2_dial_remove(void)
 
     lv_obj_del(face_116_2_dial);
     face_116_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_116_2_dial_invalidate_cached(void)
@@ -223,31 +226,31 @@ static void watchface_116_2_dial_set_datetime(int day_of_week, int date, int day
     month += 1;
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_116_2_dial_1_59716, face_116_2_dial_1_59716_group[(day / 1) % 10]);
+        lv_image_set_src(face_116_2_dial_1_59716, zsw_ui_atlas_get(&atlas, face_116_2_dial_1_59716_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_116_2_dial_2_59716, face_116_2_dial_1_59716_group[(day / 10) % 10]);
+        lv_image_set_src(face_116_2_dial_2_59716, zsw_ui_atlas_get(&atlas, face_116_2_dial_1_59716_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_116_2_dial_3_62316, face_116_2_dial_3_62316_group[(hour / 1) % 10]);
+        lv_image_set_src(face_116_2_dial_3_62316, zsw_ui_atlas_get(&atlas, face_116_2_dial_3_62316_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_116_2_dial_4_62316, face_116_2_dial_3_62316_group[(hour / 10) % 10]);
+        lv_image_set_src(face_116_2_dial_4_62316, zsw_ui_atlas_get(&atlas, face_116_2_dial_3_62316_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_116_2_dial_5_114030, face_116_2_dial_5_114030_group[(minute / 1) % 10]);
+        lv_image_set_src(face_116_2_dial_5_114030, zsw_ui_atlas_get(&atlas, face_116_2_dial_5_114030_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_116_2_dial_6_114030, face_116_2_dial_5_114030_group[(minute / 10) % 10]);
+        lv_image_set_src(face_116_2_dial_6_114030, zsw_ui_atlas_get(&atlas, face_116_2_dial_5_114030_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_116_2_dial_18_162424, face_116_2_dial_18_162424_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_116_2_dial_18_162424, zsw_ui_atlas_get(&atlas, face_116_2_dial_18_162424_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -321,6 +324,11 @@ void watchface_116_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_116_2_dial = lv_obj_create(parent);
     watchface_116_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_116_2_dial_1_59716_group, ARRAY_SIZE(face_116_2_dial_1_59716_group));
+    zsw_ui_atlas_add_group(&atlas, face_116_2_dial_3_62316_group, ARRAY_SIZE(face_116_2_dial_3_62316_group));
+    zsw_ui_atlas_add_group(&atlas, face_116_2_dial_5_114030_group, ARRAY_SIZE(face_116_2_dial_5_114030_group));
+    zsw_ui_atlas_add_group(&atlas, face_116_2_dial_18_162424_group, ARRAY_SIZE(face_116_2_dial_18_162424_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_116_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_116_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -433,7 +441,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_116_2_dial_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_116_2_dial_invalidate_cached,
     .get_preview_img = watchface_116_2_dial_get_preview_img,
-    .name = "Sporty"
+    .name = "Sporty",
+    .asset_prefix = "face_116_2_dial_",
 };
 
 static int watchface_116_2_dial_init(void)
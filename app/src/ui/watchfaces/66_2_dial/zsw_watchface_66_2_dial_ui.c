@@ -11,12 +11,14 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
 LOG_MODULE_REGISTER(watchface_66_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_66_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_66_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -223,6 +225,7 @@ static void watchface_66_2_dial_remove(void)
 
     lv_obj_del(face_66_2_dial);
     face_66_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_66_2_dial_invalidate_cached(void)
@@ -256,31 +259,31 @@ static void watchface_66_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_66_2_dial_1_68896, face_66_2_dial_1_68896_group[(hour / 1) % 10]);
+        lv_image_set_src(face_66_2_dial_1_68896, zsw_ui_atlas_get(&atlas, face_66_2_dial_1_68896_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_66_2_dial_2_61582, face_66_2_dial_2_61582_group[(hour / 10) % 3]);
+        lv_image_set_src(face_66_2_dial_2_61582, zsw_ui_atlas_get(&atlas, face_66_2_dial_2_61582_group, (hour / 10) % 3));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_66_2_dial_3_105480, face_66_2_dial_3_105480_group[(minute / 1) % 10]);
+        lv_image_set_src(face_66_2_dial_3_105480, zsw_ui_atlas_get(&atlas, face_66_2_dial_3_105480_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_66_2_dial_4_92084, face_66_2_dial_4_92084_group[(minute / 10) % 10]);
+        lv_image_set_src(face_66_2_dial_4_92084, zsw_ui_atlas_get(&atlas, face_66_2_dial_4_92084_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_66_2_dial_5_60018, face_66_2_dial_5_60018_group[(day / 1) % 10]);
+        lv_image_set_src(face_66_2_dial_5_60018, zsw_ui_atlas_get(&atlas, face_66_2_dial_5_60018_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_66_2_dial_6_58294, face_66_2_dial_6_58294_group[(day / 10) % 10]);
+        lv_image_set_src(face_66_2_dial_6_58294, zsw_ui_atlas_get(&atlas, face_66_2_dial_6_58294_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_66_2_dial_8_123132, face_66_2_dial_8_123132_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_66_2_dial_8_123132, zsw_ui_atlas_get(&atlas, face_66_2_dial_8_123132_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -354,6 +357,14 @@ void watchface_66_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_66_2_dial = lv_obj_create(parent);
     watchface_66_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_1_68896_group, ARRAY_SIZE(face_66_2_dial_1_68896_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_2_61582_group, ARRAY_SIZE(face_66_2_dial_2_61582_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_3_105480_group, ARRAY_SIZE(face_66_2_dial_3_105480_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_4_92084_group, ARRAY_SIZE(face_66_2_dial_4_92084_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_5_60018_group, ARRAY_SIZE(face_66_2_dial_5_60018_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_6_58294_group, ARRAY_SIZE(face_66_2_dial_6_58294_group));
+    zsw_ui_atlas_add_group(&atlas, face_66_2_dial_8_123132_group, ARRAY_SIZE(face_66_2_dial_8_123132_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_66_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_66_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -459,7 +470,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_66_2_dial_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_66_2_dial_invalidate_cached,
     .get_preview_img = watchface_66_2_dial_get_preview_img,
-    .name = "Jungle"
+    .name = "Jungle",
+    .asset_prefix = "face_66_2_dial_",
 };
 
 static int watchface_66_2_dial_init(void)
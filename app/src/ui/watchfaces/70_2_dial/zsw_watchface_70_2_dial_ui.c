@@ -11,11 +11,13 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 
 LOG_MODULE_REGISTER(watchface_70_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_70_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_70_2_dial_evt_cb;
 
 static int last_date = -1;
@@ -126,6 +128,7 @@ static void watchface_70_2_dial_remove(void)
 
     lv_obj_del(face_70_2_dial);
     face_70_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_70_2_dial_invalidate_cached(void)
@@ -159,19 +162,19 @@ static void watchface_70_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_70_2_dial_1_125929, face_70_2_dial_1_125929_group[(hour / 1) % 10]);
+        lv_image_set_src(face_70_2_dial_1_125929, zsw_ui_atlas_get(&atlas, face_70_2_dial_1_125929_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_70_2_dial_2_125929, face_70_2_dial_1_125929_group[(hour / 10) % 10]);
+        lv_image_set_src(face_70_2_dial_2_125929, zsw_ui_atlas_get(&atlas, face_70_2_dial_1_125929_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_70_2_dial_3_125929, face_70_2_dial_1_125929_group[(minute / 1) % 10]);
+        lv_image_set_src(face_70_2_dial_3_125929, zsw_ui_atlas_get(&atlas, face_70_2_dial_1_125929_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_70_2_dial_4_125929, face_70_2_dial_1_125929_group[(minute / 10) % 10]);
+        lv_image_set_src(face_70_2_dial_4_125929, zsw_ui_atlas_get(&atlas, face_70_2_dial_1_125929_group, (minute / 10) % 10));
     }
     lv_image_set_rotation(face_70_2_dial_13_60900, hour * 300 + (minute * 5));
     lv_image_set_rotation(face_70_2_dial_29_90967, minute * 60);
@@ -188,23 +191,23 @@ static void watchface_70_2_dial_set_step(int32_t steps, int32_t distance, int32_
     }
 
     if (getPlaceValue(last_steps, 1) != getPlaceValue(steps, 1)) {
-        lv_image_set_src(face_70_2_dial_8_59328, face_70_2_dial_5_59328_group[(steps / 1) % 10]);
+        lv_image_set_src(face_70_2_dial_8_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (steps / 1) % 10));
     }
 
     if (getPlaceValue(last_steps, 2) != getPlaceValue(steps, 2)) {
-        lv_image_set_src(face_70_2_dial_9_59328, face_70_2_dial_5_59328_group[(steps / 10) % 10]);
+        lv_image_set_src(face_70_2_dial_9_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (steps / 10) % 10));
     }
 
     if (getPlaceValue(last_steps, 3) != getPlaceValue(steps, 3)) {
-        lv_image_set_src(face_70_2_dial_10_59328, face_70_2_dial_5_59328_group[(steps / 100) % 10]);
+        lv_image_set_src(face_70_2_dial_10_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (steps / 100) % 10));
     }
 
     if (getPlaceValue(last_steps, 4) != getPlaceValue(steps, 4)) {
-        lv_image_set_src(face_70_2_dial_11_59328, face_70_2_dial_5_59328_group[(steps / 1000) % 10]);
+        lv_image_set_src(face_70_2_dial_11_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (steps / 1000) % 10));
     }
 
     if (getPlaceValue(last_steps, 5) != getPlaceValue(steps, 5)) {
-        lv_image_set_src(face_70_2_dial_12_59328, face_70_2_dial_5_59328_group[(steps / 10000) % 10]);
+        lv_image_set_src(face_70_2_dial_12_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (steps / 10000) % 10));
     }
 
     last_steps = steps;
@@ -216,9 +219,9 @@ static void watchface_70_2_dial_set_hrm(int32_t bpm, int32_t oxygen)
         return;
     }
 
-    lv_image_set_src(face_70_2_dial_5_59328, face_70_2_dial_5_59328_group[(bpm / 1) % 10]);
-    lv_image_set_src(face_70_2_dial_6_59328, face_70_2_dial_5_59328_group[(bpm / 10) % 10]);
-    lv_image_set_src(face_70_2_dial_7_59328, face_70_2_dial_5_59328_group[(bpm / 100) % 10]);
+    lv_image_set_src(face_70_2_dial_5_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (bpm / 1) % 10));
+    lv_image_set_src(face_70_2_dial_6_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (bpm / 10) % 10));
+    lv_image_set_src(face_70_2_dial_7_59328, zsw_ui_atlas_get(&atlas, face_70_2_dial_5_59328_group, (bpm / 100) % 10));
 
 }
 
@@ -269,6 +272,9 @@ void watchface_70_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_70_2_dial = lv_obj_create(parent);
     watchface_70_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_70_2_dial_5_59328_group, ARRAY_SIZE(face_70_2_dial_5_59328_group));
+    zsw_ui_atlas_add_group(&atlas, face_70_2_dial_1_125929_group, ARRAY_SIZE(face_70_2_dial_1_125929_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_70_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_70_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -448,6 +454,7 @@ static watchface_ui_api_t ui_api = {
     .ui_invalidate_cached = watchface_70_2_dial_invalidate_cached,
     .get_preview_img = watchface_70_2_dial_get_preview_img,
     .name = "Yin-yang",
+    .asset_prefix = "face_70_2_dial_",
 };
 
 static int watchface_70_2_dial_init(void)
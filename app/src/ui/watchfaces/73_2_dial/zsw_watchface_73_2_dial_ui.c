@@ -11,11 +11,13 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 
 LOG_MODULE_REGISTER(watchface_73_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_73_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_73_2_dial_evt_cb;
 
 static int last_date = -1;
@@ -253,6 +255,7 @@ static void watchface_73_2_dial_remove(void)
 
     lv_obj_del(face_73_2_dial);
     face_73_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_73_2_dial_invalidate_cached(void)
@@ -286,55 +289,55 @@ static void watchface_73_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_year, 1) != getPlaceValue(year, 1)) {
-        lv_image_set_src(face_73_2_dial_8_59942, face_73_2_dial_8_59942_group[(year / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_8_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (year / 1) % 10));
     }
 
     if (getPlaceValue(last_year, 2) != getPlaceValue(year, 2)) {
-        lv_image_set_src(face_73_2_dial_9_59942, face_73_2_dial_8_59942_group[(year / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_9_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (year / 10) % 10));
     }
 
     if (getPlaceValue(last_year, 3) != getPlaceValue(year, 3)) {
-        lv_image_set_src(face_73_2_dial_10_59942, face_73_2_dial_8_59942_group[(year / 100) % 10]);
+        lv_image_set_src(face_73_2_dial_10_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (year / 100) % 10));
     }
 
     if (getPlaceValue(last_year, 4) != getPlaceValue(year, 4)) {
-        lv_image_set_src(face_73_2_dial_11_59942, face_73_2_dial_8_59942_group[(year / 1000) % 10]);
+        lv_image_set_src(face_73_2_dial_11_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (year / 1000) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_73_2_dial_13_59942, face_73_2_dial_8_59942_group[(month / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_13_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (month / 1) % 10));
     }
 
     if (getPlaceValue(last_month, 2) != getPlaceValue(month, 2)) {
-        lv_image_set_src(face_73_2_dial_14_59942, face_73_2_dial_8_59942_group[(month / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_14_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (month / 10) % 10));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_73_2_dial_15_59942, face_73_2_dial_8_59942_group[(day / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_15_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_73_2_dial_16_59942, face_73_2_dial_8_59942_group[(day / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_16_59942, zsw_ui_atlas_get(&atlas, face_73_2_dial_8_59942_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_73_2_dial_22_112986, face_73_2_dial_22_112986_group[(hour / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_22_112986, zsw_ui_atlas_get(&atlas, face_73_2_dial_22_112986_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_73_2_dial_23_112986, face_73_2_dial_22_112986_group[(hour / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_23_112986, zsw_ui_atlas_get(&atlas, face_73_2_dial_22_112986_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_73_2_dial_24_112986, face_73_2_dial_22_112986_group[(minute / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_24_112986, zsw_ui_atlas_get(&atlas, face_73_2_dial_22_112986_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_73_2_dial_25_112986, face_73_2_dial_22_112986_group[(minute / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_25_112986, zsw_ui_atlas_get(&atlas, face_73_2_dial_22_112986_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_73_2_dial_27_127086, face_73_2_dial_27_127086_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_73_2_dial_27_127086, zsw_ui_atlas_get(&atlas, face_73_2_dial_27_127086_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -352,23 +355,23 @@ static void watchface_73_2_dial_set_step(int32_t steps, int32_t distance, int32_
     }
 
     if (getPlaceValue(last_steps, 1) != getPlaceValue(steps, 1)) {
-        lv_image_set_src(face_73_2_dial_17_110874, face_73_2_dial_17_110874_group[(steps / 1) % 10]);
+        lv_image_set_src(face_73_2_dial_17_110874, zsw_ui_atlas_get(&atlas, face_73_2_dial_17_110874_group, (steps / 1) % 10));
     }
 
     if (getPlaceValue(last_steps, 2) != getPlaceValue(steps, 2)) {
-        lv_image_set_src(face_73_2_dial_18_110874, face_73_2_dial_17_110874_group[(steps / 10) % 10]);
+        lv_image_set_src(face_73_2_dial_18_110874, zsw_ui_atlas_get(&atlas, face_73_2_dial_17_110874_group, (steps / 10) % 10));
     }
 
     if (getPlaceValue(last_steps, 3) != getPlaceValue(steps, 3)) {
-        lv_image_set_src(face_73_2_dial_19_110874, face_73_2_dial_17_110874_group[(steps / 100) % 10]);
+        lv_image_set_src(face_73_2_dial_19_110874, zsw_ui_atlas_get(&atlas, face_73_2_dial_17_110874_group, (steps / 100) % 10));
     }
 
     if (getPlaceValue(last_steps, 4) != getPlaceValue(steps, 4)) {
-        lv_image_set_src(face_73_2_dial_20_110874, face_73_2_dial_17_110874_group[(steps / 1000) % 10]);
+        lv_image_set_src(face_73_2_dial_20_110874, zsw_ui_atlas_get(&atlas, face_73_2_dial_17_110874_group, (steps / 1000) % 10));
     }
 
     if (getPlaceValue(last_steps, 5) != getPlaceValue(steps, 5)) {
-        lv_image_set_src(face_73_2_dial_21_110874, face_73_2_dial_17_110874_group[(steps / 10000) % 10]);
+        lv_image_set_src(face_73_2_dial_21_110874, zsw_ui_atlas_get(&atlas, face_73_2_dial_17_110874_group, (steps / 10000) % 10));
     }
 
     last_steps = steps;
@@ -429,6 +432,11 @@ void watchface_73_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_73_2_dial = lv_obj_create(parent);
     watchface_73_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_73_2_dial_8_59942_group, ARRAY_SIZE(face_73_2_dial_8_59942_group));
+    zsw_ui_atlas_add_group(&atlas, face_73_2_dial_17_110874_group, ARRAY_SIZE(face_73_2_dial_17_110874_group));
+    zsw_ui_atlas_add_group(&atlas, face_73_2_dial_22_112986_group, ARRAY_SIZE(face_73_2_dial_22_112986_group));
+    zsw_ui_atlas_add_group(&atlas, face_73_2_dial_27_127086_group, ARRAY_SIZE(face_73_2_dial_27_127086_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_73_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_73_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -668,6 +676,7 @@ static watchface_ui_api_t ui_api = {
     .ui_invalidate_cached = watchface_73_2_dial_invalidate_cached,
     .get_preview_img = watchface_73_2_dial_get_preview_img,
     .name = "Digital Fire",
+    .asset_prefix = "face_73_2_dial_",
 };
 
 static int watchface_73_2_dial_init(void)
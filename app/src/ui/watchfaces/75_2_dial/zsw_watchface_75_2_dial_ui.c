@@ -11,12 +11,15 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
+#include "ui/utils/zsw_ui_hand.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
 LOG_MODULE_REGISTER(watchface_75_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_75_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_75_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -55,7 +58,6 @@ ZSW_LV_IMG_DECLARE(face_75_2_dial_2_216824_5);
 ZSW_LV_IMG_DECLARE(face_75_2_dial_2_216824_6);
 LV_IMG_DECLARE(face_75_2_dial_3_59132_0);
 LV_IMG_DECLARE(face_75_2_dial_19_89191_0);
-LV_IMG_DECLARE(face_75_2_dial_35_138999_0);
 ZSW_LV_IMG_DECLARE(face_75_2_dial_preview_0);
 
 #if CONFIG_LV_COLOR_DEPTH_16 != 1
@@ -105,6 +107,7 @@ static void watchface_75_2_dial_remove(void)
 
     lv_obj_del(face_75_2_dial);
     face_75_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_75_2_dial_invalidate_cached(void)
@@ -135,11 +138,13 @@ static void watchface_75_2_dial_set_datetime(int day_of_week, int date, int day,
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_75_2_dial_2_216824, face_75_2_dial_2_216824_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_75_2_dial_2_216824, zsw_ui_atlas_get(&atlas, face_75_2_dial_2_216824_group, ((weekday + 6) / 1) % 7));
     }
     lv_image_set_rotation(face_75_2_dial_3_59132, hour * 300 + (minute * 5));
     lv_image_set_rotation(face_75_2_dial_19_89191, minute * 60);
-    lv_image_set_rotation(face_75_2_dial_35_138999, second * 60);
+    if (face_75_2_dial_35_138999) {
+        zsw_ui_hand_set_angle(face_75_2_dial_35_138999, second * 60);
+    }
 
     last_weekday = weekday;
 }
@@ -209,6 +214,8 @@ void watchface_75_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_75_2_dial = lv_obj_create(parent);
     watchface_75_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_75_2_dial_2_216824_group, ARRAY_SIZE(face_75_2_dial_2_216824_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_75_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_75_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -263,15 +270,11 @@ void watchface_75_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(face_75_2_dial_19_89191, LV_OBJ_FLAG_SCROLLABLE);
     lv_image_set_pivot(face_75_2_dial_19_89191, 5, 84);
 
-    face_75_2_dial_35_138999 = lv_image_create(face_75_2_dial);
-    lv_image_set_src(face_75_2_dial_35_138999, &face_75_2_dial_35_138999_0);
-    lv_obj_set_width(face_75_2_dial_35_138999, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_75_2_dial_35_138999, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_75_2_dial_35_138999, 115);
-    lv_obj_set_y(face_75_2_dial_35_138999, 12);
-    lv_obj_add_flag(face_75_2_dial_35_138999, LV_OBJ_FLAG_ADV_HITTEST);
-    lv_obj_clear_flag(face_75_2_dial_35_138999, LV_OBJ_FLAG_SCROLLABLE);
-    lv_image_set_pivot(face_75_2_dial_35_138999, 5, 108);
+    // Second hand drawn as a line instead of rotating the 10x113 image, see zsw_ui_hand.h.
+    face_75_2_dial_35_138999 = zsw_ui_hand_create(face_75_2_dial, 0, 0, 108, 5, 2, lv_color_hex(0xDFF0DE));
+    if (face_75_2_dial_35_138999) {
+        zsw_ui_hand_set_hub(face_75_2_dial_35_138999, 4);
+    }
 
     zsw_ui_notifications_area = zsw_ui_notification_area_add(face_75_2_dial);
     lv_obj_set_pos(zsw_ui_notifications_area->ui_notifications_container, 0, 70);
@@ -291,6 +294,7 @@ static watchface_ui_api_t ui_api = {
     .ui_invalidate_cached = watchface_75_2_dial_invalidate_cached,
     .get_preview_img = watchface_75_2_dial_get_preview_img,
     .name = "Analog Blue",
+    .asset_prefix = "face_75_2_dial_",
 };
 
 static int watchface_75_2_dial_init(void)
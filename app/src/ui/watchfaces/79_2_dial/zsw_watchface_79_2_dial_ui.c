@@ -11,12 +11,14 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
 LOG_MODULE_REGISTER(watchface_79_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_79_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_79_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -183,6 +185,7 @@ static void watchface_79_2_dial_remove(void)
 
     lv_obj_del(face_79_2_dial);
     face_79_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_79_2_dial_invalidate_cached(void)
@@ -216,39 +219,39 @@ static void watchface_79_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_79_2_dial_1_59582, face_79_2_dial_1_59582_group[(hour / 1) % 10]);
+        lv_image_set_src(face_79_2_dial_1_59582, zsw_ui_atlas_get(&atlas, face_79_2_dial_1_59582_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_79_2_dial_2_59582, face_79_2_dial_1_59582_group[(hour / 10) % 10]);
+        lv_image_set_src(face_79_2_dial_2_59582, zsw_ui_atlas_get(&atlas, face_79_2_dial_1_59582_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_79_2_dial_3_123330, face_79_2_dial_3_123330_group[(minute / 1) % 10]);
+        lv_image_set_src(face_79_2_dial_3_123330, zsw_ui_atlas_get(&atlas, face_79_2_dial_3_123330_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_79_2_dial_4_123330, face_79_2_dial_3_123330_group[(minute / 10) % 10]);
+        lv_image_set_src(face_79_2_dial_4_123330, zsw_ui_atlas_get(&atlas, face_79_2_dial_3_123330_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_79_2_dial_5_58512, face_79_2_dial_5_58512_group[(month / 1) % 10]);
+        lv_image_set_src(face_79_2_dial_5_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (month / 1) % 10));
     }
 
     if (getPlaceValue(last_month, 2) != getPlaceValue(month, 2)) {
-        lv_image_set_src(face_79_2_dial_6_58512, face_79_2_dial_5_58512_group[(month / 10) % 10]);
+        lv_image_set_src(face_79_2_dial_6_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (month / 10) % 10));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_79_2_dial_7_58512, face_79_2_dial_5_58512_group[(day / 1) % 10]);
+        lv_image_set_src(face_79_2_dial_7_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_79_2_dial_8_58512, face_79_2_dial_5_58512_group[(day / 10) % 10]);
+        lv_image_set_src(face_79_2_dial_8_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_79_2_dial_19_144206, face_79_2_dial_19_144206_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_79_2_dial_19_144206, zsw_ui_atlas_get(&atlas, face_79_2_dial_19_144206_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -265,23 +268,23 @@ static void watchface_79_2_dial_set_step(int32_t steps, int32_t distance, int32_
     }
 
     if (getPlaceValue(last_steps, 1) != getPlaceValue(steps, 1)) {
-        lv_image_set_src(face_79_2_dial_13_58512, face_79_2_dial_5_58512_group[(steps / 1) % 10]);
+        lv_image_set_src(face_79_2_dial_13_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (steps / 1) % 10));
     }
 
     if (getPlaceValue(last_steps, 2) != getPlaceValue(steps, 2)) {
-        lv_image_set_src(face_79_2_dial_14_58512, face_79_2_dial_5_58512_group[(steps / 10) % 10]);
+        lv_image_set_src(face_79_2_dial_14_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (steps / 10) % 10));
     }
 
     if (getPlaceValue(last_steps, 3) != getPlaceValue(steps, 3)) {
-        lv_image_set_src(face_79_2_dial_15_58512, face_79_2_dial_5_58512_group[(steps / 100) % 10]);
+        lv_image_set_src(face_79_2_dial_15_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (steps / 100) % 10));
     }
 
     if (getPlaceValue(last_steps, 4) != getPlaceValue(steps, 4)) {
-        lv_image_set_src(face_79_2_dial_16_58512, face_79_2_dial_5_58512_group[(steps / 1000) % 10]);
+        lv_image_set_src(face_79_2_dial_16_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (steps / 1000) % 10));
     }
 
     if (getPlaceValue(last_steps, 5) != getPlaceValue(steps, 5)) {
-        lv_image_set_src(face_79_2_dial_17_58512, face_79_2_dial_5_58512_group[(steps / 10000) % 10]);
+        lv_image_set_src(face_79_2_dial_17_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (steps / 10000) % 10));
     }
 
     last_steps = steps;
@@ -318,9 +321,9 @@ static void watchface_79_2_dial_set_battery_percent(int32_t percent, int32_t bat
         return;
     }
 
-    lv_image_set_src(face_79_2_dial_10_58512, face_79_2_dial_5_58512_group[(percent / 1) % 10]);
-    lv_image_set_src(face_79_2_dial_11_58512, face_79_2_dial_5_58512_group[(percent / 10) % 10]);
-    lv_image_set_src(face_79_2_dial_12_58512, face_79_2_dial_5_58512_group[(percent / 100) % 10]);
+    lv_image_set_src(face_79_2_dial_10_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (percent / 1) % 10));
+    lv_image_set_src(face_79_2_dial_11_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (percent / 10) % 10));
+    lv_image_set_src(face_79_2_dial_12_58512, zsw_ui_atlas_get(&atlas, face_79_2_dial_5_58512_group, (percent / 100) % 10));
     if (percent < 100) {
         lv_obj_add_flag(face_79_2_dial_12_58512, LV_OBJ_FLAG_HIDDEN);
     } else {
@@ -353,6 +356,11 @@ void watchface_79_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_79_2_dial = lv_obj_create(parent);
     watchface_79_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_79_2_dial_5_58512_group, ARRAY_SIZE(face_79_2_dial_5_58512_group));
+    zsw_ui_atlas_add_group(&atlas, face_79_2_dial_1_59582_group, ARRAY_SIZE(face_79_2_dial_1_59582_group));
+    zsw_ui_atlas_add_group(&atlas, face_79_2_dial_3_123330_group, ARRAY_SIZE(face_79_2_dial_3_123330_group));
+    zsw_ui_atlas_add_group(&atlas, face_79_2_dial_19_144206_group, ARRAY_SIZE(face_79_2_dial_19_144206_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_79_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_79_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -557,7 +565,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_79_2_dial_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_79_2_dial_invalidate_cached,
     .get_preview_img = watchface_79_2_dial_get_preview_img,
-    .name = "Digital Rough"
+    .name = "Digital Rough",
+    .asset_prefix = "face_79_2_dial_",
 };
 
 static int watchface_79_2_dial_init(void)
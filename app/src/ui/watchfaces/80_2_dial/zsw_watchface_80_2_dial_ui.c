@@ -11,6 +11,7 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
@@ -21,6 +22,7 @@ LOG_MODULE_REGISTER(watchface_80_2_dial, LOG_LEVEL_WRN);
 #define USE_DISTANCE    0
 
 static lv_obj_t *face_80_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_80_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -282,6 +284,7 @@ static void watchface_80_2_dial_remove(void)
 
     lv_obj_del(face_80_2_dial);
     face_80_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_80_2_dial_invalidate_cached(void)
@@ -315,55 +318,55 @@ static void watchface_80_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_80_2_dial_35_113802, face_80_2_dial_35_113802_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_80_2_dial_35_113802, zsw_ui_atlas_get(&atlas, face_80_2_dial_35_113802_group, ((weekday + 6) / 1) % 7));
     }
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_80_2_dial_37_96394, face_80_2_dial_37_96394_group[(hour / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_37_96394, zsw_ui_atlas_get(&atlas, face_80_2_dial_37_96394_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_80_2_dial_38_96394, face_80_2_dial_37_96394_group[(hour / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_38_96394, zsw_ui_atlas_get(&atlas, face_80_2_dial_37_96394_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_80_2_dial_39_96394, face_80_2_dial_37_96394_group[(minute / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_39_96394, zsw_ui_atlas_get(&atlas, face_80_2_dial_37_96394_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_80_2_dial_40_96394, face_80_2_dial_37_96394_group[(minute / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_40_96394, zsw_ui_atlas_get(&atlas, face_80_2_dial_37_96394_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_year, 1) != getPlaceValue(year, 1)) {
-        lv_image_set_src(face_80_2_dial_43_86861, face_80_2_dial_43_86861_group[(year / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_43_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (year / 1) % 10));
     }
 
     if (getPlaceValue(last_year, 2) != getPlaceValue(year, 2)) {
-        lv_image_set_src(face_80_2_dial_44_86861, face_80_2_dial_43_86861_group[(year / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_44_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (year / 10) % 10));
     }
 
     if (getPlaceValue(last_year, 3) != getPlaceValue(year, 3)) {
-        lv_image_set_src(face_80_2_dial_45_86861, face_80_2_dial_43_86861_group[(year / 100) % 10]);
+        lv_image_set_src(face_80_2_dial_45_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (year / 100) % 10));
     }
 
     if (getPlaceValue(last_year, 4) != getPlaceValue(year, 4)) {
-        lv_image_set_src(face_80_2_dial_46_86861, face_80_2_dial_43_86861_group[(year / 1000) % 10]);
+        lv_image_set_src(face_80_2_dial_46_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (year / 1000) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_80_2_dial_47_86861, face_80_2_dial_43_86861_group[(month / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_47_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (month / 1) % 10));
     }
 
     if (getPlaceValue(last_month, 2) != getPlaceValue(month, 2)) {
-        lv_image_set_src(face_80_2_dial_48_86861, face_80_2_dial_43_86861_group[(month / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_48_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (month / 10) % 10));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_80_2_dial_49_86861, face_80_2_dial_43_86861_group[(day / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_49_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_80_2_dial_50_86861, face_80_2_dial_43_86861_group[(day / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_50_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (day / 10) % 10));
     }
 
     last_hour = hour;
@@ -381,51 +384,51 @@ static void watchface_80_2_dial_set_step(int32_t steps, int32_t distance, int32_
     }
 
     if (getPlaceValue(last_steps, 1) != getPlaceValue(steps, 1)) {
-        lv_image_set_src(face_80_2_dial_2_85197, face_80_2_dial_2_85197_group[(steps / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_2_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (steps / 1) % 10));
     }
 
     if (getPlaceValue(last_steps, 2) != getPlaceValue(steps, 2)) {
-        lv_image_set_src(face_80_2_dial_3_85197, face_80_2_dial_2_85197_group[(steps / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_3_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (steps / 10) % 10));
     }
 
     if (getPlaceValue(last_steps, 3) != getPlaceValue(steps, 3)) {
-        lv_image_set_src(face_80_2_dial_4_85197, face_80_2_dial_2_85197_group[(steps / 100) % 10]);
+        lv_image_set_src(face_80_2_dial_4_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (steps / 100) % 10));
     }
 
     if (getPlaceValue(last_steps, 4) != getPlaceValue(steps, 4)) {
-        lv_image_set_src(face_80_2_dial_5_85197, face_80_2_dial_2_85197_group[(steps / 1000) % 10]);
+        lv_image_set_src(face_80_2_dial_5_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (steps / 1000) % 10));
     }
 
     if (getPlaceValue(last_steps, 5) != getPlaceValue(steps, 5)) {
-        lv_image_set_src(face_80_2_dial_6_85197, face_80_2_dial_2_85197_group[(steps / 10000) % 10]);
+        lv_image_set_src(face_80_2_dial_6_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (steps / 10000) % 10));
     }
 
     if (getPlaceValue(last_kcal, 1) != getPlaceValue(kcal, 1)) {
-        lv_image_set_src(face_80_2_dial_7_85197, face_80_2_dial_2_85197_group[(kcal / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_7_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (kcal / 1) % 10));
     }
 
     if (getPlaceValue(last_kcal, 2) != getPlaceValue(kcal, 2)) {
-        lv_image_set_src(face_80_2_dial_8_85197, face_80_2_dial_2_85197_group[(kcal / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_8_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (kcal / 10) % 10));
     }
 
     if (getPlaceValue(last_kcal, 3) != getPlaceValue(kcal, 3)) {
-        lv_image_set_src(face_80_2_dial_9_85197, face_80_2_dial_2_85197_group[(kcal / 100) % 10]);
+        lv_image_set_src(face_80_2_dial_9_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (kcal / 100) % 10));
     }
 
     if (getPlaceValue(last_kcal, 4) != getPlaceValue(kcal, 4)) {
-        lv_image_set_src(face_80_2_dial_10_85197, face_80_2_dial_2_85197_group[(kcal / 1000) % 10]);
+        lv_image_set_src(face_80_2_dial_10_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (kcal / 1000) % 10));
     }
 #if USE_DISTANCE
     if (getPlaceValue(last_distance, 1) != getPlaceValue(distance, 1)) {
-        lv_image_set_src(face_80_2_dial_23_85197, face_80_2_dial_2_85197_group[(distance / 1) % 10]);
+        lv_image_set_src(face_80_2_dial_23_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (distance / 1) % 10));
     }
 
     if (getPlaceValue(last_distance, 2) != getPlaceValue(distance, 2)) {
-        lv_image_set_src(face_80_2_dial_24_85197, face_80_2_dial_2_85197_group[(distance / 10) % 10]);
+        lv_image_set_src(face_80_2_dial_24_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (distance / 10) % 10));
     }
 
     if (getPlaceValue(last_distance, 3) != getPlaceValue(distance, 3)) {
-        lv_image_set_src(face_80_2_dial_25_85197, face_80_2_dial_2_85197_group[(distance / 100) % 10]);
+        lv_image_set_src(face_80_2_dial_25_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (distance / 100) % 10));
     }
     last_distance = distance;
 #endif
@@ -439,9 +442,9 @@ static void watchface_80_2_dial_set_hrm(int32_t bpm, int32_t oxygen)
         return;
     }
 #if USE_HR
-    lv_image_set_src(face_80_2_dial_27_85197, face_80_2_dial_2_85197_group[(bpm / 1) % 10]);
-    lv_image_set_src(face_80_2_dial_28_85197, face_80_2_dial_2_85197_group[(bpm / 10) % 10]);
-    lv_image_set_src(face_80_2_dial_29_85197, face_80_2_dial_2_85197_group[(bpm / 100) % 10]);
+    lv_image_set_src(face_80_2_dial_27_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (bpm / 1) % 10));
+    lv_image_set_src(face_80_2_dial_28_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (bpm / 10) % 10));
+    lv_image_set_src(face_80_2_dial_29_85197, zsw_ui_atlas_get(&atlas, face_80_2_dial_2_85197_group, (bpm / 100) % 10));
 #endif
 }
 
@@ -451,8 +454,8 @@ static void watchface_80_2_dial_set_weather(int8_t temp, int icon)
         return;
     }
 
-    lv_image_set_src(face_80_2_dial_53_86861, face_80_2_dial_43_86861_group[(temp / 1) % 10]);
-    lv_image_set_src(face_80_2_dial_54_86861, face_80_2_dial_43_86861_group[(temp / 10) % 10]);
+    lv_image_set_src(face_80_2_dial_53_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (temp / 1) % 10));
+    lv_image_set_src(face_80_2_dial_54_86861, zsw_ui_atlas_get(&atlas, face_80_2_dial_43_86861_group, (temp / 10) % 10));
     if (temp >= 0) {
         lv_obj_add_flag(face_80_2_dial_56_25742, LV_OBJ_FLAG_HIDDEN);
     } else {
@@ -503,6 +506,11 @@ void watchface_80_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_80_2_dial = lv_obj_create(parent);
     watchface_80_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_80_2_dial_2_85197_group, ARRAY_SIZE(face_80_2_dial_2_85197_group));
+    zsw_ui_atlas_add_group(&atlas, face_80_2_dial_43_86861_group, ARRAY_SIZE(face_80_2_dial_43_86861_group));
+    zsw_ui_atlas_add_group(&atlas, face_80_2_dial_37_96394_group, ARRAY_SIZE(face_80_2_dial_37_96394_group));
+    zsw_ui_atlas_add_group(&atlas, face_80_2_dial_35_113802_group, ARRAY_SIZE(face_80_2_dial_35_113802_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_80_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_80_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -974,7 +982,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_80_2_dial_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_80_2_dial_invalidate_cached,
     .get_preview_img = watchface_80_2_dial_get_preview_img,
-    .name = "Astronaut"
+    .name = "Astronaut",
+    .asset_prefix = "face_80_2_dial_",
 };
 
 static int watchface_80_2_dial_init(void)
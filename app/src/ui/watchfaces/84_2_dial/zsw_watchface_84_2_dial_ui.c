@@ -11,12 +11,14 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
 LOG_MODULE_REGISTER(watchface_84_2_dial, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_84_2_dial = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_84_2_dial_evt_cb;
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -164,6 +166,7 @@ static void watchface_84_2_dial_remove(void)
 
     lv_obj_del(face_84_2_dial);
     face_84_2_dial = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_84_2_dial_invalidate_cached(void)
@@ -197,39 +200,39 @@ static void watchface_84_2_dial_set_datetime(int day_of_week, int date, int day,
     month += 1;
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_84_2_dial_2_232486, face_84_2_dial_2_232486_group[(hour / 1) % 10]);
+        lv_image_set_src(face_84_2_dial_2_232486, zsw_ui_atlas_get(&atlas, face_84_2_dial_2_232486_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_84_2_dial_3_232486, face_84_2_dial_2_232486_group[(hour / 10) % 10]);
+        lv_image_set_src(face_84_2_dial_3_232486, zsw_ui_atlas_get(&atlas, face_84_2_dial_2_232486_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_84_2_dial_4_232486, face_84_2_dial_2_232486_group[(minute / 1) % 10]);
+        lv_image_set_src(face_84_2_dial_4_232486, zsw_ui_atlas_get(&atlas, face_84_2_dial_2_232486_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_84_2_dial_5_232486, face_84_2_dial_2_232486_group[(minute / 10) % 10]);
+        lv_image_set_src(face_84_2_dial_5_232486, zsw_ui_atlas_get(&atlas, face_84_2_dial_2_232486_group, (minute / 10) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_84_2_dial_7_231194, face_84_2_dial_7_231194_group[(month / 1) % 10]);
+        lv_image_set_src(face_84_2_dial_7_231194, zsw_ui_atlas_get(&atlas, face_84_2_dial_7_231194_group, (month / 1) % 10));
     }
 
     if (getPlaceValue(last_month, 2) != getPlaceValue(month, 2)) {
-        lv_image_set_src(face_84_2_dial_8_231194, face_84_2_dial_7_231194_group[(month / 10) % 10]);
+        lv_image_set_src(face_84_2_dial_8_231194, zsw_ui_atlas_get(&atlas, face_84_2_dial_7_231194_group, (month / 10) % 10));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_84_2_dial_9_231194, face_84_2_dial_7_231194_group[(day / 1) % 10]);
+        lv_image_set_src(face_84_2_dial_9_231194, zsw_ui_atlas_get(&atlas, face_84_2_dial_7_231194_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_84_2_dial_10_231194, face_84_2_dial_7_231194_group[(day / 10) % 10]);
+        lv_image_set_src(face_84_2_dial_10_231194, zsw_ui_atlas_get(&atlas, face_84_2_dial_7_231194_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_84_2_dial_12_247724, face_84_2_dial_12_247724_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_84_2_dial_12_247724, zsw_ui_atlas_get(&atlas, face_84_2_dial_12_247724_group, ((weekday + 6) / 1) % 7));
     }
 
     last_hour = hour;
@@ -304,6 +307,10 @@ void watchface_84_2_dial_show(lv_obj_t *parent, watchface_app_evt_listener evt_c
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_84_2_dial = lv_obj_create(parent);
     watchface_84_2_dial_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_84_2_dial_2_232486_group, ARRAY_SIZE(face_84_2_dial_2_232486_group));
+    zsw_ui_atlas_add_group(&atlas, face_84_2_dial_7_231194_group, ARRAY_SIZE(face_84_2_dial_7_231194_group));
+    zsw_ui_atlas_add_group(&atlas, face_84_2_dial_12_247724_group, ARRAY_SIZE(face_84_2_dial_12_247724_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_84_2_dial, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_84_2_dial, LV_SCROLLBAR_MODE_OFF);
@@ -446,6 +453,7 @@ static watchface_ui_api_t ui_api = {
     .ui_invalidate_cached = watchface_84_2_dial_invalidate_cached,
     .get_preview_img = watchface_84_2_dial_get_preview_img,
     .name = "Floating Space",
+    .asset_prefix = "face_84_2_dial_",
 };
 
 static int watchface_84_2_dial_init(void)
@@ -20,6 +20,7 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_anim.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
@@ -67,7 +68,7 @@ ZSW_LV_IMG_DECLARE(face_digital_preview);
 LV_FONT_DECLARE(ui_font_aliean_47);
 LV_FONT_DECLARE(ui_font_aliean_25);
 
-ZSW_LV_IMG_DECLARE(snoopy)
+ZSW_LV_IMG_DECLARE(snoopy_anim)
 
 // Remember last values as if no change then
 // no reason to waste resourses and redraw
@@ -451,12 +452,18 @@ static void watchface_show(lv_obj_t *parent, watchface_app_evt_listener evt_cb,
     lv_obj_set_style_img_recolor_opa(ui_weather_icon, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     if (settings->animations_on) {
-        lv_obj_t *img = lv_gif_create(ui_digital_watchface);
-        lv_gif_set_src(img, ZSW_LV_IMG_USE_WITH_MOUNT(snoopy, "/lvgl_lfs"));
-        lv_obj_set_align(img, LV_ALIGN_CENTER);
-        lv_obj_set_width(img, LV_SIZE_CONTENT);
-        lv_obj_set_height(img, LV_SIZE_CONTENT);
-        lv_obj_set_y(img, 45);
+        lv_obj_t *img = zsw_ui_anim_create(ui_digital_watchface);
+        // An animation that can not be loaded is left out, the watchface stays static.
+        if (img && zsw_ui_anim_set_src(img, ZSW_LV_IMG_USE_WITH_MOUNT(snoopy_anim, "/lvgl_lfs")) != 0) {
+            lv_obj_delete(img);
+            img = NULL;
+        }
+        if (img) {
+            lv_obj_set_align(img, LV_ALIGN_CENTER);
+            lv_obj_set_width(img, LV_SIZE_CONTENT);
+            lv_obj_set_height(img, LV_SIZE_CONTENT);
+            lv_obj_set_y(img, 45);
+        }
     }
 
     // Listeners
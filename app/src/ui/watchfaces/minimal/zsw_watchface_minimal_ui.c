@@ -21,6 +21,8 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/utils/zsw_ui_utils.h"
+#include "ui/utils/zsw_ui_hand.h"
+#include "ui/utils/zsw_ui_anim.h"
 #include "applications/watchface/watchface_app.h"
 #include "ui/watchfaces/zsw_ui_notification_area.h"
 
@@ -30,9 +32,8 @@ static void watchface_ui_invalidate_cached(void);
 
 LV_IMG_DECLARE(hour_minimal);
 LV_IMG_DECLARE(minute_minimal);
-LV_IMG_DECLARE(second_minimal);
 ZSW_LV_IMG_DECLARE(face_minimal_preview);
-ZSW_LV_IMG_DECLARE(snoopy_alt);
+ZSW_LV_IMG_DECLARE(snoopy_alt_anim);
 
 static zsw_ui_notification_area_t *zsw_ui_notifications_area;
 
@@ -41,7 +42,7 @@ static lv_obj_t *ui_minimal_watchface;
 static lv_obj_t *ui_hour_img;
 static lv_obj_t *ui_min_img;
 static lv_obj_t *ui_day_data_label;
-static lv_obj_t *ui_second_img;
+static lv_obj_t *ui_second_hand;
 
 // Remember last values as if no change then
 // no reason to waste resourses and redraw
@@ -49,6 +50,7 @@ static int last_hour = -1;
 static int last_minute = -1;
 static int last_second = -1;
 static int last_num_not = -1;
+static int last_date = -1;
 
 static void watchface_show(lv_obj_t *parent, watchface_app_evt_listener evt_cb, zsw_settings_watchface_t *settings)
 {
@@ -103,27 +105,26 @@ static void watchface_show(lv_obj_t *parent, watchface_app_evt_listener evt_cb,
     lv_obj_set_style_text_color(ui_day_data_label, lv_color_hex(0xCF9C60), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_opa(ui_day_data_label, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    ui_second_img = lv_image_create(ui_minimal_watchface);
-    lv_image_set_src(ui_second_img, &second_minimal);
-    lv_obj_set_width(ui_second_img, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_second_img, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_second_img, -1);
-    lv_obj_set_y(ui_second_img, -47);
-    lv_obj_set_align(ui_second_img, LV_ALIGN_CENTER);
-    lv_obj_add_flag(ui_second_img, LV_OBJ_FLAG_ADV_HITTEST);     /// Flags
-    lv_obj_clear_flag(ui_second_img, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_image_set_pivot(ui_second_img, 4, 108);
-    lv_obj_set_style_img_recolor(ui_second_img, lv_color_hex(0xFF4242), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_img_recolor_opa(ui_second_img, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    // Drawn as a line, the second hand is updated at 20 Hz with smooth_second_hand.
+    ui_second_hand = zsw_ui_hand_create(ui_minimal_watchface, 0, 1, 108, 12, 2, lv_color_hex(0xFF4242));
+    if (ui_second_hand) {
+        zsw_ui_hand_set_hub(ui_second_hand, 3);
+    }
 
     if (settings->animations_on) {
-        lv_obj_t *img = lv_gif_create(ui_minimal_watchface);
-        lv_gif_set_src(img, ZSW_LV_IMG_USE_WITH_MOUNT(snoopy_alt, "/lvgl_lfs"));
-        lv_obj_set_align(img, LV_ALIGN_CENTER);
-        lv_obj_set_width(img, LV_SIZE_CONTENT);
-        lv_obj_set_height(img, LV_SIZE_CONTENT);
-        lv_obj_set_x(img, -10);
-        lv_obj_set_y(img, 90);
+        lv_obj_t *img = zsw_ui_anim_create(ui_minimal_watchface);
+        // An animation that can not be loaded is left out, the watchface stays static.
+        if (img && zsw_ui_anim_set_src(img, ZSW_LV_IMG_USE_WITH_MOUNT(snoopy_alt_anim, "/lvgl_lfs")) != 0) {
+            lv_obj_delete(img);
+            img = NULL;
+        }
+        if (img) {
+            lv_obj_set_align(img, LV_ALIGN_CENTER);
+            lv_obj_set_width(img, LV_SIZE_CONTENT);
+            lv_obj_set_height(img, LV_SIZE_CONTENT);
+            lv_obj_set_x(img, -10);
+            lv_obj_set_y(img, 90);
+        }
     }
 
     zsw_ui_notifications_area = zsw_ui_notification_area_add(ui_minimal_watchface);
@@ -183,7 +184,10 @@ static void watchface_set_datetime(int day_of_week, int date, int day, int month
     }
     char *days[] = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
 
-    lv_label_set_text_fmt(ui_day_data_label, "%s %d", days[day_of_week], date);
+    if (date != last_date) {
+        lv_label_set_text_fmt(ui_day_data_label, "%s %d", days[day_of_week], date);
+        last_date = date;
+    }
 
     hour = hour % 12;
     // Move hour hand with greater resolution than 12.
@@ -195,7 +199,9 @@ static void watchface_set_datetime(int day_of_week, int date, int day, int month
     lv_image_set_rotation(ui_min_img, last_minute);
 
     last_second += lv_map(usec, 0, 999999, 0, 3600 / 60);
-    lv_image_set_rotation(ui_second_img, last_second);
+    if (ui_second_hand) {
+        zsw_ui_hand_set_angle(ui_second_hand, last_second);
+    }
 }
 
 static void watchface_set_watch_env_sensors(int pressure)
@@ -208,6 +214,7 @@ static void watchface_ui_invalidate_cached(void)
     last_minute = -1;
     last_num_not = -1;
     last_second = -1;
+    last_date = -1;
 }
 
 static const void *watchface_get_preview_img(void)
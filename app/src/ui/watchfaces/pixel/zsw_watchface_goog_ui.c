@@ -11,11 +11,13 @@
 #include <zephyr/logging/log.h>
 
 #include "ui/zsw_ui.h"
+#include "ui/utils/zsw_ui_atlas.h"
 #include "applications/watchface/watchface_app.h"
 
 LOG_MODULE_REGISTER(watchface_goog, LOG_LEVEL_WRN);
 
 static lv_obj_t *face_goog = NULL;
+static zsw_ui_atlas_t atlas;
 static watchface_app_evt_listener ui_goog_evt_cb;
 
 static int last_date = -1;
@@ -264,6 +266,7 @@ static void watchface_goog_remove(void)
 
     lv_obj_del(face_goog);
     face_goog = NULL;
+    zsw_ui_atlas_free(&atlas);
 }
 
 static void watchface_goog_invalidate_cached(void)
@@ -296,35 +299,35 @@ static void watchface_goog_set_datetime(int day_of_week, int date, int day, int
     month += 1;
 
     if (getPlaceValue(last_weekday, 1) != getPlaceValue(weekday, 1)) {
-        lv_image_set_src(face_goog_22_72744, face_goog_22_72744_group[((weekday + 6) / 1) % 7]);
+        lv_image_set_src(face_goog_22_72744, zsw_ui_atlas_get(&atlas, face_goog_22_72744_group, ((weekday + 6) / 1) % 7));
     }
 
     if (getPlaceValue(last_day, 1) != getPlaceValue(day, 1)) {
-        lv_image_set_src(face_goog_23_59114, face_goog_1_59114_group[(day / 1) % 10]);
+        lv_image_set_src(face_goog_23_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (day / 1) % 10));
     }
 
     if (getPlaceValue(last_day, 2) != getPlaceValue(day, 2)) {
-        lv_image_set_src(face_goog_24_59114, face_goog_1_59114_group[(day / 10) % 10]);
+        lv_image_set_src(face_goog_24_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (day / 10) % 10));
     }
 
     if (getPlaceValue(last_month, 1) != getPlaceValue(month, 1)) {
-        lv_image_set_src(face_goog_27_87610, face_goog_27_87610_group[(month / 1) % 12]);
+        lv_image_set_src(face_goog_27_87610, zsw_ui_atlas_get(&atlas, face_goog_27_87610_group, (month / 1) % 12));
     }
 
     if (getPlaceValue(last_hour, 1) != getPlaceValue(hour, 1)) {
-        lv_image_set_src(face_goog_28_97966, face_goog_28_97966_group[(hour / 1) % 10]);
+        lv_image_set_src(face_goog_28_97966, zsw_ui_atlas_get(&atlas, face_goog_28_97966_group, (hour / 1) % 10));
     }
 
     if (getPlaceValue(last_hour, 2) != getPlaceValue(hour, 2)) {
-        lv_image_set_src(face_goog_29_97966, face_goog_28_97966_group[(hour / 10) % 10]);
+        lv_image_set_src(face_goog_29_97966, zsw_ui_atlas_get(&atlas, face_goog_28_97966_group, (hour / 10) % 10));
     }
 
     if (getPlaceValue(last_minute, 1) != getPlaceValue(minute, 1)) {
-        lv_image_set_src(face_goog_30_97966, face_goog_28_97966_group[(minute / 1) % 10]);
+        lv_image_set_src(face_goog_30_97966, zsw_ui_atlas_get(&atlas, face_goog_28_97966_group, (minute / 1) % 10));
     }
 
     if (getPlaceValue(last_minute, 2) != getPlaceValue(minute, 2)) {
-        lv_image_set_src(face_goog_31_97966, face_goog_28_97966_group[(minute / 10) % 10]);
+        lv_image_set_src(face_goog_31_97966, zsw_ui_atlas_get(&atlas, face_goog_28_97966_group, (minute / 10) % 10));
     }
 
     last_hour = hour;
@@ -341,39 +344,39 @@ static void watchface_goog_set_step(int32_t steps, int32_t distance, int32_t kca
     }
 
     if (getPlaceValue(last_steps, 1) != getPlaceValue(steps, 1)) {
-        lv_image_set_src(face_goog_1_59114, face_goog_1_59114_group[(steps / 1) % 10]);
+        lv_image_set_src(face_goog_1_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (steps / 1) % 10));
     }
 
     if (getPlaceValue(last_steps, 2) != getPlaceValue(steps, 2)) {
-        lv_image_set_src(face_goog_2_59114, face_goog_1_59114_group[(steps / 10) % 10]);
+        lv_image_set_src(face_goog_2_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (steps / 10) % 10));
     }
 
     if (getPlaceValue(last_steps, 3) != getPlaceValue(steps, 3)) {
-        lv_image_set_src(face_goog_3_59114, face_goog_1_59114_group[(steps / 100) % 10]);
+        lv_image_set_src(face_goog_3_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (steps / 100) % 10));
     }
 
     if (getPlaceValue(last_steps, 4) != getPlaceValue(steps, 4)) {
-        lv_image_set_src(face_goog_4_59114, face_goog_1_59114_group[(steps / 1000) % 10]);
+        lv_image_set_src(face_goog_4_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (steps / 1000) % 10));
     }
 
     if (getPlaceValue(last_steps, 5) != getPlaceValue(steps, 5)) {
-        lv_image_set_src(face_goog_5_59114, face_goog_1_59114_group[(steps / 10000) % 10]);
+        lv_image_set_src(face_goog_5_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (steps / 10000) % 10));
     }
 
     if (getPlaceValue(last_kcal, 1) != getPlaceValue(kcal, 1)) {
-        lv_image_set_src(face_goog_6_59114, face_goog_1_59114_group[(kcal / 1) % 10]);
+        lv_image_set_src(face_goog_6_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (kcal / 1) % 10));
     }
 
     if (getPlaceValue(last_kcal, 2) != getPlaceValue(kcal, 2)) {
-        lv_image_set_src(face_goog_7_59114, face_goog_1_59114_group[(kcal / 10) % 10]);
+        lv_image_set_src(face_goog_7_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (kcal / 10) % 10));
     }
 
     if (getPlaceValue(last_kcal, 3) != getPlaceValue(kcal, 3)) {
-        lv_image_set_src(face_goog_8_59114, face_goog_1_59114_group[(kcal / 100) % 10]);
+        lv_image_set_src(face_goog_8_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (kcal / 100) % 10));
     }
 
     if (getPlaceValue(last_kcal, 4) != getPlaceValue(kcal, 4)) {
-        lv_image_set_src(face_goog_9_59114, face_goog_1_59114_group[(kcal / 1000) % 10]);
+        lv_image_set_src(face_goog_9_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (kcal / 1000) % 10));
     }
 
     last_steps = steps;
@@ -386,9 +389,9 @@ static void watchface_goog_set_hrm(int32_t bpm, int32_t oxygen)
         return;
     }
 
-    lv_image_set_src(face_goog_13_59114, face_goog_1_59114_group[(bpm / 1) % 10]);
-    lv_image_set_src(face_goog_14_59114, face_goog_1_59114_group[(bpm / 10) % 10]);
-    lv_image_set_src(face_goog_15_59114, face_goog_1_59114_group[(bpm / 100) % 10]);
+    lv_image_set_src(face_goog_13_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (bpm / 1) % 10));
+    lv_image_set_src(face_goog_14_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (bpm / 10) % 10));
+    lv_image_set_src(face_goog_15_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (bpm / 100) % 10));
 
 }
 
@@ -398,8 +401,8 @@ static void watchface_goog_set_weather(int8_t temp, int icon)
         return;
     }
 
-    lv_image_set_src(face_goog_34_59114, face_goog_1_59114_group[(temp / 1) % 10]);
-    lv_image_set_src(face_goog_35_59114, face_goog_1_59114_group[(temp / 10) % 10]);
+    lv_image_set_src(face_goog_34_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (temp / 1) % 10));
+    lv_image_set_src(face_goog_35_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (temp / 10) % 10));
     if (temp >= 0) {
         lv_obj_add_flag(face_goog_37_65535, LV_OBJ_FLAG_HIDDEN);
     } else {
@@ -423,15 +426,15 @@ static void watchface_goog_set_battery_percent(int32_t percent, int32_t battery)
         return;
     }
 
-    lv_image_set_src(face_goog_16_59114, face_goog_1_59114_group[(percent / 1) % 10]);
-    lv_image_set_src(face_goog_17_59114, face_goog_1_59114_group[(percent / 10) % 10]);
-    lv_image_set_src(face_goog_18_59114, face_goog_1_59114_group[(percent / 100) % 10]);
+    lv_image_set_src(face_goog_16_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (percent / 1) % 10));
+    lv_image_set_src(face_goog_17_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (percent / 10) % 10));
+    lv_image_set_src(face_goog_18_59114, zsw_ui_atlas_get(&atlas, face_goog_1_59114_group, (percent / 100) % 10));
     if (percent < 100) {
         lv_obj_add_flag(face_goog_18_59114, LV_OBJ_FLAG_HIDDEN);
     } else {
         lv_obj_clear_flag(face_goog_18_59114, LV_OBJ_FLAG_HIDDEN);
     }
-    lv_image_set_src(face_goog_20_61728, face_goog_20_61728_group[lv_map(percent, 0, 100, 0, 6)]);
+    lv_image_set_src(face_goog_20_61728, zsw_ui_atlas_get(&atlas, face_goog_20_61728_group, lv_map(percent, 0, 100, 0, 6)));
 }
 
 static void watchface_goog_set_num_notifcations(int32_t number)
@@ -457,6 +460,12 @@ void watchface_goog_show(lv_obj_t *parent, watchface_app_evt_listener evt_cb, zs
     lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
     face_goog = lv_obj_create(parent);
     watchface_goog_invalidate_cached();
+    zsw_ui_atlas_add_group(&atlas, face_goog_1_59114_group, ARRAY_SIZE(face_goog_1_59114_group));
+    zsw_ui_atlas_add_group(&atlas, face_goog_28_97966_group, ARRAY_SIZE(face_goog_28_97966_group));
+    zsw_ui_atlas_add_group(&atlas, face_goog_20_61728_group, ARRAY_SIZE(face_goog_20_61728_group));
+    zsw_ui_atlas_add_group(&atlas, face_goog_22_72744_group, ARRAY_SIZE(face_goog_22_72744_group));
+    zsw_ui_atlas_add_group(&atlas, face_goog_27_87610_group, ARRAY_SIZE(face_goog_27_87610_group));
+    zsw_ui_atlas_load(&atlas);
 
     lv_obj_clear_flag(face_goog, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scrollbar_mode(face_goog, LV_SCROLLBAR_MODE_OFF);
@@ -776,7 +785,8 @@ static watchface_ui_api_t ui_api = {
     .set_watch_env_sensors = watchface_goog_set_watch_env_sensors,
     .ui_invalidate_cached = watchface_goog_invalidate_cached,
     .get_preview_img = watchface_goog_get_preview_img,
-    .name = "Pixel"
+    .name = "Pixel",
+    .asset_prefix = "face_goog_",
 };
 
 static int watchface_goog_init(void)
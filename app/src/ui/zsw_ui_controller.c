@@ -46,6 +46,7 @@
 #include "managers/zsw_recording_manager.h"
 #include "ui/overlay/zsw_recording_overlay.h"
 #include "ui/overlay/zsw_voice_memo_popup.h"
+#include "zsw_boot.h"
 #endif
 
 typedef enum ui_state {
@@ -449,6 +450,7 @@ int zsw_ui_controller_init(void)
     if (!onboarding_done) {
         watch_state = INIT_STATE;
         zsw_onboarding_ui_show(root_screen, on_onboarding_done);
+        zsw_boot_first_frame_pending();
     } else {
         watch_state = WATCHFACE_STATE;
         watchface_app_start(root_screen, input_group, on_watchface_app_event_callback);
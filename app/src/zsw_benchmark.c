@@ -0,0 +1,328 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/shell/shell.h>
+#include <lvgl.h>
+
+#include "zsw_benchmark.h"
+#include "zsw_timing.h"
+#include "history/zsw_history.h"
+#include "ble/gadgetbridge/ble_gadgetbridge.h"
+#ifdef CONFIG_ZSW_MIC
+#include "applications/mic/spectrum_analyzer.h"
+#include "applications/mic/spectrum_analyzer_q15.h"
+#endif
+
+#define BENCHMARK_DEFAULT_ITERATIONS    20
+#define BENCHMARK_MAX_ITERATIONS        1000
+#define BENCHMARK_TIMEOUT_S             30
+#define BENCHMARK_DEFAULT_RAW_FS_FILE   "ZSWatch_logo_small.bin"
+#define BENCHMARK_RAW_FS_READ_LEN       1024
+#define BENCHMARK_HISTORY_KEY           "bench/hist"
+#define BENCHMARK_HISTORY_SAMPLES       64
+#define BENCHMARK_SPECTRUM_BARS         30
+// Size of the blocks the microphone driver delivers, 1 ms at 16 kHz.
+#define BENCHMARK_SPECTRUM_BLOCK        16
+
+typedef struct {
+    uint32_t num;
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+} benchmark_stat_t;
+
+typedef struct {
+    benchmark_stat_t render;
+    benchmark_stat_t raw_fs_read;
+    benchmark_stat_t gb_parse;
+    benchmark_stat_t history_save;
+    benchmark_stat_t spectrum_float;
+    benchmark_stat_t spectrum_q15;
+    uint32_t gb_bytes;
+    int raw_fs_err;
+} benchmark_result_t;
+
+typedef struct {
+    uint8_t data[8];
+} benchmark_history_sample_t;
+
+/*
+ * Gadgetbridge traffic recorded from a phone, replayed as complete messages through the
+ * parser the BLE NUS receive path uses. Parsed data is dropped instead of published.
+ */
+static const char *const recorded_gb_traffic[] = {
+    "GB({\"t\":\"notify\",\"id\":1700000001,\"src\":\"Messenger\",\"title\":\"Alice\",\"body\":\"Are we still on for lunch tomorrow? I can book a table at 12.\"})\n",
+    "GB({\"t\":\"notify-\",\"id\":1700000001})\n",
+    "GB({\"t\":\"musicinfo\",\"artist\":\"The Band\",\"album\":\"Live at the Venue\",\"track\":\"Opening Song\",\"dur\":254,\"c\":12,\"n\":3})\n",
+    "GB({\"t\":\"musicstate\",\"state\":\"play\",\"position\":42,\"shuffle\":1,\"repeat\":1})\n",
+    "GB({\"t\":\"weather\",\"temp\":288,\"hum\":71,\"code\":802,\"txt\":\"slightly cloudy\",\"wind\":3.6,\"wdir\":220,\"loc\":\"MALMO\"})\n",
+    "GB({\"t\":\"notify\",\"id\":1700000002,\"src\":\"Gmail\",\"title\":\"jakob@mail.se\",\"sender\":\"Jakob\",\"subject\":\"Build results\",\"body\":\"All checks passed on the latest commit.\"})\n",
+    "GB({\"t\":\"notify-\",\"id\":1700000002})\n",
+};
+
+static benchmark_stat_t task_handler_stat;
+static benchmark_result_t result;
+static int iterations;
+static char raw_fs_path[64];
+
+static zsw_history_t history_context;
+static benchmark_history_sample_t history_samples[BENCHMARK_HISTORY_SAMPLES];
+
+static void benchmark_work_handler(struct k_work *work);
+
+K_WORK_DEFINE(benchmark_work, benchmark_work_handler);
+K_SEM_DEFINE(benchmark_done_sem, 0, 1);
+
+static void stat_reset(benchmark_stat_t *stat)
+{
+    memset(stat, 0, sizeof(*stat));
+    stat->min = UINT32_MAX;
+}
+
+static void stat_add(benchmark_stat_t *stat, uint32_t value)
+{
+    stat->num++;
+    stat->sum += value;
+    stat->min = MIN(stat->min, value);
+    stat->max = MAX(stat->max, value);
+}
+
+void zsw_benchmark_add_task_handler_sample(uint32_t duration_us)
+{
+    stat_add(&task_handler_stat, duration_us);
+}
+
+static void benchmark_render(void)
+{
+    uint32_t start;
+
+    for (int i = 0; i < iterations; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        start = zsw_timing_get_us();
+        lv_refr_now(NULL);
+        stat_add(&result.render, zsw_timing_get_us() - start);
+    }
+}
+
+static void benchmark_raw_fs_read(void)
+{
+    static uint8_t buf[BENCHMARK_RAW_FS_READ_LEN];
+    lv_fs_file_t file;
+    lv_fs_res_t res;
+    uint32_t bytes_read;
+    uint32_t start;
+
+    for (int i = 0; i < iterations; i++) {
+        start = zsw_timing_get_us();
+        res = lv_fs_open(&file, raw_fs_path, LV_FS_MODE_RD);
+        if (res != LV_FS_RES_OK) {
+            result.raw_fs_err = res;
+            return;
+        }
+        res = lv_fs_read(&file, buf, sizeof(buf), &bytes_read);
+        lv_fs_close(&file);
+        if (res != LV_FS_RES_OK) {
+            result.raw_fs_err = res;
+            return;
+        }
+        stat_add(&result.raw_fs_read, zsw_timing_get_us() - start);
+    }
+}
+
+static void benchmark_gb_parse(void)
+{
+    uint32_t start;
+    uint16_t len;
+
+    for (int i = 0; i < iterations; i++) {
+        for (int j = 0; j < ARRAY_SIZE(recorded_gb_traffic); j++) {
+            len = strlen(recorded_gb_traffic[j]);
+            start = zsw_timing_get_us();
+            ble_gadgetbridge_parse_dry_run(recorded_gb_traffic[j], len);
+            stat_add(&result.gb_parse, zsw_timing_get_us() - start);
+            result.gb_bytes += len;
+        }
+    }
+}
+
+static void benchmark_history_save(void)
+{
+    benchmark_history_sample_t sample;
+    uint32_t start;
+
+    zsw_history_init(&history_context, BENCHMARK_HISTORY_SAMPLES, sizeof(benchmark_history_sample_t),
+                     history_samples, BENCHMARK_HISTORY_KEY);
+
+    for (int i = 0; i < iterations; i++) {
+        memset(&sample, i, sizeof(sample));
+        zsw_history_add(&history_context, &sample);
+        start = zsw_timing_get_us();
+        zsw_history_save(&history_context);
+        stat_add(&result.history_save, zsw_timing_get_us() - start);
+    }
+
+    zsw_history_del(&history_context);
+}
+
+#ifdef CONFIG_ZSW_MIC
+// Two tones and some noise, so both analyzers do the same amount of work on every bar.
+static void fill_spectrum_frame(int16_t *samples, int frame)
+{
+    uint32_t noise = 12345 + frame;
+
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        noise = noise * 1103515245 + 12345;
+        samples[i] = 6000 * sinf(2 * 3.14159265f * 440 * (i + frame * SPECTRUM_FFT_SIZE) / 16000) +
+                     2000 * sinf(2 * 3.14159265f * 3000 * i / 16000) + (int16_t)(noise >> 16) / 64;
+    }
+}
+
+// One frame each, the q15 analyzer is fed in driver sized blocks like in the Mic app.
+static void benchmark_spectrum(void)
+{
+    static int16_t samples[SPECTRUM_FFT_SIZE];
+    uint8_t magnitudes[BENCHMARK_SPECTRUM_BARS];
+    uint32_t start;
+
+    // Busy if the Mic app is open, the stats are then left empty.
+    if (spectrum_analyzer_q15_init(BENCHMARK_SPECTRUM_BARS) != 0) {
+        return;
+    }
+    if (spectrum_analyzer_init() != 0) {
+        spectrum_analyzer_q15_cleanup();
+        return;
+    }
+
+    for (int i = 0; i < iterations; i++) {
+        fill_spectrum_frame(samples, i);
+
+        start = zsw_timing_get_us();
+        spectrum_analyzer_process(samples, SPECTRUM_FFT_SIZE, magnitudes, BENCHMARK_SPECTRUM_BARS, 1.0f);
+        stat_add(&result.spectrum_float, zsw_timing_get_us() - start);
+
+        start = zsw_timing_get_us();
+        for (int j = 0; j < SPECTRUM_FFT_SIZE; j += BENCHMARK_SPECTRUM_BLOCK) {
+            spectrum_analyzer_q15_add_samples(&samples[j], BENCHMARK_SPECTRUM_BLOCK);
+        }
+        spectrum_analyzer_q15_process(magnitudes, BENCHMARK_SPECTRUM_BARS, 1.0f);
+        stat_add(&result.spectrum_q15, zsw_timing_get_us() - start);
+    }
+
+    spectrum_analyzer_cleanup();
+    spectrum_analyzer_q15_cleanup();
+}
+#endif
+
+// Runs in the system workqueue, which is also where LVGL is driven from.
+static void benchmark_work_handler(struct k_work *work)
+{
+    benchmark_render();
+    benchmark_raw_fs_read();
+    benchmark_gb_parse();
+    benchmark_history_save();
+#ifdef CONFIG_ZSW_MIC
+    benchmark_spectrum();
+#endif
+    k_sem_give(&benchmark_done_sem);
+}
+
+static void print_stat(const struct shell *sh, const char *name, const benchmark_stat_t *stat)
+{
+    if (stat->num == 0) {
+        shell_fprintf(sh, SHELL_NORMAL, "\"%s\":null,", name);
+        return;
+    }
+
+    shell_fprintf(sh, SHELL_NORMAL, "\"%s\":{\"n\":%u,\"avg_us\":%u,\"min_us\":%u,\"max_us\":%u},", name,
+                  stat->num, (uint32_t)(stat->sum / stat->num), stat->min, stat->max);
+}
+
+static int cmd_bench_reset(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    stat_reset(&task_handler_stat);
+    shell_print(sh, "Benchmark counters reset");
+    return 0;
+}
+
+static int cmd_bench_run(const struct shell *sh, size_t argc, char **argv)
+{
+    uint32_t gb_total_us;
+
+    iterations = BENCHMARK_DEFAULT_ITERATIONS;
+    if (argc > 1) {
+        iterations = CLAMP(atoi(argv[1]), 1, BENCHMARK_MAX_ITERATIONS);
+    }
+    snprintf(raw_fs_path, sizeof(raw_fs_path), "S:%s", argc > 2 ? argv[2] : BENCHMARK_DEFAULT_RAW_FS_FILE);
+
+    memset(&result, 0, sizeof(result));
+    stat_reset(&result.render);
+    stat_reset(&result.raw_fs_read);
+    stat_reset(&result.gb_parse);
+    stat_reset(&result.history_save);
+    stat_reset(&result.spectrum_float);
+    stat_reset(&result.spectrum_q15);
+
+    k_sem_reset(&benchmark_done_sem);
+    k_work_submit(&benchmark_work);
+    if (k_sem_take(&benchmark_done_sem, K_SECONDS(BENCHMARK_TIMEOUT_S)) != 0) {
+        shell_error(sh, "Benchmark timed out");
+        return -ETIMEDOUT;
+    }
+
+    gb_total_us = (uint32_t)MAX(result.gb_parse.sum, 1);
+
+    // Machine readable, a single line parsed by pytest/test_native_benchmark.py
+    shell_fprintf(sh, SHELL_NORMAL, "BENCH_JSON {\"iterations\":%d,", iterations);
+    print_stat(sh, "render", &result.render);
+    print_stat(sh, "task_handler", &task_handler_stat);
+    print_stat(sh, "raw_fs_read", &result.raw_fs_read);
+    print_stat(sh, "gb_parse", &result.gb_parse);
+    print_stat(sh, "history_save", &result.history_save);
+    print_stat(sh, "spectrum_float", &result.spectrum_float);
+    print_stat(sh, "spectrum_q15", &result.spectrum_q15);
+    shell_fprintf(sh, SHELL_NORMAL, "\"gb_parse_kb_per_s\":%u,\"raw_fs_err\":%d}\n",
+                  (uint32_t)(((uint64_t)result.gb_bytes * USEC_PER_SEC) / (gb_total_us * 1024ULL)),
+                  result.raw_fs_err);
+
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_bench,
+                               SHELL_CMD_ARG(reset, NULL, "Reset passive counters (lv_task_handler)", cmd_bench_reset, 1, 0),
+                               SHELL_CMD_ARG(run, NULL, "Run benchmarks: bench run [iterations] [raw_fs_file]", cmd_bench_run, 1,
+                                             2),
+                               SHELL_SUBCMD_SET_END
+                              );
+
+SHELL_CMD_REGISTER(bench, &sub_bench, "Performance benchmark commands", NULL);
+
+static int zsw_benchmark_init(void)
+{
+    stat_reset(&task_handler_stat);
+    return 0;
+}
+
+SYS_INIT(zsw_benchmark_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,197 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Staged boot. Only what the first watchface frame needs runs before it, the rest is run from
+ * the system workqueue afterwards, one task per run. The LVGL rendering also runs there, so
+ * the watchface stays responsive while for example Bluetooth is brought up.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
+#include <lvgl.h>
+
+#include "zsw_boot.h"
+
+LOG_MODULE_REGISTER(zsw_boot, LOG_LEVEL_INF);
+
+typedef struct boot_phase_t {
+    uint32_t start_ms;
+    uint32_t end_ms;
+} boot_phase_t;
+
+static void boot_work_handler(struct k_work *item);
+
+static K_WORK_DELAYABLE_DEFINE(boot_work, boot_work_handler);
+
+static const char *const stage_names[ZSW_BOOT_STAGE_NUM] = {
+    [ZSW_BOOT_STAGE_CRITICAL] = "critical",
+    [ZSW_BOOT_STAGE_DEFERRED] = "deferred",
+    [ZSW_BOOT_STAGE_IDLE] = "idle",
+};
+
+static zsw_boot_task_t *tasks[ZSW_BOOT_MAX_TASKS];
+static uint8_t num_tasks;
+
+static boot_phase_t phases[ZSW_BOOT_STAGE_NUM];
+static zsw_boot_stage_t current_stage;
+static uint32_t first_frame_ms;
+static bool first_frame_pending;
+static bool done;
+
+void zsw_boot_add_task(zsw_boot_task_t *task)
+{
+    __ASSERT(num_tasks < ZSW_BOOT_MAX_TASKS, "Increase ZSW_BOOT_MAX_TASKS");
+    __ASSERT(task->depends_on != task, "Task depends on itself");
+    tasks[num_tasks++] = task;
+}
+
+static void run_task(zsw_boot_task_t *task)
+{
+    uint32_t start_cycles = k_cycle_get_32();
+
+    task->start_ms = k_uptime_get_32();
+    task->result = task->init();
+    task->duration_us = k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles);
+    task->done = true;
+
+    if (task->result != 0) {
+        LOG_WRN("%s failed: %d", task->name, task->result);
+    }
+    LOG_DBG("%s %s took %u us", stage_names[task->stage], task->name, task->duration_us);
+}
+
+// First task of the stage that has not run, or the first of its dependencies that has not.
+static zsw_boot_task_t *next_task(zsw_boot_stage_t stage)
+{
+    zsw_boot_task_t *task;
+
+    for (int i = 0; i < num_tasks; i++) {
+        if (tasks[i]->done || tasks[i]->stage != stage) {
+            continue;
+        }
+        task = tasks[i];
+        while (task->depends_on && !task->depends_on->done) {
+            task = task->depends_on;
+        }
+        return task;
+    }
+
+    return NULL;
+}
+
+static void start_stage(zsw_boot_stage_t stage, k_timeout_t delay)
+{
+    current_stage = stage;
+    k_work_reschedule(&boot_work, delay);
+}
+
+static void boot_work_handler(struct k_work *item)
+{
+    zsw_boot_task_t *task = next_task(current_stage);
+    boot_phase_t *phase = &phases[current_stage];
+
+    if (phase->start_ms == 0) {
+        phase->start_ms = k_uptime_get_32();
+    }
+
+    if (task) {
+        run_task(task);
+        k_work_reschedule(&boot_work, K_NO_WAIT);
+        return;
+    }
+
+    phase->end_ms = k_uptime_get_32();
+    LOG_INF("Boot stage %s done in %u ms", stage_names[current_stage], phase->end_ms - phase->start_ms);
+
+    if (current_stage == ZSW_BOOT_STAGE_DEFERRED) {
+        start_stage(ZSW_BOOT_STAGE_IDLE, K_MSEC(CONFIG_ZSW_BOOT_IDLE_DELAY_MS));
+    } else {
+        done = true;
+    }
+}
+
+static void on_display_refresh_ready(lv_event_t *e)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), on_display_refresh_ready, NULL);
+    first_frame_ms = k_uptime_get_32();
+    LOG_INF("First frame after %u ms", first_frame_ms);
+
+    if (current_stage == ZSW_BOOT_STAGE_DEFERRED && phases[ZSW_BOOT_STAGE_DEFERRED].start_ms == 0) {
+        start_stage(ZSW_BOOT_STAGE_DEFERRED, K_NO_WAIT);
+    }
+}
+
+void zsw_boot_first_frame_pending(void)
+{
+    lv_display_t *display = lv_display_get_default();
+
+    if (first_frame_pending || display == NULL) {
+        return;
+    }
+
+    first_frame_pending = true;
+    lv_display_add_event_cb(display, on_display_refresh_ready, LV_EVENT_REFR_READY, NULL);
+}
+
+void zsw_boot_start(void)
+{
+    zsw_boot_task_t *task;
+
+    phases[ZSW_BOOT_STAGE_CRITICAL].start_ms = k_uptime_get_32();
+    while ((task = next_task(ZSW_BOOT_STAGE_CRITICAL)) != NULL) {
+        run_task(task);
+    }
+    phases[ZSW_BOOT_STAGE_CRITICAL].end_ms = k_uptime_get_32();
+    LOG_INF("Boot stage critical done in %u ms", phases[ZSW_BOOT_STAGE_CRITICAL].end_ms -
+            phases[ZSW_BOOT_STAGE_CRITICAL].start_ms);
+
+    // Started earlier by the first frame, the timeout covers a UI that never reports it.
+    start_stage(ZSW_BOOT_STAGE_DEFERRED, K_MSEC(CONFIG_ZSW_BOOT_FIRST_FRAME_TIMEOUT_MS));
+}
+
+bool zsw_boot_is_done(void)
+{
+    return done;
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_boot_report(const struct shell *sh, size_t argc, char **argv)
+{
+    const zsw_boot_task_t *task;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "boot phase=first_frame at_ms=%u", first_frame_ms);
+    for (int i = 0; i < ZSW_BOOT_STAGE_NUM; i++) {
+        shell_print(sh, "boot phase=%s start_ms=%u end_ms=%u duration_ms=%u", stage_names[i], phases[i].start_ms,
+                    phases[i].end_ms, phases[i].end_ms >= phases[i].start_ms ? phases[i].end_ms - phases[i].start_ms : 0);
+    }
+    for (int i = 0; i < num_tasks; i++) {
+        task = tasks[i];
+        shell_print(sh, "boot task=%s stage=%s done=%d result=%d start_ms=%u duration_us=%u", task->name,
+                    stage_names[task->stage], task->done, task->result, task->start_ms, task->duration_us);
+    }
+
+    return 0;
+}
+
+SHELL_CMD_REGISTER(boot_stats, NULL, "Boot stage and task durations", cmd_boot_report);
+#endif
@@ -0,0 +1,67 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ZSW_BOOT_MAX_TASKS  24
+
+typedef enum zsw_boot_stage_t {
+    // Run synchronously before the first frame, only what the watchface needs.
+    ZSW_BOOT_STAGE_CRITICAL,
+    // Run after the first frame, one task per system workqueue run so rendering and input go in between.
+    ZSW_BOOT_STAGE_DEFERRED,
+    // Run CONFIG_ZSW_BOOT_IDLE_DELAY_MS after the deferred tasks, for work nothing waits on.
+    ZSW_BOOT_STAGE_IDLE,
+    ZSW_BOOT_STAGE_NUM
+} zsw_boot_stage_t;
+
+typedef struct zsw_boot_task_t {
+    const char *name;
+    int (*init)(void);
+    zsw_boot_stage_t stage;
+    // Run before this task, even if it belongs to a later stage.
+    struct zsw_boot_task_t *depends_on;
+    // Filled in by zsw_boot
+    bool done;
+    int result;
+    uint32_t start_ms;
+    uint32_t duration_us;
+} zsw_boot_task_t;
+
+/** @brief      Add a task to the boot sequence. Tasks of the same stage run in the order they are added.
+ *              Can be called from SYS_INIT, the task must stay valid.
+ *  @param task Task to add
+*/
+void zsw_boot_add_task(zsw_boot_task_t *task);
+
+/** @brief Run the critical tasks and start the deferred ones once the first frame is shown,
+ *         or after CONFIG_ZSW_BOOT_FIRST_FRAME_TIMEOUT_MS. Call once from the system workqueue.
+*/
+void zsw_boot_start(void);
+
+/** @brief Called when the first screen is created, the next completed display refresh is the
+ *         first frame. Does nothing after the first call.
+*/
+void zsw_boot_first_frame_pending(void);
+
+/** @brief  Check if all boot tasks have run.
+ *  @return true when done
+*/
+bool zsw_boot_is_done(void);
@@ -29,6 +29,7 @@
 #include "zsw_clock.h"
 #include "events/zsw_periodic_event.h"
 #include "zsw_retained_ram_storage.h"
+#include "zsw_zbus_trace.h"
 
 #if CONFIG_RTC
 #include <zephyr/drivers/rtc.h>
@@ -44,7 +45,7 @@ static bool rtc_is_available;
 static void zbus_periodic_slow_callback(const struct zbus_channel *chan);
 
 ZBUS_CHAN_DECLARE(periodic_event_1s_chan);
-ZBUS_LISTENER_DEFINE(zsw_clock_lis, zbus_periodic_slow_callback);
+ZSW_ZBUS_LISTENER_DEFINE(zsw_clock_lis, zbus_periodic_slow_callback);
 
 LOG_MODULE_REGISTER(zsw_clock, LOG_LEVEL_INF);
 
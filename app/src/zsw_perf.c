@@ -0,0 +1,504 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Profiling commands. Output is one record per line in key=value form so it can
+ * be parsed by scripts, both over the native_sim PTY and over BLE (MCUmgr shell).
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/zbus/zbus.h>
+#include <lvgl.h>
+
+/* Private sys_heap layout, used to find the largest free chunk without allocating. */
+#include "heap.h"
+#include "zsw_zbus_trace.h"
+
+#define PERF_MAX_THREADS    40
+#define PERF_MAX_CHANNELS   40
+
+typedef struct {
+    k_tid_t tid;
+    uint64_t start_cycles;
+    uint64_t end_cycles;
+} perf_thread_snapshot_t;
+
+typedef struct {
+    const struct zbus_channel *chan;
+    uint32_t start_count;
+    uint32_t end_count;
+} perf_chan_snapshot_t;
+
+typedef enum {
+    PERF_WINDOW_NONE,
+    PERF_WINDOW_RUNNING,
+    PERF_WINDOW_STOPPED,
+} perf_window_state_t;
+
+typedef struct {
+    perf_window_state_t state;
+    int64_t start_ms;
+    int64_t end_ms;
+    uint64_t start_cycles;
+    uint64_t end_cycles;
+    perf_thread_snapshot_t threads[PERF_MAX_THREADS];
+    int num_threads;
+    perf_chan_snapshot_t chans[PERF_MAX_CHANNELS];
+    int num_chans;
+} perf_window_t;
+
+typedef struct {
+    const struct shell *sh;
+    uint64_t window_cycles;
+} perf_print_ctx_t;
+
+static perf_window_t window;
+
+static uint64_t total_execution_cycles(void)
+{
+    k_thread_runtime_stats_t stats;
+
+    k_thread_runtime_stats_all_get(&stats);
+    return stats.execution_cycles;
+}
+
+static uint64_t thread_execution_cycles(k_tid_t tid)
+{
+    k_thread_runtime_stats_t stats;
+
+    if (k_thread_runtime_stats_get(tid, &stats) != 0) {
+        return 0;
+    }
+    return stats.execution_cycles;
+}
+
+static perf_thread_snapshot_t *find_thread_snapshot(k_tid_t tid, bool create)
+{
+    for (int i = 0; i < window.num_threads; i++) {
+        if (window.threads[i].tid == tid) {
+            return &window.threads[i];
+        }
+    }
+
+    if (!create || window.num_threads >= PERF_MAX_THREADS) {
+        return NULL;
+    }
+
+    memset(&window.threads[window.num_threads], 0, sizeof(perf_thread_snapshot_t));
+    window.threads[window.num_threads].tid = tid;
+    return &window.threads[window.num_threads++];
+}
+
+static perf_chan_snapshot_t *find_chan_snapshot(const struct zbus_channel *chan, bool create)
+{
+    for (int i = 0; i < window.num_chans; i++) {
+        if (window.chans[i].chan == chan) {
+            return &window.chans[i];
+        }
+    }
+
+    if (!create || window.num_chans >= PERF_MAX_CHANNELS) {
+        return NULL;
+    }
+
+    memset(&window.chans[window.num_chans], 0, sizeof(perf_chan_snapshot_t));
+    window.chans[window.num_chans].chan = chan;
+    return &window.chans[window.num_chans++];
+}
+
+static void snapshot_thread_cb(const struct k_thread *thread, void *user_data)
+{
+    bool start = (bool)(uintptr_t)user_data;
+    perf_thread_snapshot_t *snapshot = find_thread_snapshot((k_tid_t)thread, true);
+
+    if (!snapshot) {
+        return;
+    }
+
+    if (start) {
+        snapshot->start_cycles = thread_execution_cycles((k_tid_t)thread);
+    } else {
+        snapshot->end_cycles = thread_execution_cycles((k_tid_t)thread);
+    }
+}
+
+static bool snapshot_chan_cb(const struct zbus_channel *chan, void *user_data)
+{
+    bool start = (bool)(uintptr_t)user_data;
+    perf_chan_snapshot_t *snapshot = find_chan_snapshot(chan, true);
+
+    if (!snapshot) {
+        return true;
+    }
+
+    if (start) {
+        snapshot->start_count = zbus_chan_pub_stats_count(chan);
+    } else {
+        snapshot->end_count = zbus_chan_pub_stats_count(chan);
+    }
+
+    return true;
+}
+
+static void get_window(int64_t *duration_ms, uint64_t *cycles)
+{
+    switch (window.state) {
+        case PERF_WINDOW_RUNNING:
+            *duration_ms = k_uptime_get() - window.start_ms;
+            *cycles = total_execution_cycles() - window.start_cycles;
+            break;
+        case PERF_WINDOW_STOPPED:
+            *duration_ms = window.end_ms - window.start_ms;
+            *cycles = window.end_cycles - window.start_cycles;
+            break;
+        case PERF_WINDOW_NONE:
+        default:
+            *duration_ms = k_uptime_get();
+            *cycles = total_execution_cycles();
+            break;
+    }
+}
+
+static const char *window_state_str(void)
+{
+    switch (window.state) {
+        case PERF_WINDOW_RUNNING:
+            return "running";
+        case PERF_WINDOW_STOPPED:
+            return "stopped";
+        default:
+            return "boot";
+    }
+}
+
+static void print_window(const struct shell *sh, const char *report)
+{
+    int64_t duration_ms;
+    uint64_t cycles;
+
+    get_window(&duration_ms, &cycles);
+    shell_print(sh, "perf report=%s window=%s duration_ms=%lld", report, window_state_str(), duration_ms);
+}
+
+static void print_thread_cb(const struct k_thread *thread, void *user_data)
+{
+    perf_print_ctx_t *ctx = user_data;
+    k_tid_t tid = (k_tid_t)thread;
+    perf_thread_snapshot_t *snapshot = find_thread_snapshot(tid, false);
+    const char *name = k_thread_name_get(tid);
+    uint64_t cycles;
+    uint32_t permille;
+
+    switch (window.state) {
+        case PERF_WINDOW_RUNNING:
+            // Threads created after start count from zero
+            cycles = thread_execution_cycles(tid) - (snapshot ? snapshot->start_cycles : 0);
+            break;
+        case PERF_WINDOW_STOPPED:
+            cycles = snapshot ? (snapshot->end_cycles - snapshot->start_cycles) : 0;
+            break;
+        case PERF_WINDOW_NONE:
+        default:
+            cycles = thread_execution_cycles(tid);
+            break;
+    }
+
+    permille = ctx->window_cycles ? (uint32_t)((cycles * 1000) / ctx->window_cycles) : 0;
+    shell_print(ctx->sh, "thread name=%s prio=%d cpu_pct=%u.%u cycles=%llu", name ? name : "unknown",
+                k_thread_priority_get(tid), permille / 10, permille % 10, cycles);
+}
+
+static void print_stack_cb(const struct k_thread *thread, void *user_data)
+{
+    const struct shell *sh = user_data;
+    k_tid_t tid = (k_tid_t)thread;
+    const char *name = k_thread_name_get(tid);
+    size_t size = thread->stack_info.size;
+    size_t unused = 0;
+    size_t used;
+
+    if (k_thread_stack_space_get(thread, &unused) != 0) {
+        shell_print(sh, "stack name=%s size=%zu used=unknown", name ? name : "unknown", size);
+        return;
+    }
+
+    used = size - unused;
+    shell_print(sh, "stack name=%s size=%zu used=%zu unused=%zu used_pct=%zu", name ? name : "unknown", size,
+                used, unused, size ? (used * 100) / size : 0);
+}
+
+/*
+ * Largest block a sys_heap can hand out. Free chunks are kept in buckets by power of
+ * two size, so only the highest non-empty bucket needs to be walked. Caller holds the
+ * heap lock.
+ */
+static size_t sys_heap_largest_free(struct sys_heap *heap)
+{
+    struct z_heap *h = heap->heap;
+    chunksz_t largest = 0;
+    chunkid_t first;
+    chunkid_t c;
+
+    if (h->avail_buckets == 0) {
+        return 0;
+    }
+
+    first = h->buckets[31 - __builtin_clz(h->avail_buckets)].next;
+    c = first;
+    do {
+        largest = MAX(largest, chunk_size(h, c));
+        c = next_free_chunk(h, c);
+    } while (c != first);
+
+    return chunksz_to_bytes(h, largest) - chunk_header_bytes(h);
+}
+
+static void print_heap(const struct shell *sh, const char *name, size_t free_bytes, size_t allocated_bytes,
+                       size_t max_allocated_bytes, size_t largest_free)
+{
+    uint32_t frag_pct = free_bytes ? 100 - (uint32_t)((largest_free * 100) / free_bytes) : 0;
+
+    if (largest_free == 0 && free_bytes > 0) {
+        shell_print(sh, "heap name=%s size=%zu used=%zu free=%zu max_used=%zu largest_free=unknown", name,
+                    free_bytes + allocated_bytes, allocated_bytes, free_bytes, max_allocated_bytes);
+        return;
+    }
+
+    shell_print(sh, "heap name=%s size=%zu used=%zu free=%zu max_used=%zu largest_free=%zu frag_pct=%u", name,
+                free_bytes + allocated_bytes, allocated_bytes, free_bytes, max_allocated_bytes, largest_free, frag_pct);
+}
+
+static void print_k_heaps(const struct shell *sh)
+{
+    struct sys_memory_stats stats;
+    char name[16];
+    int index = 0;
+
+    STRUCT_SECTION_FOREACH(k_heap, heap) {
+        // Stats and free list are read under the heap lock so they describe the same state.
+        k_spinlock_key_t key = k_spin_lock(&heap->lock);
+        int ret = sys_heap_runtime_stats_get(&heap->heap, &stats);
+        size_t largest_free = sys_heap_largest_free(&heap->heap);
+
+        k_spin_unlock(&heap->lock, key);
+        if (ret != 0) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "k_heap%d", index++);
+        print_heap(sh, name, stats.free_bytes, stats.allocated_bytes, stats.max_allocated_bytes, largest_free);
+    }
+}
+
+static void print_lvgl_heap(const struct shell *sh)
+{
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    if (mon.total_size == 0) {
+        shell_print(sh, "heap name=lvgl size=%d used=unknown", CONFIG_LV_Z_MEM_POOL_SIZE);
+        return;
+    }
+
+    // The LVGL heap and its lock are private to the port, free_biggest_size is 0 if it is not tracked.
+    print_heap(sh, "lvgl", mon.free_size, mon.total_size - mon.free_size, mon.max_used, mon.free_biggest_size);
+}
+
+static bool print_chan_cb(const struct zbus_channel *chan, void *user_data)
+{
+    const struct shell *sh = user_data;
+    perf_chan_snapshot_t *snapshot = find_chan_snapshot(chan, false);
+    uint32_t count;
+    int64_t duration_ms;
+    uint64_t cycles;
+
+    switch (window.state) {
+        case PERF_WINDOW_RUNNING:
+            count = zbus_chan_pub_stats_count(chan) - (snapshot ? snapshot->start_count : 0);
+            break;
+        case PERF_WINDOW_STOPPED:
+            count = snapshot ? (snapshot->end_count - snapshot->start_count) : 0;
+            break;
+        case PERF_WINDOW_NONE:
+        default:
+            count = zbus_chan_pub_stats_count(chan);
+            break;
+    }
+
+    get_window(&duration_ms, &cycles);
+    shell_print(sh, "zbus chan=%s pub_count=%u pub_per_min=%u avg_period_ms=%u", zbus_chan_name(chan), count,
+                duration_ms ? (uint32_t)((count * 60000LL) / duration_ms) : 0,
+                zbus_chan_pub_stats_avg_period(chan));
+
+    return true;
+}
+
+#ifdef CONFIG_ZSW_ZBUS_TRACE
+static void print_listener_cb(const zsw_zbus_trace_listener_t *listener, void *user_data)
+{
+    const struct shell *sh = user_data;
+
+    if (listener->count == 0) {
+        return;
+    }
+
+    shell_fprintf(sh, SHELL_NORMAL,
+                  "listener name=%s count=%u avg_us=%u max_us=%u max_chan=%s over_budget=%u latency_avg_us=%u "
+                  "latency_max_us=%u hist=", listener->name, listener->count,
+                  (uint32_t)(listener->exec_sum_us / listener->count), listener->exec_max_us,
+                  listener->max_chan ? zbus_chan_name(listener->max_chan) : "none", listener->over_budget,
+                  (uint32_t)(listener->latency_sum_us / listener->count), listener->latency_max_us);
+    for (int i = 0; i < ZSW_ZBUS_TRACE_HIST_BUCKETS; i++) {
+        shell_fprintf(sh, SHELL_NORMAL, i == 0 ? "%u" : ",%u", listener->hist[i]);
+    }
+    shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+static int cmd_perf_listeners(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    print_window(sh, "listeners");
+    shell_fprintf(sh, SHELL_NORMAL, "listener_hist_limits_us=");
+    for (int i = 0; i < ZSW_ZBUS_TRACE_HIST_BUCKETS - 1; i++) {
+        shell_fprintf(sh, SHELL_NORMAL, i == 0 ? "%u" : ",%u", zsw_zbus_trace_hist_limit_us(i));
+    }
+    shell_fprintf(sh, SHELL_NORMAL, ",inf budget_us=%u\n", CONFIG_ZSW_ZBUS_TRACE_LISTENER_BUDGET_US);
+    zsw_zbus_trace_foreach(print_listener_cb, (void *)sh);
+    return 0;
+}
+#endif
+
+static int cmd_perf_start(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    memset(&window, 0, sizeof(window));
+    window.start_ms = k_uptime_get();
+    window.start_cycles = total_execution_cycles();
+    k_thread_foreach_unlocked(snapshot_thread_cb, (void *)true);
+    zbus_iterate_over_channels_with_user_data(snapshot_chan_cb, (void *)true);
+#ifdef CONFIG_ZSW_ZBUS_TRACE
+    // Listener statistics are cumulative, so the window starts from zero.
+    zsw_zbus_trace_reset();
+#endif
+    window.state = PERF_WINDOW_RUNNING;
+
+    shell_print(sh, "perf window=running");
+    return 0;
+}
+
+static int cmd_perf_stop(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    if (window.state != PERF_WINDOW_RUNNING) {
+        shell_error(sh, "No sampling window running, use: perf start");
+        return -EINVAL;
+    }
+
+    window.end_ms = k_uptime_get();
+    window.end_cycles = total_execution_cycles();
+    k_thread_foreach_unlocked(snapshot_thread_cb, (void *)false);
+    zbus_iterate_over_channels_with_user_data(snapshot_chan_cb, (void *)false);
+    window.state = PERF_WINDOW_STOPPED;
+
+    shell_print(sh, "perf window=stopped duration_ms=%lld", window.end_ms - window.start_ms);
+    return 0;
+}
+
+static int cmd_perf_threads(const struct shell *sh, size_t argc, char **argv)
+{
+    int64_t duration_ms;
+    perf_print_ctx_t ctx = {
+        .sh = sh,
+    };
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    get_window(&duration_ms, &ctx.window_cycles);
+    print_window(sh, "threads");
+    k_thread_foreach_unlocked(print_thread_cb, &ctx);
+    return 0;
+}
+
+static int cmd_perf_stack(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "perf report=stack");
+    k_thread_foreach_unlocked(print_stack_cb, (void *)sh);
+    return 0;
+}
+
+static int cmd_perf_heap(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "perf report=heap");
+    print_k_heaps(sh);
+    print_lvgl_heap(sh);
+    return 0;
+}
+
+static int cmd_perf_zbus(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    print_window(sh, "zbus");
+    zbus_iterate_over_channels_with_user_data(print_chan_cb, (void *)sh);
+    return 0;
+}
+
+static int cmd_perf_all(const struct shell *sh, size_t argc, char **argv)
+{
+    cmd_perf_threads(sh, argc, argv);
+    cmd_perf_stack(sh, argc, argv);
+    cmd_perf_heap(sh, argc, argv);
+    cmd_perf_zbus(sh, argc, argv);
+#ifdef CONFIG_ZSW_ZBUS_TRACE
+    cmd_perf_listeners(sh, argc, argv);
+#endif
+    shell_print(sh, "perf report=end");
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_perf,
+                               SHELL_CMD_ARG(start,   NULL, "Start a sampling window", cmd_perf_start, 1, 0),
+                               SHELL_CMD_ARG(stop,    NULL, "Stop the sampling window", cmd_perf_stop, 1, 0),
+                               SHELL_CMD_ARG(threads, NULL, "CPU usage per thread in the window", cmd_perf_threads, 1, 0),
+                               SHELL_CMD_ARG(stack,   NULL, "Stack high-water marks", cmd_perf_stack, 1, 0),
+                               SHELL_CMD_ARG(heap,    NULL, "k_heap and LVGL memory with fragmentation", cmd_perf_heap, 1, 0),
+                               SHELL_CMD_ARG(zbus,    NULL, "zbus publish counts per channel in the window", cmd_perf_zbus, 1, 0),
+                               SHELL_COND_CMD_ARG(CONFIG_ZSW_ZBUS_TRACE, listeners, NULL,
+                                                  "zbus listener execution times and histograms", cmd_perf_listeners, 1, 0),
+                               SHELL_CMD_ARG(all,     NULL, "All reports", cmd_perf_all, 1, 0),
+                               SHELL_SUBCMD_SET_END
+                              );
+
+SHELL_CMD_REGISTER(perf, &sub_perf, "CPU, stack, heap and zbus profiling", NULL);
@@ -364,8 +364,9 @@ static int cmd_app_list(const struct shell *sh, size_t argc, char **argv)
                     state_str = "unknown";
                     break;
             }
-            shell_print(sh, "  [%d] %s (%s)%s", i, app->name, state_str,
-                        app->hidden ? " [hidden]" : "");
+            shell_print(sh, "  [%d] %s (%s)%s%s%s", i, app->name, state_str,
+                        app->hidden ? " [hidden]" : "", app->background ? " [background]" : "",
+                        app->initialized ? " [initialized]" : "");
         }
     }
     return 0;
@@ -0,0 +1,45 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#ifdef CONFIG_ARCH_POSIX
+#include <time.h>
+#endif
+
+/**
+ * @brief Get a timestamp for measuring execution time in microseconds.
+ *
+ * On native_sim simulated time does not advance while code executes,
+ * so the host monotonic clock is used there instead of the kernel cycle counter.
+ * The 64-bit cycle counter is used elsewhere so the conversion does not wrap.
+ *
+ * @return Timestamp in microseconds, only meaningful as a difference.
+ */
+static inline uint32_t zsw_timing_get_us(void)
+{
+#ifdef CONFIG_ARCH_POSIX
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * USEC_PER_SEC + ts.tv_nsec / NSEC_PER_USEC);
+#else
+    return (uint32_t)k_cyc_to_us_floor64(k_cycle_get_64());
+#endif
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/logging/log.h>
+
+#include "zsw_zbus_trace.h"
+#include "zsw_timing.h"
+
+LOG_MODULE_REGISTER(zsw_zbus_trace, LOG_LEVEL_WRN);
+
+#define HIST_FIRST_LIMIT_SHIFT  4
+
+static sys_slist_t listeners = SYS_SLIST_STATIC_INIT(&listeners);
+static struct k_spinlock lock;
+
+static int hist_bucket(uint32_t duration_us)
+{
+    for (int i = 0; i < ZSW_ZBUS_TRACE_HIST_BUCKETS - 1; i++) {
+        if (duration_us < zsw_zbus_trace_hist_limit_us(i)) {
+            return i;
+        }
+    }
+
+    return ZSW_ZBUS_TRACE_HIST_BUCKETS - 1;
+}
+
+uint32_t zsw_zbus_trace_hist_limit_us(int bucket)
+{
+    if (bucket >= ZSW_ZBUS_TRACE_HIST_BUCKETS - 1) {
+        return UINT32_MAX;
+    }
+
+    return BIT(bucket + HIST_FIRST_LIMIT_SHIFT);
+}
+
+void zsw_zbus_trace_run(zsw_zbus_trace_listener_t *listener, zsw_zbus_trace_listener_cb_t cb,
+                        const struct zbus_channel *chan)
+{
+    k_spinlock_key_t key;
+    uint32_t latency_us;
+    uint32_t start;
+    uint32_t duration_us;
+    bool new_max_over_budget = false;
+
+    // Publish time is stamped by zbus itself, the delay is time spent in listeners before this one.
+    latency_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks() - zbus_chan_pub_stats_last_time(chan));
+
+    start = zsw_timing_get_us();
+    cb(chan);
+    duration_us = zsw_timing_get_us() - start;
+
+    key = k_spin_lock(&lock);
+    if (!listener->registered) {
+        sys_slist_append(&listeners, &listener->node);
+        listener->registered = true;
+    }
+    listener->count++;
+    listener->exec_sum_us += duration_us;
+    listener->latency_sum_us += latency_us;
+    listener->latency_max_us = MAX(listener->latency_max_us, latency_us);
+    listener->hist[hist_bucket(duration_us)]++;
+    if (duration_us > CONFIG_ZSW_ZBUS_TRACE_LISTENER_BUDGET_US) {
+        listener->over_budget++;
+        new_max_over_budget = duration_us > listener->exec_max_us;
+    }
+    if (duration_us > listener->exec_max_us) {
+        listener->exec_max_us = duration_us;
+        listener->max_chan = chan;
+    }
+    k_spin_unlock(&lock, key);
+
+    // Only warn when the worst case gets worse, listeners can run at high rates.
+    if (new_max_over_budget) {
+        LOG_WRN("%s on %s took %u us (budget %u us)", listener->name, zbus_chan_name(chan), duration_us,
+                CONFIG_ZSW_ZBUS_TRACE_LISTENER_BUDGET_US);
+    }
+}
+
+void zsw_zbus_trace_foreach(zsw_zbus_trace_foreach_cb_t cb, void *user_data)
+{
+    zsw_zbus_trace_listener_t *listener;
+    zsw_zbus_trace_listener_t copy;
+    k_spinlock_key_t key;
+
+    // Listeners are never removed, so the list can be walked while copying each entry under the lock.
+    SYS_SLIST_FOR_EACH_CONTAINER(&listeners, listener, node) {
+        key = k_spin_lock(&lock);
+        copy = *listener;
+        k_spin_unlock(&lock, key);
+        cb(&copy, user_data);
+    }
+}
+
+void zsw_zbus_trace_reset(void)
+{
+    zsw_zbus_trace_listener_t *listener;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&listeners, listener, node) {
+        listener->count = 0;
+        listener->over_budget = 0;
+        listener->exec_sum_us = 0;
+        listener->exec_max_us = 0;
+        listener->latency_sum_us = 0;
+        listener->latency_max_us = 0;
+        listener->max_chan = NULL;
+        memset(listener->hist, 0, sizeof(listener->hist));
+    }
+
+    k_spin_unlock(&lock, key);
+}
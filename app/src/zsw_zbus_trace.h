@@ -0,0 +1,102 @@
+/*
+ * This file is part of ZSWatch project <https://github.com/zswatch/>.
+ * Copyright (c) 2025 ZSWatch Project.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+
+/* Bucket i counts executions shorter than 2^(i + 4) us, the last bucket counts the rest. */
+#define ZSW_ZBUS_TRACE_HIST_BUCKETS     12
+
+/** @brief Execution statistics for one zbus listener.
+*/
+typedef struct {
+    sys_snode_t node;
+    const char *name;
+    bool registered;
+    uint32_t count;                                     /**< Number of executions. */
+    uint32_t over_budget;                               /**< Executions longer than the budget. */
+    uint64_t exec_sum_us;
+    uint32_t exec_max_us;
+    uint64_t latency_sum_us;                            /**< Sum of publish to listener start delays. */
+    uint32_t latency_max_us;
+    uint32_t hist[ZSW_ZBUS_TRACE_HIST_BUCKETS];         /**< Execution time histogram. */
+    const struct zbus_channel *max_chan;                /**< Channel of the slowest execution. */
+} zsw_zbus_trace_listener_t;
+
+typedef void (*zsw_zbus_trace_listener_cb_t)(const struct zbus_channel *chan);
+typedef void (*zsw_zbus_trace_foreach_cb_t)(const zsw_zbus_trace_listener_t *listener, void *user_data);
+
+#ifdef CONFIG_ZSW_ZBUS_TRACE
+
+/** @brief          Run a listener callback and record its execution time.
+ *                  Used by ZSW_ZBUS_LISTENER_DEFINE, not meant to be called directly.
+ *  @param listener Statistics of the listener
+ *  @param cb       The listener callback
+ *  @param chan     Channel that was published
+*/
+void zsw_zbus_trace_run(zsw_zbus_trace_listener_t *listener, zsw_zbus_trace_listener_cb_t cb,
+                        const struct zbus_channel *chan);
+
+/** @brief          Iterate over all listeners that have executed at least once.
+ *  @param cb       Called for every listener
+ *  @param user_data Passed to cb
+*/
+void zsw_zbus_trace_foreach(zsw_zbus_trace_foreach_cb_t cb, void *user_data);
+
+/** @brief          Clear the statistics of all listeners.
+*/
+void zsw_zbus_trace_reset(void);
+
+/** @brief          Get the upper limit of a histogram bucket.
+ *  @param bucket   Bucket index
+ *  @return         Upper limit in us, UINT32_MAX for the last bucket
+*/
+uint32_t zsw_zbus_trace_hist_limit_us(int bucket);
+
+#define _ZSW_ZBUS_TRACE_WRAP(_name, _cb)                                                    \
+    static zsw_zbus_trace_listener_t _CONCAT(_name, _trace) = {                             \
+        .name = STRINGIFY(_name),                                                           \
+    };                                                                                      \
+    static void _CONCAT(_name, _trace_cb)(const struct zbus_channel *chan)                  \
+    {                                                                                       \
+        zsw_zbus_trace_run(&_CONCAT(_name, _trace), _cb, chan);                             \
+    }
+
+/** @brief Same as ZBUS_LISTENER_DEFINE, but measures the listener when CONFIG_ZSW_ZBUS_TRACE is enabled.
+*/
+#define ZSW_ZBUS_LISTENER_DEFINE(_name, _cb)                                                \
+    _ZSW_ZBUS_TRACE_WRAP(_name, _cb)                                                        \
+    ZBUS_LISTENER_DEFINE(_name, _CONCAT(_name, _trace_cb))
+
+/** @brief Same as ZBUS_LISTENER_DEFINE_WITH_ENABLE, but measures the listener when CONFIG_ZSW_ZBUS_TRACE is enabled.
+*/
+#define ZSW_ZBUS_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _enable)                           \
+    _ZSW_ZBUS_TRACE_WRAP(_name, _cb)                                                        \
+    ZBUS_LISTENER_DEFINE_WITH_ENABLE(_name, _CONCAT(_name, _trace_cb), _enable)
+
+#else
+
+#define ZSW_ZBUS_LISTENER_DEFINE(_name, _cb) ZBUS_LISTENER_DEFINE(_name, _cb)
+#define ZSW_ZBUS_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _enable) \
+    ZBUS_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _enable)
+
+#endif